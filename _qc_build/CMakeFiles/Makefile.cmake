@@ -0,0 +1,300 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "/root/repo/CTestConfig.cmake"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/cmake/BuildManPages.cmake"
+  "/root/repo/cmake/CheckCCompilerFlag.cmake"
+  "/root/repo/cmake/CheckCXXCompilerFlag.cmake"
+  "/root/repo/cmake/FindBLAS.cmake"
+  "/root/repo/cmake/FindGit.cmake"
+  "/root/repo/cmake/FindLAPACK.cmake"
+  "/root/repo/cmake/FindPthreads.cmake"
+  "/root/repo/cmake/TestAVX512.c"
+  "/root/repo/cmake/TestClangVersion.c"
+  "/root/repo/cmake/ThreadMPI.cmake"
+  "/root/repo/cmake/cmake_uninstall.cmake.in"
+  "/root/repo/cmake/gmxBuildTypeReference.cmake"
+  "/root/repo/cmake/gmxCFlags.cmake"
+  "/root/repo/cmake/gmxDetectAcceleration.cmake"
+  "/root/repo/cmake/gmxDetectClang30.cmake"
+  "/root/repo/cmake/gmxGCC44O3BugWorkaround.cmake"
+  "/root/repo/cmake/gmxGetCompilerInfo.cmake"
+  "/root/repo/cmake/gmxManageGPU.cmake"
+  "/root/repo/cmake/gmxManageMPI.cmake"
+  "/root/repo/cmake/gmxSetBuildInformation.cmake"
+  "/root/repo/cmake/gmxTestCXX11.cmake"
+  "/root/repo/cmake/gmxTestFloatFormat.cmake"
+  "/root/repo/cmake/gmxTestInline.cmake"
+  "/root/repo/cmake/gmxTestInlineASM.cmake"
+  "/root/repo/cmake/gmxTestIsfinite.cmake"
+  "/root/repo/cmake/gmxTestLargeFiles.cmake"
+  "/root/repo/cmake/gmxTestPipes.cmake"
+  "/root/repo/cmake/gmxTestRestrict.cmake"
+  "/root/repo/cmake/gmxTestSignal.cmake"
+  "/root/repo/cmake/gmxTestXDR.cmake"
+  "/root/repo/cmake/gmxTestdlopen.cmake"
+  "/root/repo/doxygen/CMakeLists.txt"
+  "/root/repo/man/man7/gromacs.7.cmakein"
+  "/root/repo/scripts/CMakeLists.txt"
+  "/root/repo/scripts/GMXRC.bash.cmakein"
+  "/root/repo/scripts/GMXRC.cmakein"
+  "/root/repo/scripts/GMXRC.csh.cmakein"
+  "/root/repo/scripts/GMXRC.zsh.cmakein"
+  "/root/repo/share/CMakeLists.txt"
+  "/root/repo/share/template/CMakeLists.txt"
+  "/root/repo/share/template/cmake/FindGROMACS.cmakein"
+  "/root/repo/src/CMakeLists.txt"
+  "/root/repo/src/buildinfo.h.cmakein"
+  "/root/repo/src/config.h.cmakein"
+  "/root/repo/src/contrib/CMakeLists.txt"
+  "/root/repo/src/external/gmock-1.6.0/CMakeLists.txt"
+  "/root/repo/src/gromacs/CMakeLists.txt"
+  "/root/repo/src/gromacs/analysisdata/CMakeLists.txt"
+  "/root/repo/src/gromacs/analysisdata/modules/CMakeLists.txt"
+  "/root/repo/src/gromacs/analysisdata/tests/CMakeLists.txt"
+  "/root/repo/src/gromacs/commandline/CMakeLists.txt"
+  "/root/repo/src/gromacs/commandline/tests/CMakeLists.txt"
+  "/root/repo/src/gromacs/gmxlib/CMakeLists.txt"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/CMakeLists.txt"
+  "/root/repo/src/gromacs/gmxlib/tests/CMakeLists.txt"
+  "/root/repo/src/gromacs/gmxpreprocess/CMakeLists.txt"
+  "/root/repo/src/gromacs/legacyheaders/CMakeLists.txt"
+  "/root/repo/src/gromacs/libgromacs.pc.cmakein"
+  "/root/repo/src/gromacs/linearalgebra/CMakeLists.txt"
+  "/root/repo/src/gromacs/mdlib/CMakeLists.txt"
+  "/root/repo/src/gromacs/mdlib/tests/CMakeLists.txt"
+  "/root/repo/src/gromacs/onlinehelp/CMakeLists.txt"
+  "/root/repo/src/gromacs/onlinehelp/tests/CMakeLists.txt"
+  "/root/repo/src/gromacs/options/CMakeLists.txt"
+  "/root/repo/src/gromacs/options/tests/CMakeLists.txt"
+  "/root/repo/src/gromacs/selection/CMakeLists.txt"
+  "/root/repo/src/gromacs/selection/tests/CMakeLists.txt"
+  "/root/repo/src/gromacs/trajectoryanalysis/CMakeLists.txt"
+  "/root/repo/src/gromacs/trajectoryanalysis/tests/CMakeLists.txt"
+  "/root/repo/src/gromacs/utility/CMakeLists.txt"
+  "/root/repo/src/gromacs/utility/gmx_header_config_gen.h.cmakein"
+  "/root/repo/src/gromacs/utility/tests/CMakeLists.txt"
+  "/root/repo/src/gromacs/version.h.cmakein"
+  "/root/repo/src/ngmx/CMakeLists.txt"
+  "/root/repo/src/programs/CMakeLists.txt"
+  "/root/repo/src/programs/g_protonate/CMakeLists.txt"
+  "/root/repo/src/programs/g_x2top/CMakeLists.txt"
+  "/root/repo/src/programs/gmx/CMakeLists.txt"
+  "/root/repo/src/programs/gmx/CreateLinks.cmake.cmakein"
+  "/root/repo/src/programs/gmxcheck/CMakeLists.txt"
+  "/root/repo/src/programs/gmxdump/CMakeLists.txt"
+  "/root/repo/src/programs/grompp/CMakeLists.txt"
+  "/root/repo/src/programs/mdrun/CMakeLists.txt"
+  "/root/repo/src/programs/pdb2gmx/CMakeLists.txt"
+  "/root/repo/src/programs/tpbconv/CMakeLists.txt"
+  "/root/repo/src/testutils/CMakeLists.txt"
+  "/root/repo/src/testutils/TestMacros.cmake"
+  "/root/repo/src/testutils/tests/CMakeLists.txt"
+  "/root/repo/src/tools/CMakeLists.txt"
+  "/root/repo/src/tools/libgmxana.pc.cmakein"
+  "/root/repo/tests/CMakeLists.txt"
+  "/usr/lib/x86_64-linux-gnu/cmake/Boost-1.74.0/BoostConfig.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/Boost-1.74.0/BoostConfigVersion.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_headers-1.74.0/boost_headers-config-version.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_headers-1.74.0/boost_headers-config.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeParseImplicitLinkInfo.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CPack.cmake"
+  "/usr/share/cmake-3.25/Modules/CPackComponent.cmake"
+  "/usr/share/cmake-3.25/Modules/CTest.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestTargets.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestUseLaunchers.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckFortranFunctionExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckFunctionExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFileCXX.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckTypeSize.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Dart.cmake"
+  "/usr/share/cmake-3.25/Modules/DartConfiguration.tcl.in"
+  "/usr/share/cmake-3.25/Modules/FindBoost.cmake"
+  "/usr/share/cmake-3.25/Modules/FindCUDA.cmake"
+  "/usr/share/cmake-3.25/Modules/FindCUDA/select_compute_arch.cmake"
+  "/usr/share/cmake-3.25/Modules/FindDart.cmake"
+  "/usr/share/cmake-3.25/Modules/FindDoxygen.cmake"
+  "/usr/share/cmake-3.25/Modules/FindLibXml2.cmake"
+  "/usr/share/cmake-3.25/Modules/FindOpenMP.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPkgConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPythonInterp.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/TestBigEndian.cmake"
+  "/usr/share/cmake-3.25/Templates/CPackConfig.cmake.in"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "DartConfiguration.tcl"
+  "CPackConfig.cmake"
+  "CPackSourceConfig.cmake"
+  "cmake/cmake_uninstall.cmake"
+  "DartConfiguration.tcl"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "doxygen/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "share/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "share/template/cmake/FindGROMACS.cmake"
+  "share/template/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/config.h"
+  "src/buildinfo.h"
+  "man/man7/gromacs.7"
+  "src/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/external/gmock-1.6.0/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/testutils/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/testutils/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/gromacs/version.h"
+  "src/gromacs/libgromacs.pc"
+  "src/gromacs/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/gromacs/legacyheaders/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/gromacs/gmxlib/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/gromacs/gmxlib/nonbonded/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/gromacs/gmxlib/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/gromacs/mdlib/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/gromacs/mdlib/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/gromacs/gmxpreprocess/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/gromacs/analysisdata/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/gromacs/analysisdata/modules/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/gromacs/analysisdata/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/gromacs/commandline/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/gromacs/commandline/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/gromacs/linearalgebra/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/gromacs/onlinehelp/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/gromacs/onlinehelp/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/gromacs/options/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/gromacs/options/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/gromacs/selection/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/gromacs/selection/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/gromacs/trajectoryanalysis/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/gromacs/trajectoryanalysis/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/gromacs/utility/gmx_header_config_gen.h"
+  "src/gromacs/utility/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/gromacs/utility/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/programs/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/programs/mdrun/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/programs/gmx/CreateLinks.cmake"
+  "src/programs/gmx/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/programs/g_protonate/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/programs/g_x2top/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/programs/gmxcheck/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/programs/gmxdump/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/programs/grompp/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/programs/pdb2gmx/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/programs/tpbconv/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/tools/libgmxana.pc"
+  "src/tools/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/ngmx/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/contrib/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "scripts/GMXRC"
+  "scripts/GMXRC.bash"
+  "scripts/GMXRC.csh"
+  "scripts/GMXRC.zsh"
+  "scripts/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/Experimental.dir/DependInfo.cmake"
+  "CMakeFiles/Nightly.dir/DependInfo.cmake"
+  "CMakeFiles/Continuous.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyMemoryCheck.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyStart.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyBuild.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyTest.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/NightlySubmit.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalStart.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalBuild.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalTest.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalSubmit.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousStart.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousBuild.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousTest.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousSubmit.dir/DependInfo.cmake"
+  "CMakeFiles/uninstall.dir/DependInfo.cmake"
+  "doxygen/CMakeFiles/depgraphs.dir/DependInfo.cmake"
+  "doxygen/CMakeFiles/depcheck.dir/DependInfo.cmake"
+  "share/template/CMakeFiles/template.dir/DependInfo.cmake"
+  "src/CMakeFiles/tests.dir/DependInfo.cmake"
+  "src/external/gmock-1.6.0/CMakeFiles/gmock.dir/DependInfo.cmake"
+  "src/testutils/CMakeFiles/testutils.dir/DependInfo.cmake"
+  "src/testutils/tests/CMakeFiles/testutils-test.dir/DependInfo.cmake"
+  "src/gromacs/CMakeFiles/gmx_version.dir/DependInfo.cmake"
+  "src/gromacs/CMakeFiles/libgromacs.dir/DependInfo.cmake"
+  "src/gromacs/gmxlib/tests/CMakeFiles/gmxlib-test.dir/DependInfo.cmake"
+  "src/gromacs/mdlib/tests/CMakeFiles/mdlib-test.dir/DependInfo.cmake"
+  "src/gromacs/analysisdata/tests/CMakeFiles/analysisdata-test.dir/DependInfo.cmake"
+  "src/gromacs/commandline/tests/CMakeFiles/commandline-test.dir/DependInfo.cmake"
+  "src/gromacs/onlinehelp/tests/CMakeFiles/onlinehelp-test.dir/DependInfo.cmake"
+  "src/gromacs/options/tests/CMakeFiles/options-test.dir/DependInfo.cmake"
+  "src/gromacs/selection/tests/CMakeFiles/selection-test.dir/DependInfo.cmake"
+  "src/gromacs/trajectoryanalysis/tests/CMakeFiles/trajectoryanalysis-test.dir/DependInfo.cmake"
+  "src/gromacs/trajectoryanalysis/tests/CMakeFiles/test_selection.dir/DependInfo.cmake"
+  "src/gromacs/utility/tests/CMakeFiles/utility-test.dir/DependInfo.cmake"
+  "src/programs/mdrun/CMakeFiles/mdrun.dir/DependInfo.cmake"
+  "src/programs/mdrun/CMakeFiles/install-mdrun.dir/DependInfo.cmake"
+  "src/programs/gmx/CMakeFiles/gmx.dir/DependInfo.cmake"
+  "src/programs/gmx/CMakeFiles/links.dir/DependInfo.cmake"
+  "src/programs/g_protonate/CMakeFiles/g_protonate.dir/DependInfo.cmake"
+  "src/programs/g_x2top/CMakeFiles/g_x2top.dir/DependInfo.cmake"
+  "src/programs/gmxcheck/CMakeFiles/gmxcheck.dir/DependInfo.cmake"
+  "src/programs/gmxdump/CMakeFiles/gmxdump.dir/DependInfo.cmake"
+  "src/programs/grompp/CMakeFiles/grompp.dir/DependInfo.cmake"
+  "src/programs/pdb2gmx/CMakeFiles/pdb2gmx.dir/DependInfo.cmake"
+  "src/programs/tpbconv/CMakeFiles/tpbconv.dir/DependInfo.cmake"
+  "src/tools/CMakeFiles/gmxana.dir/DependInfo.cmake"
+  "src/tools/CMakeFiles/g_tune_pme.dir/DependInfo.cmake"
+  "src/tools/CMakeFiles/g_pme_error.dir/DependInfo.cmake"
+  )
@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/depcheck"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/depcheck.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
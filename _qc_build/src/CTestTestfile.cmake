@@ -0,0 +1,13 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src
+# Build directory: /root/repo/_qc_build/src
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("external/gmock-1.6.0")
+subdirs("testutils")
+subdirs("gromacs")
+subdirs("programs")
+subdirs("tools")
+subdirs("ngmx")
+subdirs("contrib")
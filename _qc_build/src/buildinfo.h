@@ -0,0 +1,49 @@
+/*! \internal \file
+ * \brief
+ * Build information from the build system.
+ *
+ * Used for log and version output.
+ */
+
+/** Hardware and OS version for build host */
+#define BUILD_HOST              "Linux 6.18.44-fc-v139 x86_64"
+
+/** Date and time for build */
+#define BUILD_TIME              "Sat Oct 17 18:06:53 UTC 2026"
+
+/** User doing build */
+#define BUILD_USER              "root@vm [CMAKE]"
+
+/** CPU vendor for build host */
+#define BUILD_CPU_VENDOR        "GenuineIntel"
+
+/** CPU brand for build host */
+#define BUILD_CPU_BRAND         "Intel(R) Xeon(R) Processor"
+
+/** CPU family for build host */
+#define BUILD_CPU_FAMILY        6
+
+/** CPU model for build host */
+#define BUILD_CPU_MODEL         207
+
+/** CPU stepping for build host */
+#define BUILD_CPU_STEPPING      2
+
+/** CPU feature list for build host */
+#define BUILD_CPU_FEATURES      "aes apic avx avx2 avx512f clfsh cmov cx8 cx16 f16c fma lahf_lm mmx msr nonstop_tsc pcid pclmuldq pdpe1gb popcnt pse rdrnd rdtscp sse2 sse3 sse4.1 sse4.2 ssse3 tdt x2apic"
+
+/** C compiler used to build */
+#define BUILD_C_COMPILER        "/usr/bin/cc GNU cc (Debian 12.2.0-14+deb12u1) 12.2.0"
+
+/** C compiler flags used to build */
+#define BUILD_CFLAGS            "-mavx512f -mavx  -Wextra -Wno-missing-field-initializers -Wno-sign-compare -Wall -Wno-unused -Wunused-value   -fomit-frame-pointer -funroll-all-loops -fexcess-precision=fast  -O3 -DNDEBUG"
+
+/** C++ compiler flags used to build, or empty string if no C++ */
+#define BUILD_CXX_COMPILER      "/usr/bin/c++ GNU c++ (Debian 12.2.0-14+deb12u1) 12.2.0"
+
+/** C++ compiler flags used to build */
+#define BUILD_CXXFLAGS          "-mavx512f -mavx -std=c++0x  -Wextra -Wno-missing-field-initializers -Wnon-virtual-dtor -Wall -Wno-unused -Wunused-value   -fomit-frame-pointer -funroll-all-loops -fexcess-precision=fast  -O3 -DNDEBUG"
+
+/** CUDA nvcc compiler version information */
+#define CUDA_NVCC_COMPILER_INFO ""
+
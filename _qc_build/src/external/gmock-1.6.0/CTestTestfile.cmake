@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/external/gmock-1.6.0
+# Build directory: /root/repo/_qc_build/src/external/gmock-1.6.0
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/gmx_version"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/gmx_version.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
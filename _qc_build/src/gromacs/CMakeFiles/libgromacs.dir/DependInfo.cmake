@@ -0,0 +1,598 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/external/fftpack/fftpack.c" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/fftpack/fftpack.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/fftpack/fftpack.c.o.d"
+  "/root/repo/src/external/vmd_molfile/vmddlopen.c" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/vmd_molfile/vmddlopen.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/__/external/vmd_molfile/vmddlopen.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/3dview.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/3dview.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/3dview.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/atomprop.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/atomprop.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/atomprop.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/bondfree.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/bondfree.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/bondfree.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/calcgrid.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/calcgrid.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/calcgrid.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/calch.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/calch.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/calch.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/chargegroup.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/chargegroup.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/chargegroup.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/checkpoint.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/checkpoint.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/checkpoint.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/cinvsqrtdata.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/cinvsqrtdata.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/cinvsqrtdata.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/confio.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/confio.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/confio.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/copyrite.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/copyrite.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/copyrite.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/crecipdata.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/crecipdata.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/crecipdata.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/disre.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/disre.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/disre.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/do_fit.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/do_fit.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/do_fit.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/enxio.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/enxio.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/enxio.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/ewald_util.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/ewald_util.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/ewald_util.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/filenm.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/filenm.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/filenm.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/futil.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/futil.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/futil.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/gbutil.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/gbutil.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/gbutil.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/gmx_cpuid.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/gmx_cpuid.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/gmx_cpuid.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/gmx_cyclecounter.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/gmx_cyclecounter.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/gmx_cyclecounter.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/gmx_detect_hardware.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/gmx_detect_hardware.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/gmx_detect_hardware.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/gmx_fatal.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/gmx_fatal.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/gmx_fatal.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/gmx_omp.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/gmx_omp.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/gmx_omp.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/gmx_omp_nthreads.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/gmx_omp_nthreads.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/gmx_omp_nthreads.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/gmx_random.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/gmx_random.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/gmx_random.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/gmx_sort.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/gmx_sort.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/gmx_sort.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/gmx_system_xdr.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/gmx_system_xdr.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/gmx_system_xdr.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/gmxcpp.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/gmxcpp.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/gmxcpp.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/gmxfio.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/gmxfio.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/gmxfio.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/gmxfio_asc.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/gmxfio_asc.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/gmxfio_asc.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/gmxfio_bin.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/gmxfio_bin.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/gmxfio_bin.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/gmxfio_rw.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/gmxfio_rw.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/gmxfio_rw.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/gmxfio_xdr.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/gmxfio_xdr.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/gmxfio_xdr.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/ifunc.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/ifunc.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/ifunc.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/index.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/index.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/index.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/inputrec.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/inputrec.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/inputrec.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/invblock.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/invblock.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/invblock.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/libxdrf.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/libxdrf.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/libxdrf.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/main.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/main.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/main.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/maths.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/maths.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/maths.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/matio.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/matio.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/matio.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/md5.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/md5.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/md5.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/md_logging.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/md_logging.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/md_logging.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/mshift.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/mshift.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/mshift.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/mtop_util.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/mtop_util.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/mtop_util.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/mvdata.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/mvdata.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/mvdata.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/names.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/names.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/names.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/network.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/network.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/network.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_free_energy.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_free_energy.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_free_energy.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_generic.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_generic.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_generic.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_generic_adress.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_generic_adress.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_generic_adress.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_generic_cg.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_generic_cg.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_generic_cg.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCSTab_VdwCSTab_GeomP1P1_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCSTab_VdwCSTab_GeomP1P1_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCSTab_VdwCSTab_GeomP1P1_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCSTab_VdwCSTab_GeomW3P1_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCSTab_VdwCSTab_GeomW3P1_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCSTab_VdwCSTab_GeomW3P1_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCSTab_VdwCSTab_GeomW3W3_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCSTab_VdwCSTab_GeomW3W3_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCSTab_VdwCSTab_GeomW3W3_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCSTab_VdwCSTab_GeomW4P1_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCSTab_VdwCSTab_GeomW4P1_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCSTab_VdwCSTab_GeomW4P1_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCSTab_VdwCSTab_GeomW4W4_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCSTab_VdwCSTab_GeomW4W4_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCSTab_VdwCSTab_GeomW4W4_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCSTab_VdwLJ_GeomP1P1_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCSTab_VdwLJ_GeomP1P1_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCSTab_VdwLJ_GeomP1P1_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCSTab_VdwLJ_GeomW3P1_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCSTab_VdwLJ_GeomW3P1_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCSTab_VdwLJ_GeomW3P1_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCSTab_VdwLJ_GeomW3W3_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCSTab_VdwLJ_GeomW3W3_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCSTab_VdwLJ_GeomW3W3_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCSTab_VdwLJ_GeomW4P1_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCSTab_VdwLJ_GeomW4P1_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCSTab_VdwLJ_GeomW4P1_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCSTab_VdwLJ_GeomW4W4_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCSTab_VdwLJ_GeomW4W4_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCSTab_VdwLJ_GeomW4W4_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCSTab_VdwNone_GeomP1P1_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCSTab_VdwNone_GeomP1P1_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCSTab_VdwNone_GeomP1P1_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCSTab_VdwNone_GeomW3P1_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCSTab_VdwNone_GeomW3P1_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCSTab_VdwNone_GeomW3P1_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCSTab_VdwNone_GeomW3W3_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCSTab_VdwNone_GeomW3W3_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCSTab_VdwNone_GeomW3W3_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCSTab_VdwNone_GeomW4P1_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCSTab_VdwNone_GeomW4P1_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCSTab_VdwNone_GeomW4P1_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCSTab_VdwNone_GeomW4W4_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCSTab_VdwNone_GeomW4W4_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCSTab_VdwNone_GeomW4W4_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCoul_VdwCSTab_GeomP1P1_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCoul_VdwCSTab_GeomP1P1_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCoul_VdwCSTab_GeomP1P1_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCoul_VdwCSTab_GeomW3P1_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCoul_VdwCSTab_GeomW3P1_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCoul_VdwCSTab_GeomW3P1_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCoul_VdwCSTab_GeomW3W3_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCoul_VdwCSTab_GeomW3W3_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCoul_VdwCSTab_GeomW3W3_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCoul_VdwCSTab_GeomW4P1_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCoul_VdwCSTab_GeomW4P1_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCoul_VdwCSTab_GeomW4P1_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCoul_VdwCSTab_GeomW4W4_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCoul_VdwCSTab_GeomW4W4_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCoul_VdwCSTab_GeomW4W4_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCoul_VdwLJ_GeomP1P1_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCoul_VdwLJ_GeomP1P1_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCoul_VdwLJ_GeomP1P1_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCoul_VdwLJ_GeomW3P1_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCoul_VdwLJ_GeomW3P1_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCoul_VdwLJ_GeomW3P1_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCoul_VdwLJ_GeomW3W3_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCoul_VdwLJ_GeomW3W3_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCoul_VdwLJ_GeomW3W3_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCoul_VdwLJ_GeomW4P1_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCoul_VdwLJ_GeomW4P1_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCoul_VdwLJ_GeomW4P1_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCoul_VdwLJ_GeomW4W4_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCoul_VdwLJ_GeomW4W4_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCoul_VdwLJ_GeomW4W4_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCoul_VdwNone_GeomP1P1_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCoul_VdwNone_GeomP1P1_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCoul_VdwNone_GeomP1P1_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCoul_VdwNone_GeomW3P1_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCoul_VdwNone_GeomW3P1_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCoul_VdwNone_GeomW3P1_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCoul_VdwNone_GeomW3W3_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCoul_VdwNone_GeomW3W3_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCoul_VdwNone_GeomW3W3_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCoul_VdwNone_GeomW4P1_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCoul_VdwNone_GeomW4P1_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCoul_VdwNone_GeomW4P1_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCoul_VdwNone_GeomW4W4_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCoul_VdwNone_GeomW4W4_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCoul_VdwNone_GeomW4W4_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSh_VdwLJSh_GeomP1P1_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSh_VdwLJSh_GeomP1P1_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSh_VdwLJSh_GeomP1P1_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSh_VdwLJSh_GeomW3P1_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSh_VdwLJSh_GeomW3P1_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSh_VdwLJSh_GeomW3P1_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSh_VdwLJSh_GeomW3W3_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSh_VdwLJSh_GeomW3W3_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSh_VdwLJSh_GeomW3W3_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSh_VdwLJSh_GeomW4P1_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSh_VdwLJSh_GeomW4P1_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSh_VdwLJSh_GeomW4P1_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSh_VdwLJSh_GeomW4W4_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSh_VdwLJSh_GeomW4W4_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSh_VdwLJSh_GeomW4W4_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSh_VdwNone_GeomP1P1_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSh_VdwNone_GeomP1P1_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSh_VdwNone_GeomP1P1_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSh_VdwNone_GeomW3P1_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSh_VdwNone_GeomW3P1_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSh_VdwNone_GeomW3P1_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSh_VdwNone_GeomW3W3_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSh_VdwNone_GeomW3W3_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSh_VdwNone_GeomW3W3_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSh_VdwNone_GeomW4P1_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSh_VdwNone_GeomW4P1_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSh_VdwNone_GeomW4P1_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSh_VdwNone_GeomW4W4_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSh_VdwNone_GeomW4W4_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSh_VdwNone_GeomW4W4_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSw_VdwLJSw_GeomP1P1_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSw_VdwLJSw_GeomP1P1_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSw_VdwLJSw_GeomP1P1_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSw_VdwLJSw_GeomW3P1_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSw_VdwLJSw_GeomW3P1_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSw_VdwLJSw_GeomW3P1_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSw_VdwLJSw_GeomW3W3_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSw_VdwLJSw_GeomW3W3_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSw_VdwLJSw_GeomW3W3_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSw_VdwLJSw_GeomW4P1_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSw_VdwLJSw_GeomW4P1_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSw_VdwLJSw_GeomW4P1_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSw_VdwLJSw_GeomW4W4_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSw_VdwLJSw_GeomW4W4_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSw_VdwLJSw_GeomW4W4_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSw_VdwNone_GeomP1P1_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSw_VdwNone_GeomP1P1_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSw_VdwNone_GeomP1P1_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSw_VdwNone_GeomW3P1_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSw_VdwNone_GeomW3P1_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSw_VdwNone_GeomW3P1_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSw_VdwNone_GeomW3W3_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSw_VdwNone_GeomW3W3_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSw_VdwNone_GeomW3W3_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSw_VdwNone_GeomW4P1_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSw_VdwNone_GeomW4P1_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSw_VdwNone_GeomW4P1_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSw_VdwNone_GeomW4W4_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSw_VdwNone_GeomW4W4_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSw_VdwNone_GeomW4W4_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEw_VdwCSTab_GeomP1P1_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEw_VdwCSTab_GeomP1P1_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEw_VdwCSTab_GeomP1P1_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEw_VdwCSTab_GeomW3P1_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEw_VdwCSTab_GeomW3P1_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEw_VdwCSTab_GeomW3P1_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEw_VdwCSTab_GeomW3W3_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEw_VdwCSTab_GeomW3W3_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEw_VdwCSTab_GeomW3W3_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEw_VdwCSTab_GeomW4P1_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEw_VdwCSTab_GeomW4P1_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEw_VdwCSTab_GeomW4P1_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEw_VdwCSTab_GeomW4W4_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEw_VdwCSTab_GeomW4W4_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEw_VdwCSTab_GeomW4W4_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEw_VdwLJ_GeomP1P1_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEw_VdwLJ_GeomP1P1_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEw_VdwLJ_GeomP1P1_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEw_VdwLJ_GeomW3P1_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEw_VdwLJ_GeomW3P1_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEw_VdwLJ_GeomW3P1_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEw_VdwLJ_GeomW3W3_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEw_VdwLJ_GeomW3W3_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEw_VdwLJ_GeomW3W3_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEw_VdwLJ_GeomW4P1_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEw_VdwLJ_GeomW4P1_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEw_VdwLJ_GeomW4P1_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEw_VdwLJ_GeomW4W4_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEw_VdwLJ_GeomW4W4_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEw_VdwLJ_GeomW4W4_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEw_VdwNone_GeomP1P1_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEw_VdwNone_GeomP1P1_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEw_VdwNone_GeomP1P1_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEw_VdwNone_GeomW3P1_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEw_VdwNone_GeomW3P1_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEw_VdwNone_GeomW3P1_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEw_VdwNone_GeomW3W3_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEw_VdwNone_GeomW3W3_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEw_VdwNone_GeomW3W3_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEw_VdwNone_GeomW4P1_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEw_VdwNone_GeomW4P1_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEw_VdwNone_GeomW4P1_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEw_VdwNone_GeomW4W4_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEw_VdwNone_GeomW4W4_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEw_VdwNone_GeomW4W4_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecGB_VdwCSTab_GeomP1P1_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecGB_VdwCSTab_GeomP1P1_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecGB_VdwCSTab_GeomP1P1_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecGB_VdwLJ_GeomP1P1_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecGB_VdwLJ_GeomP1P1_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecGB_VdwLJ_GeomP1P1_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecGB_VdwNone_GeomP1P1_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecGB_VdwNone_GeomP1P1_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecGB_VdwNone_GeomP1P1_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecNone_VdwCSTab_GeomP1P1_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecNone_VdwCSTab_GeomP1P1_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecNone_VdwCSTab_GeomP1P1_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecNone_VdwLJSh_GeomP1P1_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecNone_VdwLJSh_GeomP1P1_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecNone_VdwLJSh_GeomP1P1_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecNone_VdwLJSw_GeomP1P1_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecNone_VdwLJSw_GeomP1P1_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecNone_VdwLJSw_GeomP1P1_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecNone_VdwLJ_GeomP1P1_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecNone_VdwLJ_GeomP1P1_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecNone_VdwLJ_GeomP1P1_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwCSTab_GeomP1P1_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwCSTab_GeomP1P1_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwCSTab_GeomP1P1_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwCSTab_GeomW3P1_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwCSTab_GeomW3P1_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwCSTab_GeomW3P1_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwCSTab_GeomW3W3_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwCSTab_GeomW3W3_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwCSTab_GeomW3W3_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwCSTab_GeomW4P1_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwCSTab_GeomW4P1_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwCSTab_GeomW4P1_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwCSTab_GeomW4W4_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwCSTab_GeomW4W4_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwCSTab_GeomW4W4_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwLJSh_GeomP1P1_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwLJSh_GeomP1P1_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwLJSh_GeomP1P1_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwLJSh_GeomW3P1_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwLJSh_GeomW3P1_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwLJSh_GeomW3P1_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwLJSh_GeomW3W3_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwLJSh_GeomW3W3_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwLJSh_GeomW3W3_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwLJSh_GeomW4P1_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwLJSh_GeomW4P1_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwLJSh_GeomW4P1_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwLJSh_GeomW4W4_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwLJSh_GeomW4W4_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwLJSh_GeomW4W4_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwLJSw_GeomP1P1_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwLJSw_GeomP1P1_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwLJSw_GeomP1P1_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwLJSw_GeomW3P1_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwLJSw_GeomW3P1_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwLJSw_GeomW3P1_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwLJSw_GeomW3W3_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwLJSw_GeomW3W3_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwLJSw_GeomW3W3_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwLJSw_GeomW4P1_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwLJSw_GeomW4P1_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwLJSw_GeomW4P1_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwLJSw_GeomW4W4_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwLJSw_GeomW4W4_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwLJSw_GeomW4W4_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwNone_GeomP1P1_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwNone_GeomP1P1_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwNone_GeomP1P1_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwNone_GeomW3P1_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwNone_GeomW3P1_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwNone_GeomW3P1_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwNone_GeomW3W3_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwNone_GeomW3W3_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwNone_GeomW3W3_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwNone_GeomW4P1_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwNone_GeomW4P1_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwNone_GeomW4P1_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwNone_GeomW4W4_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwNone_GeomW4W4_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwNone_GeomW4W4_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRF_VdwCSTab_GeomP1P1_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRF_VdwCSTab_GeomP1P1_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRF_VdwCSTab_GeomP1P1_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRF_VdwCSTab_GeomW3P1_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRF_VdwCSTab_GeomW3P1_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRF_VdwCSTab_GeomW3P1_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRF_VdwCSTab_GeomW3W3_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRF_VdwCSTab_GeomW3W3_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRF_VdwCSTab_GeomW3W3_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRF_VdwCSTab_GeomW4P1_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRF_VdwCSTab_GeomW4P1_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRF_VdwCSTab_GeomW4P1_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRF_VdwCSTab_GeomW4W4_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRF_VdwCSTab_GeomW4W4_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRF_VdwCSTab_GeomW4W4_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRF_VdwLJ_GeomP1P1_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRF_VdwLJ_GeomP1P1_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRF_VdwLJ_GeomP1P1_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRF_VdwLJ_GeomW3P1_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRF_VdwLJ_GeomW3P1_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRF_VdwLJ_GeomW3P1_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRF_VdwLJ_GeomW3W3_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRF_VdwLJ_GeomW3W3_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRF_VdwLJ_GeomW3W3_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRF_VdwLJ_GeomW4P1_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRF_VdwLJ_GeomW4P1_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRF_VdwLJ_GeomW4P1_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRF_VdwLJ_GeomW4W4_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRF_VdwLJ_GeomW4W4_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRF_VdwLJ_GeomW4W4_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRF_VdwNone_GeomP1P1_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRF_VdwNone_GeomP1P1_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRF_VdwNone_GeomP1P1_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRF_VdwNone_GeomW3P1_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRF_VdwNone_GeomW3P1_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRF_VdwNone_GeomW3P1_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRF_VdwNone_GeomW3W3_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRF_VdwNone_GeomW3W3_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRF_VdwNone_GeomW3W3_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRF_VdwNone_GeomW4P1_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRF_VdwNone_GeomW4P1_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRF_VdwNone_GeomW4P1_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRF_VdwNone_GeomW4W4_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRF_VdwNone_GeomW4W4_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRF_VdwNone_GeomW4W4_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_avx_256_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_avx_256_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_avx_256_single.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwBham_GeomP1P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwBham_GeomP1P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwBham_GeomP1P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwBham_GeomW3P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwBham_GeomW3P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwBham_GeomW3P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwBham_GeomW3W3_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwBham_GeomW3W3_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwBham_GeomW3W3_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwBham_GeomW4P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwBham_GeomW4P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwBham_GeomW4P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwBham_GeomW4W4_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwBham_GeomW4W4_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwBham_GeomW4W4_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwCSTab_GeomP1P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwCSTab_GeomP1P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwCSTab_GeomP1P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwCSTab_GeomW3P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwCSTab_GeomW3P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwCSTab_GeomW3P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwCSTab_GeomW3W3_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwCSTab_GeomW3W3_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwCSTab_GeomW3W3_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwCSTab_GeomW4P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwCSTab_GeomW4P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwCSTab_GeomW4P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwCSTab_GeomW4W4_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwCSTab_GeomW4W4_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwCSTab_GeomW4W4_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwLJ_GeomP1P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwLJ_GeomP1P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwLJ_GeomP1P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwLJ_GeomW3P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwLJ_GeomW3P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwLJ_GeomW3P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwLJ_GeomW3W3_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwLJ_GeomW3W3_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwLJ_GeomW3W3_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwLJ_GeomW4P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwLJ_GeomW4P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwLJ_GeomW4P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwLJ_GeomW4W4_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwLJ_GeomW4W4_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwLJ_GeomW4W4_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwNone_GeomP1P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwNone_GeomP1P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwNone_GeomP1P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwNone_GeomW3P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwNone_GeomW3P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwNone_GeomW3P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwNone_GeomW3W3_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwNone_GeomW3W3_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwNone_GeomW3W3_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwNone_GeomW4P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwNone_GeomW4P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwNone_GeomW4P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwNone_GeomW4W4_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwNone_GeomW4W4_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwNone_GeomW4W4_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwBham_GeomP1P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwBham_GeomP1P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwBham_GeomP1P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwBham_GeomW3P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwBham_GeomW3P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwBham_GeomW3P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwBham_GeomW3W3_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwBham_GeomW3W3_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwBham_GeomW3W3_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwBham_GeomW4P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwBham_GeomW4P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwBham_GeomW4P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwBham_GeomW4W4_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwBham_GeomW4W4_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwBham_GeomW4W4_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwCSTab_GeomP1P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwCSTab_GeomP1P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwCSTab_GeomP1P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwCSTab_GeomW3P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwCSTab_GeomW3P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwCSTab_GeomW3P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwCSTab_GeomW3W3_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwCSTab_GeomW3W3_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwCSTab_GeomW3W3_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwCSTab_GeomW4P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwCSTab_GeomW4P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwCSTab_GeomW4P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwCSTab_GeomW4W4_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwCSTab_GeomW4W4_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwCSTab_GeomW4W4_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwLJ_GeomP1P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwLJ_GeomP1P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwLJ_GeomP1P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwLJ_GeomW3P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwLJ_GeomW3P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwLJ_GeomW3P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwLJ_GeomW3W3_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwLJ_GeomW3W3_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwLJ_GeomW3W3_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwLJ_GeomW4P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwLJ_GeomW4P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwLJ_GeomW4P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwLJ_GeomW4W4_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwLJ_GeomW4W4_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwLJ_GeomW4W4_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwNone_GeomP1P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwNone_GeomP1P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwNone_GeomP1P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwNone_GeomW3P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwNone_GeomW3P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwNone_GeomW3P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwNone_GeomW3W3_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwNone_GeomW3W3_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwNone_GeomW3W3_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwNone_GeomW4P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwNone_GeomW4P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwNone_GeomW4P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwNone_GeomW4W4_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwNone_GeomW4W4_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwNone_GeomW4W4_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwBhamSh_GeomP1P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwBhamSh_GeomP1P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwBhamSh_GeomP1P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwBhamSh_GeomW3P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwBhamSh_GeomW3P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwBhamSh_GeomW3P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwBhamSh_GeomW3W3_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwBhamSh_GeomW3W3_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwBhamSh_GeomW3W3_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwBhamSh_GeomW4P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwBhamSh_GeomW4P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwBhamSh_GeomW4P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwBhamSh_GeomW4W4_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwBhamSh_GeomW4W4_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwBhamSh_GeomW4W4_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwLJSh_GeomP1P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwLJSh_GeomP1P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwLJSh_GeomP1P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwLJSh_GeomW3P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwLJSh_GeomW3P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwLJSh_GeomW3P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwLJSh_GeomW3W3_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwLJSh_GeomW3W3_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwLJSh_GeomW3W3_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwLJSh_GeomW4P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwLJSh_GeomW4P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwLJSh_GeomW4P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwLJSh_GeomW4W4_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwLJSh_GeomW4W4_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwLJSh_GeomW4W4_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwNone_GeomP1P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwNone_GeomP1P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwNone_GeomP1P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwNone_GeomW3P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwNone_GeomW3P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwNone_GeomW3P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwNone_GeomW3W3_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwNone_GeomW3W3_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwNone_GeomW3W3_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwNone_GeomW4P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwNone_GeomW4P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwNone_GeomW4P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwNone_GeomW4W4_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwNone_GeomW4W4_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwNone_GeomW4W4_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwBhamSw_GeomP1P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwBhamSw_GeomP1P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwBhamSw_GeomP1P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwBhamSw_GeomW3P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwBhamSw_GeomW3P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwBhamSw_GeomW3P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwBhamSw_GeomW3W3_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwBhamSw_GeomW3W3_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwBhamSw_GeomW3W3_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwBhamSw_GeomW4P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwBhamSw_GeomW4P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwBhamSw_GeomW4P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwBhamSw_GeomW4W4_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwBhamSw_GeomW4W4_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwBhamSw_GeomW4W4_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwLJSw_GeomP1P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwLJSw_GeomP1P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwLJSw_GeomP1P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwLJSw_GeomW3P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwLJSw_GeomW3P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwLJSw_GeomW3P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwLJSw_GeomW3W3_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwLJSw_GeomW3W3_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwLJSw_GeomW3W3_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwLJSw_GeomW4P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwLJSw_GeomW4P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwLJSw_GeomW4P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwLJSw_GeomW4W4_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwLJSw_GeomW4W4_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwLJSw_GeomW4W4_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwNone_GeomP1P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwNone_GeomP1P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwNone_GeomP1P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwNone_GeomW3P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwNone_GeomW3P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwNone_GeomW3P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwNone_GeomW3W3_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwNone_GeomW3W3_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwNone_GeomW3W3_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwNone_GeomW4P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwNone_GeomW4P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwNone_GeomW4P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwNone_GeomW4W4_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwNone_GeomW4W4_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwNone_GeomW4W4_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwBham_GeomP1P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwBham_GeomP1P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwBham_GeomP1P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwBham_GeomW3P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwBham_GeomW3P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwBham_GeomW3P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwBham_GeomW3W3_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwBham_GeomW3W3_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwBham_GeomW3W3_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwBham_GeomW4P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwBham_GeomW4P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwBham_GeomW4P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwBham_GeomW4W4_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwBham_GeomW4W4_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwBham_GeomW4W4_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwCSTab_GeomP1P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwCSTab_GeomP1P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwCSTab_GeomP1P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwCSTab_GeomW3P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwCSTab_GeomW3P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwCSTab_GeomW3P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwCSTab_GeomW3W3_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwCSTab_GeomW3W3_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwCSTab_GeomW3W3_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwCSTab_GeomW4P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwCSTab_GeomW4P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwCSTab_GeomW4P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwCSTab_GeomW4W4_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwCSTab_GeomW4W4_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwCSTab_GeomW4W4_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwLJ_GeomP1P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwLJ_GeomP1P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwLJ_GeomP1P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwLJ_GeomW3P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwLJ_GeomW3P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwLJ_GeomW3P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwLJ_GeomW3W3_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwLJ_GeomW3W3_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwLJ_GeomW3W3_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwLJ_GeomW4P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwLJ_GeomW4P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwLJ_GeomW4P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwLJ_GeomW4W4_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwLJ_GeomW4W4_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwLJ_GeomW4W4_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwNone_GeomP1P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwNone_GeomP1P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwNone_GeomP1P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwNone_GeomW3P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwNone_GeomW3P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwNone_GeomW3P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwNone_GeomW3W3_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwNone_GeomW3W3_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwNone_GeomW3W3_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwNone_GeomW4P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwNone_GeomW4P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwNone_GeomW4P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwNone_GeomW4W4_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwNone_GeomW4W4_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwNone_GeomW4W4_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecGB_VdwBham_GeomP1P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecGB_VdwBham_GeomP1P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecGB_VdwBham_GeomP1P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecGB_VdwCSTab_GeomP1P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecGB_VdwCSTab_GeomP1P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecGB_VdwCSTab_GeomP1P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecGB_VdwLJ_GeomP1P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecGB_VdwLJ_GeomP1P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecGB_VdwLJ_GeomP1P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecGB_VdwNone_GeomP1P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecGB_VdwNone_GeomP1P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecGB_VdwNone_GeomP1P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecNone_VdwBhamSh_GeomP1P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecNone_VdwBhamSh_GeomP1P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecNone_VdwBhamSh_GeomP1P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecNone_VdwBhamSw_GeomP1P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecNone_VdwBhamSw_GeomP1P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecNone_VdwBhamSw_GeomP1P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecNone_VdwBham_GeomP1P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecNone_VdwBham_GeomP1P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecNone_VdwBham_GeomP1P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecNone_VdwCSTab_GeomP1P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecNone_VdwCSTab_GeomP1P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecNone_VdwCSTab_GeomP1P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecNone_VdwLJSh_GeomP1P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecNone_VdwLJSh_GeomP1P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecNone_VdwLJSh_GeomP1P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecNone_VdwLJSw_GeomP1P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecNone_VdwLJSw_GeomP1P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecNone_VdwLJSw_GeomP1P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecNone_VdwLJ_GeomP1P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecNone_VdwLJ_GeomP1P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecNone_VdwLJ_GeomP1P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSh_GeomP1P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSh_GeomP1P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSh_GeomP1P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSh_GeomW3P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSh_GeomW3P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSh_GeomW3P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSh_GeomW3W3_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSh_GeomW3W3_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSh_GeomW3W3_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSh_GeomW4P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSh_GeomW4P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSh_GeomW4P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSh_GeomW4W4_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSh_GeomW4W4_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSh_GeomW4W4_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSw_GeomP1P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSw_GeomP1P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSw_GeomP1P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSw_GeomW3P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSw_GeomW3P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSw_GeomW3P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSw_GeomW3W3_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSw_GeomW3W3_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSw_GeomW3W3_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSw_GeomW4P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSw_GeomW4P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSw_GeomW4P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSw_GeomW4W4_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSw_GeomW4W4_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSw_GeomW4W4_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwCSTab_GeomP1P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwCSTab_GeomP1P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwCSTab_GeomP1P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwCSTab_GeomW3P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwCSTab_GeomW3P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwCSTab_GeomW3P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwCSTab_GeomW3W3_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwCSTab_GeomW3W3_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwCSTab_GeomW3W3_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwCSTab_GeomW4P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwCSTab_GeomW4P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwCSTab_GeomW4P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwCSTab_GeomW4W4_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwCSTab_GeomW4W4_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwCSTab_GeomW4W4_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSh_GeomP1P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSh_GeomP1P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSh_GeomP1P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSh_GeomW3P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSh_GeomW3P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSh_GeomW3P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSh_GeomW3W3_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSh_GeomW3W3_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSh_GeomW3W3_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSh_GeomW4P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSh_GeomW4P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSh_GeomW4P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSh_GeomW4W4_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSh_GeomW4W4_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSh_GeomW4W4_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSw_GeomP1P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSw_GeomP1P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSw_GeomP1P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSw_GeomW3P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSw_GeomW3P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSw_GeomW3P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSw_GeomW3W3_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSw_GeomW3W3_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSw_GeomW3W3_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSw_GeomW4P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSw_GeomW4P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSw_GeomW4P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSw_GeomW4W4_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSw_GeomW4W4_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSw_GeomW4W4_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwNone_GeomP1P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwNone_GeomP1P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwNone_GeomP1P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwNone_GeomW3P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwNone_GeomW3P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwNone_GeomW3P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwNone_GeomW3W3_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwNone_GeomW3W3_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwNone_GeomW3W3_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwNone_GeomW4P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwNone_GeomW4P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwNone_GeomW4P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwNone_GeomW4W4_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwNone_GeomW4W4_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwNone_GeomW4W4_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwBham_GeomP1P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwBham_GeomP1P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwBham_GeomP1P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwBham_GeomW3P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwBham_GeomW3P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwBham_GeomW3P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwBham_GeomW3W3_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwBham_GeomW3W3_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwBham_GeomW3W3_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwBham_GeomW4P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwBham_GeomW4P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwBham_GeomW4P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwBham_GeomW4W4_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwBham_GeomW4W4_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwBham_GeomW4W4_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwCSTab_GeomP1P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwCSTab_GeomP1P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwCSTab_GeomP1P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwCSTab_GeomW3P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwCSTab_GeomW3P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwCSTab_GeomW3P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwCSTab_GeomW3W3_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwCSTab_GeomW3W3_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwCSTab_GeomW3W3_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwCSTab_GeomW4P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwCSTab_GeomW4P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwCSTab_GeomW4P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwCSTab_GeomW4W4_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwCSTab_GeomW4W4_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwCSTab_GeomW4W4_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwLJ_GeomP1P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwLJ_GeomP1P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwLJ_GeomP1P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwLJ_GeomW3P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwLJ_GeomW3P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwLJ_GeomW3P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwLJ_GeomW3W3_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwLJ_GeomW3W3_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwLJ_GeomW3W3_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwLJ_GeomW4P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwLJ_GeomW4P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwLJ_GeomW4P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwLJ_GeomW4W4_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwLJ_GeomW4W4_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwLJ_GeomW4W4_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwNone_GeomP1P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwNone_GeomP1P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwNone_GeomP1P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwNone_GeomW3P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwNone_GeomW3P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwNone_GeomW3P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwNone_GeomW3W3_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwNone_GeomW3W3_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwNone_GeomW3W3_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwNone_GeomW4P1_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwNone_GeomW4P1_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwNone_GeomW4P1_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwNone_GeomW4W4_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwNone_GeomW4W4_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwNone_GeomW4W4_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_allvsall.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_allvsall.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_allvsall.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_allvsallgb.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_allvsallgb.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_allvsallgb.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nb_kernel_c/nb_kernel_c.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_c.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_c.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nonbonded/nonbonded.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nonbonded.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nonbonded.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nrama.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nrama.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nrama.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nrjac.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nrjac.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nrjac.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/nrnb.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nrnb.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/nrnb.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/orires.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/orires.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/orires.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/pargs.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/pargs.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/pargs.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/pbc.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/pbc.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/pbc.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/pdbio.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/pdbio.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/pdbio.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/physics.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/physics.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/physics.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/princ.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/princ.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/princ.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/rando.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/rando.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/rando.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/random.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/random.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/random.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/rbin.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/rbin.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/rbin.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/readinp.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/readinp.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/readinp.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/rmpbc.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/rmpbc.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/rmpbc.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/sfactor.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/sfactor.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/sfactor.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/shift_util.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/shift_util.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/shift_util.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/sighandler.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/sighandler.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/sighandler.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/smalloc.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/smalloc.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/smalloc.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/sortwater.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/sortwater.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/sortwater.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/splitter.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/splitter.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/splitter.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/statistics/gmx_statistics.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/statistics/gmx_statistics.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/statistics/gmx_statistics.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/statistics/histogram.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/statistics/histogram.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/statistics/histogram.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/strdb.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/strdb.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/strdb.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/string2.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/string2.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/string2.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/symtab.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/symtab.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/symtab.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/tcontrol.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/tcontrol.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/tcontrol.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/thread_mpi/alltoall.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/alltoall.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/alltoall.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/thread_mpi/barrier.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/barrier.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/barrier.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/thread_mpi/bcast.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/bcast.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/bcast.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/thread_mpi/collective.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/collective.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/collective.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/thread_mpi/comm.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/comm.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/comm.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/thread_mpi/errhandler.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/errhandler.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/errhandler.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/thread_mpi/event.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/event.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/event.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/thread_mpi/gather.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/gather.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/gather.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/thread_mpi/group.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/group.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/group.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/thread_mpi/list.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/list.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/list.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/thread_mpi/lock.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/lock.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/lock.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/thread_mpi/numa_malloc.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/numa_malloc.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/numa_malloc.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/thread_mpi/once.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/once.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/once.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/thread_mpi/p2p_protocol.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/p2p_protocol.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/p2p_protocol.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/thread_mpi/p2p_send_recv.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/p2p_send_recv.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/p2p_send_recv.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/thread_mpi/p2p_wait.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/p2p_wait.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/p2p_wait.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/thread_mpi/profile.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/profile.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/profile.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/thread_mpi/pthreads.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/pthreads.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/pthreads.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/thread_mpi/reduce.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/reduce.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/reduce.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/thread_mpi/reduce_fast.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/reduce_fast.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/reduce_fast.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/thread_mpi/scan.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/scan.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/scan.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/thread_mpi/scatter.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/scatter.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/scatter.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/thread_mpi/tmpi_init.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/tmpi_init.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/tmpi_init.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/thread_mpi/tmpi_malloc.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/tmpi_malloc.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/tmpi_malloc.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/thread_mpi/topology.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/topology.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/topology.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/thread_mpi/type.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/type.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/type.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/topsort.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/topsort.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/topsort.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/tpxio.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/tpxio.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/tpxio.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/trnio.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/trnio.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/trnio.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/trxindex.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/trxindex.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/trxindex.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/trxio.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/trxio.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/trxio.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/trxmmap.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/trxmmap.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/trxmmap.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/txtdump.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/txtdump.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/txtdump.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/typedefs.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/typedefs.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/typedefs.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/viewit.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/viewit.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/viewit.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/vmdio.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/vmdio.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/vmdio.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/warninp.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/warninp.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/warninp.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/wgms.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/wgms.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/wgms.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/writeps.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/writeps.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/writeps.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/xdrd.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/xdrd.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/xdrd.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/xtcio.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/xtcio.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/xtcio.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/xtcreadahead.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/xtcreadahead.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/xtcreadahead.c.o.d"
+  "/root/repo/src/gromacs/gmxlib/xvgr.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/xvgr.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/xvgr.c.o.d"
+  "/root/repo/src/gromacs/gmxpreprocess/add_par.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/add_par.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/add_par.c.o.d"
+  "/root/repo/src/gromacs/gmxpreprocess/calc_verletbuf.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/calc_verletbuf.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/calc_verletbuf.c.o.d"
+  "/root/repo/src/gromacs/gmxpreprocess/compute_io.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/compute_io.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/compute_io.c.o.d"
+  "/root/repo/src/gromacs/gmxpreprocess/fflibutil.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/fflibutil.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/fflibutil.c.o.d"
+  "/root/repo/src/gromacs/gmxpreprocess/gen_ad.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/gen_ad.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/gen_ad.c.o.d"
+  "/root/repo/src/gromacs/gmxpreprocess/gen_vsite.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/gen_vsite.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/gen_vsite.c.o.d"
+  "/root/repo/src/gromacs/gmxpreprocess/genhydro.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/genhydro.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/genhydro.c.o.d"
+  "/root/repo/src/gromacs/gmxpreprocess/gpp_atomtype.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/gpp_atomtype.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/gpp_atomtype.c.o.d"
+  "/root/repo/src/gromacs/gmxpreprocess/gpp_bond_atomtype.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/gpp_bond_atomtype.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/gpp_bond_atomtype.c.o.d"
+  "/root/repo/src/gromacs/gmxpreprocess/h_db.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/h_db.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/h_db.c.o.d"
+  "/root/repo/src/gromacs/gmxpreprocess/hackblock.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/hackblock.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/hackblock.c.o.d"
+  "/root/repo/src/gromacs/gmxpreprocess/pdb2top.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/pdb2top.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/pdb2top.c.o.d"
+  "/root/repo/src/gromacs/gmxpreprocess/pgutil.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/pgutil.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/pgutil.c.o.d"
+  "/root/repo/src/gromacs/gmxpreprocess/readadress.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/readadress.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/readadress.c.o.d"
+  "/root/repo/src/gromacs/gmxpreprocess/readir.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/readir.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/readir.c.o.d"
+  "/root/repo/src/gromacs/gmxpreprocess/readpull.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/readpull.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/readpull.c.o.d"
+  "/root/repo/src/gromacs/gmxpreprocess/readrot.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/readrot.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/readrot.c.o.d"
+  "/root/repo/src/gromacs/gmxpreprocess/resall.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/resall.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/resall.c.o.d"
+  "/root/repo/src/gromacs/gmxpreprocess/ter_db.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/ter_db.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/ter_db.c.o.d"
+  "/root/repo/src/gromacs/gmxpreprocess/topdirs.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/topdirs.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/topdirs.c.o.d"
+  "/root/repo/src/gromacs/gmxpreprocess/topexcl.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/topexcl.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/topexcl.c.o.d"
+  "/root/repo/src/gromacs/gmxpreprocess/topio.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/topio.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/topio.c.o.d"
+  "/root/repo/src/gromacs/gmxpreprocess/toppush.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/toppush.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/toppush.c.o.d"
+  "/root/repo/src/gromacs/gmxpreprocess/topshake.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/topshake.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/topshake.c.o.d"
+  "/root/repo/src/gromacs/gmxpreprocess/toputil.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/toputil.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/toputil.c.o.d"
+  "/root/repo/src/gromacs/gmxpreprocess/vsite_parm.c" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/vsite_parm.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxpreprocess/vsite_parm.c.o.d"
+  "/root/repo/src/gromacs/linearalgebra/eigensolver.c" "src/gromacs/CMakeFiles/libgromacs.dir/linearalgebra/eigensolver.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/linearalgebra/eigensolver.c.o.d"
+  "/root/repo/src/gromacs/linearalgebra/gmx_arpack.c" "src/gromacs/CMakeFiles/libgromacs.dir/linearalgebra/gmx_arpack.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/linearalgebra/gmx_arpack.c.o.d"
+  "/root/repo/src/gromacs/linearalgebra/matrix.c" "src/gromacs/CMakeFiles/libgromacs.dir/linearalgebra/matrix.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/linearalgebra/matrix.c.o.d"
+  "/root/repo/src/gromacs/linearalgebra/mtxio.c" "src/gromacs/CMakeFiles/libgromacs.dir/linearalgebra/mtxio.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/linearalgebra/mtxio.c.o.d"
+  "/root/repo/src/gromacs/linearalgebra/sparsematrix.c" "src/gromacs/CMakeFiles/libgromacs.dir/linearalgebra/sparsematrix.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/linearalgebra/sparsematrix.c.o.d"
+  "/root/repo/src/gromacs/mdlib/adress.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/adress.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/adress.c.o.d"
+  "/root/repo/src/gromacs/mdlib/calcmu.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/calcmu.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/calcmu.c.o.d"
+  "/root/repo/src/gromacs/mdlib/calcvir.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/calcvir.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/calcvir.c.o.d"
+  "/root/repo/src/gromacs/mdlib/clincs.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/clincs.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/clincs.c.o.d"
+  "/root/repo/src/gromacs/mdlib/constr.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/constr.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/constr.c.o.d"
+  "/root/repo/src/gromacs/mdlib/coupling.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/coupling.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/coupling.c.o.d"
+  "/root/repo/src/gromacs/mdlib/csettle.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/csettle.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/csettle.c.o.d"
+  "/root/repo/src/gromacs/mdlib/domdec.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/domdec.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/domdec.c.o.d"
+  "/root/repo/src/gromacs/mdlib/domdec_box.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/domdec_box.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/domdec_box.c.o.d"
+  "/root/repo/src/gromacs/mdlib/domdec_con.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/domdec_con.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/domdec_con.c.o.d"
+  "/root/repo/src/gromacs/mdlib/domdec_network.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/domdec_network.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/domdec_network.c.o.d"
+  "/root/repo/src/gromacs/mdlib/domdec_setup.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/domdec_setup.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/domdec_setup.c.o.d"
+  "/root/repo/src/gromacs/mdlib/domdec_top.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/domdec_top.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/domdec_top.c.o.d"
+  "/root/repo/src/gromacs/mdlib/ebin.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/ebin.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/ebin.c.o.d"
+  "/root/repo/src/gromacs/mdlib/edsam.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/edsam.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/edsam.c.o.d"
+  "/root/repo/src/gromacs/mdlib/ewald.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/ewald.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/ewald.c.o.d"
+  "/root/repo/src/gromacs/mdlib/expanded.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/expanded.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/expanded.c.o.d"
+  "/root/repo/src/gromacs/mdlib/force.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/force.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/force.c.o.d"
+  "/root/repo/src/gromacs/mdlib/forcerec.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/forcerec.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/forcerec.c.o.d"
+  "/root/repo/src/gromacs/mdlib/genborn.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/genborn.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/genborn.c.o.d"
+  "/root/repo/src/gromacs/mdlib/genborn_allvsall.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/genborn_allvsall.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/genborn_allvsall.c.o.d"
+  "/root/repo/src/gromacs/mdlib/genborn_allvsall_sse2_double.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/genborn_allvsall_sse2_double.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/genborn_allvsall_sse2_double.c.o.d"
+  "/root/repo/src/gromacs/mdlib/genborn_allvsall_sse2_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/genborn_allvsall_sse2_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/genborn_allvsall_sse2_single.c.o.d"
+  "/root/repo/src/gromacs/mdlib/genborn_sse2_double.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/genborn_sse2_double.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/genborn_sse2_double.c.o.d"
+  "/root/repo/src/gromacs/mdlib/genborn_sse2_single.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/genborn_sse2_single.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/genborn_sse2_single.c.o.d"
+  "/root/repo/src/gromacs/mdlib/gmx_fft.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/gmx_fft.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/gmx_fft.c.o.d"
+  "/root/repo/src/gromacs/mdlib/gmx_fft_fftpack.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/gmx_fft_fftpack.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/gmx_fft_fftpack.c.o.d"
+  "/root/repo/src/gromacs/mdlib/gmx_fft_mkl.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/gmx_fft_mkl.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/gmx_fft_mkl.c.o.d"
+  "/root/repo/src/gromacs/mdlib/gmx_parallel_3dfft.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/gmx_parallel_3dfft.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/gmx_parallel_3dfft.c.o.d"
+  "/root/repo/src/gromacs/mdlib/gmx_wallcycle.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/gmx_wallcycle.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/gmx_wallcycle.c.o.d"
+  "/root/repo/src/gromacs/mdlib/groupcoord.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/groupcoord.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/groupcoord.c.o.d"
+  "/root/repo/src/gromacs/mdlib/init.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/init.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/init.c.o.d"
+  "/root/repo/src/gromacs/mdlib/iteratedconstraints.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/iteratedconstraints.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/iteratedconstraints.c.o.d"
+  "/root/repo/src/gromacs/mdlib/md_support.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/md_support.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/md_support.c.o.d"
+  "/root/repo/src/gromacs/mdlib/mdatom.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/mdatom.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/mdatom.c.o.d"
+  "/root/repo/src/gromacs/mdlib/mdebin.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/mdebin.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/mdebin.c.o.d"
+  "/root/repo/src/gromacs/mdlib/mdebin_bar.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/mdebin_bar.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/mdebin_bar.c.o.d"
+  "/root/repo/src/gromacs/mdlib/minimize.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/minimize.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/minimize.c.o.d"
+  "/root/repo/src/gromacs/mdlib/mvxvf.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/mvxvf.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/mvxvf.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_atomdata.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_atomdata.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_atomdata.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/nbnxn_kernel_common.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/nbnxn_kernel_common.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/nbnxn_kernel_common.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/nbnxn_kernel_gpu_ref.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/nbnxn_kernel_gpu_ref.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/nbnxn_kernel_gpu_ref.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/nbnxn_kernel_ref.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/nbnxn_kernel_ref.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/nbnxn_kernel_ref.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/nbnxn_kernel_x86_simd128.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/nbnxn_kernel_x86_simd128.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/nbnxn_kernel_x86_simd128.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/nbnxn_kernel_x86_simd256.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/nbnxn_kernel_x86_simd256.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/nbnxn_kernel_x86_simd256.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_kernels/nbnxn_kernel_x86_simd512.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/nbnxn_kernel_x86_simd512.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/nbnxn_kernel_x86_simd512.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nbnxn_search.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_search.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nbnxn_search.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nlistheuristics.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nlistheuristics.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nlistheuristics.c.o.d"
+  "/root/repo/src/gromacs/mdlib/ns.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/ns.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/ns.c.o.d"
+  "/root/repo/src/gromacs/mdlib/nsgrid.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nsgrid.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/nsgrid.c.o.d"
+  "/root/repo/src/gromacs/mdlib/partdec.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/partdec.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/partdec.c.o.d"
+  "/root/repo/src/gromacs/mdlib/perf_est.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/perf_est.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/perf_est.c.o.d"
+  "/root/repo/src/gromacs/mdlib/pme.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/pme.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/pme.c.o.d"
+  "/root/repo/src/gromacs/mdlib/pme_pp.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/pme_pp.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/pme_pp.c.o.d"
+  "/root/repo/src/gromacs/mdlib/pull.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/pull.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/pull.c.o.d"
+  "/root/repo/src/gromacs/mdlib/pull_rotation.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/pull_rotation.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/pull_rotation.c.o.d"
+  "/root/repo/src/gromacs/mdlib/pullutil.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/pullutil.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/pullutil.c.o.d"
+  "/root/repo/src/gromacs/mdlib/qm_gamess.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/qm_gamess.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/qm_gamess.c.o.d"
+  "/root/repo/src/gromacs/mdlib/qm_gaussian.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/qm_gaussian.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/qm_gaussian.c.o.d"
+  "/root/repo/src/gromacs/mdlib/qm_mopac.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/qm_mopac.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/qm_mopac.c.o.d"
+  "/root/repo/src/gromacs/mdlib/qm_orca.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/qm_orca.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/qm_orca.c.o.d"
+  "/root/repo/src/gromacs/mdlib/qm_qchem.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/qm_qchem.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/qm_qchem.c.o.d"
+  "/root/repo/src/gromacs/mdlib/qmmm.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/qmmm.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/qmmm.c.o.d"
+  "/root/repo/src/gromacs/mdlib/rf_util.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/rf_util.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/rf_util.c.o.d"
+  "/root/repo/src/gromacs/mdlib/shakef.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/shakef.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/shakef.c.o.d"
+  "/root/repo/src/gromacs/mdlib/shellfc.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/shellfc.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/shellfc.c.o.d"
+  "/root/repo/src/gromacs/mdlib/sim_util.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/sim_util.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/sim_util.c.o.d"
+  "/root/repo/src/gromacs/mdlib/stat.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/stat.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/stat.c.o.d"
+  "/root/repo/src/gromacs/mdlib/tables.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/tables.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/tables.c.o.d"
+  "/root/repo/src/gromacs/mdlib/tgroup.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/tgroup.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/tgroup.c.o.d"
+  "/root/repo/src/gromacs/mdlib/tpi.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/tpi.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/tpi.c.o.d"
+  "/root/repo/src/gromacs/mdlib/update.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/update.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/update.c.o.d"
+  "/root/repo/src/gromacs/mdlib/vcm.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/vcm.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/vcm.c.o.d"
+  "/root/repo/src/gromacs/mdlib/vsite.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/vsite.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/vsite.c.o.d"
+  "/root/repo/src/gromacs/mdlib/wall.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/wall.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/wall.c.o.d"
+  "/root/repo/src/gromacs/mdlib/wnblist.c" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/wnblist.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/wnblist.c.o.d"
+  "/root/repo/_qc_build/src/gromacs/utility/gitversion.c" "src/gromacs/CMakeFiles/libgromacs.dir/utility/gitversion.c.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/utility/gitversion.c.o.d"
+  "/root/repo/src/gromacs/analysisdata/abstractdata.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/analysisdata/abstractdata.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/analysisdata/abstractdata.cpp.o.d"
+  "/root/repo/src/gromacs/analysisdata/analysisdata.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/analysisdata/analysisdata.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/analysisdata/analysisdata.cpp.o.d"
+  "/root/repo/src/gromacs/analysisdata/arraydata.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/analysisdata/arraydata.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/analysisdata/arraydata.cpp.o.d"
+  "/root/repo/src/gromacs/analysisdata/dataframe.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/analysisdata/dataframe.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/analysisdata/dataframe.cpp.o.d"
+  "/root/repo/src/gromacs/analysisdata/dataproxy.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/analysisdata/dataproxy.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/analysisdata/dataproxy.cpp.o.d"
+  "/root/repo/src/gromacs/analysisdata/datastorage.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/analysisdata/datastorage.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/analysisdata/datastorage.cpp.o.d"
+  "/root/repo/src/gromacs/analysisdata/modules/average.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/analysisdata/modules/average.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/analysisdata/modules/average.cpp.o.d"
+  "/root/repo/src/gromacs/analysisdata/modules/displacement.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/analysisdata/modules/displacement.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/analysisdata/modules/displacement.cpp.o.d"
+  "/root/repo/src/gromacs/analysisdata/modules/histogram.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/analysisdata/modules/histogram.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/analysisdata/modules/histogram.cpp.o.d"
+  "/root/repo/src/gromacs/analysisdata/modules/plot.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/analysisdata/modules/plot.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/analysisdata/modules/plot.cpp.o.d"
+  "/root/repo/src/gromacs/commandline/cmdlinehelpwriter.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/commandline/cmdlinehelpwriter.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/commandline/cmdlinehelpwriter.cpp.o.d"
+  "/root/repo/src/gromacs/commandline/cmdlinemodulemanager.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/commandline/cmdlinemodulemanager.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/commandline/cmdlinemodulemanager.cpp.o.d"
+  "/root/repo/src/gromacs/commandline/cmdlineparser.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/commandline/cmdlineparser.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/commandline/cmdlineparser.cpp.o.d"
+  "/root/repo/src/gromacs/gmxlib/oenv.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/oenv.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/oenv.cpp.o.d"
+  "/root/repo/src/gromacs/gmxlib/statutil.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/statutil.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/statutil.cpp.o.d"
+  "/root/repo/src/gromacs/gmxlib/thread_mpi/system_error.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/system_error.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/system_error.cpp.o.d"
+  "/root/repo/src/gromacs/gmxlib/wman.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/wman.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/gmxlib/wman.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/fft5d.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/fft5d.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/fft5d.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/gmx_fft_fftw3.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/gmx_fft_fftw3.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/mdlib/gmx_fft_fftw3.cpp.o.d"
+  "/root/repo/src/gromacs/onlinehelp/helpformat.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/onlinehelp/helpformat.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/onlinehelp/helpformat.cpp.o.d"
+  "/root/repo/src/gromacs/onlinehelp/helpmanager.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/onlinehelp/helpmanager.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/onlinehelp/helpmanager.cpp.o.d"
+  "/root/repo/src/gromacs/onlinehelp/helptopic.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/onlinehelp/helptopic.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/onlinehelp/helptopic.cpp.o.d"
+  "/root/repo/src/gromacs/onlinehelp/helpwritercontext.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/onlinehelp/helpwritercontext.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/onlinehelp/helpwritercontext.cpp.o.d"
+  "/root/repo/src/gromacs/options/abstractoption.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/options/abstractoption.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/options/abstractoption.cpp.o.d"
+  "/root/repo/src/gromacs/options/basicoptions.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/options/basicoptions.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/options/basicoptions.cpp.o.d"
+  "/root/repo/src/gromacs/options/filenameoption.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/options/filenameoption.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/options/filenameoption.cpp.o.d"
+  "/root/repo/src/gromacs/options/options.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/options/options.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/options/options.cpp.o.d"
+  "/root/repo/src/gromacs/options/optionsassigner.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/options/optionsassigner.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/options/optionsassigner.cpp.o.d"
+  "/root/repo/src/gromacs/options/optionsvisitor.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/options/optionsvisitor.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/options/optionsvisitor.cpp.o.d"
+  "/root/repo/src/gromacs/options/timeunitmanager.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/options/timeunitmanager.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/options/timeunitmanager.cpp.o.d"
+  "/root/repo/src/gromacs/selection/centerofmass.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/selection/centerofmass.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/selection/centerofmass.cpp.o.d"
+  "/root/repo/src/gromacs/selection/compiler.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/selection/compiler.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/selection/compiler.cpp.o.d"
+  "/root/repo/src/gromacs/selection/evaluate.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/selection/evaluate.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/selection/evaluate.cpp.o.d"
+  "/root/repo/src/gromacs/selection/indexutil.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/selection/indexutil.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/selection/indexutil.cpp.o.d"
+  "/root/repo/src/gromacs/selection/mempool.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/selection/mempool.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/selection/mempool.cpp.o.d"
+  "/root/repo/src/gromacs/selection/nbsearch.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/selection/nbsearch.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/selection/nbsearch.cpp.o.d"
+  "/root/repo/src/gromacs/selection/params.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/selection/params.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/selection/params.cpp.o.d"
+  "/root/repo/src/gromacs/selection/parser.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/selection/parser.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/selection/parser.cpp.o.d"
+  "/root/repo/src/gromacs/selection/parsetree.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/selection/parsetree.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/selection/parsetree.cpp.o.d"
+  "/root/repo/src/gromacs/selection/poscalc.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/selection/poscalc.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/selection/poscalc.cpp.o.d"
+  "/root/repo/src/gromacs/selection/position.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/selection/position.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/selection/position.cpp.o.d"
+  "/root/repo/src/gromacs/selection/scanner.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/selection/scanner.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/selection/scanner.cpp.o.d"
+  "/root/repo/src/gromacs/selection/scanner_internal.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/selection/scanner_internal.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/selection/scanner_internal.cpp.o.d"
+  "/root/repo/src/gromacs/selection/selection.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/selection/selection.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/selection/selection.cpp.o.d"
+  "/root/repo/src/gromacs/selection/selectioncollection.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/selection/selectioncollection.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/selection/selectioncollection.cpp.o.d"
+  "/root/repo/src/gromacs/selection/selectionoption.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/selection/selectionoption.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/selection/selectionoption.cpp.o.d"
+  "/root/repo/src/gromacs/selection/selectionoptionmanager.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/selection/selectionoptionmanager.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/selection/selectionoptionmanager.cpp.o.d"
+  "/root/repo/src/gromacs/selection/selelem.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/selection/selelem.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/selection/selelem.cpp.o.d"
+  "/root/repo/src/gromacs/selection/selhelp.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/selection/selhelp.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/selection/selhelp.cpp.o.d"
+  "/root/repo/src/gromacs/selection/selmethod.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/selection/selmethod.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/selection/selmethod.cpp.o.d"
+  "/root/repo/src/gromacs/selection/selvalue.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/selection/selvalue.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/selection/selvalue.cpp.o.d"
+  "/root/repo/src/gromacs/selection/sm_compare.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/selection/sm_compare.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/selection/sm_compare.cpp.o.d"
+  "/root/repo/src/gromacs/selection/sm_distance.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/selection/sm_distance.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/selection/sm_distance.cpp.o.d"
+  "/root/repo/src/gromacs/selection/sm_insolidangle.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/selection/sm_insolidangle.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/selection/sm_insolidangle.cpp.o.d"
+  "/root/repo/src/gromacs/selection/sm_keywords.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/selection/sm_keywords.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/selection/sm_keywords.cpp.o.d"
+  "/root/repo/src/gromacs/selection/sm_merge.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/selection/sm_merge.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/selection/sm_merge.cpp.o.d"
+  "/root/repo/src/gromacs/selection/sm_permute.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/selection/sm_permute.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/selection/sm_permute.cpp.o.d"
+  "/root/repo/src/gromacs/selection/sm_position.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/selection/sm_position.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/selection/sm_position.cpp.o.d"
+  "/root/repo/src/gromacs/selection/sm_same.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/selection/sm_same.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/selection/sm_same.cpp.o.d"
+  "/root/repo/src/gromacs/selection/sm_simple.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/selection/sm_simple.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/selection/sm_simple.cpp.o.d"
+  "/root/repo/src/gromacs/selection/symrec.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/selection/symrec.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/selection/symrec.cpp.o.d"
+  "/root/repo/src/gromacs/trajectoryanalysis/analysismodule.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/trajectoryanalysis/analysismodule.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/trajectoryanalysis/analysismodule.cpp.o.d"
+  "/root/repo/src/gromacs/trajectoryanalysis/analysissettings.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/trajectoryanalysis/analysissettings.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/trajectoryanalysis/analysissettings.cpp.o.d"
+  "/root/repo/src/gromacs/trajectoryanalysis/cmdlinerunner.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/trajectoryanalysis/cmdlinerunner.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/trajectoryanalysis/cmdlinerunner.cpp.o.d"
+  "/root/repo/src/gromacs/trajectoryanalysis/modules.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/trajectoryanalysis/modules.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/trajectoryanalysis/modules.cpp.o.d"
+  "/root/repo/src/gromacs/trajectoryanalysis/modules/angle.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/trajectoryanalysis/modules/angle.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/trajectoryanalysis/modules/angle.cpp.o.d"
+  "/root/repo/src/gromacs/trajectoryanalysis/modules/distance.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/trajectoryanalysis/modules/distance.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/trajectoryanalysis/modules/distance.cpp.o.d"
+  "/root/repo/src/gromacs/trajectoryanalysis/modules/select.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/trajectoryanalysis/modules/select.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/trajectoryanalysis/modules/select.cpp.o.d"
+  "/root/repo/src/gromacs/trajectoryanalysis/runnercommon.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/trajectoryanalysis/runnercommon.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/trajectoryanalysis/runnercommon.cpp.o.d"
+  "/root/repo/src/gromacs/utility/errorcodes.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/utility/errorcodes.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/utility/errorcodes.cpp.o.d"
+  "/root/repo/src/gromacs/utility/errorformat.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/utility/errorformat.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/utility/errorformat.cpp.o.d"
+  "/root/repo/src/gromacs/utility/exceptions.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/utility/exceptions.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/utility/exceptions.cpp.o.d"
+  "/root/repo/src/gromacs/utility/file.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/utility/file.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/utility/file.cpp.o.d"
+  "/root/repo/src/gromacs/utility/gmxassert.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/utility/gmxassert.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/utility/gmxassert.cpp.o.d"
+  "/root/repo/src/gromacs/utility/gmxregex.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/utility/gmxregex.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/utility/gmxregex.cpp.o.d"
+  "/root/repo/src/gromacs/utility/messagestringcollector.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/utility/messagestringcollector.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/utility/messagestringcollector.cpp.o.d"
+  "/root/repo/src/gromacs/utility/path.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/utility/path.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/utility/path.cpp.o.d"
+  "/root/repo/src/gromacs/utility/programinfo.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/utility/programinfo.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/utility/programinfo.cpp.o.d"
+  "/root/repo/src/gromacs/utility/stringutil.cpp" "src/gromacs/CMakeFiles/libgromacs.dir/utility/stringutil.cpp.o" "gcc" "src/gromacs/CMakeFiles/libgromacs.dir/utility/stringutil.cpp.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_qc_build/lib/libgromacs.so" "/root/repo/_qc_build/lib/libgromacs.so.6"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,1158 @@
+file(REMOVE_RECURSE
+  "../../lib/libgromacs.pdb"
+  "../../lib/libgromacs.so"
+  "../../lib/libgromacs.so.6"
+  "CMakeFiles/libgromacs.dir/__/external/fftpack/fftpack.c.o"
+  "CMakeFiles/libgromacs.dir/__/external/fftpack/fftpack.c.o.d"
+  "CMakeFiles/libgromacs.dir/__/external/vmd_molfile/vmddlopen.c.o"
+  "CMakeFiles/libgromacs.dir/__/external/vmd_molfile/vmddlopen.c.o.d"
+  "CMakeFiles/libgromacs.dir/analysisdata/abstractdata.cpp.o"
+  "CMakeFiles/libgromacs.dir/analysisdata/abstractdata.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/analysisdata/analysisdata.cpp.o"
+  "CMakeFiles/libgromacs.dir/analysisdata/analysisdata.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/analysisdata/arraydata.cpp.o"
+  "CMakeFiles/libgromacs.dir/analysisdata/arraydata.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/analysisdata/dataframe.cpp.o"
+  "CMakeFiles/libgromacs.dir/analysisdata/dataframe.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/analysisdata/dataproxy.cpp.o"
+  "CMakeFiles/libgromacs.dir/analysisdata/dataproxy.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/analysisdata/datastorage.cpp.o"
+  "CMakeFiles/libgromacs.dir/analysisdata/datastorage.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/analysisdata/modules/average.cpp.o"
+  "CMakeFiles/libgromacs.dir/analysisdata/modules/average.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/analysisdata/modules/displacement.cpp.o"
+  "CMakeFiles/libgromacs.dir/analysisdata/modules/displacement.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/analysisdata/modules/histogram.cpp.o"
+  "CMakeFiles/libgromacs.dir/analysisdata/modules/histogram.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/analysisdata/modules/plot.cpp.o"
+  "CMakeFiles/libgromacs.dir/analysisdata/modules/plot.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/commandline/cmdlinehelpwriter.cpp.o"
+  "CMakeFiles/libgromacs.dir/commandline/cmdlinehelpwriter.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/commandline/cmdlinemodulemanager.cpp.o"
+  "CMakeFiles/libgromacs.dir/commandline/cmdlinemodulemanager.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/commandline/cmdlineparser.cpp.o"
+  "CMakeFiles/libgromacs.dir/commandline/cmdlineparser.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/3dview.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/3dview.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/atomprop.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/atomprop.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/bondfree.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/bondfree.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/calcgrid.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/calcgrid.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/calch.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/calch.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/chargegroup.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/chargegroup.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/checkpoint.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/checkpoint.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/cinvsqrtdata.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/cinvsqrtdata.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/confio.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/confio.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/copyrite.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/copyrite.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/crecipdata.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/crecipdata.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/disre.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/disre.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/do_fit.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/do_fit.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/enxio.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/enxio.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/ewald_util.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/ewald_util.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/filenm.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/filenm.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/futil.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/futil.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/gbutil.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/gbutil.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/gmx_cpuid.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/gmx_cpuid.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/gmx_cyclecounter.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/gmx_cyclecounter.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/gmx_detect_hardware.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/gmx_detect_hardware.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/gmx_fatal.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/gmx_fatal.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/gmx_omp.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/gmx_omp.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/gmx_omp_nthreads.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/gmx_omp_nthreads.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/gmx_random.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/gmx_random.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/gmx_sort.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/gmx_sort.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/gmx_system_xdr.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/gmx_system_xdr.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/gmxcpp.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/gmxcpp.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/gmxfio.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/gmxfio.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/gmxfio_asc.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/gmxfio_asc.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/gmxfio_bin.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/gmxfio_bin.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/gmxfio_rw.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/gmxfio_rw.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/gmxfio_xdr.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/gmxfio_xdr.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/ifunc.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/ifunc.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/index.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/index.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/inputrec.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/inputrec.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/invblock.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/invblock.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/libxdrf.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/libxdrf.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/main.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/main.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/maths.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/maths.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/matio.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/matio.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/md5.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/md5.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/md_logging.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/md_logging.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/mshift.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/mshift.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/mtop_util.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/mtop_util.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/mvdata.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/mvdata.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/names.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/names.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/network.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/network.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_free_energy.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_free_energy.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_generic.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_generic.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_generic_adress.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_generic_adress.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_generic_cg.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_generic_cg.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCSTab_VdwCSTab_GeomP1P1_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCSTab_VdwCSTab_GeomP1P1_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCSTab_VdwCSTab_GeomW3P1_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCSTab_VdwCSTab_GeomW3P1_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCSTab_VdwCSTab_GeomW3W3_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCSTab_VdwCSTab_GeomW3W3_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCSTab_VdwCSTab_GeomW4P1_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCSTab_VdwCSTab_GeomW4P1_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCSTab_VdwCSTab_GeomW4W4_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCSTab_VdwCSTab_GeomW4W4_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCSTab_VdwLJ_GeomP1P1_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCSTab_VdwLJ_GeomP1P1_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCSTab_VdwLJ_GeomW3P1_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCSTab_VdwLJ_GeomW3P1_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCSTab_VdwLJ_GeomW3W3_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCSTab_VdwLJ_GeomW3W3_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCSTab_VdwLJ_GeomW4P1_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCSTab_VdwLJ_GeomW4P1_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCSTab_VdwLJ_GeomW4W4_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCSTab_VdwLJ_GeomW4W4_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCSTab_VdwNone_GeomP1P1_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCSTab_VdwNone_GeomP1P1_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCSTab_VdwNone_GeomW3P1_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCSTab_VdwNone_GeomW3P1_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCSTab_VdwNone_GeomW3W3_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCSTab_VdwNone_GeomW3W3_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCSTab_VdwNone_GeomW4P1_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCSTab_VdwNone_GeomW4P1_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCSTab_VdwNone_GeomW4W4_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCSTab_VdwNone_GeomW4W4_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCoul_VdwCSTab_GeomP1P1_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCoul_VdwCSTab_GeomP1P1_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCoul_VdwCSTab_GeomW3P1_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCoul_VdwCSTab_GeomW3P1_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCoul_VdwCSTab_GeomW3W3_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCoul_VdwCSTab_GeomW3W3_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCoul_VdwCSTab_GeomW4P1_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCoul_VdwCSTab_GeomW4P1_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCoul_VdwCSTab_GeomW4W4_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCoul_VdwCSTab_GeomW4W4_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCoul_VdwLJ_GeomP1P1_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCoul_VdwLJ_GeomP1P1_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCoul_VdwLJ_GeomW3P1_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCoul_VdwLJ_GeomW3P1_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCoul_VdwLJ_GeomW3W3_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCoul_VdwLJ_GeomW3W3_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCoul_VdwLJ_GeomW4P1_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCoul_VdwLJ_GeomW4P1_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCoul_VdwLJ_GeomW4W4_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCoul_VdwLJ_GeomW4W4_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCoul_VdwNone_GeomP1P1_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCoul_VdwNone_GeomP1P1_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCoul_VdwNone_GeomW3P1_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCoul_VdwNone_GeomW3P1_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCoul_VdwNone_GeomW3W3_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCoul_VdwNone_GeomW3W3_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCoul_VdwNone_GeomW4P1_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCoul_VdwNone_GeomW4P1_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCoul_VdwNone_GeomW4W4_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecCoul_VdwNone_GeomW4W4_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSh_VdwLJSh_GeomP1P1_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSh_VdwLJSh_GeomP1P1_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSh_VdwLJSh_GeomW3P1_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSh_VdwLJSh_GeomW3P1_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSh_VdwLJSh_GeomW3W3_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSh_VdwLJSh_GeomW3W3_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSh_VdwLJSh_GeomW4P1_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSh_VdwLJSh_GeomW4P1_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSh_VdwLJSh_GeomW4W4_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSh_VdwLJSh_GeomW4W4_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSh_VdwNone_GeomP1P1_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSh_VdwNone_GeomP1P1_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSh_VdwNone_GeomW3P1_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSh_VdwNone_GeomW3P1_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSh_VdwNone_GeomW3W3_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSh_VdwNone_GeomW3W3_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSh_VdwNone_GeomW4P1_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSh_VdwNone_GeomW4P1_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSh_VdwNone_GeomW4W4_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSh_VdwNone_GeomW4W4_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSw_VdwLJSw_GeomP1P1_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSw_VdwLJSw_GeomP1P1_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSw_VdwLJSw_GeomW3P1_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSw_VdwLJSw_GeomW3P1_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSw_VdwLJSw_GeomW3W3_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSw_VdwLJSw_GeomW3W3_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSw_VdwLJSw_GeomW4P1_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSw_VdwLJSw_GeomW4P1_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSw_VdwLJSw_GeomW4W4_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSw_VdwLJSw_GeomW4W4_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSw_VdwNone_GeomP1P1_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSw_VdwNone_GeomP1P1_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSw_VdwNone_GeomW3P1_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSw_VdwNone_GeomW3P1_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSw_VdwNone_GeomW3W3_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSw_VdwNone_GeomW3W3_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSw_VdwNone_GeomW4P1_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSw_VdwNone_GeomW4P1_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSw_VdwNone_GeomW4W4_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEwSw_VdwNone_GeomW4W4_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEw_VdwCSTab_GeomP1P1_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEw_VdwCSTab_GeomP1P1_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEw_VdwCSTab_GeomW3P1_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEw_VdwCSTab_GeomW3P1_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEw_VdwCSTab_GeomW3W3_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEw_VdwCSTab_GeomW3W3_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEw_VdwCSTab_GeomW4P1_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEw_VdwCSTab_GeomW4P1_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEw_VdwCSTab_GeomW4W4_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEw_VdwCSTab_GeomW4W4_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEw_VdwLJ_GeomP1P1_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEw_VdwLJ_GeomP1P1_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEw_VdwLJ_GeomW3P1_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEw_VdwLJ_GeomW3P1_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEw_VdwLJ_GeomW3W3_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEw_VdwLJ_GeomW3W3_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEw_VdwLJ_GeomW4P1_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEw_VdwLJ_GeomW4P1_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEw_VdwLJ_GeomW4W4_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEw_VdwLJ_GeomW4W4_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEw_VdwNone_GeomP1P1_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEw_VdwNone_GeomP1P1_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEw_VdwNone_GeomW3P1_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEw_VdwNone_GeomW3P1_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEw_VdwNone_GeomW3W3_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEw_VdwNone_GeomW3W3_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEw_VdwNone_GeomW4P1_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEw_VdwNone_GeomW4P1_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEw_VdwNone_GeomW4W4_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecEw_VdwNone_GeomW4W4_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecGB_VdwCSTab_GeomP1P1_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecGB_VdwCSTab_GeomP1P1_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecGB_VdwLJ_GeomP1P1_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecGB_VdwLJ_GeomP1P1_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecGB_VdwNone_GeomP1P1_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecGB_VdwNone_GeomP1P1_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecNone_VdwCSTab_GeomP1P1_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecNone_VdwCSTab_GeomP1P1_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecNone_VdwLJSh_GeomP1P1_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecNone_VdwLJSh_GeomP1P1_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecNone_VdwLJSw_GeomP1P1_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecNone_VdwLJSw_GeomP1P1_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecNone_VdwLJ_GeomP1P1_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecNone_VdwLJ_GeomP1P1_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwCSTab_GeomP1P1_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwCSTab_GeomP1P1_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwCSTab_GeomW3P1_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwCSTab_GeomW3P1_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwCSTab_GeomW3W3_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwCSTab_GeomW3W3_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwCSTab_GeomW4P1_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwCSTab_GeomW4P1_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwCSTab_GeomW4W4_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwCSTab_GeomW4W4_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwLJSh_GeomP1P1_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwLJSh_GeomP1P1_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwLJSh_GeomW3P1_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwLJSh_GeomW3P1_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwLJSh_GeomW3W3_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwLJSh_GeomW3W3_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwLJSh_GeomW4P1_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwLJSh_GeomW4P1_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwLJSh_GeomW4W4_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwLJSh_GeomW4W4_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwLJSw_GeomP1P1_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwLJSw_GeomP1P1_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwLJSw_GeomW3P1_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwLJSw_GeomW3P1_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwLJSw_GeomW3W3_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwLJSw_GeomW3W3_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwLJSw_GeomW4P1_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwLJSw_GeomW4P1_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwLJSw_GeomW4W4_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwLJSw_GeomW4W4_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwNone_GeomP1P1_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwNone_GeomP1P1_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwNone_GeomW3P1_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwNone_GeomW3P1_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwNone_GeomW3W3_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwNone_GeomW3W3_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwNone_GeomW4P1_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwNone_GeomW4P1_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwNone_GeomW4W4_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRFCut_VdwNone_GeomW4W4_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRF_VdwCSTab_GeomP1P1_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRF_VdwCSTab_GeomP1P1_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRF_VdwCSTab_GeomW3P1_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRF_VdwCSTab_GeomW3P1_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRF_VdwCSTab_GeomW3W3_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRF_VdwCSTab_GeomW3W3_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRF_VdwCSTab_GeomW4P1_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRF_VdwCSTab_GeomW4P1_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRF_VdwCSTab_GeomW4W4_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRF_VdwCSTab_GeomW4W4_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRF_VdwLJ_GeomP1P1_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRF_VdwLJ_GeomP1P1_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRF_VdwLJ_GeomW3P1_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRF_VdwLJ_GeomW3P1_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRF_VdwLJ_GeomW3W3_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRF_VdwLJ_GeomW3W3_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRF_VdwLJ_GeomW4P1_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRF_VdwLJ_GeomW4P1_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRF_VdwLJ_GeomW4W4_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRF_VdwLJ_GeomW4W4_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRF_VdwNone_GeomP1P1_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRF_VdwNone_GeomP1P1_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRF_VdwNone_GeomW3P1_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRF_VdwNone_GeomW3P1_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRF_VdwNone_GeomW3W3_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRF_VdwNone_GeomW3W3_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRF_VdwNone_GeomW4P1_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRF_VdwNone_GeomW4P1_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRF_VdwNone_GeomW4W4_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_ElecRF_VdwNone_GeomW4W4_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_avx_256_single.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_avx_256_single/nb_kernel_avx_256_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwBham_GeomP1P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwBham_GeomP1P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwBham_GeomW3P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwBham_GeomW3P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwBham_GeomW3W3_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwBham_GeomW3W3_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwBham_GeomW4P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwBham_GeomW4P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwBham_GeomW4W4_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwBham_GeomW4W4_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwCSTab_GeomP1P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwCSTab_GeomP1P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwCSTab_GeomW3P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwCSTab_GeomW3P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwCSTab_GeomW3W3_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwCSTab_GeomW3W3_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwCSTab_GeomW4P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwCSTab_GeomW4P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwCSTab_GeomW4W4_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwCSTab_GeomW4W4_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwLJ_GeomP1P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwLJ_GeomP1P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwLJ_GeomW3P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwLJ_GeomW3P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwLJ_GeomW3W3_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwLJ_GeomW3W3_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwLJ_GeomW4P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwLJ_GeomW4P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwLJ_GeomW4W4_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwLJ_GeomW4W4_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwNone_GeomP1P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwNone_GeomP1P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwNone_GeomW3P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwNone_GeomW3P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwNone_GeomW3W3_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwNone_GeomW3W3_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwNone_GeomW4P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwNone_GeomW4P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwNone_GeomW4W4_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCSTab_VdwNone_GeomW4W4_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwBham_GeomP1P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwBham_GeomP1P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwBham_GeomW3P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwBham_GeomW3P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwBham_GeomW3W3_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwBham_GeomW3W3_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwBham_GeomW4P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwBham_GeomW4P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwBham_GeomW4W4_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwBham_GeomW4W4_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwCSTab_GeomP1P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwCSTab_GeomP1P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwCSTab_GeomW3P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwCSTab_GeomW3P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwCSTab_GeomW3W3_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwCSTab_GeomW3W3_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwCSTab_GeomW4P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwCSTab_GeomW4P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwCSTab_GeomW4W4_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwCSTab_GeomW4W4_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwLJ_GeomP1P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwLJ_GeomP1P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwLJ_GeomW3P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwLJ_GeomW3P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwLJ_GeomW3W3_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwLJ_GeomW3W3_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwLJ_GeomW4P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwLJ_GeomW4P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwLJ_GeomW4W4_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwLJ_GeomW4W4_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwNone_GeomP1P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwNone_GeomP1P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwNone_GeomW3P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwNone_GeomW3P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwNone_GeomW3W3_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwNone_GeomW3W3_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwNone_GeomW4P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwNone_GeomW4P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwNone_GeomW4W4_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecCoul_VdwNone_GeomW4W4_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwBhamSh_GeomP1P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwBhamSh_GeomP1P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwBhamSh_GeomW3P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwBhamSh_GeomW3P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwBhamSh_GeomW3W3_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwBhamSh_GeomW3W3_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwBhamSh_GeomW4P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwBhamSh_GeomW4P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwBhamSh_GeomW4W4_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwBhamSh_GeomW4W4_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwLJSh_GeomP1P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwLJSh_GeomP1P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwLJSh_GeomW3P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwLJSh_GeomW3P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwLJSh_GeomW3W3_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwLJSh_GeomW3W3_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwLJSh_GeomW4P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwLJSh_GeomW4P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwLJSh_GeomW4W4_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwLJSh_GeomW4W4_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwNone_GeomP1P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwNone_GeomP1P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwNone_GeomW3P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwNone_GeomW3P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwNone_GeomW3W3_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwNone_GeomW3W3_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwNone_GeomW4P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwNone_GeomW4P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwNone_GeomW4W4_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSh_VdwNone_GeomW4W4_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwBhamSw_GeomP1P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwBhamSw_GeomP1P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwBhamSw_GeomW3P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwBhamSw_GeomW3P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwBhamSw_GeomW3W3_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwBhamSw_GeomW3W3_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwBhamSw_GeomW4P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwBhamSw_GeomW4P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwBhamSw_GeomW4W4_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwBhamSw_GeomW4W4_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwLJSw_GeomP1P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwLJSw_GeomP1P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwLJSw_GeomW3P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwLJSw_GeomW3P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwLJSw_GeomW3W3_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwLJSw_GeomW3W3_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwLJSw_GeomW4P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwLJSw_GeomW4P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwLJSw_GeomW4W4_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwLJSw_GeomW4W4_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwNone_GeomP1P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwNone_GeomP1P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwNone_GeomW3P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwNone_GeomW3P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwNone_GeomW3W3_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwNone_GeomW3W3_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwNone_GeomW4P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwNone_GeomW4P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwNone_GeomW4W4_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEwSw_VdwNone_GeomW4W4_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwBham_GeomP1P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwBham_GeomP1P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwBham_GeomW3P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwBham_GeomW3P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwBham_GeomW3W3_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwBham_GeomW3W3_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwBham_GeomW4P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwBham_GeomW4P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwBham_GeomW4W4_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwBham_GeomW4W4_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwCSTab_GeomP1P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwCSTab_GeomP1P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwCSTab_GeomW3P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwCSTab_GeomW3P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwCSTab_GeomW3W3_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwCSTab_GeomW3W3_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwCSTab_GeomW4P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwCSTab_GeomW4P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwCSTab_GeomW4W4_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwCSTab_GeomW4W4_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwLJ_GeomP1P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwLJ_GeomP1P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwLJ_GeomW3P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwLJ_GeomW3P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwLJ_GeomW3W3_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwLJ_GeomW3W3_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwLJ_GeomW4P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwLJ_GeomW4P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwLJ_GeomW4W4_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwLJ_GeomW4W4_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwNone_GeomP1P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwNone_GeomP1P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwNone_GeomW3P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwNone_GeomW3P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwNone_GeomW3W3_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwNone_GeomW3W3_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwNone_GeomW4P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwNone_GeomW4P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwNone_GeomW4W4_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecEw_VdwNone_GeomW4W4_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecGB_VdwBham_GeomP1P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecGB_VdwBham_GeomP1P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecGB_VdwCSTab_GeomP1P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecGB_VdwCSTab_GeomP1P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecGB_VdwLJ_GeomP1P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecGB_VdwLJ_GeomP1P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecGB_VdwNone_GeomP1P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecGB_VdwNone_GeomP1P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecNone_VdwBhamSh_GeomP1P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecNone_VdwBhamSh_GeomP1P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecNone_VdwBhamSw_GeomP1P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecNone_VdwBhamSw_GeomP1P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecNone_VdwBham_GeomP1P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecNone_VdwBham_GeomP1P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecNone_VdwCSTab_GeomP1P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecNone_VdwCSTab_GeomP1P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecNone_VdwLJSh_GeomP1P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecNone_VdwLJSh_GeomP1P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecNone_VdwLJSw_GeomP1P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecNone_VdwLJSw_GeomP1P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecNone_VdwLJ_GeomP1P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecNone_VdwLJ_GeomP1P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSh_GeomP1P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSh_GeomP1P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSh_GeomW3P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSh_GeomW3P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSh_GeomW3W3_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSh_GeomW3W3_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSh_GeomW4P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSh_GeomW4P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSh_GeomW4W4_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSh_GeomW4W4_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSw_GeomP1P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSw_GeomP1P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSw_GeomW3P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSw_GeomW3P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSw_GeomW3W3_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSw_GeomW3W3_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSw_GeomW4P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSw_GeomW4P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSw_GeomW4W4_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwBhamSw_GeomW4W4_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwCSTab_GeomP1P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwCSTab_GeomP1P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwCSTab_GeomW3P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwCSTab_GeomW3P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwCSTab_GeomW3W3_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwCSTab_GeomW3W3_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwCSTab_GeomW4P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwCSTab_GeomW4P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwCSTab_GeomW4W4_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwCSTab_GeomW4W4_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSh_GeomP1P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSh_GeomP1P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSh_GeomW3P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSh_GeomW3P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSh_GeomW3W3_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSh_GeomW3W3_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSh_GeomW4P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSh_GeomW4P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSh_GeomW4W4_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSh_GeomW4W4_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSw_GeomP1P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSw_GeomP1P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSw_GeomW3P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSw_GeomW3P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSw_GeomW3W3_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSw_GeomW3W3_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSw_GeomW4P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSw_GeomW4P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSw_GeomW4W4_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwLJSw_GeomW4W4_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwNone_GeomP1P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwNone_GeomP1P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwNone_GeomW3P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwNone_GeomW3P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwNone_GeomW3W3_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwNone_GeomW3W3_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwNone_GeomW4P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwNone_GeomW4P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwNone_GeomW4W4_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRFCut_VdwNone_GeomW4W4_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwBham_GeomP1P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwBham_GeomP1P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwBham_GeomW3P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwBham_GeomW3P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwBham_GeomW3W3_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwBham_GeomW3W3_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwBham_GeomW4P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwBham_GeomW4P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwBham_GeomW4W4_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwBham_GeomW4W4_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwCSTab_GeomP1P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwCSTab_GeomP1P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwCSTab_GeomW3P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwCSTab_GeomW3P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwCSTab_GeomW3W3_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwCSTab_GeomW3W3_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwCSTab_GeomW4P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwCSTab_GeomW4P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwCSTab_GeomW4W4_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwCSTab_GeomW4W4_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwLJ_GeomP1P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwLJ_GeomP1P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwLJ_GeomW3P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwLJ_GeomW3P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwLJ_GeomW3W3_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwLJ_GeomW3W3_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwLJ_GeomW4P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwLJ_GeomW4P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwLJ_GeomW4W4_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwLJ_GeomW4W4_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwNone_GeomP1P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwNone_GeomP1P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwNone_GeomW3P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwNone_GeomW3P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwNone_GeomW3W3_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwNone_GeomW3W3_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwNone_GeomW4P1_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwNone_GeomW4P1_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwNone_GeomW4W4_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_ElecRF_VdwNone_GeomW4W4_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_allvsall.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_allvsall.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_allvsallgb.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_allvsallgb.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_c.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nb_kernel_c/nb_kernel_c.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nonbonded.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nonbonded/nonbonded.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nrama.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nrama.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nrjac.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nrjac.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/nrnb.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/nrnb.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/oenv.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/oenv.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/orires.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/orires.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/pargs.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/pargs.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/pbc.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/pbc.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/pdbio.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/pdbio.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/physics.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/physics.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/princ.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/princ.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/rando.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/rando.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/random.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/random.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/rbin.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/rbin.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/readinp.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/readinp.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/rmpbc.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/rmpbc.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/sfactor.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/sfactor.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/shift_util.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/shift_util.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/sighandler.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/sighandler.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/smalloc.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/smalloc.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/sortwater.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/sortwater.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/splitter.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/splitter.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/statistics/gmx_statistics.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/statistics/gmx_statistics.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/statistics/histogram.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/statistics/histogram.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/statutil.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/statutil.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/strdb.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/strdb.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/string2.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/string2.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/symtab.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/symtab.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/tcontrol.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/tcontrol.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/alltoall.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/alltoall.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/barrier.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/barrier.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/bcast.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/bcast.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/collective.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/collective.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/comm.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/comm.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/errhandler.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/errhandler.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/event.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/event.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/gather.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/gather.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/group.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/group.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/list.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/list.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/lock.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/lock.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/numa_malloc.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/numa_malloc.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/once.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/once.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/p2p_protocol.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/p2p_protocol.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/p2p_send_recv.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/p2p_send_recv.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/p2p_wait.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/p2p_wait.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/profile.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/profile.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/pthreads.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/pthreads.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/reduce.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/reduce.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/reduce_fast.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/reduce_fast.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/scan.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/scan.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/scatter.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/scatter.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/system_error.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/system_error.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/tmpi_init.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/tmpi_init.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/tmpi_malloc.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/tmpi_malloc.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/topology.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/topology.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/type.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/thread_mpi/type.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/topsort.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/topsort.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/tpxio.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/tpxio.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/trnio.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/trnio.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/trxindex.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/trxindex.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/trxio.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/trxio.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/trxmmap.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/trxmmap.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/txtdump.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/txtdump.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/typedefs.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/typedefs.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/viewit.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/viewit.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/vmdio.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/vmdio.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/warninp.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/warninp.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/wgms.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/wgms.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/wman.cpp.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/wman.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/writeps.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/writeps.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/xdrd.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/xdrd.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/xtcio.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/xtcio.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/xtcreadahead.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/xtcreadahead.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxlib/xvgr.c.o"
+  "CMakeFiles/libgromacs.dir/gmxlib/xvgr.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/add_par.c.o"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/add_par.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/calc_verletbuf.c.o"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/calc_verletbuf.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/compute_io.c.o"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/compute_io.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/fflibutil.c.o"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/fflibutil.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/gen_ad.c.o"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/gen_ad.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/gen_vsite.c.o"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/gen_vsite.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/genhydro.c.o"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/genhydro.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/gpp_atomtype.c.o"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/gpp_atomtype.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/gpp_bond_atomtype.c.o"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/gpp_bond_atomtype.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/h_db.c.o"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/h_db.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/hackblock.c.o"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/hackblock.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/pdb2top.c.o"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/pdb2top.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/pgutil.c.o"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/pgutil.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/readadress.c.o"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/readadress.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/readir.c.o"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/readir.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/readpull.c.o"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/readpull.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/readrot.c.o"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/readrot.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/resall.c.o"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/resall.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/ter_db.c.o"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/ter_db.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/topdirs.c.o"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/topdirs.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/topexcl.c.o"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/topexcl.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/topio.c.o"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/topio.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/toppush.c.o"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/toppush.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/topshake.c.o"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/topshake.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/toputil.c.o"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/toputil.c.o.d"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/vsite_parm.c.o"
+  "CMakeFiles/libgromacs.dir/gmxpreprocess/vsite_parm.c.o.d"
+  "CMakeFiles/libgromacs.dir/linearalgebra/eigensolver.c.o"
+  "CMakeFiles/libgromacs.dir/linearalgebra/eigensolver.c.o.d"
+  "CMakeFiles/libgromacs.dir/linearalgebra/gmx_arpack.c.o"
+  "CMakeFiles/libgromacs.dir/linearalgebra/gmx_arpack.c.o.d"
+  "CMakeFiles/libgromacs.dir/linearalgebra/matrix.c.o"
+  "CMakeFiles/libgromacs.dir/linearalgebra/matrix.c.o.d"
+  "CMakeFiles/libgromacs.dir/linearalgebra/mtxio.c.o"
+  "CMakeFiles/libgromacs.dir/linearalgebra/mtxio.c.o.d"
+  "CMakeFiles/libgromacs.dir/linearalgebra/sparsematrix.c.o"
+  "CMakeFiles/libgromacs.dir/linearalgebra/sparsematrix.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/adress.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/adress.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/calcmu.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/calcmu.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/calcvir.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/calcvir.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/clincs.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/clincs.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/constr.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/constr.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/coupling.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/coupling.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/csettle.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/csettle.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/domdec.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/domdec.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/domdec_box.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/domdec_box.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/domdec_con.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/domdec_con.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/domdec_network.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/domdec_network.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/domdec_setup.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/domdec_setup.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/domdec_top.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/domdec_top.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/ebin.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/ebin.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/edsam.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/edsam.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/ewald.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/ewald.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/expanded.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/expanded.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/fft5d.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/fft5d.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/force.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/force.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/forcerec.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/forcerec.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/genborn.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/genborn.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/genborn_allvsall.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/genborn_allvsall.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/genborn_allvsall_sse2_double.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/genborn_allvsall_sse2_double.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/genborn_allvsall_sse2_single.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/genborn_allvsall_sse2_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/genborn_sse2_double.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/genborn_sse2_double.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/genborn_sse2_single.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/genborn_sse2_single.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/gmx_fft.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/gmx_fft.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/gmx_fft_fftpack.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/gmx_fft_fftpack.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/gmx_fft_fftw3.cpp.o"
+  "CMakeFiles/libgromacs.dir/mdlib/gmx_fft_fftw3.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/gmx_fft_mkl.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/gmx_fft_mkl.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/gmx_parallel_3dfft.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/gmx_parallel_3dfft.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/gmx_wallcycle.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/gmx_wallcycle.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/groupcoord.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/groupcoord.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/init.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/init.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/iteratedconstraints.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/iteratedconstraints.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/md_support.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/md_support.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/mdatom.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/mdatom.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/mdebin.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/mdebin.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/mdebin_bar.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/mdebin_bar.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/minimize.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/minimize.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/mvxvf.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/mvxvf.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_atomdata.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_atomdata.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/nbnxn_kernel_common.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/nbnxn_kernel_common.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/nbnxn_kernel_gpu_ref.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/nbnxn_kernel_gpu_ref.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/nbnxn_kernel_ref.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/nbnxn_kernel_ref.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/nbnxn_kernel_x86_simd128.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/nbnxn_kernel_x86_simd128.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/nbnxn_kernel_x86_simd256.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/nbnxn_kernel_x86_simd256.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/nbnxn_kernel_x86_simd512.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_kernels/nbnxn_kernel_x86_simd512.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_search.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nbnxn_search.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nlistheuristics.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nlistheuristics.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/ns.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/ns.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/nsgrid.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/nsgrid.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/partdec.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/partdec.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/perf_est.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/perf_est.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/pme.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/pme.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/pme_pp.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/pme_pp.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/pull.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/pull.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/pull_rotation.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/pull_rotation.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/pullutil.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/pullutil.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/qm_gamess.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/qm_gamess.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/qm_gaussian.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/qm_gaussian.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/qm_mopac.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/qm_mopac.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/qm_orca.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/qm_orca.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/qm_qchem.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/qm_qchem.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/qmmm.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/qmmm.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/rf_util.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/rf_util.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/shakef.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/shakef.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/shellfc.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/shellfc.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/sim_util.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/sim_util.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/stat.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/stat.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/tables.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/tables.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/tgroup.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/tgroup.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/tpi.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/tpi.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/update.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/update.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/vcm.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/vcm.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/vsite.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/vsite.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/wall.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/wall.c.o.d"
+  "CMakeFiles/libgromacs.dir/mdlib/wnblist.c.o"
+  "CMakeFiles/libgromacs.dir/mdlib/wnblist.c.o.d"
+  "CMakeFiles/libgromacs.dir/onlinehelp/helpformat.cpp.o"
+  "CMakeFiles/libgromacs.dir/onlinehelp/helpformat.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/onlinehelp/helpmanager.cpp.o"
+  "CMakeFiles/libgromacs.dir/onlinehelp/helpmanager.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/onlinehelp/helptopic.cpp.o"
+  "CMakeFiles/libgromacs.dir/onlinehelp/helptopic.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/onlinehelp/helpwritercontext.cpp.o"
+  "CMakeFiles/libgromacs.dir/onlinehelp/helpwritercontext.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/options/abstractoption.cpp.o"
+  "CMakeFiles/libgromacs.dir/options/abstractoption.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/options/basicoptions.cpp.o"
+  "CMakeFiles/libgromacs.dir/options/basicoptions.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/options/filenameoption.cpp.o"
+  "CMakeFiles/libgromacs.dir/options/filenameoption.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/options/options.cpp.o"
+  "CMakeFiles/libgromacs.dir/options/options.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/options/optionsassigner.cpp.o"
+  "CMakeFiles/libgromacs.dir/options/optionsassigner.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/options/optionsvisitor.cpp.o"
+  "CMakeFiles/libgromacs.dir/options/optionsvisitor.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/options/timeunitmanager.cpp.o"
+  "CMakeFiles/libgromacs.dir/options/timeunitmanager.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/selection/centerofmass.cpp.o"
+  "CMakeFiles/libgromacs.dir/selection/centerofmass.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/selection/compiler.cpp.o"
+  "CMakeFiles/libgromacs.dir/selection/compiler.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/selection/evaluate.cpp.o"
+  "CMakeFiles/libgromacs.dir/selection/evaluate.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/selection/indexutil.cpp.o"
+  "CMakeFiles/libgromacs.dir/selection/indexutil.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/selection/mempool.cpp.o"
+  "CMakeFiles/libgromacs.dir/selection/mempool.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/selection/nbsearch.cpp.o"
+  "CMakeFiles/libgromacs.dir/selection/nbsearch.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/selection/params.cpp.o"
+  "CMakeFiles/libgromacs.dir/selection/params.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/selection/parser.cpp.o"
+  "CMakeFiles/libgromacs.dir/selection/parser.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/selection/parsetree.cpp.o"
+  "CMakeFiles/libgromacs.dir/selection/parsetree.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/selection/poscalc.cpp.o"
+  "CMakeFiles/libgromacs.dir/selection/poscalc.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/selection/position.cpp.o"
+  "CMakeFiles/libgromacs.dir/selection/position.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/selection/scanner.cpp.o"
+  "CMakeFiles/libgromacs.dir/selection/scanner.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/selection/scanner_internal.cpp.o"
+  "CMakeFiles/libgromacs.dir/selection/scanner_internal.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/selection/selection.cpp.o"
+  "CMakeFiles/libgromacs.dir/selection/selection.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/selection/selectioncollection.cpp.o"
+  "CMakeFiles/libgromacs.dir/selection/selectioncollection.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/selection/selectionoption.cpp.o"
+  "CMakeFiles/libgromacs.dir/selection/selectionoption.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/selection/selectionoptionmanager.cpp.o"
+  "CMakeFiles/libgromacs.dir/selection/selectionoptionmanager.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/selection/selelem.cpp.o"
+  "CMakeFiles/libgromacs.dir/selection/selelem.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/selection/selhelp.cpp.o"
+  "CMakeFiles/libgromacs.dir/selection/selhelp.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/selection/selmethod.cpp.o"
+  "CMakeFiles/libgromacs.dir/selection/selmethod.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/selection/selvalue.cpp.o"
+  "CMakeFiles/libgromacs.dir/selection/selvalue.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/selection/sm_compare.cpp.o"
+  "CMakeFiles/libgromacs.dir/selection/sm_compare.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/selection/sm_distance.cpp.o"
+  "CMakeFiles/libgromacs.dir/selection/sm_distance.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/selection/sm_insolidangle.cpp.o"
+  "CMakeFiles/libgromacs.dir/selection/sm_insolidangle.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/selection/sm_keywords.cpp.o"
+  "CMakeFiles/libgromacs.dir/selection/sm_keywords.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/selection/sm_merge.cpp.o"
+  "CMakeFiles/libgromacs.dir/selection/sm_merge.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/selection/sm_permute.cpp.o"
+  "CMakeFiles/libgromacs.dir/selection/sm_permute.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/selection/sm_position.cpp.o"
+  "CMakeFiles/libgromacs.dir/selection/sm_position.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/selection/sm_same.cpp.o"
+  "CMakeFiles/libgromacs.dir/selection/sm_same.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/selection/sm_simple.cpp.o"
+  "CMakeFiles/libgromacs.dir/selection/sm_simple.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/selection/symrec.cpp.o"
+  "CMakeFiles/libgromacs.dir/selection/symrec.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/trajectoryanalysis/analysismodule.cpp.o"
+  "CMakeFiles/libgromacs.dir/trajectoryanalysis/analysismodule.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/trajectoryanalysis/analysissettings.cpp.o"
+  "CMakeFiles/libgromacs.dir/trajectoryanalysis/analysissettings.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/trajectoryanalysis/cmdlinerunner.cpp.o"
+  "CMakeFiles/libgromacs.dir/trajectoryanalysis/cmdlinerunner.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/trajectoryanalysis/modules.cpp.o"
+  "CMakeFiles/libgromacs.dir/trajectoryanalysis/modules.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/trajectoryanalysis/modules/angle.cpp.o"
+  "CMakeFiles/libgromacs.dir/trajectoryanalysis/modules/angle.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/trajectoryanalysis/modules/distance.cpp.o"
+  "CMakeFiles/libgromacs.dir/trajectoryanalysis/modules/distance.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/trajectoryanalysis/modules/select.cpp.o"
+  "CMakeFiles/libgromacs.dir/trajectoryanalysis/modules/select.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/trajectoryanalysis/runnercommon.cpp.o"
+  "CMakeFiles/libgromacs.dir/trajectoryanalysis/runnercommon.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/utility/errorcodes.cpp.o"
+  "CMakeFiles/libgromacs.dir/utility/errorcodes.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/utility/errorformat.cpp.o"
+  "CMakeFiles/libgromacs.dir/utility/errorformat.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/utility/exceptions.cpp.o"
+  "CMakeFiles/libgromacs.dir/utility/exceptions.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/utility/file.cpp.o"
+  "CMakeFiles/libgromacs.dir/utility/file.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/utility/gitversion.c.o"
+  "CMakeFiles/libgromacs.dir/utility/gitversion.c.o.d"
+  "CMakeFiles/libgromacs.dir/utility/gmxassert.cpp.o"
+  "CMakeFiles/libgromacs.dir/utility/gmxassert.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/utility/gmxregex.cpp.o"
+  "CMakeFiles/libgromacs.dir/utility/gmxregex.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/utility/messagestringcollector.cpp.o"
+  "CMakeFiles/libgromacs.dir/utility/messagestringcollector.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/utility/path.cpp.o"
+  "CMakeFiles/libgromacs.dir/utility/path.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/utility/programinfo.cpp.o"
+  "CMakeFiles/libgromacs.dir/utility/programinfo.cpp.o.d"
+  "CMakeFiles/libgromacs.dir/utility/stringutil.cpp.o"
+  "CMakeFiles/libgromacs.dir/utility/stringutil.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/libgromacs.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,18 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/gromacs
+# Build directory: /root/repo/_qc_build/src/gromacs
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("legacyheaders")
+subdirs("gmxlib")
+subdirs("mdlib")
+subdirs("gmxpreprocess")
+subdirs("analysisdata")
+subdirs("commandline")
+subdirs("linearalgebra")
+subdirs("onlinehelp")
+subdirs("options")
+subdirs("selection")
+subdirs("trajectoryanalysis")
+subdirs("utility")
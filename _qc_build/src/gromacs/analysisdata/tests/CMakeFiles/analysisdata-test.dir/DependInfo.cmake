@@ -0,0 +1,26 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/testutils/unittest_main.cpp" "src/gromacs/analysisdata/tests/CMakeFiles/analysisdata-test.dir/__/__/__/testutils/unittest_main.cpp.o" "gcc" "src/gromacs/analysisdata/tests/CMakeFiles/analysisdata-test.dir/__/__/__/testutils/unittest_main.cpp.o.d"
+  "/root/repo/src/gromacs/analysisdata/tests/analysisdata.cpp" "src/gromacs/analysisdata/tests/CMakeFiles/analysisdata-test.dir/analysisdata.cpp.o" "gcc" "src/gromacs/analysisdata/tests/CMakeFiles/analysisdata-test.dir/analysisdata.cpp.o.d"
+  "/root/repo/src/gromacs/analysisdata/tests/arraydata.cpp" "src/gromacs/analysisdata/tests/CMakeFiles/analysisdata-test.dir/arraydata.cpp.o" "gcc" "src/gromacs/analysisdata/tests/CMakeFiles/analysisdata-test.dir/arraydata.cpp.o.d"
+  "/root/repo/src/gromacs/analysisdata/tests/average.cpp" "src/gromacs/analysisdata/tests/CMakeFiles/analysisdata-test.dir/average.cpp.o" "gcc" "src/gromacs/analysisdata/tests/CMakeFiles/analysisdata-test.dir/average.cpp.o.d"
+  "/root/repo/src/gromacs/analysisdata/tests/histogram.cpp" "src/gromacs/analysisdata/tests/CMakeFiles/analysisdata-test.dir/histogram.cpp.o" "gcc" "src/gromacs/analysisdata/tests/CMakeFiles/analysisdata-test.dir/histogram.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_qc_build/src/testutils/CMakeFiles/testutils.dir/DependInfo.cmake"
+  "/root/repo/_qc_build/src/external/gmock-1.6.0/CMakeFiles/gmock.dir/DependInfo.cmake"
+  "/root/repo/_qc_build/src/gromacs/CMakeFiles/libgromacs.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
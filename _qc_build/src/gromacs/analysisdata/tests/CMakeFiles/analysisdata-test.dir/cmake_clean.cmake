@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "../../../../bin/analysisdata-test"
+  "../../../../bin/analysisdata-test.pdb"
+  "CMakeFiles/analysisdata-test.dir/__/__/__/testutils/unittest_main.cpp.o"
+  "CMakeFiles/analysisdata-test.dir/__/__/__/testutils/unittest_main.cpp.o.d"
+  "CMakeFiles/analysisdata-test.dir/analysisdata.cpp.o"
+  "CMakeFiles/analysisdata-test.dir/analysisdata.cpp.o.d"
+  "CMakeFiles/analysisdata-test.dir/arraydata.cpp.o"
+  "CMakeFiles/analysisdata-test.dir/arraydata.cpp.o.d"
+  "CMakeFiles/analysisdata-test.dir/average.cpp.o"
+  "CMakeFiles/analysisdata-test.dir/average.cpp.o.d"
+  "CMakeFiles/analysisdata-test.dir/histogram.cpp.o"
+  "CMakeFiles/analysisdata-test.dir/histogram.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/analysisdata-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/gromacs/analysisdata/tests
+# Build directory: /root/repo/_qc_build/src/gromacs/analysisdata/tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(AnalysisDataUnitTests "/root/repo/_qc_build/bin/analysisdata-test" "--gtest_output=xml:/root/repo/_qc_build/Testing/Temporary/analysisdata-test.xml")
+set_tests_properties(AnalysisDataUnitTests PROPERTIES  LABELS "GTest" _BACKTRACE_TRIPLES "/root/repo/src/testutils/TestMacros.cmake;12;add_test;/root/repo/src/gromacs/analysisdata/tests/CMakeLists.txt;1;gmx_add_unit_test;/root/repo/src/gromacs/analysisdata/tests/CMakeLists.txt;0;")
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "../../../../bin/commandline-test"
+  "../../../../bin/commandline-test.pdb"
+  "CMakeFiles/commandline-test.dir/__/__/__/testutils/unittest_main.cpp.o"
+  "CMakeFiles/commandline-test.dir/__/__/__/testutils/unittest_main.cpp.o.d"
+  "CMakeFiles/commandline-test.dir/cmdlinehelpwriter.cpp.o"
+  "CMakeFiles/commandline-test.dir/cmdlinehelpwriter.cpp.o.d"
+  "CMakeFiles/commandline-test.dir/cmdlinemodulemanager.cpp.o"
+  "CMakeFiles/commandline-test.dir/cmdlinemodulemanager.cpp.o.d"
+  "CMakeFiles/commandline-test.dir/cmdlineparser.cpp.o"
+  "CMakeFiles/commandline-test.dir/cmdlineparser.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/commandline-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
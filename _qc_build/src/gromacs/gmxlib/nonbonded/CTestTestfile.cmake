@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/gromacs/gmxlib/nonbonded
+# Build directory: /root/repo/_qc_build/src/gromacs/gmxlib/nonbonded
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../../bin/gmxlib-test"
+  "../../../../bin/gmxlib-test.pdb"
+  "CMakeFiles/gmxlib-test.dir/__/__/__/testutils/unittest_main.cpp.o"
+  "CMakeFiles/gmxlib-test.dir/__/__/__/testutils/unittest_main.cpp.o.d"
+  "CMakeFiles/gmxlib-test.dir/trxio.cpp.o"
+  "CMakeFiles/gmxlib-test.dir/trxio.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/gmxlib-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/gromacs/gmxpreprocess
+# Build directory: /root/repo/_qc_build/src/gromacs/gmxpreprocess
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
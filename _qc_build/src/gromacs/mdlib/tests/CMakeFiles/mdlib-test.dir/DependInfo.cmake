@@ -0,0 +1,25 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/testutils/unittest_main.cpp" "src/gromacs/mdlib/tests/CMakeFiles/mdlib-test.dir/__/__/__/testutils/unittest_main.cpp.o" "gcc" "src/gromacs/mdlib/tests/CMakeFiles/mdlib-test.dir/__/__/__/testutils/unittest_main.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/tests/fft.cpp" "src/gromacs/mdlib/tests/CMakeFiles/mdlib-test.dir/fft.cpp.o" "gcc" "src/gromacs/mdlib/tests/CMakeFiles/mdlib-test.dir/fft.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/tests/qchem.cpp" "src/gromacs/mdlib/tests/CMakeFiles/mdlib-test.dir/qchem.cpp.o" "gcc" "src/gromacs/mdlib/tests/CMakeFiles/mdlib-test.dir/qchem.cpp.o.d"
+  "/root/repo/src/gromacs/mdlib/tests/qmmm.cpp" "src/gromacs/mdlib/tests/CMakeFiles/mdlib-test.dir/qmmm.cpp.o" "gcc" "src/gromacs/mdlib/tests/CMakeFiles/mdlib-test.dir/qmmm.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_qc_build/src/testutils/CMakeFiles/testutils.dir/DependInfo.cmake"
+  "/root/repo/_qc_build/src/external/gmock-1.6.0/CMakeFiles/gmock.dir/DependInfo.cmake"
+  "/root/repo/_qc_build/src/gromacs/CMakeFiles/libgromacs.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "../../../../bin/mdlib-test"
+  "../../../../bin/mdlib-test.pdb"
+  "CMakeFiles/mdlib-test.dir/__/__/__/testutils/unittest_main.cpp.o"
+  "CMakeFiles/mdlib-test.dir/__/__/__/testutils/unittest_main.cpp.o.d"
+  "CMakeFiles/mdlib-test.dir/fft.cpp.o"
+  "CMakeFiles/mdlib-test.dir/fft.cpp.o.d"
+  "CMakeFiles/mdlib-test.dir/qchem.cpp.o"
+  "CMakeFiles/mdlib-test.dir/qchem.cpp.o.d"
+  "CMakeFiles/mdlib-test.dir/qmmm.cpp.o"
+  "CMakeFiles/mdlib-test.dir/qmmm.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mdlib-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,21 @@
+file(REMOVE_RECURSE
+  "../../../../bin/options-test"
+  "../../../../bin/options-test.pdb"
+  "CMakeFiles/options-test.dir/__/__/__/testutils/unittest_main.cpp.o"
+  "CMakeFiles/options-test.dir/__/__/__/testutils/unittest_main.cpp.o.d"
+  "CMakeFiles/options-test.dir/abstractoptionstorage.cpp.o"
+  "CMakeFiles/options-test.dir/abstractoptionstorage.cpp.o.d"
+  "CMakeFiles/options-test.dir/filenameoption.cpp.o"
+  "CMakeFiles/options-test.dir/filenameoption.cpp.o.d"
+  "CMakeFiles/options-test.dir/option.cpp.o"
+  "CMakeFiles/options-test.dir/option.cpp.o.d"
+  "CMakeFiles/options-test.dir/optionsassigner.cpp.o"
+  "CMakeFiles/options-test.dir/optionsassigner.cpp.o.d"
+  "CMakeFiles/options-test.dir/timeunitmanager.cpp.o"
+  "CMakeFiles/options-test.dir/timeunitmanager.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/options-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
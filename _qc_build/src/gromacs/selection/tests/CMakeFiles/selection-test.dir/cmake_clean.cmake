@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../../../bin/selection-test"
+  "../../../../bin/selection-test.pdb"
+  "CMakeFiles/selection-test.dir/__/__/__/testutils/unittest_main.cpp.o"
+  "CMakeFiles/selection-test.dir/__/__/__/testutils/unittest_main.cpp.o.d"
+  "CMakeFiles/selection-test.dir/selectioncollection.cpp.o"
+  "CMakeFiles/selection-test.dir/selectioncollection.cpp.o.d"
+  "CMakeFiles/selection-test.dir/selectionoption.cpp.o"
+  "CMakeFiles/selection-test.dir/selectionoption.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/selection-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "../../../../bin/trajectoryanalysis-test"
+  "../../../../bin/trajectoryanalysis-test.pdb"
+  "CMakeFiles/trajectoryanalysis-test.dir/__/__/__/testutils/unittest_main.cpp.o"
+  "CMakeFiles/trajectoryanalysis-test.dir/__/__/__/testutils/unittest_main.cpp.o.d"
+  "CMakeFiles/trajectoryanalysis-test.dir/angle.cpp.o"
+  "CMakeFiles/trajectoryanalysis-test.dir/angle.cpp.o.d"
+  "CMakeFiles/trajectoryanalysis-test.dir/moduletest.cpp.o"
+  "CMakeFiles/trajectoryanalysis-test.dir/moduletest.cpp.o.d"
+  "CMakeFiles/trajectoryanalysis-test.dir/select.cpp.o"
+  "CMakeFiles/trajectoryanalysis-test.dir/select.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/trajectoryanalysis-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
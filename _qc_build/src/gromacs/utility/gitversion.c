@@ -0,0 +1,5 @@
+#include "gromacs/utility/gitversion.h"
+
+const char _gmx_ver_string[] = "VERSION 5.0-dev-20261017-7363cff-dirty-unknown";
+const char _gmx_full_git_hash[] = "7363cffe8b47f8c4f2f8dc4a900c91f19f72712b (dirty)";
+const char _gmx_central_base_hash[] = "unknown";
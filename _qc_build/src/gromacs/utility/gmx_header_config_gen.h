@@ -0,0 +1,24 @@
+/*! \file
+ * \brief
+ * Generated include file for configuration macros that affect installed
+ * headers.
+ *
+ * This include file will configured by CMake and installed with GROMACS
+ * header files so that they can refer to a central location for \#defines that
+ * will be available for builds of projects that depend on GROMACS.
+ *
+ * gmx_header_config.h should be included instead of this file to allow usage
+ * of relative install paths.
+ *
+ * \inlibraryapi
+ * \ingroup module_utility
+ */
+
+/** Detect Cygwin */
+/* #undef GMX_CYGWIN */
+
+/** Detect native (i.e. non-Cygwin) Windows */
+/* #undef GMX_NATIVE_WINDOWS */
+
+/** Define if we have sufficient C++11 support */
+#define GMX_CXX11
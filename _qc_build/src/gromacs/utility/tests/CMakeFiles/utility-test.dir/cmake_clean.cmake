@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../../bin/utility-test"
+  "../../../../bin/utility-test.pdb"
+  "CMakeFiles/utility-test.dir/__/__/__/testutils/unittest_main.cpp.o"
+  "CMakeFiles/utility-test.dir/__/__/__/testutils/unittest_main.cpp.o.d"
+  "CMakeFiles/utility-test.dir/stringutil.cpp.o"
+  "CMakeFiles/utility-test.dir/stringutil.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/utility-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/gromacs/utility/tests
+# Build directory: /root/repo/_qc_build/src/gromacs/utility/tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(UtilityUnitTests "/root/repo/_qc_build/bin/utility-test" "--gtest_output=xml:/root/repo/_qc_build/Testing/Temporary/utility-test.xml")
+set_tests_properties(UtilityUnitTests PROPERTIES  LABELS "GTest" _BACKTRACE_TRIPLES "/root/repo/src/testutils/TestMacros.cmake;12;add_test;/root/repo/src/gromacs/utility/tests/CMakeLists.txt;1;gmx_add_unit_test;/root/repo/src/gromacs/utility/tests/CMakeLists.txt;0;")
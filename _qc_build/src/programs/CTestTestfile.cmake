@@ -0,0 +1,15 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/programs
+# Build directory: /root/repo/_qc_build/src/programs
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("mdrun")
+subdirs("gmx")
+subdirs("g_protonate")
+subdirs("g_x2top")
+subdirs("gmxcheck")
+subdirs("gmxdump")
+subdirs("grompp")
+subdirs("pdb2gmx")
+subdirs("tpbconv")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../bin/g_protonate"
+  "../../../bin/g_protonate.pdb"
+  "CMakeFiles/g_protonate.dir/__/main.cpp.o"
+  "CMakeFiles/g_protonate.dir/__/main.cpp.o.d"
+  "CMakeFiles/g_protonate.dir/g_protonate.c.o"
+  "CMakeFiles/g_protonate.dir/g_protonate.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/g_protonate.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
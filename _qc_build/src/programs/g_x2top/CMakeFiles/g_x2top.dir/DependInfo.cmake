@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/programs/g_x2top/g_x2top.c" "src/programs/g_x2top/CMakeFiles/g_x2top.dir/g_x2top.c.o" "gcc" "src/programs/g_x2top/CMakeFiles/g_x2top.dir/g_x2top.c.o.d"
+  "/root/repo/src/programs/g_x2top/nm2type.c" "src/programs/g_x2top/CMakeFiles/g_x2top.dir/nm2type.c.o" "gcc" "src/programs/g_x2top/CMakeFiles/g_x2top.dir/nm2type.c.o.d"
+  "/root/repo/src/programs/main.cpp" "src/programs/g_x2top/CMakeFiles/g_x2top.dir/__/main.cpp.o" "gcc" "src/programs/g_x2top/CMakeFiles/g_x2top.dir/__/main.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_qc_build/src/gromacs/CMakeFiles/libgromacs.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
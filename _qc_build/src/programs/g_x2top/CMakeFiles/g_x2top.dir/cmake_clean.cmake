@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../../bin/g_x2top"
+  "../../../bin/g_x2top.pdb"
+  "CMakeFiles/g_x2top.dir/__/main.cpp.o"
+  "CMakeFiles/g_x2top.dir/__/main.cpp.o.d"
+  "CMakeFiles/g_x2top.dir/g_x2top.c.o"
+  "CMakeFiles/g_x2top.dir/g_x2top.c.o.d"
+  "CMakeFiles/g_x2top.dir/nm2type.c.o"
+  "CMakeFiles/g_x2top.dir/nm2type.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/g_x2top.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
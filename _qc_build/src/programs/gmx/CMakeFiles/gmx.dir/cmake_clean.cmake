@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../bin/gmx"
+  "../../../bin/gmx.pdb"
+  "CMakeFiles/gmx.dir/gmx.cpp.o"
+  "CMakeFiles/gmx.dir/gmx.cpp.o.d"
+  "CMakeFiles/gmx.dir/legacymodules.cpp.o"
+  "CMakeFiles/gmx.dir/legacymodules.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/gmx.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
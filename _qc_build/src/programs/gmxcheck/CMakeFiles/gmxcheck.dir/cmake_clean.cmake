@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../../bin/gmxcheck"
+  "../../../bin/gmxcheck.pdb"
+  "CMakeFiles/gmxcheck.dir/__/main.cpp.o"
+  "CMakeFiles/gmxcheck.dir/__/main.cpp.o.d"
+  "CMakeFiles/gmxcheck.dir/gmxcheck.c.o"
+  "CMakeFiles/gmxcheck.dir/gmxcheck.c.o.d"
+  "CMakeFiles/gmxcheck.dir/tpbcmp.c.o"
+  "CMakeFiles/gmxcheck.dir/tpbcmp.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/gmxcheck.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/programs/gmxdump/gmxdump.c" "src/programs/gmxdump/CMakeFiles/gmxdump.dir/gmxdump.c.o" "gcc" "src/programs/gmxdump/CMakeFiles/gmxdump.dir/gmxdump.c.o.d"
+  "/root/repo/src/programs/main.cpp" "src/programs/gmxdump/CMakeFiles/gmxdump.dir/__/main.cpp.o" "gcc" "src/programs/gmxdump/CMakeFiles/gmxdump.dir/__/main.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_qc_build/src/gromacs/CMakeFiles/libgromacs.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../bin/gmxdump"
+  "../../../bin/gmxdump.pdb"
+  "CMakeFiles/gmxdump.dir/__/main.cpp.o"
+  "CMakeFiles/gmxdump.dir/__/main.cpp.o.d"
+  "CMakeFiles/gmxdump.dir/gmxdump.c.o"
+  "CMakeFiles/gmxdump.dir/gmxdump.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/gmxdump.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
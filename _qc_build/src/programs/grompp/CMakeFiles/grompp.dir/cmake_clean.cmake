@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "../../../bin/grompp"
+  "../../../bin/grompp.pdb"
+  "CMakeFiles/grompp.dir/__/main.cpp.o"
+  "CMakeFiles/grompp.dir/__/main.cpp.o.d"
+  "CMakeFiles/grompp.dir/convparm.c.o"
+  "CMakeFiles/grompp.dir/convparm.c.o.d"
+  "CMakeFiles/grompp.dir/grompp.c.o"
+  "CMakeFiles/grompp.dir/grompp.c.o.d"
+  "CMakeFiles/grompp.dir/tomorse.c.o"
+  "CMakeFiles/grompp.dir/tomorse.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/grompp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/install-mdrun"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/install-mdrun.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,32 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/programs/mdrun/do_gct.c" "src/programs/mdrun/CMakeFiles/mdrun.dir/do_gct.c.o" "gcc" "src/programs/mdrun/CMakeFiles/mdrun.dir/do_gct.c.o.d"
+  "/root/repo/src/programs/mdrun/gctio.c" "src/programs/mdrun/CMakeFiles/mdrun.dir/gctio.c.o" "gcc" "src/programs/mdrun/CMakeFiles/mdrun.dir/gctio.c.o.d"
+  "/root/repo/src/programs/mdrun/genalg.c" "src/programs/mdrun/CMakeFiles/mdrun.dir/genalg.c.o" "gcc" "src/programs/mdrun/CMakeFiles/mdrun.dir/genalg.c.o.d"
+  "/root/repo/src/programs/mdrun/ionize.c" "src/programs/mdrun/CMakeFiles/mdrun.dir/ionize.c.o" "gcc" "src/programs/mdrun/CMakeFiles/mdrun.dir/ionize.c.o.d"
+  "/root/repo/src/programs/mdrun/md.c" "src/programs/mdrun/CMakeFiles/mdrun.dir/md.c.o" "gcc" "src/programs/mdrun/CMakeFiles/mdrun.dir/md.c.o.d"
+  "/root/repo/src/programs/mdrun/md_openmm.c" "src/programs/mdrun/CMakeFiles/mdrun.dir/md_openmm.c.o" "gcc" "src/programs/mdrun/CMakeFiles/mdrun.dir/md_openmm.c.o.d"
+  "/root/repo/src/programs/mdrun/mdrun.c" "src/programs/mdrun/CMakeFiles/mdrun.dir/mdrun.c.o" "gcc" "src/programs/mdrun/CMakeFiles/mdrun.dir/mdrun.c.o.d"
+  "/root/repo/src/programs/mdrun/membed.c" "src/programs/mdrun/CMakeFiles/mdrun.dir/membed.c.o" "gcc" "src/programs/mdrun/CMakeFiles/mdrun.dir/membed.c.o.d"
+  "/root/repo/src/programs/mdrun/pme_loadbal.c" "src/programs/mdrun/CMakeFiles/mdrun.dir/pme_loadbal.c.o" "gcc" "src/programs/mdrun/CMakeFiles/mdrun.dir/pme_loadbal.c.o.d"
+  "/root/repo/src/programs/mdrun/repl_ex.c" "src/programs/mdrun/CMakeFiles/mdrun.dir/repl_ex.c.o" "gcc" "src/programs/mdrun/CMakeFiles/mdrun.dir/repl_ex.c.o.d"
+  "/root/repo/src/programs/mdrun/runner.c" "src/programs/mdrun/CMakeFiles/mdrun.dir/runner.c.o" "gcc" "src/programs/mdrun/CMakeFiles/mdrun.dir/runner.c.o.d"
+  "/root/repo/src/programs/mdrun/xutils.c" "src/programs/mdrun/CMakeFiles/mdrun.dir/xutils.c.o" "gcc" "src/programs/mdrun/CMakeFiles/mdrun.dir/xutils.c.o.d"
+  "/root/repo/src/programs/main.cpp" "src/programs/mdrun/CMakeFiles/mdrun.dir/__/main.cpp.o" "gcc" "src/programs/mdrun/CMakeFiles/mdrun.dir/__/main.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_qc_build/src/gromacs/CMakeFiles/libgromacs.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
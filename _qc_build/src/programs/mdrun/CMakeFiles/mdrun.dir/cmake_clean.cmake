@@ -0,0 +1,35 @@
+file(REMOVE_RECURSE
+  "../../../bin/mdrun"
+  "../../../bin/mdrun.pdb"
+  "CMakeFiles/mdrun.dir/__/main.cpp.o"
+  "CMakeFiles/mdrun.dir/__/main.cpp.o.d"
+  "CMakeFiles/mdrun.dir/do_gct.c.o"
+  "CMakeFiles/mdrun.dir/do_gct.c.o.d"
+  "CMakeFiles/mdrun.dir/gctio.c.o"
+  "CMakeFiles/mdrun.dir/gctio.c.o.d"
+  "CMakeFiles/mdrun.dir/genalg.c.o"
+  "CMakeFiles/mdrun.dir/genalg.c.o.d"
+  "CMakeFiles/mdrun.dir/ionize.c.o"
+  "CMakeFiles/mdrun.dir/ionize.c.o.d"
+  "CMakeFiles/mdrun.dir/md.c.o"
+  "CMakeFiles/mdrun.dir/md.c.o.d"
+  "CMakeFiles/mdrun.dir/md_openmm.c.o"
+  "CMakeFiles/mdrun.dir/md_openmm.c.o.d"
+  "CMakeFiles/mdrun.dir/mdrun.c.o"
+  "CMakeFiles/mdrun.dir/mdrun.c.o.d"
+  "CMakeFiles/mdrun.dir/membed.c.o"
+  "CMakeFiles/mdrun.dir/membed.c.o.d"
+  "CMakeFiles/mdrun.dir/pme_loadbal.c.o"
+  "CMakeFiles/mdrun.dir/pme_loadbal.c.o.d"
+  "CMakeFiles/mdrun.dir/repl_ex.c.o"
+  "CMakeFiles/mdrun.dir/repl_ex.c.o.d"
+  "CMakeFiles/mdrun.dir/runner.c.o"
+  "CMakeFiles/mdrun.dir/runner.c.o.d"
+  "CMakeFiles/mdrun.dir/xutils.c.o"
+  "CMakeFiles/mdrun.dir/xutils.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/mdrun.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
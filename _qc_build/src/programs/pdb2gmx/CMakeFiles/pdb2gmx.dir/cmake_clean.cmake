@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "../../../bin/pdb2gmx"
+  "../../../bin/pdb2gmx.pdb"
+  "CMakeFiles/pdb2gmx.dir/__/main.cpp.o"
+  "CMakeFiles/pdb2gmx.dir/__/main.cpp.o.d"
+  "CMakeFiles/pdb2gmx.dir/hizzie.c.o"
+  "CMakeFiles/pdb2gmx.dir/hizzie.c.o.d"
+  "CMakeFiles/pdb2gmx.dir/pdb2gmx.c.o"
+  "CMakeFiles/pdb2gmx.dir/pdb2gmx.c.o.d"
+  "CMakeFiles/pdb2gmx.dir/specbond.c.o"
+  "CMakeFiles/pdb2gmx.dir/specbond.c.o.d"
+  "CMakeFiles/pdb2gmx.dir/xlate.c.o"
+  "CMakeFiles/pdb2gmx.dir/xlate.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/pdb2gmx.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../bin/tpbconv"
+  "../../../bin/tpbconv.pdb"
+  "CMakeFiles/tpbconv.dir/__/main.cpp.o"
+  "CMakeFiles/tpbconv.dir/__/main.cpp.o.d"
+  "CMakeFiles/tpbconv.dir/tpbconv.c.o"
+  "CMakeFiles/tpbconv.dir/tpbconv.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/tpbconv.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
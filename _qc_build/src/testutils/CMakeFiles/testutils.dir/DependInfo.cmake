@@ -0,0 +1,29 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/testutils/cmdlinetest.cpp" "src/testutils/CMakeFiles/testutils.dir/cmdlinetest.cpp.o" "gcc" "src/testutils/CMakeFiles/testutils.dir/cmdlinetest.cpp.o.d"
+  "/root/repo/src/testutils/datatest.cpp" "src/testutils/CMakeFiles/testutils.dir/datatest.cpp.o" "gcc" "src/testutils/CMakeFiles/testutils.dir/datatest.cpp.o.d"
+  "/root/repo/src/testutils/mock_datamodule.cpp" "src/testutils/CMakeFiles/testutils.dir/mock_datamodule.cpp.o" "gcc" "src/testutils/CMakeFiles/testutils.dir/mock_datamodule.cpp.o.d"
+  "/root/repo/src/testutils/mock_helptopic.cpp" "src/testutils/CMakeFiles/testutils.dir/mock_helptopic.cpp.o" "gcc" "src/testutils/CMakeFiles/testutils.dir/mock_helptopic.cpp.o.d"
+  "/root/repo/src/testutils/refdata.cpp" "src/testutils/CMakeFiles/testutils.dir/refdata.cpp.o" "gcc" "src/testutils/CMakeFiles/testutils.dir/refdata.cpp.o.d"
+  "/root/repo/src/testutils/stringtest.cpp" "src/testutils/CMakeFiles/testutils.dir/stringtest.cpp.o" "gcc" "src/testutils/CMakeFiles/testutils.dir/stringtest.cpp.o.d"
+  "/root/repo/src/testutils/testfilemanager.cpp" "src/testutils/CMakeFiles/testutils.dir/testfilemanager.cpp.o" "gcc" "src/testutils/CMakeFiles/testutils.dir/testfilemanager.cpp.o.d"
+  "/root/repo/src/testutils/testoptions.cpp" "src/testutils/CMakeFiles/testutils.dir/testoptions.cpp.o" "gcc" "src/testutils/CMakeFiles/testutils.dir/testoptions.cpp.o.d"
+  "/root/repo/src/testutils/unittest_main.cpp" "src/testutils/CMakeFiles/testutils.dir/unittest_main.cpp.o" "gcc" "src/testutils/CMakeFiles/testutils.dir/unittest_main.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_qc_build/src/gromacs/CMakeFiles/libgromacs.dir/DependInfo.cmake"
+  "/root/repo/_qc_build/src/external/gmock-1.6.0/CMakeFiles/gmock.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,27 @@
+file(REMOVE_RECURSE
+  "../../lib/libtestutils.a"
+  "../../lib/libtestutils.pdb"
+  "CMakeFiles/testutils.dir/cmdlinetest.cpp.o"
+  "CMakeFiles/testutils.dir/cmdlinetest.cpp.o.d"
+  "CMakeFiles/testutils.dir/datatest.cpp.o"
+  "CMakeFiles/testutils.dir/datatest.cpp.o.d"
+  "CMakeFiles/testutils.dir/mock_datamodule.cpp.o"
+  "CMakeFiles/testutils.dir/mock_datamodule.cpp.o.d"
+  "CMakeFiles/testutils.dir/mock_helptopic.cpp.o"
+  "CMakeFiles/testutils.dir/mock_helptopic.cpp.o.d"
+  "CMakeFiles/testutils.dir/refdata.cpp.o"
+  "CMakeFiles/testutils.dir/refdata.cpp.o.d"
+  "CMakeFiles/testutils.dir/stringtest.cpp.o"
+  "CMakeFiles/testutils.dir/stringtest.cpp.o.d"
+  "CMakeFiles/testutils.dir/testfilemanager.cpp.o"
+  "CMakeFiles/testutils.dir/testfilemanager.cpp.o.d"
+  "CMakeFiles/testutils.dir/testoptions.cpp.o"
+  "CMakeFiles/testutils.dir/testoptions.cpp.o.d"
+  "CMakeFiles/testutils.dir/unittest_main.cpp.o"
+  "CMakeFiles/testutils.dir/unittest_main.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testutils.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
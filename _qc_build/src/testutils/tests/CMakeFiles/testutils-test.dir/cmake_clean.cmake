@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../bin/testutils-test"
+  "../../../bin/testutils-test.pdb"
+  "CMakeFiles/testutils-test.dir/__/unittest_main.cpp.o"
+  "CMakeFiles/testutils-test.dir/__/unittest_main.cpp.o.d"
+  "CMakeFiles/testutils-test.dir/refdata.cpp.o"
+  "CMakeFiles/testutils-test.dir/refdata.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testutils-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/g_pme_error"
+  "../../bin/g_pme_error.pdb"
+  "CMakeFiles/g_pme_error.dir/g_pme_error.c.o"
+  "CMakeFiles/g_pme_error.dir/g_pme_error.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/g_pme_error.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/g_tune_pme"
+  "../../bin/g_tune_pme.pdb"
+  "CMakeFiles/g_tune_pme.dir/g_tune_pme.c.o"
+  "CMakeFiles/g_tune_pme.dir/g_tune_pme.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/g_tune_pme.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
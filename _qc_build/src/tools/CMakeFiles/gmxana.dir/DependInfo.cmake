@@ -0,0 +1,132 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/tools/addconf.c" "src/tools/CMakeFiles/gmxana.dir/addconf.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/addconf.c.o.d"
+  "/root/repo/src/tools/anadih.c" "src/tools/CMakeFiles/gmxana.dir/anadih.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/anadih.c.o.d"
+  "/root/repo/src/tools/autocorr.c" "src/tools/CMakeFiles/gmxana.dir/autocorr.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/autocorr.c.o.d"
+  "/root/repo/src/tools/binsearch.c" "src/tools/CMakeFiles/gmxana.dir/binsearch.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/binsearch.c.o.d"
+  "/root/repo/src/tools/calcpot.c" "src/tools/CMakeFiles/gmxana.dir/calcpot.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/calcpot.c.o.d"
+  "/root/repo/src/tools/cmat.c" "src/tools/CMakeFiles/gmxana.dir/cmat.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/cmat.c.o.d"
+  "/root/repo/src/tools/correl.c" "src/tools/CMakeFiles/gmxana.dir/correl.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/correl.c.o.d"
+  "/root/repo/src/tools/dens_filter.c" "src/tools/CMakeFiles/gmxana.dir/dens_filter.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/dens_filter.c.o.d"
+  "/root/repo/src/tools/dlist.c" "src/tools/CMakeFiles/gmxana.dir/dlist.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/dlist.c.o.d"
+  "/root/repo/src/tools/edittop.c" "src/tools/CMakeFiles/gmxana.dir/edittop.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/edittop.c.o.d"
+  "/root/repo/src/tools/eigio.c" "src/tools/CMakeFiles/gmxana.dir/eigio.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/eigio.c.o.d"
+  "/root/repo/src/tools/expfit.c" "src/tools/CMakeFiles/gmxana.dir/expfit.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/expfit.c.o.d"
+  "/root/repo/src/tools/fitahx.c" "src/tools/CMakeFiles/gmxana.dir/fitahx.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/fitahx.c.o.d"
+  "/root/repo/src/tools/geminate.c" "src/tools/CMakeFiles/gmxana.dir/geminate.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/geminate.c.o.d"
+  "/root/repo/src/tools/gmx_anadock.c" "src/tools/CMakeFiles/gmxana.dir/gmx_anadock.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/gmx_anadock.c.o.d"
+  "/root/repo/src/tools/gmx_anaeig.c" "src/tools/CMakeFiles/gmxana.dir/gmx_anaeig.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/gmx_anaeig.c.o.d"
+  "/root/repo/src/tools/gmx_analyze.c" "src/tools/CMakeFiles/gmxana.dir/gmx_analyze.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/gmx_analyze.c.o.d"
+  "/root/repo/src/tools/gmx_angle.c" "src/tools/CMakeFiles/gmxana.dir/gmx_angle.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/gmx_angle.c.o.d"
+  "/root/repo/src/tools/gmx_bar.c" "src/tools/CMakeFiles/gmxana.dir/gmx_bar.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/gmx_bar.c.o.d"
+  "/root/repo/src/tools/gmx_bond.c" "src/tools/CMakeFiles/gmxana.dir/gmx_bond.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/gmx_bond.c.o.d"
+  "/root/repo/src/tools/gmx_bundle.c" "src/tools/CMakeFiles/gmxana.dir/gmx_bundle.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/gmx_bundle.c.o.d"
+  "/root/repo/src/tools/gmx_chi.c" "src/tools/CMakeFiles/gmxana.dir/gmx_chi.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/gmx_chi.c.o.d"
+  "/root/repo/src/tools/gmx_cluster.c" "src/tools/CMakeFiles/gmxana.dir/gmx_cluster.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/gmx_cluster.c.o.d"
+  "/root/repo/src/tools/gmx_clustsize.c" "src/tools/CMakeFiles/gmxana.dir/gmx_clustsize.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/gmx_clustsize.c.o.d"
+  "/root/repo/src/tools/gmx_confrms.c" "src/tools/CMakeFiles/gmxana.dir/gmx_confrms.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/gmx_confrms.c.o.d"
+  "/root/repo/src/tools/gmx_covar.c" "src/tools/CMakeFiles/gmxana.dir/gmx_covar.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/gmx_covar.c.o.d"
+  "/root/repo/src/tools/gmx_current.c" "src/tools/CMakeFiles/gmxana.dir/gmx_current.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/gmx_current.c.o.d"
+  "/root/repo/src/tools/gmx_density.c" "src/tools/CMakeFiles/gmxana.dir/gmx_density.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/gmx_density.c.o.d"
+  "/root/repo/src/tools/gmx_densmap.c" "src/tools/CMakeFiles/gmxana.dir/gmx_densmap.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/gmx_densmap.c.o.d"
+  "/root/repo/src/tools/gmx_densorder.c" "src/tools/CMakeFiles/gmxana.dir/gmx_densorder.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/gmx_densorder.c.o.d"
+  "/root/repo/src/tools/gmx_dielectric.c" "src/tools/CMakeFiles/gmxana.dir/gmx_dielectric.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/gmx_dielectric.c.o.d"
+  "/root/repo/src/tools/gmx_dih.c" "src/tools/CMakeFiles/gmxana.dir/gmx_dih.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/gmx_dih.c.o.d"
+  "/root/repo/src/tools/gmx_dipoles.c" "src/tools/CMakeFiles/gmxana.dir/gmx_dipoles.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/gmx_dipoles.c.o.d"
+  "/root/repo/src/tools/gmx_disre.c" "src/tools/CMakeFiles/gmxana.dir/gmx_disre.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/gmx_disre.c.o.d"
+  "/root/repo/src/tools/gmx_dist.c" "src/tools/CMakeFiles/gmxana.dir/gmx_dist.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/gmx_dist.c.o.d"
+  "/root/repo/src/tools/gmx_do_dssp.c" "src/tools/CMakeFiles/gmxana.dir/gmx_do_dssp.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/gmx_do_dssp.c.o.d"
+  "/root/repo/src/tools/gmx_dos.c" "src/tools/CMakeFiles/gmxana.dir/gmx_dos.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/gmx_dos.c.o.d"
+  "/root/repo/src/tools/gmx_dyecoupl.c" "src/tools/CMakeFiles/gmxana.dir/gmx_dyecoupl.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/gmx_dyecoupl.c.o.d"
+  "/root/repo/src/tools/gmx_dyndom.c" "src/tools/CMakeFiles/gmxana.dir/gmx_dyndom.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/gmx_dyndom.c.o.d"
+  "/root/repo/src/tools/gmx_editconf.c" "src/tools/CMakeFiles/gmxana.dir/gmx_editconf.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/gmx_editconf.c.o.d"
+  "/root/repo/src/tools/gmx_eneconv.c" "src/tools/CMakeFiles/gmxana.dir/gmx_eneconv.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/gmx_eneconv.c.o.d"
+  "/root/repo/src/tools/gmx_enemat.c" "src/tools/CMakeFiles/gmxana.dir/gmx_enemat.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/gmx_enemat.c.o.d"
+  "/root/repo/src/tools/gmx_energy.c" "src/tools/CMakeFiles/gmxana.dir/gmx_energy.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/gmx_energy.c.o.d"
+  "/root/repo/src/tools/gmx_filter.c" "src/tools/CMakeFiles/gmxana.dir/gmx_filter.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/gmx_filter.c.o.d"
+  "/root/repo/src/tools/gmx_genbox.c" "src/tools/CMakeFiles/gmxana.dir/gmx_genbox.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/gmx_genbox.c.o.d"
+  "/root/repo/src/tools/gmx_genconf.c" "src/tools/CMakeFiles/gmxana.dir/gmx_genconf.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/gmx_genconf.c.o.d"
+  "/root/repo/src/tools/gmx_genion.c" "src/tools/CMakeFiles/gmxana.dir/gmx_genion.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/gmx_genion.c.o.d"
+  "/root/repo/src/tools/gmx_genpr.c" "src/tools/CMakeFiles/gmxana.dir/gmx_genpr.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/gmx_genpr.c.o.d"
+  "/root/repo/src/tools/gmx_gyrate.c" "src/tools/CMakeFiles/gmxana.dir/gmx_gyrate.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/gmx_gyrate.c.o.d"
+  "/root/repo/src/tools/gmx_h2order.c" "src/tools/CMakeFiles/gmxana.dir/gmx_h2order.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/gmx_h2order.c.o.d"
+  "/root/repo/src/tools/gmx_hbond.c" "src/tools/CMakeFiles/gmxana.dir/gmx_hbond.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/gmx_hbond.c.o.d"
+  "/root/repo/src/tools/gmx_helix.c" "src/tools/CMakeFiles/gmxana.dir/gmx_helix.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/gmx_helix.c.o.d"
+  "/root/repo/src/tools/gmx_helixorient.c" "src/tools/CMakeFiles/gmxana.dir/gmx_helixorient.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/gmx_helixorient.c.o.d"
+  "/root/repo/src/tools/gmx_hydorder.c" "src/tools/CMakeFiles/gmxana.dir/gmx_hydorder.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/gmx_hydorder.c.o.d"
+  "/root/repo/src/tools/gmx_kinetics.c" "src/tools/CMakeFiles/gmxana.dir/gmx_kinetics.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/gmx_kinetics.c.o.d"
+  "/root/repo/src/tools/gmx_lie.c" "src/tools/CMakeFiles/gmxana.dir/gmx_lie.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/gmx_lie.c.o.d"
+  "/root/repo/src/tools/gmx_make_edi.c" "src/tools/CMakeFiles/gmxana.dir/gmx_make_edi.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/gmx_make_edi.c.o.d"
+  "/root/repo/src/tools/gmx_make_ndx.c" "src/tools/CMakeFiles/gmxana.dir/gmx_make_ndx.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/gmx_make_ndx.c.o.d"
+  "/root/repo/src/tools/gmx_mdmat.c" "src/tools/CMakeFiles/gmxana.dir/gmx_mdmat.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/gmx_mdmat.c.o.d"
+  "/root/repo/src/tools/gmx_mindist.c" "src/tools/CMakeFiles/gmxana.dir/gmx_mindist.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/gmx_mindist.c.o.d"
+  "/root/repo/src/tools/gmx_mk_angndx.c" "src/tools/CMakeFiles/gmxana.dir/gmx_mk_angndx.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/gmx_mk_angndx.c.o.d"
+  "/root/repo/src/tools/gmx_morph.c" "src/tools/CMakeFiles/gmxana.dir/gmx_morph.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/gmx_morph.c.o.d"
+  "/root/repo/src/tools/gmx_msd.c" "src/tools/CMakeFiles/gmxana.dir/gmx_msd.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/gmx_msd.c.o.d"
+  "/root/repo/src/tools/gmx_nmeig.c" "src/tools/CMakeFiles/gmxana.dir/gmx_nmeig.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/gmx_nmeig.c.o.d"
+  "/root/repo/src/tools/gmx_nmens.c" "src/tools/CMakeFiles/gmxana.dir/gmx_nmens.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/gmx_nmens.c.o.d"
+  "/root/repo/src/tools/gmx_nmtraj.c" "src/tools/CMakeFiles/gmxana.dir/gmx_nmtraj.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/gmx_nmtraj.c.o.d"
+  "/root/repo/src/tools/gmx_options.c" "src/tools/CMakeFiles/gmxana.dir/gmx_options.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/gmx_options.c.o.d"
+  "/root/repo/src/tools/gmx_order.c" "src/tools/CMakeFiles/gmxana.dir/gmx_order.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/gmx_order.c.o.d"
+  "/root/repo/src/tools/gmx_pme_error.c" "src/tools/CMakeFiles/gmxana.dir/gmx_pme_error.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/gmx_pme_error.c.o.d"
+  "/root/repo/src/tools/gmx_polystat.c" "src/tools/CMakeFiles/gmxana.dir/gmx_polystat.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/gmx_polystat.c.o.d"
+  "/root/repo/src/tools/gmx_potential.c" "src/tools/CMakeFiles/gmxana.dir/gmx_potential.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/gmx_potential.c.o.d"
+  "/root/repo/src/tools/gmx_principal.c" "src/tools/CMakeFiles/gmxana.dir/gmx_principal.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/gmx_principal.c.o.d"
+  "/root/repo/src/tools/gmx_rama.c" "src/tools/CMakeFiles/gmxana.dir/gmx_rama.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/gmx_rama.c.o.d"
+  "/root/repo/src/tools/gmx_rdf.c" "src/tools/CMakeFiles/gmxana.dir/gmx_rdf.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/gmx_rdf.c.o.d"
+  "/root/repo/src/tools/gmx_rms.c" "src/tools/CMakeFiles/gmxana.dir/gmx_rms.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/gmx_rms.c.o.d"
+  "/root/repo/src/tools/gmx_rmsdist.c" "src/tools/CMakeFiles/gmxana.dir/gmx_rmsdist.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/gmx_rmsdist.c.o.d"
+  "/root/repo/src/tools/gmx_rmsf.c" "src/tools/CMakeFiles/gmxana.dir/gmx_rmsf.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/gmx_rmsf.c.o.d"
+  "/root/repo/src/tools/gmx_rotacf.c" "src/tools/CMakeFiles/gmxana.dir/gmx_rotacf.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/gmx_rotacf.c.o.d"
+  "/root/repo/src/tools/gmx_rotmat.c" "src/tools/CMakeFiles/gmxana.dir/gmx_rotmat.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/gmx_rotmat.c.o.d"
+  "/root/repo/src/tools/gmx_saltbr.c" "src/tools/CMakeFiles/gmxana.dir/gmx_saltbr.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/gmx_saltbr.c.o.d"
+  "/root/repo/src/tools/gmx_sans.c" "src/tools/CMakeFiles/gmxana.dir/gmx_sans.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/gmx_sans.c.o.d"
+  "/root/repo/src/tools/gmx_sas.c" "src/tools/CMakeFiles/gmxana.dir/gmx_sas.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/gmx_sas.c.o.d"
+  "/root/repo/src/tools/gmx_saxs.c" "src/tools/CMakeFiles/gmxana.dir/gmx_saxs.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/gmx_saxs.c.o.d"
+  "/root/repo/src/tools/gmx_sgangle.c" "src/tools/CMakeFiles/gmxana.dir/gmx_sgangle.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/gmx_sgangle.c.o.d"
+  "/root/repo/src/tools/gmx_sham.c" "src/tools/CMakeFiles/gmxana.dir/gmx_sham.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/gmx_sham.c.o.d"
+  "/root/repo/src/tools/gmx_sigeps.c" "src/tools/CMakeFiles/gmxana.dir/gmx_sigeps.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/gmx_sigeps.c.o.d"
+  "/root/repo/src/tools/gmx_sorient.c" "src/tools/CMakeFiles/gmxana.dir/gmx_sorient.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/gmx_sorient.c.o.d"
+  "/root/repo/src/tools/gmx_spatial.c" "src/tools/CMakeFiles/gmxana.dir/gmx_spatial.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/gmx_spatial.c.o.d"
+  "/root/repo/src/tools/gmx_spol.c" "src/tools/CMakeFiles/gmxana.dir/gmx_spol.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/gmx_spol.c.o.d"
+  "/root/repo/src/tools/gmx_tcaf.c" "src/tools/CMakeFiles/gmxana.dir/gmx_tcaf.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/gmx_tcaf.c.o.d"
+  "/root/repo/src/tools/gmx_traj.c" "src/tools/CMakeFiles/gmxana.dir/gmx_traj.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/gmx_traj.c.o.d"
+  "/root/repo/src/tools/gmx_trjcat.c" "src/tools/CMakeFiles/gmxana.dir/gmx_trjcat.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/gmx_trjcat.c.o.d"
+  "/root/repo/src/tools/gmx_trjconv.c" "src/tools/CMakeFiles/gmxana.dir/gmx_trjconv.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/gmx_trjconv.c.o.d"
+  "/root/repo/src/tools/gmx_trjorder.c" "src/tools/CMakeFiles/gmxana.dir/gmx_trjorder.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/gmx_trjorder.c.o.d"
+  "/root/repo/src/tools/gmx_tune_pme.c" "src/tools/CMakeFiles/gmxana.dir/gmx_tune_pme.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/gmx_tune_pme.c.o.d"
+  "/root/repo/src/tools/gmx_vanhove.c" "src/tools/CMakeFiles/gmxana.dir/gmx_vanhove.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/gmx_vanhove.c.o.d"
+  "/root/repo/src/tools/gmx_velacc.c" "src/tools/CMakeFiles/gmxana.dir/gmx_velacc.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/gmx_velacc.c.o.d"
+  "/root/repo/src/tools/gmx_wheel.c" "src/tools/CMakeFiles/gmxana.dir/gmx_wheel.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/gmx_wheel.c.o.d"
+  "/root/repo/src/tools/gmx_xpm2ps.c" "src/tools/CMakeFiles/gmxana.dir/gmx_xpm2ps.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/gmx_xpm2ps.c.o.d"
+  "/root/repo/src/tools/hxprops.c" "src/tools/CMakeFiles/gmxana.dir/hxprops.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/hxprops.c.o.d"
+  "/root/repo/src/tools/levenmar.c" "src/tools/CMakeFiles/gmxana.dir/levenmar.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/levenmar.c.o.d"
+  "/root/repo/src/tools/nsc.c" "src/tools/CMakeFiles/gmxana.dir/nsc.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/nsc.c.o.d"
+  "/root/repo/src/tools/nsfactor.c" "src/tools/CMakeFiles/gmxana.dir/nsfactor.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/nsfactor.c.o.d"
+  "/root/repo/src/tools/polynomials.c" "src/tools/CMakeFiles/gmxana.dir/polynomials.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/polynomials.c.o.d"
+  "/root/repo/src/tools/powerspect.c" "src/tools/CMakeFiles/gmxana.dir/powerspect.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/powerspect.c.o.d"
+  "/root/repo/src/tools/pp2shift.c" "src/tools/CMakeFiles/gmxana.dir/pp2shift.c.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/pp2shift.c.o.d"
+  "/root/repo/src/tools/gmx_wham.cpp" "src/tools/CMakeFiles/gmxana.dir/gmx_wham.cpp.o" "gcc" "src/tools/CMakeFiles/gmxana.dir/gmx_wham.cpp.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_qc_build/lib/libgmxana.so" "/root/repo/_qc_build/lib/libgmxana.so.6"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_qc_build/src/gromacs/CMakeFiles/libgromacs.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
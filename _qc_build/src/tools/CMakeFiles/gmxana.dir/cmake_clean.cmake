@@ -0,0 +1,224 @@
+file(REMOVE_RECURSE
+  "../../lib/libgmxana.pdb"
+  "../../lib/libgmxana.so"
+  "../../lib/libgmxana.so.6"
+  "CMakeFiles/gmxana.dir/addconf.c.o"
+  "CMakeFiles/gmxana.dir/addconf.c.o.d"
+  "CMakeFiles/gmxana.dir/anadih.c.o"
+  "CMakeFiles/gmxana.dir/anadih.c.o.d"
+  "CMakeFiles/gmxana.dir/autocorr.c.o"
+  "CMakeFiles/gmxana.dir/autocorr.c.o.d"
+  "CMakeFiles/gmxana.dir/binsearch.c.o"
+  "CMakeFiles/gmxana.dir/binsearch.c.o.d"
+  "CMakeFiles/gmxana.dir/calcpot.c.o"
+  "CMakeFiles/gmxana.dir/calcpot.c.o.d"
+  "CMakeFiles/gmxana.dir/cmat.c.o"
+  "CMakeFiles/gmxana.dir/cmat.c.o.d"
+  "CMakeFiles/gmxana.dir/correl.c.o"
+  "CMakeFiles/gmxana.dir/correl.c.o.d"
+  "CMakeFiles/gmxana.dir/dens_filter.c.o"
+  "CMakeFiles/gmxana.dir/dens_filter.c.o.d"
+  "CMakeFiles/gmxana.dir/dlist.c.o"
+  "CMakeFiles/gmxana.dir/dlist.c.o.d"
+  "CMakeFiles/gmxana.dir/edittop.c.o"
+  "CMakeFiles/gmxana.dir/edittop.c.o.d"
+  "CMakeFiles/gmxana.dir/eigio.c.o"
+  "CMakeFiles/gmxana.dir/eigio.c.o.d"
+  "CMakeFiles/gmxana.dir/expfit.c.o"
+  "CMakeFiles/gmxana.dir/expfit.c.o.d"
+  "CMakeFiles/gmxana.dir/fitahx.c.o"
+  "CMakeFiles/gmxana.dir/fitahx.c.o.d"
+  "CMakeFiles/gmxana.dir/geminate.c.o"
+  "CMakeFiles/gmxana.dir/geminate.c.o.d"
+  "CMakeFiles/gmxana.dir/gmx_anadock.c.o"
+  "CMakeFiles/gmxana.dir/gmx_anadock.c.o.d"
+  "CMakeFiles/gmxana.dir/gmx_anaeig.c.o"
+  "CMakeFiles/gmxana.dir/gmx_anaeig.c.o.d"
+  "CMakeFiles/gmxana.dir/gmx_analyze.c.o"
+  "CMakeFiles/gmxana.dir/gmx_analyze.c.o.d"
+  "CMakeFiles/gmxana.dir/gmx_angle.c.o"
+  "CMakeFiles/gmxana.dir/gmx_angle.c.o.d"
+  "CMakeFiles/gmxana.dir/gmx_bar.c.o"
+  "CMakeFiles/gmxana.dir/gmx_bar.c.o.d"
+  "CMakeFiles/gmxana.dir/gmx_bond.c.o"
+  "CMakeFiles/gmxana.dir/gmx_bond.c.o.d"
+  "CMakeFiles/gmxana.dir/gmx_bundle.c.o"
+  "CMakeFiles/gmxana.dir/gmx_bundle.c.o.d"
+  "CMakeFiles/gmxana.dir/gmx_chi.c.o"
+  "CMakeFiles/gmxana.dir/gmx_chi.c.o.d"
+  "CMakeFiles/gmxana.dir/gmx_cluster.c.o"
+  "CMakeFiles/gmxana.dir/gmx_cluster.c.o.d"
+  "CMakeFiles/gmxana.dir/gmx_clustsize.c.o"
+  "CMakeFiles/gmxana.dir/gmx_clustsize.c.o.d"
+  "CMakeFiles/gmxana.dir/gmx_confrms.c.o"
+  "CMakeFiles/gmxana.dir/gmx_confrms.c.o.d"
+  "CMakeFiles/gmxana.dir/gmx_covar.c.o"
+  "CMakeFiles/gmxana.dir/gmx_covar.c.o.d"
+  "CMakeFiles/gmxana.dir/gmx_current.c.o"
+  "CMakeFiles/gmxana.dir/gmx_current.c.o.d"
+  "CMakeFiles/gmxana.dir/gmx_density.c.o"
+  "CMakeFiles/gmxana.dir/gmx_density.c.o.d"
+  "CMakeFiles/gmxana.dir/gmx_densmap.c.o"
+  "CMakeFiles/gmxana.dir/gmx_densmap.c.o.d"
+  "CMakeFiles/gmxana.dir/gmx_densorder.c.o"
+  "CMakeFiles/gmxana.dir/gmx_densorder.c.o.d"
+  "CMakeFiles/gmxana.dir/gmx_dielectric.c.o"
+  "CMakeFiles/gmxana.dir/gmx_dielectric.c.o.d"
+  "CMakeFiles/gmxana.dir/gmx_dih.c.o"
+  "CMakeFiles/gmxana.dir/gmx_dih.c.o.d"
+  "CMakeFiles/gmxana.dir/gmx_dipoles.c.o"
+  "CMakeFiles/gmxana.dir/gmx_dipoles.c.o.d"
+  "CMakeFiles/gmxana.dir/gmx_disre.c.o"
+  "CMakeFiles/gmxana.dir/gmx_disre.c.o.d"
+  "CMakeFiles/gmxana.dir/gmx_dist.c.o"
+  "CMakeFiles/gmxana.dir/gmx_dist.c.o.d"
+  "CMakeFiles/gmxana.dir/gmx_do_dssp.c.o"
+  "CMakeFiles/gmxana.dir/gmx_do_dssp.c.o.d"
+  "CMakeFiles/gmxana.dir/gmx_dos.c.o"
+  "CMakeFiles/gmxana.dir/gmx_dos.c.o.d"
+  "CMakeFiles/gmxana.dir/gmx_dyecoupl.c.o"
+  "CMakeFiles/gmxana.dir/gmx_dyecoupl.c.o.d"
+  "CMakeFiles/gmxana.dir/gmx_dyndom.c.o"
+  "CMakeFiles/gmxana.dir/gmx_dyndom.c.o.d"
+  "CMakeFiles/gmxana.dir/gmx_editconf.c.o"
+  "CMakeFiles/gmxana.dir/gmx_editconf.c.o.d"
+  "CMakeFiles/gmxana.dir/gmx_eneconv.c.o"
+  "CMakeFiles/gmxana.dir/gmx_eneconv.c.o.d"
+  "CMakeFiles/gmxana.dir/gmx_enemat.c.o"
+  "CMakeFiles/gmxana.dir/gmx_enemat.c.o.d"
+  "CMakeFiles/gmxana.dir/gmx_energy.c.o"
+  "CMakeFiles/gmxana.dir/gmx_energy.c.o.d"
+  "CMakeFiles/gmxana.dir/gmx_filter.c.o"
+  "CMakeFiles/gmxana.dir/gmx_filter.c.o.d"
+  "CMakeFiles/gmxana.dir/gmx_genbox.c.o"
+  "CMakeFiles/gmxana.dir/gmx_genbox.c.o.d"
+  "CMakeFiles/gmxana.dir/gmx_genconf.c.o"
+  "CMakeFiles/gmxana.dir/gmx_genconf.c.o.d"
+  "CMakeFiles/gmxana.dir/gmx_genion.c.o"
+  "CMakeFiles/gmxana.dir/gmx_genion.c.o.d"
+  "CMakeFiles/gmxana.dir/gmx_genpr.c.o"
+  "CMakeFiles/gmxana.dir/gmx_genpr.c.o.d"
+  "CMakeFiles/gmxana.dir/gmx_gyrate.c.o"
+  "CMakeFiles/gmxana.dir/gmx_gyrate.c.o.d"
+  "CMakeFiles/gmxana.dir/gmx_h2order.c.o"
+  "CMakeFiles/gmxana.dir/gmx_h2order.c.o.d"
+  "CMakeFiles/gmxana.dir/gmx_hbond.c.o"
+  "CMakeFiles/gmxana.dir/gmx_hbond.c.o.d"
+  "CMakeFiles/gmxana.dir/gmx_helix.c.o"
+  "CMakeFiles/gmxana.dir/gmx_helix.c.o.d"
+  "CMakeFiles/gmxana.dir/gmx_helixorient.c.o"
+  "CMakeFiles/gmxana.dir/gmx_helixorient.c.o.d"
+  "CMakeFiles/gmxana.dir/gmx_hydorder.c.o"
+  "CMakeFiles/gmxana.dir/gmx_hydorder.c.o.d"
+  "CMakeFiles/gmxana.dir/gmx_kinetics.c.o"
+  "CMakeFiles/gmxana.dir/gmx_kinetics.c.o.d"
+  "CMakeFiles/gmxana.dir/gmx_lie.c.o"
+  "CMakeFiles/gmxana.dir/gmx_lie.c.o.d"
+  "CMakeFiles/gmxana.dir/gmx_make_edi.c.o"
+  "CMakeFiles/gmxana.dir/gmx_make_edi.c.o.d"
+  "CMakeFiles/gmxana.dir/gmx_make_ndx.c.o"
+  "CMakeFiles/gmxana.dir/gmx_make_ndx.c.o.d"
+  "CMakeFiles/gmxana.dir/gmx_mdmat.c.o"
+  "CMakeFiles/gmxana.dir/gmx_mdmat.c.o.d"
+  "CMakeFiles/gmxana.dir/gmx_mindist.c.o"
+  "CMakeFiles/gmxana.dir/gmx_mindist.c.o.d"
+  "CMakeFiles/gmxana.dir/gmx_mk_angndx.c.o"
+  "CMakeFiles/gmxana.dir/gmx_mk_angndx.c.o.d"
+  "CMakeFiles/gmxana.dir/gmx_morph.c.o"
+  "CMakeFiles/gmxana.dir/gmx_morph.c.o.d"
+  "CMakeFiles/gmxana.dir/gmx_msd.c.o"
+  "CMakeFiles/gmxana.dir/gmx_msd.c.o.d"
+  "CMakeFiles/gmxana.dir/gmx_nmeig.c.o"
+  "CMakeFiles/gmxana.dir/gmx_nmeig.c.o.d"
+  "CMakeFiles/gmxana.dir/gmx_nmens.c.o"
+  "CMakeFiles/gmxana.dir/gmx_nmens.c.o.d"
+  "CMakeFiles/gmxana.dir/gmx_nmtraj.c.o"
+  "CMakeFiles/gmxana.dir/gmx_nmtraj.c.o.d"
+  "CMakeFiles/gmxana.dir/gmx_options.c.o"
+  "CMakeFiles/gmxana.dir/gmx_options.c.o.d"
+  "CMakeFiles/gmxana.dir/gmx_order.c.o"
+  "CMakeFiles/gmxana.dir/gmx_order.c.o.d"
+  "CMakeFiles/gmxana.dir/gmx_pme_error.c.o"
+  "CMakeFiles/gmxana.dir/gmx_pme_error.c.o.d"
+  "CMakeFiles/gmxana.dir/gmx_polystat.c.o"
+  "CMakeFiles/gmxana.dir/gmx_polystat.c.o.d"
+  "CMakeFiles/gmxana.dir/gmx_potential.c.o"
+  "CMakeFiles/gmxana.dir/gmx_potential.c.o.d"
+  "CMakeFiles/gmxana.dir/gmx_principal.c.o"
+  "CMakeFiles/gmxana.dir/gmx_principal.c.o.d"
+  "CMakeFiles/gmxana.dir/gmx_rama.c.o"
+  "CMakeFiles/gmxana.dir/gmx_rama.c.o.d"
+  "CMakeFiles/gmxana.dir/gmx_rdf.c.o"
+  "CMakeFiles/gmxana.dir/gmx_rdf.c.o.d"
+  "CMakeFiles/gmxana.dir/gmx_rms.c.o"
+  "CMakeFiles/gmxana.dir/gmx_rms.c.o.d"
+  "CMakeFiles/gmxana.dir/gmx_rmsdist.c.o"
+  "CMakeFiles/gmxana.dir/gmx_rmsdist.c.o.d"
+  "CMakeFiles/gmxana.dir/gmx_rmsf.c.o"
+  "CMakeFiles/gmxana.dir/gmx_rmsf.c.o.d"
+  "CMakeFiles/gmxana.dir/gmx_rotacf.c.o"
+  "CMakeFiles/gmxana.dir/gmx_rotacf.c.o.d"
+  "CMakeFiles/gmxana.dir/gmx_rotmat.c.o"
+  "CMakeFiles/gmxana.dir/gmx_rotmat.c.o.d"
+  "CMakeFiles/gmxana.dir/gmx_saltbr.c.o"
+  "CMakeFiles/gmxana.dir/gmx_saltbr.c.o.d"
+  "CMakeFiles/gmxana.dir/gmx_sans.c.o"
+  "CMakeFiles/gmxana.dir/gmx_sans.c.o.d"
+  "CMakeFiles/gmxana.dir/gmx_sas.c.o"
+  "CMakeFiles/gmxana.dir/gmx_sas.c.o.d"
+  "CMakeFiles/gmxana.dir/gmx_saxs.c.o"
+  "CMakeFiles/gmxana.dir/gmx_saxs.c.o.d"
+  "CMakeFiles/gmxana.dir/gmx_sgangle.c.o"
+  "CMakeFiles/gmxana.dir/gmx_sgangle.c.o.d"
+  "CMakeFiles/gmxana.dir/gmx_sham.c.o"
+  "CMakeFiles/gmxana.dir/gmx_sham.c.o.d"
+  "CMakeFiles/gmxana.dir/gmx_sigeps.c.o"
+  "CMakeFiles/gmxana.dir/gmx_sigeps.c.o.d"
+  "CMakeFiles/gmxana.dir/gmx_sorient.c.o"
+  "CMakeFiles/gmxana.dir/gmx_sorient.c.o.d"
+  "CMakeFiles/gmxana.dir/gmx_spatial.c.o"
+  "CMakeFiles/gmxana.dir/gmx_spatial.c.o.d"
+  "CMakeFiles/gmxana.dir/gmx_spol.c.o"
+  "CMakeFiles/gmxana.dir/gmx_spol.c.o.d"
+  "CMakeFiles/gmxana.dir/gmx_tcaf.c.o"
+  "CMakeFiles/gmxana.dir/gmx_tcaf.c.o.d"
+  "CMakeFiles/gmxana.dir/gmx_traj.c.o"
+  "CMakeFiles/gmxana.dir/gmx_traj.c.o.d"
+  "CMakeFiles/gmxana.dir/gmx_trjcat.c.o"
+  "CMakeFiles/gmxana.dir/gmx_trjcat.c.o.d"
+  "CMakeFiles/gmxana.dir/gmx_trjconv.c.o"
+  "CMakeFiles/gmxana.dir/gmx_trjconv.c.o.d"
+  "CMakeFiles/gmxana.dir/gmx_trjorder.c.o"
+  "CMakeFiles/gmxana.dir/gmx_trjorder.c.o.d"
+  "CMakeFiles/gmxana.dir/gmx_tune_pme.c.o"
+  "CMakeFiles/gmxana.dir/gmx_tune_pme.c.o.d"
+  "CMakeFiles/gmxana.dir/gmx_vanhove.c.o"
+  "CMakeFiles/gmxana.dir/gmx_vanhove.c.o.d"
+  "CMakeFiles/gmxana.dir/gmx_velacc.c.o"
+  "CMakeFiles/gmxana.dir/gmx_velacc.c.o.d"
+  "CMakeFiles/gmxana.dir/gmx_wham.cpp.o"
+  "CMakeFiles/gmxana.dir/gmx_wham.cpp.o.d"
+  "CMakeFiles/gmxana.dir/gmx_wheel.c.o"
+  "CMakeFiles/gmxana.dir/gmx_wheel.c.o.d"
+  "CMakeFiles/gmxana.dir/gmx_xpm2ps.c.o"
+  "CMakeFiles/gmxana.dir/gmx_xpm2ps.c.o.d"
+  "CMakeFiles/gmxana.dir/hxprops.c.o"
+  "CMakeFiles/gmxana.dir/hxprops.c.o.d"
+  "CMakeFiles/gmxana.dir/levenmar.c.o"
+  "CMakeFiles/gmxana.dir/levenmar.c.o.d"
+  "CMakeFiles/gmxana.dir/nsc.c.o"
+  "CMakeFiles/gmxana.dir/nsc.c.o.d"
+  "CMakeFiles/gmxana.dir/nsfactor.c.o"
+  "CMakeFiles/gmxana.dir/nsfactor.c.o.d"
+  "CMakeFiles/gmxana.dir/polynomials.c.o"
+  "CMakeFiles/gmxana.dir/polynomials.c.o.d"
+  "CMakeFiles/gmxana.dir/powerspect.c.o"
+  "CMakeFiles/gmxana.dir/powerspect.c.o.d"
+  "CMakeFiles/gmxana.dir/pp2shift.c.o"
+  "CMakeFiles/gmxana.dir/pp2shift.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/gmxana.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
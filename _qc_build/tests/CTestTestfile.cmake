@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests
+# Build directory: /root/repo/_qc_build/tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(TestExec_mdrun-h "/root/repo/_qc_build/bin/mdrun" "-h")
+set_tests_properties(TestExec_mdrun-h PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;1;add_test;/root/repo/tests/CMakeLists.txt;0;")
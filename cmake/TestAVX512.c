@@ -0,0 +1,11 @@
+#include <immintrin.h>
+
+int main()
+{
+    __m512    x  = _mm512_set1_ps(0.5);
+    __mmask16 m;
+    x = _mm512_rsqrt14_ps(x);
+    m = _mm512_cmp_ps_mask(x,_mm512_set1_ps(1.0),_CMP_LT_OQ);
+    x = _mm512_maskz_mov_ps(m,x);
+    return 0;
+}
@@ -64,6 +64,7 @@ gmx_cpuid_feature_string[GMX_CPUID_NFEATURES] =
     "apic",
     "avx",
     "avx2",
+    "avx512f",
     "clfsh",
     "cmov",
     "cx8",
@@ -104,7 +105,8 @@ gmx_cpuid_acceleration_string[GMX_CPUID_NACCELERATIONS] =
     "SSE2",
     "SSE4.1",
     "AVX_128_FMA",
-    "AVX_256"
+    "AVX_256",
+    "AVX_512"
 };
 
 /* Max length of brand string */
@@ -172,7 +174,11 @@ gmx_cpuid_feature           (gmx_cpuid_t                cpuid,
  * This is set from Cmake. Note that the SSE2 and SSE4_1 macros are set for
  * AVX too, so it is important that they appear last in the list.
  */
-#ifdef GMX_X86_AVX_256
+#ifdef GMX_X86_AVX_512
+static const
+enum gmx_cpuid_acceleration
+compiled_acc = GMX_CPUID_ACCELERATION_X86_AVX_512;
+#elif defined GMX_X86_AVX_256
 static const
 enum gmx_cpuid_acceleration
 compiled_acc = GMX_CPUID_ACCELERATION_X86_AVX_256;
@@ -433,6 +439,7 @@ cpuid_check_intel_x86(gmx_cpuid_t                cpuid)
     {
         execute_x86cpuid(0x7,0,&eax,&ebx,&ecx,&edx);
         cpuid->feature[GMX_CPUID_FEATURE_X86_AVX2]    = (ebx & (1 << 5))  != 0;
+        cpuid->feature[GMX_CPUID_FEATURE_X86_AVX512F] = (ebx & (1 << 16)) != 0;
     }
 
     /* Check whether Hyper-Threading is enabled, not only supported */
@@ -610,7 +617,11 @@ gmx_cpuid_acceleration_suggest  (gmx_cpuid_t                 cpuid)
 
     if(gmx_cpuid_vendor(cpuid)==GMX_CPUID_VENDOR_INTEL)
     {
-        if(gmx_cpuid_feature(cpuid,GMX_CPUID_FEATURE_X86_AVX))
+        if(gmx_cpuid_feature(cpuid,GMX_CPUID_FEATURE_X86_AVX512F))
+        {
+            tmpacc = GMX_CPUID_ACCELERATION_X86_AVX_512;
+        }
+        else if(gmx_cpuid_feature(cpuid,GMX_CPUID_FEATURE_X86_AVX))
         {
             tmpacc = GMX_CPUID_ACCELERATION_X86_AVX_256;
         }
@@ -103,8 +103,8 @@ static omp_module_nthreads_t modth = { 0, 0, {0, 0, 0, 0, 0, 0, 0, 0, 0}, FALSE}
  *  GMX_*_NUM_THERADS env var is set, case in which its value overrides
  *  the deafult.
  *
- *  The "group" scheme supports OpenMP only in PME and in thise case all but
- *  the PME nthread values default to 1.
+ *  The "group" scheme supports OpenMP only in PME and in the non-bonded
+ *  search and kernels, all other nthread values are set to 1.
  */
 static int pick_module_nthreads(FILE *fplog, int m,
                                 gmx_bool bSimMaster,
@@ -149,10 +149,11 @@ static int pick_module_nthreads(FILE *fplog, int m,
                       modth_env_var[m], nth);
         }
 
-        /* with the group scheme warn if any env var except PME is set */
+        /* with the group scheme warn if any env var except PME
+         * or non-bonded is set */
         if (!bFullOmpSupport)
         {
-            if (m != emntPME)
+            if (m != emntPME && m != emntNonbonded)
             {
                 gmx_warning("%s=%d is set, but OpenMP multithreading is not "
                             "supported in %s!",
@@ -181,6 +182,11 @@ static int pick_module_nthreads(FILE *fplog, int m,
         /* pick the global PME node nthreads if we are setting the number
          * of threads in separate PME nodes  */
         nth = (bSepPME && m == emntPME) ? modth.gnth_pme : modth.gnth;
+
+        if (!bFullOmpSupport && m != emntPME && m != emntNonbonded)
+        {
+            nth = 1;
+        }
     }
 
     return modth.nth[m] = nth;
@@ -264,12 +270,15 @@ void gmx_omp_nthreads_init(FILE *fplog, t_commrec *cr,
          *   the respective module and it has to be used in conjunction with
          *   OMP_NUM_THREADS.
          *
-         * With the group scheme OpenMP multithreading is only supported in PME,
-         * for all other modules nthreads is set to 1.
-         * The number of PME threads is equal to:
+         * With the group scheme OpenMP multithreading is only supported in
+         * PME and in the non-bonded search and kernels, for all other
+         * modules nthreads is set to 1.
+         * The number of PME and non-bonded threads is equal to:
          * - 1 if not compiled with OpenMP or
-         * - GMX_PME_NUM_THREADS if defined, otherwise
+         * - GMX_PME_NUM_THREADS / GMX_NONBONDED_NUM_THREADS if defined,
+         *   otherwise
          * - OMP_NUM_THREADS if defined, otherwise
+         * - omp_nthreads_req if set, otherwise
          * - 1
          */
         nth = 1;
@@ -306,10 +315,11 @@ void gmx_omp_nthreads_init(FILE *fplog, t_commrec *cr,
         }
 
         /* now we have the global values, set them:
-         * - 1 if not compiled with OpenMP and for the group scheme
-         * - nth for the verlet scheme when compiled with OpenMP
+         * - 1 if not compiled with OpenMP
+         * - nth when compiled with OpenMP, for the group scheme
+         *   nth is only larger than 1 when explicitly requested
          */
-        if (bFullOmpSupport && bOMP)
+        if (bOMP)
         {
             modth.gnth = nth;
         }
@@ -387,8 +397,8 @@ void gmx_omp_nthreads_init(FILE *fplog, t_commrec *cr,
         const char *mpi_str="per MPI process";
 #endif
 
-        /* for group scheme we print PME threads info only */
-        if (bFullOmpSupport)
+        /* for group scheme we only print when using multiple threads */
+        if (bFullOmpSupport || modth.gnth > 1)
         {
             fprintf(stderr, "Using %d OpenMP thread%s %s\n",
                     modth.gnth,modth.gnth > 1 ? "s" : "",
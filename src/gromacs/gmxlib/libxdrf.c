@@ -692,23 +692,29 @@ static void sendints(int buf[], const int num_of_ints, const int num_of_bits,
  |
  | receivebits - decode number from buf using specified number of bits
  | 
- | extract the number of bits from the array buf and construct an integer
- | from it. Return that value.
+ | extract the number of bits from the byte array cbuf and construct an
+ | integer from it. Return that value. buf holds the position in cbuf.
+ | cbuf holds nbytes bytes, when more are needed buf[0] is set beyond
+ | nbytes and 0 is returned.
  |
 */
 
-static int receivebits(int buf[], int num_of_bits) {
+static int receivebits(int buf[], const unsigned char *cbuf, int nbytes,
+                       int num_of_bits) {
 
     int cnt, num, lastbits; 
     unsigned int lastbyte;
-    unsigned char * cbuf;
     int mask = (1 << num_of_bits) -1;
 
-    cbuf = ((unsigned char *)buf) + 3 * sizeof(*buf);
     cnt = buf[0];
     lastbits = (unsigned int) buf[1];
     lastbyte = (unsigned int) buf[2];
     
+    if (cnt + (num_of_bits + 7 - lastbits)/8 > nbytes) {
+	buf[0] = nbytes + 1;
+	return 0;
+    }
+
     num = 0;
     while (num_of_bits >= 8) {
 	lastbyte = ( lastbyte << 8 ) | cbuf[cnt++];
@@ -741,7 +747,8 @@ static int receivebits(int buf[], int num_of_bits) {
  |
 */
 
-static void receiveints(int buf[], const int num_of_ints, int num_of_bits,
+static void receiveints(int buf[], const unsigned char *cbuf, int nbytes,
+	const int num_of_ints, int num_of_bits,
 	unsigned int sizes[], int nums[]) {
     int bytes[32];
     int i, j, num_of_bytes, p, num;
@@ -749,11 +756,11 @@ static void receiveints(int buf[], const int num_of_ints, int num_of_bits,
     bytes[0] = bytes[1] = bytes[2] = bytes[3] = 0;
     num_of_bytes = 0;
     while (num_of_bits > 8) {
-	bytes[num_of_bytes++] = receivebits(buf, 8);
+	bytes[num_of_bytes++] = receivebits(buf, cbuf, nbytes, 8);
 	num_of_bits -= 8;
     }
     if (num_of_bits > 0) {
-	bytes[num_of_bytes++] = receivebits(buf, num_of_bits);
+	bytes[num_of_bytes++] = receivebits(buf, cbuf, nbytes, num_of_bits);
     }
     for (i = num_of_ints-1; i > 0; i--) {
 	num = 0;
@@ -768,6 +775,191 @@ static void receiveints(int buf[], const int num_of_ints, int num_of_bits,
     nums[0] = bytes[0] | (bytes[1] << 8) | (bytes[2] << 16) | (bytes[3] << 24);
 }
     
+/*____________________________________________________________________________
+ |
+ | decompress_coords - decode the compressed coordinates of xdr3dfcoord
+ |
+ | decodes the size coordinate triplets in the nbytes bytes of cbuf into
+ | fp, using the precision, range and initial small index read from the
+ | header by xdr3dfcoord. ip should have space for 3*size ints.
+ | Returns 0 when the data runs beyond nbytes.
+ |
+ */
+
+static int decompress_coords(const unsigned char *cbuf, int nbytes,
+			     float *fp, int size,
+			      float precision, const int minint[],
+			      const int maxint[], int smallidx, int *ip)
+{
+    int buf[3];
+    int minidx, maxidx;
+    unsigned sizeint[3], sizesmall[3], bitsizeint[3];
+    int flag, k;
+    int smallnum, smaller, larger, i, is_smaller, run;
+    float *lfp;
+    int tmp, *thiscoord,  prevcoord[3], *lip;
+    unsigned int bitsize;
+    float inv_precision;
+
+    bitsizeint[0] = bitsizeint[1] = bitsizeint[2] = 0;
+    prevcoord[0]  = prevcoord[1]  = prevcoord[2]  = 0;
+
+    sizeint[0] = maxint[0] - minint[0]+1;
+    sizeint[1] = maxint[1] - minint[1]+1;
+    sizeint[2] = maxint[2] - minint[2]+1;
+	
+    /* check if one of the sizes is to big to be multiplied */
+    if ((sizeint[0] | sizeint[1] | sizeint[2] ) > 0xffffff) {
+	bitsizeint[0] = sizeofint(sizeint[0]);
+	bitsizeint[1] = sizeofint(sizeint[1]);
+	bitsizeint[2] = sizeofint(sizeint[2]);
+	bitsize = 0; /* flag the use of large sizes */
+    } else {
+	bitsize = sizeofints(3, sizeint);
+    }
+
+    maxidx = MIN(LASTIDX, smallidx + 8) ;
+    minidx = maxidx - 8; /* often this equal smallidx */
+    smaller = magicints[MAX(FIRSTIDX, smallidx-1)] / 2;
+    smallnum = magicints[smallidx] / 2;
+    sizesmall[0] = sizesmall[1] = sizesmall[2] = magicints[smallidx] ;
+    larger = magicints[maxidx];
+
+    buf[0] = buf[1] = buf[2] = 0;
+
+    lfp = fp;
+    inv_precision = 1.0 / precision;
+    run = 0;
+    i = 0;
+    lip = ip;
+    while ( i < size ) {
+        thiscoord = (int *)(lip) + i * 3;
+
+        if (bitsize == 0) {
+    	thiscoord[0] = receivebits(buf, cbuf, nbytes, bitsizeint[0]);
+    	thiscoord[1] = receivebits(buf, cbuf, nbytes, bitsizeint[1]);
+    	thiscoord[2] = receivebits(buf, cbuf, nbytes, bitsizeint[2]);
+        } else {
+    	receiveints(buf, cbuf, nbytes, 3, bitsize, sizeint, thiscoord);
+        }
+        
+        i++;
+        thiscoord[0] += minint[0];
+        thiscoord[1] += minint[1];
+        thiscoord[2] += minint[2];
+        
+        prevcoord[0] = thiscoord[0];
+        prevcoord[1] = thiscoord[1];
+        prevcoord[2] = thiscoord[2];
+        
+       
+        flag = receivebits(buf, cbuf, nbytes, 1);
+        is_smaller = 0;
+        if (flag == 1) {
+    	run = receivebits(buf, cbuf, nbytes, 5);
+    	is_smaller = run % 3;
+    	run -= is_smaller;
+    	is_smaller--;
+        }
+        /* a corrupt run or index would write beyond fp or magicints */
+        if (buf[0] > nbytes || i + run/3 > size ||
+            smallidx + is_smaller < FIRSTIDX ||
+            smallidx + is_smaller > LASTIDX) {
+    	return 0;
+        }
+        if (run > 0) {
+    	thiscoord += 3;
+    	for (k = 0; k < run; k+=3) {
+    	    receiveints(buf, cbuf, nbytes, 3, smallidx, sizesmall, thiscoord);
+    	    i++;
+    	    thiscoord[0] += prevcoord[0] - smallnum;
+    	    thiscoord[1] += prevcoord[1] - smallnum;
+    	    thiscoord[2] += prevcoord[2] - smallnum;
+    	    if (k == 0) {
+    		/* interchange first with second atom for better
+    		 * compression of water molecules
+    		 */
+    		tmp = thiscoord[0]; thiscoord[0] = prevcoord[0];
+    			prevcoord[0] = tmp;
+    		tmp = thiscoord[1]; thiscoord[1] = prevcoord[1];
+    			prevcoord[1] = tmp;
+    		tmp = thiscoord[2]; thiscoord[2] = prevcoord[2];
+    			prevcoord[2] = tmp;
+    		*lfp++ = prevcoord[0] * inv_precision;
+    		*lfp++ = prevcoord[1] * inv_precision;
+    		*lfp++ = prevcoord[2] * inv_precision;
+    	    } else {
+    		prevcoord[0] = thiscoord[0];
+    		prevcoord[1] = thiscoord[1];
+    		prevcoord[2] = thiscoord[2];
+    	    }
+    	    *lfp++ = thiscoord[0] * inv_precision;
+    	    *lfp++ = thiscoord[1] * inv_precision;
+    	    *lfp++ = thiscoord[2] * inv_precision;
+    	}
+        } else {
+    	*lfp++ = thiscoord[0] * inv_precision;
+    	*lfp++ = thiscoord[1] * inv_precision;
+    	*lfp++ = thiscoord[2] * inv_precision;		
+        }
+        smallidx += is_smaller;
+        if (is_smaller < 0) {
+    	smallnum = smaller;
+    	if (smallidx > FIRSTIDX) {
+    	    smaller = magicints[smallidx - 1] /2;
+    	} else {
+    	    smaller = 0;
+    	}
+        } else if (is_smaller > 0) {
+    	smaller = smallnum;
+    	smallnum = magicints[smallidx] / 2;
+        }
+        sizesmall[0] = sizesmall[1] = sizesmall[2] = magicints[smallidx] ;
+    }
+
+    return (buf[0] <= nbytes);
+}
+
+int xdr3dfcoord_decompress(const unsigned char *cbuf, int nbytes,
+			   float *fp, int size,
+			   float precision, const int minint[],
+			   const int maxint[], int smallidx)
+{
+    int ret;
+
+    unsigned prealloc_size=3*16;
+    int prealloc_ip[3*16];
+    int *ip;
+
+    if (smallidx < FIRSTIDX || smallidx > LASTIDX)
+    {
+        return 0;
+    }
+    if ((unsigned)(3*size) <= prealloc_size)
+    {
+        ip = prealloc_ip;
+    }
+    else
+    {
+        ip = (int *)malloc((size_t)(3 * size * sizeof(*ip)));
+        if (ip == NULL)
+        {
+            fprintf(stderr,"malloc failed\n");
+            exit(1);
+        }
+    }
+
+    ret = decompress_coords(cbuf, nbytes, fp, size, precision,
+                            minint, maxint, smallidx, ip);
+
+    if (ip != prealloc_ip)
+    {
+        free(ip);
+    }
+
+    return ret;
+}
+
 /*____________________________________________________________________________
  |
  | xdr3dfcoord - read or write compressed 3d coordinates to xdr file.
@@ -1120,6 +1312,7 @@ int xdr3dfcoord(XDR *xdrs, float *fp, int *size, float *precision)
         {
             ip=prealloc_ip;
             buf=prealloc_buf;
+            bufsize=3*20;
         }
         else
         {
@@ -1151,20 +1344,6 @@ int xdr3dfcoord(XDR *xdrs, float *fp, int *size, float *precision)
             return 0;
 	}
 			
-	sizeint[0] = maxint[0] - minint[0]+1;
-	sizeint[1] = maxint[1] - minint[1]+1;
-	sizeint[2] = maxint[2] - minint[2]+1;
-	
-	/* check if one of the sizes is to big to be multiplied */
-	if ((sizeint[0] | sizeint[1] | sizeint[2] ) > 0xffffff) {
-	    bitsizeint[0] = sizeofint(sizeint[0]);
-	    bitsizeint[1] = sizeofint(sizeint[1]);
-	    bitsizeint[2] = sizeofint(sizeint[2]);
-	    bitsize = 0; /* flag the use of large sizes */
-	} else {
-	    bitsize = sizeofints(3, sizeint);
-	}
-	
 	if (xdr_int(xdrs, &smallidx) == 0)	
         {
             if (we_should_free)
@@ -1175,13 +1354,6 @@ int xdr3dfcoord(XDR *xdrs, float *fp, int *size, float *precision)
             return 0;
         }
 
-	maxidx = MIN(LASTIDX, smallidx + 8) ;
-	minidx = maxidx - 8; /* often this equal smallidx */
-	smaller = magicints[MAX(FIRSTIDX, smallidx-1)] / 2;
-	smallnum = magicints[smallidx] / 2;
-	sizesmall[0] = sizesmall[1] = sizesmall[2] = magicints[smallidx] ;
-	larger = magicints[maxidx];
-
     	/* buf[0] holds the length in bytes */
 
 	if (xdr_int(xdrs, &(buf[0])) == 0)
@@ -1195,7 +1367,10 @@ int xdr3dfcoord(XDR *xdrs, float *fp, int *size, float *precision)
         }
 
 
-	if (xdr_opaque(xdrs, (char *)&(buf[3]), (unsigned int)buf[0]) == 0)
+	/* the compressed data should fit in buf after the 3 state ints */
+	if (buf[0] < 0 ||
+	    buf[0] > (int)((bufsize - 3)*sizeof(*buf)) ||
+	    xdr_opaque(xdrs, (char *)&(buf[3]), (unsigned int)buf[0]) == 0)
         {
             if (we_should_free)
             {
@@ -1205,100 +1380,15 @@ int xdr3dfcoord(XDR *xdrs, float *fp, int *size, float *precision)
             return 0;
         }
 
-
-
-	buf[0] = buf[1] = buf[2] = 0;
-	
-	lfp = fp;
-	inv_precision = 1.0 / * precision;
-	run = 0;
-	i = 0;
-	lip = ip;
-	while ( i < lsize ) {
-	    thiscoord = (int *)(lip) + i * 3;
-
-	    if (bitsize == 0) {
-		thiscoord[0] = receivebits(buf, bitsizeint[0]);
-		thiscoord[1] = receivebits(buf, bitsizeint[1]);
-		thiscoord[2] = receivebits(buf, bitsizeint[2]);
-	    } else {
-		receiveints(buf, 3, bitsize, sizeint, thiscoord);
-	    }
-	    
-	    i++;
-	    thiscoord[0] += minint[0];
-	    thiscoord[1] += minint[1];
-	    thiscoord[2] += minint[2];
-	    
-	    prevcoord[0] = thiscoord[0];
-	    prevcoord[1] = thiscoord[1];
-	    prevcoord[2] = thiscoord[2];
-	    
-	   
-	    flag = receivebits(buf, 1);
-	    is_smaller = 0;
-	    if (flag == 1) {
-		run = receivebits(buf, 5);
-		is_smaller = run % 3;
-		run -= is_smaller;
-		is_smaller--;
-	    }
-	    if (run > 0) {
-		thiscoord += 3;
-		for (k = 0; k < run; k+=3) {
-		    receiveints(buf, 3, smallidx, sizesmall, thiscoord);
-		    i++;
-		    thiscoord[0] += prevcoord[0] - smallnum;
-		    thiscoord[1] += prevcoord[1] - smallnum;
-		    thiscoord[2] += prevcoord[2] - smallnum;
-		    if (k == 0) {
-			/* interchange first with second atom for better
-			 * compression of water molecules
-			 */
-			tmp = thiscoord[0]; thiscoord[0] = prevcoord[0];
-				prevcoord[0] = tmp;
-			tmp = thiscoord[1]; thiscoord[1] = prevcoord[1];
-				prevcoord[1] = tmp;
-			tmp = thiscoord[2]; thiscoord[2] = prevcoord[2];
-				prevcoord[2] = tmp;
-			*lfp++ = prevcoord[0] * inv_precision;
-			*lfp++ = prevcoord[1] * inv_precision;
-			*lfp++ = prevcoord[2] * inv_precision;
-		    } else {
-			prevcoord[0] = thiscoord[0];
-			prevcoord[1] = thiscoord[1];
-			prevcoord[2] = thiscoord[2];
-		    }
-		    *lfp++ = thiscoord[0] * inv_precision;
-		    *lfp++ = thiscoord[1] * inv_precision;
-		    *lfp++ = thiscoord[2] * inv_precision;
-		}
-	    } else {
-		*lfp++ = thiscoord[0] * inv_precision;
-		*lfp++ = thiscoord[1] * inv_precision;
-		*lfp++ = thiscoord[2] * inv_precision;		
-	    }
-	    smallidx += is_smaller;
-	    if (is_smaller < 0) {
-		smallnum = smaller;
-		if (smallidx > FIRSTIDX) {
-		    smaller = magicints[smallidx - 1] /2;
-		} else {
-		    smaller = 0;
-		}
-	    } else if (is_smaller > 0) {
-		smaller = smallnum;
-		smallnum = magicints[smallidx] / 2;
-	    }
-	    sizesmall[0] = sizesmall[1] = sizesmall[2] = magicints[smallidx] ;
-	}
+	rc = decompress_coords((unsigned char *)&(buf[3]), buf[0], fp, lsize,
+			       *precision, minint, maxint, smallidx, ip);
     }
     if (we_should_free)
     {
         free(ip);
         free(buf);
     }
-    return 1;
+    return rc;
 }
 
 
@@ -1322,6 +1412,9 @@ int xdr3dfcoord(XDR *xdrs, float *fp, int *size, float *precision)
 #ifndef XTC_MAGIC
 #define XTC_MAGIC 1995
 #endif
+#ifndef XTC_CHUNK_MAGIC
+#define XTC_CHUNK_MAGIC 1996
+#endif
 
 static const int header_size = 16;
 
@@ -1346,7 +1439,7 @@ static int xtc_at_header_start(FILE *fp, XDR *xdrs,
     }    
   }
   /* quick return */
-  if(i_inp[0] != XTC_MAGIC){
+  if(i_inp[0] != XTC_MAGIC && i_inp[0] != XTC_CHUNK_MAGIC){
     if(gmx_fseek(fp,off+XDR_INT_SIZE,SEEK_SET)){
       return -1;
     }
@@ -652,6 +652,7 @@ static void bc_molblock(const t_commrec *cr,gmx_molblock_t *molb)
 static void bc_atomtypes(const t_commrec *cr, t_atomtypes *atomtypes)
 {
   int nr;
+  gmx_bool bAtomnumber;
 
   block_bc(cr,atomtypes->nr);
 
@@ -668,6 +669,14 @@ static void bc_atomtypes(const t_commrec *cr, t_atomtypes *atomtypes)
   nblock_bc(cr,nr,atomtypes->surftens);
   nblock_bc(cr,nr,atomtypes->gb_radius);
   nblock_bc(cr,nr,atomtypes->S_hct);
+
+  /* the atomic numbers are only needed, and only present, for QM/MM */
+  bAtomnumber = (atomtypes->atomnumber != NULL);
+  block_bc(cr,bAtomnumber);
+  if (bAtomnumber) {
+    snew_bc(cr,atomtypes->atomnumber,nr);
+    nblock_bc(cr,nr,atomtypes->atomnumber);
+  }
 }
 
 
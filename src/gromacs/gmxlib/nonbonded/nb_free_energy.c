@@ -106,14 +106,15 @@ gmx_nb_free_energy_kernel(t_nblist *                nlist,
     real *        Vv;
     real *        Vc;
     gmx_bool      bDoForces;
-    real          rcoulomb,rvdw,factor_coul,factor_vdw,sh_invrc6;
+    real          rcoulomb,rvdw,factor_coul,factor_vdw,sh_invrc6,sh_coul;
+    const interaction_const_t *ic;
     gmx_bool      bExactElecCutoff,bExactVdwCutoff;
     real          rcutoff,rcutoff2,rswitch,d,d2,swV3,swV4,swV5,swF2,swF3,swF4,sw,dsw,rinvcorr;
 
     x                   = xx[0];
     f                   = ff[0];
 
-    fshift              = fr->fshift[0];
+    fshift              = kernel_data->fshift[0];
     Vc                  = kernel_data->energygrp_elec;
     Vv                  = kernel_data->energygrp_vdw;
     tabscale            = kernel_data->table_elec_vdw->scale;
@@ -157,6 +158,17 @@ gmx_nb_free_energy_kernel(t_nblist *                nlist,
     rcoulomb            = fr->rcoulomb;
     rvdw                = fr->rvdw;
     sh_invrc6           = fr->ic->sh_invrc6;
+    ic                  = fr->ic;
+
+    /* Potential shift of plain and Ewald Coulomb, as in the Verlet kernels */
+    if (fr->coulomb_modifier==eintmodPOTSHIFT)
+    {
+        sh_coul         = (icoul==GMX_NBKERNEL_ELEC_EWALD) ? fr->ic->sh_ewald : fr->ic->c_rf;
+    }
+    else
+    {
+        sh_coul         = 0.0;
+    }
 
     if(fr->coulomb_modifier==eintmodPOTSWITCH || fr->vdw_modifier==eintmodPOTSWITCH)
     {
@@ -382,6 +394,7 @@ gmx_nb_free_energy_kernel(t_nblist *                nlist,
                                 /* simple cutoff (yes, ewald is done all on direct space for free energy) */
                                 Vcoul[i]   = qq[i]*rinvC;
                                 FscalC[i]  = Vcoul[i]*rpinvC;
+                                Vcoul[i]  -= qq[i]*sh_coul;
                                 break;
                                 
                             case GMX_NBKERNEL_ELEC_REACTIONFIELD:
@@ -418,8 +431,8 @@ gmx_nb_free_energy_kernel(t_nblist *                nlist,
                             sw               = 1.0+d2*d*(swV3+d*(swV4+d*swV5));
                             dsw              = d2*(swF2+d*(swF3+d*swF4));
 
+                            FscalC[i]        = FscalC[i]*sw - Vcoul[i]*dsw*rC*rpinvC;
                             Vcoul[i]        *= sw;
-                            FscalC[i]        = FscalC[i]*sw + Vcoul[i]*dsw;
                         }
 
                         if(bExactElecCutoff)
@@ -449,12 +462,26 @@ gmx_nb_free_energy_kernel(t_nblist *                nlist,
                                 {
                                     Vvdw[i]          = ( (Vvdw12-c12[i]*sh_invrc6*sh_invrc6)*(1.0/12.0)
                                                         -(Vvdw6-c6[i]*sh_invrc6)*(1.0/6.0));
+                                    FscalV[i]        = (Vvdw12-Vvdw6)*rpinvV;
+                                }
+                                else if(fr->vdw_modifier==eintmodFORCESWITCH)
+                                {
+                                    /* c6 and c12 contain the factors 6 and 12 */
+                                    d                = rV-fr->rvdw_switch;
+                                    d                = (d>0.0) ? d : 0.0;
+                                    d2               = d*d;
+                                    Vvdw[i]          = ( (Vvdw12+c12[i]*ic->repulsion_shift_cpot)*(1.0/12.0)
+                                                        -c12[i]*d2*d*(ic->repulsion_shift_c2*(1.0/3.0)+d*ic->repulsion_shift_c3*0.25)
+                                                        -(Vvdw6+c6[i]*ic->dispersion_shift_cpot)*(1.0/6.0)
+                                                        +c6[i]*d2*d*(ic->dispersion_shift_c2*(1.0/3.0)+d*ic->dispersion_shift_c3*0.25));
+                                    FscalV[i]        = ( Vvdw12+c12[i]*d2*(ic->repulsion_shift_c2+d*ic->repulsion_shift_c3)*rV
+                                                        -Vvdw6-c6[i]*d2*(ic->dispersion_shift_c2+d*ic->dispersion_shift_c3)*rV)*rpinvV;
                                 }
                                 else
                                 {
                                     Vvdw[i]          = Vvdw12*(1.0/12.0)-Vvdw6*(1.0/6.0);
+                                    FscalV[i]        = (Vvdw12-Vvdw6)*rpinvV;
                                 }
-                                FscalV[i]        = (Vvdw12-Vvdw6)*rpinvV;
                                 break;
 
                             case GMX_NBKERNEL_VDW_BUCKINGHAM:
@@ -501,9 +528,12 @@ gmx_nb_free_energy_kernel(t_nblist *                nlist,
                             sw               = 1.0+d2*d*(swV3+d*(swV4+d*swV5));
                             dsw              = d2*(swF2+d*(swF3+d*swF4));
 
+                            FscalV[i]        = FscalV[i]*sw - Vvdw[i]*dsw*rV*rpinvV;
                             Vvdw[i]         *= sw;
-                            FscalV[i]        = FscalV[i]*sw + Vvdw[i]*dsw;
+                        }
 
+                        if(bExactVdwCutoff)
+                        {
                             FscalV[i]        = (rV<rvdw) ? FscalV[i] : 0.0;
                             Vvdw[i]          = (rV<rvdw) ? Vvdw[i] : 0.0;
                         }
@@ -513,7 +543,7 @@ gmx_nb_free_energy_kernel(t_nblist *                nlist,
 
             Fscal = 0;
 
-            if (icoul==GMX_NBKERNEL_ELEC_EWALD)
+            if (icoul==GMX_NBKERNEL_ELEC_EWALD && (!bExactElecCutoff || r<rcoulomb))
             {
                 /* because we compute the softcore normally,
                  we have to remove the ewald short range portion. Done outside of
@@ -589,6 +619,160 @@ gmx_nb_free_energy_kernel(t_nblist *                nlist,
     inc_nrnb(nrnb,eNR_NBKERNEL_FREE_ENERGY,nlist->nri*12 + nlist->jindex[n]*150);
 }
 
+void
+gmx_nb_free_energy_excl_kernel(t_nblist *                nlist,
+                               rvec *                    xx,
+                               rvec *                    ff,
+                               t_forcerec *              fr,
+                               t_mdatoms *               mdatoms,
+                               nb_kernel_data_t *        kernel_data,
+                               t_nrnb *                  nrnb)
+{
+    int           n,k,ii,ii3,jnr,j3,is3,ggid,s;
+    real          shX,shY,shZ,ix,iy,iz,fix,fiy,fiz;
+    real          dx,dy,dz,rsq,rinv,r,rcut2;
+    real          iqA,iqB,qq[NSTATES],LFC[NSTATES],DLF[NSTATES];
+    real          VV,FF,Fscal,vctot,tx,ty,tz;
+    real          ewc,krf,crf,V_self;
+    double        dvdl_coul;
+    gmx_bool      bEwald,bDoForces;
+    real *        x;
+    real *        f;
+    real *        fshift;
+    real *        shiftvec;
+    real *        Vc;
+
+    x           = xx[0];
+    f           = ff[0];
+    fshift      = kernel_data->fshift[0];
+    Vc          = kernel_data->energygrp_elec;
+    shiftvec    = fr->shift_vec[0];
+    bDoForces   = kernel_data->flags & GMX_NONBONDED_DO_FORCE;
+
+    bEwald      = (nlist->ielec == GMX_NBKERNEL_ELEC_EWALD);
+    ewc         = fr->ic->ewaldcoeff;
+    krf         = fr->ic->k_rf;
+    crf         = fr->ic->c_rf;
+    rcut2       = fr->ic->rcoulomb*fr->ic->rcoulomb;
+    /* The self pair gets half the r=0 limit, as the cluster kernels do */
+    V_self      = 0.5*(bEwald ? ewc*M_2_SQRTPI : crf);
+
+    LFC[STATE_A] = 1.0 - kernel_data->lambda[efptCOUL];
+    LFC[STATE_B] = kernel_data->lambda[efptCOUL];
+    DLF[STATE_A] = -1;
+    DLF[STATE_B] = 1;
+
+    dvdl_coul   = 0;
+
+    for(n=0; n<nlist->nri; n++)
+    {
+        is3         = 3*nlist->shift[n];
+        shX         = shiftvec[is3];
+        shY         = shiftvec[is3+1];
+        shZ         = shiftvec[is3+2];
+        ii          = nlist->iinr[n];
+        ii3         = 3*ii;
+        ix          = shX + x[ii3+0];
+        iy          = shY + x[ii3+1];
+        iz          = shZ + x[ii3+2];
+        iqA         = fr->epsfac*mdatoms->chargeA[ii];
+        iqB         = fr->epsfac*mdatoms->chargeB[ii];
+        vctot       = 0;
+        fix         = 0;
+        fiy         = 0;
+        fiz         = 0;
+
+        for(k=nlist->jindex[n]; k<nlist->jindex[n+1]; k++)
+        {
+            jnr         = nlist->jjnr[k];
+            qq[STATE_A] = iqA*mdatoms->chargeA[jnr];
+            qq[STATE_B] = iqB*mdatoms->chargeB[jnr];
+
+            if (jnr == ii)
+            {
+                /* Self pair, only an energy */
+                for(s=0; s<NSTATES; s++)
+                {
+                    vctot     -= LFC[s]*qq[s]*V_self;
+                    dvdl_coul -= DLF[s]*qq[s]*V_self;
+                }
+                continue;
+            }
+
+            j3          = 3*jnr;
+            dx          = ix - x[j3];
+            dy          = iy - x[j3+1];
+            dz          = iz - x[j3+2];
+            rsq         = dx*dx + dy*dy + dz*dz;
+            if (rsq >= rcut2)
+            {
+                continue;
+            }
+
+            if (bEwald)
+            {
+                /* Remove the Ewald mesh interaction of the excluded pair */
+                if (rsq > 0)
+                {
+                    rinv    = gmx_invsqrt(rsq);
+                    r       = rsq*rinv;
+                    VV      = -gmx_erf(ewc*r)*rinv;
+                    FF      = rinv*rinv*(VV + ewc*M_2_SQRTPI*exp(-ewc*ewc*rsq));
+                }
+                else
+                {
+                    VV      = -ewc*M_2_SQRTPI;
+                    FF      = 0;
+                }
+            }
+            else
+            {
+                /* The reaction-field of the excluded pair */
+                VV          = krf*rsq - crf;
+                FF          = -2.0*krf;
+            }
+
+            Fscal       = 0;
+            for(s=0; s<NSTATES; s++)
+            {
+                vctot     += LFC[s]*qq[s]*VV;
+                Fscal     += LFC[s]*qq[s]*FF;
+                dvdl_coul += DLF[s]*qq[s]*VV;
+            }
+
+            if (bDoForces)
+            {
+                tx          = Fscal*dx;
+                ty          = Fscal*dy;
+                tz          = Fscal*dz;
+                fix         = fix + tx;
+                fiy         = fiy + ty;
+                fiz         = fiz + tz;
+                f[j3]       = f[j3]   - tx;
+                f[j3+1]     = f[j3+1] - ty;
+                f[j3+2]     = f[j3+2] - tz;
+            }
+        }
+
+        if (bDoForces)
+        {
+            f[ii3]          = f[ii3]        + fix;
+            f[ii3+1]        = f[ii3+1]      + fiy;
+            f[ii3+2]        = f[ii3+2]      + fiz;
+            fshift[is3]     = fshift[is3]   + fix;
+            fshift[is3+1]   = fshift[is3+1] + fiy;
+            fshift[is3+2]   = fshift[is3+2] + fiz;
+        }
+        ggid                = nlist->gid[n];
+        Vc[ggid]            = Vc[ggid] + vctot;
+    }
+
+    kernel_data->dvdl[efptCOUL] += dvdl_coul;
+
+    /* Estimate flops, 30 flops per excluded pair */
+    inc_nrnb(nrnb,eNR_NBKERNEL_FREE_ENERGY,nlist->nri*12 + nlist->jindex[nlist->nri]*30);
+}
+
 real
 nb_free_energy_evaluate_single(real r2,real sc_r_power,real alpha_coul,real alpha_vdw,
                                real tabscale,real *vftab,
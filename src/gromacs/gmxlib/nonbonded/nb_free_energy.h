@@ -47,6 +47,20 @@ gmx_nb_free_energy_kernel(t_nblist *                nlist,
                           nb_kernel_data_t *        kernel_data,
                           t_nrnb *                  nrnb);
 
+/* Computes the Ewald or reaction-field correction for the excluded
+ * pairs and the self pairs (j==i) in nlist, interpolating the charges
+ * between the A and B states, as the Verlet cluster kernels do for
+ * the excluded pairs of the unperturbed atoms.
+ */
+void
+gmx_nb_free_energy_excl_kernel(t_nblist *                nlist,
+                               rvec *                    x,
+                               rvec *                    f,
+                               t_forcerec *              fr,
+                               t_mdatoms *               mdatoms,
+                               nb_kernel_data_t *        kernel_data,
+                               t_nrnb *                  nrnb);
+
 real
 nb_free_energy_evaluate_single(real r2,real sc_r_power,real alpha_coul,
                                real alpha_vdw,real tabscale,real *vftab,
@@ -102,7 +102,7 @@ gmx_nb_generic_kernel(t_nblist *                nlist,
     ielec               = nlist->ielec;
     ivdw                = nlist->ivdw;
 
-    fshift              = fr->fshift[0];
+    fshift              = kernel_data->fshift[0];
     velecgrp            = kernel_data->energygrp_elec;
     vvdwgrp             = kernel_data->energygrp_vdw;
     tabscale            = kernel_data->table_elec_vdw->scale;
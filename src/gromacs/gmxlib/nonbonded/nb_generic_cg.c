@@ -94,7 +94,7 @@ gmx_nb_generic_cg_kernel(t_nblist *                nlist,
      ielec               = nlist->ielec;
      ivdw                = nlist->ivdw;
 
-     fshift              = fr->fshift[0];
+     fshift              = kernel_data->fshift[0];
      Vc                  = kernel_data->energygrp_elec;
      Vvdw                = kernel_data->energygrp_vdw;
      tabscale            = kernel_data->table_elec_vdw->scale;
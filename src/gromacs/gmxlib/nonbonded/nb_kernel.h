@@ -45,6 +45,8 @@ typedef struct
     t_blocka *         exclusions;
     real *             lambda;
     real *             dvdl;
+    rvec *             fshift;
+    real *             dvda;
 
     /* pointers to tables */
     t_forcetable *     table_elec;
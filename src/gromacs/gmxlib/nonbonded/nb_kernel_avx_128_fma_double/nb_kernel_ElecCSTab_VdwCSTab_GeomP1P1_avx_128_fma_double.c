@@ -94,7 +94,7 @@ nb_kernel_ElecCSTab_VdwCSTab_GeomP1P1_VF_avx_128_fma_double
     shiftidx         = nlist->shift;
     gid              = nlist->gid;
     shiftvec         = fr->shift_vec[0];
-    fshift           = fr->fshift[0];
+    fshift           = kernel_data->fshift[0];
     facel            = _mm_set1_pd(fr->epsfac);
     charge           = mdatoms->chargeA;
     nvdwtype         = fr->ntype;
@@ -449,7 +449,7 @@ nb_kernel_ElecCSTab_VdwCSTab_GeomP1P1_F_avx_128_fma_double
     shiftidx         = nlist->shift;
     gid              = nlist->gid;
     shiftvec         = fr->shift_vec[0];
-    fshift           = fr->fshift[0];
+    fshift           = kernel_data->fshift[0];
     facel            = _mm_set1_pd(fr->epsfac);
     charge           = mdatoms->chargeA;
     nvdwtype         = fr->ntype;
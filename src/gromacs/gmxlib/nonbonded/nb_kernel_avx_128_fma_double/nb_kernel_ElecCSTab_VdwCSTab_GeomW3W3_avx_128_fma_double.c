@@ -110,7 +110,7 @@ nb_kernel_ElecCSTab_VdwCSTab_GeomW3W3_VF_avx_128_fma_double
     shiftidx         = nlist->shift;
     gid              = nlist->gid;
     shiftvec         = fr->shift_vec[0];
-    fshift           = fr->fshift[0];
+    fshift           = kernel_data->fshift[0];
     facel            = _mm_set1_pd(fr->epsfac);
     charge           = mdatoms->chargeA;
     nvdwtype         = fr->ntype;
@@ -1319,7 +1319,7 @@ nb_kernel_ElecCSTab_VdwCSTab_GeomW3W3_F_avx_128_fma_double
     shiftidx         = nlist->shift;
     gid              = nlist->gid;
     shiftvec         = fr->shift_vec[0];
-    fshift           = fr->fshift[0];
+    fshift           = kernel_data->fshift[0];
     facel            = _mm_set1_pd(fr->epsfac);
     charge           = mdatoms->chargeA;
     nvdwtype         = fr->ntype;
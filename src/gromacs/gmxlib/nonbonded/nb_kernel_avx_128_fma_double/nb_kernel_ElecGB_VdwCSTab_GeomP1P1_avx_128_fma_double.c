@@ -98,7 +98,7 @@ nb_kernel_ElecGB_VdwCSTab_GeomP1P1_VF_avx_128_fma_double
     shiftidx         = nlist->shift;
     gid              = nlist->gid;
     shiftvec         = fr->shift_vec[0];
-    fshift           = fr->fshift[0];
+    fshift           = kernel_data->fshift[0];
     facel            = _mm_set1_pd(fr->epsfac);
     charge           = mdatoms->chargeA;
     nvdwtype         = fr->ntype;
@@ -109,7 +109,7 @@ nb_kernel_ElecGB_VdwCSTab_GeomP1P1_VF_avx_128_fma_double
     vftabscale       = _mm_set1_pd(kernel_data->table_vdw->scale);
 
     invsqrta         = fr->invsqrta;
-    dvda             = fr->dvda;
+    dvda             = kernel_data->dvda;
     gbtabscale       = _mm_set1_pd(fr->gbtab.scale);
     gbtab            = fr->gbtab.data;
     gbinvepsdiff     = _mm_set1_pd((1.0/fr->epsilon_r) - (1.0/fr->gb_epsilon_solvent));
@@ -518,7 +518,7 @@ nb_kernel_ElecGB_VdwCSTab_GeomP1P1_F_avx_128_fma_double
     shiftidx         = nlist->shift;
     gid              = nlist->gid;
     shiftvec         = fr->shift_vec[0];
-    fshift           = fr->fshift[0];
+    fshift           = kernel_data->fshift[0];
     facel            = _mm_set1_pd(fr->epsfac);
     charge           = mdatoms->chargeA;
     nvdwtype         = fr->ntype;
@@ -529,7 +529,7 @@ nb_kernel_ElecGB_VdwCSTab_GeomP1P1_F_avx_128_fma_double
     vftabscale       = _mm_set1_pd(kernel_data->table_vdw->scale);
 
     invsqrta         = fr->invsqrta;
-    dvda             = fr->dvda;
+    dvda             = kernel_data->dvda;
     gbtabscale       = _mm_set1_pd(fr->gbtab.scale);
     gbtab            = fr->gbtab.data;
     gbinvepsdiff     = _mm_set1_pd((1.0/fr->epsilon_r) - (1.0/fr->gb_epsilon_solvent));
@@ -98,7 +98,7 @@ nb_kernel_ElecGB_VdwLJ_GeomP1P1_VF_avx_128_fma_double
     shiftidx         = nlist->shift;
     gid              = nlist->gid;
     shiftvec         = fr->shift_vec[0];
-    fshift           = fr->fshift[0];
+    fshift           = kernel_data->fshift[0];
     facel            = _mm_set1_pd(fr->epsfac);
     charge           = mdatoms->chargeA;
     nvdwtype         = fr->ntype;
@@ -106,7 +106,7 @@ nb_kernel_ElecGB_VdwLJ_GeomP1P1_VF_avx_128_fma_double
     vdwtype          = mdatoms->typeA;
 
     invsqrta         = fr->invsqrta;
-    dvda             = fr->dvda;
+    dvda             = kernel_data->dvda;
     gbtabscale       = _mm_set1_pd(fr->gbtab.scale);
     gbtab            = fr->gbtab.data;
     gbinvepsdiff     = _mm_set1_pd((1.0/fr->epsilon_r) - (1.0/fr->gb_epsilon_solvent));
@@ -455,7 +455,7 @@ nb_kernel_ElecGB_VdwLJ_GeomP1P1_F_avx_128_fma_double
     shiftidx         = nlist->shift;
     gid              = nlist->gid;
     shiftvec         = fr->shift_vec[0];
-    fshift           = fr->fshift[0];
+    fshift           = kernel_data->fshift[0];
     facel            = _mm_set1_pd(fr->epsfac);
     charge           = mdatoms->chargeA;
     nvdwtype         = fr->ntype;
@@ -463,7 +463,7 @@ nb_kernel_ElecGB_VdwLJ_GeomP1P1_F_avx_128_fma_double
     vdwtype          = mdatoms->typeA;
 
     invsqrta         = fr->invsqrta;
-    dvda             = fr->dvda;
+    dvda             = kernel_data->dvda;
     gbtabscale       = _mm_set1_pd(fr->gbtab.scale);
     gbtab            = fr->gbtab.data;
     gbinvepsdiff     = _mm_set1_pd((1.0/fr->epsilon_r) - (1.0/fr->gb_epsilon_solvent));
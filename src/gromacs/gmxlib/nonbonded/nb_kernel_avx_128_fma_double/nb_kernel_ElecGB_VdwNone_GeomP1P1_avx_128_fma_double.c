@@ -92,12 +92,12 @@ nb_kernel_ElecGB_VdwNone_GeomP1P1_VF_avx_128_fma_double
     shiftidx         = nlist->shift;
     gid              = nlist->gid;
     shiftvec         = fr->shift_vec[0];
-    fshift           = fr->fshift[0];
+    fshift           = kernel_data->fshift[0];
     facel            = _mm_set1_pd(fr->epsfac);
     charge           = mdatoms->chargeA;
 
     invsqrta         = fr->invsqrta;
-    dvda             = fr->dvda;
+    dvda             = kernel_data->dvda;
     gbtabscale       = _mm_set1_pd(fr->gbtab.scale);
     gbtab            = fr->gbtab.data;
     gbinvepsdiff     = _mm_set1_pd((1.0/fr->epsilon_r) - (1.0/fr->gb_epsilon_solvent));
@@ -408,12 +408,12 @@ nb_kernel_ElecGB_VdwNone_GeomP1P1_F_avx_128_fma_double
     shiftidx         = nlist->shift;
     gid              = nlist->gid;
     shiftvec         = fr->shift_vec[0];
-    fshift           = fr->fshift[0];
+    fshift           = kernel_data->fshift[0];
     facel            = _mm_set1_pd(fr->epsfac);
     charge           = mdatoms->chargeA;
 
     invsqrta         = fr->invsqrta;
-    dvda             = fr->dvda;
+    dvda             = kernel_data->dvda;
     gbtabscale       = _mm_set1_pd(fr->gbtab.scale);
     gbtab            = fr->gbtab.data;
     gbinvepsdiff     = _mm_set1_pd((1.0/fr->epsilon_r) - (1.0/fr->gb_epsilon_solvent));
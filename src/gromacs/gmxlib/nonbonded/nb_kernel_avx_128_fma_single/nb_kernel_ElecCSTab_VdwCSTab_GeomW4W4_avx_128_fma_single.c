@@ -118,7 +118,7 @@ nb_kernel_ElecCSTab_VdwCSTab_GeomW4W4_VF_avx_128_fma_single
     shiftidx         = nlist->shift;
     gid              = nlist->gid;
     shiftvec         = fr->shift_vec[0];
-    fshift           = fr->fshift[0];
+    fshift           = kernel_data->fshift[0];
     facel            = _mm_set1_ps(fr->epsfac);
     charge           = mdatoms->chargeA;
     nvdwtype         = fr->ntype;
@@ -1449,7 +1449,7 @@ nb_kernel_ElecCSTab_VdwCSTab_GeomW4W4_F_avx_128_fma_single
     shiftidx         = nlist->shift;
     gid              = nlist->gid;
     shiftvec         = fr->shift_vec[0];
-    fshift           = fr->fshift[0];
+    fshift           = kernel_data->fshift[0];
     facel            = _mm_set1_ps(fr->epsfac);
     charge           = mdatoms->chargeA;
     nvdwtype         = fr->ntype;
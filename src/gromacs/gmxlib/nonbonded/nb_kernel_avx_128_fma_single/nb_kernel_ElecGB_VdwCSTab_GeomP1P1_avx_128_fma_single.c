@@ -101,7 +101,7 @@ nb_kernel_ElecGB_VdwCSTab_GeomP1P1_VF_avx_128_fma_single
     shiftidx         = nlist->shift;
     gid              = nlist->gid;
     shiftvec         = fr->shift_vec[0];
-    fshift           = fr->fshift[0];
+    fshift           = kernel_data->fshift[0];
     facel            = _mm_set1_ps(fr->epsfac);
     charge           = mdatoms->chargeA;
     nvdwtype         = fr->ntype;
@@ -112,7 +112,7 @@ nb_kernel_ElecGB_VdwCSTab_GeomP1P1_VF_avx_128_fma_single
     vftabscale       = _mm_set1_ps(kernel_data->table_vdw->scale);
 
     invsqrta         = fr->invsqrta;
-    dvda             = fr->dvda;
+    dvda             = kernel_data->dvda;
     gbtabscale       = _mm_set1_ps(fr->gbtab.scale);
     gbtab            = fr->gbtab.data;
     gbinvepsdiff     = _mm_set1_ps((1.0/fr->epsilon_r) - (1.0/fr->gb_epsilon_solvent));
@@ -581,7 +581,7 @@ nb_kernel_ElecGB_VdwCSTab_GeomP1P1_F_avx_128_fma_single
     shiftidx         = nlist->shift;
     gid              = nlist->gid;
     shiftvec         = fr->shift_vec[0];
-    fshift           = fr->fshift[0];
+    fshift           = kernel_data->fshift[0];
     facel            = _mm_set1_ps(fr->epsfac);
     charge           = mdatoms->chargeA;
     nvdwtype         = fr->ntype;
@@ -592,7 +592,7 @@ nb_kernel_ElecGB_VdwCSTab_GeomP1P1_F_avx_128_fma_single
     vftabscale       = _mm_set1_ps(kernel_data->table_vdw->scale);
 
     invsqrta         = fr->invsqrta;
-    dvda             = fr->dvda;
+    dvda             = kernel_data->dvda;
     gbtabscale       = _mm_set1_ps(fr->gbtab.scale);
     gbtab            = fr->gbtab.data;
     gbinvepsdiff     = _mm_set1_ps((1.0/fr->epsilon_r) - (1.0/fr->gb_epsilon_solvent));
@@ -113,7 +113,7 @@ nb_kernel_ElecRFCut_VdwCSTab_GeomW3W3_VF_avx_128_fma_single
     shiftidx         = nlist->shift;
     gid              = nlist->gid;
     shiftvec         = fr->shift_vec[0];
-    fshift           = fr->fshift[0];
+    fshift           = kernel_data->fshift[0];
     facel            = _mm_set1_ps(fr->epsfac);
     charge           = mdatoms->chargeA;
     krf              = _mm_set1_ps(fr->ic->k_rf);
@@ -1201,7 +1201,7 @@ nb_kernel_ElecRFCut_VdwCSTab_GeomW3W3_F_avx_128_fma_single
     shiftidx         = nlist->shift;
     gid              = nlist->gid;
     shiftvec         = fr->shift_vec[0];
-    fshift           = fr->fshift[0];
+    fshift           = kernel_data->fshift[0];
     facel            = _mm_set1_ps(fr->epsfac);
     charge           = mdatoms->chargeA;
     krf              = _mm_set1_ps(fr->ic->k_rf);
@@ -84,7 +84,7 @@ nb_kernel_ElecCSTab_VdwBham_GeomW3P1_VF_c
     shiftidx         = nlist->shift;
     gid              = nlist->gid;
     shiftvec         = fr->shift_vec[0];
-    fshift           = fr->fshift[0];
+    fshift           = kernel_data->fshift[0];
     facel            = fr->epsfac;
     charge           = mdatoms->chargeA;
     nvdwtype         = fr->ntype;
@@ -424,7 +424,7 @@ nb_kernel_ElecCSTab_VdwBham_GeomW3P1_F_c
     shiftidx         = nlist->shift;
     gid              = nlist->gid;
     shiftvec         = fr->shift_vec[0];
-    fshift           = fr->fshift[0];
+    fshift           = kernel_data->fshift[0];
     facel            = fr->epsfac;
     charge           = mdatoms->chargeA;
     nvdwtype         = fr->ntype;
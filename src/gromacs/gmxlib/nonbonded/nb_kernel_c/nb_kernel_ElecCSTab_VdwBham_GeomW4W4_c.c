@@ -99,7 +99,7 @@ nb_kernel_ElecCSTab_VdwBham_GeomW4W4_VF_c
     shiftidx         = nlist->shift;
     gid              = nlist->gid;
     shiftvec         = fr->shift_vec[0];
-    fshift           = fr->fshift[0];
+    fshift           = kernel_data->fshift[0];
     facel            = fr->epsfac;
     charge           = mdatoms->chargeA;
     nvdwtype         = fr->ntype;
@@ -783,7 +783,7 @@ nb_kernel_ElecCSTab_VdwBham_GeomW4W4_F_c
     shiftidx         = nlist->shift;
     gid              = nlist->gid;
     shiftvec         = fr->shift_vec[0];
-    fshift           = fr->fshift[0];
+    fshift           = kernel_data->fshift[0];
     facel            = fr->epsfac;
     charge           = mdatoms->chargeA;
     nvdwtype         = fr->ntype;
@@ -81,7 +81,7 @@ nb_kernel_ElecGB_VdwBham_GeomP1P1_VF_c
     shiftidx         = nlist->shift;
     gid              = nlist->gid;
     shiftvec         = fr->shift_vec[0];
-    fshift           = fr->fshift[0];
+    fshift           = kernel_data->fshift[0];
     facel            = fr->epsfac;
     charge           = mdatoms->chargeA;
     nvdwtype         = fr->ntype;
@@ -89,7 +89,7 @@ nb_kernel_ElecGB_VdwBham_GeomP1P1_VF_c
     vdwtype          = mdatoms->typeA;
 
     invsqrta         = fr->invsqrta;
-    dvda             = fr->dvda;
+    dvda             = kernel_data->dvda;
     gbtabscale       = fr->gbtab.scale;
     gbtab            = fr->gbtab.data;
     gbinvepsdiff     = (1.0/fr->epsilon_r) - (1.0/fr->gb_epsilon_solvent);
@@ -318,7 +318,7 @@ nb_kernel_ElecGB_VdwBham_GeomP1P1_F_c
     shiftidx         = nlist->shift;
     gid              = nlist->gid;
     shiftvec         = fr->shift_vec[0];
-    fshift           = fr->fshift[0];
+    fshift           = kernel_data->fshift[0];
     facel            = fr->epsfac;
     charge           = mdatoms->chargeA;
     nvdwtype         = fr->ntype;
@@ -326,7 +326,7 @@ nb_kernel_ElecGB_VdwBham_GeomP1P1_F_c
     vdwtype          = mdatoms->typeA;
 
     invsqrta         = fr->invsqrta;
-    dvda             = fr->dvda;
+    dvda             = kernel_data->dvda;
     gbtabscale       = fr->gbtab.scale;
     gbtab            = fr->gbtab.data;
     gbinvepsdiff     = (1.0/fr->epsilon_r) - (1.0/fr->gb_epsilon_solvent);
@@ -81,7 +81,7 @@ nb_kernel_ElecGB_VdwCSTab_GeomP1P1_VF_c
     shiftidx         = nlist->shift;
     gid              = nlist->gid;
     shiftvec         = fr->shift_vec[0];
-    fshift           = fr->fshift[0];
+    fshift           = kernel_data->fshift[0];
     facel            = fr->epsfac;
     charge           = mdatoms->chargeA;
     nvdwtype         = fr->ntype;
@@ -92,7 +92,7 @@ nb_kernel_ElecGB_VdwCSTab_GeomP1P1_VF_c
     vftabscale       = kernel_data->table_vdw->scale;
 
     invsqrta         = fr->invsqrta;
-    dvda             = fr->dvda;
+    dvda             = kernel_data->dvda;
     gbtabscale       = fr->gbtab.scale;
     gbtab            = fr->gbtab.data;
     gbinvepsdiff     = (1.0/fr->epsilon_r) - (1.0/fr->gb_epsilon_solvent);
@@ -341,7 +341,7 @@ nb_kernel_ElecGB_VdwCSTab_GeomP1P1_F_c
     shiftidx         = nlist->shift;
     gid              = nlist->gid;
     shiftvec         = fr->shift_vec[0];
-    fshift           = fr->fshift[0];
+    fshift           = kernel_data->fshift[0];
     facel            = fr->epsfac;
     charge           = mdatoms->chargeA;
     nvdwtype         = fr->ntype;
@@ -352,7 +352,7 @@ nb_kernel_ElecGB_VdwCSTab_GeomP1P1_F_c
     vftabscale       = kernel_data->table_vdw->scale;
 
     invsqrta         = fr->invsqrta;
-    dvda             = fr->dvda;
+    dvda             = kernel_data->dvda;
     gbtabscale       = fr->gbtab.scale;
     gbtab            = fr->gbtab.data;
     gbinvepsdiff     = (1.0/fr->epsilon_r) - (1.0/fr->gb_epsilon_solvent);
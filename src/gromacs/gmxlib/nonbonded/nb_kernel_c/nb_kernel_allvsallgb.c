@@ -286,7 +286,7 @@ nb_kernel_allvsallgb(t_nblist *                nlist,
     GBtab               = fr->gbtab.data;
     gbtabscale          = fr->gbtab.scale;
     invsqrta            = fr->invsqrta;
-    dvda                = fr->dvda;
+    dvda                = kernel_data->dvda;
     vpol                = kernel_data->energygrp_polarization;
 
     natoms              = mdatoms->nr;
@@ -81,7 +81,7 @@
 #if (defined GMX_CPU_ACCELERATION_X86_AVX_128_FMA) && !(defined GMX_DOUBLE)
 #    include "nb_kernel_avx_128_fma_single/nb_kernel_avx_128_fma_single.h"
 #endif
-#if (defined GMX_CPU_ACCELERATION_X86_AVX_256) && !(defined GMX_DOUBLE)
+#if (defined GMX_CPU_ACCELERATION_X86_AVX_256 || defined GMX_CPU_ACCELERATION_X86_AVX_512) && !(defined GMX_DOUBLE)
 #    include "nb_kernel_avx_256_single/nb_kernel_avx_256_single.h"
 #endif
 #if (defined GMX_CPU_ACCELERATION_X86_SSE2 && defined GMX_DOUBLE)
@@ -93,7 +93,7 @@
 #if (defined GMX_CPU_ACCELERATION_X86_AVX_128_FMA && defined GMX_DOUBLE)
 #    include "nb_kernel_avx_128_fma_double/nb_kernel_avx_128_fma_double.h"
 #endif
-#if (defined GMX_CPU_ACCELERATION_X86_AVX_256 && defined GMX_DOUBLE)
+#if ((defined GMX_CPU_ACCELERATION_X86_AVX_256 || defined GMX_CPU_ACCELERATION_X86_AVX_512) && defined GMX_DOUBLE)
 #    include "nb_kernel_avx_256_double/nb_kernel_avx_256_double.h"
 #endif
 
@@ -133,7 +133,7 @@ gmx_nonbonded_setup(FILE *         fplog,
 #if (defined GMX_CPU_ACCELERATION_X86_AVX_128_FMA) && !(defined GMX_DOUBLE)
                 nb_kernel_list_add_kernels(kernellist_avx_128_fma_single,kernellist_avx_128_fma_single_size);
 #endif
-#if (defined GMX_CPU_ACCELERATION_X86_AVX_256) && !(defined GMX_DOUBLE)
+#if (defined GMX_CPU_ACCELERATION_X86_AVX_256 || defined GMX_CPU_ACCELERATION_X86_AVX_512) && !(defined GMX_DOUBLE)
                 nb_kernel_list_add_kernels(kernellist_avx_256_single,kernellist_avx_256_single_size);
 #endif
                 /* Double precision */
@@ -146,7 +146,7 @@ gmx_nonbonded_setup(FILE *         fplog,
 #if (defined GMX_CPU_ACCELERATION_X86_AVX_128_FMA && defined GMX_DOUBLE)
                 nb_kernel_list_add_kernels(kernellist_avx_128_fma_double,kernellist_avx_128_fma_double_size);
 #endif
-#if (defined GMX_CPU_ACCELERATION_X86_AVX_256 && defined GMX_DOUBLE)
+#if ((defined GMX_CPU_ACCELERATION_X86_AVX_256 || defined GMX_CPU_ACCELERATION_X86_AVX_512) && defined GMX_DOUBLE)
                 nb_kernel_list_add_kernels(kernellist_avx_256_double,kernellist_avx_256_double_size);
 #endif
                 ; /* empty statement to avoid a completely empty block */
@@ -183,7 +183,7 @@ gmx_nonbonded_set_kernel_pointers(FILE *log, t_nblist *nl)
     arch_and_padding[] =
     {
         /* Single precision */
-#if (defined GMX_CPU_ACCELERATION_X86_AVX_256) && !(defined GMX_DOUBLE)
+#if (defined GMX_CPU_ACCELERATION_X86_AVX_256 || defined GMX_CPU_ACCELERATION_X86_AVX_512) && !(defined GMX_DOUBLE)
         { "avx_256_single", 8 },
 #endif
 #if (defined GMX_CPU_ACCELERATION_X86_AVX_128_FMA) && !(defined GMX_DOUBLE)
@@ -196,7 +196,7 @@ gmx_nonbonded_set_kernel_pointers(FILE *log, t_nblist *nl)
         { "sse2_single", 4 },
 #endif
         /* Double precision */
-#if (defined GMX_CPU_ACCELERATION_X86_AVX_256 && defined GMX_DOUBLE)
+#if ((defined GMX_CPU_ACCELERATION_X86_AVX_256 || defined GMX_CPU_ACCELERATION_X86_AVX_512) && defined GMX_DOUBLE)
         { "avx_256_double", 4 },
 #endif
 #if (defined GMX_CPU_ACCELERATION_X86_AVX_128_FMA && defined GMX_DOUBLE)
@@ -302,23 +302,273 @@ gmx_nonbonded_set_kernel_pointers(FILE *log, t_nblist *nl)
     return;
 }
 
-void do_nonbonded(t_commrec *cr,t_forcerec *fr,
-                  rvec x[],rvec f_shortrange[],rvec f_longrange[],t_mdatoms *mdatoms,t_blocka *excl,
-                  gmx_grppairener_t *grppener,rvec box_size,
-                  t_nrnb *nrnb,real *lambda, real *dvdl,
-                  int nls,int eNL,int flags)
+/* The thread force buffers are divided in at most 32 blocks,
+ * of at least 2^6=64 atoms, as for the bonded interactions.
+ */
+#define NB_RED_BLOCK_BITS 32
+/* A fixed maximum avoids memory management in the reduction */
+#define NB_RED_MAX_THREADS 256
+
+int
+gmx_nonbonded_red_ashift(int natoms)
+{
+    int ashift;
+
+    ashift = 6;
+    while (natoms > (int)(NB_RED_BLOCK_BITS*(1U<<ashift)))
+    {
+        ashift++;
+    }
+
+    return ashift;
+}
+
+unsigned
+gmx_nblist_red_mask(const t_nblist *nl,int ashift,unsigned mask)
+{
+    int i,j,a,ni,nj;
+
+    /* Water i- and j-entries are the first atom of the water */
+    switch (nl->igeometry)
+    {
+    case GMX_NBLIST_GEOMETRY_WATER3_PARTICLE: ni = 3; nj = 1; break;
+    case GMX_NBLIST_GEOMETRY_WATER3_WATER3:   ni = 3; nj = 3; break;
+    case GMX_NBLIST_GEOMETRY_WATER4_PARTICLE: ni = 4; nj = 1; break;
+    case GMX_NBLIST_GEOMETRY_WATER4_WATER4:   ni = 4; nj = 4; break;
+    default:                                  ni = 1; nj = 1;
+    }
+
+    for(i=0; i<nl->nri; i++)
+    {
+        if (nl->igeometry == GMX_NBLIST_GEOMETRY_CG_CG)
+        {
+            ni = nl->iinr_end[i] - nl->iinr[i];
+        }
+        for(a=nl->iinr[i]; a<nl->iinr[i]+ni; a++)
+        {
+            mask |= (1U << (a>>ashift));
+        }
+        for(j=nl->jindex[i]; j<nl->jindex[i+1]; j++)
+        {
+            /* Skip the SIMD padding entries */
+            if (nl->jjnr[j] < 0)
+            {
+                continue;
+            }
+            if (nl->igeometry == GMX_NBLIST_GEOMETRY_CG_CG)
+            {
+                nj = nl->jjnr_end[j] - nl->jjnr[j];
+            }
+            for(a=nl->jjnr[j]; a<nl->jjnr[j]+nj; a++)
+            {
+                mask |= (1U << (a>>ashift));
+            }
+        }
+    }
+
+    return mask;
+}
+
+void
+gmx_nonbonded_clear_thread_force(f_thread_t *ft,int natoms,int ashift,
+                                 gmx_bool bDvda)
+{
+    int b,a0,a1,a;
+
+    if (natoms > ft->f_nalloc)
+    {
+        ft->f_nalloc = over_alloc_large(natoms);
+        srenew(ft->f,ft->f_nalloc);
+        if (bDvda)
+        {
+            srenew(ft->dvda,ft->f_nalloc);
+        }
+    }
+
+    for(b=0; b<NB_RED_BLOCK_BITS; b++)
+    {
+        if (ft->red_mask & (1U<<b))
+        {
+            a0 = b<<ashift;
+            a1 = min((b+1)<<ashift,natoms);
+            for(a=a0; a<a1; a++)
+            {
+                clear_rvec(ft->f[a]);
+            }
+            if (bDvda)
+            {
+                for(a=a0; a<a1; a++)
+                {
+                    ft->dvda[a] = 0;
+                }
+            }
+        }
+    }
+    clear_rvecs(SHIFTS,ft->fshift);
+}
+
+void
+gmx_nonbonded_reduce_thread_force(int natoms,rvec *f,real *dvda,
+                                  int nthreads,const f_thread_t *f_t,
+                                  int ashift)
+{
+    int nblock,b;
+
+    if (nthreads > NB_RED_MAX_THREADS)
+    {
+        gmx_fatal(FARGS,"Can not reduce nonbonded forces on more than %d threads",
+                  NB_RED_MAX_THREADS);
+    }
+
+    nblock = ((natoms - 1)>>ashift) + 1;
+
+    /* Each block is reduced by one thread, over the thread buffers
+     * that contribute to it.
+     */
+#pragma omp parallel for num_threads(nthreads) schedule(static)
+    for(b=0; b<nblock; b++)
+    {
+        int th,nfb,fb,a0,a1,a;
+        int tb[NB_RED_MAX_THREADS];
+
+        nfb = 0;
+        for(th=1; th<nthreads; th++)
+        {
+            if (f_t[th].red_mask & (1U<<b))
+            {
+                tb[nfb++] = th;
+            }
+        }
+        a0 = b<<ashift;
+        a1 = min((b+1)<<ashift,natoms);
+        for(fb=0; fb<nfb; fb++)
+        {
+            for(a=a0; a<a1; a++)
+            {
+                rvec_inc(f[a],f_t[tb[fb]].f[a]);
+            }
+            if (dvda != NULL)
+            {
+                for(a=a0; a<a1; a++)
+                {
+                    dvda[a] += f_t[tb[fb]].dvda[a];
+                }
+            }
+        }
+    }
+}
+
+/* Computes the short- or long-range (range=0/1) interactions of
+ * list sets n0 to n1 of the group scheme lists in nblists.
+ * The tables are always taken from the first set in fr->nblists.
+ */
+static void do_nonbonded_lists(t_forcerec *fr,t_nblists *nblists,
+                               int n0,int n1,int i0,int i1,int range,
+                               rvec x[],rvec f[],rvec fshift[],real *dvda,
+                               t_mdatoms *mdatoms,t_blocka *excl,
+                               gmx_grppairener_t *grppener,
+                               t_nrnb *nrnb,real *lambda,real *dvdl,
+                               int flags)
 {
 	t_nblist *        nlist;
-	int               n,n0,n1,i,i0,i1,sz,range;
-	t_nblists *       nblists;
+	int               n,i;
     nb_kernel_data_t  kernel_data;
     nb_kernel_t *     kernelptr=NULL;
-    rvec *            f;
-    
+
     kernel_data.flags                   = flags;
     kernel_data.exclusions              = excl;
     kernel_data.lambda                  = lambda;
     kernel_data.dvdl                    = dvdl;
+    kernel_data.fshift                  = fshift;
+    kernel_data.dvda                    = dvda;
+
+    if(range==0)
+    {
+        /* Short-range */
+        kernel_data.energygrp_elec          = grppener->ener[egCOULSR];
+        kernel_data.energygrp_vdw           = grppener->ener[fr->bBHAM ? egBHAMSR : egLJSR];
+    }
+    else
+    {
+        /* Long-range */
+        kernel_data.energygrp_elec          = grppener->ener[egCOULLR];
+        kernel_data.energygrp_vdw           = grppener->ener[fr->bBHAM ? egBHAMLR : egLJLR];
+    }
+    kernel_data.energygrp_polarization  = grppener->ener[egGB];
+
+	for(n=n0; (n<n1); n++)
+	{
+        kernel_data.table_elec              = &fr->nblists[n].table_elec;
+        kernel_data.table_vdw               = &fr->nblists[n].table_vdw;
+        kernel_data.table_elec_vdw          = &fr->nblists[n].table_elec_vdw;
+
+        nlist = (range==0) ? nblists[n].nlist_sr : nblists[n].nlist_lr;
+
+        for(i=i0; (i<i1); i++)
+        {
+            if (nlist[i].nri > 0)
+            {
+                if(flags & GMX_NONBONDED_DO_POTENTIAL)
+                {
+                    /* Potential and force */
+                    kernelptr = (nb_kernel_t *)nlist[i].kernelptr_vf;
+                }
+                else
+                {
+                    /* Force only, no potential */
+                    kernelptr = (nb_kernel_t *)nlist[i].kernelptr_f;
+                }
+
+                if(nlist[i].type!=GMX_NBLIST_INTERACTION_FREE_ENERGY && (flags & GMX_NONBONDED_DO_FOREIGNLAMBDA))
+                {
+                    /* We don't need the non-perturbed interactions */
+                    continue;
+                }
+                (*kernelptr)(&(nlist[i]),x,f,fr,mdatoms,&kernel_data,nrnb);
+            }
+        }
+    }
+}
+
+/* Returns the force block mask for the lists computed by
+ * do_nonbonded_lists with the same arguments.
+ */
+static unsigned nonbonded_lists_red_mask(t_nblists *nblists,
+                                         int n0,int n1,int i0,int i1,
+                                         int range,int ashift,int flags)
+{
+    t_nblist *nlist;
+    int      n,i;
+    unsigned mask;
+
+    mask = 0;
+    for(n=n0; n<n1; n++)
+    {
+        nlist = (range==0) ? nblists[n].nlist_sr : nblists[n].nlist_lr;
+
+        for(i=i0; i<i1; i++)
+        {
+            if (nlist[i].nri > 0 &&
+                !(nlist[i].type!=GMX_NBLIST_INTERACTION_FREE_ENERGY &&
+                  (flags & GMX_NONBONDED_DO_FOREIGNLAMBDA)))
+            {
+                mask = gmx_nblist_red_mask(&nlist[i],ashift,mask);
+            }
+        }
+    }
+
+    return mask;
+}
+
+void do_nonbonded(t_commrec *cr,t_forcerec *fr,
+                  rvec x[],rvec f_shortrange[],rvec f_longrange[],t_mdatoms *mdatoms,t_blocka *excl,
+                  gmx_grppairener_t *grppener,rvec box_size,
+                  t_nrnb *nrnb,real *lambda, real *dvdl,
+                  int nls,int eNL,int flags)
+{
+	int               n0,n1,i,j,i0,i1,range,nthreads,th,ashift;
+    rvec *            f;
+    gmx_bool          bForce;
         
     if(fr->bAllvsAll)
     {
@@ -347,71 +597,152 @@ void do_nonbonded(t_commrec *cr,t_forcerec *fr,
 		n1 = fr->nnblists;
 	}
 
-	for(n=n0; (n<n1); n++)
-	{
-		nblists = &fr->nblists[n];
+    nthreads = fr->nthread_ns;
+    bForce   = (flags & GMX_NONBONDED_DO_FORCE);
+    ashift   = gmx_nonbonded_red_ashift(fr->natoms_force);
+
+    for(range=0;range<2;range++)
+    {
+        /* Are we doing short/long-range? */
+        if(range==0)
+        {
+            if(!(flags & GMX_NONBONDED_DO_SR))
+            {
+                continue;
+            }
+            f = f_shortrange;
+        }
+        else
+        {
+            if(!(flags & GMX_NONBONDED_DO_LR))
+            {
+                continue;
+            }
+            f = f_longrange;
+        }
 
-        kernel_data.table_elec              = &nblists->table_elec;
-        kernel_data.table_vdw               = &nblists->table_vdw;
-        kernel_data.table_elec_vdw          = &nblists->table_elec_vdw;
+        if (nthreads == 1)
+        {
+            do_nonbonded_lists(fr,fr->nblists,n0,n1,i0,i1,range,
+                               x,f,fr->fshift,fr->dvda,mdatoms,excl,grppener,
+                               nrnb,lambda,dvdl,flags);
+            continue;
+        }
 
-        for(range=0;range<2;range++)
+        /* Each thread computes the list set generated by the same
+         * search thread. Thread 0 adds to the global output,
+         * the other threads use fr->f_t_nb and are reduced afterwards.
+         * Only the force blocks with atoms in a thread's lists
+         * are cleared and reduced.
+         */
+#pragma omp parallel for num_threads(nthreads) schedule(static)
+        for(th=0; th<nthreads; th++)
         {
-            /* Are we doing short/long-range? */
-            if(range==0)
+            f_thread_t *ft;
+            t_nrnb     nrnb_th;
+            int        e,k;
+
+            init_nrnb(&nrnb_th);
+            if (th == 0)
+            {
+                do_nonbonded_lists(fr,fr->nblists,n0,n1,i0,i1,range,
+                                   x,f,fr->fshift,fr->dvda,mdatoms,excl,grppener,
+                                   &nrnb_th,lambda,dvdl,flags);
+            }
+            else
             {
-                /* Short-range */
-                if(!(flags & GMX_NONBONDED_DO_SR))
+                ft = &fr->f_t_nb[th];
+                /* The kernels always compute forces, so we need
+                 * a thread local force buffer even without bForce.
+                 */
+                ft->red_mask =
+                    nonbonded_lists_red_mask(fr->nblists+th*fr->nnblists,
+                                             n0,n1,i0,i1,range,ashift,flags);
+                gmx_nonbonded_clear_thread_force(ft,fr->natoms_force,ashift,
+                                                 fr->bGB);
+                for(e=0; e<egNR; e++)
                 {
-                    continue;
+                    for(k=0; k<ft->grpp.nener; k++)
+                    {
+                        ft->grpp.ener[e][k] = 0;
+                    }
                 }
-                kernel_data.energygrp_elec          = grppener->ener[egCOULSR];
-                kernel_data.energygrp_vdw           = grppener->ener[fr->bBHAM ? egBHAMSR : egLJSR];
-                kernel_data.energygrp_polarization  = grppener->ener[egGB];
-                nlist = nblists->nlist_sr;
-                f                                   = f_shortrange;
+                ft->dvdl[efptCOUL] = 0;
+                ft->dvdl[efptVDW]  = 0;
+
+                do_nonbonded_lists(fr,fr->nblists+th*fr->nnblists,
+                                   n0,n1,i0,i1,range,
+                                   x,ft->f,ft->fshift,ft->dvda,
+                                   mdatoms,excl,&ft->grpp,
+                                   &nrnb_th,lambda,ft->dvdl,flags);
             }
-            else if(range==1)
+#pragma omp critical
+            add_nrnb(nrnb,nrnb,&nrnb_th);
+        }
+
+        if (bForce)
+        {
+            gmx_nonbonded_reduce_thread_force(fr->natoms_force,f,
+                                              fr->bGB ? fr->dvda : NULL,
+                                              nthreads,fr->f_t_nb,ashift);
+        }
+        for(th=1; th<nthreads; th++)
+        {
+            if (bForce)
             {
-                /* Long-range */
-                if(!(flags & GMX_NONBONDED_DO_LR))
+                for(i=0; i<SHIFTS; i++)
                 {
-                    continue;
+                    rvec_inc(fr->fshift[i],fr->f_t_nb[th].fshift[i]);
                 }
-                kernel_data.energygrp_elec          = grppener->ener[egCOULLR];
-                kernel_data.energygrp_vdw           = grppener->ener[fr->bBHAM ? egBHAMLR : egLJLR];
-                kernel_data.energygrp_polarization  = grppener->ener[egGB];
-                nlist = nblists->nlist_lr;
-                f                                   = f_longrange;
             }
-
-            for(i=i0; (i<i1); i++)
+            for(i=0; i<egNR; i++)
             {
-                if (nlist[i].nri > 0)
+                for(j=0; j<grppener->nener; j++)
                 {
-                    if(flags & GMX_NONBONDED_DO_POTENTIAL)
-                    {
-                        /* Potential and force */
-                        kernelptr = (nb_kernel_t *)nlist[i].kernelptr_vf;
-                    }
-                    else
-                    {
-                        /* Force only, no potential */
-                        kernelptr = (nb_kernel_t *)nlist[i].kernelptr_f;
-                    }
-
-                    if(nlist[i].type!=GMX_NBLIST_INTERACTION_FREE_ENERGY && (flags & GMX_NONBONDED_DO_FOREIGNLAMBDA))
-                    {
-                        /* We don't need the non-perturbed interactions */
-                        continue;
-                    }
-                    (*kernelptr)(&(nlist[i]),x,f,fr,mdatoms,&kernel_data,nrnb);
-                 }
+                    grppener->ener[i][j] += fr->f_t_nb[th].grpp.ener[i][j];
+                }
             }
+            dvdl[efptCOUL] += fr->f_t_nb[th].dvdl[efptCOUL];
+            dvdl[efptVDW]  += fr->f_t_nb[th].dvdl[efptVDW];
         }
     }
 }
 
+void
+do_nonbonded_fep_list(t_forcerec *fr,t_nblist *nlist,t_nblist *nlist_excl,
+                      rvec x[],rvec f[],rvec fshift[],t_mdatoms *mdatoms,
+                      gmx_grppairener_t *grppener,
+                      t_nrnb *nrnb,real *lambda,real *dvdl,
+                      int flags)
+{
+    nb_kernel_data_t  kernel_data;
+
+    kernel_data.flags                   = flags;
+    kernel_data.exclusions              = NULL;
+    kernel_data.lambda                  = lambda;
+    kernel_data.dvdl                    = dvdl;
+    kernel_data.fshift                  = fshift;
+    kernel_data.dvda                    = fr->dvda;
+
+    /* The list only uses analytical kernels, but the kernel reads the scale */
+    kernel_data.table_elec              = &fr->nblists[0].table_elec;
+    kernel_data.table_vdw               = &fr->nblists[0].table_vdw;
+    kernel_data.table_elec_vdw          = &fr->nblists[0].table_elec_vdw;
+
+    kernel_data.energygrp_elec          = grppener->ener[egCOULSR];
+    kernel_data.energygrp_vdw           = grppener->ener[egLJSR];
+    kernel_data.energygrp_polarization  = grppener->ener[egGB];
+
+    if (nlist->nri > 0)
+    {
+        gmx_nb_free_energy_kernel(nlist,x,f,fr,mdatoms,&kernel_data,nrnb);
+    }
+    if (nlist_excl->nri > 0)
+    {
+        gmx_nb_free_energy_excl_kernel(nlist_excl,x,f,fr,mdatoms,&kernel_data,nrnb);
+    }
+}
+
 static void
 nb_listed_warning_rlimit(const rvec *x,int ai, int aj,int * global_atom_index,real r, real rlimit)
 {
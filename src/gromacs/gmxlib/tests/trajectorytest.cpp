@@ -0,0 +1,240 @@
+/*
+ *
+ *                This source code is part of
+ *
+ *                 G   R   O   M   A   C   S
+ *
+ *          GROningen MAchine for Chemical Simulations
+ *
+ * Written by David van der Spoel, Erik Lindahl, Berk Hess, and others.
+ * Copyright (c) 1991-2000, University of Groningen, The Netherlands.
+ * Copyright (c) 2001-2009, The GROMACS development team,
+ * check out http://www.gromacs.org for more information.
+
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * If you want to redistribute modifications, please consider that
+ * scientific software is very special. Version control is crucial -
+ * bugs must be traceable. We will be happy to consider code for
+ * inclusion in the official distribution, but derived work must not
+ * be called official GROMACS. Details are found in the README & COPYING
+ * files - if they are missing, get the official version at www.gromacs.org.
+ *
+ * To help us fund GROMACS development, we humbly ask that you cite
+ * the papers on the package - you can find them in the top README file.
+ *
+ * For more info, check our website at http://www.gromacs.org
+ */
+/*! \internal \file
+ * \brief
+ * Implements helpers for writing and reading back test trajectories.
+ *
+ * \ingroup module_gmxlib
+ */
+#include "config.h"
+
+#ifndef GMX_NATIVE_WINDOWS
+
+#include "trajectorytest.h"
+
+#include <cmath>
+#include <cstdlib>
+
+#include "futil.h"
+#include "statutil.h"
+#include "xtcio.h"
+#include "trnio.h"
+#include "vec.h"
+#include "trxindex.h"
+
+namespace gmx
+{
+namespace test
+{
+
+namespace
+{
+
+//! Sets or, with value NULL, unsets environment variable name.
+void setEnv(const char *name, const char *value)
+{
+    if (value != NULL)
+    {
+        setenv(name, value, 1);
+    }
+    else
+    {
+        unsetenv(name);
+    }
+}
+
+} // namespace
+
+const ReadPath plainPath = { "1", "1", "0" };
+
+void makeFrame(int f, int natoms, Frame *fr)
+{
+    fr->step = 10*f;
+    fr->time = f*frameDt;
+    clear_mat(fr->box);
+    fr->box[XX][XX] = 5;
+    fr->box[YY][YY] = 5;
+    fr->box[ZZ][ZZ] = 5 + 0.001*f;
+    fr->x.resize(natoms*DIM);
+    fr->v.resize(natoms*DIM);
+    for (int i = 0; i < natoms; i++)
+    {
+        int w = i/3;
+        for (int d = 0; d < DIM; d++)
+        {
+            fr->x[i*DIM + d] = 0.31*((w*(d + 3)) % 16) + 0.1*(i % 3 == d)
+                + 0.02*std::sin(0.1*f + i + d);
+            fr->v[i*DIM + d] = std::cos(0.3*f + i*d);
+        }
+    }
+}
+
+void writeFrames(const std::string &fn, int natoms, int first, int n,
+                 const char *mode)
+{
+    bool      bXtc = (fn2ftp(fn.c_str()) == efXTC);
+    t_fileio *fio  = bXtc ? open_xtc(fn.c_str(), mode) : open_trn(fn.c_str(), mode);
+
+    for (int f = first; f < first + n; f++)
+    {
+        Frame fr;
+        makeFrame(f, natoms, &fr);
+        if (bXtc)
+        {
+            write_xtc(fio, natoms, fr.step, fr.time, fr.box,
+                      (rvec *)&fr.x[0], xtcPrec);
+        }
+        else
+        {
+            fwrite_trn(fio, fr.step, fr.time, 0, fr.box, natoms,
+                       (rvec *)&fr.x[0], (rvec *)&fr.v[0], NULL);
+        }
+    }
+    if (bXtc)
+    {
+        close_xtc(fio);
+    }
+    else
+    {
+        close_trn(fio);
+    }
+}
+
+void setReadPath(const ReadPath *path, real tbegin)
+{
+    setEnv("GMX_NO_TRX_MMAP", path != NULL ? path->noMmap : NULL);
+    setEnv("GMX_NO_TRX_INDEX", path != NULL ? path->noIndex : NULL);
+    setEnv("GMX_XTC_READ_THREADS", path != NULL ? path->readThreads : NULL);
+    /* -b is a global setting, a negative time selects all frames */
+    setTimeValue(TBEGIN, tbegin);
+}
+
+void appendFrame(t_trxframe *fr, std::vector<Frame> *frames)
+{
+    Frame f;
+
+    f.step = fr->step;
+    f.time = fr->time;
+    copy_mat(fr->box, f.box);
+    f.x.assign(fr->x[0], fr->x[0] + fr->natoms*DIM);
+    if (fr->bV)
+    {
+        f.v.assign(fr->v[0], fr->v[0] + fr->natoms*DIM);
+    }
+    frames->push_back(f);
+}
+
+std::vector<Frame> readTrajectory(const std::string &fn, const ReadPath &path,
+                                  real tbegin)
+{
+    output_env_t       oenv;
+    t_trxstatus       *status;
+    t_trxframe         fr;
+    std::vector<Frame> frames;
+
+    setReadPath(&path, tbegin);
+    output_env_init_default(&oenv);
+    if (read_first_frame(oenv, &status, fn.c_str(), &fr,
+                         TRX_NEED_X | TRX_READ_V))
+    {
+        do
+        {
+            appendFrame(&fr, &frames);
+        }
+        while (read_next_frame(oenv, status, &fr));
+        close_trx(status);
+    }
+    output_env_done(oenv);
+    setReadPath(NULL, -1);
+
+    return frames;
+}
+
+void compareFrames(const std::vector<Frame> &a, const std::vector<Frame> &b)
+{
+    ASSERT_EQ(a.size(), b.size());
+    for (size_t f = 0; f < a.size(); f++)
+    {
+        SCOPED_TRACE(testing::Message() << "frame " << f);
+        EXPECT_EQ(a[f].step, b[f].step);
+        EXPECT_EQ(a[f].time, b[f].time);
+        for (int d = 0; d < DIM; d++)
+        {
+            for (int e = 0; e < DIM; e++)
+            {
+                EXPECT_EQ(a[f].box[d][e], b[f].box[d][e]);
+            }
+        }
+        EXPECT_TRUE(a[f].x == b[f].x);
+        EXPECT_TRUE(a[f].v == b[f].v);
+    }
+}
+
+void compareToWritten(const std::vector<Frame> &frames, int f0, int natoms,
+                      real tol)
+{
+    ASSERT_EQ(nframes - f0, static_cast<int>(frames.size()));
+    for (size_t f = 0; f < frames.size(); f++)
+    {
+        Frame ref;
+        makeFrame(f0 + f, natoms, &ref);
+        SCOPED_TRACE(testing::Message() << "frame " << f0 + f);
+        EXPECT_EQ(ref.step, frames[f].step);
+        EXPECT_FLOAT_EQ(ref.time, frames[f].time);
+        ASSERT_EQ(ref.x.size(), frames[f].x.size());
+        for (size_t i = 0; i < ref.x.size(); i++)
+        {
+            EXPECT_NEAR(ref.x[i], frames[f].x[i], tol);
+        }
+    }
+}
+
+std::string TrajectoryReadTest::fileName(const char *ext)
+{
+    std::string fn  = tempFiles_.getTemporaryFilePath(ext);
+    std::string idx = std::string(ext) + TRXINDEX_EXT;
+    /* Registers the cached index for removal */
+    tempFiles_.getTemporaryFilePath(idx.c_str());
+    return fn;
+}
+
+std::string TrajectoryReadTest::write(const char *ext, int natoms)
+{
+    std::string fn = fileName(ext);
+
+    writeFrames(fn, natoms, 0, nframes, "w");
+    return fn;
+}
+
+} // namespace test
+} // namespace gmx
+
+#endif
@@ -0,0 +1,149 @@
+/*
+ *
+ *                This source code is part of
+ *
+ *                 G   R   O   M   A   C   S
+ *
+ *          GROningen MAchine for Chemical Simulations
+ *
+ * Written by David van der Spoel, Erik Lindahl, Berk Hess, and others.
+ * Copyright (c) 1991-2000, University of Groningen, The Netherlands.
+ * Copyright (c) 2001-2009, The GROMACS development team,
+ * check out http://www.gromacs.org for more information.
+
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * If you want to redistribute modifications, please consider that
+ * scientific software is very special. Version control is crucial -
+ * bugs must be traceable. We will be happy to consider code for
+ * inclusion in the official distribution, but derived work must not
+ * be called official GROMACS. Details are found in the README & COPYING
+ * files - if they are missing, get the official version at www.gromacs.org.
+ *
+ * To help us fund GROMACS development, we humbly ask that you cite
+ * the papers on the package - you can find them in the top README file.
+ *
+ * For more info, check our website at http://www.gromacs.org
+ */
+/*! \internal \file
+ * \brief
+ * Declares helpers for writing and reading back test trajectories.
+ *
+ * \ingroup module_gmxlib
+ */
+#ifndef GMX_GMXLIB_TESTS_TRAJECTORYTEST_H
+#define GMX_GMXLIB_TESTS_TRAJECTORYTEST_H
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "testutils/testfilemanager.h"
+
+#include "typedefs.h"
+
+namespace gmx
+{
+namespace test
+{
+
+//! Number of atoms in the xtc files, enough to enable read-ahead.
+const int  xtcNatoms  = 1500;
+//! Number of atoms in the trr files.
+const int  trrNatoms  = 100;
+//! Number of frames written by TrajectoryReadTest::write().
+const int  nframes    = 25;
+//! Time between frames.
+const real frameDt    = 0.5;
+//! xtc precision.
+const real xtcPrec    = 1000;
+
+//! One frame as returned by the reader.
+struct Frame
+{
+    int               step;
+    real              time;
+    matrix            box;
+    std::vector<real> x;
+    std::vector<real> v;
+};
+
+//! Generates the box and coordinates, as waters, of frame f.
+void makeFrame(int f, int natoms, Frame *fr);
+
+/*! \brief
+ * Writes frames first to first + n - 1 with natoms atoms to fn.
+ *
+ * The file type follows from the extension, mode is "w" or "a".
+ */
+void writeFrames(const std::string &fn, int natoms, int first, int n,
+                 const char *mode);
+
+//! Reader settings, the values of the environment switches.
+struct ReadPath
+{
+    const char *noMmap;
+    const char *noIndex;
+    const char *readThreads;
+};
+
+//! The plain xdr reader without index, mapping or threads.
+extern const ReadPath plainPath;
+
+/*! \brief
+ * Selects the reader of path and start time tbegin for the next reads.
+ *
+ * With path NULL, the environment switches are unset.
+ */
+void setReadPath(const ReadPath *path, real tbegin);
+
+//! Appends the frame read into fr to frames.
+void appendFrame(t_trxframe *fr, std::vector<Frame> *frames);
+
+/*! \brief
+ * Reads all frames from time tbegin on of fn with the reader of path.
+ *
+ * A negative tbegin reads all frames.
+ */
+std::vector<Frame> readTrajectory(const std::string &fn, const ReadPath &path,
+                                  real tbegin);
+
+//! Checks that frames a and b are bitwise equal.
+void compareFrames(const std::vector<Frame> &a, const std::vector<Frame> &b);
+
+/*! \brief
+ * Checks read frames, starting at frame f0, against the written ones.
+ *
+ * There should be nframes - f0 frames.
+ */
+void compareToWritten(const std::vector<Frame> &frames, int f0, int natoms,
+                      real tol);
+
+//! Test fixture that writes trajectories to temporary files.
+class TrajectoryReadTest : public ::testing::Test
+{
+    public:
+        /*! \brief
+         * Returns a temporary file name with extension ext.
+         *
+         * The file and its cached frame index are removed after the test.
+         */
+        std::string fileName(const char *ext);
+
+        /*! \brief
+         * Writes nframes frames with extension ext, returns the file name.
+         */
+        std::string write(const char *ext, int natoms);
+
+        //! Manages the temporary files.
+        TestFileManager tempFiles_;
+};
+
+} // namespace test
+} // namespace gmx
+
+#endif
@@ -0,0 +1,189 @@
+/*
+ *
+ *                This source code is part of
+ *
+ *                 G   R   O   M   A   C   S
+ *
+ *          GROningen MAchine for Chemical Simulations
+ *
+ * Written by David van der Spoel, Erik Lindahl, Berk Hess, and others.
+ * Copyright (c) 1991-2000, University of Groningen, The Netherlands.
+ * Copyright (c) 2001-2009, The GROMACS development team,
+ * check out http://www.gromacs.org for more information.
+
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * If you want to redistribute modifications, please consider that
+ * scientific software is very special. Version control is crucial -
+ * bugs must be traceable. We will be happy to consider code for
+ * inclusion in the official distribution, but derived work must not
+ * be called official GROMACS. Details are found in the README & COPYING
+ * files - if they are missing, get the official version at www.gromacs.org.
+ *
+ * To help us fund GROMACS development, we humbly ask that you cite
+ * the papers on the package - you can find them in the top README file.
+ *
+ * For more info, check our website at http://www.gromacs.org
+ */
+/*! \internal \file
+ * \brief
+ * Tests the trajectory frame index and the start time reads that use it.
+ *
+ * \ingroup module_gmxlib
+ */
+
+#include "config.h"
+
+#ifndef GMX_NATIVE_WINDOWS
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "futil.h"
+#include "trxindex.h"
+
+#include "trajectorytest.h"
+
+namespace
+{
+
+using gmx::test::Frame;
+using gmx::test::ReadPath;
+using gmx::test::plainPath;
+using gmx::test::makeFrame;
+using gmx::test::writeFrames;
+using gmx::test::readTrajectory;
+using gmx::test::compareFrames;
+using gmx::test::compareToWritten;
+using gmx::test::nframes;
+using gmx::test::frameDt;
+using gmx::test::xtcNatoms;
+using gmx::test::trrNatoms;
+using gmx::test::xtcPrec;
+
+class TrajectoryIndexTest : public gmx::test::TrajectoryReadTest
+{
+    public:
+        //! Checks that idx lists the first n written frames.
+        void checkIndex(const t_trxindex *idx, int n)
+        {
+            ASSERT_TRUE(idx != NULL);
+            ASSERT_EQ(n, idx->nframes);
+            for (int f = 0; f < n; f++)
+            {
+                Frame ref;
+                makeFrame(f, 0, &ref);
+                SCOPED_TRACE(testing::Message() << "frame " << f);
+                EXPECT_EQ(ref.step, idx->frame[f].step);
+                EXPECT_FLOAT_EQ(ref.time, idx->frame[f].time);
+                if (f > 0)
+                {
+                    EXPECT_GT(idx->frame[f].offset, idx->frame[f-1].offset);
+                }
+            }
+            EXPECT_GT(idx->end, idx->frame[n-1].offset);
+        }
+
+        //! Builds, caches, re-reads and extends the index of a file.
+        void testRoundTrip(const char *ext, int natoms)
+        {
+            std::string  fn  = write(ext, natoms);
+            std::string  idx = fn + TRXINDEX_EXT;
+            t_trxindex  *first, *cached, *appended;
+
+            first = trxindex_get(fn.c_str());
+            checkIndex(first, nframes);
+            EXPECT_TRUE(gmx_fexist(idx.c_str()));
+
+            cached = trxindex_get(fn.c_str());
+            checkIndex(cached, nframes);
+            EXPECT_EQ(first->end, cached->end);
+            for (int f = 0; f < nframes; f++)
+            {
+                EXPECT_EQ(first->frame[f].offset, cached->frame[f].offset);
+            }
+
+            writeFrames(fn, natoms, nframes, 5, "a");
+            appended = trxindex_get(fn.c_str());
+            checkIndex(appended, nframes + 5);
+            for (int f = 0; f < nframes; f++)
+            {
+                EXPECT_EQ(first->frame[f].offset, appended->frame[f].offset);
+            }
+
+            done_trxindex(first);
+            done_trxindex(cached);
+            done_trxindex(appended);
+        }
+};
+
+TEST_F(TrajectoryIndexTest, WritingAndReadingDoesNotCreateIndex)
+{
+    const ReadPath defaultPath = { NULL, NULL, NULL };
+    std::string    fn          = write(".xtc", xtcNatoms);
+    std::string    idx         = fn + TRXINDEX_EXT;
+
+    EXPECT_FALSE(gmx_fexist(idx.c_str()));
+    compareToWritten(readTrajectory(fn, defaultPath, -1), 0, xtcNatoms,
+                     0.5/xtcPrec + 1e-5);
+    EXPECT_FALSE(gmx_fexist(idx.c_str()));
+}
+
+TEST_F(TrajectoryIndexTest, XtcIndexRoundTrip)
+{
+    testRoundTrip(".xtc", xtcNatoms);
+}
+
+TEST_F(TrajectoryIndexTest, TrrIndexRoundTrip)
+{
+    testRoundTrip(".trr", trrNatoms);
+}
+
+TEST_F(TrajectoryIndexTest, XtcStartTimeMatchesPlainReader)
+{
+    const ReadPath     indexPath     = { "1", NULL, "0" };
+    const ReadPath     allPath       = { NULL, NULL, "2" };
+    const int          f0            = 9;
+    std::string        fn            = write(".xtc", xtcNatoms);
+    std::vector<Frame> ref           = readTrajectory(fn, plainPath, f0*frameDt);
+
+    compareToWritten(ref, f0, xtcNatoms, 0.5/xtcPrec + 1e-5);
+    EXPECT_FALSE(gmx_fexist((fn + TRXINDEX_EXT).c_str()));
+    {
+        SCOPED_TRACE("index");
+        compareFrames(ref, readTrajectory(fn, indexPath, f0*frameDt));
+    }
+    EXPECT_TRUE(gmx_fexist((fn + TRXINDEX_EXT).c_str()));
+    {
+        SCOPED_TRACE("cached index, mmap and read-ahead");
+        compareFrames(ref, readTrajectory(fn, allPath, f0*frameDt));
+    }
+}
+
+TEST_F(TrajectoryIndexTest, TrrStartTimeMatchesPlainReader)
+{
+    const ReadPath     indexPath     = { "1", NULL, "0" };
+    const ReadPath     allPath       = { NULL, NULL, "0" };
+    const int          f0            = 13;
+    std::string        fn            = write(".trr", trrNatoms);
+    std::vector<Frame> ref           = readTrajectory(fn, plainPath, f0*frameDt);
+
+    compareToWritten(ref, f0, trrNatoms, 0);
+    {
+        SCOPED_TRACE("index");
+        compareFrames(ref, readTrajectory(fn, indexPath, f0*frameDt));
+    }
+    {
+        SCOPED_TRACE("index and mmap");
+        compareFrames(ref, readTrajectory(fn, allPath, f0*frameDt));
+    }
+}
+
+} // namespace
+
+#endif
@@ -0,0 +1,75 @@
+/*
+ *
+ *                This source code is part of
+ *
+ *                 G   R   O   M   A   C   S
+ *
+ *          GROningen MAchine for Chemical Simulations
+ *
+ * Written by David van der Spoel, Erik Lindahl, Berk Hess, and others.
+ * Copyright (c) 1991-2000, University of Groningen, The Netherlands.
+ * Copyright (c) 2001-2009, The GROMACS development team,
+ * check out http://www.gromacs.org for more information.
+
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * If you want to redistribute modifications, please consider that
+ * scientific software is very special. Version control is crucial -
+ * bugs must be traceable. We will be happy to consider code for
+ * inclusion in the official distribution, but derived work must not
+ * be called official GROMACS. Details are found in the README & COPYING
+ * files - if they are missing, get the official version at www.gromacs.org.
+ *
+ * To help us fund GROMACS development, we humbly ask that you cite
+ * the papers on the package - you can find them in the top README file.
+ *
+ * For more info, check our website at http://www.gromacs.org
+ */
+/*! \internal \file
+ * \brief
+ * Tests that the xtc read-ahead threads return the same frames as the
+ * plain xdr reader.
+ *
+ * \ingroup module_gmxlib
+ */
+
+#include "config.h"
+
+#ifndef GMX_NATIVE_WINDOWS
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "trajectorytest.h"
+
+namespace
+{
+
+using gmx::test::Frame;
+using gmx::test::ReadPath;
+using gmx::test::plainPath;
+using gmx::test::readTrajectory;
+using gmx::test::compareFrames;
+using gmx::test::compareToWritten;
+using gmx::test::xtcNatoms;
+using gmx::test::xtcPrec;
+
+typedef gmx::test::TrajectoryReadTest TrajectoryReadTest;
+
+TEST_F(TrajectoryReadTest, XtcReadAheadMatchesPlainReader)
+{
+    const ReadPath     readAheadPath = { NULL, "1", "2" };
+    std::string        fn            = write(".xtc", xtcNatoms);
+    std::vector<Frame> ref           = readTrajectory(fn, plainPath, -1);
+
+    compareToWritten(ref, 0, xtcNatoms, 0.5/xtcPrec + 1e-5);
+    compareFrames(ref, readTrajectory(fn, readAheadPath, -1));
+}
+
+} // namespace
+
+#endif
@@ -0,0 +1,271 @@
+/*
+ *
+ *                This source code is part of
+ *
+ *                 G   R   O   M   A   C   S
+ *
+ *          GROningen MAchine for Chemical Simulations
+ *
+ * Written by David van der Spoel, Erik Lindahl, Berk Hess, and others.
+ * Copyright (c) 1991-2000, University of Groningen, The Netherlands.
+ * Copyright (c) 2001-2009, The GROMACS development team,
+ * check out http://www.gromacs.org for more information.
+
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * If you want to redistribute modifications, please consider that
+ * scientific software is very special. Version control is crucial -
+ * bugs must be traceable. We will be happy to consider code for
+ * inclusion in the official distribution, but derived work must not
+ * be called official GROMACS. Details are found in the README & COPYING
+ * files - if they are missing, get the official version at www.gromacs.org.
+ *
+ * To help us fund GROMACS development, we humbly ask that you cite
+ * the papers on the package - you can find them in the top README file.
+ *
+ * For more info, check our website at http://www.gromacs.org
+ */
+/*! \internal \file
+ * \brief
+ * Tests that the memory-mapped trajectory readers return the same frames
+ * as the plain xdr reader, also for truncated files.
+ *
+ * \ingroup module_gmxlib
+ */
+
+#include "config.h"
+
+#ifndef GMX_NATIVE_WINDOWS
+
+#include <string>
+#include <vector>
+
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+#include "statutil.h"
+
+#include "trajectorytest.h"
+
+namespace
+{
+
+using gmx::test::Frame;
+using gmx::test::ReadPath;
+using gmx::test::plainPath;
+using gmx::test::setReadPath;
+using gmx::test::appendFrame;
+using gmx::test::writeFrames;
+using gmx::test::readTrajectory;
+using gmx::test::compareFrames;
+using gmx::test::compareToWritten;
+using gmx::test::nframes;
+using gmx::test::xtcNatoms;
+using gmx::test::trrNatoms;
+using gmx::test::xtcPrec;
+
+//! The memory-mapped reader without read-ahead threads.
+const ReadPath mmapPath      = { NULL, "1", "0" };
+//! The memory-mapped xtc reader with read-ahead threads.
+const ReadPath readAheadPath = { NULL, "1", "2" };
+
+//! Number of complete frames left in truncated files.
+const int      ncomplete     = 10;
+
+//! Returns the size of file fn.
+off_t fileSize(const std::string &fn)
+{
+    struct stat st;
+
+    EXPECT_EQ(0, stat(fn.c_str(), &st));
+    return st.st_size;
+}
+
+class TrajectoryMmapTest : public gmx::test::TrajectoryReadTest
+{
+    public:
+        /*! \brief
+         * Writes nframes frames to a file with extension ext.
+         *
+         * Returns the file name and, in frameEnd, the file size after
+         * the first ncomplete frames.
+         */
+        std::string writeSplit(const char *ext, int natoms, off_t *frameEnd)
+        {
+            std::string fn = fileName(ext);
+
+            writeFrames(fn, natoms, 0, ncomplete, "w");
+            *frameEnd = fileSize(fn);
+            writeFrames(fn, natoms, ncomplete, nframes - ncomplete, "a");
+            return fn;
+        }
+
+        /*! \brief
+         * Checks reading fn truncated at offset bytes into frame ncomplete.
+         *
+         * All readers should return the ncomplete complete frames.
+         */
+        void testTruncated(const std::string &fn, off_t frameEnd, off_t offset,
+                           const std::vector<Frame> &full, bool bXtc)
+        {
+            std::vector<Frame> complete(full.begin(), full.begin() + ncomplete);
+
+            ASSERT_EQ(0, truncate(fn.c_str(), frameEnd + offset));
+            {
+                SCOPED_TRACE("plain");
+                compareFrames(complete, readTrajectory(fn, plainPath, -1));
+            }
+            {
+                SCOPED_TRACE("mmap");
+                compareFrames(complete, readTrajectory(fn, mmapPath, -1));
+            }
+            if (bXtc)
+            {
+                SCOPED_TRACE("read-ahead");
+                compareFrames(complete, readTrajectory(fn, readAheadPath, -1));
+            }
+        }
+
+        /*! \brief
+         * Truncates fn to frameEnd + offset while reading it through path.
+         *
+         * Returns the frames read, reading should stop without crashing.
+         */
+        std::vector<Frame> readWhileTruncating(const std::string &fn,
+                                               const ReadPath &path,
+                                               off_t frameEnd, off_t offset)
+        {
+            output_env_t       oenv;
+            t_trxstatus       *status;
+            t_trxframe         fr;
+            std::vector<Frame> frames;
+
+            setReadPath(&path, -1);
+            output_env_init_default(&oenv);
+            if (read_first_frame(oenv, &status, fn.c_str(), &fr,
+                                 TRX_NEED_X | TRX_READ_V))
+            {
+                do
+                {
+                    appendFrame(&fr, &frames);
+                    if (frames.size() == 2)
+                    {
+                        EXPECT_EQ(0, truncate(fn.c_str(), frameEnd + offset));
+                    }
+                }
+                while (read_next_frame(oenv, status, &fr));
+                close_trx(status);
+            }
+            output_env_done(oenv);
+            setReadPath(NULL, -1);
+
+            return frames;
+        }
+};
+
+TEST_F(TrajectoryMmapTest, XtcMmapMatchesPlainReader)
+{
+    std::string        fn  = write(".xtc", xtcNatoms);
+    std::vector<Frame> ref = readTrajectory(fn, plainPath, -1);
+
+    compareToWritten(ref, 0, xtcNatoms, 0.5/xtcPrec + 1e-5);
+    compareFrames(ref, readTrajectory(fn, mmapPath, -1));
+}
+
+TEST_F(TrajectoryMmapTest, TrrMmapMatchesPlainReader)
+{
+    std::string        fn  = write(".trr", trrNatoms);
+    std::vector<Frame> ref = readTrajectory(fn, plainPath, -1);
+
+    compareToWritten(ref, 0, trrNatoms, 0);
+    compareFrames(ref, readTrajectory(fn, mmapPath, -1));
+}
+
+TEST_F(TrajectoryMmapTest, XtcTruncatedInPayload)
+{
+    off_t              frameEnd;
+    std::string        fn   = writeSplit(".xtc", xtcNatoms, &frameEnd);
+    std::vector<Frame> full = readTrajectory(fn, plainPath, -1);
+
+    ASSERT_EQ(nframes, static_cast<int>(full.size()));
+    testTruncated(fn, frameEnd, 500, full, true);
+}
+
+TEST_F(TrajectoryMmapTest, XtcTruncatedInHeader)
+{
+    off_t              frameEnd;
+    std::string        fn   = writeSplit(".xtc", xtcNatoms, &frameEnd);
+    std::vector<Frame> full = readTrajectory(fn, plainPath, -1);
+
+    ASSERT_EQ(nframes, static_cast<int>(full.size()));
+    testTruncated(fn, frameEnd, 20, full, true);
+}
+
+TEST_F(TrajectoryMmapTest, TrrTruncatedInPayload)
+{
+    off_t              frameEnd;
+    std::string        fn   = writeSplit(".trr", trrNatoms, &frameEnd);
+    std::vector<Frame> full = readTrajectory(fn, plainPath, -1);
+
+    ASSERT_EQ(nframes, static_cast<int>(full.size()));
+    testTruncated(fn, frameEnd, 500, full, false);
+}
+
+TEST_F(TrajectoryMmapTest, TrrTruncatedInHeader)
+{
+    off_t              frameEnd;
+    std::string        fn   = writeSplit(".trr", trrNatoms, &frameEnd);
+    std::vector<Frame> full = readTrajectory(fn, plainPath, -1);
+
+    ASSERT_EQ(nframes, static_cast<int>(full.size()));
+    testTruncated(fn, frameEnd, 20, full, false);
+}
+
+TEST_F(TrajectoryMmapTest, XtcTruncatedWhileReading)
+{
+    off_t              frameEnd;
+    std::string        fn   = writeSplit(".xtc", xtcNatoms, &frameEnd);
+    std::vector<Frame> full = readTrajectory(fn, plainPath, -1);
+    std::vector<Frame> read = readWhileTruncating(fn, mmapPath, frameEnd, 500);
+
+    ASSERT_EQ(nframes, static_cast<int>(full.size()));
+    full.resize(ncomplete);
+    compareFrames(full, read);
+}
+
+TEST_F(TrajectoryMmapTest, XtcReadAheadTruncatedWhileReading)
+{
+    off_t              frameEnd;
+    std::string        fn   = writeSplit(".xtc", xtcNatoms, &frameEnd);
+    std::vector<Frame> full = readTrajectory(fn, plainPath, -1);
+    std::vector<Frame> read = readWhileTruncating(fn, readAheadPath, frameEnd, 500);
+
+    /* Frames decoded ahead before the truncation are still returned */
+    ASSERT_EQ(nframes, static_cast<int>(full.size()));
+    ASSERT_GE(read.size(), static_cast<size_t>(ncomplete));
+    ASSERT_LE(read.size(), full.size());
+    full.resize(read.size());
+    compareFrames(full, read);
+}
+
+TEST_F(TrajectoryMmapTest, TrrTruncatedWhileReading)
+{
+    off_t              frameEnd;
+    std::string        fn   = writeSplit(".trr", trrNatoms, &frameEnd);
+    std::vector<Frame> full = readTrajectory(fn, plainPath, -1);
+    std::vector<Frame> read = readWhileTruncating(fn, mmapPath, frameEnd, 500);
+
+    ASSERT_EQ(nframes, static_cast<int>(full.size()));
+    full.resize(ncomplete);
+    compareFrames(full, read);
+}
+
+} // namespace
+
+#endif
@@ -0,0 +1,241 @@
+/*
+ *
+ *                This source code is part of
+ *
+ *                 G   R   O   M   A   C   S
+ *
+ *          GROningen MAchine for Chemical Simulations
+ *
+ * Written by David van der Spoel, Erik Lindahl, Berk Hess, and others.
+ * Copyright (c) 1991-2000, University of Groningen, The Netherlands.
+ * Copyright (c) 2001-2009, The GROMACS development team,
+ * check out http://www.gromacs.org for more information.
+
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * If you want to redistribute modifications, please consider that
+ * scientific software is very special. Version control is crucial -
+ * bugs must be traceable. We will be happy to consider code for
+ * inclusion in the official distribution, but derived work must not
+ * be called official GROMACS. Details are found in the README & COPYING
+ * files - if they are missing, get the official version at www.gromacs.org.
+ *
+ * To help us fund GROMACS development, we humbly ask that you cite
+ * the papers on the package - you can find them in the top README file.
+ *
+ * For more info, check our website at http://www.gromacs.org
+ */
+/*! \internal \file
+ * \brief
+ * Tests xtc frames written as separately compressed chunks.
+ *
+ * \ingroup module_gmxlib
+ */
+
+#include "config.h"
+
+#ifndef GMX_NATIVE_WINDOWS
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "smalloc.h"
+#include "xtcio.h"
+
+#include "trajectorytest.h"
+
+namespace
+{
+
+using gmx::test::Frame;
+using gmx::test::ReadPath;
+using gmx::test::plainPath;
+using gmx::test::makeFrame;
+using gmx::test::readTrajectory;
+using gmx::test::compareFrames;
+using gmx::test::compareToWritten;
+using gmx::test::nframes;
+using gmx::test::frameDt;
+using gmx::test::xtcNatoms;
+using gmx::test::xtcPrec;
+
+//! Returns the chunk of atom i, spreading the waters as domains would.
+typedef int (*ChunkOfAtom)(int i, int nchunk);
+
+//! Assigns each water to a pseudo-random chunk.
+int waterChunk(int i, int nchunk)
+{
+    return ((i/3)*7919 + (i/3)/11) % nchunk;
+}
+
+/*! \brief
+ * Puts only atoms 10 to 14 in the last chunk and none in the one before.
+ *
+ * The other atoms are assigned as by waterChunk.
+ */
+int smallLastChunk(int i, int nchunk)
+{
+    return (i >= 10 && i < 15) ? nchunk - 1 : waterChunk(i, nchunk - 2);
+}
+
+/*! \brief
+ * Writes nframes frames to fn, each as nchunk chunks.
+ *
+ * The atoms are distributed over the chunks by chunkOf, empty
+ * chunks are left out as mdrun does.
+ */
+void writeChunkedFrames(const std::string &fn, int natoms, int nchunk,
+                        ChunkOfAtom chunkOf)
+{
+    t_fileio *fio = open_xtc(fn.c_str(), "w");
+
+    for (int f = 0; f < nframes; f++)
+    {
+        Frame                      fr;
+        std::vector<unsigned char> chunks;
+        int                        nnonempty = 0;
+
+        makeFrame(f, natoms, &fr);
+        for (int c = 0; c < nchunk; c++)
+        {
+            std::vector<int>  index;
+            std::vector<real> x;
+            unsigned char    *buf    = NULL;
+            int               nalloc = 0;
+
+            for (int i = 0; i < natoms; i++)
+            {
+                if (chunkOf(i, nchunk) == c)
+                {
+                    index.push_back(i);
+                    x.insert(x.end(), &fr.x[i*DIM], &fr.x[i*DIM] + DIM);
+                }
+            }
+            int nbytes = xtc_pack_chunk(index.size(),
+                                        index.empty() ? NULL : &index[0],
+                                        x.empty() ? NULL : (rvec *)&x[0],
+                                        xtcPrec, &buf, &nalloc);
+            EXPECT_EQ(0, nbytes % 4);
+            EXPECT_EQ(index.empty(), nbytes == 0);
+            if (nbytes > 0)
+            {
+                chunks.insert(chunks.end(), buf, buf + nbytes);
+                nnonempty++;
+            }
+            sfree(buf);
+        }
+        EXPECT_TRUE(write_xtc_chunks(fio, natoms, fr.step, fr.time, fr.box,
+                                     xtcPrec, nnonempty, chunks.size(),
+                                     &chunks[0]));
+    }
+    close_xtc(fio);
+}
+
+class XtcChunkTest : public gmx::test::TrajectoryReadTest
+{
+};
+
+TEST_F(XtcChunkTest, ReadersMatchStandardFrames)
+{
+    const ReadPath     mmapPath      = { NULL, "1", "0" };
+    const ReadPath     readAheadPath = { NULL, "1", "2" };
+    std::string        fnStandard    = write(".xtc", xtcNatoms);
+    std::string        fn            = fileName("_chunked.xtc");
+    std::vector<Frame> ref           = readTrajectory(fnStandard, plainPath, -1);
+
+    writeChunkedFrames(fn, xtcNatoms, 5, waterChunk);
+    /* The chunks quantize the coordinates as a standard frame does */
+    {
+        SCOPED_TRACE("plain");
+        compareFrames(ref, readTrajectory(fn, plainPath, -1));
+    }
+    {
+        SCOPED_TRACE("mmap");
+        compareFrames(ref, readTrajectory(fn, mmapPath, -1));
+    }
+    {
+        SCOPED_TRACE("read-ahead");
+        compareFrames(ref, readTrajectory(fn, readAheadPath, -1));
+    }
+}
+
+TEST_F(XtcChunkTest, ReadsSmallAndEmptyChunks)
+{
+    const ReadPath     mmapPath = { NULL, "1", "0" };
+    std::string        fn       = fileName(".xtc");
+    std::vector<Frame> frames;
+
+    /* Chunk 3 of 5 is empty, the last chunk is stored uncompressed */
+    writeChunkedFrames(fn, xtcNatoms, 5, smallLastChunk);
+    frames = readTrajectory(fn, plainPath, -1);
+    compareToWritten(frames, 0, xtcNatoms, 0.5/xtcPrec + 1e-5);
+    compareFrames(frames, readTrajectory(fn, mmapPath, -1));
+}
+
+TEST_F(XtcChunkTest, StartTimeMatchesPlainReader)
+{
+    const ReadPath     indexPath = { "1", NULL, "0" };
+    const ReadPath     allPath   = { NULL, NULL, "2" };
+    const int          f0        = 11;
+    std::string        fn        = fileName(".xtc");
+
+    writeChunkedFrames(fn, xtcNatoms, 3, waterChunk);
+    std::vector<Frame> ref = readTrajectory(fn, plainPath, f0*frameDt);
+    compareToWritten(ref, f0, xtcNatoms, 0.5/xtcPrec + 1e-5);
+    {
+        SCOPED_TRACE("index");
+        compareFrames(ref, readTrajectory(fn, indexPath, f0*frameDt));
+    }
+    {
+        SCOPED_TRACE("index, mmap and read-ahead");
+        compareFrames(ref, readTrajectory(fn, allPath, f0*frameDt));
+    }
+}
+
+TEST_F(XtcChunkTest, RejectsOverlappingChunks)
+{
+    std::string    fn     = fileName(".xtc");
+    Frame          fr;
+    std::vector<int> index;
+    unsigned char *buf    = NULL;
+    int            nalloc = 0;
+    int            natoms, step, nbytes;
+    real           time, prec;
+    matrix         box;
+    rvec          *x;
+    gmx_bool       bOK;
+
+    /* Two copies of the first half of the atoms */
+    makeFrame(0, 100, &fr);
+    for (int i = 0; i < 50; i++)
+    {
+        index.push_back(i);
+    }
+    nbytes = xtc_pack_chunk(50, &index[0], (rvec *)&fr.x[0], xtcPrec,
+                            &buf, &nalloc);
+    ASSERT_GT(nbytes, 0);
+    std::vector<unsigned char> chunks(buf, buf + nbytes);
+    chunks.insert(chunks.end(), buf, buf + nbytes);
+    sfree(buf);
+
+    t_fileio *fio = open_xtc(fn.c_str(), "w");
+    ASSERT_TRUE(write_xtc_chunks(fio, 100, fr.step, fr.time, fr.box, xtcPrec,
+                                 2, chunks.size(), &chunks[0]));
+    close_xtc(fio);
+
+    fio = open_xtc(fn.c_str(), "r");
+    read_first_xtc(fio, &natoms, &step, &time, box, &x, &prec, &bOK);
+    close_xtc(fio);
+    EXPECT_EQ(100, natoms);
+    EXPECT_FALSE(bOK);
+    sfree(x);
+}
+
+} // namespace
+
+#endif
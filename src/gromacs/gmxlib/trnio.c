@@ -276,3 +276,94 @@ void close_trn(t_fileio *fio)
 {
   gmx_fio_close(fio);
 }
+
+gmx_bool mread_trnheader(t_trxmmap *mm,gmx_off_t *pos,t_trnheader *sh,
+                         gmx_bool *bOK)
+{
+  const unsigned char *p;
+  gmx_off_t off;
+  int  len,nflsize,i;
+  int  *sizes[11];
+
+  *bOK = TRUE;
+  off  = *pos;
+
+  if ((p = trxmmap_get(mm,off,sizeof(int))) == NULL ||
+      trxmmap_int(p) != GROMACS_MAGIC)
+    return FALSE;
+  off += sizeof(int);
+
+  /* The version string is stored as the string size including
+   * the terminating zero and an xdr string padded to 4 bytes.
+   */
+  if ((p = trxmmap_get(mm,off,2*sizeof(int))) == NULL) {
+    *bOK = FALSE;
+    return FALSE;
+  }
+  len  = trxmmap_int(p + sizeof(int));
+  off += 2*sizeof(int) + ((len + sizeof(int) - 1)/sizeof(int))*sizeof(int);
+
+  if ((p = trxmmap_get(mm,off,13*sizeof(int))) == NULL) {
+    *bOK = FALSE;
+    return FALSE;
+  }
+  sizes[0]  = &sh->ir_size;
+  sizes[1]  = &sh->e_size;
+  sizes[2]  = &sh->box_size;
+  sizes[3]  = &sh->vir_size;
+  sizes[4]  = &sh->pres_size;
+  sizes[5]  = &sh->top_size;
+  sizes[6]  = &sh->sym_size;
+  sizes[7]  = &sh->x_size;
+  sizes[8]  = &sh->v_size;
+  sizes[9]  = &sh->f_size;
+  sizes[10] = &sh->natoms;
+  for(i=0; i<11; i++)
+    *sizes[i] = trxmmap_int(p + i*sizeof(int));
+  sh->step = trxmmap_int(p + 11*sizeof(int));
+  sh->nre  = trxmmap_int(p + 12*sizeof(int));
+  off += 13*sizeof(int);
+
+  nflsize = nFloatSize(sh);
+  sh->bDouble = (nflsize == sizeof(double));
+  if ((p = trxmmap_get(mm,off,2*nflsize)) == NULL) {
+    *bOK = FALSE;
+    return FALSE;
+  }
+  trxmmap_reals(p,sh->bDouble,1,&sh->t);
+  trxmmap_reals(p + nflsize,sh->bDouble,1,&sh->lambda);
+  off += 2*nflsize;
+
+  *pos = off;
+
+  return TRUE;
+}
+
+gmx_bool mread_htrn(t_trxmmap *mm,gmx_off_t *pos,t_trnheader *sh,
+                    rvec *box,rvec *x,rvec *v,rvec *f)
+{
+  const unsigned char *p;
+
+  p = trxmmap_get(mm,*pos,sh->box_size + sh->vir_size + sh->pres_size +
+                  sh->x_size + sh->v_size + sh->f_size);
+  if (p == NULL)
+    return FALSE;
+
+  /* Decode straight from the mapped file into the caller's buffers */
+  if (sh->box_size != 0 && box)
+    trxmmap_reals(p,sh->bDouble,DIM*DIM,box[0]);
+  p += sh->box_size + sh->vir_size + sh->pres_size;
+  if (sh->x_size != 0 && x)
+    trxmmap_reals(p,sh->bDouble,sh->natoms*DIM,x[0]);
+  p += sh->x_size;
+  if (sh->v_size != 0 && v)
+    trxmmap_reals(p,sh->bDouble,sh->natoms*DIM,v[0]);
+  p += sh->v_size;
+  if (sh->f_size != 0 && f)
+    trxmmap_reals(p,sh->bDouble,sh->natoms*DIM,f[0]);
+
+  *pos += sh->box_size + sh->vir_size + sh->pres_size +
+    sh->x_size + sh->v_size + sh->f_size;
+
+  return TRUE;
+}
@@ -0,0 +1,486 @@
+/*
+ *
+ *                This source code is part of
+ *
+ *                 G   R   O   M   A   C   S
+ *
+ *          GROningen MAchine for Chemical Simulations
+ *
+ * Written by David van der Spoel, Erik Lindahl, Berk Hess, and others.
+ * Copyright (c) 1991-2000, University of Groningen, The Netherlands.
+ * Copyright (c) 2001-2012, The GROMACS development team,
+ * check out http://www.gromacs.org for more information.
+
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * If you want to redistribute modifications, please consider that
+ * scientific software is very special. Version control is crucial -
+ * bugs must be traceable. We will be happy to consider code for
+ * inclusion in the official distribution, but derived work must not
+ * be called official GROMACS. Details are found in the README & COPYING
+ * files - if they are missing, get the official version at www.gromacs.org.
+ *
+ * To help us fund GROMACS development, we humbly ask that you cite
+ * the papers on the package - you can find them in the top README file.
+ *
+ * For more info, check our website at http://www.gromacs.org
+ */
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "typedefs.h"
+#include "smalloc.h"
+#include "gmx_fatal.h"
+#include "futil.h"
+#include "filenm.h"
+#include "gmxfio.h"
+#include "xdrf.h"
+#include "trnio.h"
+#include "trxindex.h"
+
+#define TRXINDEX_MAGIC   2013
+#define TRXINDEX_VERSION 1
+
+/* Must match xtcio.c and libxdrf.c */
+#define XTC_MAGIC       1995
+#define XTC_CHUNK_MAGIC 1996
+#define XDR_INT_SIZE    4
+
+/* The xtc frame header, box and coordinate count, in xdr ints */
+#define XTC_NINT_HEADER  (4 + DIM*DIM + 1)
+/* The compressed coordinate header: precision, minint, maxint,
+ * smallidx and the byte count.
+ */
+#define XTC_NINT_COMPR   (1 + 2*DIM + 1 + 1)
+/* The header of the chunks of a chunked frame: precision, chunk count
+ * and byte count.
+ */
+#define XTC_NINT_CHUNKS  (1 + 1 + 1)
+
+
+gmx_bool trxindex_supported(const char *fn)
+{
+    int ftp;
+
+    ftp = fn2ftp(fn);
+
+    return ((ftp == efXTC || ftp == efTRR) &&
+            getenv("GMX_NO_TRX_INDEX") == NULL);
+}
+
+static char *trxindex_fn(const char *fn)
+{
+    char *fn_idx;
+
+    snew(fn_idx,strlen(fn)+strlen(TRXINDEX_EXT)+1);
+    sprintf(fn_idx,"%s%s",fn,TRXINDEX_EXT);
+
+    return fn_idx;
+}
+
+static t_trxindex *init_trxindex(int ftp)
+{
+    t_trxindex *idx;
+
+    snew(idx,1);
+    idx->ftp     = ftp;
+    idx->nframes = 0;
+    idx->nalloc  = 0;
+    idx->frame   = NULL;
+    idx->end     = 0;
+
+    return idx;
+}
+
+void done_trxindex(t_trxindex *idx)
+{
+    sfree(idx->frame);
+    sfree(idx);
+}
+
+static void trxindex_add(t_trxindex *idx,
+                         gmx_off_t offset,gmx_large_int_t step,double time)
+{
+    t_trxindex_frame *fr;
+
+    if (idx->nframes >= idx->nalloc)
+    {
+        idx->nalloc = over_alloc_large(idx->nframes + 1);
+        srenew(idx->frame,idx->nalloc);
+    }
+    fr = &idx->frame[idx->nframes++];
+    fr->offset = offset;
+    fr->step   = step;
+    fr->time   = time;
+}
+
+/* Reads the xtc frame header at pos and the size of the coordinate data,
+ * without decompressing. Returns FALSE when there is no valid header.
+ */
+static gmx_bool xtc_scan_frame(XDR *xd,gmx_off_t pos,
+                               gmx_large_int_t *step,double *time,
+                               gmx_off_t *end)
+{
+    int   magic,natoms,istep,lsize,idum,nbytes,i;
+    float t,fdum;
+
+    if (!xdr_int(xd,&magic) ||
+        (magic != XTC_MAGIC && magic != XTC_CHUNK_MAGIC) ||
+        !xdr_int(xd,&natoms) || natoms < 0 ||
+        !xdr_int(xd,&istep) ||
+        !xdr_float(xd,&t))
+    {
+        return FALSE;
+    }
+    for(i=0; i<DIM*DIM; i++)
+    {
+        if (!xdr_float(xd,&fdum))
+        {
+            return FALSE;
+        }
+    }
+    if (!xdr_int(xd,&lsize) || lsize != natoms)
+    {
+        return FALSE;
+    }
+    if (magic == XTC_CHUNK_MAGIC)
+    {
+        if (!xdr_float(xd,&fdum) || !xdr_int(xd,&idum) ||
+            !xdr_int(xd,&nbytes) || nbytes < 0)
+        {
+            return FALSE;
+        }
+        *end = pos + (XTC_NINT_HEADER + XTC_NINT_CHUNKS)*XDR_INT_SIZE + nbytes;
+    }
+    else if (natoms <= 9)
+    {
+        /* Small systems are stored uncompressed */
+        *end = pos + (XTC_NINT_HEADER + natoms*DIM)*XDR_INT_SIZE;
+    }
+    else
+    {
+        if (!xdr_float(xd,&fdum))
+        {
+            return FALSE;
+        }
+        for(i=0; i<2*DIM+1; i++)
+        {
+            if (!xdr_int(xd,&idum))
+            {
+                return FALSE;
+            }
+        }
+        if (!xdr_int(xd,&nbytes) || nbytes < 0)
+        {
+            return FALSE;
+        }
+        /* xdr_opaque pads the data to a multiple of 4 bytes */
+        *end = pos + (XTC_NINT_HEADER + XTC_NINT_COMPR)*XDR_INT_SIZE +
+            ((nbytes + XDR_INT_SIZE - 1)/XDR_INT_SIZE)*XDR_INT_SIZE;
+    }
+    *step = istep;
+    *time = t;
+
+    return TRUE;
+}
+
+/* Reads the trr frame header at the current position,
+ * returns FALSE when there is no valid header.
+ */
+static gmx_bool trn_scan_frame(t_fileio *fio,
+                               gmx_large_int_t *step,double *time,
+                               gmx_off_t *end)
+{
+    t_trnheader sh;
+    gmx_bool    bOK;
+
+    if (!fread_trnheader(fio,&sh,&bOK) || !bOK)
+    {
+        return FALSE;
+    }
+    *step = sh.step;
+    *time = sh.t;
+    *end  = gmx_fio_ftell(fio) +
+        sh.box_size + sh.vir_size + sh.pres_size +
+        sh.x_size + sh.v_size + sh.f_size;
+
+    return TRUE;
+}
+
+static gmx_bool trxindex_scan_frame(t_fileio *fio,int ftp,gmx_off_t pos,
+                                    gmx_large_int_t *step,double *time,
+                                    gmx_off_t *end)
+{
+    if (gmx_fio_seek(fio,pos) != 0)
+    {
+        return FALSE;
+    }
+    if (ftp == efXTC)
+    {
+        return xtc_scan_frame(gmx_fio_getxdr(fio),pos,step,time,end);
+    }
+    else
+    {
+        return trn_scan_frame(fio,step,time,end);
+    }
+}
+
+static gmx_off_t trxindex_file_size(t_fileio *fio)
+{
+    FILE *fp;
+
+    fp = gmx_fio_getfp(fio);
+    if (gmx_fseek(fp,0,SEEK_END) != 0)
+    {
+        return -1;
+    }
+
+    return gmx_ftell(fp);
+}
+
+/* Adds the frames of fio starting at idx->end to idx. Stops at the end
+ * of the file or at the first incomplete frame, which might still be
+ * being written. Returns the number of frames added.
+ */
+static int trxindex_scan(t_fileio *fio,t_trxindex *idx,gmx_off_t size)
+{
+    gmx_off_t       pos,end;
+    gmx_large_int_t step;
+    double          time;
+    int             nframes0;
+
+    nframes0 = idx->nframes;
+    pos      = idx->end;
+    while (pos < size &&
+           trxindex_scan_frame(fio,idx->ftp,pos,&step,&time,&end) &&
+           end <= size)
+    {
+        trxindex_add(idx,pos,step,time);
+        idx->end = end;
+        pos      = end;
+    }
+
+    return idx->nframes - nframes0;
+}
+
+/* Drops the frames beyond the end of the file, which mdrun truncates
+ * when it appends from a checkpoint, and checks that the last remaining
+ * frame is still present in fio.
+ */
+static gmx_bool trxindex_check(t_fileio *fio,t_trxindex *idx,gmx_off_t size)
+{
+    const t_trxindex_frame *fr;
+    gmx_large_int_t step;
+    double          time;
+    gmx_off_t       end;
+
+    while (idx->nframes > 0 && idx->end > size)
+    {
+        idx->nframes--;
+        idx->end = idx->frame[idx->nframes].offset;
+    }
+    if (idx->nframes == 0)
+    {
+        idx->end = 0;
+
+        return TRUE;
+    }
+    fr = &idx->frame[idx->nframes-1];
+
+    return (trxindex_scan_frame(fio,idx->ftp,fr->offset,&step,&time,&end) &&
+            step == fr->step && time == fr->time && end == idx->end);
+}
+
+static t_trxindex *trxindex_read(const char *fn_idx,int ftp)
+{
+    FILE            *fp;
+    XDR             xd;
+    t_trxindex      *idx;
+    int             magic,version,ftp_file,nframes,i;
+    gmx_large_int_t offset,step;
+    double          time;
+    gmx_bool        bOK;
+
+    fp = fopen(fn_idx,"rb");
+    if (fp == NULL)
+    {
+        return NULL;
+    }
+    xdrstdio_create(&xd,fp,XDR_DECODE);
+
+    idx = init_trxindex(ftp);
+    bOK = (xdr_int(&xd,&magic) && magic == TRXINDEX_MAGIC &&
+           xdr_int(&xd,&version) && version == TRXINDEX_VERSION &&
+           xdr_int(&xd,&ftp_file) && ftp_file == ftp &&
+           xdr_int(&xd,&nframes) && nframes >= 0 &&
+           xdr_gmx_large_int(&xd,&offset,NULL));
+    if (bOK)
+    {
+        idx->end = offset;
+    }
+    for(i=0; i<nframes && bOK; i++)
+    {
+        bOK = (xdr_gmx_large_int(&xd,&offset,NULL) &&
+               xdr_gmx_large_int(&xd,&step,NULL) &&
+               xdr_double(&xd,&time));
+        if (bOK)
+        {
+            trxindex_add(idx,offset,step,time);
+        }
+    }
+
+    xdr_destroy(&xd);
+    fclose(fp);
+
+    if (!bOK)
+    {
+        if (debug)
+        {
+            fprintf(debug,"Ignoring corrupt trajectory index %s\n",fn_idx);
+        }
+        done_trxindex(idx);
+        idx = NULL;
+    }
+
+    return idx;
+}
+
+static void trxindex_write(const char *fn_idx,const t_trxindex *idx)
+{
+    FILE            *fp;
+    XDR             xd;
+    int             magic,version,ftp,nframes,i;
+    gmx_large_int_t offset,step;
+    double          time;
+    gmx_bool        bOK;
+
+    /* The index is only a cache, so we silently continue
+     * when we can not write it, e.g. in a read-only directory.
+     */
+    fp = fopen(fn_idx,"wb");
+    if (fp == NULL)
+    {
+        if (debug)
+        {
+            fprintf(debug,"Can not write trajectory index %s\n",fn_idx);
+        }
+        return;
+    }
+    xdrstdio_create(&xd,fp,XDR_ENCODE);
+
+    magic   = TRXINDEX_MAGIC;
+    version = TRXINDEX_VERSION;
+    ftp     = idx->ftp;
+    nframes = idx->nframes;
+    offset  = idx->end;
+    bOK = (xdr_int(&xd,&magic) &&
+           xdr_int(&xd,&version) &&
+           xdr_int(&xd,&ftp) &&
+           xdr_int(&xd,&nframes) &&
+           xdr_gmx_large_int(&xd,&offset,NULL));
+    for(i=0; i<nframes && bOK; i++)
+    {
+        offset = idx->frame[i].offset;
+        step   = idx->frame[i].step;
+        time   = idx->frame[i].time;
+        bOK = (xdr_gmx_large_int(&xd,&offset,NULL) &&
+               xdr_gmx_large_int(&xd,&step,NULL) &&
+               xdr_double(&xd,&time));
+    }
+
+    xdr_destroy(&xd);
+    if (fclose(fp) != 0 || !bOK)
+    {
+        /* Do not leave a truncated index behind */
+        remove(fn_idx);
+    }
+}
+
+t_trxindex *trxindex_get(const char *fn)
+{
+    t_fileio   *fio;
+    t_trxindex *idx;
+    char       *fn_idx;
+    gmx_off_t  size;
+    int        nframes;
+    gmx_bool   bChanged;
+
+    if (!trxindex_supported(fn) || !gmx_fexist(fn))
+    {
+        return NULL;
+    }
+
+    fio  = gmx_fio_open(fn,"r");
+    size = trxindex_file_size(fio);
+    if (size < 0)
+    {
+        gmx_fio_close(fio);
+        return NULL;
+    }
+
+    fn_idx   = trxindex_fn(fn);
+    bChanged = FALSE;
+    idx      = trxindex_read(fn_idx,gmx_fio_getftp(fio));
+    if (idx != NULL)
+    {
+        nframes = idx->nframes;
+        if (!trxindex_check(fio,idx,size))
+        {
+            if (debug)
+            {
+                fprintf(debug,"Trajectory index %s does not match %s, "
+                        "rebuilding\n",fn_idx,fn);
+            }
+            done_trxindex(idx);
+            idx = NULL;
+        }
+        else if (idx->nframes < nframes)
+        {
+            bChanged = TRUE;
+        }
+    }
+    if (idx == NULL)
+    {
+        idx      = init_trxindex(gmx_fio_getftp(fio));
+        bChanged = TRUE;
+    }
+    if (trxindex_scan(fio,idx,size) > 0)
+    {
+        bChanged = TRUE;
+    }
+    gmx_fio_close(fio);
+
+    if (bChanged)
+    {
+        trxindex_write(fn_idx,idx);
+    }
+    sfree(fn_idx);
+
+    return idx;
+}
+
+int trxindex_find_time(const t_trxindex *idx,real t)
+{
+    int i;
+
+    /* Frame times need not be monotonic, e.g. after concatenation,
+     * so we do a linear search. This only touches memory.
+     */
+    for(i=0; i<idx->nframes; i++)
+    {
+        if ((real)idx->frame[i].time >= t)
+        {
+            break;
+        }
+    }
+
+    return i;
+}
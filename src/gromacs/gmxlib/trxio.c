@@ -55,6 +55,9 @@
 #include "confio.h"
 #include "checkpoint.h"
 #include "wgms.h"
+#include "trxindex.h"
+#include "trxmmap.h"
+#include "xtcreadahead.h"
 #include <math.h>
 
 /* defines for frame counter output */
@@ -71,11 +74,15 @@ struct t_trxstatus
     t_trxframe *xframe;
     int nxframe;
     t_fileio *fio;
+    t_trxmmap *mm;         /* Mapping of fio for reading xtc/trr, or NULL */
+    t_xtc_readahead *ra;   /* Threads decompressing the next xtc frames */
     eFileFormat eFF;
     int         NATOMS;
     double      DT,BOX[3];
     gmx_bool        bReadBox;
     char *persistent_line; /* Persistent line for reading g96 trajectories */
+    gmx_bool bSeekBegin;   /* Should we try to seek to -b with the index? */
+    gmx_bool bIndexSeek;   /* Did we seek to -b with the frame index?     */
 };
 
 static void initcount(t_trxstatus *status)
@@ -88,8 +95,12 @@ static void status_init(t_trxstatus *status)
     status->nxframe=0;
     status->xframe=NULL;
     status->fio=NULL;
+    status->mm=NULL;
+    status->ra=NULL;
     status->__frame=-1;
     status->persistent_line=NULL;
+    status->bSeekBegin=TRUE;
+    status->bIndexSeek=FALSE;
 }
 
 
@@ -379,6 +390,10 @@ int write_trx(t_trxstatus *status,int nind,const atom_id *ind,t_atoms *atoms,
 
 void close_trx(t_trxstatus *status)
 {
+  if (status->ra)
+    done_xtc_readahead(status->ra);
+  if (status->mm)
+    trxmmap_close(status->mm);
   gmx_fio_close(status->fio);
   sfree(status);
 }
@@ -399,11 +414,23 @@ t_trxstatus *open_trx(const char *outfile,const char *filemode)
 static gmx_bool gmx_next_frame(t_trxstatus *status,t_trxframe *fr)
 {
   t_trnheader sh;
-  gmx_bool bOK,bRet;
+  gmx_bool bOK,bRet,bHeader,bData;
+  gmx_off_t pos=0;
   
   bRet = FALSE;
 
-  if (fread_trnheader(status->fio,&sh,&bOK)) {
+  /* With a mapped file the file position of fio is still used,
+   * so seeking and rewinding work as without mapping.
+   */
+  if (status->mm) {
+    pos = gmx_fio_ftell(status->fio);
+    bHeader = mread_trnheader(status->mm,&pos,&sh,&bOK);
+    if (bHeader)
+      gmx_fio_setprecision(status->fio,sh.bDouble);
+  } else
+    bHeader = fread_trnheader(status->fio,&sh,&bOK);
+
+  if (bHeader) {
     fr->bDouble=sh.bDouble;
     fr->natoms=sh.natoms;
     fr->bStep=TRUE;
@@ -429,7 +456,11 @@ static gmx_bool gmx_next_frame(t_trxstatus *status,t_trxframe *fr)
 	snew(fr->f,sh.natoms);
       fr->bF = sh.f_size>0;
     }
-    if (fread_htrn(status->fio,&sh,fr->box,fr->x,fr->v,fr->f))
+    if (status->mm)
+      bData = mread_htrn(status->mm,&pos,&sh,fr->box,fr->x,fr->v,fr->f);
+    else
+      bData = fread_htrn(status->fio,&sh,fr->box,fr->x,fr->v,fr->f);
+    if (bData)
       bRet = TRUE;
     else
       fr->not_ok = DATA_NOT_OK;
@@ -437,9 +468,37 @@ static gmx_bool gmx_next_frame(t_trxstatus *status,t_trxframe *fr)
     if (!bOK)
       fr->not_ok = HEADER_NOT_OK;
 
+  if (status->mm && bRet)
+    gmx_fio_seek(status->fio,pos);
+
   return bRet;    
 }
 
+static gmx_bool xtc_next_frame(t_trxstatus *status,t_trxframe *fr,
+                               gmx_bool *bOK)
+{
+  gmx_off_t pos;
+  gmx_bool  bRet;
+
+  if (status->ra) {
+    pos  = gmx_fio_ftell(status->fio);
+    bRet = xtc_readahead_read(status->ra,&pos,&fr->step,&fr->time,
+                              fr->box,fr->x,&fr->prec,bOK);
+    if (bRet)
+      gmx_fio_seek(status->fio,pos);
+  } else if (status->mm) {
+    pos  = gmx_fio_ftell(status->fio);
+    bRet = read_next_xtc_mmap(status->mm,&pos,fr->natoms,&fr->step,&fr->time,
+                              fr->box,fr->x,&fr->prec,bOK);
+    if (bRet)
+      gmx_fio_seek(status->fio,pos);
+  } else
+    bRet = read_next_xtc(status->fio,fr->natoms,&fr->step,&fr->time,fr->box,
+                         fr->x,&fr->prec,bOK);
+
+  return bRet;
+}
+
 static void choose_file_format(FILE *fp)
 {
   int i,m,c;
@@ -672,6 +731,44 @@ static int pdb_first_x(t_trxstatus *status, FILE *fp, t_trxframe *fr)
   return fr->natoms;
 }
 
+static void trx_index_seek_begin(t_trxstatus *status,t_trxframe *fr)
+/* Moves the file to the first frame with time >= -b using the frame index,
+ * instead of reading or bisecting over all frames before it.
+ */
+{
+  t_trxindex *idx;
+  gmx_off_t  pos;
+  int        i;
+
+  status->bSeekBegin = FALSE;
+
+  if (!bTimeSet(TBEGIN) ||
+      (fr->natoms > 0 && fr->time >= rTimeValue(TBEGIN)) ||
+      !trxindex_supported(gmx_fio_getname(status->fio)))
+    return;
+
+  idx = trxindex_get(gmx_fio_getname(status->fio));
+  if (idx == NULL)
+    return;
+
+  i = trxindex_find_time(idx,rTimeValue(TBEGIN));
+  pos = (i < idx->nframes) ? idx->frame[i].offset : idx->end;
+  /* Only seek forward, we might have read frames already */
+  if (pos > gmx_fio_ftell(status->fio)) {
+    if (gmx_fio_seek(status->fio,pos) == 0) {
+      initcount(status);
+      status->bIndexSeek = TRUE;
+    }
+  } else {
+    status->bIndexSeek = TRUE;
+  }
+  if (debug)
+    fprintf(debug,"Frame index of %s: %d frames, -b %g is frame %d\n",
+	    gmx_fio_getname(status->fio),idx->nframes,rTimeValue(TBEGIN),i);
+
+  done_trxindex(idx);
+}
+
 gmx_bool read_next_frame(const output_env_t oenv,t_trxstatus *status,t_trxframe *fr)
 {
   real pt;
@@ -682,6 +779,9 @@ gmx_bool read_next_frame(const output_env_t oenv,t_trxstatus *status,t_trxframe
   bRet = FALSE;
   pt=fr->time; 
 
+  if (status->bSeekBegin)
+    trx_index_seek_begin(status,fr);
+
   do {
     clear_trxframe(fr,FALSE);
     fr->tppf = fr->tpf;
@@ -715,15 +815,15 @@ gmx_bool read_next_frame(const output_env_t oenv,t_trxstatus *status,t_trxframe
       /* DvdS 2005-05-31: this has been fixed along with the increased
        * accuracy of the control over -b and -e options.
        */
-        if (bTimeSet(TBEGIN) && (fr->time < rTimeValue(TBEGIN))) {
+        if (!status->bIndexSeek &&
+            bTimeSet(TBEGIN) && (fr->time < rTimeValue(TBEGIN))) {
           if (xtc_seek_time(status->fio, rTimeValue(TBEGIN),fr->natoms,TRUE)) {
             gmx_fatal(FARGS,"Specified frame (time %f) doesn't exist or file corrupt/inconsistent.",
                       rTimeValue(TBEGIN));
             }
             initcount(status);
         }
-      bRet = read_next_xtc(status->fio,fr->natoms,&fr->step,&fr->time,fr->box,
-			   fr->x,&fr->prec,&bOK);
+      bRet = xtc_next_frame(status,fr,&bOK);
       fr->bPrec = (bRet && fr->prec > 0);
       fr->bStep = bRet;
       fr->bTime = bRet;
@@ -803,6 +903,7 @@ int read_first_frame(const output_env_t oenv,t_trxstatus **status,
   {
   case efTRJ:
   case efTRR:
+    (*status)->mm = trxmmap_open(fn);
     break;
   case efCPT:
     read_checkpoint_trxframe(fio,fr);
@@ -854,6 +955,9 @@ int read_first_frame(const output_env_t oenv,t_trxstatus **status,
       fr->bX    = TRUE;
       fr->bBox  = TRUE;
       printcount(*status,oenv,fr->time,FALSE);
+      /* The following frames are read from the mapped file */
+      (*status)->mm = trxmmap_open(fn);
+      (*status)->ra = init_xtc_readahead((*status)->mm,fr->natoms);
     }
     bFirst = FALSE;
     break;
@@ -938,6 +1042,14 @@ gmx_bool read_next_x(const output_env_t oenv, t_trxstatus *status,real *t,
 
 void close_trj(t_trxstatus *status)
 {
+    if (status->ra)
+    {
+        done_xtc_readahead(status->ra);
+    }
+    if (status->mm)
+    {
+        trxmmap_close(status->mm);
+    }
     gmx_fio_close(status->fio);
     /* The memory in status->xframe is lost here,
      * but the read_first_x/read_next_x functions are deprecated anyhow.
@@ -949,6 +1061,8 @@ void close_trj(t_trxstatus *status)
 void rewind_trj(t_trxstatus *status)
 {
   initcount(status);
+  status->bSeekBegin=TRUE;
+  status->bIndexSeek=FALSE;
   
   gmx_fio_rewind(status->fio);
 }
@@ -0,0 +1,209 @@
+/*
+ *
+ *                This source code is part of
+ *
+ *                 G   R   O   M   A   C   S
+ *
+ *          GROningen MAchine for Chemical Simulations
+ *
+ * Written by David van der Spoel, Erik Lindahl, Berk Hess, and others.
+ * Copyright (c) 1991-2000, University of Groningen, The Netherlands.
+ * Copyright (c) 2001-2012, The GROMACS development team,
+ * check out http://www.gromacs.org for more information.
+
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * If you want to redistribute modifications, please consider that
+ * scientific software is very special. Version control is crucial -
+ * bugs must be traceable. We will be happy to consider code for
+ * inclusion in the official distribution, but derived work must not
+ * be called official GROMACS. Details are found in the README & COPYING
+ * files - if they are missing, get the official version at www.gromacs.org.
+ *
+ * To help us fund GROMACS development, we humbly ask that you cite
+ * the papers on the package - you can find them in the top README file.
+ *
+ * For more info, check our website at http://www.gromacs.org
+ */
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifndef GMX_NATIVE_WINDOWS
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+#endif
+
+#include "typedefs.h"
+#include "smalloc.h"
+#include "gmx_fatal.h"
+#include "trxmmap.h"
+
+struct t_trxmmap
+{
+    int            fd;    /* The file descriptor                  */
+    unsigned char *base;  /* Start of the mapping, NULL when empty */
+    gmx_off_t      size;  /* The mapped size, the file size       */
+};
+
+#ifndef GMX_NATIVE_WINDOWS
+
+/* (Re)maps the whole file, returns FALSE on failure */
+static gmx_bool trxmmap_map(t_trxmmap *mm)
+{
+    struct stat st;
+    void        *base;
+
+    if (fstat(mm->fd,&st) != 0)
+    {
+        return FALSE;
+    }
+    if ((gmx_off_t)st.st_size == mm->size && mm->base != NULL)
+    {
+        return TRUE;
+    }
+    /* A file larger than the address space can not be mapped */
+    if ((gmx_off_t)(size_t)st.st_size != (gmx_off_t)st.st_size)
+    {
+        return FALSE;
+    }
+
+    if (mm->base != NULL)
+    {
+        munmap(mm->base,mm->size);
+        mm->base = NULL;
+        mm->size = 0;
+    }
+    if (st.st_size == 0)
+    {
+        return TRUE;
+    }
+
+    base = mmap(NULL,st.st_size,PROT_READ,MAP_PRIVATE,mm->fd,0);
+    if (base == MAP_FAILED)
+    {
+        if (debug)
+        {
+            fprintf(debug,"Can not map trajectory: %s\n",strerror(errno));
+        }
+        return FALSE;
+    }
+#ifdef MADV_SEQUENTIAL
+    madvise(base,st.st_size,MADV_SEQUENTIAL);
+#endif
+    mm->base = (unsigned char *)base;
+    mm->size = st.st_size;
+
+    return TRUE;
+}
+
+t_trxmmap *trxmmap_open(const char *fn)
+{
+    t_trxmmap *mm;
+    int       fd;
+
+    if (getenv("GMX_NO_TRX_MMAP") != NULL)
+    {
+        return NULL;
+    }
+
+    fd = open(fn,O_RDONLY);
+    if (fd < 0)
+    {
+        return NULL;
+    }
+
+    snew(mm,1);
+    mm->fd   = fd;
+    mm->base = NULL;
+    mm->size = 0;
+    if (!trxmmap_map(mm))
+    {
+        trxmmap_close(mm);
+        mm = NULL;
+    }
+
+    return mm;
+}
+
+void trxmmap_close(t_trxmmap *mm)
+{
+    if (mm->base != NULL)
+    {
+        munmap(mm->base,mm->size);
+    }
+    close(mm->fd);
+    sfree(mm);
+}
+
+const unsigned char *trxmmap_get(t_trxmmap *mm,gmx_off_t pos,gmx_off_t n)
+{
+    struct stat st;
+
+    if (pos < 0 || n < 0)
+    {
+        return NULL;
+    }
+    if (pos + n > mm->size)
+    {
+        /* The file might have grown, or shrunk, remap */
+        if (!trxmmap_map(mm) || pos + n > mm->size)
+        {
+            return NULL;
+        }
+    }
+    else if (fstat(mm->fd,&st) != 0 || (gmx_off_t)st.st_size < pos + n)
+    {
+        /* The file was truncated after mapping, reading the pages
+         * beyond the end would raise SIGBUS. We do not remap here,
+         * as read-ahead threads might still use other parts of the
+         * mapping, the next read beyond the mapped size remaps.
+         */
+        return NULL;
+    }
+
+    return mm->base + pos;
+}
+
+gmx_off_t trxmmap_size(const t_trxmmap *mm)
+{
+    return mm->size;
+}
+
+#else
+
+t_trxmmap *trxmmap_open(const char *fn)
+{
+    return NULL;
+}
+
+void trxmmap_close(t_trxmmap *mm)
+{
+    gmx_incons("trxmmap_close called without mapping support");
+}
+
+const unsigned char *trxmmap_get(t_trxmmap *mm,gmx_off_t pos,gmx_off_t n)
+{
+    gmx_incons("trxmmap_get called without mapping support");
+
+    return NULL;
+}
+
+gmx_off_t trxmmap_size(const t_trxmmap *mm)
+{
+    gmx_incons("trxmmap_size called without mapping support");
+
+    return 0;
+}
+
+#endif
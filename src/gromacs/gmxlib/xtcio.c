@@ -45,8 +45,21 @@
 #include "vec.h"
 #include "futil.h"
 #include "gmx_fatal.h"
+#include "trxmmap.h"
 
 #define XTC_MAGIC 1995
+/* Frames written as compressed chunks, see write_xtc_chunks */
+#define XTC_CHUNK_MAGIC 1996
+
+/* The xtc header, box and coordinate count, in bytes */
+#define XTC_HEADER_SIZE ((4 + DIM*DIM + 1)*sizeof(int))
+/* Precision, minint, maxint, smallidx and the byte count, in bytes */
+#define XTC_COMPR_SIZE  ((1 + 2*DIM + 1 + 1)*sizeof(int))
+/* Precision, chunk count and byte count of a chunked frame, in bytes */
+#define XTC_CHUNKS_SIZE ((1 + 1 + 1)*sizeof(int))
+
+/* xdr_opaque pads the data to a multiple of 4 bytes */
+#define XTC_PAD(n) ((((n) + sizeof(int) - 1)/sizeof(int))*sizeof(int))
 
 
 static int xdr_r2f(XDR *xdrs,real *r,gmx_bool bRead)
@@ -80,7 +93,7 @@ void close_xtc(t_fileio *fio)
 
 static void check_xtc_magic(int magic)
 {
-  if (magic != XTC_MAGIC) 
+  if (magic != XTC_MAGIC && magic != XTC_CHUNK_MAGIC) 
     gmx_fatal(FARGS,"Magic Number Error in XTC file (read %d, should be %d)",
 		magic,XTC_MAGIC);
 }
@@ -176,6 +189,271 @@ static int xtc_coord(XDR *xd,int *natoms,matrix box,rvec *x,real *prec, gmx_bool
 
 
 
+/* The atoms of a chunk are stored as runs of consecutive xtc output
+ * indices. Each run is a pair of the gap after the previous run and
+ * the run length, both as base-128 variable length integers.
+ */
+static int xtc_put_varint(unsigned char *p,unsigned int v)
+{
+  int n=0;
+
+  while (v >= 0x80) {
+    p[n++] = (v & 0x7f) | 0x80;
+    v    >>= 7;
+  }
+  p[n++] = v;
+
+  return n;
+}
+
+static gmx_bool xtc_get_varint(const unsigned char *p,int nbytes,int *pos,
+                               unsigned int *v)
+{
+  int shift;
+
+  *v = 0;
+  for(shift=0; shift<32; shift+=7) {
+    if (*pos >= nbytes)
+      return FALSE;
+    *v |= (unsigned int)(p[*pos] & 0x7f) << shift;
+    if (!(p[(*pos)++] & 0x80))
+      return TRUE;
+  }
+
+  return FALSE;
+}
+
+int xtc_pack_chunk(int natoms,const int *index,rvec *x,real prec,
+                   unsigned char **buf,int *nalloc)
+{
+  XDR   xd;
+  int   nalloc_new,nidx,i,start,len,prev_end,nbytes;
+  float fprec,*fx;
+
+  if (natoms == 0)
+    return 0;
+
+  /* The index runs take at most 10 bytes per atom, the compressed
+   * coordinates less than 16 bytes per atom plus the record header.
+   */
+  nalloc_new = 26*natoms + 64;
+  if (nalloc_new > *nalloc) {
+    *nalloc = nalloc_new;
+    srenew(*buf,*nalloc);
+  }
+
+  nidx     = 0;
+  prev_end = 0;
+  for(i=0; i<natoms; i+=len) {
+    start = index[i];
+    if (start < prev_end)
+      gmx_incons("The atoms of an xtc chunk are not in output order");
+    for(len=1; i+len<natoms && index[i+len]==start+len; len++)
+      ;
+    nidx    += xtc_put_varint(*buf + 2*sizeof(int) + nidx,start - prev_end);
+    nidx    += xtc_put_varint(*buf + 2*sizeof(int) + nidx,len);
+    prev_end = start + len;
+  }
+  memset(*buf + 2*sizeof(int) + nidx,0,XTC_PAD(nidx) - nidx);
+
+  xdrmem_create(&xd,(char *)*buf,*nalloc,XDR_ENCODE);
+  if (!xdr_int(&xd,&natoms) || !xdr_int(&xd,&nidx) ||
+      !xdr_setpos(&xd,2*sizeof(int) + XTC_PAD(nidx)))
+    gmx_incons("xtc chunk buffer too small");
+
+#ifdef GMX_DOUBLE
+  snew(fx,natoms*DIM);
+  for(i=0; i<natoms*DIM; i++)
+    fx[i] = x[i/DIM][i%DIM];
+#else
+  fx = x[0];
+#endif
+  fprec = prec;
+  nbytes = (xdr3dfcoord(&xd,fx,&natoms,&fprec) ? xdr_getpos(&xd) : 0);
+#ifdef GMX_DOUBLE
+  sfree(fx);
+#endif
+  xdr_destroy(&xd);
+
+  return nbytes;
+}
+
+/* Decodes the nchunk chunks in the nbytes bytes at p into x, which
+ * has natoms atoms. All atoms should be present exactly once.
+ * Returns FALSE when the data is inconsistent or corrupt.
+ */
+static gmx_bool xtc_unpack_chunks(const unsigned char *p,int nbytes,
+                                  int nchunk,int natoms,rvec *x,real *prec)
+{
+  int   c,off,n,nidx,ipos,cnt,i,d,lsize,minint[DIM],maxint[DIM],smallidx,nb;
+  unsigned int gap,len,start,prev_end;
+  int   *index;
+  float *fx,fprec;
+  gmx_bool bOK,*bSet;
+
+  snew(index,natoms);
+  snew(fx,natoms*DIM);
+  snew(bSet,natoms);
+  bOK = TRUE;
+  off = 0;
+  cnt = 0;
+  for(c=0; c<nchunk && bOK; c++) {
+    /* The atom count and the index runs */
+    bOK = (off + 2*(int)sizeof(int) <= nbytes);
+    if (bOK) {
+      n    = trxmmap_int(p + off);
+      nidx = trxmmap_int(p + off + sizeof(int));
+      off += 2*sizeof(int);
+      bOK  = (n >= 0 && n <= natoms - cnt &&
+              nidx >= 0 && nidx <= nbytes - off &&
+              (int)XTC_PAD(nidx) <= nbytes - off);
+    }
+    ipos     = 0;
+    prev_end = 0;
+    for(i=0; i<n && bOK; ) {
+      bOK = (xtc_get_varint(p + off,nidx,&ipos,&gap) &&
+             xtc_get_varint(p + off,nidx,&ipos,&len) &&
+             len >= 1 && len <= (unsigned int)(n - i) &&
+             gap <= (unsigned int)natoms - prev_end &&
+             len <= (unsigned int)natoms - prev_end - gap);
+      if (bOK) {
+        for(start=prev_end+gap; len>0; len--)
+          index[i++] = start++;
+        prev_end = start;
+      }
+    }
+    if (!bOK)
+      break;
+    off += XTC_PAD(nidx);
+
+    /* The coordinates, as written by xdr3dfcoord */
+    bOK = (off + (int)sizeof(int) <= nbytes);
+    if (bOK) {
+      lsize = trxmmap_int(p + off);
+      off  += sizeof(int);
+      bOK   = (lsize == n);
+    }
+    if (bOK && n <= 9) {
+      /* Small chunks are stored uncompressed */
+      bOK = (n*DIM*(int)sizeof(float) <= nbytes - off);
+      if (bOK) {
+        for(i=0; i<n*DIM; i++)
+          fx[i] = trxmmap_float(p + off + i*sizeof(float));
+        off += n*DIM*sizeof(float);
+      }
+    } else if (bOK) {
+      bOK = ((int)XTC_COMPR_SIZE <= nbytes - off);
+      if (bOK) {
+        fprec = trxmmap_float(p + off);
+        for(d=0; d<DIM; d++) {
+          minint[d] = trxmmap_int(p + off + (1 + d)*sizeof(int));
+          maxint[d] = trxmmap_int(p + off + (1 + DIM + d)*sizeof(int));
+        }
+        smallidx = trxmmap_int(p + off + (1 + 2*DIM)*sizeof(int));
+        nb       = trxmmap_int(p + off + (2 + 2*DIM)*sizeof(int));
+        off     += XTC_COMPR_SIZE;
+        bOK      = (nb >= 0 && nb <= nbytes - off &&
+                    (int)XTC_PAD(nb) <= nbytes - off);
+      }
+      if (bOK) {
+        bOK   = xdr3dfcoord_decompress(p + off,nb,fx,n,fprec,
+                                       minint,maxint,smallidx);
+        off  += XTC_PAD(nb);
+        *prec = fprec;
+      }
+    }
+    for(i=0; i<n && bOK; i++) {
+      /* With overlapping chunks, other atoms would be left unset */
+      bOK = !bSet[index[i]];
+      bSet[index[i]] = TRUE;
+      for(d=0; d<DIM; d++)
+        x[index[i]][d] = fx[i*DIM + d];
+    }
+    cnt += n;
+  }
+  sfree(bSet);
+  sfree(fx);
+  sfree(index);
+
+  return (bOK && cnt == natoms && off == nbytes);
+}
+
+/* Reads the chunked part of a frame, after the header, into x */
+static int xtc_read_chunks(XDR *xd,int natoms,matrix box,rvec *x,real *prec)
+{
+  int  i,j,lsize,nchunk,nbytes,result;
+  real fprec;
+  unsigned char *buf;
+
+  result=1;
+  for(i=0; ((i<DIM) && result); i++)
+    for(j=0; ((j<DIM) && result); j++)
+      result=XTC_CHECK("box",xdr_r2f(xd,&(box[i][j]),TRUE));
+  if (result)
+    result=XTC_CHECK("natoms",xdr_int(xd,&lsize) && lsize == natoms);
+  if (result)
+    result=XTC_CHECK("precision",xdr_r2f(xd,&fprec,TRUE));
+  if (result)
+    result=XTC_CHECK("nchunk",xdr_int(xd,&nchunk) && nchunk >= 0);
+  if (result)
+    result=XTC_CHECK("nbytes",xdr_int(xd,&nbytes) &&
+                     nbytes >= 0 && nbytes % sizeof(int) == 0);
+  if (!result)
+    return result;
+
+  *prec = fprec;
+  snew(buf,nbytes);
+  result=XTC_CHECK("chunks",xdr_opaque(xd,(char *)buf,nbytes));
+  if (result)
+    result=XTC_CHECK("chunks",xtc_unpack_chunks(buf,nbytes,nchunk,natoms,
+                                                x,prec));
+  sfree(buf);
+
+  return result;
+}
+
+int write_xtc_chunks(t_fileio *fio,
+                     int natoms,int step,real time,
+                     matrix box,real prec,
+                     int nchunk,int nbytes,unsigned char *chunks)
+{
+  int magic_number = XTC_CHUNK_MAGIC;
+  XDR *xd;
+  gmx_bool bDum;
+  int i,j,bOK;
+
+  xd = gmx_fio_getxdr(fio);
+  if (xtc_header(xd,&magic_number,&natoms,&step,&time,FALSE,&bDum) == 0)
+  {
+	  return 0;
+  }
+
+  bOK = 1;
+  for(i=0; ((i<DIM) && bOK); i++)
+    for(j=0; ((j<DIM) && bOK); j++)
+      bOK=XTC_CHECK("box",xdr_r2f(xd,&(box[i][j]),FALSE));
+  if (bOK)
+    bOK=XTC_CHECK("natoms",xdr_int(xd,&natoms));
+  if (bOK)
+    bOK=XTC_CHECK("precision",xdr_r2f(xd,&prec,FALSE));
+  if (bOK)
+    bOK=XTC_CHECK("nchunk",xdr_int(xd,&nchunk));
+  if (bOK)
+    bOK=XTC_CHECK("nbytes",xdr_int(xd,&nbytes));
+  if (bOK)
+    bOK=XTC_CHECK("chunks",xdr_opaque(xd,(char *)chunks,nbytes));
+
+  if(bOK)
+  {
+	  if(gmx_fio_flush(fio) !=0)
+	  {
+		  bOK = 0;
+	  }
+  }
+  return bOK;
+}
+
+
 int write_xtc(t_fileio *fio,
 	      int natoms,int step,real time,
 	      matrix box,rvec *x,real prec)
@@ -223,7 +501,10 @@ int read_first_xtc(t_fileio *fio,int *natoms,int *step,real *time,
   
   snew(*x,*natoms);
 
-  *bOK=xtc_coord(xd,natoms,box,*x,prec,TRUE);
+  if (magic == XTC_CHUNK_MAGIC)
+    *bOK=xtc_read_chunks(xd,*natoms,box,*x,prec);
+  else
+    *bOK=xtc_coord(xd,natoms,box,*x,prec,TRUE);
   
   return *bOK;
 }
@@ -251,9 +532,169 @@ int read_next_xtc(t_fileio* fio,
 	      n, natoms);
   }
 
-  *bOK=xtc_coord(xd,&natoms,box,x,prec,TRUE);
+  if (magic == XTC_CHUNK_MAGIC)
+    *bOK=xtc_read_chunks(xd,n,box,x,prec);
+  else
+    *bOK=xtc_coord(xd,&natoms,box,x,prec,TRUE);
 
   return *bOK;
 }
 
+int read_next_xtc_mmap(t_trxmmap *mm,gmx_off_t *pos,
+                       int natoms,int *step,real *time,
+                       matrix box,rvec *x,real *prec,gmx_bool *bOK)
+{
+  const unsigned char *p;
+  gmx_off_t off;
+  int   magic,n,lsize,minint[DIM],maxint[DIM],smallidx,nbytes,npad,nchunk,i,j;
+  float fprec,*fx;
+
+  *bOK = TRUE;
+  off  = *pos;
+
+  /* Without a full magic number we are at the end of the file */
+  if ((p = trxmmap_get(mm,off,sizeof(int))) == NULL)
+    return 0;
+  magic = trxmmap_int(p);
+  check_xtc_magic(magic);
+
+  if ((p = trxmmap_get(mm,off,XTC_HEADER_SIZE)) == NULL) {
+    *bOK = FALSE;
+    return 0;
+  }
+  n     = trxmmap_int(p + 1*sizeof(int));
+  *step = trxmmap_int(p + 2*sizeof(int));
+  *time = trxmmap_float(p + 3*sizeof(int));
+  for(i=0; i<DIM; i++)
+    for(j=0; j<DIM; j++)
+      box[i][j] = trxmmap_float(p + (4 + i*DIM + j)*sizeof(int));
+  lsize = trxmmap_int(p + (4 + DIM*DIM)*sizeof(int));
+  off  += XTC_HEADER_SIZE;
+
+  if (n > natoms) {
+    gmx_fatal(FARGS, "Frame contains more atoms (%d) than expected (%d)", 
+	      n, natoms);
+  }
+  if (lsize != n) {
+    *bOK = FALSE;
+    return 0;
+  }
+
+  if (magic == XTC_CHUNK_MAGIC) {
+    if ((p = trxmmap_get(mm,off,XTC_CHUNKS_SIZE)) == NULL) {
+      *bOK = FALSE;
+      return 0;
+    }
+    *prec  = trxmmap_float(p);
+    nchunk = trxmmap_int(p + sizeof(int));
+    nbytes = trxmmap_int(p + 2*sizeof(int));
+    off   += XTC_CHUNKS_SIZE;
+    if (nchunk < 0 || nbytes < 0 || nbytes % sizeof(int) != 0 ||
+        (p = trxmmap_get(mm,off,nbytes)) == NULL) {
+      *bOK = FALSE;
+      return 0;
+    }
+    *bOK = xtc_unpack_chunks(p,nbytes,nchunk,n,x,prec);
+    if (!*bOK)
+      return 0;
+    *pos = off + nbytes;
+
+    return 1;
+  }
+
+  if (lsize <= 9) {
+    /* Small systems are stored uncompressed */
+    if ((p = trxmmap_get(mm,off,lsize*DIM*sizeof(float))) == NULL) {
+      *bOK = FALSE;
+      return 0;
+    }
+    trxmmap_reals(p,FALSE,lsize*DIM,x[0]);
+    off  += lsize*DIM*sizeof(float);
+    *prec = -1;
+  } else {
+    if ((p = trxmmap_get(mm,off,XTC_COMPR_SIZE)) == NULL) {
+      *bOK = FALSE;
+      return 0;
+    }
+    fprec = trxmmap_float(p);
+    for(i=0; i<DIM; i++) {
+      minint[i] = trxmmap_int(p + (1 + i)*sizeof(int));
+      maxint[i] = trxmmap_int(p + (1 + DIM + i)*sizeof(int));
+    }
+    smallidx = trxmmap_int(p + (1 + 2*DIM)*sizeof(int));
+    nbytes   = trxmmap_int(p + (2 + 2*DIM)*sizeof(int));
+    off     += XTC_COMPR_SIZE;
+    /* The data is padded to a multiple of 4 bytes */
+    npad     = XTC_PAD(nbytes);
+    if (nbytes < 0 || (p = trxmmap_get(mm,off,npad)) == NULL) {
+      *bOK = FALSE;
+      return 0;
+    }
+    off += npad;
+
+    /* Decompress directly into the caller's coordinate buffer */
+#ifdef GMX_DOUBLE
+    snew(fx,lsize*DIM);
+#else
+    fx = x[0];
+#endif
+    *bOK = xdr3dfcoord_decompress(p,nbytes,fx,lsize,fprec,
+                                  minint,maxint,smallidx);
+#ifdef GMX_DOUBLE
+    for(i=0; i<lsize*DIM; i++)
+      x[i/DIM][i%DIM] = fx[i];
+    sfree(fx);
+#endif
+    *prec = fprec;
+    if (!*bOK)
+      return 0;
+  }
+
+  *pos = off;
+
+  return 1;
+}
+
+gmx_off_t xtc_mmap_frame_end(t_trxmmap *mm,gmx_off_t pos,int natoms,
+                             gmx_off_t size)
+{
+  const unsigned char *p;
+  int magic,n,nbytes;
+
+  /* Only use data within size, so nothing is remapped */
+  if (pos < 0 || pos + XTC_HEADER_SIZE > size)
+    return -1;
+  /* NULL when the file was truncated */
+  if ((p = trxmmap_get(mm,pos,XTC_HEADER_SIZE)) == NULL)
+    return -1;
+  magic = trxmmap_int(p);
+  n     = trxmmap_int(p + sizeof(int));
+  if ((magic != XTC_MAGIC && magic != XTC_CHUNK_MAGIC) || n > natoms ||
+      trxmmap_int(p + (4 + DIM*DIM)*sizeof(int)) != n)
+    return -1;
+  pos += XTC_HEADER_SIZE;
 
+  if (magic == XTC_CHUNK_MAGIC) {
+    if (pos + XTC_CHUNKS_SIZE > size)
+      return -1;
+    if ((p = trxmmap_get(mm,pos,XTC_CHUNKS_SIZE)) == NULL)
+      return -1;
+    nbytes = trxmmap_int(p + 2*sizeof(int));
+    if (nbytes < 0)
+      return -1;
+    pos   += XTC_CHUNKS_SIZE + nbytes;
+  } else if (n <= 9) {
+    pos += n*DIM*sizeof(float);
+  } else {
+    if (pos + XTC_COMPR_SIZE > size)
+      return -1;
+    if ((p = trxmmap_get(mm,pos,XTC_COMPR_SIZE)) == NULL)
+      return -1;
+    nbytes = trxmmap_int(p + (2 + 2*DIM)*sizeof(int));
+    if (nbytes < 0)
+      return -1;
+    pos   += XTC_COMPR_SIZE + XTC_PAD(nbytes);
+  }
+
+  return (pos <= size ? pos : -1);
+}
@@ -0,0 +1,320 @@
+/*
+ *
+ *                This source code is part of
+ *
+ *                 G   R   O   M   A   C   S
+ *
+ *          GROningen MAchine for Chemical Simulations
+ *
+ * Written by David van der Spoel, Erik Lindahl, Berk Hess, and others.
+ * Copyright (c) 1991-2000, University of Groningen, The Netherlands.
+ * Copyright (c) 2001-2012, The GROMACS development team,
+ * check out http://www.gromacs.org for more information.
+
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * If you want to redistribute modifications, please consider that
+ * scientific software is very special. Version control is crucial -
+ * bugs must be traceable. We will be happy to consider code for
+ * inclusion in the official distribution, but derived work must not
+ * be called official GROMACS. Details are found in the README & COPYING
+ * files - if they are missing, get the official version at www.gromacs.org.
+ *
+ * To help us fund GROMACS development, we humbly ask that you cite
+ * the papers on the package - you can find them in the top README file.
+ *
+ * For more info, check our website at http://www.gromacs.org
+ */
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "typedefs.h"
+#include "smalloc.h"
+#include "vec.h"
+#include "macros.h"
+#include "gmx_fatal.h"
+#include "xtcio.h"
+#include "xtcreadahead.h"
+#include "thread_mpi/threads.h"
+
+enum { eraEMPTY, eraQUEUED, eraBUSY, eraDONE };
+
+typedef struct
+{
+    int       state;
+    gmx_off_t pos;    /* Offset of the frame                      */
+    gmx_off_t end;    /* Offset after the frame, set when decoded */
+    int       ret;    /* Return value of read_next_xtc_mmap       */
+    gmx_bool  bOK;
+    int       step;
+    real      time;
+    matrix    box;
+    rvec      *x;
+    real      prec;
+} t_xtc_slot;
+
+struct t_xtc_readahead
+{
+    t_trxmmap           *mm;
+    int                 natoms;
+    int                 nslot;
+    t_xtc_slot          *slot;    /* Ring buffer of frames                */
+    int                 first;    /* The slot of the next frame to return */
+    int                 nused;    /* The number of slots in use from first */
+    gmx_off_t           next;     /* Offset of the next frame to queue    */
+    gmx_bool            bFinish;
+    int                 nthreads;
+    tMPI_Thread_t       *thread;
+    tMPI_Thread_mutex_t mutex;
+    tMPI_Thread_cond_t  cond;
+};
+
+static void *xtc_readahead_thread(void *arg)
+{
+    t_xtc_readahead *ra=(t_xtc_readahead *)arg;
+    t_xtc_slot      *s;
+    int             i;
+
+    tMPI_Thread_mutex_lock(&ra->mutex);
+    while (TRUE)
+    {
+        /* Decode the oldest queued frame first */
+        s = NULL;
+        for(i=0; i<ra->nused && s==NULL; i++)
+        {
+            if (ra->slot[(ra->first + i) % ra->nslot].state == eraQUEUED)
+            {
+                s = &ra->slot[(ra->first + i) % ra->nslot];
+            }
+        }
+        if (s == NULL)
+        {
+            if (ra->bFinish)
+            {
+                break;
+            }
+            tMPI_Thread_cond_wait(&ra->cond,&ra->mutex);
+            continue;
+        }
+        s->state = eraBUSY;
+        tMPI_Thread_mutex_unlock(&ra->mutex);
+
+        /* The header has been checked and the frame lies within
+         * the mapping, so this neither remaps nor calls gmx_fatal.
+         */
+        s->end = s->pos;
+        s->ret = read_next_xtc_mmap(ra->mm,&s->end,ra->natoms,&s->step,
+                                    &s->time,s->box,s->x,&s->prec,&s->bOK);
+
+        tMPI_Thread_mutex_lock(&ra->mutex);
+        s->state = eraDONE;
+        tMPI_Thread_cond_broadcast(&ra->cond);
+    }
+    tMPI_Thread_mutex_unlock(&ra->mutex);
+
+    return NULL;
+}
+
+/* Queues frames from ra->next into the free slots, should be called
+ * with the lock held. Stops at the first frame that does not lie
+ * completely within the current mapping.
+ */
+static void xtc_readahead_queue(t_xtc_readahead *ra)
+{
+    gmx_off_t  size,end;
+    t_xtc_slot *s;
+
+    size = trxmmap_size(ra->mm);
+    while (ra->nused < ra->nslot && ra->next >= 0)
+    {
+        end = xtc_mmap_frame_end(ra->mm,ra->next,ra->natoms,size);
+        if (end < 0)
+        {
+            break;
+        }
+        s        = &ra->slot[(ra->first + ra->nused) % ra->nslot];
+        s->state = eraQUEUED;
+        s->pos   = ra->next;
+        ra->next = end;
+        ra->nused++;
+    }
+    tMPI_Thread_cond_broadcast(&ra->cond);
+}
+
+/* Discards all frames, should be called with the lock held */
+static void xtc_readahead_flush(t_xtc_readahead *ra)
+{
+    gmx_bool bBusy;
+    int      i;
+
+    do
+    {
+        bBusy = FALSE;
+        for(i=0; i<ra->nslot; i++)
+        {
+            if (ra->slot[i].state == eraQUEUED)
+            {
+                ra->slot[i].state = eraEMPTY;
+            }
+            bBusy = bBusy || ra->slot[i].state == eraBUSY;
+        }
+        if (bBusy)
+        {
+            tMPI_Thread_cond_wait(&ra->cond,&ra->mutex);
+        }
+    }
+    while (bBusy);
+
+    for(i=0; i<ra->nslot; i++)
+    {
+        ra->slot[i].state = eraEMPTY;
+    }
+    ra->first = 0;
+    ra->nused = 0;
+}
+
+t_xtc_readahead *init_xtc_readahead(t_trxmmap *mm,int natoms)
+{
+    t_xtc_readahead *ra;
+    char            *env;
+    int             nthreads,i;
+
+    nthreads = min(tMPI_Thread_get_hw_number() - 1,XTC_READAHEAD_MAXTHREADS);
+    if ((env = getenv("GMX_XTC_READ_THREADS")) != NULL)
+    {
+        nthreads = strtol(env,NULL,10);
+    }
+    if (mm == NULL || nthreads <= 0 || natoms < XTC_READAHEAD_MINATOMS)
+    {
+        return NULL;
+    }
+    if (debug)
+    {
+        fprintf(debug,"Decompressing xtc frames ahead with %d threads\n",
+                nthreads);
+    }
+
+    snew(ra,1);
+    ra->mm       = mm;
+    ra->natoms   = natoms;
+    /* Keep every thread busy while the caller processes a frame */
+    ra->nslot    = 2*nthreads;
+    snew(ra->slot,ra->nslot);
+    for(i=0; i<ra->nslot; i++)
+    {
+        ra->slot[i].state = eraEMPTY;
+        snew(ra->slot[i].x,natoms);
+    }
+    ra->first    = 0;
+    ra->nused    = 0;
+    ra->next     = -1;
+    ra->bFinish  = FALSE;
+    ra->nthreads = nthreads;
+    snew(ra->thread,nthreads);
+    tMPI_Thread_mutex_init(&ra->mutex);
+    tMPI_Thread_cond_init(&ra->cond);
+    for(i=0; i<nthreads; i++)
+    {
+        if (tMPI_Thread_create(&ra->thread[i],xtc_readahead_thread,ra) != 0)
+        {
+            gmx_fatal(FARGS,"Could not start the xtc read-ahead threads");
+        }
+    }
+
+    return ra;
+}
+
+int xtc_readahead_read(t_xtc_readahead *ra,gmx_off_t *pos,
+                       int *step,real *time,
+                       matrix box,rvec *x,real *prec,gmx_bool *bOK)
+{
+    t_xtc_slot *s;
+    int        ret;
+
+    tMPI_Thread_mutex_lock(&ra->mutex);
+    if (ra->nused > 0 && ra->slot[ra->first].pos != *pos)
+    {
+        /* The caller seeked, restart from the new position */
+        xtc_readahead_flush(ra);
+    }
+    if (ra->nused == 0)
+    {
+        ra->next = *pos;
+        xtc_readahead_queue(ra);
+    }
+    if (ra->nused == 0)
+    {
+        tMPI_Thread_mutex_unlock(&ra->mutex);
+        /* The frame is incomplete, corrupt or not in the mapping yet.
+         * No thread uses the mapping now, so we can read directly,
+         * which remaps when the file has grown.
+         */
+        return read_next_xtc_mmap(ra->mm,pos,ra->natoms,step,time,box,x,
+                                  prec,bOK);
+    }
+
+    s = &ra->slot[ra->first];
+    while (s->state != eraDONE)
+    {
+        tMPI_Thread_cond_wait(&ra->cond,&ra->mutex);
+    }
+    tMPI_Thread_mutex_unlock(&ra->mutex);
+
+    /* The slot stays in use, so the threads leave it alone */
+    ret   = s->ret;
+    *bOK  = s->bOK;
+    *step = s->step;
+    *time = s->time;
+    copy_mat(s->box,box);
+    memcpy(x[0],s->x[0],ra->natoms*sizeof(rvec));
+    *prec = s->prec;
+    if (ret)
+    {
+        *pos = s->end;
+    }
+
+    tMPI_Thread_mutex_lock(&ra->mutex);
+    s->state  = eraEMPTY;
+    ra->first = (ra->first + 1) % ra->nslot;
+    ra->nused--;
+    xtc_readahead_queue(ra);
+    tMPI_Thread_mutex_unlock(&ra->mutex);
+
+    return ret;
+}
+
+void done_xtc_readahead(t_xtc_readahead *ra)
+{
+    int i;
+
+    tMPI_Thread_mutex_lock(&ra->mutex);
+    xtc_readahead_flush(ra);
+    ra->bFinish = TRUE;
+    tMPI_Thread_cond_broadcast(&ra->cond);
+    tMPI_Thread_mutex_unlock(&ra->mutex);
+    for(i=0; i<ra->nthreads; i++)
+    {
+        if (tMPI_Thread_join(ra->thread[i],NULL) != 0)
+        {
+            gmx_fatal(FARGS,"Could not join the xtc read-ahead threads");
+        }
+    }
+    tMPI_Thread_cond_destroy(&ra->cond);
+    tMPI_Thread_mutex_destroy(&ra->mutex);
+
+    for(i=0; i<ra->nslot; i++)
+    {
+        sfree(ra->slot[i].x);
+    }
+    sfree(ra->slot);
+    sfree(ra->thread);
+    sfree(ra);
+}
@@ -308,15 +308,17 @@ static void approx_2dof(real s2,real x,
 static real ener_drift(const verletbuf_atomtype_t *att,int natt,
                        const gmx_ffparams_t *ffp,
                        real kT_fac,
-                       real md_ljd,real md_ljr,real md_el,real dd_el,
+                       real md_ljd,real md_ljr,real md_el,
+                       real dd_ljd,real dd_ljr,real dd_el,
+                       real md3_ljd,real md3_ljr,
                        real r_buffer,
                        real rlist,real boxvol)
 {
-    double drift_tot,pot1,pot2,pot;
+    double drift_tot,pot1,pot2,pot3,pot;
     int    i,j;
     real   s2i,s2j,s2,s;
     int    ti,tj;
-    real   md,dd;
+    real   md,dd,md3;
     real   sc_fac,rsh;
     double c_exp,c_erfc;
 
@@ -342,8 +344,18 @@ static real ener_drift(const verletbuf_atomtype_t *att,int natt,
                 md_ljr*ffp->iparams[ti*ffp->atnr+tj].lj.c12 +
                 md_el*att[i].q*att[j].q;
 
-            /* d2V/dr2 at the cut-off for Coulomb, we neglect LJ */
-            dd = dd_el*att[i].q*att[j].q;
+            /* d2V/dr2 at the cut-off for LJ + Coulomb, for plain cut-off
+             * LJ we neglect it, with a force-switch it is the leading term.
+             */
+            dd =
+                dd_ljd*ffp->iparams[ti*ffp->atnr+tj].lj.c6 +
+                dd_ljr*ffp->iparams[ti*ffp->atnr+tj].lj.c12 +
+                dd_el*att[i].q*att[j].q;
+
+            /* -d3V/dr3 at the cut-off, only non-zero for potential-switched LJ */
+            md3 =
+                md3_ljd*ffp->iparams[ti*ffp->atnr+tj].lj.c6 +
+                md3_ljr*ffp->iparams[ti*ffp->atnr+tj].lj.c12;
 
             s2  = s2i + s2j;
 
@@ -384,14 +396,16 @@ static real ener_drift(const verletbuf_atomtype_t *att,int natt,
                 md/2*((rsh*rsh + s2)*c_erfc - rsh*s*c_exp);
             pot2 = sc_fac*
                 dd/6*(s*(rsh*rsh + 2*s2)*c_exp - rsh*(rsh*rsh + 3*s2)*c_erfc);
-            pot = pot1 + pot2;
+            pot3 = sc_fac*
+                md3/24*((rsh*rsh*rsh*rsh + 6*rsh*rsh*s2 + 3*s2*s2)*c_erfc - rsh*s*(rsh*rsh + 5*s2)*c_exp);
+            pot = pot1 + pot2 + pot3;
 
             if (gmx_debug_at)
             {
-                fprintf(debug,"n %d %d d s %.3f %.3f con %d md %8.1e dd %8.1e pot1 %8.1e pot2 %8.1e pot %8.1e\n",
+                fprintf(debug,"n %d %d d s %.3f %.3f con %d md %8.1e dd %8.1e md3 %8.1e pot1 %8.1e pot2 %8.1e pot3 %8.1e pot %8.1e\n",
                         att[i].n,att[j].n,sqrt(s2i),sqrt(s2j),
                         att[i].con+att[j].con,
-                        md,dd,pot1,pot2,pot);
+                        md,dd,md3,pot1,pot2,pot3,pot);
             }
 
             /* Multiply by the number of atom pairs */
@@ -482,7 +496,7 @@ void calc_verlet_buffer_size(const gmx_mtop_t *mtop,real boxvol,
     verletbuf_atomtype_t *att=NULL;
     int  natt=-1,i;
     double reppow;
-    real md_ljd,md_ljr,md_el,dd_el;
+    real md_ljd,md_ljr,md_el,dd_ljd,dd_ljr,dd_el,md3_ljd,md3_ljr;
     real elfac;
     real kT_fac,mass_min;
     int  ib0,ib1,ib;
@@ -536,9 +550,52 @@ void calc_verlet_buffer_size(const gmx_mtop_t *mtop,real boxvol,
     }
 
     reppow = mtop->ffparams.reppow;
-    md_ljd = 0;
-    md_ljr = 0;
-    if (ir->vdwtype == evdwCUT)
+    md_ljd  = 0;
+    md_ljr  = 0;
+    dd_ljd  = 0;
+    dd_ljr  = 0;
+    md3_ljd = 0;
+    md3_ljr = 0;
+    if (ir->vdwtype == evdwSHIFT ||
+        (ir->vdwtype == evdwCUT && ir->vdw_modifier == eintmodFORCESWITCH))
+    {
+        real rsw,rc,c2,c3;
+        int  p;
+
+        /* The force is zero at the cut-off, the second derivative is not.
+         * With the force switched from rsw, the force/p for r^-p is:
+         * r^-(p+1) + c2*(r-rsw)^2 + c3*(r-rsw)^3
+         */
+        rsw = ir->rvdw_switch;
+        rc  = ir->rvdw;
+        for(p=6; p<=12; p+=6)
+        {
+            c2 =  ((p + 1)*rsw - (p + 4)*rc)/(pow(rc,p + 2)*sqr(rc - rsw));
+            c3 = -((p + 1)*rsw - (p + 3)*rc)/(pow(rc,p + 2)*pow(rc - rsw,3));
+            /* d2V/dr2 = -dF/dr, with the sign of the dispersion term */
+            if (p == 6)
+            {
+                dd_ljd =  p*(-(p + 1)*pow(rc,-(p + 2)) + 2*c2*(rc - rsw) + 3*c3*sqr(rc - rsw));
+            }
+            else
+            {
+                dd_ljr = -p*(-(p + 1)*pow(rc,-(p + 2)) + 2*c2*(rc - rsw) + 3*c3*sqr(rc - rsw));
+            }
+        }
+    }
+    else if (ir->vdwtype == evdwSWITCH ||
+             (ir->vdwtype == evdwCUT && ir->vdw_modifier == eintmodPOTSWITCH))
+    {
+        real sw3;
+
+        /* V, V' and V'' are zero at the cut-off, the third derivative
+         * of the switch function sw(r) is -60/(rc-rsw)^3.
+         */
+        sw3     = -60*pow(ir->rvdw - ir->rvdw_switch,-3.0);
+        md3_ljd = -(-pow(ir->rvdw,-6.0)*sw3);
+        md3_ljr = -(pow(ir->rvdw,-reppow)*sw3);
+    }
+    else if (ir->vdwtype == evdwCUT)
     {
         /* -dV/dr of -r^-6 and r^-repporw */
         md_ljd = -6*pow(ir->rvdw,-7.0);
@@ -547,7 +604,7 @@ void calc_verlet_buffer_size(const gmx_mtop_t *mtop,real boxvol,
     }
     else
     {
-        gmx_fatal(FARGS,"Energy drift calculation is only implemented for plain cut-off Lennard-Jones interactions");
+        gmx_fatal(FARGS,"Energy drift calculation is only implemented for plain cut-off, switched and shifted Lennard-Jones interactions");
     }
 
     elfac = ONE_4PI_EPS0/ir->epsilon_r;
@@ -654,6 +711,8 @@ void calc_verlet_buffer_size(const gmx_mtop_t *mtop,real boxvol,
     if (debug)
     {
         fprintf(debug,"md_ljd %e md_ljr %e\n",md_ljd,md_ljr);
+        fprintf(debug,"dd_ljd %e dd_ljr %e\n",dd_ljd,dd_ljr);
+        fprintf(debug,"md3_ljd %e md3_ljr %e\n",md3_ljd,md3_ljr);
         fprintf(debug,"md_el %e dd_el %e\n",md_el,dd_el);
         fprintf(debug,"sqrt(kT_fac) %f\n",sqrt(kT_fac));
         fprintf(debug,"mass_min %f\n",mass_min);
@@ -674,7 +733,9 @@ void calc_verlet_buffer_size(const gmx_mtop_t *mtop,real boxvol,
          */
         drift = ener_drift(att,natt,&mtop->ffparams,
                            kT_fac,
-                           md_ljd,md_ljr,md_el,dd_el,rb,
+                           md_ljd,md_ljr,md_el,
+                           dd_ljd,dd_ljr,dd_el,
+                           md3_ljd,md3_ljr,rb,
                            rl,boxvol);
 
         /* Correct for the fact that we are using a Ni x Nj particle pair list
@@ -239,6 +239,20 @@ void check_ir(const char *mdparin,t_inputrec *ir, t_gromppopts *opts,
     process_interaction_modifier(ir,&ir->coulomb_modifier);
     process_interaction_modifier(ir,&ir->vdw_modifier);
 
+    if (ir->coulomb_modifier == eintmodFORCESWITCH)
+    {
+        sprintf(warn_buf,"coulomb-modifier = %s is not supported",
+                eintmod_names[eintmodFORCESWITCH]);
+        warning_error(wi,warn_buf);
+    }
+    if (ir->cutoff_scheme == ecutsGROUP &&
+        ir->vdw_modifier == eintmodFORCESWITCH)
+    {
+        sprintf(warn_buf,"vdw-modifier = %s is only supported with cutoff-scheme = %s",
+                eintmod_names[eintmodFORCESWITCH],ecutscheme_names[ecutsVERLET]);
+        warning_error(wi,warn_buf);
+    }
+
     if (ir->cutoff_scheme == ecutsGROUP)
     {
         /* BASIC CUT-OFF STUFF */
@@ -289,13 +303,22 @@ void check_ir(const char *mdparin,t_inputrec *ir, t_gromppopts *opts,
         {
             warning_error(wi,"With Verlet lists only full pbc or pbc=xy with walls is supported");
         }
-        if (ir->rcoulomb != ir->rvdw)
+        if (ir->rcoulomb < ir->rvdw)
         {
-            warning_error(wi,"With Verlet lists rcoulomb!=rvdw is not supported");
+            warning_error(wi,"With Verlet lists rcoulomb<rvdw is not supported");
         }
-        if (ir->vdwtype != evdwCUT)
+        if (!(ir->vdwtype == evdwCUT ||
+              ir->vdwtype == evdwSWITCH || ir->vdwtype == evdwSHIFT))
         {
-            warning_error(wi,"With Verlet lists only cut-off LJ interactions are supported");
+            warning_error(wi,"With Verlet lists only cut-off, switched and shifted LJ interactions are supported");
+        }
+        if (ir->vdwtype != evdwCUT &&
+            !(ir->vdw_modifier == eintmodNONE ||
+              ir->vdw_modifier == eintmodPOTSHIFT))
+        {
+            sprintf(warn_buf,"With Verlet lists and vdwtype = %s, vdw-modifier is ignored",
+                    evdw_names[ir->vdwtype]);
+            warning_note(wi,warn_buf);
         }
         if (!(ir->coulombtype == eelCUT ||
               (EEL_RF(ir->coulombtype) && ir->coulombtype != eelRF_NEC) ||
@@ -966,7 +989,8 @@ void check_ir(const char *mdparin,t_inputrec *ir, t_gromppopts *opts,
   }
 
   if(ir->coulombtype==eelSWITCH || ir->coulombtype==eelSHIFT ||
-     ir->vdwtype==evdwSWITCH || ir->vdwtype==evdwSHIFT)
+     (ir->cutoff_scheme == ecutsGROUP &&
+      (ir->vdwtype==evdwSWITCH || ir->vdwtype==evdwSHIFT)))
   {
       sprintf(warn_buf,
               "The switch/shift interaction settings are just for compatibility; you will get better"
@@ -1024,6 +1048,12 @@ void check_ir(const char *mdparin,t_inputrec *ir, t_gromppopts *opts,
     sprintf(err_buf,"With vdwtype = %s rvdw-switch must be < rvdw. Or, better - use a potential modifier.",
 	    evdw_names[ir->vdwtype]);
     CHECK(ir->rvdw_switch >= ir->rvdw);
+  } else if (ir->vdwtype == evdwCUT &&
+             (ir->vdw_modifier == eintmodPOTSWITCH ||
+              ir->vdw_modifier == eintmodFORCESWITCH)) {
+    sprintf(err_buf,"With vdw-modifier = %s rvdw-switch must be < rvdw",
+            eintmod_names[ir->vdw_modifier]);
+    CHECK(ir->rvdw_switch >= ir->rvdw);
   } else if (ir->vdwtype == evdwCUT) {
       if (ir->cutoff_scheme == ecutsGROUP && ir->vdw_modifier == eintmodNONE) {
           sprintf(err_buf,"With vdwtype = %s, rvdw must be >= rlist unless you use a potential modifier",evdw_names[ir->vdwtype]);
@@ -116,6 +116,26 @@ void setup_dd_grid(FILE *fplog,gmx_domdec_t *dd);
 void dd_collect_vec(gmx_domdec_t *dd,
                            t_state *state_local,rvec *lv,rvec *v);
 
+void dd_collect_xtc(gmx_domdec_t *dd,
+                           t_state *state_local,gmx_groups_t *groups,
+                           rvec *x_xtc);
+/* Collects only the coordinates of the atoms in the xtc output group
+ * on the master, in xtc output order in x_xtc. Each node selects its
+ * own home atoms of the group, so the communication volume and the
+ * master work scale with the size of the group, not of the system.
+ */
+
+void dd_collect_xtc_chunks(gmx_domdec_t *dd,
+                           t_state *state_local,gmx_groups_t *groups,
+                           real prec,int *nchunk,int *nbytes,
+                           unsigned char **chunks,int *chunks_nalloc);
+/* Each node compresses the coordinates of its home atoms in the xtc
+ * output group into an xtc chunk. The master collects the nchunk
+ * chunks of in total nbytes bytes in *chunks, which is reallocated as
+ * needed, for write_xtc_chunks. The compression runs in parallel and
+ * the master never holds the uncompressed coordinates.
+ */
+
 void dd_collect_state(gmx_domdec_t *dd,
                              t_state *state_local,t_state *state);
 
@@ -135,6 +155,14 @@ float dd_pme_f_ratio(gmx_domdec_t *dd);
  * Should only be called on the DD master node.
  */
 
+void dd_check_npme_start(gmx_domdec_t *dd);
+/* Start measuring the PME/PP force load over the next partitionings.
+ * At the end of the measurement the DD master node notes in the log file
+ * and on stderr when a different number of PME only nodes would be faster.
+ * This only reports, the PP/PME node division is not changed.
+ * Should be called on all PP nodes at the same step.
+ */
+
 void dd_move_x(gmx_domdec_t *dd,matrix box,rvec x[]);
 /* Communicate the coordinates to the neighboring cells and do pbc. */
 
@@ -278,6 +306,13 @@ real dd_choose_grid(FILE *fplog,
  * On the master node returns the actual cellsize limit used.
  */
 
+int dd_npme_from_load(FILE *fplog,gmx_mtop_t *mtop,t_inputrec *ir,matrix box,
+                      int nnodes,int npme,float pme_f_ratio);
+/* Returns the number of separate PME nodes out of nnodes that balances
+ * the PME mesh/force load ratio pme_f_ratio measured with npme PME nodes,
+ * 0 when all nodes should do PME, -1 when no suitable number is found.
+ */
+
 
 /* In domdec_box.c */
 
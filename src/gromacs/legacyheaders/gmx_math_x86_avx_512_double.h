@@ -0,0 +1,196 @@
+/* -*- mode: c; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4; c-file-style: "stroustrup"; -*-
+ *
+ *
+ * This file is part of GROMACS.
+ * Copyright (c) 2012-
+ *
+ * Written by the Gromacs development team under coordination of
+ * David van der Spoel, Berk Hess, and Erik Lindahl.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * To help us fund GROMACS development, we humbly ask that you cite
+ * the research papers on the package. Check out http://www.gromacs.org
+ *
+ * And Hey:
+ * Gnomes, ROck Monsters And Chili Sauce
+ */
+#ifndef _gmx_math_x86_avx_512_double_h_
+#define _gmx_math_x86_avx_512_double_h_
+
+#include "gmx_x86_avx_512.h"
+#include "gmx_math_x86_avx_256_double.h"
+
+
+/* Only the routines needed by the nbnxn kernels are available
+ * in 512-bit width, all others can be found in the 256-bit header.
+ */
+
+/* 1.0/sqrt(x), 512 bit wide.
+ * AVX-512 has a double precision lookup with 14 bits accuracy,
+ * two N-R steps give full double precision.
+ */
+static gmx_inline __m512d
+gmx_mm512_invsqrt_pd(__m512d x)
+{
+    const __m512d half  = _mm512_set1_pd(0.5);
+    const __m512d three = _mm512_set1_pd(3.0);
+
+    __m512d lu = _mm512_rsqrt14_pd(x);
+
+    lu = _mm512_mul_pd(half,_mm512_mul_pd(_mm512_sub_pd(three,_mm512_mul_pd(_mm512_mul_pd(lu,lu),x)),lu));
+    return _mm512_mul_pd(half,_mm512_mul_pd(_mm512_sub_pd(three,_mm512_mul_pd(_mm512_mul_pd(lu,lu),x)),lu));
+}
+
+/* 1.0/x, 512 bit wide */
+static gmx_inline __m512d
+gmx_mm512_inv_pd(__m512d x)
+{
+    const __m512d two  = _mm512_set1_pd(2.0);
+
+    __m512d lu = _mm512_rcp14_pd(x);
+
+    /* Perform two N-R steps for double precision */
+    lu         = _mm512_mul_pd(lu,_mm512_sub_pd(two,_mm512_mul_pd(x,lu)));
+    return _mm512_mul_pd(lu,_mm512_sub_pd(two,_mm512_mul_pd(x,lu)));
+}
+
+
+/* Calculate the force correction due to PME analytically, 512-bit wide.
+ *
+ * See gmx_mm256_pmecorrF_ps() for details about the approximation.
+ */
+static __m512d
+gmx_mm512_pmecorrF_pd(__m512d z2)
+{
+    const __m512d  FN10     = _mm512_set1_pd(-8.0072854618360083154e-14);
+    const __m512d  FN9      = _mm512_set1_pd(1.1859116242260148027e-11);
+    const __m512d  FN8      = _mm512_set1_pd(-8.1490406329798423616e-10);
+    const __m512d  FN7      = _mm512_set1_pd(3.4404793543907847655e-8);
+    const __m512d  FN6      = _mm512_set1_pd(-9.9471420832602741006e-7);
+    const __m512d  FN5      = _mm512_set1_pd(0.000020740315999115847456);
+    const __m512d  FN4      = _mm512_set1_pd(-0.00031991745139313364005);
+    const __m512d  FN3      = _mm512_set1_pd(0.0035074449373659008203);
+    const __m512d  FN2      = _mm512_set1_pd(-0.031750380176100813405);
+    const __m512d  FN1      = _mm512_set1_pd(0.13884101728898463426);
+    const __m512d  FN0      = _mm512_set1_pd(-0.75225277815249618847);
+
+    const __m512d  FD5      = _mm512_set1_pd(0.000016009278224355026701);
+    const __m512d  FD4      = _mm512_set1_pd(0.00051055686934806966046);
+    const __m512d  FD3      = _mm512_set1_pd(0.0081803507497974289008);
+    const __m512d  FD2      = _mm512_set1_pd(0.077181146026670287235);
+    const __m512d  FD1      = _mm512_set1_pd(0.41543303143712535988);
+    const __m512d  FD0      = _mm512_set1_pd(1.0);
+
+    __m512d z4;
+    __m512d polyFN0,polyFN1,polyFD0,polyFD1;
+
+    z4             = _mm512_mul_pd(z2,z2);
+
+    polyFD1        = _mm512_mul_pd(FD5,z4);
+    polyFD0        = _mm512_mul_pd(FD4,z4);
+    polyFD1        = _mm512_add_pd(polyFD1,FD3);
+    polyFD0        = _mm512_add_pd(polyFD0,FD2);
+    polyFD1        = _mm512_mul_pd(polyFD1,z4);
+    polyFD0        = _mm512_mul_pd(polyFD0,z4);
+    polyFD1        = _mm512_add_pd(polyFD1,FD1);
+    polyFD0        = _mm512_add_pd(polyFD0,FD0);
+    polyFD1        = _mm512_mul_pd(polyFD1,z2);
+    polyFD0        = _mm512_add_pd(polyFD0,polyFD1);
+
+    polyFD0        = gmx_mm512_inv_pd(polyFD0);
+
+    polyFN0        = _mm512_mul_pd(FN10,z4);
+    polyFN1        = _mm512_mul_pd(FN9,z4);
+    polyFN0        = _mm512_add_pd(polyFN0,FN8);
+    polyFN1        = _mm512_add_pd(polyFN1,FN7);
+    polyFN0        = _mm512_mul_pd(polyFN0,z4);
+    polyFN1        = _mm512_mul_pd(polyFN1,z4);
+    polyFN0        = _mm512_add_pd(polyFN0,FN6);
+    polyFN1        = _mm512_add_pd(polyFN1,FN5);
+    polyFN0        = _mm512_mul_pd(polyFN0,z4);
+    polyFN1        = _mm512_mul_pd(polyFN1,z4);
+    polyFN0        = _mm512_add_pd(polyFN0,FN4);
+    polyFN1        = _mm512_add_pd(polyFN1,FN3);
+    polyFN0        = _mm512_mul_pd(polyFN0,z4);
+    polyFN1        = _mm512_mul_pd(polyFN1,z4);
+    polyFN0        = _mm512_add_pd(polyFN0,FN2);
+    polyFN1        = _mm512_add_pd(polyFN1,FN1);
+    polyFN0        = _mm512_mul_pd(polyFN0,z4);
+    polyFN1        = _mm512_mul_pd(polyFN1,z2);
+    polyFN0        = _mm512_add_pd(polyFN0,FN0);
+    polyFN0        = _mm512_add_pd(polyFN0,polyFN1);
+
+    return   _mm512_mul_pd(polyFN0,polyFD0);
+}
+
+
+/* Calculate the potential correction due to PME analytically, 512-bit wide.
+ *
+ * See gmx_mm256_pmecorrV_pd() for details about the approximation.
+ */
+static __m512d
+gmx_mm512_pmecorrV_pd(__m512d z2)
+{
+    const __m512d  VN9      = _mm512_set1_pd(-9.3723776169321855475e-13);
+    const __m512d  VN8      = _mm512_set1_pd(1.2280156762674215741e-10);
+    const __m512d  VN7      = _mm512_set1_pd(-7.3562157912251309487e-9);
+    const __m512d  VN6      = _mm512_set1_pd(2.6215886208032517509e-7);
+    const __m512d  VN5      = _mm512_set1_pd(-4.9532491651265819499e-6);
+    const __m512d  VN4      = _mm512_set1_pd(0.00025907400778966060389);
+    const __m512d  VN3      = _mm512_set1_pd(0.0010585044856156469792);
+    const __m512d  VN2      = _mm512_set1_pd(0.045247661136833092885);
+    const __m512d  VN1      = _mm512_set1_pd(0.11643931522926034421);
+    const __m512d  VN0      = _mm512_set1_pd(1.1283791671726767970);
+
+    const __m512d  VD5      = _mm512_set1_pd(0.000021784709867336150342);
+    const __m512d  VD4      = _mm512_set1_pd(0.00064293662010911388448);
+    const __m512d  VD3      = _mm512_set1_pd(0.0096311444822588683504);
+    const __m512d  VD2      = _mm512_set1_pd(0.085608012351550627051);
+    const __m512d  VD1      = _mm512_set1_pd(0.43652499166614811084);
+    const __m512d  VD0      = _mm512_set1_pd(1.0);
+
+    __m512d z4;
+    __m512d polyVN0,polyVN1,polyVD0,polyVD1;
+
+    z4             = _mm512_mul_pd(z2,z2);
+
+    polyVD1        = _mm512_mul_pd(VD5,z4);
+    polyVD0        = _mm512_mul_pd(VD4,z4);
+    polyVD1        = _mm512_add_pd(polyVD1,VD3);
+    polyVD0        = _mm512_add_pd(polyVD0,VD2);
+    polyVD1        = _mm512_mul_pd(polyVD1,z4);
+    polyVD0        = _mm512_mul_pd(polyVD0,z4);
+    polyVD1        = _mm512_add_pd(polyVD1,VD1);
+    polyVD0        = _mm512_add_pd(polyVD0,VD0);
+    polyVD1        = _mm512_mul_pd(polyVD1,z2);
+    polyVD0        = _mm512_add_pd(polyVD0,polyVD1);
+
+    polyVD0        = gmx_mm512_inv_pd(polyVD0);
+
+    polyVN1        = _mm512_mul_pd(VN9,z4);
+    polyVN0        = _mm512_mul_pd(VN8,z4);
+    polyVN1        = _mm512_add_pd(polyVN1,VN7);
+    polyVN0        = _mm512_add_pd(polyVN0,VN6);
+    polyVN1        = _mm512_mul_pd(polyVN1,z4);
+    polyVN0        = _mm512_mul_pd(polyVN0,z4);
+    polyVN1        = _mm512_add_pd(polyVN1,VN5);
+    polyVN0        = _mm512_add_pd(polyVN0,VN4);
+    polyVN1        = _mm512_mul_pd(polyVN1,z4);
+    polyVN0        = _mm512_mul_pd(polyVN0,z4);
+    polyVN1        = _mm512_add_pd(polyVN1,VN3);
+    polyVN0        = _mm512_add_pd(polyVN0,VN2);
+    polyVN1        = _mm512_mul_pd(polyVN1,z4);
+    polyVN0        = _mm512_mul_pd(polyVN0,z4);
+    polyVN1        = _mm512_add_pd(polyVN1,VN1);
+    polyVN0        = _mm512_add_pd(polyVN0,VN0);
+    polyVN1        = _mm512_mul_pd(polyVN1,z2);
+    polyVN0        = _mm512_add_pd(polyVN0,polyVN1);
+
+    return   _mm512_mul_pd(polyVN0,polyVD0);
+}
+
+#endif /* _gmx_math_x86_avx_512_double_h_ */
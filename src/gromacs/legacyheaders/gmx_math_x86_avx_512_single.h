@@ -0,0 +1,162 @@
+/* -*- mode: c; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4; c-file-style: "stroustrup"; -*-
+ *
+ *
+ * This file is part of GROMACS.
+ * Copyright (c) 2012-
+ *
+ * Written by the Gromacs development team under coordination of
+ * David van der Spoel, Berk Hess, and Erik Lindahl.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * To help us fund GROMACS development, we humbly ask that you cite
+ * the research papers on the package. Check out http://www.gromacs.org
+ *
+ * And Hey:
+ * Gnomes, ROck Monsters And Chili Sauce
+ */
+#ifndef _gmx_math_x86_avx_512_single_h_
+#define _gmx_math_x86_avx_512_single_h_
+
+#include "gmx_x86_avx_512.h"
+#include "gmx_math_x86_avx_256_single.h"
+
+
+/* Only the routines needed by the nbnxn kernels are available
+ * in 512-bit width, all others can be found in the 256-bit header.
+ */
+
+/* 1.0/sqrt(x), 512-bit wide version.
+ * The AVX-512 lookup has 14 bits accuracy, one N-R step is sufficient.
+ */
+static gmx_inline __m512
+gmx_mm512_invsqrt_ps(__m512 x)
+{
+    const __m512 half  = _mm512_set1_ps(0.5f);
+    const __m512 three = _mm512_set1_ps(3.0f);
+
+    __m512 lu = _mm512_rsqrt14_ps(x);
+
+    return _mm512_mul_ps(half,_mm512_mul_ps(_mm512_sub_ps(three,_mm512_mul_ps(_mm512_mul_ps(lu,lu),x)),lu));
+}
+
+/* 1.0/x, 512-bit wide */
+static gmx_inline __m512
+gmx_mm512_inv_ps(__m512 x)
+{
+    const __m512 two = _mm512_set1_ps(2.0f);
+
+    __m512 lu = _mm512_rcp14_ps(x);
+
+    return _mm512_mul_ps(lu,_mm512_sub_ps(two,_mm512_mul_ps(lu,x)));
+}
+
+
+/* Calculate the force correction due to PME analytically, 512-bit wide.
+ *
+ * See gmx_mm256_pmecorrF_ps() for details about the approximation.
+ */
+static __m512
+gmx_mm512_pmecorrF_ps(__m512 z2)
+{
+    const __m512  FN6      = _mm512_set1_ps(-1.7357322914161492954e-8f);
+    const __m512  FN5      = _mm512_set1_ps(1.4703624142580877519e-6f);
+    const __m512  FN4      = _mm512_set1_ps(-0.000053401640219807709149f);
+    const __m512  FN3      = _mm512_set1_ps(0.0010054721316683106153f);
+    const __m512  FN2      = _mm512_set1_ps(-0.019278317264888380590f);
+    const __m512  FN1      = _mm512_set1_ps(0.069670166153766424023f);
+    const __m512  FN0      = _mm512_set1_ps(-0.75225204789749321333f);
+
+    const __m512  FD4      = _mm512_set1_ps(0.0011193462567257629232f);
+    const __m512  FD3      = _mm512_set1_ps(0.014866955030185295499f);
+    const __m512  FD2      = _mm512_set1_ps(0.11583842382862377919f);
+    const __m512  FD1      = _mm512_set1_ps(0.50736591960530292870f);
+    const __m512  FD0      = _mm512_set1_ps(1.0f);
+
+    __m512 z4;
+    __m512 polyFN0,polyFN1,polyFD0,polyFD1;
+
+    z4             = _mm512_mul_ps(z2,z2);
+
+    polyFD0        = _mm512_mul_ps(FD4,z4);
+    polyFD1        = _mm512_mul_ps(FD3,z4);
+    polyFD0        = _mm512_add_ps(polyFD0,FD2);
+    polyFD1        = _mm512_add_ps(polyFD1,FD1);
+    polyFD0        = _mm512_mul_ps(polyFD0,z4);
+    polyFD1        = _mm512_mul_ps(polyFD1,z2);
+    polyFD0        = _mm512_add_ps(polyFD0,FD0);
+    polyFD0        = _mm512_add_ps(polyFD0,polyFD1);
+
+    polyFD0        = gmx_mm512_inv_ps(polyFD0);
+
+    polyFN0        = _mm512_mul_ps(FN6,z4);
+    polyFN1        = _mm512_mul_ps(FN5,z4);
+    polyFN0        = _mm512_add_ps(polyFN0,FN4);
+    polyFN1        = _mm512_add_ps(polyFN1,FN3);
+    polyFN0        = _mm512_mul_ps(polyFN0,z4);
+    polyFN1        = _mm512_mul_ps(polyFN1,z4);
+    polyFN0        = _mm512_add_ps(polyFN0,FN2);
+    polyFN1        = _mm512_add_ps(polyFN1,FN1);
+    polyFN0        = _mm512_mul_ps(polyFN0,z4);
+    polyFN1        = _mm512_mul_ps(polyFN1,z2);
+    polyFN0        = _mm512_add_ps(polyFN0,FN0);
+    polyFN0        = _mm512_add_ps(polyFN0,polyFN1);
+
+    return   _mm512_mul_ps(polyFN0,polyFD0);
+}
+
+
+/* Calculate the potential correction due to PME analytically, 512-bit wide.
+ *
+ * See gmx_mm256_pmecorrV_ps() for details about the approximation.
+ */
+static __m512
+gmx_mm512_pmecorrV_ps(__m512 z2)
+{
+    const __m512  VN6      = _mm512_set1_ps(1.9296833005951166339e-8f);
+    const __m512  VN5      = _mm512_set1_ps(-1.4213390571557850962e-6f);
+    const __m512  VN4      = _mm512_set1_ps(0.000041603292906656984871f);
+    const __m512  VN3      = _mm512_set1_ps(-0.00013134036773265025626f);
+    const __m512  VN2      = _mm512_set1_ps(0.038657983986041781264f);
+    const __m512  VN1      = _mm512_set1_ps(0.11285044772717598220f);
+    const __m512  VN0      = _mm512_set1_ps(1.1283802385263030286f);
+
+    const __m512  VD3      = _mm512_set1_ps(0.0066752224023576045451f);
+    const __m512  VD2      = _mm512_set1_ps(0.078647795836373922256f);
+    const __m512  VD1      = _mm512_set1_ps(0.43336185284710920150f);
+    const __m512  VD0      = _mm512_set1_ps(1.0f);
+
+    __m512 z4;
+    __m512 polyVN0,polyVN1,polyVD0,polyVD1;
+
+    z4             = _mm512_mul_ps(z2,z2);
+
+    polyVD1        = _mm512_mul_ps(VD3,z4);
+    polyVD0        = _mm512_mul_ps(VD2,z4);
+    polyVD1        = _mm512_add_ps(polyVD1,VD1);
+    polyVD0        = _mm512_add_ps(polyVD0,VD0);
+    polyVD1        = _mm512_mul_ps(polyVD1,z2);
+    polyVD0        = _mm512_add_ps(polyVD0,polyVD1);
+
+    polyVD0        = gmx_mm512_inv_ps(polyVD0);
+
+    polyVN0        = _mm512_mul_ps(VN6,z4);
+    polyVN1        = _mm512_mul_ps(VN5,z4);
+    polyVN0        = _mm512_add_ps(polyVN0,VN4);
+    polyVN1        = _mm512_add_ps(polyVN1,VN3);
+    polyVN0        = _mm512_mul_ps(polyVN0,z4);
+    polyVN1        = _mm512_mul_ps(polyVN1,z4);
+    polyVN0        = _mm512_add_ps(polyVN0,VN2);
+    polyVN1        = _mm512_add_ps(polyVN1,VN1);
+    polyVN0        = _mm512_mul_ps(polyVN0,z4);
+    polyVN1        = _mm512_mul_ps(polyVN1,z2);
+    polyVN0        = _mm512_add_ps(polyVN0,VN0);
+    polyVN0        = _mm512_add_ps(polyVN0,polyVN1);
+
+    return   _mm512_mul_ps(polyVN0,polyVD0);
+}
+
+#endif /* _gmx_math_x86_avx_512_single_h_ */
@@ -35,6 +35,10 @@
  * used whenever OpenMP API functions are needed.
  */
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 /*! Returns an integer equal to or greater than the number of threads
  *  that would be available if a parallel region without num_threads were
  *  defined at that point in the code. Acts as a wrapper for omp_set_num_threads(void). */
@@ -56,4 +60,8 @@ void gmx_omp_set_num_threads(int num_threads);
 void gmx_omp_check_thread_affinity(FILE *fplog, const t_commrec *cr,
                                    gmx_hw_opt_t *hw_opt);
 
+#ifdef __cplusplus
+}
+#endif
+
 #endif /* GMX_OMP_H */
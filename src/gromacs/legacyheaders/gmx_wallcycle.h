@@ -50,6 +50,7 @@ enum { ewcRUN, ewcSTEP, ewcPPDURINGPME, ewcDOMDEC, ewcDDCOMMLOAD,
        ewcPME_REDISTXF, ewcPME_SPREADGATHER, ewcPME_FFT, ewcPME_FFTCOMM, ewcPME_SOLVE,
        ewcPMEWAITCOMM, ewcPP_PMEWAITRECVF, ewcWAIT_GPU_NB_NL, ewcWAIT_GPU_NB_L, ewcNB_XF_BUF_OPS,
        ewcVSITESPREAD, ewcTRAJ, ewcUPDATE, ewcCONSTR, ewcMoveE, ewcROT, ewcROTadd,
+       ewcQMMM, ewcQMMM_EMBED, ewcQMMM_INPUT, ewcQMMM_ENGINE, ewcQMMM_OUTPUT,
        ewcTEST, ewcNR };
 
 enum { ewcsDD_REDIST, ewcsDD_GRID, ewcsDD_SETUPCOMM,
@@ -78,6 +79,12 @@ void wallcycle_start_nocount(gmx_wallcycle_t wc, int ewc);
 double wallcycle_stop(gmx_wallcycle_t wc, int ewc);
 /* Stop the cycle count for ewc, returns the last cycle count */
 
+void wallcycle_add(gmx_wallcycle_t wc, int ewc, int n, double cycles);
+/* Adds n to the call count and cycles to the cycle count of ewc, for
+ * counts that were accumulated elsewhere, e.g. in a thread that can
+ * not use wc.
+ */
+
 void wallcycle_reset_all(gmx_wallcycle_t wc);
 /* Resets all cycle counters to zero */
 
@@ -0,0 +1,101 @@
+/* -*- mode: c; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4; c-file-style: "stroustrup"; -*-
+ *
+ *
+ * This file is part of GROMACS.
+ * Copyright (c) 2012-
+ *
+ * Written by the Gromacs development team under coordination of
+ * David van der Spoel, Berk Hess, and Erik Lindahl.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * To help us fund GROMACS development, we humbly ask that you cite
+ * the research papers on the package. Check out http://www.gromacs.org
+ *
+ * And Hey:
+ * Gnomes, ROck Monsters And Chili Sauce
+ */
+#ifndef _gmx_x86_avx_512_h_
+#define _gmx_x86_avx_512_h_
+
+/* AVX-512F is a superset of AVX-256, all 256- and 128-bit helpers
+ * are still available and used for loads and stores of half registers.
+ */
+#include "gmx_x86_avx_256.h"
+
+
+/* Return a 512-bit register with a in the lower and b in the upper half */
+static gmx_inline __m512
+gmx_mm512_set2_ps(float a, float b)
+{
+    return _mm512_mask_blend_ps(0xFF00,_mm512_set1_ps(a),_mm512_set1_ps(b));
+}
+
+static gmx_inline __m512d
+gmx_mm512_set2_pd(double a, double b)
+{
+    return _mm512_mask_blend_pd(0xF0,_mm512_set1_pd(a),_mm512_set1_pd(b));
+}
+
+/* Load 256 bits from aligned memory into both halves of a 512-bit register */
+static gmx_inline __m512
+gmx_mm512_load_dup_ps(const float *x)
+{
+    return _mm512_castpd_ps(_mm512_broadcast_f64x4(_mm256_load_pd((const double *)x)));
+}
+
+static gmx_inline __m512d
+gmx_mm512_load_dup_pd(const double *x)
+{
+    return _mm512_broadcast_f64x4(_mm256_load_pd(x));
+}
+
+/* Return the sum of the lower and upper half of a 512-bit register */
+static gmx_inline __m256
+gmx_mm512_sum_halves_ps(__m512 x)
+{
+    return _mm256_add_ps(_mm512_castps512_ps256(x),
+                         _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(x),1)));
+}
+
+static gmx_inline __m256d
+gmx_mm512_sum_halves_pd(__m512d x)
+{
+    return _mm256_add_pd(_mm512_castpd512_pd256(x),_mm512_extractf64x4_pd(x,1));
+}
+
+
+static void
+gmx_mm512_printzmm_ps(const char *s,__m512 zmm)
+{
+    float f[16];
+    int   i;
+
+    _mm512_storeu_ps(f,zmm);
+    printf("%s:",s);
+    for(i=0; i<16; i++)
+    {
+        printf(" %12.7f",f[i]);
+    }
+    printf("\n");
+}
+
+static void
+gmx_mm512_printzmm_pd(const char *s,__m512d zmm)
+{
+    double f[8];
+    int    i;
+
+    _mm512_storeu_pd(f,zmm);
+    printf("%s:",s);
+    for(i=0; i<8; i++)
+    {
+        printf(" %15.10e",f[i]);
+    }
+    printf("\n");
+}
+
+#endif /* _gmx_x86_avx_512_h_ */
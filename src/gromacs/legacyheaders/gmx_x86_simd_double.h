@@ -23,6 +23,10 @@
 
 /* This file includes the highest possible level of x86 (math) acceleration */
 
+#ifdef GMX_X86_AVX_512
+#include "gmx_x86_avx_512.h"
+#include "gmx_math_x86_avx_512_double.h"
+#else
 #ifdef GMX_X86_AVX_256
 #include "gmx_x86_avx_256.h"
 #include "gmx_math_x86_avx_256_double.h"
@@ -44,6 +48,7 @@
 #endif
 #endif
 #endif
+#endif
 
 static inline __m128d
 gmx_mm_calc_rsq_pd(__m128d dx, __m128d dy, __m128d dz)
@@ -67,4 +72,18 @@ gmx_mm256_calc_rsq_pd(__m256d dx, __m256d dy, __m256d dz)
 
 #endif
 
+
+#ifdef GMX_X86_AVX_512
+
+static inline __m512d
+gmx_mm512_calc_rsq_pd(__m512d dx, __m512d dy, __m512d dz)
+{
+    return _mm512_add_pd( _mm512_add_pd( _mm512_mul_pd(dx,dx), _mm512_mul_pd(dy,dy) ), _mm512_mul_pd(dz,dz) );
+}
+
+/* Normal sum of four __m512d registers */
+#define gmx_mm512_sum4_pd(t0,t1,t2,t3)  _mm512_add_pd(_mm512_add_pd(t0,t1),_mm512_add_pd(t2,t3))
+
+#endif
+
 #endif /* _gmx_x86_simd_double_h_ */
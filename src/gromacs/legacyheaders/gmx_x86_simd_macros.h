@@ -56,12 +56,31 @@
 #undef gmx_or_pr
 #undef gmx_andnot_pr
 
+#undef gmx_cmpneq_pr
+
 #undef gmx_floor_pr
 #undef gmx_blendv_pr
 
 #undef gmx_movemask_pr
 
 #undef gmx_mm_castsi128_pr
+#undef gmx_mm_castsi256_pr
+
+#undef gmx_mm_pb
+#undef gmx_cmplt_pb
+#undef gmx_blendzero_pr
+#undef gmx_blendnotzero_pr
+
+#undef gmx_mm_hpr
+#undef gmx_load_dup_pr
+#undef gmx_set2_pr
+#undef gmx_sum_halves_pr
+#undef gmx_load_hpr
+#undef gmx_store_hpr
+#undef gmx_add_hpr
+#undef gmx_sub_hpr
+#undef gmx_lower_hpr
+#undef gmx_upper_hpr
 
 #undef gmx_cvttpr_epi32
 #undef gmx_cvtepi32_pr
@@ -74,21 +93,26 @@
 #undef gmx_pmecorrV_pr
 
 
-/* By defining GMX_MM128_HERE or GMX_MM256_HERE before including this file
- * the same intrinsics, with defines, can be compiled for either 128 or 256
- * bit wide SSE or AVX instructions.
- * The gmx_ prefix is replaced by _mm_ or _mm256_ (SSE or AVX).
+/* By defining GMX_MM128_HERE, GMX_MM256_HERE or GMX_MM512_HERE before
+ * including this file the same intrinsics, with defines, can be compiled
+ * for either 128, 256 or 512 bit wide SSE or AVX instructions.
+ * The gmx_ prefix is replaced by _mm_, _mm256_ or _mm512_.
  * The _pr suffix is replaced by _ps or _pd (single or double precision).
  * Note that compiler settings will decide if 128-bit intrinsics will
  * be translated into SSE or AVX instructions.
+ *
+ * AVX-512 comparisons return a bit mask in a mask register instead of
+ * a floating point mask. With GMX_MM512_HERE the comparison results are
+ * of type gmx_mm_pb and are used with the gmx_blend*zero_pr macros;
+ * the and/or/andnot/blendv/movemask macros are not available.
  */
 
-#if !defined GMX_MM128_HERE && !defined GMX_MM256_HERE
-"You should define GMX_MM128_HERE or GMX_MM256_HERE"
+#if !defined GMX_MM128_HERE && !defined GMX_MM256_HERE && !defined GMX_MM512_HERE
+"You should define GMX_MM128_HERE, GMX_MM256_HERE or GMX_MM512_HERE"
 #endif
 
-#if defined GMX_MM128_HERE && defined GMX_MM256_HERE
-"You should not define both GMX_MM128_HERE and GMX_MM256_HERE"
+#if (defined GMX_MM128_HERE && defined GMX_MM256_HERE) || (defined GMX_MM128_HERE && defined GMX_MM512_HERE) || (defined GMX_MM256_HERE && defined GMX_MM512_HERE)
+"You should define only one of GMX_MM128_HERE, GMX_MM256_HERE and GMX_MM512_HERE"
 #endif
 
 #ifdef GMX_MM128_HERE
@@ -274,3 +298,115 @@
 #endif
 
 #endif /* GMX_MM256_HERE */
+
+
+#ifdef GMX_MM512_HERE
+
+#ifndef GMX_DOUBLE
+
+#include "gmx_x86_simd_single.h"
+
+#define GMX_X86_SIMD_WIDTH_HERE  16
+
+#define gmx_epi32 __m512i
+
+#define gmx_mm_pr  __m512
+#define gmx_mm_pb  __mmask16
+
+#define gmx_load_pr       _mm512_load_ps
+#define gmx_load1_pr(x)   _mm512_set1_ps((x)[0])
+#define gmx_set1_pr       _mm512_set1_ps
+#define gmx_setzero_pr    _mm512_setzero_ps
+#define gmx_store_pr      _mm512_store_ps
+#define gmx_storeu_pr     _mm512_storeu_ps
+
+#define gmx_add_pr        _mm512_add_ps
+#define gmx_sub_pr        _mm512_sub_ps
+#define gmx_mul_pr        _mm512_mul_ps
+#define gmx_max_pr        _mm512_max_ps
+/* Less-than (ordered, non-signaling), returns a bit mask */
+#define gmx_cmplt_pb(x,y) _mm512_cmp_ps_mask(x,y,_CMP_LT_OQ)
+/* Returns x where mask m is set, 0 elsewhere */
+#define gmx_blendzero_pr(x,m)     _mm512_maskz_mov_ps(m,x)
+/* Returns x where mask m is not set, 0 elsewhere */
+#define gmx_blendnotzero_pr(x,m)  _mm512_mask_mov_ps(x,m,_mm512_setzero_ps())
+
+#define gmx_floor_pr      _mm512_floor_ps
+
+#define gmx_cvttpr_epi32  _mm512_cvttps_epi32
+
+#define gmx_invsqrt_pr    gmx_mm512_invsqrt_ps
+#define gmx_calc_rsq_pr   gmx_mm512_calc_rsq_ps
+#define gmx_sum4_pr       gmx_mm512_sum4_ps
+
+#define gmx_pmecorrF_pr   gmx_mm512_pmecorrF_ps
+#define gmx_pmecorrV_pr   gmx_mm512_pmecorrV_ps
+
+/* Operations on half registers, used for 2x(N+N) cluster pair layouts */
+#define gmx_mm_hpr        __m256
+#define gmx_load_dup_pr   gmx_mm512_load_dup_ps
+#define gmx_set2_pr       gmx_mm512_set2_ps
+#define gmx_sum_halves_pr gmx_mm512_sum_halves_ps
+#define gmx_load_hpr      _mm256_load_ps
+#define gmx_store_hpr     _mm256_store_ps
+#define gmx_add_hpr       _mm256_add_ps
+#define gmx_sub_hpr       _mm256_sub_ps
+#define gmx_lower_hpr(x)  _mm512_castps512_ps256(x)
+#define gmx_upper_hpr(x)  _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(x),1))
+
+#else
+
+#include "gmx_x86_simd_double.h"
+
+#define GMX_X86_SIMD_WIDTH_HERE  8
+
+/* Double precision conversions return 8 ints in a 256-bit register */
+#define gmx_epi32 __m256i
+
+#define gmx_mm_pr  __m512d
+#define gmx_mm_pb  __mmask8
+
+#define gmx_load_pr       _mm512_load_pd
+#define gmx_load1_pr(x)   _mm512_set1_pd((x)[0])
+#define gmx_set1_pr       _mm512_set1_pd
+#define gmx_setzero_pr    _mm512_setzero_pd
+#define gmx_store_pr      _mm512_store_pd
+#define gmx_storeu_pr     _mm512_storeu_pd
+
+#define gmx_add_pr        _mm512_add_pd
+#define gmx_sub_pr        _mm512_sub_pd
+#define gmx_mul_pr        _mm512_mul_pd
+#define gmx_max_pr        _mm512_max_pd
+/* Less-than (ordered, non-signaling), returns a bit mask */
+#define gmx_cmplt_pb(x,y) _mm512_cmp_pd_mask(x,y,_CMP_LT_OQ)
+/* Returns x where mask m is set, 0 elsewhere */
+#define gmx_blendzero_pr(x,m)     _mm512_maskz_mov_pd(m,x)
+/* Returns x where mask m is not set, 0 elsewhere */
+#define gmx_blendnotzero_pr(x,m)  _mm512_mask_mov_pd(x,m,_mm512_setzero_pd())
+
+#define gmx_floor_pr      _mm512_floor_pd
+
+#define gmx_cvttpr_epi32  _mm512_cvttpd_epi32
+
+#define gmx_invsqrt_pr    gmx_mm512_invsqrt_pd
+#define gmx_calc_rsq_pr   gmx_mm512_calc_rsq_pd
+#define gmx_sum4_pr       gmx_mm512_sum4_pd
+
+#define gmx_pmecorrF_pr   gmx_mm512_pmecorrF_pd
+#define gmx_pmecorrV_pr   gmx_mm512_pmecorrV_pd
+
+/* Operations on half registers, used for 2x(N+N) cluster pair layouts */
+#define gmx_mm_hpr        __m256d
+#define gmx_load_dup_pr   gmx_mm512_load_dup_pd
+#define gmx_set2_pr       gmx_mm512_set2_pd
+#define gmx_sum_halves_pr gmx_mm512_sum_halves_pd
+#define gmx_load_hpr      _mm256_load_pd
+#define gmx_store_hpr     _mm256_store_pd
+#define gmx_add_hpr       _mm256_add_pd
+#define gmx_sub_hpr       _mm256_sub_pd
+#define gmx_lower_hpr(x)  _mm512_castpd512_pd256(x)
+#define gmx_upper_hpr(x)  _mm512_extractf64x4_pd(x,1)
+
+#endif
+
+#endif /* GMX_MM512_HERE */
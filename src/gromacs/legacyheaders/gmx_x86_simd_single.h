@@ -23,6 +23,10 @@
 
 /* This file includes the highest possible level of x86 (math) acceleration */
 
+#ifdef GMX_X86_AVX_512
+#include "gmx_x86_avx_512.h"
+#include "gmx_math_x86_avx_512_single.h"
+#else
 #ifdef GMX_X86_AVX_256
 #include "gmx_x86_avx_256.h"
 #include "gmx_math_x86_avx_256_single.h"
@@ -44,6 +48,7 @@
 #endif
 #endif
 #endif
+#endif
 
 
 static inline __m128
@@ -68,4 +73,18 @@ gmx_mm256_calc_rsq_ps(__m256 dx, __m256 dy, __m256 dz)
 
 #endif
 
+
+#ifdef GMX_X86_AVX_512
+
+static inline __m512
+gmx_mm512_calc_rsq_ps(__m512 dx, __m512 dy, __m512 dz)
+{
+    return _mm512_add_ps( _mm512_add_ps( _mm512_mul_ps(dx,dx), _mm512_mul_ps(dy,dy) ), _mm512_mul_ps(dz,dz) );
+}
+
+/* Normal sum of four __m512 registers */
+#define gmx_mm512_sum4_ps(t0,t1,t2,t3)  _mm512_add_ps(_mm512_add_ps(t0,t1),_mm512_add_ps(t2,t3))
+
+#endif
+
 #endif /* _gmx_x86_simd256_single_h_ */
@@ -61,6 +61,7 @@ typedef struct {
   int    ie,iconrmsd,ib,ivol,idens,ipv,ienthalpy;
   int    isvir,ifvir,ipres,ivir,isurft,ipc,itemp,itc,itcb,iu,imu;
   int    ivcos,ivisc;
+  int    iqm;
   int    nE,nEg,nEc,nTC,nTCP,nU,nNHC;
   int    *igrp;
   char   **grpnms;
@@ -75,6 +76,7 @@ typedef struct {
   gmx_bool   bPrintNHChains;
   gmx_bool   bMTTK;
   gmx_bool   bMu; /* true if dipole is calculated */
+  gmx_bool   bQMMM; /* true if QM SCF cycles are stored */
   gmx_bool   bDiagPres;
   gmx_bool   bVir;
   gmx_bool   bPress;
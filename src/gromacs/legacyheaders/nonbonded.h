@@ -79,6 +79,48 @@ do_nonbonded(t_commrec *cr,t_forcerec *fr,
              t_nrnb *nrnb,real *lambda,real dvdlambda[],
              int nls,int eNL,int flags);
 
+/* Calculate the interactions in the free-energy atom pair list nlist
+ * with the soft-core kernel and the exclusion corrections of the pairs
+ * in nlist_excl, as used with the Verlet cut-off scheme.
+ * Forces are added to f and fshift, energies to grppener, dV/dlambda
+ * to dvdlambda. Flags are the GMX_NONBONDED_DO_... flags above.
+ */
+void
+do_nonbonded_fep_list(t_forcerec *fr,t_nblist *nlist,t_nblist *nlist_excl,
+                      rvec x[],rvec f[],rvec fshift[],t_mdatoms *md,
+                      gmx_grppairener_t *grppener,
+                      t_nrnb *nrnb,real *lambda,real dvdlambda[],
+                      int flags);
+
+/* Returns the atom shift for dividing natoms atoms in at most
+ * 32 blocks for reducing thread force buffers.
+ */
+int
+gmx_nonbonded_red_ashift(int natoms);
+
+/* Returns mask with the bits set of the blocks of 1<<ashift atoms
+ * to which the interactions in nl contribute forces.
+ */
+unsigned
+gmx_nblist_red_mask(const t_nblist *nl,int ashift,unsigned mask);
+
+/* (Re)allocates the force buffer, and dvda with bDvda, of thread
+ * buffer ft for natoms atoms and clears the blocks in ft->red_mask
+ * and the shift forces.
+ */
+void
+gmx_nonbonded_clear_thread_force(f_thread_t *ft,int natoms,int ashift,
+                                 gmx_bool bDvda);
+
+/* Adds the blocks set in red_mask of the force buffers of threads
+ * 1 to nthreads-1 in f_t to f, and to dvda when not NULL.
+ * Runs in parallel over the blocks.
+ */
+void
+gmx_nonbonded_reduce_thread_force(int natoms,rvec *f,real *dvda,
+                                  int nthreads,const f_thread_t *f_t,
+                                  int ashift);
+
 /* Calculate VdW/charge listed pair interactions (usually 1-4 interactions).
  * global_atom_index is only passed for printing error messages.
  */
@@ -108,6 +108,23 @@ void gmx_pme_calc_energy(gmx_pme_t pme,int n,rvec *x,real *q,real *V);
  * Currently does not work in parallel or with free energy.
  */
 
+void gmx_pme_calc_pot_field(gmx_pme_t pme,int n,rvec *x,
+                            real *pot,rvec *field);
+/* Calculate the PME grid potential pot and electric field field,
+ * per unit charge, at n positions x with the potential in the pme
+ * struct of the last call to gmx_pme_do that computed forces.
+ * Currently does not work in parallel or with free energy.
+ */
+
+void gmx_pme_calc_source_f(gmx_pme_t pme,matrix box,real ewaldcoeff,
+                           int nsrc,rvec *xsrc,real *qsrc,
+                           int n,rvec *x,real *q,rvec *f);
+/* Adds to f the PME mesh forces of the nsrc source charges qsrc at xsrc
+ * on the n charges q at x, without the forces among the targets or
+ * among the sources. Overwrites the grid of the last gmx_pme_do call.
+ * Currently does not work in parallel or with free energy.
+ */
+
 /* The following three routines are for PME/PP node splitting in pme_pp.c */
 
 /* Abstract type for PME <-> PP communication */
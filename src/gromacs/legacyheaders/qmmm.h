@@ -60,6 +60,11 @@ void init_QMMMrec(t_commrec *cr,
  * names and types are read; from inputrec->QMcharge
  * resp. inputrec->QMmult the nelecs and multiplicity are determined
  * and md->cQMMM gives numbers of the MM and QM atoms 
+ *
+ * QM/MM only runs on more than one node with normal mode analysis,
+ * where every node computes other displaced geometries of the full
+ * system. The QM calculations of node i then run in directory
+ * QMnode<i>, which also holds its SCF guesses.
  */
 
 void update_QMMMrec(t_commrec *cr,
@@ -67,24 +72,128 @@ void update_QMMMrec(t_commrec *cr,
 			   rvec x[],
 			   t_mdatoms *md,
 			   matrix box,
-			   gmx_localtop_t *top);
+			   gmx_localtop_t *top,
+			   gmx_bool bNS,
+			   gmx_wallcycle_t wcycle);
 
 /* update_QMMMrec fills the MM stuff in QMMMrec. The MM atoms are
  * taken froom the neighbourlists of the QM atoms. In a QMMM run this
- * routine should be called at every step, since it updates the MM
- * elements of the t_QMMMrec struct.  
+ * routine should be called at every step, since it updates the
+ * coordinates in the t_QMMMrec struct. The MM embedding itself is
+ * only rebuilt when bNS is set, as the neighbourlists only change on
+ * search steps. With the Verlet cut-off scheme the list is made from
+ * the cluster pair lists by nbnxn_make_qmmm_list and holds the MM atoms
+ * within rcoulomb of a QM atom.
+ *
+ * With PME and the environment variable GMX_QMMM_PME set (Q-Chem only)
+ * the MM charges beyond the neighbourlists enter the QM Hamiltonian
+ * through the PME mesh potential on the QM atoms, stored in qm->Vext.
+ * For this the MM charges at the current coordinates are put on the
+ * mesh here, an extra mesh calculation. The QM program returns the
+ * charges qm->Qext that couple to this potential, with which
+ * calculate_QMMM or finish_QMMM add the reaction forces on the QM
+ * atoms and on all MM atoms to fr->f_novirsum.
+ *
+ * The time is counted as ewcQMMM in wcycle, the embedding as
+ * ewcQMMM_EMBED.
  */
 
-real calculate_QMMM(t_commrec *cr,
+real calculate_QMMM(FILE *fplog,
+                           gmx_large_int_t step,
+                           t_commrec *cr,
 			   rvec x[], rvec f[],
 			   t_forcerec *fr,
-			   t_mdatoms *md);
+			   t_mdatoms *md,
+			   gmx_bool bFullQM,
+			   gmx_wallcycle_t wcycle);
 
 /* QMMM computes the QM forces. This routine makes either function
  * calls to gmx QM routines (derived from MOPAC7 (semi-emp.) and MPQC
  * (ab initio)) or generates input files for an external QM package
  * (listed in QMMMrec.QMpackage). The binary of the QM package is
- * called by system().
+ * called by system(). The SCF guess of each QM calculation is taken
+ * from the previous step(s), the number of SCF cycles is written to
+ * fplog when the QM package reports it.
+ *
+ * With multiple time stepping (environment variable GMX_QMMM_NSTQM
+ * larger than 1, dynamical integrators only) every step only a cheap
+ * reference is computed: the QM method GMX_QMMM_MTS_METHOD with basis
+ * GMX_QMMM_MTS_BASIS, or nothing for a pure MM reference. The full QM
+ * forces are only computed when bFullQM is set, which md sets every
+ * nstQM steps with GMX_FORCE_QMMM_FULL. The full QM minus reference
+ * forces are then stored in fr->qr->f_mts, which update_coords applies
+ * as an impulse covering nstQM steps.
+ *
+ * The time is counted as ewcQMMM in wcycle, the stages of the QM calls
+ * (see QMMM_cycles_start) as ewcQMMM_INPUT, ewcQMMM_ENGINE and
+ * ewcQMMM_OUTPUT. The SCF cycles of the step are stored in fr->qr->nSCF
+ * for the energy file.
+ */
+
+real add_QMMM_mts_forces(t_QMMMrec *qr,gmx_bool bFullQM,real Eref,real EQM,
+                         rvec f[],rvec fshift_tot[]);
+
+/* Adds the multiple time stepping QM forces to f and fshift_tot: the
+ * reference gradients in qr->f_ref and, with bFullQM, the full QM minus
+ * reference gradients, which are then also stored in qr->f_mts. Eref
+ * and EQM are the reference and full QM energies, EQM is only used
+ * with bFullQM. Returns Eref plus the QM correction of the last full
+ * QM step. Independent of the QM package, called by calculate_QMMM.
+ */
+
+void start_QMMM(FILE *fplog,
+                gmx_large_int_t step,
+                t_commrec *cr,
+                rvec x[],
+                t_forcerec *fr,
+                t_mdatoms *md,
+                gmx_bool bFullQM);
+
+/* With asynchronous QM/MM (environment variable GMX_QMMM_ASYNC set,
+ * fr->qr->async != NULL) start_QMMM hands the QM calculation of
+ * calculate_QMMM to a QM thread, which is started once by init_QMMMrec
+ * and runs until done_QMMMrec. It should be called directly
+ * after update_QMMMrec, so the classical forces can be computed while
+ * the QM package runs. Without asynchronous QM/MM it does nothing.
+ */
+
+real finish_QMMM(rvec f[], t_forcerec *fr, gmx_wallcycle_t wcycle);
+
+/* Waits for the QM calculation launched by start_QMMM, adds the QM
+ * forces to f and fr->fshift, writes the SCF convergence lines of the
+ * QM calls to the fplog passed to start_QMMM and returns the QM energy. Should be
+ * called when the MM forces are complete, but before virtual site
+ * forces are spread and the virial is computed. The wait counts as
+ * ewcQMMM, the stages as with calculate_QMMM.
+ */
+
+void done_QMMMrec(t_QMMMrec *qr);
+
+/* Stops and joins the QM thread of asynchronous QM/MM, closes the
+ * connections to the QM server and frees the work arrays of qr.
+ * Called by mdrun at the end of the run.
+ */
+
+const char *QMMM_workfile(t_QMrec *qm,const char *name,char *buf);
+
+/* Returns the path of file name in the scratch directory of qm, stored
+ * in buf (STRLEN), or name itself when qm runs in the working directory.
+ * With GMX_QMMM_ONIOM_PARALLEL set the 2n-1 calculations of an n-layer
+ * ONIOM step run concurrently (Gaussian, ORCA and Q-Chem), each in a
+ * scratch directory QMlayer<i> or QMlayer<i>_low. QM programs that
+ * communicate through files should read and write their files there;
+ * Q-Chem has a server connection per calculation instead.
+ */
+
+void QMMM_cycles_start(t_QMrec *qm,int stage);
+
+void QMMM_cycles_stop(t_QMrec *qm,int stage);
+
+/* Time stage (eQMcycINPUT, eQMcycENGINE or eQMcycOUTPUT) of a QM call.
+ * The interfaces call these around writing the input, running the QM
+ * program and reading its output. The cycles are kept in qm, as the
+ * calls can run in a separate thread, and added to the wallcycle
+ * counters by calculate_QMMM or finish_QMMM.
  */
 
 #ifdef __cplusplus
@@ -60,6 +60,12 @@ typedef struct {
   int  simulation_part;
   FILE *fp_dhdl;
   FILE *fp_field;
+  /* Non-NULL when trajectory frames are written by a separate I/O thread */
+  struct gmx_mdoutf_async *async;
+  /* TRUE when each domain compresses its own xtc chunk */
+  gmx_bool bXtcChunks;
+  unsigned char *xtc_chunks;
+  int  xtc_chunks_nalloc;
 } gmx_mdoutf_t;
 
 typedef struct gmx_global_stat *gmx_global_stat_t;
@@ -134,6 +140,10 @@ void write_traj(FILE *fplog,t_commrec *cr,
 /* Routine that writes frames to trn, xtc and/or checkpoint.
  * What is written is determined by the mdof_flags defined above.
  * Data is collected to the master node only when necessary.
+ * With the environment variable GMX_ASYNC_OUTPUT set, the master copies
+ * trn and xtc frames into one of two buffers and a separate I/O thread
+ * compresses and writes them. Checkpoints are still written directly,
+ * after all queued frames have been written.
  */
 
 int do_per_step(gmx_large_int_t step,gmx_large_int_t nstep);
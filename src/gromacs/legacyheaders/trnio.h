@@ -53,6 +53,7 @@
 	
 #include "typedefs.h"
 #include "gmxfio.h"
+#include "trxmmap.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -115,6 +116,19 @@ gmx_bool fread_htrn(t_fileio *fio,t_trnheader *sh,
  * Return FALSE on error
  */
  
+gmx_bool mread_trnheader(t_trxmmap *mm,gmx_off_t *pos,t_trnheader *sh,
+                         gmx_bool *bOK);
+/* As fread_trnheader, but reads the header at offset *pos of a mapped
+ * file and advances *pos past it.
+ */
+
+gmx_bool mread_htrn(t_trxmmap *mm,gmx_off_t *pos,t_trnheader *sh,
+                    rvec *box,rvec *x,rvec *v,rvec *f);
+/* As fread_htrn, but decodes the frame data at offset *pos of a mapped
+ * file directly into box, x, v and f and advances *pos past it.
+ * Return FALSE when the data is incomplete.
+ */
+
 gmx_bool fread_trn(t_fileio *fio,int *step,real *t,real *lambda,
 		      rvec *box,int *natoms,rvec *x,rvec *v,rvec *f);
 /* Read a trn frame, including the header from fp. box, x, v, f may
@@ -0,0 +1,93 @@
+/*
+ *
+ *                This source code is part of
+ *
+ *                 G   R   O   M   A   C   S
+ *
+ *          GROningen MAchine for Chemical Simulations
+ *
+ * Written by David van der Spoel, Erik Lindahl, Berk Hess, and others.
+ * Copyright (c) 1991-2000, University of Groningen, The Netherlands.
+ * Copyright (c) 2001-2012, The GROMACS development team,
+ * check out http://www.gromacs.org for more information.
+
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * If you want to redistribute modifications, please consider that
+ * scientific software is very special. Version control is crucial -
+ * bugs must be traceable. We will be happy to consider code for
+ * inclusion in the official distribution, but derived work must not
+ * be called official GROMACS. Details are found in the README & COPYING
+ * files - if they are missing, get the official version at www.gromacs.org.
+ *
+ * To help us fund GROMACS development, we humbly ask that you cite
+ * the papers on the package - you can find them in the top README file.
+ *
+ * For more info, check our website at http://www.gromacs.org
+ */
+#ifndef _trxindex_h
+#define _trxindex_h
+
+#include "typedefs.h"
+#include "futil.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Frame index for xtc and trr trajectories.
+ *
+ * The index stores the file offset, step and time of every frame.
+ * It is only built when a reader first needs to seek, currently to the
+ * start time -b, and then cached in a small xdr file next to the
+ * trajectory, with the trajectory name plus TRXINDEX_EXT. Writers do
+ * not touch the index. Building an index only reads the frame headers
+ * and skips the coordinate data. A cached index is checked against the
+ * trajectory before use. When the trajectory has grown, for instance
+ * by appending, only the new frames are scanned.
+ * Setting the environment variable GMX_NO_TRX_INDEX disables the index.
+ */
+
+#define TRXINDEX_EXT ".idx"
+
+typedef struct {
+    gmx_off_t       offset;  /* File offset of the frame header     */
+    gmx_large_int_t step;    /* Step of the frame                   */
+    double          time;    /* Time of the frame                   */
+} t_trxindex_frame;
+
+typedef struct {
+    int               ftp;     /* efXTC or efTRR                      */
+    int               nframes; /* The number of complete frames       */
+    int               nalloc;  /* Allocation size of frame            */
+    t_trxindex_frame *frame;   /* The frames, in file order           */
+    gmx_off_t         end;     /* File offset after the last frame    */
+} t_trxindex;
+
+gmx_bool trxindex_supported(const char *fn);
+/* Returns TRUE when fn is a trajectory type that can be indexed
+ * and the index is not disabled.
+ */
+
+t_trxindex *trxindex_get(const char *fn);
+/* Returns the up to date index of trajectory fn. The cached index
+ * is read, checked, extended or rebuilt as needed, and written back
+ * when it changed. Returns NULL when fn can not be indexed.
+ */
+
+int trxindex_find_time(const t_trxindex *idx,real t);
+/* Returns the first frame, in file order, with time >= t,
+ * or idx->nframes when there is no such frame.
+ */
+
+void done_trxindex(t_trxindex *idx);
+/* Frees idx */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,126 @@
+/*
+ *
+ *                This source code is part of
+ *
+ *                 G   R   O   M   A   C   S
+ *
+ *          GROningen MAchine for Chemical Simulations
+ *
+ * Written by David van der Spoel, Erik Lindahl, Berk Hess, and others.
+ * Copyright (c) 1991-2000, University of Groningen, The Netherlands.
+ * Copyright (c) 2001-2012, The GROMACS development team,
+ * check out http://www.gromacs.org for more information.
+
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * If you want to redistribute modifications, please consider that
+ * scientific software is very special. Version control is crucial -
+ * bugs must be traceable. We will be happy to consider code for
+ * inclusion in the official distribution, but derived work must not
+ * be called official GROMACS. Details are found in the README & COPYING
+ * files - if they are missing, get the official version at www.gromacs.org.
+ *
+ * To help us fund GROMACS development, we humbly ask that you cite
+ * the papers on the package - you can find them in the top README file.
+ *
+ * For more info, check our website at http://www.gromacs.org
+ */
+#ifndef _trxmmap_h
+#define _trxmmap_h
+
+#include "typedefs.h"
+#include "futil.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Read-only memory mapping of a trajectory file.
+ *
+ * Frames are decoded from the mapped pages straight into the caller's
+ * arrays, without going through stdio and an XDR stream. The kernel is
+ * told we read sequentially, so it reads ahead aggressively.
+ * Setting the environment variable GMX_NO_TRX_MMAP disables mapping.
+ */
+
+typedef struct t_trxmmap t_trxmmap;
+
+t_trxmmap *trxmmap_open(const char *fn);
+/* Maps file fn for reading. Returns NULL when the file can not be
+ * mapped, e.g. on Windows, or when mapping is disabled.
+ */
+
+void trxmmap_close(t_trxmmap *mm);
+/* Unmaps and closes the file */
+
+const unsigned char *trxmmap_get(t_trxmmap *mm,gmx_off_t pos,gmx_off_t n);
+/* Returns a pointer to the n bytes at offset pos in the file, or NULL
+ * when the file is shorter. When the file has grown since it was
+ * mapped, e.g. because mdrun is still writing it, it is remapped.
+ * The file size is checked on every call, so data truncated away after
+ * mapping gives NULL instead of SIGBUS.
+ * The pointer is valid until the next call.
+ */
+
+gmx_off_t trxmmap_size(const t_trxmmap *mm);
+/* Returns the currently mapped size. Calls of trxmmap_get for data
+ * within this size do not remap, so the returned pointers stay valid
+ * and can be used by several threads at the same time.
+ */
+
+/* Decoding of big-endian XDR data */
+
+static gmx_inline int trxmmap_int(const unsigned char *p)
+{
+    return (int)(((unsigned int)p[0] << 24) | ((unsigned int)p[1] << 16) |
+                 ((unsigned int)p[2] <<  8) |  (unsigned int)p[3]);
+}
+
+static gmx_inline float trxmmap_float(const unsigned char *p)
+{
+    union { int i; float f; } u;
+
+    u.i = trxmmap_int(p);
+
+    return u.f;
+}
+
+static gmx_inline double trxmmap_double(const unsigned char *p)
+{
+    union { unsigned long long i; double d; } u;
+
+    u.i = ((unsigned long long)(unsigned int)trxmmap_int(p) << 32) |
+        (unsigned int)trxmmap_int(p + 4);
+
+    return u.d;
+}
+
+static gmx_inline void trxmmap_reals(const unsigned char *p,gmx_bool bDouble,
+                                     int n,real *r)
+{
+    int i;
+
+    if (bDouble)
+    {
+        for(i=0; i<n; i++)
+        {
+            r[i] = trxmmap_double(p + i*sizeof(double));
+        }
+    }
+    else
+    {
+        for(i=0; i<n; i++)
+        {
+            r[i] = trxmmap_float(p + i*sizeof(float));
+        }
+    }
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
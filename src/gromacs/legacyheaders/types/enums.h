@@ -86,9 +86,10 @@ enum {
 /* Coulomb / VdW interaction modifiers.
  * grompp replaces eintmodPOTSHIFT_VERLET by eintmodPOTSHIFT or eintmodNONE.
  * Exactcutoff is only used by Reaction-field-zero, and is not user-selectable.
+ * Force-switch is only supported for VdW with the Verlet cut-off scheme.
  */
 enum eintmod {
-    eintmodPOTSHIFT_VERLET, eintmodPOTSHIFT, eintmodNONE, eintmodPOTSWITCH, eintmodEXACTCUTOFF, eintmodNR
+    eintmodPOTSHIFT_VERLET, eintmodPOTSHIFT, eintmodNONE, eintmodPOTSWITCH, eintmodEXACTCUTOFF, eintmodFORCESWITCH, eintmodNR
 };
 
 /*
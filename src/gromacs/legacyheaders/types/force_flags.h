@@ -68,6 +68,10 @@ extern "C" {
 #define GMX_FORCE_DHDL         (1<<10)
 /* Calculate long-range energies/forces */
 #define GMX_FORCE_DO_LR        (1<<11)
+/* With QM/MM multiple time stepping, calculate the full QM forces */
+#define GMX_FORCE_QMMM_FULL    (1<<12)
+/* With PME mesh multiple time stepping, calculate the mesh part */
+#define GMX_FORCE_PME_MESH     (1<<13)
 
 /* Normally one want all energy terms and forces */
 #define GMX_FORCE_ALLFORCES    (GMX_FORCE_BONDED | GMX_FORCE_NONBONDED | GMX_FORCE_FORCES)
@@ -147,6 +147,7 @@ typedef struct {
   double *enerpart_lambda; /* Partial energy for lambda and flambda[] */
   real foreign_term[F_NRE];    /* alternate array for storing foreign lambda energies */
   gmx_grppairener_t foreign_grpp;  /* alternate array for storing foreign lambda energies */
+  real QMnscf;                 /* QM SCF cycles of this step            */
 } gmx_enerdata_t;
 /* The idea is that dvdl terms with linear lambda dependence will be added
  * automatically to enerpart_lambda. Terms with non-linear lambda dependence
@@ -170,6 +171,7 @@ typedef struct {
     int  f_nalloc;
     unsigned red_mask; /* Mask for marking which parts of f are filled */
     rvec *fshift;
+    real *dvda;        /* GB dV/d(Born radius), only for the group scheme */
     real ener[F_NRE];
     gmx_grppairener_t grpp;
     real Vcorr;
@@ -296,10 +298,15 @@ typedef struct {
   int  cg_nalloc;
   rvec *shift_vec;
 
-  /* The neighborlists including tables */
+  /* The neighborlists including tables.
+   * With the group scheme the search generates nthread_ns sets of
+   * nnblists lists, stored consecutively in nblists, one set per thread.
+   * Only the first set holds the tables.
+   */
   int  nnblists;
   int  *gid2nblists;
   t_nblists *nblists;
+  int  nthread_ns;
 
   int cutoff_scheme; /* group- or Verlet-style cutoff */
   gmx_bool bNonbonded;    /* true if nonbonded calculations are *not* turned off */
@@ -323,6 +330,17 @@ typedef struct {
   int  nlr;
   rvec *f_twin;
 
+  /* PME mesh multiple time stepping: the mesh part is only computed
+   * every nstpme steps and then applied as an impulse in update_coords.
+   * f_pme_mts holds the mesh force, it has size natoms_force_constr.
+   * The mesh energy, dV/dlambda and virial are reused between mesh steps.
+   */
+  int    nstpme;
+  rvec   *f_pme_mts;
+  real   pme_mts_ener;
+  real   pme_mts_dvdl;
+  matrix pme_mts_vir;
+
   /* Forces that should not enter into the virial summation:
    * PPPM/PME/Ewald/posres
    */
@@ -458,6 +476,17 @@ typedef struct {
   int  red_nblock;
   f_thread_t *f_t;
 
+  /* Thread local output of the free-energy pair lists with the Verlet
+   * scheme, thread 0 uses the global force and energy arrays
+   */
+  int        nthreads_fep;
+  f_thread_t *f_t_fep;
+
+  /* Thread local output of the group scheme kernels, nthread_ns threads,
+   * thread 0 uses the global force and energy arrays
+   */
+  f_thread_t *f_t_nb;
+
   /* Exclusion load distribution over the threads */
   int  *excl_load;
 } t_forcerec;
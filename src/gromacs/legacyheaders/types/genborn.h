@@ -71,6 +71,8 @@ typedef struct
 	real  *gpol_globalindex;  /*  */
 	real  *gpol_still_work;   /* Work array for Still model */
 	real  *gpol_hct_work;     /* Work array for HCT/OBC models */
+	real  **gpol_work_t;      /* Thread local Still/HCT/OBC work arrays, thread>0 */
+	int   gpol_work_t_nalloc; /* Allocation size of the gpol_work_t arrays */
 	real  *bRad;              /* Atomic Born radii */
 	real  *vsolv;             /* Atomic solvation volumes */
 	real  *vsolv_globalindex; /*  */
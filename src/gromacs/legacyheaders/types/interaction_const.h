@@ -42,9 +42,27 @@ extern "C" {
 
 typedef struct {
     /* VdW */
+    int  vdw_modifier;
     real rvdw;
+    real rvdw_switch;
     real sh_invrc6; /* For shifting the LJ potential */
 
+    /* Force-switch constants for the r^-p LJ terms, with t = r - rvdw_switch:
+     * F/p = r^-(p+1) + (c2 + c3*t)*t^2 for t > 0,
+     * cpot is the constant that shifts the potential to zero at rvdw.
+     */
+    real dispersion_shift_c2;
+    real dispersion_shift_c3;
+    real dispersion_shift_cpot;
+    real repulsion_shift_c2;
+    real repulsion_shift_c3;
+    real repulsion_shift_cpot;
+
+    /* Potential-switch constants, sw = 1 + c3*t^3 + c4*t^4 + c5*t^5 */
+    real vdw_switch_c3;
+    real vdw_switch_c4;
+    real vdw_switch_c5;
+
     /* type of electrostatics (defined in enums.h) */
     int  eeltype;
 
@@ -48,6 +48,7 @@ enum { nbkNotSet = 0,
        nbk4x4_PlainC, 
        nbk4xN_X86_SIMD128,
        nbk4xN_X86_SIMD256,
+       nbk4xN_X86_SIMD512,
        nbk8x8x8_CUDA,
        nbk8x8x8_PlainC };
 
@@ -36,6 +36,8 @@
 #ifndef _nbnxn_pairlist_h
 #define _nbnxn_pairlist_h
 
+#include "nblist.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -150,6 +152,10 @@ typedef struct {
     int          natpair_ljq; /* Total number of atom pairs for LJ+Q kernel */
     int          natpair_lj;  /* Total number of atom pairs for LJ kernel   */
     int          natpair_q;   /* Total number of atom pairs for Q kernel    */
+    t_nblist     **nbl_fep; /* Atom pair lists of the perturbed atoms, one
+                               per list, NULL without free-energy */
+    t_nblist     **nbl_fep_excl; /* The excluded pairs and self pairs of
+                                    the perturbed atoms, one per list */
 } nbnxn_pairlist_set_t;
 
 enum { nbatXYZ, nbatXYZQ, nbatX4, nbatX8 };
@@ -53,22 +53,34 @@ typedef struct {
   atom_id jcg[MAX_CG];
 } t_ns_buf;
 
+/* Thread local exclusion masks, cell distances and j-charge-group buffers
+ * of the grid search
+ */
+typedef struct {
+  t_excl   *bexcl;
+  real     *dcx2;       /* Squared distance from atom to j-cell */
+  real     *dcy2;       /* Squared distance from atom to j-cell */
+  real     *dcz2;       /* Squared distance from atom to j-cell */
+  int      dc_nalloc;   /* Allocation size of dcx2, dyc2, dcz2  */
+  atom_id  **nl_sr;
+  int      *nsr;
+  atom_id  **nl_lr_ljc;
+  atom_id  **nl_lr_one;
+  int      *nlr_ljc;
+  int      *nlr_one;
+} gmx_ns_thread_t;
+
 typedef struct {
   gmx_bool     bCGlist;
   atom_id  *simple_aaj;
   t_grid   *grid;
-  t_excl   *bexcl;
   gmx_bool     *bHaveVdW;
   t_ns_buf **ns_buf;
   gmx_bool     *bExcludeAlleg;
   int      nra_alloc;
   int      cg_alloc;
-  atom_id  **nl_sr;
-  int      *nsr;
-  atom_id  **nl_lr_ljc;
-  atom_id  **nl_lr_one;
-  int      *nlr_ljc;
-  int      *nlr_one;
+  int      nthread; /* the number of search threads, equal to fr->nthread_ns */
+  gmx_ns_thread_t *th; /* the thread local search data */
   /* the nblists should probably go in here */
   gmx_bool     nblist_initialized; /* has the nblist been initialized?  */
   int      dump_nl; /* neighbour list dump level (from env. var. GMX_DUMP_NL)*/
@@ -65,10 +65,8 @@ typedef struct {
   rvec   *os1;
   int    *a;		/* The grid of cgs			*/
   int    nr_alloc;      /* Allocation size of cell_index and a  */
-  real   *dcx2;         /* Squared distance from atom to j-cell */
-  real   *dcy2;         /* Squared distance from atom to j-cell */
-  real   *dcz2;         /* Squared distance from atom to j-cell */
-  int    dc_nalloc;     /* Allocation size of dcx2, dyc2, dcz2  */
+  int    dc_nalloc;     /* Required allocation size of the thread
+                         * local cell distance buffers of ns     */
 } t_grid;
 
 #ifdef __cplusplus
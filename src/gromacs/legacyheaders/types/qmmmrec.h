@@ -39,6 +39,25 @@
 extern "C" {
 #endif
 
+/* Connection to a Q-Chem server, only defined in qm_qchem.c */
+struct gmx_qchem;
+
+/* SCF guess carry-over between steps, owned by the QM/MM layer.
+ * The wavefunctions of the last nstored steps are kept in file[],
+ * newest first. coeff[] holds the ASPC predictor coefficients with
+ * which a QM program that can combine densities extrapolates its
+ * guess; programs that can not just read file[0].
+ */
+typedef struct {
+  int           nhist;          /* nr of previous steps used, 0: none */
+  int           nstored;        /* nr of wavefunctions stored so far  */
+  char          **file;         /* stored wavefunction files          */
+  real          *coeff;         /* extrapolation coefficients         */
+} t_QMguess;
+
+/* Stages of a QM call that are timed separately, see QMMM_cycles_start */
+enum { eQMcycINPUT, eQMcycENGINE, eQMcycOUTPUT, eQMcycNR };
+
 typedef struct {
  int           nrQMatoms;      /* total nr of QM atoms              */
  rvec          *xQM;           /* shifted to center of box          */  
@@ -54,6 +73,17 @@ typedef struct {
  gmx_bool          bTS;            /* Optimize a TS, only steep, no md  */
  gmx_bool          bOPT;          /* Optimize QM subsys, only steep, no md  */
  gmx_bool          *frontatoms;   /* qm atoms on the QM side of a QM-MM bond */
+ t_QMguess     *guess;         /* SCF guess history, NULL: none     */
+ char          *wfnfile;       /* wavefunction file of the QM program */
+ int           nSCF;           /* SCF cycles of the last call, 0: unknown */
+ int           ncalls;         /* nr of calls of the QM program so far */
+ char          *workdir;       /* scratch directory, NULL: working dir */
+ real          *Vext;          /* long-range MM potential (kJ/mol/e) and */
+ rvec          *Eext;          /* field on the QM atoms, NULL: none      */
+ real          *Qext;          /* QM charges coupling to Vext, dE/dVext  */
+ double        cyc[eQMcycNR];  /* cycles per stage, not yet in wcycle */
+ int           ncyc[eQMcycNR]; /* nr of calls per stage               */
+ double        cyc_start;      /* cycle count at the start of a stage */
  /* Gaussian specific stuff */
  int           nQMcpus;        /* no. of CPUs used for the QM calc. */
  int           QMmem;          /* memory for the gaussian calc.     */
@@ -64,6 +94,11 @@ typedef struct {
  char          *devel_dir;
  char          *orca_basename; /* basename for I/O with orca        */
  char          *orca_dir;      /* directory for ORCA                */
+ /* Q-Chem specific stuff */
+ struct gmx_qchem *qchem;      /* server connection of this calculation */
+ rvec          *QMgrad;        /* gradient buffers of the server reply */
+ rvec          *MMgrad;
+ int           MMgrad_nalloc;  /* the MM count changes with the embedding */
  real          *c6;
  real          *c12;
  /* Surface hopping stuff */
@@ -96,11 +131,55 @@ typedef struct {
 } t_MMrec;
 
 
+/* atom index and shift of an i or j particle in the QMMM neighborlist */
+typedef struct {
+  int           j;
+  int           shift;
+} t_j_particle;
+
+/* Persistent buffers for building the MM embedding from the QMMM
+ * neighborlist. The embedding only changes on neighbor search steps.
+ */
+typedef struct {
+  int           *mark;          /* per local atom, set while listed   */
+  int           mark_nalloc;
+  t_j_particle  *mm;            /* the MM particles, sorted on index  */
+  int           mm_nalloc;
+  int           mm_nr;
+  int           *buf;           /* communication buffer               */
+  int           buf_nalloc;
+  int           MMrec_nalloc;   /* allocation size of the MMrec arrays */
+} t_QMMMenv;
+
+/* State of a QM calculation running concurrently with the MM forces,
+ * only defined in qmmm.c
+ */
+typedef struct gmx_QMMM_async *gmx_QMMM_async_t;
+
 typedef struct {
   int           QMMMscheme; /* ONIOM (multi-layer) or normal          */
   int           nrQMlayers; /* number of QM layers (total layers +1 (MM)) */
   t_QMrec       **qm;        /* atoms and run params for each QM group */
   t_MMrec       *mm;        /* there can only be one MM subsystem !   */
+  t_QMrec       **qm_low;    /* ONIOM: layer i at the level of layer i+1 */
+  gmx_bool      bParONIOM;  /* run the ONIOM calculations concurrently */
+  t_QMMMenv     env;        /* work data for the MM embedding         */
+  gmx_QMMM_async_t async;   /* non-NULL when QM and MM run concurrently */
+  /* multiple time stepping, the full QM forces every nstQM steps */
+  int           nstQM;
+  t_QMrec       *qm_ref;    /* cheap reference level, NULL for MM only */
+  rvec          *f_mts;     /* full QM minus reference forces         */
+  int           natoms_mts; /* size of f_mts                          */
+  real          dE_mts;     /* full QM minus reference energy         */
+  rvec          *f_QM,*fshift_QM;   /* work arrays of the QM and the  */
+  rvec          *f_ref,*fshift_ref; /* reference calls, natoms_mts    */
+  gmx_bool      bPMEembed;  /* long-range embedding from the PME mesh */
+  rvec          *f_pme;     /* the forces of the embedding mesh call  */
+  int           f_pme_nalloc;
+  matrix        box_pme;    /* the box of the embedding mesh call     */
+  int           nSCF;       /* SCF cycles of all QM calls this step   */
+  char          *QMlog;     /* log lines of the QM calls this step,   */
+  int           QMlog_nalloc; /* printed by the main thread           */
 } t_QMMMrec;
 
 #ifdef __cplusplus
@@ -96,7 +96,8 @@ void update_coords(FILE         *fplog,
 		          gmx_bool     bMolPBC,
 			  rvec         *f,    /* forces on home particles */
 			  gmx_bool         bDoLR,
-			  rvec         *f_lr,
+			  rvec         *f_lr, /* applied as impulse when bDoLR */
+			  int          nstlr, /* the number of steps f_lr covers */
 			  t_fcdata     *fcd,
 			  gmx_ekindata_t *ekind,
 			  matrix       M,
@@ -111,6 +112,21 @@ void update_coords(FILE         *fplog,
 
 /* Return TRUE if OK, FALSE in case of Shake Error */
 
+void combine_forces(int nstcalclr,
+                    gmx_constr_t constr,
+                    t_inputrec *ir,t_mdatoms *md,t_idef *idef,
+                    t_commrec *cr,
+                    gmx_large_int_t step,
+                    t_state *state,gmx_bool bMolPBC,
+                    int start,int nrend,
+                    rvec f[],rvec f_lr[],
+                    t_nrnb *nrnb);
+/* Stores f plus nstcalclr-1 times f_lr in f_lr, which update_coords
+ * then uses as the force of a step with long-range forces, for twin-range
+ * cut-offs and multiple time stepping. With constr the long-range forces
+ * are constrained first.
+ */
+
 extern gmx_bool update_randomize_velocities(t_inputrec *ir, gmx_large_int_t step, t_mdatoms *md, t_state *state, gmx_update_t upd, t_idef *idef, gmx_constr_t constr);
 
 void update_constraints(FILE         *fplog,
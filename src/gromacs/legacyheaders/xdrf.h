@@ -82,6 +82,17 @@ extern const char *xdr_datatype_names[];
 /* Read or write reduced precision *float* coordinates */
 int xdr3dfcoord(XDR *xdrs, float *fp, int *size, float *precision);
 
+/* Decode the compressed part of reduced precision coordinates, as read
+ * by xdr3dfcoord, directly from the nbytes bytes cbuf, e.g. of a mapped
+ * file. precision, minint, maxint and smallidx are the values stored
+ * before the byte count. Returns 0 when smallidx is out of range or
+ * the data is corrupt and runs beyond nbytes.
+ */
+int xdr3dfcoord_decompress(const unsigned char *cbuf, int nbytes,
+                           float *fp, int size,
+                           float precision, const int minint[],
+                           const int maxint[], int smallidx);
+
 
 /* Read or write a *real* value (stored as float) */
 int xdr_real(XDR *xdrs,real *r); 
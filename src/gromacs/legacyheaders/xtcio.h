@@ -39,6 +39,7 @@
 #include "typedefs.h"
 #include "gmxfio.h"
 #include "xdrf.h"
+#include "trxmmap.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -64,11 +65,46 @@ int read_next_xtc(t_fileio *fio,
 			 matrix box,rvec *x,real *prec,gmx_bool *bOK);
 /* Read subsequent frames */
 
+int read_next_xtc_mmap(t_trxmmap *mm,gmx_off_t *pos,
+                       int natoms,int *step,real *time,
+                       matrix box,rvec *x,real *prec,gmx_bool *bOK);
+/* As read_next_xtc, but decodes the frame at offset *pos of a mapped
+ * file, without copies through an XDR stream. Advances *pos past the
+ * frame on success.
+ */
+
+gmx_off_t xtc_mmap_frame_end(t_trxmmap *mm,gmx_off_t pos,int natoms,
+                             gmx_off_t size);
+/* Returns the offset after the frame at offset pos of a mapped file,
+ * using only the frame header. Returns -1 when there is no valid frame
+ * with at most natoms atoms that ends within the first size bytes.
+ * Does not remap mm when size <= trxmmap_size(mm).
+ */
+
 int write_xtc(t_fileio *fio,
 		     int natoms,int step,real time,
 		     matrix box,rvec *x,real prec);
 /* Write a frame to xtc file */
 
+int xtc_pack_chunk(int natoms,const int *index,rvec *x,real prec,
+                   unsigned char **buf,int *nalloc);
+/* Compresses the coordinates x of natoms atoms into an xtc chunk in
+ * *buf, which is reallocated when needed. index holds the increasing
+ * output indices of the atoms. Each domain can pack its own atoms,
+ * so the compression runs in parallel. Returns the chunk size in bytes,
+ * a multiple of 4, or 0 when natoms is 0 or packing failed.
+ */
+
+int write_xtc_chunks(t_fileio *fio,
+                     int natoms,int step,real time,
+                     matrix box,real prec,
+                     int nchunk,int nbytes,unsigned char *chunks);
+/* Write a frame of natoms atoms stored as nchunk chunks from
+ * xtc_pack_chunk, concatenated in chunks of nbytes bytes. The chunks
+ * together should contain every atom once. read_next_xtc reads such
+ * frames as any other, but other programs only know standard frames.
+ */
+
 int xtc_check(const char *str,gmx_bool bResult,const char *file,int line);
 #define XTC_CHECK(s,b) xtc_check(s,b,__FILE__,__LINE__)
 
@@ -0,0 +1,83 @@
+/*
+ *
+ *                This source code is part of
+ *
+ *                 G   R   O   M   A   C   S
+ *
+ *          GROningen MAchine for Chemical Simulations
+ *
+ * Written by David van der Spoel, Erik Lindahl, Berk Hess, and others.
+ * Copyright (c) 1991-2000, University of Groningen, The Netherlands.
+ * Copyright (c) 2001-2012, The GROMACS development team,
+ * check out http://www.gromacs.org for more information.
+
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * If you want to redistribute modifications, please consider that
+ * scientific software is very special. Version control is crucial -
+ * bugs must be traceable. We will be happy to consider code for
+ * inclusion in the official distribution, but derived work must not
+ * be called official GROMACS. Details are found in the README & COPYING
+ * files - if they are missing, get the official version at www.gromacs.org.
+ *
+ * To help us fund GROMACS development, we humbly ask that you cite
+ * the papers on the package - you can find them in the top README file.
+ *
+ * For more info, check our website at http://www.gromacs.org
+ */
+#ifndef _xtcreadahead_h
+#define _xtcreadahead_h
+
+#include "typedefs.h"
+#include "futil.h"
+#include "trxmmap.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Read-ahead decompression of xtc frames from a mapped file.
+ *
+ * Decompression of xtc coordinates usually takes much longer than the
+ * analysis of a frame. Worker threads therefore decompress the frames
+ * following the one that was read last into a small ring of buffers,
+ * while the caller processes the current frame. The frame boundaries
+ * are found from the frame headers. Reading at any other offset, e.g.
+ * after a seek, discards the read-ahead frames and restarts from there.
+ * The number of threads defaults to one less than the number of cores,
+ * at most XTC_READAHEAD_MAXTHREADS, and can be set with the environment
+ * variable GMX_XTC_READ_THREADS, where 0 disables read-ahead.
+ */
+
+#define XTC_READAHEAD_MAXTHREADS 4
+
+/* Below this many atoms decompression is too cheap to hand off */
+#define XTC_READAHEAD_MINATOMS  1000
+
+typedef struct t_xtc_readahead t_xtc_readahead;
+
+t_xtc_readahead *init_xtc_readahead(t_trxmmap *mm,int natoms);
+/* Starts the read-ahead threads for frames of at most natoms atoms
+ * in mm. Returns NULL when read-ahead is disabled or not useful.
+ */
+
+int xtc_readahead_read(t_xtc_readahead *ra,gmx_off_t *pos,
+                       int *step,real *time,
+                       matrix box,rvec *x,real *prec,gmx_bool *bOK);
+/* As read_next_xtc_mmap with the natoms passed to init_xtc_readahead,
+ * returns the frame at offset *pos and queues the following frames.
+ * While read-ahead threads are running, mm should only be accessed
+ * through ra.
+ */
+
+void done_xtc_readahead(t_xtc_readahead *ra);
+/* Stops the threads and frees ra */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -50,6 +50,7 @@
 #include "shellfc.h"
 #include "mtop_util.h"
 #include "gmxfio.h"
+#include "xtcio.h"
 #include "gmx_ga2la.h"
 #include "gmx_sort.h"
 #include "macros.h"
@@ -78,6 +79,7 @@ typedef struct gmx_domdec_master
     int  *nat;     /* Number of home atoms for each node. */
     int  *ibuf;    /* Buffer for communication */
     rvec *vbuf;    /* Buffer for state scattering and gathering */
+    int  *xtc_index; /* The xtc output index of each atom, -1 if not written */
 } gmx_domdec_master_t;
 
 typedef struct
@@ -143,6 +145,12 @@ typedef struct
     int  ind;
 } gmx_cgsort_t;
 
+typedef struct
+{
+    int  ind_xtc; /* The xtc output index of the atom */
+    int  a;       /* The local atom index */
+} gmx_xtcsort_t;
+
 typedef struct
 {
     gmx_cgsort_t *sort;
@@ -296,6 +304,19 @@ typedef struct gmx_domdec_comm
     
     /* Which cg distribution is stored on the master node */
     int master_cg_ddp_count;
+
+    /* Buffer for the home atoms in the xtc output group */
+    rvec *xtc_buf;
+    int  xtc_buf_nalloc;
+    /* For xtc chunks: the xtc output index of each global atom, -1 if
+     * not written, the sorted home atoms and the compressed chunk.
+     */
+    int  *xtc_gl_index;
+    gmx_xtcsort_t *xtc_sort;
+    int  *xtc_ind;
+    int  xtc_sort_nalloc;
+    unsigned char *xtc_chunk;
+    int  xtc_chunk_nalloc;
     
     /* The number of cg's received from the direct neighbors */
     int  zone_ncg1[DD_MAXZONE];
@@ -371,6 +392,11 @@ typedef struct gmx_domdec_comm
     double load_mdf;
     double load_pme;
 
+    /* Load measurement for checking the number of PME only nodes */
+    int    npme_check_nleft;
+    double npme_check_mdf;
+    double npme_check_pme;
+
     /* The last partition step */
     gmx_large_int_t partition_step;
 
@@ -425,6 +451,9 @@ static const ivec dd_zp1[dd_zp1n] = {{0,0,2}};
 /* Allowed performance loss before we DLB or warn */
 #define DD_PERF_LOSS 0.05
 
+/* The number of load measurements for checking the number of PME nodes */
+#define DD_NPME_CHECK_NLOAD 100
+
 #define DD_CELL_F_SIZE(dd,di) ((dd)->nc[(dd)->dim[(di)]]+1+(di)*2+1+(di))
 
 /* Use separate MPI send and receive commands
@@ -1495,6 +1524,277 @@ void dd_collect_vec(gmx_domdec_t *dd,
 }
 
 
+static int dd_nat_xtc(gmx_domdec_master_t *ma,t_block *cgs_gl,int n)
+{
+    int i,c,nat;
+
+    nat = 0;
+    for(i=ma->index[n]; i<ma->index[n+1]; i++)
+    {
+        for(c=cgs_gl->index[ma->cg[i]]; c<cgs_gl->index[ma->cg[i]+1]; c++)
+        {
+            if (ma->xtc_index[c] >= 0)
+            {
+                nat++;
+            }
+        }
+    }
+
+    return nat;
+}
+
+static void dd_place_xtc(gmx_domdec_master_t *ma,t_block *cgs_gl,int n,
+                         rvec *buf,rvec *x_xtc)
+{
+    int i,c,a;
+
+    a = 0;
+    for(i=ma->index[n]; i<ma->index[n+1]; i++)
+    {
+        for(c=cgs_gl->index[ma->cg[i]]; c<cgs_gl->index[ma->cg[i]+1]; c++)
+        {
+            if (ma->xtc_index[c] >= 0)
+            {
+                copy_rvec(buf[a++],x_xtc[ma->xtc_index[c]]);
+            }
+        }
+    }
+}
+
+void dd_collect_xtc(gmx_domdec_t *dd,
+                    t_state *state_local,gmx_groups_t *groups,
+                    rvec *x_xtc)
+{
+    gmx_domdec_master_t *ma;
+    gmx_domdec_comm_t *comm;
+    t_block *cgs_gl;
+    int  ncg_home,*cg,i,c,a,n,nsel,nat,nalloc=0;
+    int  *rcounts=NULL,*disps=NULL;
+    rvec *buf=NULL;
+
+    comm   = dd->comm;
+    cgs_gl = &comm->cgs_gl;
+
+    dd_collect_cg(dd,state_local);
+
+    if (state_local->ddp_count == dd->ddp_count)
+    {
+        ncg_home = dd->ncg_home;
+        cg       = dd->index_gl;
+    }
+    else
+    {
+        ncg_home = state_local->ncg_gl;
+        cg       = state_local->cg_gl;
+    }
+
+    /* Each node packs its home atoms of the xtc group, so only these
+     * are sent. The master knows the charge group distribution,
+     * so no atom indices need to be communicated.
+     */
+    if (state_local->natoms > comm->xtc_buf_nalloc)
+    {
+        comm->xtc_buf_nalloc = over_alloc_dd(state_local->natoms);
+        srenew(comm->xtc_buf,comm->xtc_buf_nalloc);
+    }
+    nsel = 0;
+    a    = 0;
+    for(i=0; i<ncg_home; i++)
+    {
+        for(c=cgs_gl->index[cg[i]]; c<cgs_gl->index[cg[i]+1]; c++)
+        {
+            if (ggrpnr(groups,egcXTC,c) == 0)
+            {
+                copy_rvec(state_local->x[a],comm->xtc_buf[nsel++]);
+            }
+            a++;
+        }
+    }
+
+    ma = dd->ma;
+    if (DDMASTER(dd) && ma->xtc_index == NULL)
+    {
+        snew(ma->xtc_index,cgs_gl->index[cgs_gl->nr]);
+        n = 0;
+        for(c=0; c<cgs_gl->index[cgs_gl->nr]; c++)
+        {
+            ma->xtc_index[c] = (ggrpnr(groups,egcXTC,c) == 0 ? n++ : -1);
+        }
+    }
+
+    if (dd->nnodes <= GMX_DD_NNODES_SENDRECV)
+    {
+        if (!DDMASTER(dd))
+        {
+#ifdef GMX_MPI
+            MPI_Send(comm->xtc_buf,nsel*sizeof(rvec),MPI_BYTE,
+                     DDMASTERRANK(dd),dd->rank,dd->mpi_comm_all);
+#endif
+        }
+        else
+        {
+            dd_place_xtc(ma,cgs_gl,DDMASTERRANK(dd),comm->xtc_buf,x_xtc);
+            for(n=0; n<dd->nnodes; n++)
+            {
+                if (n != dd->rank)
+                {
+                    nat = dd_nat_xtc(ma,cgs_gl,n);
+                    if (nat > nalloc)
+                    {
+                        nalloc = over_alloc_dd(nat);
+                        srenew(buf,nalloc);
+                    }
+#ifdef GMX_MPI
+                    MPI_Recv(buf,nat*sizeof(rvec),MPI_BYTE,DDRANK(dd,n),
+                             n,dd->mpi_comm_all,MPI_STATUS_IGNORE);
+#endif
+                    dd_place_xtc(ma,cgs_gl,n,buf,x_xtc);
+                }
+            }
+            sfree(buf);
+        }
+    }
+    else
+    {
+        if (DDMASTER(dd))
+        {
+            rcounts = ma->ibuf;
+            disps   = ma->ibuf + dd->nnodes;
+            for(n=0; n<dd->nnodes; n++)
+            {
+                rcounts[n] = dd_nat_xtc(ma,cgs_gl,n)*sizeof(rvec);
+                disps[n]   = (n == 0 ? 0 : disps[n-1] + rcounts[n-1]);
+            }
+        }
+
+        dd_gatherv(dd,nsel*sizeof(rvec),comm->xtc_buf,rcounts,disps,
+                   DDMASTER(dd) ? ma->vbuf : NULL);
+
+        if (DDMASTER(dd))
+        {
+            for(n=0; n<dd->nnodes; n++)
+            {
+                dd_place_xtc(ma,cgs_gl,n,ma->vbuf + disps[n]/sizeof(rvec),
+                             x_xtc);
+            }
+        }
+    }
+}
+
+static int comp_xtcsort(const void *a,const void *b)
+{
+    return ((gmx_xtcsort_t *)a)->ind_xtc - ((gmx_xtcsort_t *)b)->ind_xtc;
+}
+
+void dd_collect_xtc_chunks(gmx_domdec_t *dd,
+                           t_state *state_local,gmx_groups_t *groups,
+                           real prec,int *nchunk,int *nbytes,
+                           unsigned char **chunks,int *chunks_nalloc)
+{
+    gmx_domdec_master_t *ma;
+    gmx_domdec_comm_t *comm;
+    t_block *cgs_gl;
+    int  ncg_home,*cg,i,c,a,n,nsel,nb;
+    int  *rcounts=NULL,*disps=NULL;
+
+    comm   = dd->comm;
+    cgs_gl = &comm->cgs_gl;
+
+    if (comm->xtc_gl_index == NULL)
+    {
+        snew(comm->xtc_gl_index,cgs_gl->index[cgs_gl->nr]);
+        n = 0;
+        for(c=0; c<cgs_gl->index[cgs_gl->nr]; c++)
+        {
+            comm->xtc_gl_index[c] = (ggrpnr(groups,egcXTC,c) == 0 ? n++ : -1);
+        }
+    }
+
+    if (state_local->ddp_count == dd->ddp_count)
+    {
+        ncg_home = dd->ncg_home;
+        cg       = dd->index_gl;
+    }
+    else
+    {
+        ncg_home = state_local->ncg_gl;
+        cg       = state_local->cg_gl;
+    }
+
+    /* Each node compresses its home atoms of the xtc group in xtc
+     * order, so the master only has to concatenate the chunks.
+     */
+    if (state_local->natoms > comm->xtc_sort_nalloc)
+    {
+        comm->xtc_sort_nalloc = over_alloc_dd(state_local->natoms);
+        srenew(comm->xtc_sort,comm->xtc_sort_nalloc);
+        srenew(comm->xtc_ind,comm->xtc_sort_nalloc);
+    }
+    if (state_local->natoms > comm->xtc_buf_nalloc)
+    {
+        comm->xtc_buf_nalloc = over_alloc_dd(state_local->natoms);
+        srenew(comm->xtc_buf,comm->xtc_buf_nalloc);
+    }
+    nsel = 0;
+    a    = 0;
+    for(i=0; i<ncg_home; i++)
+    {
+        for(c=cgs_gl->index[cg[i]]; c<cgs_gl->index[cg[i]+1]; c++)
+        {
+            if (comm->xtc_gl_index[c] >= 0)
+            {
+                comm->xtc_sort[nsel].ind_xtc = comm->xtc_gl_index[c];
+                comm->xtc_sort[nsel].a       = a;
+                nsel++;
+            }
+            a++;
+        }
+    }
+    qsort_threadsafe(comm->xtc_sort,nsel,sizeof(comm->xtc_sort[0]),
+                     comp_xtcsort);
+    for(i=0; i<nsel; i++)
+    {
+        comm->xtc_ind[i] = comm->xtc_sort[i].ind_xtc;
+        copy_rvec(state_local->x[comm->xtc_sort[i].a],comm->xtc_buf[i]);
+    }
+    nb = xtc_pack_chunk(nsel,comm->xtc_ind,comm->xtc_buf,prec,
+                        &comm->xtc_chunk,&comm->xtc_chunk_nalloc);
+    if (nsel > 0 && nb == 0)
+    {
+        gmx_fatal(FARGS,"XTC error - the coordinates of node %d can not be compressed",
+                  dd->rank);
+    }
+
+    ma = dd->ma;
+    if (DDMASTER(dd))
+    {
+        rcounts = ma->ibuf;
+        disps   = ma->ibuf + dd->nnodes;
+    }
+    dd_gather(dd,sizeof(int),&nb,rcounts);
+    if (DDMASTER(dd))
+    {
+        *nchunk = 0;
+        for(n=0; n<dd->nnodes; n++)
+        {
+            disps[n] = (n == 0 ? 0 : disps[n-1] + rcounts[n-1]);
+            if (rcounts[n] > 0)
+            {
+                (*nchunk)++;
+            }
+        }
+        *nbytes = disps[dd->nnodes-1] + rcounts[dd->nnodes-1];
+        if (*nbytes > *chunks_nalloc)
+        {
+            *chunks_nalloc = over_alloc_large(*nbytes);
+            srenew(*chunks,*chunks_nalloc);
+        }
+    }
+
+    dd_gatherv(dd,nb,comm->xtc_chunk,rcounts,disps,
+               DDMASTER(dd) ? *chunks : NULL);
+}
+
 void dd_collect_state(gmx_domdec_t *dd,
                       t_state *state_local,t_state *state)
 {
@@ -5373,6 +5673,85 @@ static float dd_f_imbal(gmx_domdec_t *dd)
     return dd->comm->load[0].max*dd->nnodes/dd->comm->load[0].sum - 1;
 }
 
+void dd_check_npme_start(gmx_domdec_t *dd)
+{
+    gmx_domdec_comm_t *comm;
+
+    comm = dd->comm;
+
+    if (comm->bRecordLoad && dd->pme_nodeid >= 0 && comm->npmenodes > 0)
+    {
+        comm->npme_check_nleft = DD_NPME_CHECK_NLOAD;
+        comm->npme_check_mdf   = 0;
+        comm->npme_check_pme   = 0;
+    }
+}
+
+static void dd_check_npme(FILE *fplog,gmx_domdec_t *dd,
+                          gmx_mtop_t *mtop,t_inputrec *ir,matrix box)
+{
+    gmx_domdec_comm_t *comm;
+    char  buf[STRLEN];
+    int   npp,npme,nnodes,npme_new;
+    float pme_f_ratio,t_cur,t_new,gain;
+
+    comm = dd->comm;
+
+    if (comm->npme_check_mdf <= 0)
+    {
+        return;
+    }
+
+    npp    = dd->nnodes;
+    npme   = comm->npmenodes;
+    nnodes = npp + npme;
+
+    pme_f_ratio = comm->npme_check_pme/comm->npme_check_mdf;
+    if (fplog)
+    {
+        fprintf(fplog,"\nPME mesh/force load over %d load measurements: %5.3f\n",
+                DD_NPME_CHECK_NLOAD,pme_f_ratio);
+    }
+
+    npme_new = dd_npme_from_load(fplog,mtop,ir,box,nnodes,npme,pme_f_ratio);
+    if (npme_new < 0 || npme_new == npme)
+    {
+        return;
+    }
+
+    /* Estimate the step time in units of the current PP force time,
+     * neglecting changes in the communication cost.
+     */
+    t_cur = max(1,pme_f_ratio);
+    if (npme_new == 0)
+    {
+        t_new = (npp + pme_f_ratio*npme)/nnodes;
+    }
+    else
+    {
+        t_new = max((float)npp/(nnodes - npme_new),pme_f_ratio*npme/npme_new);
+    }
+    gain = 1 - t_new/t_cur;
+
+    if (gain >= DD_PERF_LOSS)
+    {
+        sprintf(buf,
+                "NOTE: The PME nodes have %s work to do than the PP nodes,\n"
+                "      the measured PME mesh/force load is %.3f with %d PME nodes.\n"
+                "      With %d instead of %d PME nodes (mdrun option -npme)\n"
+                "      the simulation would run about %.0f %% faster.\n"
+                "      The number of PME nodes can be changed when continuing\n"
+                "      from a checkpoint, but not during a run.\n",
+                (pme_f_ratio < 1) ? "less" : "more",
+                pme_f_ratio,npme,npme_new,npme,gain*100);
+        if (fplog)
+        {
+            fprintf(fplog,"\n%s\n",buf);
+        }
+        fprintf(stderr,"\n%s\n",buf);
+    }
+}
+
 float dd_pme_f_ratio(gmx_domdec_t *dd)
 {
     if (dd->comm->cycl_n[ddCyclPME] > 0)
@@ -6386,6 +6765,8 @@ static gmx_domdec_comm_t *init_dd_comm()
     comm->load_mdf  = 0;
     comm->load_pme  = 0;
 
+    comm->npme_check_nleft = 0;
+
     return comm;
 }
 
@@ -9112,7 +9493,7 @@ void dd_partition_system(FILE            *fplog,
         /* Avoid extra communication due to verbose screen output
          * when nstglobalcomm is set.
          */
-        if (bDoDLB || bLogLoad || bCheckDLB ||
+        if (bDoDLB || bLogLoad || bCheckDLB || comm->npme_check_nleft > 0 ||
             (bVerbose && (ir->nstlist == 0 || nstglobalcomm <= ir->nstlist)))
         {
             get_load_distribution(dd,wcycle);
@@ -9129,6 +9510,20 @@ void dd_partition_system(FILE            *fplog,
             }
             comm->n_load_collect++;
 
+            if (comm->npme_check_nleft > 0)
+            {
+                if (DDMASTER(dd))
+                {
+                    comm->npme_check_mdf += comm->load[0].mdf;
+                    comm->npme_check_pme += comm->load[0].pme;
+                }
+                comm->npme_check_nleft--;
+                if (comm->npme_check_nleft == 0 && DDMASTER(dd))
+                {
+                    dd_check_npme(fplog,dd,top_global,ir,state_local->box);
+                }
+            }
+
             if (bCheckDLB) {
                 /* Since the timings are node dependent, the master decides */
                 if (DDMASTER(dd))
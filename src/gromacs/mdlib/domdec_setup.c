@@ -138,19 +138,13 @@ static gmx_bool fits_pp_pme_perf(FILE *fplog,
     return fits_pme_ratio(nnodes,npme,ratio);
 }
 
-static int guess_npme(FILE *fplog,gmx_mtop_t *mtop,t_inputrec *ir,matrix box,
-					  int nnodes)
+/* Returns the number of PME only nodes for relative PME load ratio,
+ * returns a number larger than nnodes/2 when no suitable number is found.
+ */
+static int npme_for_ratio(FILE *fplog,gmx_mtop_t *mtop,t_inputrec *ir,
+                          matrix box,int nnodes,float ratio)
 {
-	float ratio;
-	int  npme,nkx,nky;
-	t_inputrec ir_try;
-	
-	ratio = pme_load_estimate(mtop,ir,box);
-	
-	if (fplog)
-    {
-		fprintf(fplog,"Guess for relative PME load: %.2f\n",ratio);
-    }
+	int  npme;
 	
 	/* We assume the optimal node ratio is close to the load ratio.
 	 * The communication load is neglected,
@@ -199,6 +193,24 @@ static int guess_npme(FILE *fplog,gmx_mtop_t *mtop,t_inputrec *ir,matrix box,
             npme++;
         }
     }
+
+    return npme;
+}
+
+static int guess_npme(FILE *fplog,gmx_mtop_t *mtop,t_inputrec *ir,matrix box,
+					  int nnodes)
+{
+	float ratio;
+	int  npme;
+	
+	ratio = pme_load_estimate(mtop,ir,box);
+	
+	if (fplog)
+    {
+		fprintf(fplog,"Guess for relative PME load: %.2f\n",ratio);
+    }
+	
+    npme = npme_for_ratio(fplog,mtop,ir,box,nnodes,ratio);
     if (npme > nnodes/2)
     {
         gmx_fatal(FARGS,"Could not find an appropriate number of separate PME nodes. i.e. >= %5f*#nodes (%d) and <= #nodes/2 (%d) and reasonable performance wise (grid_x=%d, grid_y=%d).\n"
@@ -225,6 +237,31 @@ static int guess_npme(FILE *fplog,gmx_mtop_t *mtop,t_inputrec *ir,matrix box,
     return npme;
 }
 
+int dd_npme_from_load(FILE *fplog,gmx_mtop_t *mtop,t_inputrec *ir,matrix box,
+                      int nnodes,int npme,float pme_f_ratio)
+{
+    float ratio;
+    int   npme_new;
+
+    /* The PME and PP work are proportional to the per node load
+     * times the number of nodes doing that work.
+     */
+    ratio = pme_f_ratio*npme/(pme_f_ratio*npme + (nnodes - npme));
+
+    if (fplog)
+    {
+        fprintf(fplog,"Measured relative PME load: %.2f\n",ratio);
+    }
+
+    npme_new = npme_for_ratio(fplog,mtop,ir,box,nnodes,ratio);
+    if (npme_new > nnodes/2)
+    {
+        npme_new = -1;
+    }
+
+    return npme_new;
+}
+
 static int div_up(int n,int f)
 {
     return (n + f - 1)/f;
@@ -142,6 +142,114 @@ static int vmax(int* a, int s) {
 } 
 
 
+/* Returns TRUE when the transpose after step s transposes axes 1 and 3 */
+static int transpose13(fft5d_plan plan,int s)
+{
+    return ((s==0 && !(plan->flags&FFT5D_ORDER_YZ)) || (s==1 && (plan->flags&FFT5D_ORDER_YZ)));
+}
+
+/* The number of complex elements sent to each rank in the transpose after step s */
+static int transpose_blocksize(fft5d_plan plan,int s)
+{
+    if (transpose13(plan,s))
+    {
+        return plan->N[s]*plan->pM[s]*plan->K[s];
+    }
+    else
+    {
+        return plan->N[s]*plan->M[s]*plan->pK[s];
+    }
+}
+
+/* Returns the local line range of 1D FFTs for chunk c of step s for thread */
+static void chunk_lines(fft5d_plan plan,int s,int c,int thread,
+                        int *tstart,int *tend)
+{
+    int l0,l1;
+
+    l0 = std::min(plan->chunk_z[s][c  ],plan->pK[s])*plan->pM[s];
+    l1 = std::min(plan->chunk_z[s][c+1],plan->pK[s])*plan->pM[s];
+
+    *tstart = l0 + ( thread   *(l1 - l0))/plan->nthreads;
+    *tend   = l0 + ((thread+1)*(l1 - l0))/plan->nthreads;
+}
+
+/* Divide the transposes of decomposed dimensions into chunks along
+ * the major axis, which is the outer axis of each block of the all-to-all,
+ * and set up the 1D FFT plans for each chunk and thread.
+ */
+static void init_pipeline(fft5d_plan plan)
+{
+    int s,c,t,slicesize,blocksize,nslice,nreq;
+
+    nreq = 0;
+    for (s=0;s<2;s++)
+    {
+        plan->nchunk[s] = 0;
+#ifndef FFT5D_MPI_TRANSPOSE
+        if (plan->P[s] <= 1 || plan->cart[s] == MPI_COMM_NULL)
+        {
+            continue;
+        }
+        slicesize = plan->N[s]*plan->M[s];
+        blocksize = transpose_blocksize(plan,s);
+        if (slicesize == 0 || blocksize % slicesize != 0)
+        {
+            /* Uneven decomposition, use the normal all-to-all */
+            continue;
+        }
+        nslice = blocksize/slicesize;
+        if (std::min(FFT5D_PIPELINE_NCHUNK,nslice) < 2)
+        {
+            continue;
+        }
+        plan->nchunk[s] = std::min(FFT5D_PIPELINE_NCHUNK,nslice);
+
+        snew(plan->chunk_z[s],plan->nchunk[s]+1);
+        for (c=0;c<=plan->nchunk[s];c++)
+        {
+            plan->chunk_z[s][c] = (c*nslice)/plan->nchunk[s];
+        }
+
+        snew(plan->p1d_chunk[s],plan->nchunk[s]*plan->nthreads);
+        for (c=0;c<plan->nchunk[s];c++)
+        {
+#pragma omp parallel for num_threads(plan->nthreads) schedule(static) ordered
+            for(t=0; t<plan->nthreads; t++)
+#pragma omp ordered
+            {
+                int tstart,tend,i;
+
+                chunk_lines(plan,s,c,t,&tstart,&tend);
+                i = c*plan->nthreads + t;
+                if (tend == tstart)
+                {
+                    plan->p1d_chunk[s][i] = NULL;
+                }
+                else if ((plan->flags&FFT5D_REALCOMPLEX) && !(plan->flags&FFT5D_BACKWARD) && s==0)
+                {
+                    gmx_fft_init_many_1d_real( &plan->p1d_chunk[s][i], plan->rC[s], tend-tstart, (plan->flags&FFT5D_NOMEASURE)?GMX_FFT_FLAG_CONSERVATIVE:0 );
+                }
+                else
+                {
+                    gmx_fft_init_many_1d     ( &plan->p1d_chunk[s][i], plan->C[s], tend-tstart, (plan->flags&FFT5D_NOMEASURE)?GMX_FFT_FLAG_CONSERVATIVE:0 );
+                }
+            }
+        }
+
+        nreq = std::max(nreq,plan->nchunk[s]*2*plan->P[s]);
+
+        if (debug)
+        {
+            fprintf(debug,"FFT5D: Pipelining transpose %d in %d chunks of %d slices of %d elements\n",
+                    s,plan->nchunk[s],nslice/plan->nchunk[s],slicesize);
+        }
+#endif
+    }
+
+    snew(plan->req,nreq);
+}
+
 /* NxMxK the size of the data
  * comm communicator to use for fft5d
  * P0 number of processor in 1st axes (can be null for automatic)
@@ -370,12 +478,20 @@ fft5d_plan fft5d_plan_3d(int NG, int MG, int KG, MPI_Comm comm[2], int flags, t_
     /* int lsize = fmax(N[0]*M[0]*K[0]*nP[0],N[1]*M[1]*K[1]*nP[1]); */
     lsize = std::max(N[0]*M[0]*K[0]*nP[0],std::max(N[1]*M[1]*K[1]*nP[1],C[2]*M[2]*K[2]));
     /* int lsize = fmax(C[0]*M[0]*K[0],fmax(C[1]*M[1]*K[1],C[2]*M[2]*K[2])); */
+    /* Only pipeline the transposes when there is communication */
+    if (!(P[0]>1 || P[1]>1))
+    {
+        flags &= ~FFT5D_PIPELINE;
+    }
     if (!(flags&FFT5D_NOMALLOC)) { 
         snew_aligned(lin, lsize, 32);
         snew_aligned(lout, lsize, 32);
-        if (nthreads > 1)
+        if (nthreads > 1 || (flags&FFT5D_PIPELINE))
         {
-            /* We need extra transpose buffers to avoid OpenMP barriers */
+            /* We need extra transpose buffers to avoid OpenMP barriers
+             * and, when pipelining, to keep chunks in flight
+             * while the next chunks are transformed.
+             */
             snew_aligned(lout2, lsize, 32);
             snew_aligned(lout3, lsize, 32);
         }
@@ -388,7 +504,7 @@ fft5d_plan fft5d_plan_3d(int NG, int MG, int KG, MPI_Comm comm[2], int flags, t_
     } else {
         lin = *rlin;
         lout = *rlout;
-        if (nthreads > 1)
+        if (nthreads > 1 || (flags&FFT5D_PIPELINE))
         {
             lout2 = *rlout2;
             lout3 = *rlout3;
@@ -572,6 +688,10 @@ fft5d_plan fft5d_plan_3d(int NG, int MG, int KG, MPI_Comm comm[2], int flags, t_
 */
     plan->flags=flags;
     plan->nthreads=nthreads;
+    if (flags&FFT5D_PIPELINE)
+    {
+        init_pipeline(plan);
+    }
     *rlin=lin;
     *rlout=lout;
     *rlout2=lout2;
@@ -641,10 +761,12 @@ static void splitaxes(t_complex* lout,const t_complex* lin,
   variables see above
   the major, middle, minor order is only correct for x,y,z (N,M,K) for the input
   N,M,K local dimensions
-  KG global size*/
+  KG global size
+  only z in [startz,endz) is joined, for pipelining*/
 static void joinAxesTrans13(t_complex* lout,const t_complex* lin,
                             int maxN,int maxM,int maxK,int pN, int pM, int pK, 
-                            int P,int KG, int* K, int* oK,int starty, int startx, int endy, int endx)
+                            int P,int KG, int* K, int* oK,int starty, int startx, int endy, int endx,
+                            int startz, int endz)
 {
     int i,x,y,z;
     int out_i,in_i,out_x,in_x,out_z,in_z;
@@ -676,7 +798,7 @@ static void joinAxesTrans13(t_complex* lout,const t_complex* lin,
         {
             out_i  = out_x  + oK[i];
             in_i = in_x + i*maxM*maxN*maxK;
-            for (z=0;z<K[i];z++) /*3.l*/
+            for (z=startz;z<std::min(K[i],endz);z++) /*3.l*/
             {
                 out_z  = out_i  + z;
                 in_z = in_i + z*maxM*maxN;
@@ -840,6 +962,121 @@ static void print_localdata(const t_complex* lin, const char* txt, int s, fft5d_
     }
 }
 
+/* Post the non-blocking communication of chunk c of the transpose after step s.
+ * The chunk consists of the same range of major-axis slices of every block.
+ */
+static void post_chunk(fft5d_plan plan,int s,int c)
+{
+#ifdef GMX_MPI
+    MPI_Request *req;
+    int slicesize,blocksize,count,offset,i;
+
+    slicesize = plan->N[s]*plan->M[s];
+    blocksize = transpose_blocksize(plan,s);
+    count     = (plan->chunk_z[s][c+1] - plan->chunk_z[s][c])*slicesize*sizeof(t_complex)/sizeof(real);
+    req       = plan->req + c*2*plan->P[s];
+    for (i=0;i<plan->P[s];i++)
+    {
+        offset = i*blocksize + plan->chunk_z[s][c]*slicesize;
+        MPI_Irecv(plan->lout3+offset,count,GMX_MPI_REAL,i,c,plan->cart[s],&req[2*i]);
+        MPI_Isend(plan->lout2+offset,count,GMX_MPI_REAL,i,c,plan->cart[s],&req[2*i+1]);
+    }
+#else
+    gmx_incons("fft5d MPI call without MPI configuration");
+#endif
+}
+
+/* Executes the 1D FFTs and transpose of step s chunk by chunk.
+ * The all-to-all of each chunk is done with non-blocking point-to-point
+ * communication, which overlaps with the FFTs and local split of the next
+ * chunks. The join of a chunk is done as soon as its data has arrived.
+ * Note that the join can only start after all FFTs of this step are done,
+ * since it writes to lin.
+ */
+static void execute_pipelined(fft5d_plan plan,int s,int thread,fft5d_time times)
+{
+    t_complex *lin = plan->lin;
+    t_complex *lout = plan->lout;
+    t_complex *lout2 = plan->lout2;
+    t_complex *lout3 = plan->lout3;
+    int *N=plan->N,*M=plan->M,*K=plan->K,*pN=plan->pN,*pM=plan->pM,*pK=plan->pK,
+        *C=plan->C,*P=plan->P,**iNin=plan->iNin,**oNin=plan->oNin,**iNout=plan->iNout,**oNout=plan->oNout;
+    int c,z0,z1,tstart,tend;
+    gmx_fft_t p1d;
+
+    /* The lines of lin were joined with a different thread division */
+#pragma omp barrier
+
+    for (c=0;c<plan->nchunk[s];c++)
+    {
+        chunk_lines(plan,s,c,thread,&tstart,&tend);
+        p1d = plan->p1d_chunk[s][c*plan->nthreads+thread];
+        if (tend > tstart)
+        {
+            if ((plan->flags&FFT5D_REALCOMPLEX) && !(plan->flags&FFT5D_BACKWARD) && s==0)
+            {
+                gmx_fft_many_1d_real(p1d,GMX_FFT_REAL_TO_COMPLEX,lin+tstart*C[s],lout+tstart*C[s]);
+            }
+            else
+            {
+                gmx_fft_many_1d(     p1d,(plan->flags&FFT5D_BACKWARD)?GMX_FFT_BACKWARD:GMX_FFT_FORWARD,lin+tstart*C[s],lout+tstart*C[s]);
+            }
+            splitaxes(lout2,lout,N[s],M[s],K[s], pN[s],pM[s],pK[s],P[s],C[s],iNout[s],oNout[s],tstart%pM[s],tstart/pM[s],tend%pM[s],tend/pM[s]);
+        }
+#pragma omp barrier /*all split data of this chunk has to be there before sending*/
+        if (thread == 0)
+        {
+#ifndef NOGMX
+            wallcycle_start(times,ewcPME_FFTCOMM);
+#endif
+            post_chunk(plan,s,c);
+#ifndef NOGMX
+            wallcycle_stop(times,ewcPME_FFTCOMM);
+#endif
+        }
+    }
+
+    for (c=0;c<plan->nchunk[s];c++)
+    {
+        if (thread == 0)
+        {
+#ifndef NOGMX
+            wallcycle_start(times,ewcPME_FFTCOMM);
+#endif
+#ifdef GMX_MPI
+            MPI_Waitall(2*P[s],plan->req+c*2*P[s],MPI_STATUSES_IGNORE);
+#endif
+#ifndef NOGMX
+            wallcycle_stop(times,ewcPME_FFTCOMM);
+#endif
+        }
+#pragma omp barrier /*wait for the data of this chunk*/
+
+        z0 = plan->chunk_z[s][c];
+        z1 = plan->chunk_z[s][c+1];
+        if (transpose13(plan,s))
+        {
+            if (pM[s]>0)
+            {
+                tstart = ( thread   *pM[s]*pN[s]/plan->nthreads);
+                tend   = ((thread+1)*pM[s]*pN[s]/plan->nthreads);
+                joinAxesTrans13(lin,lout3,N[s],pM[s],K[s],pN[s],pM[s],pK[s],P[s],C[s+1],iNin[s+1],oNin[s+1],tstart%pM[s],tstart/pM[s],tend%pM[s],tend/pM[s],z0,z1);
+            }
+        }
+        else
+        {
+            z1 = std::min(z1,pK[s]);
+            if (pN[s]>0 && z1>z0)
+            {
+                tstart = z0*pN[s] + ( thread   *(z1-z0)*pN[s]/plan->nthreads);
+                tend   = z0*pN[s] + ((thread+1)*(z1-z0)*pN[s]/plan->nthreads);
+                joinAxesTrans12(lin,lout3,N[s],M[s],pK[s],pN[s],pM[s],pK[s],P[s],C[s+1],iNin[s+1],oNin[s+1],tstart%pN[s],tstart/pN[s],tend%pN[s],tend/pN[s]);
+            }
+        }
+    }
+#pragma omp barrier /*the join is not divided over threads as the next FFT*/
+}
+
 void fft5d_execute(fft5d_plan plan,int thread,fft5d_time times) {
     t_complex *lin = plan->lin;
     t_complex *lout = plan->lout;
@@ -906,6 +1143,16 @@ void fft5d_execute(fft5d_plan plan,int thread,fft5d_time times) {
             bParallelDim = 0;
         }
 
+        if (bParallelDim && plan->nchunk[s] > 0)
+        {
+            execute_pipelined(plan,s,thread,times);
+            if (plan->flags&FFT5D_DEBUG && thread == 0)
+            {
+                print_localdata(lin, "%d %d: tranposed %d\n", s+1, plan);
+            }
+            continue;
+        }
+
         /* ---------- START FFT ------------ */
 #ifdef NOGMX
         if (times!=0 && thread == 0)
@@ -1037,7 +1284,7 @@ llToAll
             {
                 tstart = ( thread   *pM[s]*pN[s]/plan->nthreads);
                 tend   = ((thread+1)*pM[s]*pN[s]/plan->nthreads);
-                joinAxesTrans13(lin,joinin,N[s],pM[s],K[s],pN[s],pM[s],pK[s],P[s],C[s+1],iNin[s+1],oNin[s+1],tstart%pM[s],tstart/pM[s],tend%pM[s],tend/pM[s]);
+                joinAxesTrans13(lin,joinin,N[s],pM[s],K[s],pN[s],pM[s],pK[s],P[s],C[s+1],iNin[s+1],oNin[s+1],tstart%pM[s],tstart/pM[s],tend%pM[s],tend/pM[s],0,K[s]);
             }
         }
         else {
@@ -1152,12 +1399,29 @@ void fft5d_destroy(fft5d_plan plan) {
     {
         sfree_aligned(plan->lin);
         sfree_aligned(plan->lout);
-        if (plan->nthreads > 1)
+        if (plan->lout2 != plan->lin)
         {
             sfree_aligned(plan->lout2);
             sfree_aligned(plan->lout3);
         }
     }
+
+    for (s=0;s<2;s++)
+    {
+        if (plan->nchunk[s] > 0)
+        {
+            for (t=0;t<plan->nchunk[s]*plan->nthreads;t++)
+            {
+                if (plan->p1d_chunk[s][t])
+                {
+                    gmx_many_fft_destroy(plan->p1d_chunk[s][t]);
+                }
+            }
+            sfree(plan->p1d_chunk[s]);
+            sfree(plan->chunk_z[s]);
+        }
+    }
+    sfree(plan->req);
     
 #ifdef FFT5D_THREADS
 #ifdef FFT5D_FFTW_THREADS
@@ -85,9 +85,16 @@ typedef enum fft5d_flags_t {
     FFT5D_DEBUG=8,
     FFT5D_NOMEASURE=16,
     FFT5D_INPLACE=32,
-    FFT5D_NOMALLOC=64
+    FFT5D_NOMALLOC=64,
+    FFT5D_PIPELINE=128
 } fft5d_flags;
 
+/* With FFT5D_PIPELINE the transposes of decomposed dimensions are split
+ * into this many chunks along the major axis, so the communication of a chunk
+ * overlaps with the 1D FFTs of the next chunks.
+ */
+#define FFT5D_PIPELINE_NCHUNK 4
+
 struct fft5d_plan_t {
     t_complex *lin;
     t_complex *lout,*lout2,*lout3;
@@ -116,6 +123,11 @@ struct fft5d_plan_t {
   /*int P[2];*/
     int coor[2];
     int nthreads;
+    /* Pipelined transposes, only used with FFT5D_PIPELINE */
+    int nchunk[2];           /* number of chunks for step s, 0: not pipelined */
+    int *chunk_z[2];         /* major-axis chunk boundaries, nchunk+1 entries */
+    gmx_fft_t *p1d_chunk[2]; /* 1D plans for each chunk and thread */
+    MPI_Request *req;        /* send+receive requests for each chunk */
 }; 
 
 typedef struct fft5d_plan_t *fft5d_plan;
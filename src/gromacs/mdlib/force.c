@@ -197,10 +197,13 @@ void do_force_lowlevel(FILE       *fplog,   gmx_large_int_t step,
     bSepDVDL=(fr->bSepDVDL && do_per_step(step,ir->nstlog));
     debug_gmx();
 
-    /* do QMMM first if requested */
-    if(fr->bQMMM)
+    /* do QMMM first if requested, unless it runs concurrently */
+    if(fr->bQMMM && fr->qr->async == NULL)
     {
-        enerd->term[F_EQM] = calculate_QMMM(cr,x,f,fr,md);
+        enerd->term[F_EQM] = calculate_QMMM(fplog,step,cr,x,f,fr,md,
+                                            (flags & GMX_FORCE_QMMM_FULL),
+                                            wcycle);
+        enerd->QMnscf      = fr->qr->nSCF;
     }
 
     if (bSepDVDL)
@@ -545,14 +548,24 @@ void do_force_lowlevel(FILE       *fplog,   gmx_large_int_t step,
             if (cr->duty & DUTY_PME)
             {
                 assert(fr->n_tpi >= 0);
-                if (fr->n_tpi == 0 || (flags & GMX_FORCE_STATECHANGED))
+                if (fr->nstpme > 1 && !(flags & GMX_FORCE_PME_MESH))
+                {
+                    /* Between mesh steps we reuse the mesh energy and
+                     * virial, the mesh force is only applied on mesh steps.
+                     */
+                    Vlr  = fr->pme_mts_ener;
+                    dvdl = fr->pme_mts_dvdl;
+                    m_add(fr->vir_el_recip,fr->pme_mts_vir,fr->vir_el_recip);
+                }
+                else if (fr->n_tpi == 0 || (flags & GMX_FORCE_STATECHANGED))
                 {
                     pme_flags = GMX_PME_SPREAD_Q | GMX_PME_SOLVE;
                     if (flags & GMX_FORCE_FORCES)
                     {
                         pme_flags |= GMX_PME_CALC_F;
                     }
-                    if (flags & (GMX_FORCE_VIRIAL | GMX_FORCE_ENERGY))
+                    if ((flags & (GMX_FORCE_VIRIAL | GMX_FORCE_ENERGY)) ||
+                        fr->nstpme > 1)
                     {
                         pme_flags |= GMX_PME_CALC_ENER_VIR;
                     }
@@ -561,20 +574,39 @@ void do_force_lowlevel(FILE       *fplog,   gmx_large_int_t step,
                         /* We don't calculate f, but we do want the potential */
                         pme_flags |= GMX_PME_CALC_POT;
                     }
+                    if (fr->nstpme > 1)
+                    {
+                        /* Store the mesh part separately for the impulse */
+                        clear_rvecs(fr->natoms_force_constr,fr->f_pme_mts);
+                        clear_mat(fr->pme_mts_vir);
+                    }
                     wallcycle_start(wcycle,ewcPMEMESH);
                     status = gmx_pme_do(fr->pmedata,
                                         md->start,md->homenr - fr->n_tpi,
-                                        x,fr->f_novirsum,
+                                        x,
+                                        fr->nstpme > 1 ? fr->f_pme_mts : fr->f_novirsum,
                                         md->chargeA,md->chargeB,
                                         bSB ? boxs : box,cr,
                                         DOMAINDECOMP(cr) ? dd_pme_maxshift_x(cr->dd) : 0,
                                         DOMAINDECOMP(cr) ? dd_pme_maxshift_y(cr->dd) : 0,
                                         nrnb,wcycle,
-                                        fr->vir_el_recip,fr->ewaldcoeff,
+                                        fr->nstpme > 1 ? fr->pme_mts_vir : fr->vir_el_recip,
+                                        fr->ewaldcoeff,
                                         &Vlr,lambda[efptCOUL],&dvdl,
                                         pme_flags);
                     *cycles_pme = wallcycle_stop(wcycle,ewcPMEMESH);
 
+                    if (fr->nstpme > 1)
+                    {
+                        fr->pme_mts_ener = Vlr;
+                        fr->pme_mts_dvdl = dvdl;
+                        for(i=md->start; i<md->start+md->homenr; i++)
+                        {
+                            rvec_inc(fr->f_novirsum[i],fr->f_pme_mts[i]);
+                        }
+                        m_add(fr->vir_el_recip,fr->pme_mts_vir,fr->vir_el_recip);
+                    }
+
                     /* We should try to do as little computation after
                      * this as possible, because parallel PME synchronizes
                      * the nodes, so we want all load imbalance of the rest
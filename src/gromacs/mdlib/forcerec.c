@@ -1272,6 +1272,10 @@ void forcerec_set_ranges(t_forcerec *fr,
         {
             srenew(fr->f_twin,fr->nalloc_force);
         }
+        if (fr->nstpme > 1)
+        {
+            srenew(fr->f_pme_mts,fr->nalloc_force);
+        }
     }
 
     if (fr->bF_NoVirSum)
@@ -1372,6 +1376,32 @@ gmx_bool can_use_allvsall(const t_inputrec *ir, const gmx_mtop_t *mtop,
 }
 
 
+static void init_forcerec_nb_threads(FILE *fp,t_forcerec *fr,int nenergrp)
+{
+    int t,i;
+
+    /* Thread 0 uses the global force and energy arrays */
+    snew(fr->f_t_nb,fr->nthread_ns);
+    for(t=1; t<fr->nthread_ns; t++)
+    {
+        fr->f_t_nb[t].f = NULL;
+        fr->f_t_nb[t].f_nalloc = 0;
+        fr->f_t_nb[t].dvda = NULL;
+        snew(fr->f_t_nb[t].fshift,SHIFTS);
+        fr->f_t_nb[t].grpp.nener = nenergrp*nenergrp;
+        for(i=0; i<egNR; i++)
+        {
+            snew(fr->f_t_nb[t].grpp.ener[i],fr->f_t_nb[t].grpp.nener);
+        }
+    }
+
+    if (fp && fr->nthread_ns > 1)
+    {
+        fprintf(fp,"Using %d sets of group scheme neighbor lists, one per thread\n",
+                fr->nthread_ns);
+    }
+}
+
 static void init_forcerec_f_threads(t_forcerec *fr,int nenergrp)
 {
     int t,i;
@@ -1411,6 +1441,7 @@ static void pick_nbnxn_kernel_cpu(FILE *fp,
     {
         /* On Intel Sandy-Bridge AVX-256 kernels are always faster.
          * On AMD Bulldozer AVX-256 is much slower than AVX-128.
+         * When the CPU supports it, the AVX-512 kernels are faster still.
          */
         if(gmx_cpuid_feature(cpuid_info, GMX_CPUID_FEATURE_X86_AVX) == 1 &&
            gmx_cpuid_vendor(cpuid_info) != GMX_CPUID_VENDOR_AMD)
@@ -1419,6 +1450,12 @@ static void pick_nbnxn_kernel_cpu(FILE *fp,
             *kernel_type = nbk4xN_X86_SIMD256;
 #else
             *kernel_type = nbk4xN_X86_SIMD128;
+#endif
+#ifdef GMX_X86_AVX_512
+            if (gmx_cpuid_feature(cpuid_info, GMX_CPUID_FEATURE_X86_AVX512F) == 1)
+            {
+                *kernel_type = nbk4xN_X86_SIMD512;
+            }
 #endif
         }
         else
@@ -1438,6 +1475,14 @@ static void pick_nbnxn_kernel_cpu(FILE *fp,
             gmx_fatal(FARGS,"You requested AVX-256 nbnxn kernels, but GROMACS was built without AVX support");
 #endif
         }
+        if (getenv("GMX_NBNXN_AVX512") != NULL)
+        {
+#ifdef GMX_X86_AVX_512
+            *kernel_type = nbk4xN_X86_SIMD512;
+#else
+            gmx_fatal(FARGS,"You requested AVX-512 nbnxn kernels, but GROMACS was built without AVX-512 support");
+#endif
+        }
 
         /* Analytical Ewald exclusion correction is only an option in the
          * x86 SIMD kernel. This is faster in single precision
@@ -1492,6 +1537,11 @@ static const char *nbk_name[] =
     "AVX-256 4x8",
 #else
     "AVX-256 4x4",
+#endif
+#ifndef GMX_DOUBLE
+    "AVX-512 2x(8+8)",
+#else
+    "AVX-512 2x(4+4)",
 #endif
     "CUDA 8x8x8", "plain C 8x8x8" };
 
@@ -1670,6 +1720,39 @@ void init_interaction_const_tables(FILE *fp,
     }
 }
 
+static void force_switch_constants(real p,
+                                   real rsw,real rc,
+                                   real *c2,real *c3,real *cpot)
+{
+    /* Here we determine the coefficient for shifting the force to zero
+     * between distance rsw and the cut-off rc.
+     * For a potential of r^-p, we have force p*r^-(p+1).
+     * But to save flops we absorb p in the coefficient.
+     * Thus we get, with t = max(r - rsw, 0):
+     * force/p   = r^-(p+1) + c2*t^2 + c3*t^3
+     * potential = r^-p - c2/3*p*t^3 - c3/4*p*t^4 + cpot
+     */
+    *c2   =  ((p + 1)*rsw - (p + 4)*rc)/(pow(rc,p + 2)*sqr(rc - rsw));
+    *c3   = -((p + 1)*rsw - (p + 3)*rc)/(pow(rc,p + 2)*pow(rc - rsw,3));
+    *cpot = -pow(rc,-p) + p*(*c2)/3*pow(rc - rsw,3) + p*(*c3)/4*pow(rc - rsw,4);
+}
+
+static void potential_switch_constants(real rsw,real rc,
+                                       real *c3,real *c4,real *c5)
+{
+    /* The switch function is 1 at rsw and 0 at rc.
+     * The derivative and second derivative are zero at both ends.
+     * t          = max(r - rsw, 0)
+     * sw         = 1 + c3*t^3 + c4*t^4 + c5*t^5
+     * dsw        = 3*c3*t^2 + 4*c4*t^3 + 5*c5*t^4
+     * force      = force*sw - potential*dsw
+     * potential *= sw
+     */
+    *c3 = -10*pow(rc - rsw,-3);
+    *c4 =  15*pow(rc - rsw,-4);
+    *c5 =  -6*pow(rc - rsw,-5);
+}
+
 void init_interaction_const(FILE *fp, 
                             interaction_const_t **interaction_const,
                             const t_forcerec *fr,
@@ -1689,7 +1772,9 @@ void init_interaction_const(FILE *fp,
     ic->rlistlong   = fr->rlistlong;
     
     /* Lennard-Jones */
-    ic->rvdw        = fr->rvdw;
+    ic->vdw_modifier = fr->vdw_modifier;
+    ic->rvdw         = fr->rvdw;
+    ic->rvdw_switch  = fr->rvdw_switch;
     if (fr->vdw_modifier==eintmodPOTSHIFT)
     {
         ic->sh_invrc6 = pow(ic->rvdw,-6.0);
@@ -1699,6 +1784,28 @@ void init_interaction_const(FILE *fp,
         ic->sh_invrc6 = 0;
     }
 
+    switch (ic->vdw_modifier)
+    {
+        case eintmodFORCESWITCH:
+            force_switch_constants(6.0,ic->rvdw_switch,ic->rvdw,
+                                   &ic->dispersion_shift_c2,
+                                   &ic->dispersion_shift_c3,
+                                   &ic->dispersion_shift_cpot);
+            force_switch_constants(12.0,ic->rvdw_switch,ic->rvdw,
+                                   &ic->repulsion_shift_c2,
+                                   &ic->repulsion_shift_c3,
+                                   &ic->repulsion_shift_cpot);
+            break;
+        case eintmodPOTSWITCH:
+            potential_switch_constants(ic->rvdw_switch,ic->rvdw,
+                                       &ic->vdw_switch_c3,
+                                       &ic->vdw_switch_c4,
+                                       &ic->vdw_switch_c5);
+            break;
+        default:
+            break;
+    }
+
     /* Electrostatics */
     ic->eeltype     = fr->eeltype;
     ic->rcoulomb    = fr->rcoulomb;
@@ -1740,8 +1847,22 @@ void init_interaction_const(FILE *fp,
 
     if (fp != NULL)
     {
-        fprintf(fp,"Potential shift: LJ r^-12: %.3f r^-6 %.3f",
-                sqr(ic->sh_invrc6),ic->sh_invrc6);
+        if (ic->vdw_modifier == eintmodFORCESWITCH)
+        {
+            fprintf(fp,"Force-switched LJ from %g to %g nm, potential shift: LJ r^-12: %.3f r^-6 %.3f",
+                    ic->rvdw_switch,ic->rvdw,
+                    -ic->repulsion_shift_cpot,-ic->dispersion_shift_cpot);
+        }
+        else if (ic->vdw_modifier == eintmodPOTSWITCH)
+        {
+            fprintf(fp,"Potential-switched LJ from %g to %g nm, potential shift: LJ none",
+                    ic->rvdw_switch,ic->rvdw);
+        }
+        else
+        {
+            fprintf(fp,"Potential shift: LJ r^-12: %.3f r^-6 %.3f",
+                    sqr(ic->sh_invrc6),ic->sh_invrc6);
+        }
         if (ic->eeltype == eelCUT)
         {
             fprintf(fp,", Coulomb %.3f",ic->c_rf);
@@ -1822,6 +1943,17 @@ static void init_nb_verlet(FILE *fp,
 
     if (nbv->bUseGPU)
     {
+        if (fr->vdw_modifier == eintmodPOTSWITCH ||
+            fr->vdw_modifier == eintmodFORCESWITCH)
+        {
+            gmx_fatal(FARGS,"Switched or shifted Lennard-Jones interactions with the Verlet cut-off scheme are not supported on GPUs, use mdrun -nb cpu");
+        }
+        if (fr->rcoulomb != fr->rvdw &&
+            !(EEL_PME(fr->eeltype) || fr->eeltype == eelEWALD))
+        {
+            gmx_fatal(FARGS,"With the Verlet cut-off scheme on GPUs rcoulomb > rvdw is only supported with Ewald electrostatics, use mdrun -nb cpu");
+        }
+
         /* init the NxN GPU data; the last argument tells whether we'll have
          * both local and non-local NB calculation on GPU */
         nbnxn_cuda_init(fp, &nbv->cu_nbv,
@@ -1889,9 +2021,13 @@ static void init_nb_verlet(FILE *fp,
             nbv->grp[0].kernel_type != nbv->grp[i].kernel_type)
         {
             snew(nbv->grp[i].nbat,1);
+            /* The switched LJ kernels only use the full LJ parameter matrix */
             nbnxn_atomdata_init(fp,
                                 nbv->grp[i].nbat,
                                 nbv->grp[i].kernel_type,
+                                (fr->vdw_modifier == eintmodPOTSWITCH ||
+                                 fr->vdw_modifier == eintmodFORCESWITCH) ?
+                                enbnxninitcombruleNONE : enbnxninitcombruleDETECT,
                                 fr->ntype,fr->nbfp,
                                 ir->opts.ngener,
                                 nbnxn_kernel_pairlist_simple(nbv->grp[i].kernel_type) ? gmx_omp_nthreads_get(emntNonbonded) : 1,
@@ -1904,6 +2040,113 @@ static void init_nb_verlet(FILE *fp,
     }
 }
 
+/* Sets up the free-energy pair lists and their thread output. The
+ * perturbed atoms are taken out of the cluster kernels and all their
+ * non-bonded interactions are computed with the soft-core kernel.
+ */
+static void init_nb_verlet_fep(FILE *fp,t_forcerec *fr,int nenergrp)
+{
+    nonbonded_verlet_t *nbv;
+    int ielec,i,t;
+
+    nbv = fr->nbv;
+    for(i=0; i<nbv->ngrp; i++)
+    {
+        if (!nbnxn_kernel_pairlist_simple(nbv->grp[i].kernel_type))
+        {
+            gmx_fatal(FARGS,"Free-energy calculations with the Verlet cut-off scheme are not supported on GPUs, use mdrun -nb cpu");
+        }
+    }
+
+    if (EEL_PME(fr->eeltype) || fr->eeltype == eelEWALD)
+    {
+        ielec = GMX_NBKERNEL_ELEC_EWALD;
+    }
+    else if (EEL_RF(fr->eeltype))
+    {
+        ielec = GMX_NBKERNEL_ELEC_REACTIONFIELD;
+    }
+    else
+    {
+        ielec = GMX_NBKERNEL_ELEC_COULOMB;
+    }
+    for(i=0; i<nbv->ngrp; i++)
+    {
+        nbnxn_init_pairlist_fep(&nbv->grp[i].nbl_lists,
+                                ielec,GMX_NBKERNEL_VDW_LENNARDJONES);
+    }
+
+    fr->nthreads_fep = nbv->grp[0].nbl_lists.nnbl;
+    snew(fr->f_t_fep,fr->nthreads_fep);
+    for(t=1; t<fr->nthreads_fep; t++)
+    {
+        fr->f_t_fep[t].f = NULL;
+        fr->f_t_fep[t].f_nalloc = 0;
+        snew(fr->f_t_fep[t].fshift,SHIFTS);
+        fr->f_t_fep[t].grpp.nener = nenergrp*nenergrp;
+        for(i=0; i<egNR; i++)
+        {
+            snew(fr->f_t_fep[t].grpp.ener[i],fr->f_t_fep[t].grpp.nener);
+        }
+    }
+
+    if (fp)
+    {
+        fprintf(fp,"Using a free-energy pair list for the perturbed atoms on %d thread%s\n",
+                fr->nthreads_fep,fr->nthreads_fep > 1 ? "s" : "");
+    }
+}
+
+static void init_pme_mts(FILE *fp,const t_commrec *cr,const t_inputrec *ir,
+                         t_forcerec *fr)
+{
+    char *env;
+
+    /* With PME mesh multiple time stepping the reciprocal space part
+     * is only computed every nstpme steps and applied as an impulse
+     * of nstpme times the mesh force in update_coords.
+     */
+    fr->nstpme = 1;
+    env = getenv("GMX_PME_NSTMESH");
+    if (env == NULL || !EEL_PME(fr->eeltype))
+    {
+        return;
+    }
+    sscanf(env,"%d",&fr->nstpme);
+    if (fr->nstpme < 1)
+    {
+        gmx_fatal(FARGS,"GMX_PME_NSTMESH should be 1 or larger");
+    }
+    if (fr->nstpme == 1)
+    {
+        return;
+    }
+    if (!EI_DYNAMICS(ir->eI) || EI_VV(ir->eI))
+    {
+        if (MASTER(cr))
+        {
+            fprintf(stderr,"Note: PME mesh multiple time stepping is only supported "
+                    "with leap-frog type integrators, ignoring GMX_PME_NSTMESH\n");
+        }
+        fr->nstpme = 1;
+        return;
+    }
+    if (fr->bTwinRange && ir->nstcalclr > 1)
+    {
+        gmx_fatal(FARGS,"PME mesh multiple time stepping can not be combined with "
+                  "twin-range interactions (nstcalclr > 1)");
+    }
+
+    if (fp)
+    {
+        fprintf(fp,"Computing the PME mesh part every %d steps\n",fr->nstpme);
+    }
+    if (MASTER(cr))
+    {
+        fprintf(stderr,"Computing the PME mesh part every %d steps\n",fr->nstpme);
+    }
+}
+
 void init_forcerec(FILE *fp,
                    const output_env_t oenv,
                    t_forcerec *fr,
@@ -2272,6 +2515,27 @@ void init_forcerec(FILE *fp,
         }
         fr->bvdwtab  = FALSE;
         fr->bcoultab = FALSE;
+
+        /* The Verlet kernels implement switched and shifted LJ
+         * as modifiers of plain cut-off LJ. The dispersion correction
+         * uses the tables, which are set up based on vdwtype.
+         */
+        if (fr->vdwtype == evdwSWITCH)
+        {
+            fr->vdw_modifier = eintmodPOTSWITCH;
+        }
+        else if (fr->vdwtype == evdwSHIFT)
+        {
+            fr->vdw_modifier = eintmodFORCESWITCH;
+        }
+        else if (fr->vdw_modifier == eintmodPOTSWITCH)
+        {
+            fr->vdwtype      = evdwSWITCH;
+        }
+        else if (fr->vdw_modifier == eintmodFORCESWITCH)
+        {
+            fr->vdwtype      = evdwSHIFT;
+        }
     }
     
     /* Tables are used for direct ewald sum */
@@ -2308,6 +2572,8 @@ void init_forcerec(FILE *fp,
                     1/fr->ewaldcoeff);
         }
     }
+
+    init_pme_mts(fp,cr,ir,fr);
     
     /* Electrostatics */
     fr->epsilon_r  = ir->epsilon_r;
@@ -2369,7 +2635,7 @@ void init_forcerec(FILE *fp,
                       fr->rvdw_switch,fr->rvdw);
         if (fp)
             fprintf(fp,"Using %s Lennard-Jones, switch between %g and %g nm\n",
-                    (fr->eeltype==eelSWITCH) ? "switched":"shifted",
+                    (fr->vdwtype==evdwSWITCH) ? "switched":"shifted",
                     fr->rvdw_switch,fr->rvdw);
     } 
     
@@ -2464,6 +2730,9 @@ void init_forcerec(FILE *fp,
      * but what the heck... */
     
     bTab = fr->bcoultab || fr->bvdwtab || fr->bEwald;
+    /* The dispersion correction for switched LJ integrates the LJ tables */
+    bTab = bTab || (fr->eDispCorr != edispcNO &&
+                    (fr->vdwtype == evdwSWITCH || fr->vdwtype == evdwSHIFT));
 
     bSep14tab = ((!bTab || fr->eeltype!=eelCUT || fr->vdwtype!=evdwCUT ||
                   fr->bBHAM || fr->bEwald) &&
@@ -2503,7 +2772,16 @@ void init_forcerec(FILE *fp,
         fr->nnblists*=2;
     }
 
-    snew(fr->nblists,fr->nnblists);
+    /* With the group scheme we search and compute the non-bondeds
+     * with a separate set of lists for each thread.
+     * The generalized Born radii and chain rule use the same threads.
+     */
+    fr->nthread_ns = 1;
+    if (fr->cutoff_scheme == ecutsGROUP)
+    {
+        fr->nthread_ns = max(1,gmx_omp_nthreads_get(emntNonbonded));
+    }
+    snew(fr->nblists,fr->nnblists*fr->nthread_ns);
     
     /* This code automatically gives table length tabext without cut-off's,
      * in that case grompp should already have checked that we do not need
@@ -2650,17 +2928,25 @@ void init_forcerec(FILE *fp,
 
     /* Initialize the thread working data for bonded interactions */
     init_forcerec_f_threads(fr,mtop->groups.grps[egcENER].nr);
+
+    /* Initialize the thread output data of the group scheme kernels */
+    init_forcerec_nb_threads(fp,fr,mtop->groups.grps[egcENER].nr);
     
     snew(fr->excl_load,fr->nthreads+1);
 
     if (fr->cutoff_scheme == ecutsVERLET)
     {
-        if (ir->rcoulomb != ir->rvdw)
+        if (ir->rcoulomb < ir->rvdw)
         {
-            gmx_fatal(FARGS,"With Verlet lists rcoulomb and rvdw should be identical");
+            gmx_fatal(FARGS,"With Verlet lists rcoulomb should be equal to or larger than rvdw");
         }
 
         init_nb_verlet(fp, &fr->nbv, ir, fr, cr, nbpu_opt);
+
+        if (fr->efep != efepNO)
+        {
+            init_nb_verlet_fep(fp,fr,mtop->groups.grps[egcENER].nr);
+        }
     }
 
     /* fr->ic is used both by verlet and group kernels (to some extent) now */
@@ -396,6 +396,8 @@ int init_gb(gmx_genborn_t **p_born,
     fr->nalloc_dadx       = 0;
     born->gpol_still_work = NULL;
     born->gpol_hct_work   = NULL;
+    born->gpol_work_t     = NULL;
+    born->gpol_work_t_nalloc = 0;
     
     /* snew(born->asurf,natoms); */
     /* snew(born->dasurf,natoms); */
@@ -482,29 +484,127 @@ int init_gb(gmx_genborn_t **p_born,
 
 
 
-static int
-calc_gb_rad_still(t_commrec *cr, t_forcerec *fr,int natoms, gmx_localtop_t *top,
-                  const t_atomtypes *atype, rvec x[], t_nblist *nl, 
-                  gmx_genborn_t *born,t_mdatoms *md)
-{    
-    int i,k,n,nj0,nj1,ai,aj,type;
+typedef void
+gb_rad_pairs_t(t_forcerec *fr, gmx_localtop_t *top, rvec x[], t_nblist *nl,
+               gmx_genborn_t *born, t_mdatoms *md, int i0, int i1, real *work);
+
+/* Returns the first i-entry of nl for thread th out of nthread,
+ * such that each thread gets about the same number of j-particles.
+ */
+static int gb_nblist_thread_start(const t_nblist *nl,int th,int nthread)
+{
+    int i,nrj_start;
+
+    if (th == 0)
+    {
+        return 0;
+    }
+    if (th == nthread)
+    {
+        return nl->nri;
+    }
+    nrj_start = (int)(((gmx_large_int_t)nl->nrj*th)/nthread);
+    i = 0;
+    while (i < nl->nri && nl->jindex[i] < nrj_start)
+    {
+        i++;
+    }
+
+    return i;
+}
+
+/* Computes the radii sums of gb_rad_pairs over the GB neighborlist nl
+ * into work, using fr->nthread_ns threads with thread local work arrays.
+ * The chain rule terms of each pair are stored at 2*j-index in fr->dadx,
+ * so the threads can write these without synchronization.
+ */
+static void
+calc_gb_rad_threads(t_forcerec *fr, gmx_localtop_t *top, rvec x[], t_nblist *nl,
+                    gmx_genborn_t *born, t_mdatoms *md,
+                    gb_rad_pairs_t *gb_rad_pairs, real *work)
+{
+    int nthread,th,i;
+
+    nthread = fr->nthread_ns;
+
+    for(i=0;i<born->nr;i++)
+    {
+        work[i] = 0;
+    }
+
+    if (nthread == 1)
+    {
+        gb_rad_pairs(fr,top,x,nl,born,md,0,nl->nri,work);
+
+        return;
+    }
+
+    if (born->gpol_work_t == NULL)
+    {
+        snew(born->gpol_work_t,nthread);
+    }
+    if (fr->natoms_force > born->gpol_work_t_nalloc)
+    {
+        born->gpol_work_t_nalloc = over_alloc_large(fr->natoms_force);
+        for(th=1; th<nthread; th++)
+        {
+            srenew(born->gpol_work_t[th],born->gpol_work_t_nalloc);
+        }
+    }
+
+#pragma omp parallel for num_threads(nthread) schedule(static)
+    for(th=0; th<nthread; th++)
+    {
+        real *work_th;
+        int  a;
+
+        if (th == 0)
+        {
+            work_th = work;
+        }
+        else
+        {
+            work_th = born->gpol_work_t[th];
+            for(a=0; a<fr->natoms_force; a++)
+            {
+                work_th[a] = 0;
+            }
+        }
+
+        gb_rad_pairs(fr,top,x,nl,born,md,
+                     gb_nblist_thread_start(nl,th,nthread),
+                     gb_nblist_thread_start(nl,th+1,nthread),
+                     work_th);
+    }
+
+#pragma omp parallel for num_threads(nthread) schedule(static)
+    for(i=0; i<fr->natoms_force; i++)
+    {
+        int t;
+
+        for(t=1; t<nthread; t++)
+        {
+            work[i] += born->gpol_work_t[t][i];
+        }
+    }
+}
+
+static void
+calc_gb_rad_still_pairs(t_forcerec *fr, gmx_localtop_t *top, rvec x[], t_nblist *nl,
+                        gmx_genborn_t *born, t_mdatoms *md, int i0, int i1, real *work)
+{
+    int i,k,n,nj0,nj1,ai,aj;
     int shift;
     real shX,shY,shZ;
-    real gpi,dr,dr2,dr4,idr4,rvdw,ratio,ccf,theta,term,rai,raj;
+    real gpi,dr2,idr4,rvdw,ratio,ccf,theta,term,rai,raj;
     real ix1,iy1,iz1,jx1,jy1,jz1,dx11,dy11,dz11;
-    real rinv,idr2,idr6,vaj,dccf,cosq,sinq,prod,gpi2;
-    real factor;
+    real rinv,idr2,idr6,vaj,dccf,cosq,sinq,prod;
     real vai, prod_ai, icf4,icf6;
     
-    factor  = 0.5*ONE_4PI_EPS0;
-    n       = 0;
+    /* Each pair stores two chain rule terms */
+    n       = 2*nl->jindex[i0];
     
-    for(i=0;i<born->nr;i++)
-    {
-        born->gpol_still_work[i]=0;
-    }
-     
-	for(i=0;i<nl->nri;i++ )
+	for(i=i0;i<i1;i++ )
     {
         ai      = nl->iinr[i];
         
@@ -571,15 +671,30 @@ calc_gb_rad_still(t_commrec *cr, t_forcerec *fr,int natoms, gmx_localtop_t *top,
             icf4          = ccf*idr4;
             icf6          = (4*ccf-dccf)*idr6;
 
-            born->gpol_still_work[aj] += prod_ai*icf4;
+            work[aj]       += prod_ai*icf4;
             gpi             = gpi+prod*icf4;
             
             /* Save ai->aj and aj->ai chain rule terms */
             fr->dadx[n++]   = prod*icf6;
             fr->dadx[n++]   = prod_ai*icf6;
         }
-        born->gpol_still_work[ai]+=gpi;
+        work[ai] += gpi;
     }
+}
+
+static int
+calc_gb_rad_still(t_commrec *cr, t_forcerec *fr,int natoms, gmx_localtop_t *top,
+                  const t_atomtypes *atype, rvec x[], t_nblist *nl, 
+                  gmx_genborn_t *born,t_mdatoms *md)
+{    
+    int i;
+    real gpi,gpi2;
+    real factor;
+    
+    factor  = 0.5*ONE_4PI_EPS0;
+    
+    calc_gb_rad_threads(fr,top,x,nl,born,md,calc_gb_rad_still_pairs,
+                        born->gpol_still_work);
 
     /* Parallel summations */
     if(PARTDECOMP(cr))
@@ -616,35 +731,29 @@ calc_gb_rad_still(t_commrec *cr, t_forcerec *fr,int natoms, gmx_localtop_t *top,
 }
     
 
-static int 
-calc_gb_rad_hct(t_commrec *cr,t_forcerec *fr,int natoms, gmx_localtop_t *top,
-                const t_atomtypes *atype, rvec x[], t_nblist *nl, 
-                gmx_genborn_t *born,t_mdatoms *md)
+static void
+calc_gb_rad_hct_pairs(t_forcerec *fr, gmx_localtop_t *top, rvec x[], t_nblist *nl,
+                      gmx_genborn_t *born, t_mdatoms *md, int i0, int i1, real *work)
 {
-    int i,k,n,ai,aj,nj0,nj1,at0,at1;
+    int i,k,n,ai,aj,nj0,nj1;
     int shift;
     real shX,shY,shZ;
-    real rai,raj,gpi,dr2,dr,sk,sk_ai,sk2,sk2_ai,lij,uij,diff2,tmp,sum_ai;
-    real rad,min_rad,rinv,rai_inv;
+    real rai,raj,dr2,dr,sk,sk_ai,sk2,sk2_ai,lij,uij,diff2,tmp,sum_ai;
+    real rinv,rai_inv;
     real ix1,iy1,iz1,jx1,jy1,jz1,dx11,dy11,dz11;
     real lij2, uij2, lij3, uij3, t1,t2,t3;
-    real lij_inv,dlij,duij,sk2_rinv,prod,log_term;
-    real doffset,raj_inv,dadx_val;
+    real lij_inv,dlij,sk2_rinv,prod,log_term;
+    real raj_inv,dadx_val;
     real *gb_radius;
     
-    doffset = born->gb_doffset;
     gb_radius = born->gb_radius;
 
-    for(i=0;i<born->nr;i++)
-    {
-        born->gpol_hct_work[i] = 0;
-    }
-    
+    /* Each pair stores two chain rule terms */
+    n    = 2*nl->jindex[i0];
     /* Keep the compiler happy */
-    n    = 0;
     prod = 0;
         
-    for(i=0;i<nl->nri;i++)
+    for(i=i0;i<i1;i++)
     {
         ai     = nl->iinr[i];
             
@@ -789,7 +898,7 @@ calc_gb_rad_hct(t_commrec *cr,t_forcerec *fr,int natoms, gmx_localtop_t *top,
                 dadx_val = (dlij*t1+t2+t3)*rinv; /* rb2 is moved to chainrule    */
                 /* fr->dadx[n++] = (dlij*t1+duij*t2+t3)*rinv; */ /* rb2 is moved to chainrule    */
                 
-                born->gpol_hct_work[aj] += 0.5*tmp;
+                work[aj] += 0.5*tmp;
             }
             else
             {
@@ -798,8 +907,23 @@ calc_gb_rad_hct(t_commrec *cr,t_forcerec *fr,int natoms, gmx_localtop_t *top,
             fr->dadx[n++] = dadx_val;
         }
         
-        born->gpol_hct_work[ai] += sum_ai;
+        work[ai] += sum_ai;
     }
+}
+
+static int 
+calc_gb_rad_hct(t_commrec *cr,t_forcerec *fr,int natoms, gmx_localtop_t *top,
+                const t_atomtypes *atype, rvec x[], t_nblist *nl, 
+                gmx_genborn_t *born,t_mdatoms *md)
+{
+    int i;
+    real rai,sum_ai,rad,min_rad;
+    real doffset;
+    
+    doffset = born->gb_doffset;
+
+    calc_gb_rad_threads(fr,top,x,nl,born,md,calc_gb_rad_hct_pairs,
+                        born->gpol_hct_work);
     
     /* Parallel summations */
     if(PARTDECOMP(cr))
@@ -836,35 +960,30 @@ calc_gb_rad_hct(t_commrec *cr,t_forcerec *fr,int natoms, gmx_localtop_t *top,
     return 0;
 }
 
-static int 
-calc_gb_rad_obc(t_commrec *cr, t_forcerec *fr, int natoms, gmx_localtop_t *top,
-                    const t_atomtypes *atype, rvec x[], t_nblist *nl, gmx_genborn_t *born,t_mdatoms *md)
+static void
+calc_gb_rad_obc_pairs(t_forcerec *fr, gmx_localtop_t *top, rvec x[], t_nblist *nl,
+                      gmx_genborn_t *born, t_mdatoms *md, int i0, int i1, real *work)
 {
-    int i,k,ai,aj,nj0,nj1,n,at0,at1;
+    int i,k,ai,aj,nj0,nj1,n;
     int shift;
     real shX,shY,shZ;
-    real rai,raj,gpi,dr2,dr,sk,sk2,lij,uij,diff2,tmp,sum_ai;
-    real rad, min_rad,sum_ai2,sum_ai3,tsum,tchain,rinv,rai_inv,lij_inv,rai_inv2;
+    real rai,raj,dr2,dr,sk,sk2,lij,uij,diff2,tmp,sum_ai;
+    real rinv,rai_inv,lij_inv;
     real log_term,prod,sk2_rinv,sk_ai,sk2_ai;
     real ix1,iy1,iz1,jx1,jy1,jz1,dx11,dy11,dz11;
-    real lij2,uij2,lij3,uij3,dlij,duij,t1,t2,t3;
-    real doffset,raj_inv,dadx_val;
+    real lij2,uij2,lij3,uij3,dlij,t1,t2,t3;
+    real raj_inv,dadx_val;
     real *gb_radius;
     
+    /* Each pair stores two chain rule terms */
+    n    = 2*nl->jindex[i0];
     /* Keep the compiler happy */
-    n    = 0;
     prod = 0;
     raj  = 0;
     
-    doffset = born->gb_doffset;
     gb_radius = born->gb_radius;
     
-    for(i=0;i<born->nr;i++)
-    {
-        born->gpol_hct_work[i] = 0;
-    }
-    
-    for(i=0;i<nl->nri;i++)
+    for(i=i0;i<i1;i++)
     {
         ai      = nl->iinr[i];
     
@@ -1002,7 +1121,7 @@ calc_gb_rad_obc(t_commrec *cr, t_forcerec *fr, int natoms, gmx_localtop_t *top,
                 
                 dadx_val = (dlij*t1+t2+t3)*rinv; /* rb2 is moved to chainrule    */
                 
-                born->gpol_hct_work[aj] += 0.5*tmp;
+                work[aj] += 0.5*tmp;
                 
             }
             else
@@ -1012,9 +1131,23 @@ calc_gb_rad_obc(t_commrec *cr, t_forcerec *fr, int natoms, gmx_localtop_t *top,
             fr->dadx[n++] = dadx_val;
 
         }        
-        born->gpol_hct_work[ai] += sum_ai;
+        work[ai] += sum_ai;
       
     }
+}
+
+static int 
+calc_gb_rad_obc(t_commrec *cr, t_forcerec *fr, int natoms, gmx_localtop_t *top,
+                    const t_atomtypes *atype, rvec x[], t_nblist *nl, gmx_genborn_t *born,t_mdatoms *md)
+{
+    int i;
+    real rai,sum_ai,sum_ai2,sum_ai3,tsum,tchain,rai_inv,rai_inv2;
+    real doffset;
+    
+    doffset = born->gb_doffset;
+    
+    calc_gb_rad_threads(fr,top,x,nl,born,md,calc_gb_rad_obc_pairs,
+                        born->gpol_hct_work);
     
     /* Parallel summations */
     if(PARTDECOMP(cr))
@@ -1503,50 +1636,22 @@ real calc_gb_nonpolar(t_commrec *cr, t_forcerec *fr,int natoms,gmx_genborn_t *bo
 
 
 
-real calc_gb_chainrule(int natoms, t_nblist *nl, real *dadx, real *dvda, rvec x[], rvec t[], rvec fshift[], 
-                       rvec shift_vec[], int gb_algorithm, gmx_genborn_t *born, t_mdatoms *md)
-{    
-    int i,k,n,ai,aj,nj0,nj1,n0,n1;
+/* Computes the chain rule forces of i-entries i0 to i1 of nl */
+static void calc_gb_chainrule_pairs(t_nblist *nl, real *dadx, real *rb,
+                                    rvec x[], rvec t[], rvec fshift[], rvec shift_vec[],
+                                    int i0, int i1)
+{
+    int i,k,n,ai,aj,nj0,nj1;
     int shift;
     real shX,shY,shZ;
-    real fgb,fij,rb2,rbi,fix1,fiy1,fiz1;
-    real ix1,iy1,iz1,jx1,jy1,jz1,dx11,dy11,dz11,rsq11;
-    real rinv11,tx,ty,tz,rbai,rbaj,fgb_ai;
-    real *rb;
-    volatile int idx;
-        
-    n  = 0;    
-    rb = born->work;
-        
-  n0 = 0;
-  n1 = natoms;
-  
-    if(gb_algorithm==egbSTILL) 
-    {
-        for(i=n0;i<n1;i++)
-        {
-          rbi   = born->bRad[i];
-          rb[i] = (2 * rbi * rbi * dvda[i])/ONE_4PI_EPS0;
-        }
-    }
-    else if(gb_algorithm==egbHCT) 
-    {
-        for(i=n0;i<n1;i++)
-        {
-          rbi   = born->bRad[i];
-          rb[i] = rbi * rbi * dvda[i];
-        }
-    }
-    else if(gb_algorithm==egbOBC) 
-    {
-        for(i=n0;i<n1;i++)
-        {
-          rbi   = born->bRad[i];
-          rb[i] = rbi * rbi * born->drobc[i] * dvda[i];
-        }
-    }
-    
-    for(i=0;i<nl->nri;i++)
+    real fgb,fix1,fiy1,fiz1;
+    real ix1,iy1,iz1,jx1,jy1,jz1,dx11,dy11,dz11;
+    real tx,ty,tz,rbai,rbaj,fgb_ai;
+
+    /* Each pair has two chain rule terms */
+    n  = 2*nl->jindex[i0];
+
+    for(i=i0;i<i1;i++)
     {
         ai   = nl->iinr[i];
         
@@ -1614,6 +1719,106 @@ real calc_gb_chainrule(int natoms, t_nblist *nl, real *dadx, real *dvda, rvec x[
         fshift[shift][2] = fshift[shift][2] + fiz1;
         
     }
+}
+
+real calc_gb_chainrule(t_forcerec *fr, int natoms, t_nblist *nl, real *dadx, real *dvda,
+                       rvec x[], rvec t[], rvec fshift[], rvec shift_vec[],
+                       int gb_algorithm, gmx_genborn_t *born, t_mdatoms *md)
+{    
+    int i,nthread,th;
+    real rbi;
+    real *rb;
+        
+    rb      = born->work;
+    nthread = fr->nthread_ns;
+        
+    if(gb_algorithm==egbSTILL) 
+    {
+#pragma omp parallel for num_threads(nthread) schedule(static) private(rbi)
+        for(i=0;i<natoms;i++)
+        {
+          rbi   = born->bRad[i];
+          rb[i] = (2 * rbi * rbi * dvda[i])/ONE_4PI_EPS0;
+        }
+    }
+    else if(gb_algorithm==egbHCT) 
+    {
+#pragma omp parallel for num_threads(nthread) schedule(static) private(rbi)
+        for(i=0;i<natoms;i++)
+        {
+          rbi   = born->bRad[i];
+          rb[i] = rbi * rbi * dvda[i];
+        }
+    }
+    else if(gb_algorithm==egbOBC) 
+    {
+#pragma omp parallel for num_threads(nthread) schedule(static) private(rbi)
+        for(i=0;i<natoms;i++)
+        {
+          rbi   = born->bRad[i];
+          rb[i] = rbi * rbi * born->drobc[i] * dvda[i];
+        }
+    }
+
+    if (nthread == 1)
+    {
+        calc_gb_chainrule_pairs(nl,dadx,rb,x,t,fshift,shift_vec,0,nl->nri);
+
+        return 0;
+    }
+
+    /* Thread 0 adds to t and fshift, the other threads use
+     * the thread local force buffers of the non-bonded threads.
+     */
+#pragma omp parallel for num_threads(nthread) schedule(static)
+    for(th=0; th<nthread; th++)
+    {
+        f_thread_t *ft;
+        int        a;
+
+        if (th == 0)
+        {
+            calc_gb_chainrule_pairs(nl,dadx,rb,x,t,fshift,shift_vec,
+                                    0,gb_nblist_thread_start(nl,1,nthread));
+        }
+        else
+        {
+            ft = &fr->f_t_nb[th];
+            if (natoms > ft->f_nalloc)
+            {
+                ft->f_nalloc = over_alloc_large(natoms);
+                srenew(ft->f,ft->f_nalloc);
+                srenew(ft->dvda,ft->f_nalloc);
+            }
+            for(a=0; a<natoms; a++)
+            {
+                clear_rvec(ft->f[a]);
+            }
+            clear_rvecs(SHIFTS,ft->fshift);
+
+            calc_gb_chainrule_pairs(nl,dadx,rb,x,ft->f,ft->fshift,shift_vec,
+                                    gb_nblist_thread_start(nl,th,nthread),
+                                    gb_nblist_thread_start(nl,th+1,nthread));
+        }
+    }
+
+#pragma omp parallel for num_threads(nthread) schedule(static)
+    for(i=0; i<natoms; i++)
+    {
+        int thr;
+
+        for(thr=1; thr<nthread; thr++)
+        {
+            rvec_inc(t[i],fr->f_t_nb[thr].f[i]);
+        }
+    }
+    for(th=1; th<nthread; th++)
+    {
+        for(i=0; i<SHIFTS; i++)
+        {
+            rvec_inc(fshift[i],fr->f_t_nb[th].fshift[i]);
+        }
+    }
 
     return 0;    
 }
@@ -1697,11 +1902,11 @@ calc_gb_forces(t_commrec *cr, t_mdatoms *md, gmx_genborn_t *born, gmx_localtop_t
     }
     else
     {
-        calc_gb_chainrule(fr->natoms_force, &(fr->gblist), fr->dadx, fr->dvda, 
+        calc_gb_chainrule(fr, fr->natoms_force, &(fr->gblist), fr->dadx, fr->dvda, 
                           x, f, fr->fshift, fr->shift_vec, gb_algorithm, born, md);
     }
 #else
-    calc_gb_chainrule(fr->natoms_force, &(fr->gblist), fr->dadx, fr->dvda, 
+    calc_gb_chainrule(fr, fr->natoms_force, &(fr->gblist), fr->dadx, fr->dvda, 
                       x, f, fr->fshift, fr->shift_vec, gb_algorithm, born, md);
 #endif
 
@@ -1861,8 +2066,10 @@ int make_gb_nblist(t_commrec *cr, int gb_algorithm, real gbcut,
         gmx_incons("Unknown GB algorithm");
     }
     
-    /* Loop over the VDWQQ and VDW nblists to set up the nonbonded part of the GB list */
-    for(n=0; (n<fr->nnblists); n++)
+    /* Loop over the VDWQQ and VDW nblists of all thread list sets
+     * to set up the nonbonded part of the GB list.
+     */
+    for(n=0; (n<fr->nnblists*fr->nthread_ns); n++)
     {
         for(i=0; (i<eNL_NR); i++)
         {
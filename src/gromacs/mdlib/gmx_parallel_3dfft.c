@@ -61,6 +61,11 @@ gmx_parallel_3dfft_init   (gmx_parallel_3dfft_t *    pfft_setup,
     
     snew(*pfft_setup,1);
     if (bReproducible) flags |= FFT5D_NOMEASURE; 
+    if (getenv("GMX_FFT_PIPELINE") != NULL)
+    {
+        /* Overlap the transpose communication with the 1D FFTs */
+        flags |= FFT5D_PIPELINE;
+    }
     
     if (!(flags&FFT5D_ORDER_YZ)) { 
         Nb=M;Mb=K;Kb=rN;		
@@ -101,7 +101,9 @@ static const char *wcn[ewcNR] =
   "PME redist. X/F", "PME spread/gather", "PME 3D-FFT", "PME 3D-FFT Comm.", "PME solve",
   "PME wait for PP", "Wait + Recv. PME F", "Wait GPU nonlocal", "Wait GPU local", "NB X/F buffer ops.",
   "Vsite spread", "Write traj.", "Update", "Constraints", "Comm. energies",
-  "Enforced rotation", "Add rot. forces", "Test" };
+  "Enforced rotation", "Add rot. forces",
+  "QM/MM", "QM/MM embedding", "QM input", "QM program", "QM output",
+  "Test" };
 
 static const char *wcsn[ewcsNR] =
 { "DD redist.", "DD NS grid + sort", "DD setup comm.",
@@ -327,6 +329,17 @@ double wallcycle_stop(gmx_wallcycle_t wc, int ewc)
     return last;
 }
 
+void wallcycle_add(gmx_wallcycle_t wc, int ewc, int n, double cycles)
+{
+    if (wc == NULL)
+    {
+        return;
+    }
+
+    wc->wcc[ewc].n += n;
+    wc->wcc[ewc].c += (gmx_cycles_t)cycles;
+}
+
 void wallcycle_reset_all(gmx_wallcycle_t wc)
 {
     int i;
@@ -368,6 +381,11 @@ static gmx_bool is_pme_subcounter(int ewc)
     return (ewc >= ewcPME_REDISTXF && ewc < ewcPMEWAITCOMM);
 }
 
+static gmx_bool is_qmmm_subcounter(int ewc)
+{
+    return (ewc > ewcQMMM && ewc <= ewcQMMM_OUTPUT);
+}
+
 void wallcycle_sum(t_commrec *cr, gmx_wallcycle_t wc)
 {
     wallcc_t *wcc;
@@ -426,6 +444,11 @@ void wallcycle_sum(t_commrec *cr, gmx_wallcycle_t wc)
     {
         wcc[ewcPME_FFT].c -= wcc[ewcPME_FFTCOMM].c;
     }
+    if (wcc[ewcQMMM].n > 0)
+    {
+        /* The QM/MM calls are nested in the force counter */
+        wcc[ewcFORCE].c -= wcc[ewcQMMM].c;
+    }
 
     if (cr->npmenodes == 0)
     {
@@ -610,7 +633,7 @@ void wallcycle_print(FILE *fplog, int nnodes, int npme, double realtime,
     sum = 0;
     for(i=ewcPPDURINGPME+1; i<ewcNR; i++)
     {
-        if (!is_pme_subcounter(i))
+        if (!is_pme_subcounter(i) && !is_qmmm_subcounter(i))
         {
             print_cycles(fplog,c2t,wcn[i],nnodes,
                          is_pme_counter(i) ? npme : npp,
@@ -659,6 +682,20 @@ void wallcycle_print(FILE *fplog, int nnodes, int npme, double realtime,
         fprintf(fplog,"%s\n",hline);
     }
 
+    if (wc->wcc[ewcQMMM].n > 0)
+    {
+        /* The QM stages can run in a separate thread, concurrently with
+         * the other counters, so they do not add up to the QM/MM time.
+         */
+        fprintf(fplog,"%s\n",hline);
+        for(i=ewcQMMM_EMBED; i<=ewcQMMM_OUTPUT; i++)
+        {
+            print_cycles(fplog,c2t,wcn[i],nnodes,npp,nth_pp,
+                         wc->wcc[i].n,cycles[i],tot);
+        }
+        fprintf(fplog,"%s\n",hline);
+    }
+
 #ifdef GMX_CYCLE_SUBCOUNTERS
     fprintf(fplog,"%s\n",hline);
     for(i=0; i<ewcsNR; i++)
@@ -77,6 +77,8 @@ static const char *pv_nm[] = {"pV" };
 
 static const char *enthalpy_nm[] = {"Enthalpy" };
 
+static const char *qmscf_nm[] = { "QM SCF cycles" };
+
 static const char *boxvel_nm[] = {
     "Box-Vel-XX", "Box-Vel-YY", "Box-Vel-ZZ",
     "Box-Vel-YX", "Box-Vel-ZX", "Box-Vel-ZY"
@@ -283,6 +285,7 @@ t_mdebin *init_mdebin(ener_file_t fp_ene,
     md->bPrintNHChains = ir-> bPrintNHChains;
     md->bMTTK = (IR_NPT_TROTTER(ir) || IR_NPH_TROTTER(ir));
     md->bMu = NEED_MUTOT(*ir);
+    md->bQMMM = ir->bQMMM;
 
     md->ebin  = mk_ebin();
     /* Pass NULL for unit to let get_ebin_space determine the units
@@ -331,6 +334,10 @@ t_mdebin *init_mdebin(ener_file_t fp_ene,
     {
         md->imu    = get_ebin_space(md->ebin,asize(mu_nm),mu_nm,unit_dipole_D);
     }
+    if (md->bQMMM)
+    {
+        md->iqm    = get_ebin_space(md->ebin,1,qmscf_nm,"");
+    }
     if (ir->cos_accel != 0)
     {
         md->ivcos = get_ebin_space(md->ebin,asize(vcos_nm),vcos_nm,unit_vel);
@@ -884,6 +891,11 @@ void upd_mdebin(t_mdebin *md,
     {
         add_ebin(md->ebin,md->imu,3,mu_tot,bSum);
     }
+    if (md->bQMMM)
+    {
+        tmp6[0] = enerd->QMnscf;
+        add_ebin(md->ebin,md->iqm,1,tmp6,bSum);
+    }
     if (ekind && ekind->cosacc.cos_accel != 0)
     {
         vol  = box[XX][XX]*box[YY][YY]*box[ZZ][ZZ];
@@ -1313,6 +1325,11 @@ void print_ebin(ener_file_t fp_ene,gmx_bool bEne,gmx_bool bDR,gmx_bool bOR,
                 pr_ebin(log,md->ebin,md->imu,3,3,mode,FALSE);
                 fprintf(log,"\n");
             }
+            if (md->bQMMM)
+            {
+                pr_ebin(log,md->ebin,md->iqm,1,5,mode,TRUE);
+                fprintf(log,"\n");
+            }
 
             if (md->nE > 1)
             {
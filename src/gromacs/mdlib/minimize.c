@@ -2251,6 +2251,83 @@ double do_steep(FILE *fplog,t_commrec *cr,
 } /* That's all folks */
 
 
+static void nm_row_range(int nrow,int nnodes,int node,int *row0,int *row1)
+{
+    /* Returns the block [row0,row1) of the Hessian rows of node */
+    *row0 = (int)(((gmx_large_int_t)nrow*node)/nnodes);
+    *row1 = (int)(((gmx_large_int_t)nrow*(node + 1))/nnodes);
+}
+
+static void nm_collect_rows(t_commrec *cr,int sz,gmx_bool bSparse,
+                            gmx_sparsematrix_t *sparse_matrix,
+                            real *full_matrix)
+{
+    /* Sends the Hessian rows of all nodes to the master. Every row is a
+     * message, for the sparse format preceded by its number of entries.
+     * Messages with the same tag from one node arrive in order, so the
+     * node id is used as tag.
+     */
+#ifdef GMX_MPI
+    int        node,row,row0,row1,n;
+    MPI_Status stat;
+
+    if (!MASTER(cr))
+    {
+        nm_row_range(sz,cr->nnodes,cr->nodeid,&row0,&row1);
+        for(row=row0; row<row1; row++)
+        {
+            if (bSparse)
+            {
+                n = sparse_matrix->ndata[row];
+                MPI_Send(&n,1,MPI_INT,MASTERNODE(cr),cr->nodeid,
+                         cr->mpi_comm_mygroup);
+                if (n > 0)
+                {
+                    MPI_Send(sparse_matrix->data[row],
+                             n*sizeof(gmx_sparsematrix_entry_t),MPI_BYTE,
+                             MASTERNODE(cr),cr->nodeid,cr->mpi_comm_mygroup);
+                }
+            }
+            else
+            {
+                MPI_Send(full_matrix + (row - row0)*sz,sz,GMX_MPI_REAL,
+                         MASTERNODE(cr),cr->nodeid,cr->mpi_comm_mygroup);
+            }
+        }
+        return;
+    }
+
+    for(node=1; node<cr->nnodes; node++)
+    {
+        nm_row_range(sz,cr->nnodes,node,&row0,&row1);
+        for(row=row0; row<row1; row++)
+        {
+            if (bSparse)
+            {
+                MPI_Recv(&n,1,MPI_INT,node,node,cr->mpi_comm_mygroup,&stat);
+                if (n > sparse_matrix->nalloc[row])
+                {
+                    sparse_matrix->nalloc[row] = n;
+                    srenew(sparse_matrix->data[row],n);
+                }
+                sparse_matrix->ndata[row] = n;
+                if (n > 0)
+                {
+                    MPI_Recv(sparse_matrix->data[row],
+                             n*sizeof(gmx_sparsematrix_entry_t),MPI_BYTE,
+                             node,node,cr->mpi_comm_mygroup,&stat);
+                }
+            }
+            else
+            {
+                MPI_Recv(full_matrix + row*sz,sz,GMX_MPI_REAL,
+                         node,node,cr->mpi_comm_mygroup,&stat);
+            }
+        }
+    }
+#endif
+}
+
 double do_nm(FILE *fplog,t_commrec *cr,
              int nfile,const t_filenm fnm[],
              const output_env_t oenv, gmx_bool bVerbose,gmx_bool bCompact,
@@ -2274,7 +2351,7 @@ double do_nm(FILE *fplog,t_commrec *cr,
     const char *NM = "Normal Mode Analysis";
     gmx_mdoutf_t *outf;
     int        natoms,atom,d;
-    int        nnodes,node;
+    int        nnodes;
     rvec       *f_global;
     gmx_localtop_t *top;
     gmx_enerdata_t *enerd;
@@ -2285,7 +2362,8 @@ double do_nm(FILE *fplog,t_commrec *cr,
     gmx_bool       bNS;
     tensor     vir,pres;
     rvec       mu_tot;
-    rvec       *fneg,*dfdx;
+    rvec       *fneg;
+    real       dfdx;
     gmx_bool       bSparse; /* use sparse matrix storage format */
     size_t     sz;
     gmx_sparsematrix_t * sparse_matrix = NULL;
@@ -2293,7 +2371,7 @@ double do_nm(FILE *fplog,t_commrec *cr,
     em_state_t *   state_work;
 
     /* added with respect to mdrun */
-    int        i,j,k,row,col;
+    int        i,j,k,row,col,row0,row1;
     real       der_range=10.0*sqrt(GMX_REAL_EPS);
     real       x_min;
     real       fnorm,fmax;
@@ -2314,7 +2392,6 @@ double do_nm(FILE *fplog,t_commrec *cr,
 
     natoms = top_global->natoms;
     snew(fneg,natoms);
-    snew(dfdx,natoms);
 
 #ifndef GMX_DOUBLE
     if (MASTER(cr))
@@ -2358,10 +2435,15 @@ double do_nm(FILE *fplog,t_commrec *cr,
         sparse_matrix=gmx_sparsematrix_init(sz);
         sparse_matrix->compressed_symmetric = TRUE;
     }
-    else
+    else if (MASTER(cr))
     {
         snew(full_matrix,sz*sz);
     }
+    else
+    {
+        nm_row_range((int)sz,cr->nnodes,cr->nodeid,&row0,&row1);
+        snew(full_matrix,(row1 - row0)*sz);
+    }
 
     /* Initial values */
     t0           = inputrec->init_t;
@@ -2376,8 +2458,8 @@ double do_nm(FILE *fplog,t_commrec *cr,
     /* Write start time and temperature */
     print_em_start(fplog,cr,runtime,wcycle,NM);
 
-    /* fudge nr of steps to nr of atoms */
-    inputrec->nsteps = natoms*2;
+    /* fudge nr of steps to nr of displaced geometries */
+    inputrec->nsteps = sz*2;
 
     if (MASTER(cr))
     {
@@ -2420,115 +2502,96 @@ double do_nm(FILE *fplog,t_commrec *cr,
      *
      ************************************************************/
 
-    /* Steps are divided one by one over the nodes */
-    for(atom=cr->nodeid; atom<natoms; atom+=nnodes)
+    /* The degrees of freedom are divided in contiguous blocks over the
+     * nodes. The displaced geometries are independent, so every node
+     * computes the Hessian rows of its block without waiting for the
+     * others, the master collects all rows at the end. Consecutive
+     * displacements give similar geometries, which with QM/MM keeps
+     * the SCF guess from the previous calculation good.
+     */
+    nm_row_range((int)sz,nnodes,cr->nodeid,&row0,&row1);
+    if (MASTER(cr) && nnodes > 1)
     {
+        fprintf(stderr,"Dividing the %d displaced coordinates over %d nodes\n\n",
+                (int)sz,nnodes);
+    }
 
-        for (d=0; d<DIM; d++)
-        {
-            x_min = state_work->s.x[atom][d];
+    for(row=row0; row<row1; row++)
+    {
+        atom  = row/DIM;
+        d     = row - atom*DIM;
+        x_min = state_work->s.x[atom][d];
 
-            state_work->s.x[atom][d] = x_min - der_range;
+        state_work->s.x[atom][d] = x_min - der_range;
 
-            /* Make evaluate_energy do a single node force calculation */
-            cr->nnodes = 1;
-            evaluate_energy(fplog,bVerbose,cr,
-                            state_global,top_global,state_work,top,
-                            inputrec,nrnb,wcycle,gstat,
-                            vsite,constr,fcd,graph,mdatoms,fr,
-                            mu_tot,enerd,vir,pres,atom*2,FALSE);
+        /* Make evaluate_energy do a single node force calculation */
+        cr->nnodes = 1;
+        evaluate_energy(fplog,bVerbose,cr,
+                        state_global,top_global,state_work,top,
+                        inputrec,nrnb,wcycle,gstat,
+                        vsite,constr,fcd,graph,mdatoms,fr,
+                        mu_tot,enerd,vir,pres,row*2,FALSE);
 
-            for(i=0; i<natoms; i++)
-            {
-                copy_rvec(state_work->f[i], fneg[i]);
-            }
+        for(i=0; i<natoms; i++)
+        {
+            copy_rvec(state_work->f[i], fneg[i]);
+        }
 
-            state_work->s.x[atom][d] = x_min + der_range;
+        state_work->s.x[atom][d] = x_min + der_range;
 
-            evaluate_energy(fplog,bVerbose,cr,
-                            state_global,top_global,state_work,top,
-                            inputrec,nrnb,wcycle,gstat,
-                            vsite,constr,fcd,graph,mdatoms,fr,
-                            mu_tot,enerd,vir,pres,atom*2+1,FALSE);
-            cr->nnodes = nnodes;
+        evaluate_energy(fplog,bVerbose,cr,
+                        state_global,top_global,state_work,top,
+                        inputrec,nrnb,wcycle,gstat,
+                        vsite,constr,fcd,graph,mdatoms,fr,
+                        mu_tot,enerd,vir,pres,row*2+1,FALSE);
+        cr->nnodes = nnodes;
 
-            /* x is restored to original */
-            state_work->s.x[atom][d] = x_min;
+        /* x is restored to original */
+        state_work->s.x[atom][d] = x_min;
 
-            for(j=0; j<natoms; j++)
+        for(j=0; j<natoms; j++)
+        {
+            for(k=0; k<DIM; k++)
             {
-                for (k=0; (k<DIM); k++)
-                {
-                    dfdx[j][k] =
-                        -(state_work->f[j][k] - fneg[j][k])/(2*der_range);
-                }
-            }
+                dfdx = -(state_work->f[j][k] - fneg[j][k])/(2*der_range);
+                col  = j*DIM + k;
 
-            if (!MASTER(cr))
-            {
-#ifdef GMX_MPI
-#ifdef GMX_DOUBLE
-#define mpi_type MPI_DOUBLE
-#else
-#define mpi_type MPI_FLOAT
-#endif
-                MPI_Send(dfdx[0],natoms*DIM,mpi_type,MASTERNODE(cr),cr->nodeid,
-                         cr->mpi_comm_mygroup);
-#endif
-            }
-            else
-            {
-                for(node=0; (node<nnodes && atom+node<natoms); node++)
+                if (bSparse)
                 {
-                    if (node > 0)
-                    {
-#ifdef GMX_MPI
-                        MPI_Status stat;
-                        MPI_Recv(dfdx[0],natoms*DIM,mpi_type,node,node,
-                                 cr->mpi_comm_mygroup,&stat);
-#undef mpi_type
-#endif
-                    }
-
-                    row = (atom + node)*DIM + d;
-
-                    for(j=0; j<natoms; j++)
+                    if (col >= row && dfdx != 0.0)
                     {
-                        for(k=0; k<DIM; k++)
-                        {
-                            col = j*DIM + k;
-
-                            if (bSparse)
-                            {
-                                if (col >= row && dfdx[j][k] != 0.0)
-                                {
-                                    gmx_sparsematrix_increment_value(sparse_matrix,
-                                                                     row,col,dfdx[j][k]);
-                                }
-                            }
-                            else
-                            {
-                                full_matrix[row*sz+col] = dfdx[j][k];
-                            }
-                        }
+                        gmx_sparsematrix_increment_value(sparse_matrix,
+                                                         row,col,dfdx);
                     }
                 }
+                else
+                {
+                    /* the master stores the whole matrix, the other
+                     * nodes only their own rows
+                     */
+                    full_matrix[(row - row0)*sz + col] = dfdx;
+                }
             }
+        }
 
-            if (bVerbose && fplog)
-            {
-                fflush(fplog);
-            }
+        if (bVerbose && fplog)
+        {
+            fflush(fplog);
         }
         /* write progress */
         if (MASTER(cr) && bVerbose)
         {
             fprintf(stderr,"\rFinished step %d out of %d",
-                    min(atom+nnodes,natoms),natoms);
+                    2*(row - row0 + 1),2*(row1 - row0));
             fflush(stderr);
         }
     }
 
+    if (nnodes > 1)
+    {
+        nm_collect_rows(cr,sz,bSparse,sparse_matrix,full_matrix);
+    }
+
     if (MASTER(cr))
     {
         fprintf(stderr,"\n\nWriting Hessian...\n");
@@ -2537,7 +2600,7 @@ double do_nm(FILE *fplog,t_commrec *cr,
 
     finish_em(fplog,cr,outf,runtime,wcycle);
 
-    runtime->nsteps_done = natoms*2;
+    runtime->nsteps_done = sz*2;
 
     return 0;
 }
@@ -146,7 +146,8 @@ static void nbnxn_atomdata_output_init(nbnxn_atomdata_output_t *out,
     ma((void **)&out->Vc  ,out->nV*sizeof(*out->Vc  ));
 
     if (nb_kernel_type == nbk4xN_X86_SIMD128 ||
-        nb_kernel_type == nbk4xN_X86_SIMD256)
+        nb_kernel_type == nbk4xN_X86_SIMD256 ||
+        nb_kernel_type == nbk4xN_X86_SIMD512)
     {
         cj_size = nbnxn_kernel_to_cj_size(nb_kernel_type);
         out->nVS = nenergrp*nenergrp*stride*(cj_size>>1)*cj_size;
@@ -424,6 +425,7 @@ static void set_combination_rule_data(nbnxn_atomdata_t *nbat)
 void nbnxn_atomdata_init(FILE *fp,
                          nbnxn_atomdata_t *nbat,
                          int nb_kernel_type,
+                         int enbnxninitcombrule,
                          int ntype,const real *nbfp,
                          int n_energygroups,
                          int nout,
@@ -550,7 +552,13 @@ void nbnxn_atomdata_init(FILE *fp,
         /* We prefer the geometic combination rule,
          * as that gives a slightly faster kernel than the LB rule.
          */
-        if (bCombGeom)
+        if (enbnxninitcombrule == enbnxninitcombruleNONE)
+        {
+            nbat->comb_rule = ljcrNONE;
+
+            nbat->free(nbat->nbfp_comb);
+        }
+        else if (bCombGeom)
         {
             nbat->comb_rule = ljcrGEOM;
         }
@@ -598,6 +606,7 @@ void nbnxn_atomdata_init(FILE *fp,
             nbat->XFormat = nbatX4;
             break;
         case nbk4xN_X86_SIMD256:
+        case nbk4xN_X86_SIMD512:
 #ifndef GMX_DOUBLE
             nbat->XFormat = nbatX8;
 #else
@@ -696,6 +705,28 @@ static void copy_lj_to_nbat_lj_comb_x8(const real *ljparam_type,
     }
 }
 
+/* Sets the LJ combination parameters of the na atoms starting at ash
+ * from the atom types
+ */
+static void set_lj_comb_column(nbnxn_atomdata_t *nbat,int ash,int na)
+{
+    if (nbat->comb_rule != ljcrNONE)
+    {
+        if (nbat->XFormat == nbatX4)
+        {
+            copy_lj_to_nbat_lj_comb_x4(nbat->nbfp_comb,
+                                       nbat->type+ash,na,
+                                       nbat->lj_comb+ash*2);
+        }
+        else if (nbat->XFormat == nbatX8)
+        {
+            copy_lj_to_nbat_lj_comb_x8(nbat->nbfp_comb,
+                                       nbat->type+ash,na,
+                                       nbat->lj_comb+ash*2);
+        }
+    }
+}
+
 /* Sets the atom type and LJ data in nbnxn_atomdata_t */
 static void nbnxn_atomdata_set_atomtypes(nbnxn_atomdata_t *nbat,
                                          int ngrid,
@@ -718,21 +749,7 @@ static void nbnxn_atomdata_set_atomtypes(nbnxn_atomdata_t *nbat,
             copy_int_to_nbat_int(nbs->a+ash,grid->cxy_na[i],ncz*grid->na_sc,
                                  type,nbat->ntype-1,nbat->type+ash);
 
-            if (nbat->comb_rule != ljcrNONE)
-            {
-                if (nbat->XFormat == nbatX4)
-                {
-                    copy_lj_to_nbat_lj_comb_x4(nbat->nbfp_comb,
-                                               nbat->type+ash,ncz*grid->na_sc,
-                                               nbat->lj_comb+ash*2);
-                }
-                else if (nbat->XFormat == nbatX8)
-                {
-                    copy_lj_to_nbat_lj_comb_x8(nbat->nbfp_comb,
-                                               nbat->type+ash,ncz*grid->na_sc,
-                                               nbat->lj_comb+ash*2);
-                }
-            }
+            set_lj_comb_column(nbat,ash,ncz*grid->na_sc);
         }
     }
 }
@@ -792,6 +809,56 @@ static void nbnxn_atomdata_set_charges(nbnxn_atomdata_t *nbat,
     }
 }
 
+/* Gives the perturbed atoms the charge and LJ type of the filler
+ * particles, so the cluster kernels skip all their interactions.
+ * These are computed with the free-energy pair lists instead.
+ */
+static void nbnxn_atomdata_mask_fep(nbnxn_atomdata_t *nbat,
+                                    int ngrid,
+                                    const nbnxn_search_t nbs,
+                                    const gmx_bool *bPerturbed)
+{
+    int  g,cxy,ash,na,i,at;
+    gmx_bool bMasked;
+    const nbnxn_grid_t *grid;
+
+    for(g=0; g<ngrid; g++)
+    {
+        grid = &nbs->grid[g];
+
+        for(cxy=0; cxy<grid->ncx*grid->ncy; cxy++)
+        {
+            ash = (grid->cell0 + grid->cxy_ind[cxy])*grid->na_sc;
+            na  = grid->cxy_na[cxy];
+
+            bMasked = FALSE;
+            for(i=0; i<na; i++)
+            {
+                at = nbs->a[ash+i];
+                if (at >= 0 && bPerturbed[at])
+                {
+                    nbat->type[ash+i] = nbat->ntype - 1;
+                    if (nbat->XFormat == nbatXYZQ)
+                    {
+                        nbat->x[(ash+i)*STRIDE_XYZQ+ZZ+1] = 0;
+                    }
+                    else
+                    {
+                        nbat->q[ash+i] = 0;
+                    }
+                    bMasked = TRUE;
+                }
+            }
+
+            if (bMasked)
+            {
+                set_lj_comb_column(nbat,ash,
+                                   (grid->cxy_ind[cxy+1] - grid->cxy_ind[cxy])*grid->na_sc);
+            }
+        }
+    }
+}
+
 /* Copies the energy group indices to a reordered and packed array */
 static void copy_egp_to_nbat_egps(const int *a,int na,int na_round,
                                   int na_c,int bit_shift,
@@ -870,6 +937,11 @@ void nbnxn_atomdata_set(nbnxn_atomdata_t *nbat,
 
     nbnxn_atomdata_set_charges(nbat,ngrid,nbs,mdatoms->chargeA);
 
+    if (mdatoms->nPerturbed)
+    {
+        nbnxn_atomdata_mask_fep(nbat,ngrid,nbs,mdatoms->bPerturbed);
+    }
+
     if (nbat->nenergrp > 1)
     {
         nbnxn_atomdata_set_energygroups(nbat,ngrid,nbs,atinfo);
@@ -67,21 +67,29 @@ void copy_rvec_to_nbat_real(const int *a,int na,int na_round,
 			    rvec *x,int nbatFormat,real *xnb,int a0,
 			    int cx,int cy,int cz);
 
+enum { enbnxninitcombruleDETECT, enbnxninitcombruleNONE };
+
 /* Initialize the non-bonded atom data structure.
  * The enum for nbatXFormat is in the file defining nbnxn_atomdata_t.
  * Copy the ntypes*ntypes*2 sized nbfp non-bonded parameter list
  * to the atom data structure.
+ * enbnxninitcombrule sets if we should detect a combination rule
+ * or always use the full LJ parameter matrix.
  */
 void nbnxn_atomdata_init(FILE *fp,
 			 nbnxn_atomdata_t *nbat,
 			 int nb_kernel_type,
+			 int enbnxninitcombrule,
 			 int ntype,const real *nbfp,
 			 int n_energygroups,
 			 int nout,
 			 nbnxn_alloc_t *alloc,
 			 nbnxn_free_t  *free);
 
-/* Copy the atom data to the non-bonded atom data structure */
+/* Copy the atom data to the non-bonded atom data structure.
+ * Perturbed atoms get zero charge and LJ parameters, their
+ * interactions go through the free-energy pair lists.
+ */
 void nbnxn_atomdata_set(nbnxn_atomdata_t *nbat,
                          int locality,
                          const nbnxn_search_t nbs,
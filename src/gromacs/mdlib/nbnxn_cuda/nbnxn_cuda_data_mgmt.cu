@@ -177,9 +177,10 @@ static void init_nbparam(cu_nbparam_t *nbp,
     }
     else if ((EEL_PME(ic->eeltype) || ic->eeltype==eelEWALD))
     {
-        /* Initially rcoulomb == rvdw, so it's surely not twin cut-off, unless
-           forced by the env. var. (used only for benchmarking). */
-        if (getenv("GMX_CUDA_NB_EWALD_TWINCUT") == NULL)
+        /* Use twin cut-off when rcoulomb > rvdw, or when forced by
+           the env. var. (used only for benchmarking). */
+        if (ic->rcoulomb == ic->rvdw &&
+            getenv("GMX_CUDA_NB_EWALD_TWINCUT") == NULL)
         {
             nbp->eeltype = eelCuEWALD;
         }
@@ -195,7 +196,7 @@ static void init_nbparam(cu_nbparam_t *nbp,
     }
 
     /* generate table for PME */
-    if (nbp->eeltype == eelCuEWALD)
+    if (nbp->eeltype == eelCuEWALD || nbp->eeltype == eelCuEWALD_TWIN)
     {
         nbp->coulomb_tab = NULL;
         init_ewald_coulomb_force_table(nbp);
@@ -115,6 +115,18 @@ typedef struct nbnxn_x_ci_x86_simd256 {
 } nbnxn_x_ci_x86_simd256_t;
 #undef GMX_MM256_HERE
 #endif
+#ifdef GMX_X86_AVX_512
+#define GMX_MM512_HERE
+#include "gmx_x86_simd_macros.h"
+typedef struct nbnxn_x_ci_x86_simd512 {
+    /* The i-cluster coordinates for simple search,
+     * i-atoms 0 and 1 in register 0, i-atoms 2 and 3 in register 2.
+     */
+    gmx_mm_pr ix_SSE0,iy_SSE0,iz_SSE0;
+    gmx_mm_pr ix_SSE2,iy_SSE2,iz_SSE2;
+} nbnxn_x_ci_x86_simd512_t;
+#undef GMX_MM512_HERE
+#endif
 #endif
 
 /* Working data for the actual i-supercell during pair search */
@@ -128,6 +140,9 @@ typedef struct nbnxn_list_work {
 #ifdef GMX_X86_AVX_256
     nbnxn_x_ci_x86_simd256_t *x_ci_x86_simd256;
 #endif
+#ifdef GMX_X86_AVX_512
+    nbnxn_x_ci_x86_simd512_t *x_ci_x86_simd512;
+#endif
 #endif
     int  cj_ind;       /* The current cj_ind index for the current list     */
     int  cj4_init;     /* The first unitialized cj4 block                   */
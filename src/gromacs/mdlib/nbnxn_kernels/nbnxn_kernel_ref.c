@@ -47,20 +47,13 @@
 /* Analytical reaction-field kernels */
 #define CALC_COUL_RF
 
-/* Include the force+energy kernels */
-#define CALC_ENERGIES
-#include "nbnxn_kernel_ref_outer.h"
-#undef CALC_ENERGIES
+/* Single cut-off: rcoulomb = rvdw */
+#include "nbnxn_kernel_ref_includes.h"
 
-/* Include the force+energygroups kernels */
-#define CALC_ENERGIES
-#define ENERGY_GROUPS
-#include "nbnxn_kernel_ref_outer.h"
-#undef ENERGY_GROUPS
-#undef CALC_ENERGIES
-
-/* Include the force only kernels */
-#include "nbnxn_kernel_ref_outer.h"
+/* Twin cut-off: rcoulomb >= rvdw */
+#define VDW_CUTOFF_CHECK
+#include "nbnxn_kernel_ref_includes.h"
+#undef VDW_CUTOFF_CHECK
 
 #undef CALC_COUL_RF
 
@@ -68,39 +61,12 @@
 /* Tabulated exclusion interaction electrostatics kernels */
 #define CALC_COUL_TAB
 
-/* Include the force+energy kernels */
-#define CALC_ENERGIES
-#include "nbnxn_kernel_ref_outer.h"
-#undef CALC_ENERGIES
+/* Single cut-off: rcoulomb = rvdw */
+#include "nbnxn_kernel_ref_includes.h"
 
-/* Include the force+energygroups kernels */
-#define CALC_ENERGIES
-#define ENERGY_GROUPS
-#include "nbnxn_kernel_ref_outer.h"
-#undef ENERGY_GROUPS
-#undef CALC_ENERGIES
-
-/* Include the force only kernels */
-#include "nbnxn_kernel_ref_outer.h"
-
-/* Twin-range cut-off kernels */
+/* Twin cut-off: rcoulomb >= rvdw */
 #define VDW_CUTOFF_CHECK
-
-/* Include the force+energy kernels */
-#define CALC_ENERGIES
-#include "nbnxn_kernel_ref_outer.h"
-#undef CALC_ENERGIES
-
-/* Include the force+energygroups kernels */
-#define CALC_ENERGIES
-#define ENERGY_GROUPS
-#include "nbnxn_kernel_ref_outer.h"
-#undef ENERGY_GROUPS
-#undef CALC_ENERGIES
-
-/* Include the force only kernels */
-#include "nbnxn_kernel_ref_outer.h"
-
+#include "nbnxn_kernel_ref_includes.h"
 #undef VDW_CUTOFF_CHECK
 
 #undef CALC_COUL_TAB
@@ -122,22 +88,31 @@ typedef void (*p_nbk_func_noener)(const nbnxn_pairlist_t     *nbl,
                                   real                       *f,
                                   real                       *fshift);
 
-enum { coultRF, coultTAB, coultTAB_TWIN, coultNR };
+enum { coultRF, coultRF_TWIN, coultTAB, coultTAB_TWIN, coultNR };
+
+enum { vdwtLJ, vdwtLJ_FSW, vdwtLJ_PSW, vdwtNR };
+
+#define NBK_FN(elec,ener) { nbnxn_kernel_ref_##elec##_lj_##ener, nbnxn_kernel_ref_##elec##_lj_fsw_##ener, nbnxn_kernel_ref_##elec##_lj_psw_##ener }
 
-p_nbk_func_ener p_nbk_c_ener[coultNR] =
-{ nbnxn_kernel_ref_rf_ener,
-  nbnxn_kernel_ref_tab_ener,
-  nbnxn_kernel_ref_tab_twin_ener };
+p_nbk_func_ener p_nbk_c_ener[coultNR][vdwtNR] =
+{ NBK_FN(rf      ,ener),
+  NBK_FN(rf_twin ,ener),
+  NBK_FN(tab     ,ener),
+  NBK_FN(tab_twin,ener) };
 
-p_nbk_func_ener p_nbk_c_energrp[coultNR] =
-{ nbnxn_kernel_ref_rf_energrp,
-  nbnxn_kernel_ref_tab_energrp,
-  nbnxn_kernel_ref_tab_twin_energrp};
+p_nbk_func_ener p_nbk_c_energrp[coultNR][vdwtNR] =
+{ NBK_FN(rf      ,energrp),
+  NBK_FN(rf_twin ,energrp),
+  NBK_FN(tab     ,energrp),
+  NBK_FN(tab_twin,energrp) };
 
-p_nbk_func_noener p_nbk_c_noener[coultNR] =
-{ nbnxn_kernel_ref_rf_noener,
-  nbnxn_kernel_ref_tab_noener,
-  nbnxn_kernel_ref_tab_twin_noener };
+p_nbk_func_noener p_nbk_c_noener[coultNR][vdwtNR] =
+{ NBK_FN(rf      ,noener),
+  NBK_FN(rf_twin ,noener),
+  NBK_FN(tab     ,noener),
+  NBK_FN(tab_twin,noener) };
+
+#undef NBK_FN
 
 void
 nbnxn_kernel_ref(const nbnxn_pairlist_set_t *nbl_list,
@@ -152,7 +127,7 @@ nbnxn_kernel_ref(const nbnxn_pairlist_set_t *nbl_list,
 {
     int              nnbl;
     nbnxn_pairlist_t **nbl;
-    int coult;
+    int coult,vdwt;
     int nb;
 
     nnbl = nbl_list->nnbl;
@@ -160,7 +135,14 @@ nbnxn_kernel_ref(const nbnxn_pairlist_set_t *nbl_list,
 
     if (EEL_RF(ic->eeltype) || ic->eeltype == eelCUT)
     {
-        coult = coultRF;
+        if (ic->rcoulomb == ic->rvdw)
+        {
+            coult = coultRF;
+        }
+        else
+        {
+            coult = coultRF_TWIN;
+        }
     }
     else
     {
@@ -174,6 +156,19 @@ nbnxn_kernel_ref(const nbnxn_pairlist_set_t *nbl_list,
         }
     }
 
+    switch (ic->vdw_modifier)
+    {
+        case eintmodFORCESWITCH:
+            vdwt = vdwtLJ_FSW;
+            break;
+        case eintmodPOTSWITCH:
+            vdwt = vdwtLJ_PSW;
+            break;
+        default:
+            vdwt = vdwtLJ;
+            break;
+    }
+
 #pragma omp parallel for schedule(static) num_threads(gmx_omp_nthreads_get(emntNonbonded))
     for(nb=0; nb<nnbl; nb++)
     {
@@ -204,11 +199,11 @@ nbnxn_kernel_ref(const nbnxn_pairlist_set_t *nbl_list,
         if (!(force_flags & GMX_FORCE_ENERGY))
         {
             /* Don't calculate energies */
-            p_nbk_c_noener[coult](nbl[nb],nbat,
-                                  ic,
-                                  shift_vec,
-                                  out->f,
-                                  fshift_p);
+            p_nbk_c_noener[coult][vdwt](nbl[nb],nbat,
+                                        ic,
+                                        shift_vec,
+                                        out->f,
+                                        fshift_p);
         }
         else if (out->nV == 1)
         {
@@ -216,13 +211,13 @@ nbnxn_kernel_ref(const nbnxn_pairlist_set_t *nbl_list,
             out->Vvdw[0] = 0;
             out->Vc[0]   = 0;
 
-            p_nbk_c_ener[coult](nbl[nb],nbat,
-                                ic,
-                                shift_vec,
-                                out->f,
-                                fshift_p,
-                                out->Vvdw,
-                                out->Vc);
+            p_nbk_c_ener[coult][vdwt](nbl[nb],nbat,
+                                      ic,
+                                      shift_vec,
+                                      out->f,
+                                      fshift_p,
+                                      out->Vvdw,
+                                      out->Vc);
         }
         else
         {
@@ -238,13 +233,13 @@ nbnxn_kernel_ref(const nbnxn_pairlist_set_t *nbl_list,
                 out->Vc[i] = 0;
             }
 
-            p_nbk_c_energrp[coult](nbl[nb],nbat,
-                                   ic,
-                                   shift_vec,
-                                   out->f,
-                                   fshift_p,
-                                   out->Vvdw,
-                                   out->Vc);
+            p_nbk_c_energrp[coult][vdwt](nbl[nb],nbat,
+                                         ic,
+                                         shift_vec,
+                                         out->f,
+                                         fshift_p,
+                                         out->Vvdw,
+                                         out->Vc);
         }
     }
 
@@ -67,6 +67,12 @@
                     real rinvsq,rinvsix;
                     real c6,c12;
                     real FrLJ6=0,FrLJ12=0,VLJ=0;
+#if defined LJ_FORCE_SWITCH || defined LJ_POT_SWITCH
+                    real r,rsw,rsw2;
+#endif
+#ifdef LJ_POT_SWITCH
+                    real sw,dsw;
+#endif
 #ifdef CALC_COULOMB
                     real qq;
                     real fcoul;
@@ -158,9 +164,35 @@
                         FrLJ6   = c6*rinvsix;
                         FrLJ12  = c12*rinvsix*rinvsix;
                         /* 6 flops for r^-2 + LJ force */
+#if defined LJ_FORCE_SWITCH || defined LJ_POT_SWITCH
+                        /* The distance beyond the switch radius,
+                         * zero for pairs beyond the cut-off and excluded pairs.
+                         */
+                        r       = rsq*rinv;
+                        rsw     = r - ic->rvdw_switch;
+                        rsw     = (rsw > 0 ? rsw : 0)*interact;
+#ifdef VDW_CUTOFF_CHECK
+                        rsw    *= skipmask_rvdw;
+#endif
+                        rsw2    = rsw*rsw;
+#endif
+#ifdef LJ_POT_SWITCH
+                        sw      = 1 + rsw2*rsw*(ic->vdw_switch_c3 + rsw*(ic->vdw_switch_c4 + rsw*ic->vdw_switch_c5));
+                        dsw     = rsw2*(3*ic->vdw_switch_c3 + rsw*(4*ic->vdw_switch_c4 + rsw*5*ic->vdw_switch_c5));
+#endif
 #ifdef CALC_ENERGIES
+#ifndef LJ_FORCE_SWITCH
                         VLJ     = (FrLJ12 - c12*sh_invrc6*sh_invrc6)/12 -
                                   (FrLJ6 - c6*sh_invrc6)/6;
+#else
+                        VLJ     = (FrLJ12 + c12*ic->repulsion_shift_cpot)/12 -
+                                  c12*(ic->repulsion_shift_c2/3 + rsw*ic->repulsion_shift_c3/4)*rsw2*rsw -
+                                  (FrLJ6 + c6*ic->dispersion_shift_cpot)/6 +
+                                  c6*(ic->dispersion_shift_c2/3 + rsw*ic->dispersion_shift_c3/4)*rsw2*rsw;
+#endif
+#ifdef LJ_POT_SWITCH
+                        VLJ    *= sw;
+#endif
                         /* Need to zero the interaction if r >= rcut
                          * or there should be exclusion. */
                         VLJ     = VLJ * skipmask * interact;
@@ -174,6 +206,15 @@
                         Vvdw_ci += VLJ;
                         /* 1 flop for LJ energy addition */
 #endif
+#endif
+#ifdef LJ_FORCE_SWITCH
+                        FrLJ6  += c6*(ic->dispersion_shift_c2 + ic->dispersion_shift_c3*rsw)*rsw2*r;
+                        FrLJ12 += c12*(ic->repulsion_shift_c2 + ic->repulsion_shift_c3*rsw)*rsw2*r;
+#endif
+#ifdef LJ_POT_SWITCH
+                        /* F*r = F*r*sw - V*dsw*r, with V = FrLJ12/12 - FrLJ6/6 */
+                        FrLJ6  *= sw - r*dsw/6;
+                        FrLJ12 *= sw - r*dsw/12;
 #endif
                     }
 
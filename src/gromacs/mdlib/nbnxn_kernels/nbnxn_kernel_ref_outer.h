@@ -49,14 +49,28 @@
 /* We always calculate shift forces, because it's cheap anyhow */
 #define CALC_SHIFTFORCES
 
+#ifdef LJ_FORCE_SWITCH
+#define NBK_FUNC_NAME_C(x,c,y) x##_##c##_lj_fsw_##y
+#else
+#ifdef LJ_POT_SWITCH
+#define NBK_FUNC_NAME_C(x,c,y) x##_##c##_lj_psw_##y
+#else
+#define NBK_FUNC_NAME_C(x,c,y) x##_##c##_lj_##y
+#endif
+#endif
+
 #ifdef CALC_COUL_RF
-#define NBK_FUNC_NAME(x,y) x##_rf_##y
+#ifndef VDW_CUTOFF_CHECK
+#define NBK_FUNC_NAME(x,y) NBK_FUNC_NAME_C(x,rf,y)
+#else
+#define NBK_FUNC_NAME(x,y) NBK_FUNC_NAME_C(x,rf_twin,y)
+#endif
 #endif
 #ifdef CALC_COUL_TAB
 #ifndef VDW_CUTOFF_CHECK
-#define NBK_FUNC_NAME(x,y) x##_tab_##y
+#define NBK_FUNC_NAME(x,y) NBK_FUNC_NAME_C(x,tab,y)
 #else
-#define NBK_FUNC_NAME(x,y) x##_tab_twin_##y
+#define NBK_FUNC_NAME(x,y) NBK_FUNC_NAME_C(x,tab_twin,y)
 #endif
 #endif
 
@@ -71,6 +85,7 @@ NBK_FUNC_NAME(nbnxn_kernel_ref,energrp)
 #endif
 #endif
 #undef NBK_FUNC_NAME
+#undef NBK_FUNC_NAME_C
                             (const nbnxn_pairlist_t     *nbl,
                              const nbnxn_atomdata_t     *nbat,
                              const interaction_const_t  *ic,
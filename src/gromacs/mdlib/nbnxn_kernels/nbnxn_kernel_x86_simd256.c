@@ -57,8 +57,14 @@
 /* Analytical reaction-field kernels */
 #define CALC_COUL_RF
 
+/* Single cut-off: rcoulomb = rvdw */
 #include "nbnxn_kernel_x86_simd_includes.h"
 
+/* Twin cut-off: rcoulomb >= rvdw */
+#define VDW_CUTOFF_CHECK
+#include "nbnxn_kernel_x86_simd_includes.h"
+#undef VDW_CUTOFF_CHECK
+
 #undef CALC_COUL_RF
 
 /* Tabulated exclusion interaction electrostatics kernels */
@@ -104,33 +110,41 @@ typedef void (*p_nbk_func_noener)(const nbnxn_pairlist_t     *nbl,
                                   real                       *f,
                                   real                       *fshift);
 
-enum { coultRF, coultTAB, coultTAB_TWIN, coultEWALD, coultEWALD_TWIN, coultNR };
+enum { coultRF, coultRF_TWIN, coultTAB, coultTAB_TWIN, coultEWALD, coultEWALD_TWIN, coultNR };
 
-#define NBK_FN(elec,ljcomb) nbnxn_kernel_x86_simd256_##elec##_comb_##ljcomb##_ener
-static p_nbk_func_ener p_nbk_ener[coultNR][ljcrNR] =
-{ { NBK_FN(rf        ,geom), NBK_FN(rf        ,lb), NBK_FN(rf        ,none) },
-  { NBK_FN(tab       ,geom), NBK_FN(tab       ,lb), NBK_FN(tab       ,none) },
-  { NBK_FN(tab_twin  ,geom), NBK_FN(tab_twin  ,lb), NBK_FN(tab_twin  ,none) },
-  { NBK_FN(ewald     ,geom), NBK_FN(ewald     ,lb), NBK_FN(ewald     ,none) },
-  { NBK_FN(ewald_twin,geom), NBK_FN(ewald_twin,lb), NBK_FN(ewald_twin,none) } };
+/* LJ kernel flavors: plain cut-off with the three combination rule types
+ * and force- and potential-switched LJ, which use the full LJ matrix.
+ */
+enum { vdwktLJCUT_COMBGEOM, vdwktLJCUT_COMBLB, vdwktLJCUT_COMBNONE, vdwktLJFORCESWITCH, vdwktLJPOTSWITCH, vdwktNR };
+
+#define NBK_FN(elec,ljt) nbnxn_kernel_x86_simd256_##elec##_##ljt##_ener
+static p_nbk_func_ener p_nbk_ener[coultNR][vdwktNR] =
+{ { NBK_FN(rf        ,comb_geom), NBK_FN(rf        ,comb_lb), NBK_FN(rf        ,comb_none), NBK_FN(rf        ,lj_fsw), NBK_FN(rf        ,lj_psw) },
+  { NBK_FN(rf_twin   ,comb_geom), NBK_FN(rf_twin   ,comb_lb), NBK_FN(rf_twin   ,comb_none), NBK_FN(rf_twin   ,lj_fsw), NBK_FN(rf_twin   ,lj_psw) },
+  { NBK_FN(tab       ,comb_geom), NBK_FN(tab       ,comb_lb), NBK_FN(tab       ,comb_none), NBK_FN(tab       ,lj_fsw), NBK_FN(tab       ,lj_psw) },
+  { NBK_FN(tab_twin  ,comb_geom), NBK_FN(tab_twin  ,comb_lb), NBK_FN(tab_twin  ,comb_none), NBK_FN(tab_twin  ,lj_fsw), NBK_FN(tab_twin  ,lj_psw) },
+  { NBK_FN(ewald     ,comb_geom), NBK_FN(ewald     ,comb_lb), NBK_FN(ewald     ,comb_none), NBK_FN(ewald     ,lj_fsw), NBK_FN(ewald     ,lj_psw) },
+  { NBK_FN(ewald_twin,comb_geom), NBK_FN(ewald_twin,comb_lb), NBK_FN(ewald_twin,comb_none), NBK_FN(ewald_twin,lj_fsw), NBK_FN(ewald_twin,lj_psw) } };
 #undef NBK_FN
 
-#define NBK_FN(elec,ljcomb) nbnxn_kernel_x86_simd256_##elec##_comb_##ljcomb##_energrp
-static p_nbk_func_ener p_nbk_energrp[coultNR][ljcrNR] =
-{ { NBK_FN(rf        ,geom), NBK_FN(rf        ,lb), NBK_FN(rf        ,none) },
-  { NBK_FN(tab       ,geom), NBK_FN(tab       ,lb), NBK_FN(tab       ,none) },
-  { NBK_FN(tab_twin  ,geom), NBK_FN(tab_twin  ,lb), NBK_FN(tab_twin  ,none) },
-  { NBK_FN(ewald     ,geom), NBK_FN(ewald     ,lb), NBK_FN(ewald     ,none) },
-  { NBK_FN(ewald_twin,geom), NBK_FN(ewald_twin,lb), NBK_FN(ewald_twin,none) } };
+#define NBK_FN(elec,ljt) nbnxn_kernel_x86_simd256_##elec##_##ljt##_energrp
+static p_nbk_func_ener p_nbk_energrp[coultNR][vdwktNR] =
+{ { NBK_FN(rf        ,comb_geom), NBK_FN(rf        ,comb_lb), NBK_FN(rf        ,comb_none), NBK_FN(rf        ,lj_fsw), NBK_FN(rf        ,lj_psw) },
+  { NBK_FN(rf_twin   ,comb_geom), NBK_FN(rf_twin   ,comb_lb), NBK_FN(rf_twin   ,comb_none), NBK_FN(rf_twin   ,lj_fsw), NBK_FN(rf_twin   ,lj_psw) },
+  { NBK_FN(tab       ,comb_geom), NBK_FN(tab       ,comb_lb), NBK_FN(tab       ,comb_none), NBK_FN(tab       ,lj_fsw), NBK_FN(tab       ,lj_psw) },
+  { NBK_FN(tab_twin  ,comb_geom), NBK_FN(tab_twin  ,comb_lb), NBK_FN(tab_twin  ,comb_none), NBK_FN(tab_twin  ,lj_fsw), NBK_FN(tab_twin  ,lj_psw) },
+  { NBK_FN(ewald     ,comb_geom), NBK_FN(ewald     ,comb_lb), NBK_FN(ewald     ,comb_none), NBK_FN(ewald     ,lj_fsw), NBK_FN(ewald     ,lj_psw) },
+  { NBK_FN(ewald_twin,comb_geom), NBK_FN(ewald_twin,comb_lb), NBK_FN(ewald_twin,comb_none), NBK_FN(ewald_twin,lj_fsw), NBK_FN(ewald_twin,lj_psw) } };
 #undef NBK_FN
 
-#define NBK_FN(elec,ljcomb) nbnxn_kernel_x86_simd256_##elec##_comb_##ljcomb##_noener
-static p_nbk_func_noener p_nbk_noener[coultNR][ljcrNR] =
-{ { NBK_FN(rf        ,geom), NBK_FN(rf        ,lb), NBK_FN(rf        ,none) },
-  { NBK_FN(tab       ,geom), NBK_FN(tab       ,lb), NBK_FN(tab       ,none) },
-  { NBK_FN(tab_twin  ,geom), NBK_FN(tab_twin  ,lb), NBK_FN(tab_twin  ,none) },
-  { NBK_FN(ewald     ,geom), NBK_FN(ewald     ,lb), NBK_FN(ewald     ,none) },
-  { NBK_FN(ewald_twin,geom), NBK_FN(ewald_twin,lb), NBK_FN(ewald_twin,none) } };
+#define NBK_FN(elec,ljt) nbnxn_kernel_x86_simd256_##elec##_##ljt##_noener
+static p_nbk_func_noener p_nbk_noener[coultNR][vdwktNR] =
+{ { NBK_FN(rf        ,comb_geom), NBK_FN(rf        ,comb_lb), NBK_FN(rf        ,comb_none), NBK_FN(rf        ,lj_fsw), NBK_FN(rf        ,lj_psw) },
+  { NBK_FN(rf_twin   ,comb_geom), NBK_FN(rf_twin   ,comb_lb), NBK_FN(rf_twin   ,comb_none), NBK_FN(rf_twin   ,lj_fsw), NBK_FN(rf_twin   ,lj_psw) },
+  { NBK_FN(tab       ,comb_geom), NBK_FN(tab       ,comb_lb), NBK_FN(tab       ,comb_none), NBK_FN(tab       ,lj_fsw), NBK_FN(tab       ,lj_psw) },
+  { NBK_FN(tab_twin  ,comb_geom), NBK_FN(tab_twin  ,comb_lb), NBK_FN(tab_twin  ,comb_none), NBK_FN(tab_twin  ,lj_fsw), NBK_FN(tab_twin  ,lj_psw) },
+  { NBK_FN(ewald     ,comb_geom), NBK_FN(ewald     ,comb_lb), NBK_FN(ewald     ,comb_none), NBK_FN(ewald     ,lj_fsw), NBK_FN(ewald     ,lj_psw) },
+  { NBK_FN(ewald_twin,comb_geom), NBK_FN(ewald_twin,comb_lb), NBK_FN(ewald_twin,comb_none), NBK_FN(ewald_twin,lj_fsw), NBK_FN(ewald_twin,lj_psw) } };
 #undef NBK_FN
 
 
@@ -191,7 +205,7 @@ nbnxn_kernel_x86_simd256(nbnxn_pairlist_set_t       *nbl_list,
 {
     int              nnbl;
     nbnxn_pairlist_t **nbl;
-    int coult;
+    int coult,vdwkt;
     int nb;
 
     nnbl = nbl_list->nnbl;
@@ -199,7 +213,14 @@ nbnxn_kernel_x86_simd256(nbnxn_pairlist_set_t       *nbl_list,
 
     if (EEL_RF(ic->eeltype) || ic->eeltype == eelCUT)
     {
-        coult = coultRF;
+        if (ic->rcoulomb == ic->rvdw)
+        {
+            coult = coultRF;
+        }
+        else
+        {
+            coult = coultRF_TWIN;
+        }
     }
     else
     {
@@ -227,6 +248,33 @@ nbnxn_kernel_x86_simd256(nbnxn_pairlist_set_t       *nbl_list,
         }
     }
 
+    switch (ic->vdw_modifier)
+    {
+        case eintmodFORCESWITCH:
+            vdwkt = vdwktLJFORCESWITCH;
+            break;
+        case eintmodPOTSWITCH:
+            vdwkt = vdwktLJPOTSWITCH;
+            break;
+        default:
+            switch (nbat->comb_rule)
+            {
+                case ljcrGEOM:
+                    vdwkt = vdwktLJCUT_COMBGEOM;
+                    break;
+                case ljcrLB:
+                    vdwkt = vdwktLJCUT_COMBLB;
+                    break;
+                case ljcrNONE:
+                    vdwkt = vdwktLJCUT_COMBNONE;
+                    break;
+                default:
+                    gmx_incons("Unknown combination rule");
+                    break;
+            }
+            break;
+    }
+
 #pragma omp parallel for schedule(static) num_threads(gmx_omp_nthreads_get(emntNonbonded))
     for(nb=0; nb<nnbl; nb++)
     {
@@ -262,11 +310,11 @@ nbnxn_kernel_x86_simd256(nbnxn_pairlist_set_t       *nbl_list,
               (EEL_FULL(ic->eeltype) && (force_flags & GMX_FORCE_VIRIAL))))
         {
             /* Don't calculate energies */
-            p_nbk_noener[coult][nbat->comb_rule](nbl[nb],nbat,
-                                                 ic,
-                                                 shift_vec,
-                                                 out->f,
-                                                 fshift_p);
+            p_nbk_noener[coult][vdwkt](nbl[nb],nbat,
+                                       ic,
+                                       shift_vec,
+                                       out->f,
+                                       fshift_p);
         }
         else if (out->nV == 1 || !(force_flags & GMX_FORCE_ENERGY))
         {
@@ -274,13 +322,13 @@ nbnxn_kernel_x86_simd256(nbnxn_pairlist_set_t       *nbl_list,
             out->Vvdw[0] = 0;
             out->Vc[0]   = 0;
 
-            p_nbk_ener[coult][nbat->comb_rule](nbl[nb],nbat,
-                                               ic,
-                                               shift_vec,
-                                               out->f,
-                                               fshift_p,
-                                               out->Vvdw,
-                                               out->Vc);
+            p_nbk_ener[coult][vdwkt](nbl[nb],nbat,
+                                     ic,
+                                     shift_vec,
+                                     out->f,
+                                     fshift_p,
+                                     out->Vvdw,
+                                     out->Vc);
         }
         else
         {
@@ -296,13 +344,13 @@ nbnxn_kernel_x86_simd256(nbnxn_pairlist_set_t       *nbl_list,
                 out->VSc[i] = 0;
             }
 
-            p_nbk_energrp[coult][nbat->comb_rule](nbl[nb],nbat,
-                                                  ic,
-                                                  shift_vec,
-                                                  out->f,
-                                                  fshift_p,
-                                                  out->VSvdw,
-                                                  out->VSc);
+            p_nbk_energrp[coult][vdwkt](nbl[nb],nbat,
+                                        ic,
+                                        shift_vec,
+                                        out->f,
+                                        fshift_p,
+                                        out->VSvdw,
+                                        out->VSc);
 
             reduce_group_energies(nbat->nenergrp,nbat->neg_2log,
                                   out->VSvdw,out->VSc,
@@ -0,0 +1,375 @@
+/* -*- mode: c; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4; c-file-style: "stroustrup"; -*-
+ *
+ *
+ *                This source code is part of
+ *
+ *                 G   R   O   M   A   C   S
+ *
+ *          GROningen MAchine for Chemical Simulations
+ *
+ * Written by David van der Spoel, Erik Lindahl, Berk Hess, and others.
+ * Copyright (c) 1991-2000, University of Groningen, The Netherlands.
+ * Copyright (c) 2001-2012, The GROMACS development team,
+ * check out http://www.gromacs.org for more information.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * If you want to redistribute modifications, please consider that
+ * scientific software is very special. Version control is crucial -
+ * bugs must be traceable. We will be happy to consider code for
+ * inclusion in the official distribution, but derived work must not
+ * be called official GROMACS. Details are found in the README & COPYING
+ * files - if they are missing, get the official version at www.gromacs.org.
+ *
+ * To help us fund GROMACS development, we humbly ask that you cite
+ * the papers on the package - you can find them in the top README file.
+ *
+ * For more info, check our website at http://www.gromacs.org
+ *
+ * And Hey:
+ * Gallium Rubidium Oxygen Manganese Argon Carbon Silicon
+ */
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include <math.h>
+
+#include "typedefs.h"
+#include "vec.h"
+#include "smalloc.h"
+#include "force.h"
+#include "gmx_omp_nthreads.h"
+#include "../nbnxn_consts.h"
+#include "nbnxn_kernel_common.h"
+
+#ifdef GMX_X86_AVX_512
+
+#include "nbnxn_kernel_x86_simd512.h"
+
+/* Include all flavors of the 512-bit AVX kernel loops.
+ * These use a 2x(N+N) layout: each register holds two i-atoms
+ * times a j-cluster of half the SIMD width, so the cluster sizes
+ * and data layouts are the same as for the 256-bit kernels.
+ */
+
+#define GMX_MM512_HERE
+
+/* Analytical reaction-field kernels */
+#define CALC_COUL_RF
+
+/* Single cut-off: rcoulomb = rvdw */
+#include "nbnxn_kernel_x86_simd_2xnn_includes.h"
+
+/* Twin cut-off: rcoulomb >= rvdw */
+#define VDW_CUTOFF_CHECK
+#include "nbnxn_kernel_x86_simd_2xnn_includes.h"
+#undef VDW_CUTOFF_CHECK
+
+#undef CALC_COUL_RF
+
+/* Tabulated exclusion interaction electrostatics kernels */
+#define CALC_COUL_TAB
+
+/* Single cut-off: rcoulomb = rvdw */
+#include "nbnxn_kernel_x86_simd_2xnn_includes.h"
+
+/* Twin cut-off: rcoulomb >= rvdw */
+#define VDW_CUTOFF_CHECK
+#include "nbnxn_kernel_x86_simd_2xnn_includes.h"
+#undef VDW_CUTOFF_CHECK
+
+#undef CALC_COUL_TAB
+
+/* Analytical Ewald exclusion interaction electrostatics kernels */
+#define CALC_COUL_EWALD
+
+/* Single cut-off: rcoulomb = rvdw */
+#include "nbnxn_kernel_x86_simd_2xnn_includes.h"
+
+/* Twin cut-off: rcoulomb >= rvdw */
+#define VDW_CUTOFF_CHECK
+#include "nbnxn_kernel_x86_simd_2xnn_includes.h"
+#undef VDW_CUTOFF_CHECK
+
+#undef CALC_COUL_EWALD
+
+
+typedef void (*p_nbk_func_ener)(const nbnxn_pairlist_t     *nbl,
+                                const nbnxn_atomdata_t     *nbat,
+                                const interaction_const_t  *ic,
+                                rvec                       *shift_vec,
+                                real                       *f,
+                                real                       *fshift,
+                                real                       *Vvdw,
+                                real                       *Vc);
+
+typedef void (*p_nbk_func_noener)(const nbnxn_pairlist_t     *nbl,
+                                  const nbnxn_atomdata_t     *nbat,
+                                  const interaction_const_t  *ic,
+                                  rvec                       *shift_vec,
+                                  real                       *f,
+                                  real                       *fshift);
+
+enum { coultRF, coultRF_TWIN, coultTAB, coultTAB_TWIN, coultEWALD, coultEWALD_TWIN, coultNR };
+
+/* LJ kernel flavors: plain cut-off with the three combination rule types
+ * and force- and potential-switched LJ, which use the full LJ matrix.
+ */
+enum { vdwktLJCUT_COMBGEOM, vdwktLJCUT_COMBLB, vdwktLJCUT_COMBNONE, vdwktLJFORCESWITCH, vdwktLJPOTSWITCH, vdwktNR };
+
+#define NBK_FN(elec,ljt) nbnxn_kernel_x86_simd512_##elec##_##ljt##_ener
+static p_nbk_func_ener p_nbk_ener[coultNR][vdwktNR] =
+{ { NBK_FN(rf        ,comb_geom), NBK_FN(rf        ,comb_lb), NBK_FN(rf        ,comb_none), NBK_FN(rf        ,lj_fsw), NBK_FN(rf        ,lj_psw) },
+  { NBK_FN(rf_twin   ,comb_geom), NBK_FN(rf_twin   ,comb_lb), NBK_FN(rf_twin   ,comb_none), NBK_FN(rf_twin   ,lj_fsw), NBK_FN(rf_twin   ,lj_psw) },
+  { NBK_FN(tab       ,comb_geom), NBK_FN(tab       ,comb_lb), NBK_FN(tab       ,comb_none), NBK_FN(tab       ,lj_fsw), NBK_FN(tab       ,lj_psw) },
+  { NBK_FN(tab_twin  ,comb_geom), NBK_FN(tab_twin  ,comb_lb), NBK_FN(tab_twin  ,comb_none), NBK_FN(tab_twin  ,lj_fsw), NBK_FN(tab_twin  ,lj_psw) },
+  { NBK_FN(ewald     ,comb_geom), NBK_FN(ewald     ,comb_lb), NBK_FN(ewald     ,comb_none), NBK_FN(ewald     ,lj_fsw), NBK_FN(ewald     ,lj_psw) },
+  { NBK_FN(ewald_twin,comb_geom), NBK_FN(ewald_twin,comb_lb), NBK_FN(ewald_twin,comb_none), NBK_FN(ewald_twin,lj_fsw), NBK_FN(ewald_twin,lj_psw) } };
+#undef NBK_FN
+
+#define NBK_FN(elec,ljt) nbnxn_kernel_x86_simd512_##elec##_##ljt##_energrp
+static p_nbk_func_ener p_nbk_energrp[coultNR][vdwktNR] =
+{ { NBK_FN(rf        ,comb_geom), NBK_FN(rf        ,comb_lb), NBK_FN(rf        ,comb_none), NBK_FN(rf        ,lj_fsw), NBK_FN(rf        ,lj_psw) },
+  { NBK_FN(rf_twin   ,comb_geom), NBK_FN(rf_twin   ,comb_lb), NBK_FN(rf_twin   ,comb_none), NBK_FN(rf_twin   ,lj_fsw), NBK_FN(rf_twin   ,lj_psw) },
+  { NBK_FN(tab       ,comb_geom), NBK_FN(tab       ,comb_lb), NBK_FN(tab       ,comb_none), NBK_FN(tab       ,lj_fsw), NBK_FN(tab       ,lj_psw) },
+  { NBK_FN(tab_twin  ,comb_geom), NBK_FN(tab_twin  ,comb_lb), NBK_FN(tab_twin  ,comb_none), NBK_FN(tab_twin  ,lj_fsw), NBK_FN(tab_twin  ,lj_psw) },
+  { NBK_FN(ewald     ,comb_geom), NBK_FN(ewald     ,comb_lb), NBK_FN(ewald     ,comb_none), NBK_FN(ewald     ,lj_fsw), NBK_FN(ewald     ,lj_psw) },
+  { NBK_FN(ewald_twin,comb_geom), NBK_FN(ewald_twin,comb_lb), NBK_FN(ewald_twin,comb_none), NBK_FN(ewald_twin,lj_fsw), NBK_FN(ewald_twin,lj_psw) } };
+#undef NBK_FN
+
+#define NBK_FN(elec,ljt) nbnxn_kernel_x86_simd512_##elec##_##ljt##_noener
+static p_nbk_func_noener p_nbk_noener[coultNR][vdwktNR] =
+{ { NBK_FN(rf        ,comb_geom), NBK_FN(rf        ,comb_lb), NBK_FN(rf        ,comb_none), NBK_FN(rf        ,lj_fsw), NBK_FN(rf        ,lj_psw) },
+  { NBK_FN(rf_twin   ,comb_geom), NBK_FN(rf_twin   ,comb_lb), NBK_FN(rf_twin   ,comb_none), NBK_FN(rf_twin   ,lj_fsw), NBK_FN(rf_twin   ,lj_psw) },
+  { NBK_FN(tab       ,comb_geom), NBK_FN(tab       ,comb_lb), NBK_FN(tab       ,comb_none), NBK_FN(tab       ,lj_fsw), NBK_FN(tab       ,lj_psw) },
+  { NBK_FN(tab_twin  ,comb_geom), NBK_FN(tab_twin  ,comb_lb), NBK_FN(tab_twin  ,comb_none), NBK_FN(tab_twin  ,lj_fsw), NBK_FN(tab_twin  ,lj_psw) },
+  { NBK_FN(ewald     ,comb_geom), NBK_FN(ewald     ,comb_lb), NBK_FN(ewald     ,comb_none), NBK_FN(ewald     ,lj_fsw), NBK_FN(ewald     ,lj_psw) },
+  { NBK_FN(ewald_twin,comb_geom), NBK_FN(ewald_twin,comb_lb), NBK_FN(ewald_twin,comb_none), NBK_FN(ewald_twin,lj_fsw), NBK_FN(ewald_twin,lj_psw) } };
+#undef NBK_FN
+
+
+static void reduce_group_energies(int ng,int ng_2log,
+                                  const real *VSvdw,const real *VSc,
+                                  real *Vvdw,real *Vc)
+{
+    int ng_p2,i,j,j0,j1,c,s;
+
+    /* The energy buffers are stored per j-cluster of half the SIMD width */
+#define SIMD_WIDTH       (GMX_X86_SIMD_WIDTH_HERE/2)
+#define SIMD_WIDTH_HALF  (GMX_X86_SIMD_WIDTH_HERE/4)
+
+    ng_p2 = (1<<ng_2log);
+
+    /* The size of the x86 SIMD energy group buffer array is:
+     * ng*ng*ng_p2*SIMD_WIDTH_HALF*SIMD_WIDTH
+     */
+    for(i=0; i<ng; i++)
+    {
+        for(j=0; j<ng; j++)
+        {
+            Vvdw[i*ng+j] = 0;
+            Vc[i*ng+j]   = 0;
+        }
+
+        for(j1=0; j1<ng; j1++)
+        {
+            for(j0=0; j0<ng; j0++)
+            {
+                c = ((i*ng + j1)*ng_p2 + j0)*SIMD_WIDTH_HALF*SIMD_WIDTH;
+                for(s=0; s<SIMD_WIDTH_HALF; s++)
+                {
+                    Vvdw[i*ng+j0] += VSvdw[c+0];
+                    Vvdw[i*ng+j1] += VSvdw[c+1];
+                    Vc  [i*ng+j0] += VSc  [c+0];
+                    Vc  [i*ng+j1] += VSc  [c+1];
+                    c += SIMD_WIDTH + 2;
+                }
+            }
+        }
+    }
+}
+
+#endif /* GMX_X86_AVX_512 */
+
+void
+nbnxn_kernel_x86_simd512(nbnxn_pairlist_set_t       *nbl_list,
+                         const nbnxn_atomdata_t     *nbat,
+                         const interaction_const_t  *ic,
+                         int                        ewald_excl,
+                         rvec                       *shift_vec, 
+                         int                        force_flags,
+                         int                        clearF,
+                         real                       *fshift,
+                         real                       *Vc,
+                         real                       *Vvdw)
+#ifdef GMX_X86_AVX_512
+{
+    int              nnbl;
+    nbnxn_pairlist_t **nbl;
+    int coult,vdwkt;
+    int nb;
+
+    nnbl = nbl_list->nnbl;
+    nbl  = nbl_list->nbl;
+
+    if (EEL_RF(ic->eeltype) || ic->eeltype == eelCUT)
+    {
+        if (ic->rcoulomb == ic->rvdw)
+        {
+            coult = coultRF;
+        }
+        else
+        {
+            coult = coultRF_TWIN;
+        }
+    }
+    else
+    {
+        if (ewald_excl == ewaldexclTable)
+        {
+            if (ic->rcoulomb == ic->rvdw)
+            {
+                coult = coultTAB;
+            }
+            else
+            {
+                coult = coultTAB_TWIN;
+            }
+        }
+        else
+        {
+            if (ic->rcoulomb == ic->rvdw)
+            {
+                coult = coultEWALD;
+            }
+            else
+            {
+                coult = coultEWALD_TWIN;
+            }
+        }
+    }
+
+    switch (ic->vdw_modifier)
+    {
+        case eintmodFORCESWITCH:
+            vdwkt = vdwktLJFORCESWITCH;
+            break;
+        case eintmodPOTSWITCH:
+            vdwkt = vdwktLJPOTSWITCH;
+            break;
+        default:
+            switch (nbat->comb_rule)
+            {
+                case ljcrGEOM:
+                    vdwkt = vdwktLJCUT_COMBGEOM;
+                    break;
+                case ljcrLB:
+                    vdwkt = vdwktLJCUT_COMBLB;
+                    break;
+                case ljcrNONE:
+                    vdwkt = vdwktLJCUT_COMBNONE;
+                    break;
+                default:
+                    gmx_incons("Unknown combination rule");
+                    break;
+            }
+            break;
+    }
+
+#pragma omp parallel for schedule(static) num_threads(gmx_omp_nthreads_get(emntNonbonded))
+    for(nb=0; nb<nnbl; nb++)
+    {
+        nbnxn_atomdata_output_t *out;
+        real *fshift_p;
+
+        out = &nbat->out[nb];
+
+        if (clearF == enbvClearFYes)
+        {
+            clear_f(nbat,nb,out->f);
+        }
+
+        if ((force_flags & GMX_FORCE_VIRIAL) && nnbl == 1)
+        {
+            fshift_p = fshift;
+        }
+        else
+        {
+            fshift_p = out->fshift;
+
+            if (clearF == enbvClearFYes)
+            {
+                clear_fshift(fshift_p);
+            }
+        }
+
+        /* With Ewald type electrostatics we the forces for excluded atom pairs
+         * should not contribute to the virial sum. The exclusion forces
+         * are not calculate in the energy kernels, but are in _noener.
+         */
+        if (!((force_flags & GMX_FORCE_ENERGY) ||
+              (EEL_FULL(ic->eeltype) && (force_flags & GMX_FORCE_VIRIAL))))
+        {
+            /* Don't calculate energies */
+            p_nbk_noener[coult][vdwkt](nbl[nb],nbat,
+                                       ic,
+                                       shift_vec,
+                                       out->f,
+                                       fshift_p);
+        }
+        else if (out->nV == 1 || !(force_flags & GMX_FORCE_ENERGY))
+        {
+            /* No energy groups */
+            out->Vvdw[0] = 0;
+            out->Vc[0]   = 0;
+
+            p_nbk_ener[coult][vdwkt](nbl[nb],nbat,
+                                     ic,
+                                     shift_vec,
+                                     out->f,
+                                     fshift_p,
+                                     out->Vvdw,
+                                     out->Vc);
+        }
+        else
+        {
+            /* Calculate energy group contributions */
+            int i;
+
+            for(i=0; i<out->nVS; i++)
+            {
+                out->VSvdw[i] = 0;
+            }
+            for(i=0; i<out->nVS; i++)
+            {
+                out->VSc[i] = 0;
+            }
+
+            p_nbk_energrp[coult][vdwkt](nbl[nb],nbat,
+                                        ic,
+                                        shift_vec,
+                                        out->f,
+                                        fshift_p,
+                                        out->VSvdw,
+                                        out->VSc);
+
+            reduce_group_energies(nbat->nenergrp,nbat->neg_2log,
+                                  out->VSvdw,out->VSc,
+                                  out->Vvdw,out->Vc);
+        }
+    }
+
+    if (force_flags & GMX_FORCE_ENERGY)
+    {
+        reduce_energies_over_lists(nbat,nnbl,Vvdw,Vc);
+    }
+}
+#else
+{
+    gmx_incons("nbnxn_kernel_x86_simd512 called while GROMACS was configured without AVX-512 enabled");
+}
+#endif
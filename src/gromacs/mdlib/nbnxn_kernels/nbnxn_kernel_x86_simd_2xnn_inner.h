@@ -0,0 +1,774 @@
+/* -*- mode: c; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4; c-file-style: "stroustrup"; -*-
+ *
+ *
+ *                This source code is part of
+ *
+ *                 G   R   O   M   A   C   S
+ *
+ * Copyright (c) 1991-2000, University of Groningen, The Netherlands.
+ * Copyright (c) 2001-2009, The GROMACS Development Team
+ *
+ * Gromacs is a library for molecular simulation and trajectory analysis,
+ * written by Erik Lindahl, David van der Spoel, Berk Hess, and others - for
+ * a full list of developers and information, check out http://www.gromacs.org
+ *
+ * This program is free software; you can redistribute it and/or modify it under 
+ * the terms of the GNU Lesser General Public License as published by the Free 
+ * Software Foundation; either version 2 of the License, or (at your option) any 
+ * later version.
+ * As a special exception, you may use this file as part of a free software
+ * library without restriction.  Specifically, if other files instantiate
+ * templates or use macros or inline functions from this file, or you compile
+ * this file and link it with other files to produce an executable, this
+ * file does not by itself cause the resulting executable to be covered by
+ * the GNU Lesser General Public License.  
+ *
+ * In plain-speak: do not worry about classes/macros/templates either - only
+ * changes to the library have to be LGPL, not an application linking with it.
+ *
+ * To help fund GROMACS development, we humbly ask that you cite
+ * the papers people have written on it - you can find them on the website!
+ */
+
+/* This is the innermost loop contents for the n vs n atom
+ * x86 SIMD 2x(N+N) kernels.
+ */
+
+/* When calculating RF or Ewald interactions we calculate the electrostatic
+ * forces on excluded atom pairs here in the non-bonded loops.
+ * But when energies and/or virial is required we calculate them
+ * separately to as then it is easier to separate the energy and virial
+ * contributions.
+ */
+#if defined CHECK_EXCLS && defined CALC_COULOMB
+#define EXCL_FORCES
+#endif
+
+/* All masks, for the cut-off, exclusions and the diagonal, are bit masks
+ * of type gmx_mm_pb, which are applied with gmx_blendzero_pr.
+ */
+
+        {
+            int        cj,aj,ajx,ajy,ajz;
+
+#ifdef ENERGY_GROUPS
+            /* Energy group indices for two atoms packed into one int */
+            int        egp_jj[UNROLLJ/2];
+#endif
+
+#ifdef CHECK_EXCLS
+            /* Interaction (non-exclusion) mask */
+            gmx_mm_pb  int_SSE0;
+            gmx_mm_pb  int_SSE2;
+#endif
+
+            gmx_mm_pr  jxSSE,jySSE,jzSSE;
+            gmx_mm_pr  dx_SSE0,dy_SSE0,dz_SSE0;
+            gmx_mm_pr  dx_SSE2,dy_SSE2,dz_SSE2;
+            gmx_mm_pr  tx_SSE0,ty_SSE0,tz_SSE0;
+            gmx_mm_pr  tx_SSE2,ty_SSE2,tz_SSE2;
+            gmx_mm_pr  rsq_SSE0,rinv_SSE0,rinvsq_SSE0;
+            gmx_mm_pr  rsq_SSE2,rinv_SSE2,rinvsq_SSE2;
+            /* wco: within cut-off mask */
+            gmx_mm_pb  wco_SSE0;
+            gmx_mm_pb  wco_SSE2;
+#ifdef VDW_CUTOFF_CHECK
+            gmx_mm_pb  wco_vdw_SSE0;
+#ifndef HALF_LJ
+            gmx_mm_pb  wco_vdw_SSE2;
+#endif
+#endif
+#ifdef CALC_COULOMB
+#ifdef CHECK_EXCLS
+            /* 1/r masked with the interaction mask */
+            gmx_mm_pr  rinv_ex_SSE0;
+            gmx_mm_pr  rinv_ex_SSE2;
+#endif
+            gmx_mm_pr  jq_SSE;
+            gmx_mm_pr  qq_SSE0;
+            gmx_mm_pr  qq_SSE2;
+#ifdef CALC_COUL_TAB
+            /* The force (PME mesh force) we need to subtract from 1/r^2 */
+            gmx_mm_pr  fsub_SSE0;
+            gmx_mm_pr  fsub_SSE2;
+#endif
+#ifdef CALC_COUL_EWALD
+            gmx_mm_pr  brsq_SSE0,brsq_SSE2;
+            gmx_mm_pr  ewcorr_SSE0,ewcorr_SSE2;
+#endif
+
+            /* frcoul = (1/r - fsub)*r */
+            gmx_mm_pr  frcoul_SSE0;
+            gmx_mm_pr  frcoul_SSE2;
+#ifdef CALC_COUL_TAB
+            /* For tables: r, rs=r/sp, rf=floor(rs), frac=rs-rf */
+            gmx_mm_pr  r_SSE0,rs_SSE0,rf_SSE0,frac_SSE0;
+            gmx_mm_pr  r_SSE2,rs_SSE2,rf_SSE2,frac_SSE2;
+            /* Table index: rs converted to an int */
+            gmx_epi32  ti_SSE0,ti_SSE2;
+            /* Linear force table values */
+            gmx_mm_pr  ctab0_SSE0,ctab1_SSE0;
+            gmx_mm_pr  ctab0_SSE2,ctab1_SSE2;
+#ifdef CALC_ENERGIES
+            /* Quadratic energy table value */
+            gmx_mm_pr  ctabv_SSE0;
+            gmx_mm_pr  ctabv_SSE2;
+#endif
+#endif
+#if defined CALC_ENERGIES && (defined CALC_COUL_EWALD || defined CALC_COUL_TAB)
+            /* The potential (PME mesh) we need to subtract from 1/r */
+            gmx_mm_pr  vc_sub_SSE0;
+            gmx_mm_pr  vc_sub_SSE2;
+#endif
+#ifdef CALC_ENERGIES
+            /* Electrostatic potential */
+            gmx_mm_pr  vcoul_SSE0;
+            gmx_mm_pr  vcoul_SSE2;
+#endif
+#endif
+            /* The force times 1/r */
+            gmx_mm_pr  fscal_SSE0;
+            gmx_mm_pr  fscal_SSE2;
+
+#ifdef CALC_LJ
+#ifdef LJ_COMB_LB
+            /* LJ sigma_j/2 and sqrt(epsilon_j) */
+            gmx_mm_pr  hsig_j_SSE,seps_j_SSE;
+            /* LJ sigma_ij and epsilon_ij */
+            gmx_mm_pr  sig_SSE0,eps_SSE0;
+#ifndef HALF_LJ
+            gmx_mm_pr  sig_SSE2,eps_SSE2;
+#endif
+#ifdef CALC_ENERGIES
+            gmx_mm_pr  sig2_SSE0,sig6_SSE0;
+#ifndef HALF_LJ
+            gmx_mm_pr  sig2_SSE2,sig6_SSE2;
+#endif
+#endif /* LJ_COMB_LB */
+#endif /* CALC_LJ */
+
+#ifdef LJ_COMB_GEOM
+            gmx_mm_pr  c6s_j_SSE,c12s_j_SSE;
+#endif
+
+#if defined LJ_COMB_GEOM || defined LJ_COMB_LB
+            /* Index for loading LJ parameters, complicated when interleaving */
+            int         aj2;
+#else
+            /* The j-atom type offsets in the LJ parameter matrix */
+            gmx_epi32  nbfp_j_SSE;
+#endif
+
+            /* LJ C6 and C12 parameters, used with geometric comb. rule */
+            gmx_mm_pr  c6_SSE0,c12_SSE0;
+#ifndef HALF_LJ
+            gmx_mm_pr  c6_SSE2,c12_SSE2;
+#endif
+
+            /* Intermediate variables for LJ calculation */
+#ifndef LJ_COMB_LB
+            gmx_mm_pr  rinvsix_SSE0;
+#ifndef HALF_LJ
+            gmx_mm_pr  rinvsix_SSE2;
+#endif
+#endif
+#ifdef LJ_COMB_LB
+            gmx_mm_pr  sir_SSE0,sir2_SSE0,sir6_SSE0;
+#ifndef HALF_LJ
+            gmx_mm_pr  sir_SSE2,sir2_SSE2,sir6_SSE2;
+#endif
+#endif
+
+            gmx_mm_pr  FrLJ6_SSE0,FrLJ12_SSE0;
+#ifndef HALF_LJ
+            gmx_mm_pr  FrLJ6_SSE2,FrLJ12_SSE2;
+#endif
+#ifdef CALC_ENERGIES
+            gmx_mm_pr  VLJ6_SSE0,VLJ12_SSE0,VLJ_SSE0;
+#ifndef HALF_LJ
+            gmx_mm_pr  VLJ6_SSE2,VLJ12_SSE2,VLJ_SSE2;
+#endif
+#endif
+#if defined LJ_FORCE_SWITCH || defined LJ_POT_SWITCH
+            gmx_mm_pr  rlj_SSE0,rsw_SSE0,rsw2_SSE0;
+#ifndef HALF_LJ
+            gmx_mm_pr  rlj_SSE2,rsw_SSE2,rsw2_SSE2;
+#endif
+#endif
+#ifdef LJ_POT_SWITCH
+            gmx_mm_pr  sw_SSE0,dsw_SSE0;
+#ifndef HALF_LJ
+            gmx_mm_pr  sw_SSE2,dsw_SSE2;
+#endif
+#endif
+#endif /* CALC_LJ */
+
+            /* j-cluster index */
+            cj            = l_cj[cjind].cj;
+
+            /* Atom indices (of the first atom in the cluster) */
+            aj            = cj*UNROLLJ;
+#if defined CALC_LJ && (defined LJ_COMB_GEOM || defined LJ_COMB_LB)
+            aj2           = aj*2;
+#endif
+            ajx           = aj*DIM;
+            ajy           = ajx + STRIDE;
+            ajz           = ajy + STRIDE;
+
+#ifdef CHECK_EXCLS
+            /* The interaction mask bits are ordered as i*UNROLLJ+j,
+             * which matches the lanes of register 0 for i-atoms 0,1
+             * and of register 2 for i-atoms 2,3.
+             */
+            int_SSE0      = (gmx_mm_pb)( l_cj[cjind].excl                 & ((1U<<(2*UNROLLJ)) - 1));
+            int_SSE2      = (gmx_mm_pb)((l_cj[cjind].excl >> (2*UNROLLJ)) & ((1U<<(2*UNROLLJ)) - 1));
+#endif
+            /* load j atom coordinates into both halves */
+            jxSSE         = gmx_load_dup_pr(x+ajx);
+            jySSE         = gmx_load_dup_pr(x+ajy);
+            jzSSE         = gmx_load_dup_pr(x+ajz);
+
+            /* Calculate distance */
+            dx_SSE0       = gmx_sub_pr(ix_SSE0,jxSSE);
+            dy_SSE0       = gmx_sub_pr(iy_SSE0,jySSE);
+            dz_SSE0       = gmx_sub_pr(iz_SSE0,jzSSE);
+            dx_SSE2       = gmx_sub_pr(ix_SSE2,jxSSE);
+            dy_SSE2       = gmx_sub_pr(iy_SSE2,jySSE);
+            dz_SSE2       = gmx_sub_pr(iz_SSE2,jzSSE);
+
+            /* rsq = dx*dx+dy*dy+dz*dz */
+            rsq_SSE0      = gmx_calc_rsq_pr(dx_SSE0,dy_SSE0,dz_SSE0);
+            rsq_SSE2      = gmx_calc_rsq_pr(dx_SSE2,dy_SSE2,dz_SSE2);
+
+            wco_SSE0      = gmx_cmplt_pb(rsq_SSE0,rc2_SSE);
+            wco_SSE2      = gmx_cmplt_pb(rsq_SSE2,rc2_SSE);
+
+#ifdef CHECK_EXCLS
+#ifdef EXCL_FORCES
+            /* Only remove the (sub-)diagonal to avoid double counting */
+#if UNROLLJ == UNROLLI
+            if (cj == ci_sh)
+            {
+                wco_SSE0  = wco_SSE0 & diag_SSE0;
+                wco_SSE2  = wco_SSE2 & diag_SSE2;
+            }
+#else
+            if (cj*2 == ci_sh)
+            {
+                wco_SSE0  = wco_SSE0 & diag0_SSE0;
+                wco_SSE2  = wco_SSE2 & diag0_SSE2;
+            }
+            else if (cj*2 + 1 == ci_sh)
+            {
+                wco_SSE0  = wco_SSE0 & diag1_SSE0;
+                wco_SSE2  = wco_SSE2 & diag1_SSE2;
+            }
+#endif
+#else /* EXCL_FORCES */
+            /* Remove all excluded atom pairs from the list */
+            wco_SSE0      = wco_SSE0 & int_SSE0;
+            wco_SSE2      = wco_SSE2 & int_SSE2;
+#endif
+#endif
+
+#ifdef COUNT_PAIRS
+            {
+                int i;
+                for(i=0; i<GMX_X86_SIMD_WIDTH_HERE; i++)
+                {
+                    npair += ((wco_SSE0 >> i) & 1) + ((wco_SSE2 >> i) & 1);
+                }
+            }
+#endif
+
+#ifdef CHECK_EXCLS
+            /* For excluded pairs add a small number to avoid r^-6 = NaN */
+            rsq_SSE0      = gmx_add_pr(rsq_SSE0,gmx_blendnotzero_pr(avoid_sing_SSE,int_SSE0));
+            rsq_SSE2      = gmx_add_pr(rsq_SSE2,gmx_blendnotzero_pr(avoid_sing_SSE,int_SSE2));
+#endif
+
+            /* Calculate 1/r */
+            rinv_SSE0     = gmx_invsqrt_pr(rsq_SSE0);
+            rinv_SSE2     = gmx_invsqrt_pr(rsq_SSE2);
+
+#ifdef CALC_COULOMB
+            /* Load parameters for j atom */
+            jq_SSE        = gmx_load_dup_pr(q+aj);
+            qq_SSE0       = gmx_mul_pr(iq_SSE0,jq_SSE);
+            qq_SSE2       = gmx_mul_pr(iq_SSE2,jq_SSE);
+#endif
+
+#ifdef CALC_LJ
+
+#if !defined LJ_COMB_GEOM && !defined LJ_COMB_LB
+            load_lj_type_j(type,aj,nbfp_j_SSE);
+            load_lj_pair_params(nbfp_ptr,nbfp_i_SSE0,nbfp_j_SSE,c6_SSE0,c12_SSE0);
+#ifndef HALF_LJ
+            load_lj_pair_params(nbfp_ptr,nbfp_i_SSE2,nbfp_j_SSE,c6_SSE2,c12_SSE2);
+#endif
+#endif /* not defined any LJ rule */
+
+#ifdef LJ_COMB_GEOM
+            c6s_j_SSE     = gmx_load_dup_pr(ljc+aj2+0);
+            c12s_j_SSE    = gmx_load_dup_pr(ljc+aj2+STRIDE);
+            c6_SSE0       = gmx_mul_pr(c6s_SSE0 ,c6s_j_SSE );
+#ifndef HALF_LJ
+            c6_SSE2       = gmx_mul_pr(c6s_SSE2 ,c6s_j_SSE );
+#endif
+            c12_SSE0      = gmx_mul_pr(c12s_SSE0,c12s_j_SSE);
+#ifndef HALF_LJ
+            c12_SSE2      = gmx_mul_pr(c12s_SSE2,c12s_j_SSE);
+#endif
+#endif /* LJ_COMB_GEOM */
+
+#ifdef LJ_COMB_LB
+            hsig_j_SSE    = gmx_load_dup_pr(ljc+aj2+0);
+            seps_j_SSE    = gmx_load_dup_pr(ljc+aj2+STRIDE);
+
+            sig_SSE0      = gmx_add_pr(hsig_i_SSE0,hsig_j_SSE);
+            eps_SSE0      = gmx_mul_pr(seps_i_SSE0,seps_j_SSE);
+#ifndef HALF_LJ
+            sig_SSE2      = gmx_add_pr(hsig_i_SSE2,hsig_j_SSE);
+            eps_SSE2      = gmx_mul_pr(seps_i_SSE2,seps_j_SSE);
+#endif
+#endif /* LJ_COMB_LB */
+
+#endif /* CALC_LJ */
+
+            rinv_SSE0     = gmx_blendzero_pr(rinv_SSE0,wco_SSE0);
+            rinv_SSE2     = gmx_blendzero_pr(rinv_SSE2,wco_SSE2);
+
+            rinvsq_SSE0   = gmx_mul_pr(rinv_SSE0,rinv_SSE0);
+            rinvsq_SSE2   = gmx_mul_pr(rinv_SSE2,rinv_SSE2);
+
+#ifdef CALC_COULOMB
+            /* Note that here we calculate force*r, not the usual force/r.
+             * This allows avoiding masking the reaction-field contribution,
+             * as frcoul is later multiplied by rinvsq which has been
+             * masked with the cut-off check.
+             */
+
+#ifdef EXCL_FORCES
+            /* Only add 1/r for non-excluded atom pairs */
+            rinv_ex_SSE0  = gmx_blendzero_pr(rinv_SSE0,int_SSE0);
+            rinv_ex_SSE2  = gmx_blendzero_pr(rinv_SSE2,int_SSE2);
+#else
+            /* No exclusion forces, we always need 1/r */
+#define     rinv_ex_SSE0    rinv_SSE0
+#define     rinv_ex_SSE2    rinv_SSE2
+#endif
+
+#ifdef CALC_COUL_RF
+            /* Electrostatic interactions */
+            frcoul_SSE0   = gmx_mul_pr(qq_SSE0,gmx_add_pr(rinv_ex_SSE0,gmx_mul_pr(rsq_SSE0,mrc_3_SSE)));
+            frcoul_SSE2   = gmx_mul_pr(qq_SSE2,gmx_add_pr(rinv_ex_SSE2,gmx_mul_pr(rsq_SSE2,mrc_3_SSE)));
+
+#ifdef CALC_ENERGIES
+            vcoul_SSE0    = gmx_mul_pr(qq_SSE0,gmx_add_pr(rinv_ex_SSE0,gmx_add_pr(gmx_mul_pr(rsq_SSE0,hrc_3_SSE),moh_rc_SSE)));
+            vcoul_SSE2    = gmx_mul_pr(qq_SSE2,gmx_add_pr(rinv_ex_SSE2,gmx_add_pr(gmx_mul_pr(rsq_SSE2,hrc_3_SSE),moh_rc_SSE)));
+#endif
+#endif
+
+#ifdef CALC_COUL_EWALD
+            /* We need to mask (or limit) rsq for the cut-off,
+             * as large distances can cause an overflow in gmx_pmecorrF/V.
+             */
+            brsq_SSE0     = gmx_mul_pr(beta2_SSE,gmx_blendzero_pr(rsq_SSE0,wco_SSE0));
+            brsq_SSE2     = gmx_mul_pr(beta2_SSE,gmx_blendzero_pr(rsq_SSE2,wco_SSE2));
+            ewcorr_SSE0   = gmx_mul_pr(gmx_pmecorrF_pr(brsq_SSE0),beta_SSE);
+            ewcorr_SSE2   = gmx_mul_pr(gmx_pmecorrF_pr(brsq_SSE2),beta_SSE);
+            frcoul_SSE0   = gmx_mul_pr(qq_SSE0,gmx_add_pr(rinv_ex_SSE0,gmx_mul_pr(ewcorr_SSE0,brsq_SSE0)));
+            frcoul_SSE2   = gmx_mul_pr(qq_SSE2,gmx_add_pr(rinv_ex_SSE2,gmx_mul_pr(ewcorr_SSE2,brsq_SSE2)));
+
+#ifdef CALC_ENERGIES
+            vc_sub_SSE0   = gmx_mul_pr(gmx_pmecorrV_pr(brsq_SSE0),beta_SSE);
+            vc_sub_SSE2   = gmx_mul_pr(gmx_pmecorrV_pr(brsq_SSE2),beta_SSE);
+#endif
+
+#endif /* CALC_COUL_EWALD */
+
+#ifdef CALC_COUL_TAB
+            /* Electrostatic interactions */
+            r_SSE0        = gmx_mul_pr(rsq_SSE0,rinv_SSE0);
+            r_SSE2        = gmx_mul_pr(rsq_SSE2,rinv_SSE2);
+            /* Convert r to scaled table units */
+            rs_SSE0       = gmx_mul_pr(r_SSE0,invtsp_SSE);
+            rs_SSE2       = gmx_mul_pr(r_SSE2,invtsp_SSE);
+            /* Truncate scaled r to an int */
+            ti_SSE0       = gmx_cvttpr_epi32(rs_SSE0);
+            ti_SSE2       = gmx_cvttpr_epi32(rs_SSE2);
+            rf_SSE0       = gmx_floor_pr(rs_SSE0);
+            rf_SSE2       = gmx_floor_pr(rs_SSE2);
+            frac_SSE0     = gmx_sub_pr(rs_SSE0,rf_SSE0);
+            frac_SSE2     = gmx_sub_pr(rs_SSE2,rf_SSE2);
+
+            /* Load and interpolate table forces and possibly energies.
+             * Force and energy can be combined in one table, stride 4: FDV0
+             * or in two separate tables with stride 1: F and V
+             * Currently single precision uses FDV0, double F and V.
+             */
+#ifndef CALC_ENERGIES
+            load_table_f(tab_coul_F,ti_SSE0,ctab0_SSE0,ctab1_SSE0);
+            load_table_f(tab_coul_F,ti_SSE2,ctab0_SSE2,ctab1_SSE2);
+#else
+#ifdef TAB_FDV0
+            load_table_f_v(tab_coul_F,ti_SSE0,ctab0_SSE0,ctab1_SSE0,ctabv_SSE0);
+            load_table_f_v(tab_coul_F,ti_SSE2,ctab0_SSE2,ctab1_SSE2,ctabv_SSE2);
+#else
+            load_table_f_v(tab_coul_F,tab_coul_V,ti_SSE0,ctab0_SSE0,ctab1_SSE0,ctabv_SSE0);
+            load_table_f_v(tab_coul_F,tab_coul_V,ti_SSE2,ctab0_SSE2,ctab1_SSE2,ctabv_SSE2);
+#endif
+#endif
+            fsub_SSE0     = gmx_add_pr(ctab0_SSE0,gmx_mul_pr(frac_SSE0,ctab1_SSE0));
+            fsub_SSE2     = gmx_add_pr(ctab0_SSE2,gmx_mul_pr(frac_SSE2,ctab1_SSE2));
+            frcoul_SSE0   = gmx_mul_pr(qq_SSE0,gmx_sub_pr(rinv_ex_SSE0,gmx_mul_pr(fsub_SSE0,r_SSE0)));
+            frcoul_SSE2   = gmx_mul_pr(qq_SSE2,gmx_sub_pr(rinv_ex_SSE2,gmx_mul_pr(fsub_SSE2,r_SSE2)));
+
+#ifdef CALC_ENERGIES
+            vc_sub_SSE0   = gmx_add_pr(ctabv_SSE0,gmx_mul_pr(gmx_mul_pr(mhalfsp_SSE,frac_SSE0),gmx_add_pr(ctab0_SSE0,fsub_SSE0)));
+            vc_sub_SSE2   = gmx_add_pr(ctabv_SSE2,gmx_mul_pr(gmx_mul_pr(mhalfsp_SSE,frac_SSE2),gmx_add_pr(ctab0_SSE2,fsub_SSE2)));
+#endif
+#endif /* CALC_COUL_TAB */
+
+#if defined CALC_ENERGIES && (defined CALC_COUL_EWALD || defined CALC_COUL_TAB)
+#ifndef NO_SHIFT_EWALD
+            /* Add Ewald potential shift to vc_sub for convenience */
+#ifdef CHECK_EXCLS
+            vc_sub_SSE0   = gmx_add_pr(vc_sub_SSE0,gmx_blendzero_pr(sh_ewald_SSE,int_SSE0));
+            vc_sub_SSE2   = gmx_add_pr(vc_sub_SSE2,gmx_blendzero_pr(sh_ewald_SSE,int_SSE2));
+#else
+            vc_sub_SSE0   = gmx_add_pr(vc_sub_SSE0,sh_ewald_SSE);
+            vc_sub_SSE2   = gmx_add_pr(vc_sub_SSE2,sh_ewald_SSE);
+#endif
+#endif
+
+            vcoul_SSE0    = gmx_mul_pr(qq_SSE0,gmx_sub_pr(rinv_ex_SSE0,vc_sub_SSE0));
+            vcoul_SSE2    = gmx_mul_pr(qq_SSE2,gmx_sub_pr(rinv_ex_SSE2,vc_sub_SSE2));
+
+#endif
+
+#ifdef CALC_ENERGIES
+            /* Mask energy for cut-off and diagonal */
+            vcoul_SSE0    = gmx_blendzero_pr(vcoul_SSE0,wco_SSE0);
+            vcoul_SSE2    = gmx_blendzero_pr(vcoul_SSE2,wco_SSE2);
+#endif
+
+#endif /* CALC_COULOMB */
+
+#ifdef CALC_LJ
+            /* Lennard-Jones interaction */
+
+#ifdef VDW_CUTOFF_CHECK
+            wco_vdw_SSE0  = gmx_cmplt_pb(rsq_SSE0,rcvdw2_SSE);
+#ifndef HALF_LJ
+            wco_vdw_SSE2  = gmx_cmplt_pb(rsq_SSE2,rcvdw2_SSE);
+#endif
+#else
+            /* Same cut-off for Coulomb and VdW, reuse the registers */
+#define     wco_vdw_SSE0    wco_SSE0
+#define     wco_vdw_SSE2    wco_SSE2
+#endif
+
+#ifndef LJ_COMB_LB
+            rinvsix_SSE0  = gmx_mul_pr(rinvsq_SSE0,gmx_mul_pr(rinvsq_SSE0,rinvsq_SSE0));
+#ifdef EXCL_FORCES
+            rinvsix_SSE0  = gmx_blendzero_pr(rinvsix_SSE0,int_SSE0);
+#endif
+#ifndef HALF_LJ
+            rinvsix_SSE2  = gmx_mul_pr(rinvsq_SSE2,gmx_mul_pr(rinvsq_SSE2,rinvsq_SSE2));
+#ifdef EXCL_FORCES
+            rinvsix_SSE2  = gmx_blendzero_pr(rinvsix_SSE2,int_SSE2);
+#endif
+#endif
+#ifdef VDW_CUTOFF_CHECK
+            rinvsix_SSE0  = gmx_blendzero_pr(rinvsix_SSE0,wco_vdw_SSE0);
+#ifndef HALF_LJ
+            rinvsix_SSE2  = gmx_blendzero_pr(rinvsix_SSE2,wco_vdw_SSE2);
+#endif
+#endif
+            FrLJ6_SSE0    = gmx_mul_pr(c6_SSE0,rinvsix_SSE0);
+#ifndef HALF_LJ
+            FrLJ6_SSE2    = gmx_mul_pr(c6_SSE2,rinvsix_SSE2);
+#endif
+            FrLJ12_SSE0   = gmx_mul_pr(c12_SSE0,gmx_mul_pr(rinvsix_SSE0,rinvsix_SSE0));
+#ifndef HALF_LJ
+            FrLJ12_SSE2   = gmx_mul_pr(c12_SSE2,gmx_mul_pr(rinvsix_SSE2,rinvsix_SSE2));
+#endif
+#endif /* not LJ_COMB_LB */
+
+#ifdef LJ_COMB_LB
+            sir_SSE0      = gmx_mul_pr(sig_SSE0,rinv_SSE0);
+#ifndef HALF_LJ
+            sir_SSE2      = gmx_mul_pr(sig_SSE2,rinv_SSE2);
+#endif
+            sir2_SSE0     = gmx_mul_pr(sir_SSE0,sir_SSE0);
+#ifndef HALF_LJ
+            sir2_SSE2     = gmx_mul_pr(sir_SSE2,sir_SSE2);
+#endif
+            sir6_SSE0     = gmx_mul_pr(sir2_SSE0,gmx_mul_pr(sir2_SSE0,sir2_SSE0));
+#ifdef EXCL_FORCES
+            sir6_SSE0     = gmx_blendzero_pr(sir6_SSE0,int_SSE0);
+#endif
+#ifndef HALF_LJ
+            sir6_SSE2     = gmx_mul_pr(sir2_SSE2,gmx_mul_pr(sir2_SSE2,sir2_SSE2));
+#ifdef EXCL_FORCES
+            sir6_SSE2     = gmx_blendzero_pr(sir6_SSE2,int_SSE2);
+#endif
+#endif
+#ifdef VDW_CUTOFF_CHECK
+            sir6_SSE0     = gmx_blendzero_pr(sir6_SSE0,wco_vdw_SSE0);
+#ifndef HALF_LJ
+            sir6_SSE2     = gmx_blendzero_pr(sir6_SSE2,wco_vdw_SSE2);
+#endif
+#endif
+            FrLJ6_SSE0    = gmx_mul_pr(eps_SSE0,sir6_SSE0);
+#ifndef HALF_LJ
+            FrLJ6_SSE2    = gmx_mul_pr(eps_SSE2,sir6_SSE2);
+#endif
+            FrLJ12_SSE0   = gmx_mul_pr(FrLJ6_SSE0,sir6_SSE0);
+#ifndef HALF_LJ
+            FrLJ12_SSE2   = gmx_mul_pr(FrLJ6_SSE2,sir6_SSE2);
+#endif
+#if defined CALC_ENERGIES
+            /* We need C6 and C12 to calculate the LJ potential shift */
+            sig2_SSE0     = gmx_mul_pr(sig_SSE0,sig_SSE0);
+#ifndef HALF_LJ
+            sig2_SSE2     = gmx_mul_pr(sig_SSE2,sig_SSE2);
+#endif
+            sig6_SSE0     = gmx_mul_pr(sig2_SSE0,gmx_mul_pr(sig2_SSE0,sig2_SSE0));
+#ifndef HALF_LJ
+            sig6_SSE2     = gmx_mul_pr(sig2_SSE2,gmx_mul_pr(sig2_SSE2,sig2_SSE2));
+#endif
+            c6_SSE0       = gmx_mul_pr(eps_SSE0,sig6_SSE0);
+#ifndef HALF_LJ
+            c6_SSE2       = gmx_mul_pr(eps_SSE2,sig6_SSE2);
+#endif
+            c12_SSE0      = gmx_mul_pr(c6_SSE0,sig6_SSE0);
+#ifndef HALF_LJ
+            c12_SSE2      = gmx_mul_pr(c6_SSE2,sig6_SSE2);
+#endif
+#endif
+#endif /* LJ_COMB_LB */
+
+#if defined LJ_FORCE_SWITCH || defined LJ_POT_SWITCH
+            /* The distance beyond the switch radius, rinv is zero beyond
+             * the cut-off, we also need to mask the twin-range and excluded
+             * pairs, so the switch terms are zero for those.
+             */
+            rlj_SSE0    = gmx_mul_pr(rsq_SSE0,rinv_SSE0);
+#ifndef HALF_LJ
+            rlj_SSE2    = gmx_mul_pr(rsq_SSE2,rinv_SSE2);
+#endif
+            rsw_SSE0    = gmx_max_pr(gmx_sub_pr(rlj_SSE0,rswitch_SSE),gmx_setzero_pr());
+#ifndef HALF_LJ
+            rsw_SSE2    = gmx_max_pr(gmx_sub_pr(rlj_SSE2,rswitch_SSE),gmx_setzero_pr());
+#endif
+#ifdef EXCL_FORCES
+            rsw_SSE0    = gmx_blendzero_pr(rsw_SSE0,int_SSE0);
+#ifndef HALF_LJ
+            rsw_SSE2    = gmx_blendzero_pr(rsw_SSE2,int_SSE2);
+#endif
+#endif
+#ifdef VDW_CUTOFF_CHECK
+            rsw_SSE0    = gmx_blendzero_pr(rsw_SSE0,wco_vdw_SSE0);
+#ifndef HALF_LJ
+            rsw_SSE2    = gmx_blendzero_pr(rsw_SSE2,wco_vdw_SSE2);
+#endif
+#endif
+            rsw2_SSE0   = gmx_mul_pr(rsw_SSE0,rsw_SSE0);
+#ifndef HALF_LJ
+            rsw2_SSE2   = gmx_mul_pr(rsw_SSE2,rsw_SSE2);
+#endif
+#endif
+#ifdef LJ_POT_SWITCH
+            sw_SSE0     = gmx_add_pr(one_SSE,gmx_mul_pr(gmx_mul_pr(rsw2_SSE0,rsw_SSE0),gmx_add_pr(swV3_SSE,gmx_mul_pr(rsw_SSE0,gmx_add_pr(swV4_SSE,gmx_mul_pr(rsw_SSE0,swV5_SSE))))));
+#ifndef HALF_LJ
+            sw_SSE2     = gmx_add_pr(one_SSE,gmx_mul_pr(gmx_mul_pr(rsw2_SSE2,rsw_SSE2),gmx_add_pr(swV3_SSE,gmx_mul_pr(rsw_SSE2,gmx_add_pr(swV4_SSE,gmx_mul_pr(rsw_SSE2,swV5_SSE))))));
+#endif
+            dsw_SSE0    = gmx_mul_pr(rsw2_SSE0,gmx_add_pr(swF2_SSE,gmx_mul_pr(rsw_SSE0,gmx_add_pr(swF3_SSE,gmx_mul_pr(rsw_SSE0,swF4_SSE)))));
+#ifndef HALF_LJ
+            dsw_SSE2    = gmx_mul_pr(rsw2_SSE2,gmx_add_pr(swF2_SSE,gmx_mul_pr(rsw_SSE2,gmx_add_pr(swF3_SSE,gmx_mul_pr(rsw_SSE2,swF4_SSE)))));
+#endif
+#endif
+
+#endif /* CALC_LJ */
+
+#ifdef CALC_ENERGIES
+#ifdef ENERGY_GROUPS
+            /* Extract the group pair index per j pair.
+             * Energy groups are stored per i-cluster, so things get
+             * complicated when the i- and j-cluster size don't match.
+             */
+            {
+                int egps_j;
+                /* We assume UNROLLI <= UNROLLJ */
+                int jdi;
+                for(jdi=0; jdi<UNROLLJ/UNROLLI; jdi++)
+                {
+                    int jj;
+                    egps_j = nbat->energrp[cj*(UNROLLJ/UNROLLI)+jdi];
+                    for(jj=0; jj<(UNROLLI/2); jj++)
+                    {
+                        egp_jj[jdi*(UNROLLI/2)+jj] = ((egps_j >> (jj*egps_jshift)) & egps_jmask)*egps_jstride;
+                    }
+                }
+            }
+#endif
+
+#ifdef CALC_COULOMB
+#ifndef ENERGY_GROUPS
+            vctotSSE      = gmx_add_pr(vctotSSE, gmx_add_pr(vcoul_SSE0,vcoul_SSE2));
+#else
+            add_ener_grp_halves(vcoul_SSE0,vctp[0],vctp[1],egp_jj);
+            add_ener_grp_halves(vcoul_SSE2,vctp[2],vctp[3],egp_jj);
+#endif
+#endif
+
+#ifdef CALC_LJ
+            /* Calculate the LJ energies */
+            VLJ6_SSE0     = gmx_mul_pr(sixthSSE,gmx_sub_pr(FrLJ6_SSE0,gmx_mul_pr(c6_SSE0,sh_invrc6_SSE)));
+#ifndef HALF_LJ
+            VLJ6_SSE2     = gmx_mul_pr(sixthSSE,gmx_sub_pr(FrLJ6_SSE2,gmx_mul_pr(c6_SSE2,sh_invrc6_SSE)));
+#endif
+            VLJ12_SSE0    = gmx_mul_pr(twelvethSSE,gmx_sub_pr(FrLJ12_SSE0,gmx_mul_pr(c12_SSE0,sh_invrc12_SSE)));
+#ifndef HALF_LJ
+            VLJ12_SSE2    = gmx_mul_pr(twelvethSSE,gmx_sub_pr(FrLJ12_SSE2,gmx_mul_pr(c12_SSE2,sh_invrc12_SSE)));
+#endif
+
+#ifdef LJ_FORCE_SWITCH
+            /* Add the terms for the force switch beyond rvdw_switch */
+            VLJ6_SSE0   = gmx_add_pr(VLJ6_SSE0,gmx_mul_pr(c6_SSE0,gmx_mul_pr(gmx_add_pr(p6_vc3_SSE,gmx_mul_pr(p6_vc4_SSE,rsw_SSE0)),gmx_mul_pr(rsw2_SSE0,rsw_SSE0))));
+#ifndef HALF_LJ
+            VLJ6_SSE2   = gmx_add_pr(VLJ6_SSE2,gmx_mul_pr(c6_SSE2,gmx_mul_pr(gmx_add_pr(p6_vc3_SSE,gmx_mul_pr(p6_vc4_SSE,rsw_SSE2)),gmx_mul_pr(rsw2_SSE2,rsw_SSE2))));
+#endif
+            VLJ12_SSE0  = gmx_add_pr(VLJ12_SSE0,gmx_mul_pr(c12_SSE0,gmx_mul_pr(gmx_add_pr(p12_vc3_SSE,gmx_mul_pr(p12_vc4_SSE,rsw_SSE0)),gmx_mul_pr(rsw2_SSE0,rsw_SSE0))));
+#ifndef HALF_LJ
+            VLJ12_SSE2  = gmx_add_pr(VLJ12_SSE2,gmx_mul_pr(c12_SSE2,gmx_mul_pr(gmx_add_pr(p12_vc3_SSE,gmx_mul_pr(p12_vc4_SSE,rsw_SSE2)),gmx_mul_pr(rsw2_SSE2,rsw_SSE2))));
+#endif
+#endif
+
+            VLJ_SSE0      = gmx_sub_pr(VLJ12_SSE0,VLJ6_SSE0);
+#ifndef HALF_LJ
+            VLJ_SSE2      = gmx_sub_pr(VLJ12_SSE2,VLJ6_SSE2);
+#endif
+#ifdef LJ_POT_SWITCH
+            VLJ_SSE0    = gmx_mul_pr(VLJ_SSE0,sw_SSE0);
+#ifndef HALF_LJ
+            VLJ_SSE2    = gmx_mul_pr(VLJ_SSE2,sw_SSE2);
+#endif
+#endif
+            /* The potential shift should be removed for pairs beyond cut-off */
+            VLJ_SSE0      = gmx_blendzero_pr(VLJ_SSE0,wco_vdw_SSE0);
+#ifndef HALF_LJ
+            VLJ_SSE2      = gmx_blendzero_pr(VLJ_SSE2,wco_vdw_SSE2);
+#endif
+#ifdef CHECK_EXCLS
+            /* The potential shift should be removed for excluded pairs */
+            VLJ_SSE0      = gmx_blendzero_pr(VLJ_SSE0,int_SSE0);
+#ifndef HALF_LJ
+            VLJ_SSE2      = gmx_blendzero_pr(VLJ_SSE2,int_SSE2);
+#endif
+#endif
+#ifndef ENERGY_GROUPS
+            VvdwtotSSE    = gmx_add_pr(VvdwtotSSE,
+#ifndef HALF_LJ
+                                       gmx_add_pr(VLJ_SSE0,VLJ_SSE2)
+#else
+                                       VLJ_SSE0
+#endif
+                                      );
+#else
+            add_ener_grp_halves(VLJ_SSE0,vvdwtp[0],vvdwtp[1],egp_jj);
+#ifndef HALF_LJ
+            add_ener_grp_halves(VLJ_SSE2,vvdwtp[2],vvdwtp[3],egp_jj);
+#endif
+#endif
+#endif /* CALC_LJ */
+#endif /* CALC_ENERGIES */
+
+#if defined CALC_LJ && defined LJ_FORCE_SWITCH
+            /* Add the force switch terms, the force is computed as F*r */
+            FrLJ6_SSE0  = gmx_add_pr(FrLJ6_SSE0,gmx_mul_pr(c6_SSE0,gmx_mul_pr(gmx_add_pr(p6_fc2_SSE,gmx_mul_pr(p6_fc3_SSE,rsw_SSE0)),gmx_mul_pr(rsw2_SSE0,rlj_SSE0))));
+#ifndef HALF_LJ
+            FrLJ6_SSE2  = gmx_add_pr(FrLJ6_SSE2,gmx_mul_pr(c6_SSE2,gmx_mul_pr(gmx_add_pr(p6_fc2_SSE,gmx_mul_pr(p6_fc3_SSE,rsw_SSE2)),gmx_mul_pr(rsw2_SSE2,rlj_SSE2))));
+#endif
+            FrLJ12_SSE0 = gmx_add_pr(FrLJ12_SSE0,gmx_mul_pr(c12_SSE0,gmx_mul_pr(gmx_add_pr(p12_fc2_SSE,gmx_mul_pr(p12_fc3_SSE,rsw_SSE0)),gmx_mul_pr(rsw2_SSE0,rlj_SSE0))));
+#ifndef HALF_LJ
+            FrLJ12_SSE2 = gmx_add_pr(FrLJ12_SSE2,gmx_mul_pr(c12_SSE2,gmx_mul_pr(gmx_add_pr(p12_fc2_SSE,gmx_mul_pr(p12_fc3_SSE,rsw_SSE2)),gmx_mul_pr(rsw2_SSE2,rlj_SSE2))));
+#endif
+#endif
+
+#if defined CALC_LJ && defined LJ_POT_SWITCH
+            /* F*r = F*r*sw - V*dsw*r, with V = FrLJ12/12 - FrLJ6/6 */
+            dsw_SSE0    = gmx_mul_pr(dsw_SSE0,rlj_SSE0);
+#ifndef HALF_LJ
+            dsw_SSE2    = gmx_mul_pr(dsw_SSE2,rlj_SSE2);
+#endif
+            FrLJ6_SSE0  = gmx_mul_pr(FrLJ6_SSE0,gmx_sub_pr(sw_SSE0,gmx_mul_pr(dsw_SSE0,sixthSSE)));
+#ifndef HALF_LJ
+            FrLJ6_SSE2  = gmx_mul_pr(FrLJ6_SSE2,gmx_sub_pr(sw_SSE2,gmx_mul_pr(dsw_SSE2,sixthSSE)));
+#endif
+            FrLJ12_SSE0 = gmx_mul_pr(FrLJ12_SSE0,gmx_sub_pr(sw_SSE0,gmx_mul_pr(dsw_SSE0,twelvethSSE)));
+#ifndef HALF_LJ
+            FrLJ12_SSE2 = gmx_mul_pr(FrLJ12_SSE2,gmx_sub_pr(sw_SSE2,gmx_mul_pr(dsw_SSE2,twelvethSSE)));
+#endif
+#endif
+
+#ifdef CALC_LJ
+            fscal_SSE0    = gmx_mul_pr(rinvsq_SSE0,
+#ifdef CALC_COULOMB
+                                                   gmx_add_pr(frcoul_SSE0,
+#else
+                                                   (
+#endif
+                                                    gmx_sub_pr(FrLJ12_SSE0,FrLJ6_SSE0)));
+#else
+            fscal_SSE0    = gmx_mul_pr(rinvsq_SSE0,frcoul_SSE0);
+#endif /* CALC_LJ */
+#if defined CALC_LJ && !defined HALF_LJ
+            fscal_SSE2    = gmx_mul_pr(rinvsq_SSE2,
+#ifdef CALC_COULOMB
+                                                   gmx_add_pr(frcoul_SSE2,
+#else
+                                                   (
+#endif
+                                                    gmx_sub_pr(FrLJ12_SSE2,FrLJ6_SSE2)));
+#else
+            /* Atom 2 and 3 don't have LJ, so only add Coulomb forces */
+            fscal_SSE2    = gmx_mul_pr(rinvsq_SSE2,frcoul_SSE2);
+#endif
+
+            /* Calculate temporary vectorial force */
+            tx_SSE0       = gmx_mul_pr(fscal_SSE0,dx_SSE0);
+            tx_SSE2       = gmx_mul_pr(fscal_SSE2,dx_SSE2);
+            ty_SSE0       = gmx_mul_pr(fscal_SSE0,dy_SSE0);
+            ty_SSE2       = gmx_mul_pr(fscal_SSE2,dy_SSE2);
+            tz_SSE0       = gmx_mul_pr(fscal_SSE0,dz_SSE0);
+            tz_SSE2       = gmx_mul_pr(fscal_SSE2,dz_SSE2);
+
+            /* Increment i atom force */
+            fix_SSE0      = gmx_add_pr(fix_SSE0,tx_SSE0);
+            fix_SSE2      = gmx_add_pr(fix_SSE2,tx_SSE2);
+            fiy_SSE0      = gmx_add_pr(fiy_SSE0,ty_SSE0);
+            fiy_SSE2      = gmx_add_pr(fiy_SSE2,ty_SSE2);
+            fiz_SSE0      = gmx_add_pr(fiz_SSE0,tz_SSE0);
+            fiz_SSE2      = gmx_add_pr(fiz_SSE2,tz_SSE2);
+
+            /* Decrement j atom force, summing the contributions
+             * of the two i-atom halves.
+             */
+            gmx_store_hpr(f+ajx,
+                          gmx_sub_hpr( gmx_load_hpr(f+ajx), gmx_sum_halves_pr(gmx_add_pr(tx_SSE0,tx_SSE2)) ));
+            gmx_store_hpr(f+ajy,
+                          gmx_sub_hpr( gmx_load_hpr(f+ajy), gmx_sum_halves_pr(gmx_add_pr(ty_SSE0,ty_SSE2)) ));
+            gmx_store_hpr(f+ajz,
+                          gmx_sub_hpr( gmx_load_hpr(f+ajz), gmx_sum_halves_pr(gmx_add_pr(tz_SSE0,tz_SSE2)) ));
+        }
+
+#undef  rinv_ex_SSE0
+#undef  rinv_ex_SSE2
+
+#undef  wco_vdw_SSE0
+#undef  wco_vdw_SSE2
+
+#undef  EXCL_FORCES
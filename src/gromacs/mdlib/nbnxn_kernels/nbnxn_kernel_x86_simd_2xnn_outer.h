@@ -0,0 +1,657 @@
+/* -*- mode: c; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4; c-file-style: "stroustrup"; -*-
+ *
+ *
+ *                This source code is part of
+ *
+ *                 G   R   O   M   A   C   S
+ *
+ * Copyright (c) 1991-2000, University of Groningen, The Netherlands.
+ * Copyright (c) 2001-2009, The GROMACS Development Team
+ *
+ * Gromacs is a library for molecular simulation and trajectory analysis,
+ * written by Erik Lindahl, David van der Spoel, Berk Hess, and others - for
+ * a full list of developers and information, check out http://www.gromacs.org
+ *
+ * This program is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation; either version 2 of the License, or (at your option) any
+ * later version.
+ * As a special exception, you may use this file as part of a free software
+ * library without restriction.  Specifically, if other files instantiate
+ * templates or use macros or inline functions from this file, or you compile
+ * this file and link it with other files to produce an executable, this
+ * file does not by itself cause the resulting executable to be covered by
+ * the GNU Lesser General Public License.
+ *
+ * In plain-speak: do not worry about classes/macros/templates either - only
+ * changes to the library have to be LGPL, not an application linking with it.
+ *
+ * To help fund GROMACS development, we humbly ask that you cite
+ * the papers people have written on it - you can find them on the website!
+ */
+
+/* GMX_MM512_HERE should be set before including this file */
+#include "gmx_x86_simd_macros.h"
+
+/* The 2x(N+N) layout: each register holds two i-atoms times UNROLLJ j-atoms.
+ * Register 0 holds i-atoms 0 and 1, register 2 i-atoms 2 and 3.
+ */
+#define UNROLLI    NBNXN_CPU_CLUSTER_I_SIZE
+#define UNROLLJ    (GMX_X86_SIMD_WIDTH_HERE/2)
+
+#ifndef GMX_DOUBLE
+/* AVX-512 single precision 2x(8+8) kernel */
+#define STRIDE     8
+#define SUM_SIMD(x) (x[0]+x[1]+x[2]+x[3]+x[4]+x[5]+x[6]+x[7])
+#define TAB_FDV0
+#else
+/* AVX-512 double precision 2x(4+4) kernel */
+#define STRIDE     4
+#define SUM_SIMD(x) (x[0]+x[1]+x[2]+x[3])
+#endif
+
+#define SUM_SIMD4(x) (x[0]+x[1]+x[2]+x[3])
+
+#define SIMD_MASK_ALL   0xffffffff
+
+#include "nbnxn_kernel_x86_simd_2xnn_utils.h"
+
+/* All functionality defines are set here, except for:
+ * CALC_ENERGIES, ENERGY_GROUPS which are defined before.
+ * CHECK_EXCLS, which is set just before including the inner loop contents.
+ * The combination rule defines, LJ_COMB_GEOM or LJ_COMB_LB are currently
+ * set before calling the kernel function. We might want to move that
+ * to inside the n-loop and have a different combination rule for different
+ * ci's, as no combination rule gives a 50% performance hit for LJ.
+ */
+
+/* We always calculate shift forces, because it's cheap anyhow */
+#define CALC_SHIFTFORCES
+
+#define NBK_FUNC_NAME_C_LJC(b,s,c,ljc,e) b##_##s##_##c##_comb_##ljc##_##e
+#define NBK_FUNC_NAME_C_LJT(b,s,c,ljt,e) b##_##s##_##c##_##ljt##_##e
+
+#if defined LJ_COMB_GEOM
+#define NBK_FUNC_NAME_C(b,s,c,e) NBK_FUNC_NAME_C_LJC(b,s,c,geom,e)
+#else
+#if defined LJ_COMB_LB
+#define NBK_FUNC_NAME_C(b,s,c,e) NBK_FUNC_NAME_C_LJC(b,s,c,lb,e)
+#else
+#if defined LJ_FORCE_SWITCH
+/* The switched LJ kernels always use the full parameter matrix */
+#define NBK_FUNC_NAME_C(b,s,c,e) NBK_FUNC_NAME_C_LJT(b,s,c,lj_fsw,e)
+#else
+#if defined LJ_POT_SWITCH
+#define NBK_FUNC_NAME_C(b,s,c,e) NBK_FUNC_NAME_C_LJT(b,s,c,lj_psw,e)
+#else
+#define NBK_FUNC_NAME_C(b,s,c,e) NBK_FUNC_NAME_C_LJC(b,s,c,none,e)
+#endif
+#endif
+#endif
+#endif
+
+#ifdef CALC_COUL_RF
+#ifndef VDW_CUTOFF_CHECK
+#define NBK_FUNC_NAME(b,s,e) NBK_FUNC_NAME_C(b,s,rf,e)
+#else
+#define NBK_FUNC_NAME(b,s,e) NBK_FUNC_NAME_C(b,s,rf_twin,e)
+#endif
+#endif
+#ifdef CALC_COUL_TAB
+#ifndef VDW_CUTOFF_CHECK
+#define NBK_FUNC_NAME(b,s,e) NBK_FUNC_NAME_C(b,s,tab,e)
+#else
+#define NBK_FUNC_NAME(b,s,e) NBK_FUNC_NAME_C(b,s,tab_twin,e)
+#endif
+#endif
+#ifdef CALC_COUL_EWALD
+#ifndef VDW_CUTOFF_CHECK
+#define NBK_FUNC_NAME(b,s,e) NBK_FUNC_NAME_C(b,s,ewald,e)
+#else
+#define NBK_FUNC_NAME(b,s,e) NBK_FUNC_NAME_C(b,s,ewald_twin,e)
+#endif
+#endif
+
+static void
+#ifndef CALC_ENERGIES
+NBK_FUNC_NAME(nbnxn_kernel,x86_simd512,noener)
+#else
+#ifndef ENERGY_GROUPS
+NBK_FUNC_NAME(nbnxn_kernel,x86_simd512,ener)
+#else
+NBK_FUNC_NAME(nbnxn_kernel,x86_simd512,energrp)
+#endif
+#endif
+#undef NBK_FUNC_NAME
+#undef NBK_FUNC_NAME_C
+#undef NBK_FUNC_NAME_C_LJC
+#undef NBK_FUNC_NAME_C_LJT
+                            (const nbnxn_pairlist_t     *nbl,
+                             const nbnxn_atomdata_t     *nbat,
+                             const interaction_const_t  *ic,
+                             rvec                       *shift_vec,
+                             real                       *f
+#ifdef CALC_SHIFTFORCES
+                             ,
+                             real                       *fshift
+#endif
+#ifdef CALC_ENERGIES
+                             ,
+                             real                       *Vvdw,
+                             real                       *Vc
+#endif
+                            )
+{
+    const nbnxn_ci_t   *nbln;
+    const nbnxn_cj_t   *l_cj;
+    const int          *type;
+    const real         *q;
+    const real         *shiftvec;
+    const real         *x;
+    real       facel;
+    real       *nbfp_ptr;
+    int        nbfp_stride;
+    int        n,ci,ci_sh;
+    int        ish,ish3;
+    gmx_bool   half_LJ,do_coul;
+    int        sci,scix,sciy,sciz,sci2;
+    int        cjind0,cjind1,cjind;
+
+#ifdef ENERGY_GROUPS
+    int        Vstride_i;
+    int        egps_ishift,egps_imask;
+    int        egps_jshift,egps_jmask,egps_jstride;
+    int        egps_i;
+    real       *vvdwtp[UNROLLI];
+    real       *vctp[UNROLLI];
+#endif
+
+    gmx_mm_pr  shX_SSE;
+    gmx_mm_pr  shY_SSE;
+    gmx_mm_pr  shZ_SSE;
+    gmx_mm_pr  ix_SSE0,iy_SSE0,iz_SSE0;
+    gmx_mm_pr  ix_SSE2,iy_SSE2,iz_SSE2;
+    gmx_mm_pr  fix_SSE0,fiy_SSE0,fiz_SSE0;
+    gmx_mm_pr  fix_SSE2,fiy_SSE2,fiz_SSE2;
+#ifndef GMX_DOUBLE
+    __m128     fix_SSE,fiy_SSE,fiz_SSE;
+#else
+    __m256d    fix_SSE,fiy_SSE,fiz_SSE;
+#endif
+
+    /* The (sub-)diagonal masks for the self-interactions, as bit masks */
+#ifndef GMX_DOUBLE
+    gmx_mm_pb  diag0_SSE0 = 0xFCFE;
+    gmx_mm_pb  diag0_SSE2 = 0xF0F8;
+    gmx_mm_pb  diag1_SSE0 = 0xC0E0;
+    gmx_mm_pb  diag1_SSE2 = 0x0080;
+#else
+    gmx_mm_pb  diag_SSE0  = 0xCE;
+    gmx_mm_pb  diag_SSE2  = 0x08;
+#endif
+
+    gmx_mm_pr  one_SSE=gmx_set1_pr(1.0);
+    gmx_mm_pr  iq_SSE0=gmx_setzero_pr();
+    gmx_mm_pr  iq_SSE2=gmx_setzero_pr();
+    gmx_mm_pr  mrc_3_SSE;
+#ifdef CALC_ENERGIES
+    gmx_mm_pr  hrc_3_SSE,moh_rc_SSE;
+#endif
+
+#ifdef CALC_COUL_TAB
+    /* Coulomb table variables */
+    gmx_mm_pr  invtsp_SSE;
+    const real *tab_coul_F;
+#ifndef TAB_FDV0
+    const real *tab_coul_V;
+#endif
+#ifdef CALC_ENERGIES
+    gmx_mm_pr  mhalfsp_SSE;
+#endif
+#endif
+
+#ifdef CALC_COUL_EWALD
+    gmx_mm_pr beta2_SSE,beta_SSE;
+#endif
+
+#if defined CALC_ENERGIES && (defined CALC_COUL_EWALD || defined CALC_COUL_TAB)
+    gmx_mm_pr  sh_ewald_SSE;
+#endif
+
+#ifdef LJ_COMB_LB
+    const real *ljc;
+
+    gmx_mm_pr  hsig_i_SSE0,seps_i_SSE0;
+    gmx_mm_pr  hsig_i_SSE2,seps_i_SSE2;
+#else
+#ifdef LJ_COMB_GEOM
+    const real *ljc;
+
+    gmx_mm_pr  c6s_SSE0,c12s_SSE0;
+    gmx_mm_pr  c6s_SSE2=gmx_setzero_pr(),c12s_SSE2=gmx_setzero_pr();
+#else
+    /* The i-atom type offsets in the LJ parameter matrix */
+    gmx_epi32  nbfp_i_SSE0,nbfp_i_SSE2;
+#endif
+#endif /* LJ_COMB_LB */
+
+    gmx_mm_pr  vctotSSE,VvdwtotSSE;
+    gmx_mm_pr  sixthSSE,twelvethSSE;
+
+    gmx_mm_pr  avoid_sing_SSE;
+    gmx_mm_pr  rc2_SSE;
+#ifdef VDW_CUTOFF_CHECK
+    gmx_mm_pr  rcvdw2_SSE;
+#endif
+
+#if defined LJ_FORCE_SWITCH || defined LJ_POT_SWITCH
+    gmx_mm_pr  rswitch_SSE;
+#endif
+#ifdef LJ_FORCE_SWITCH
+    gmx_mm_pr  p6_fc2_SSE,p6_fc3_SSE;
+    gmx_mm_pr  p12_fc2_SSE,p12_fc3_SSE;
+#ifdef CALC_ENERGIES
+    gmx_mm_pr  p6_vc3_SSE,p6_vc4_SSE;
+    gmx_mm_pr  p12_vc3_SSE,p12_vc4_SSE;
+#endif
+#endif
+#ifdef LJ_POT_SWITCH
+    gmx_mm_pr  swV3_SSE,swV4_SSE,swV5_SSE;
+    gmx_mm_pr  swF2_SSE,swF3_SSE,swF4_SSE;
+#endif
+
+#ifdef CALC_ENERGIES
+    gmx_mm_pr  sh_invrc6_SSE,sh_invrc12_SSE;
+
+    /* cppcheck-suppress unassignedVariable */
+    real       tmpsum_array[15],*tmpsum;
+#endif
+#ifdef CALC_SHIFTFORCES
+    /* cppcheck-suppress unassignedVariable */
+    real       shf_array[15],*shf;
+#endif
+
+    int ninner;
+
+#ifdef COUNT_PAIRS
+    int npair=0;
+#endif
+
+#if defined LJ_COMB_GEOM || defined LJ_COMB_LB
+    ljc = nbat->lj_comb;
+#else
+    /* No combination rule used */
+#ifndef GMX_DOUBLE
+    nbfp_ptr    = nbat->nbfp_s4;
+#define NBFP_STRIDE  4
+#else
+    nbfp_ptr    = nbat->nbfp;
+#define NBFP_STRIDE  2
+#endif
+    nbfp_stride = NBFP_STRIDE;
+#endif
+
+#ifdef CALC_COUL_TAB
+    invtsp_SSE  = gmx_set1_pr(ic->tabq_scale);
+#ifdef CALC_ENERGIES
+    mhalfsp_SSE = gmx_set1_pr(-0.5/ic->tabq_scale);
+#endif
+
+#ifdef TAB_FDV0
+    tab_coul_F = ic->tabq_coul_FDV0;
+#else
+    tab_coul_F = ic->tabq_coul_F;
+    tab_coul_V = ic->tabq_coul_V;
+#endif
+#endif /* CALC_COUL_TAB */
+
+#ifdef CALC_COUL_EWALD
+    beta2_SSE = gmx_set1_pr(ic->ewaldcoeff*ic->ewaldcoeff);
+    beta_SSE  = gmx_set1_pr(ic->ewaldcoeff);
+#endif
+
+#if (defined CALC_COUL_TAB || defined CALC_COUL_EWALD) && defined CALC_ENERGIES
+    sh_ewald_SSE = gmx_set1_pr(ic->sh_ewald);
+#endif
+
+    q                   = nbat->q;
+    type                = nbat->type;
+    facel               = ic->epsfac;
+    shiftvec            = shift_vec[0];
+    x                   = nbat->x;
+
+    avoid_sing_SSE = gmx_set1_pr(NBNXN_AVOID_SING_R2_INC);
+
+    /* The kernel either supports rcoulomb = rvdw or rcoulomb >= rvdw */
+    rc2_SSE    = gmx_set1_pr(ic->rcoulomb*ic->rcoulomb);
+#ifdef VDW_CUTOFF_CHECK
+    rcvdw2_SSE = gmx_set1_pr(ic->rvdw*ic->rvdw);
+#endif
+
+#if defined CALC_ENERGIES || defined LJ_POT_SWITCH
+    sixthSSE    = gmx_set1_pr(1.0/6.0);
+    twelvethSSE = gmx_set1_pr(1.0/12.0);
+#endif
+
+#ifdef CALC_ENERGIES
+#ifndef LJ_FORCE_SWITCH
+    sh_invrc6_SSE  = gmx_set1_pr(ic->sh_invrc6);
+    sh_invrc12_SSE = gmx_set1_pr(ic->sh_invrc6*ic->sh_invrc6);
+#else
+    /* The force-switch potential shift is applied as a shift of r^-p */
+    sh_invrc6_SSE  = gmx_set1_pr(-ic->dispersion_shift_cpot);
+    sh_invrc12_SSE = gmx_set1_pr(-ic->repulsion_shift_cpot);
+#endif
+#endif
+
+#if defined LJ_FORCE_SWITCH || defined LJ_POT_SWITCH
+    rswitch_SSE = gmx_set1_pr(ic->rvdw_switch);
+#endif
+
+#ifdef LJ_FORCE_SWITCH
+    p6_fc2_SSE  = gmx_set1_pr(ic->dispersion_shift_c2);
+    p6_fc3_SSE  = gmx_set1_pr(ic->dispersion_shift_c3);
+    p12_fc2_SSE = gmx_set1_pr(ic->repulsion_shift_c2);
+    p12_fc3_SSE = gmx_set1_pr(ic->repulsion_shift_c3);
+#ifdef CALC_ENERGIES
+    p6_vc3_SSE  = gmx_set1_pr(-ic->dispersion_shift_c2/3);
+    p6_vc4_SSE  = gmx_set1_pr(-ic->dispersion_shift_c3/4);
+    p12_vc3_SSE = gmx_set1_pr(-ic->repulsion_shift_c2/3);
+    p12_vc4_SSE = gmx_set1_pr(-ic->repulsion_shift_c3/4);
+#endif
+#endif
+
+#ifdef LJ_POT_SWITCH
+    swV3_SSE = gmx_set1_pr(ic->vdw_switch_c3);
+    swV4_SSE = gmx_set1_pr(ic->vdw_switch_c4);
+    swV5_SSE = gmx_set1_pr(ic->vdw_switch_c5);
+    swF2_SSE = gmx_set1_pr(3*ic->vdw_switch_c3);
+    swF3_SSE = gmx_set1_pr(4*ic->vdw_switch_c4);
+    swF4_SSE = gmx_set1_pr(5*ic->vdw_switch_c5);
+#endif
+
+    mrc_3_SSE = gmx_set1_pr(-2*ic->k_rf);
+
+#ifdef CALC_ENERGIES
+    hrc_3_SSE = gmx_set1_pr(ic->k_rf);
+
+    moh_rc_SSE = gmx_set1_pr(-ic->c_rf);
+#endif
+
+#ifdef CALC_ENERGIES
+    tmpsum = (real *)(((size_t)(tmpsum_array+7)) & (~((size_t)31)));
+#endif
+#ifdef CALC_SHIFTFORCES
+    shf = (real *)(((size_t)(shf_array+7)) & (~((size_t)31)));
+#endif
+
+#ifdef ENERGY_GROUPS
+    egps_ishift  = nbat->neg_2log;
+    egps_imask   = (1<<egps_ishift) - 1;
+    egps_jshift  = 2*nbat->neg_2log;
+    egps_jmask   = (1<<egps_jshift) - 1;
+    egps_jstride = (UNROLLJ>>1)*UNROLLJ;
+    /* Major division is over i-particles: divide nVS by 4 for i-stride */
+    Vstride_i    = nbat->nenergrp*(1<<nbat->neg_2log)*egps_jstride;
+#endif
+
+    l_cj = nbl->cj;
+
+    ninner = 0;
+    for(n=0; n<nbl->nci; n++)
+    {
+        nbln = &nbl->ci[n];
+
+        ish              = (nbln->shift & NBNXN_CI_SHIFT);
+        ish3             = ish*3;
+        cjind0           = nbln->cj_ind_start;
+        cjind1           = nbln->cj_ind_end;
+        /* Currently only works super-cells equal to sub-cells */
+        ci               = nbln->ci;
+        ci_sh            = (ish == CENTRAL ? ci : -1);
+
+        shX_SSE = gmx_load1_pr(shiftvec+ish3);
+        shY_SSE = gmx_load1_pr(shiftvec+ish3+1);
+        shZ_SSE = gmx_load1_pr(shiftvec+ish3+2);
+
+#if UNROLLJ <= 4
+        sci              = ci*STRIDE;
+        scix             = sci*DIM;
+        sci2             = sci*2;
+#else
+        sci              = (ci>>1)*STRIDE;
+        scix             = sci*DIM + (ci & 1)*(STRIDE>>1);
+        sci2             = sci*2 + (ci & 1)*(STRIDE>>1);
+        sci             += (ci & 1)*(STRIDE>>1);
+#endif
+
+        half_LJ = (nbln->shift & NBNXN_CI_HALF_LJ(0));
+        do_coul = (nbln->shift & NBNXN_CI_DO_COUL(0));
+
+#ifdef ENERGY_GROUPS
+        egps_i = nbat->energrp[ci];
+        {
+            int ia,egp_ia;
+
+            for(ia=0; ia<UNROLLI; ia++)
+            {
+                egp_ia = (egps_i >> (ia*egps_ishift)) & egps_imask;
+                vvdwtp[ia] = Vvdw + egp_ia*Vstride_i;
+                vctp[ia]   = Vc   + egp_ia*Vstride_i;
+            }
+        }
+#endif
+#if defined CALC_ENERGIES
+#if UNROLLJ == 4
+        if (do_coul && l_cj[nbln->cj_ind_start].cj == ci_sh)
+#endif
+#if UNROLLJ == 8
+        if (do_coul && l_cj[nbln->cj_ind_start].cj == (ci_sh>>1))
+#endif
+        {
+            int  ia;
+            real Vc_sub_self;
+
+#ifdef CALC_COUL_RF
+            Vc_sub_self = 0.5*ic->c_rf;
+#endif
+#ifdef CALC_COUL_TAB
+#ifdef TAB_FDV0
+            Vc_sub_self = 0.5*tab_coul_F[2];
+#else
+            Vc_sub_self = 0.5*tab_coul_V[0];
+#endif
+#endif
+#ifdef CALC_COUL_EWALD
+            /* beta/sqrt(pi) */
+            Vc_sub_self = 0.5*ic->ewaldcoeff*M_2_SQRTPI;
+#endif
+
+            for(ia=0; ia<UNROLLI; ia++)
+            {
+                real qi;
+
+                qi = q[sci+ia];
+#ifdef ENERGY_GROUPS
+                vctp[ia][((egps_i>>(ia*egps_ishift)) & egps_imask)*egps_jstride]
+#else
+                Vc[0]
+#endif
+                    -= facel*qi*qi*Vc_sub_self;
+            }
+        }
+#endif
+
+        /* Load i atom data, i-atoms 0,1 in register 0, 2,3 in register 2 */
+        sciy             = scix + STRIDE;
+        sciz             = sciy + STRIDE;
+        ix_SSE0          = gmx_add_pr(gmx_set2_pr(x[scix  ],x[scix+1]),shX_SSE);
+        ix_SSE2          = gmx_add_pr(gmx_set2_pr(x[scix+2],x[scix+3]),shX_SSE);
+        iy_SSE0          = gmx_add_pr(gmx_set2_pr(x[sciy  ],x[sciy+1]),shY_SSE);
+        iy_SSE2          = gmx_add_pr(gmx_set2_pr(x[sciy+2],x[sciy+3]),shY_SSE);
+        iz_SSE0          = gmx_add_pr(gmx_set2_pr(x[sciz  ],x[sciz+1]),shZ_SSE);
+        iz_SSE2          = gmx_add_pr(gmx_set2_pr(x[sciz+2],x[sciz+3]),shZ_SSE);
+
+        /* With half_LJ we currently always calculate Coulomb interactions */
+        if (do_coul || half_LJ)
+        {
+            iq_SSE0      = gmx_set2_pr(facel*q[sci  ],facel*q[sci+1]);
+            iq_SSE2      = gmx_set2_pr(facel*q[sci+2],facel*q[sci+3]);
+        }
+
+#ifdef LJ_COMB_LB
+        hsig_i_SSE0      = gmx_set2_pr(ljc[sci2+0],ljc[sci2+1]);
+        hsig_i_SSE2      = gmx_set2_pr(ljc[sci2+2],ljc[sci2+3]);
+        seps_i_SSE0      = gmx_set2_pr(ljc[sci2+STRIDE+0],ljc[sci2+STRIDE+1]);
+        seps_i_SSE2      = gmx_set2_pr(ljc[sci2+STRIDE+2],ljc[sci2+STRIDE+3]);
+#else
+#ifdef LJ_COMB_GEOM
+        c6s_SSE0         = gmx_set2_pr(ljc[sci2+0],ljc[sci2+1]);
+        if (!half_LJ)
+        {
+            c6s_SSE2     = gmx_set2_pr(ljc[sci2+2],ljc[sci2+3]);
+        }
+        c12s_SSE0        = gmx_set2_pr(ljc[sci2+STRIDE+0],ljc[sci2+STRIDE+1]);
+        if (!half_LJ)
+        {
+            c12s_SSE2    = gmx_set2_pr(ljc[sci2+STRIDE+2],ljc[sci2+STRIDE+3]);
+        }
+#else
+        nbfp_i_SSE0      = gmx_set2_epi32(type[sci  ]*nbat->ntype*nbfp_stride,
+                                          type[sci+1]*nbat->ntype*nbfp_stride);
+        if (!half_LJ)
+        {
+            nbfp_i_SSE2  = gmx_set2_epi32(type[sci+2]*nbat->ntype*nbfp_stride,
+                                          type[sci+3]*nbat->ntype*nbfp_stride);
+        }
+#endif
+#endif
+
+        /* Zero the potential energy for this list */
+        VvdwtotSSE       = gmx_setzero_pr();
+        vctotSSE         = gmx_setzero_pr();
+
+        /* Clear i atom forces */
+        fix_SSE0           = gmx_setzero_pr();
+        fix_SSE2           = gmx_setzero_pr();
+        fiy_SSE0           = gmx_setzero_pr();
+        fiy_SSE2           = gmx_setzero_pr();
+        fiz_SSE0           = gmx_setzero_pr();
+        fiz_SSE2           = gmx_setzero_pr();
+
+        cjind = cjind0;
+
+        /* Currently all kernels use (at least half) LJ */
+#define CALC_LJ
+        if (half_LJ)
+        {
+#define CALC_COULOMB
+#define HALF_LJ
+#define CHECK_EXCLS
+            while (cjind < cjind1 && nbl->cj[cjind].excl != SIMD_MASK_ALL)
+            {
+#include "nbnxn_kernel_x86_simd_2xnn_inner.h"
+                cjind++;
+            }
+#undef CHECK_EXCLS
+            for(; (cjind<cjind1); cjind++)
+            {
+#include "nbnxn_kernel_x86_simd_2xnn_inner.h"
+            }
+#undef HALF_LJ
+#undef CALC_COULOMB
+        }
+        else if (do_coul)
+        {
+#define CALC_COULOMB
+#define CHECK_EXCLS
+            while (cjind < cjind1 && nbl->cj[cjind].excl != SIMD_MASK_ALL)
+            {
+#include "nbnxn_kernel_x86_simd_2xnn_inner.h"
+                cjind++;
+            }
+#undef CHECK_EXCLS
+            for(; (cjind<cjind1); cjind++)
+            {
+#include "nbnxn_kernel_x86_simd_2xnn_inner.h"
+            }
+#undef CALC_COULOMB
+        }
+        else
+        {
+#define CHECK_EXCLS
+            while (cjind < cjind1 && nbl->cj[cjind].excl != SIMD_MASK_ALL)
+            {
+#include "nbnxn_kernel_x86_simd_2xnn_inner.h"
+                cjind++;
+            }
+#undef CHECK_EXCLS
+            for(; (cjind<cjind1); cjind++)
+            {
+#include "nbnxn_kernel_x86_simd_2xnn_inner.h"
+            }
+        }
+#undef CALC_LJ
+        ninner += cjind1 - cjind0;
+
+        /* Add accumulated i-forces to the force array */
+#ifndef GMX_DOUBLE
+#define gmx_load_ps4  _mm_load_ps
+#define gmx_store_ps4 _mm_store_ps
+#define gmx_add_ps4   _mm_add_ps
+#else
+#define gmx_load_ps4  _mm256_load_pd
+#define gmx_store_ps4 _mm256_store_pd
+#define gmx_add_ps4   _mm256_add_pd
+#endif
+        GMX_MM_TRANSPOSE_SUM4H_PR(fix_SSE0,fix_SSE2,fix_SSE);
+        gmx_store_ps4(f+scix, gmx_add_ps4(fix_SSE, gmx_load_ps4(f+scix)));
+
+        GMX_MM_TRANSPOSE_SUM4H_PR(fiy_SSE0,fiy_SSE2,fiy_SSE);
+        gmx_store_ps4(f+sciy, gmx_add_ps4(fiy_SSE, gmx_load_ps4(f+sciy)));
+
+        GMX_MM_TRANSPOSE_SUM4H_PR(fiz_SSE0,fiz_SSE2,fiz_SSE);
+        gmx_store_ps4(f+sciz, gmx_add_ps4(fiz_SSE, gmx_load_ps4(f+sciz)));
+
+#ifdef CALC_SHIFTFORCES
+        gmx_store_ps4(shf,fix_SSE);
+        fshift[ish3+0] += SUM_SIMD4(shf);
+        gmx_store_ps4(shf,fiy_SSE);
+        fshift[ish3+1] += SUM_SIMD4(shf);
+        gmx_store_ps4(shf,fiz_SSE);
+        fshift[ish3+2] += SUM_SIMD4(shf);
+#endif
+
+#ifdef CALC_ENERGIES
+        /* Reduce the two halves first, so we need to sum only UNROLLJ terms */
+        if (do_coul)
+        {
+            gmx_store_hpr(tmpsum,gmx_sum_halves_pr(vctotSSE));
+            *Vc += SUM_SIMD(tmpsum);
+        }
+
+        gmx_store_hpr(tmpsum,gmx_sum_halves_pr(VvdwtotSSE));
+        *Vvdw += SUM_SIMD(tmpsum);
+#endif
+
+        /* Outer loop uses 6 flops/iteration */
+    }
+
+#ifdef COUNT_PAIRS
+    printf("atom pairs %d\n",npair);
+#endif
+}
+
+#undef gmx_load_ps4
+#undef gmx_store_ps4
+#undef gmx_add_ps4
+
+#undef CALC_SHIFTFORCES
+
+#undef UNROLLI
+#undef UNROLLJ
+#undef STRIDE
+#undef TAB_FDV0
+#undef NBFP_STRIDE
+#undef SUM_SIMD
+#undef SUM_SIMD4
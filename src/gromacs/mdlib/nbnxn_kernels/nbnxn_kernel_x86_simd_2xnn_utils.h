@@ -0,0 +1,201 @@
+/* -*- mode: c; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4; c-file-style: "stroustrup"; -*-
+ *
+ *
+ *                This source code is part of
+ *
+ *                 G   R   O   M   A   C   S
+ *
+ * Copyright (c) 1991-2000, University of Groningen, The Netherlands.
+ * Copyright (c) 2001-2012, The GROMACS Development Team
+ *
+ * Gromacs is a library for molecular simulation and trajectory analysis,
+ * written by Erik Lindahl, David van der Spoel, Berk Hess, and others - for
+ * a full list of developers and information, check out http://www.gromacs.org
+ *
+ * This program is free software; you can redistribute it and/or modify it under 
+ * the terms of the GNU Lesser General Public License as published by the Free 
+ * Software Foundation; either version 2 of the License, or (at your option) any 
+ * later version.
+ * As a special exception, you may use this file as part of a free software
+ * library without restriction.  Specifically, if other files instantiate
+ * templates or use macros or inline functions from this file, or you compile
+ * this file and link it with other files to produce an executable, this
+ * file does not by itself cause the resulting executable to be covered by
+ * the GNU Lesser General Public License.  
+ *
+ * In plain-speak: do not worry about classes/macros/templates either - only
+ * changes to the library have to be LGPL, not an application linking with it.
+ *
+ * To help fund GROMACS development, we humbly ask that you cite
+ * the papers people have written on it - you can find them on the website!
+ */
+#ifndef _nbnxn_kernel_sse_2xnn_utils_h_
+#define _nbnxn_kernel_sse_2xnn_utils_h_
+
+/* This files contains all functions/macros for the x86 SIMD kernels
+ * with a 2x(N+N) layout: each register contains two i-atoms times
+ * a j-cluster of N=UNROLLJ atoms, which is half the SIMD width.
+ * Currently this is only used for AVX-512, which has 8 (double)
+ * or 16 (single) elements per register.
+ * The functionality which depends on the j-cluster size is:
+ *   LJ-parameter lookup
+ *   force table lookup
+ *   energy group pair energy storage
+ * AVX-512 has gather instructions, which we use for the table and
+ * LJ-parameter lookups, so these don't need temporary index arrays.
+ */
+
+/* Sum the i-atom forces in the four halves of the two registers
+ * i_SSE0 (atoms 0,1) and i_SSE2 (atoms 2,3) into one 4-wide register.
+ */
+#ifndef GMX_DOUBLE
+#define GMX_MM_TRANSPOSE_SUM4H_PR(i_SSE0,i_SSE2,o_SSE)                  \
+{                                                                       \
+    __m256 _s0,_s1,_s2,_s3;                                             \
+    _s0   = gmx_lower_hpr(i_SSE0);                                      \
+    _s1   = gmx_upper_hpr(i_SSE0);                                      \
+    _s2   = gmx_lower_hpr(i_SSE2);                                      \
+    _s3   = gmx_upper_hpr(i_SSE2);                                      \
+    _s0   = _mm256_hadd_ps(_s0,_s1);                                    \
+    _s2   = _mm256_hadd_ps(_s2,_s3);                                    \
+    _s1   = _mm256_hadd_ps(_s0,_s2);                                    \
+    o_SSE = _mm_add_ps(_mm256_castps256_ps128(_s1),_mm256_extractf128_ps(_s1,1)); \
+}
+#else
+#define GMX_MM_TRANSPOSE_SUM4H_PR(i_SSE0,i_SSE2,o_SSE)                  \
+{                                                                       \
+    __m256d _s0,_s1,_s2,_s3;                                            \
+    _s0   = gmx_lower_hpr(i_SSE0);                                      \
+    _s1   = gmx_upper_hpr(i_SSE0);                                      \
+    _s2   = gmx_lower_hpr(i_SSE2);                                      \
+    _s3   = gmx_upper_hpr(i_SSE2);                                      \
+    _s0   = _mm256_hadd_pd(_s0,_s1);                                    \
+    _s2   = _mm256_hadd_pd(_s2,_s3);                                    \
+    o_SSE = _mm256_add_pd(_mm256_permute2f128_pd(_s0,_s2,0x20),_mm256_permute2f128_pd(_s0,_s2,0x31)); \
+}
+#endif
+
+
+/* LJ-parameter lookup with the full type matrix.
+ * The index is the j-type offset, tj_SSE, which is the same in both halves,
+ * plus the i-type offset, which differs between the two halves.
+ */
+#ifndef GMX_DOUBLE
+
+/* Set the lower half of an int register to a, the upper half to b */
+#define gmx_set2_epi32(a,b)  _mm512_mask_blend_epi32(0xFF00,_mm512_set1_epi32(a),_mm512_set1_epi32(b))
+
+/* Load the j-atom types, multiplied by NBFP_STRIDE=4, into both halves */
+#define load_lj_type_j(type,aj,tj_SSE)                                  \
+{                                                                       \
+    __m256i _tj;                                                        \
+    _tj    = _mm256_loadu_si256((const __m256i *)(type+aj));            \
+    tj_SSE = _mm512_broadcast_i64x4(_mm256_slli_epi32(_tj,2));          \
+}
+
+#define load_lj_pair_params(nbfp,ti_SSE,tj_SSE,c6_SSE,c12_SSE)          \
+{                                                                       \
+    gmx_epi32 _ind;                                                     \
+    _ind    = _mm512_add_epi32(ti_SSE,tj_SSE);                          \
+    c6_SSE  = _mm512_i32gather_ps(_ind,nbfp  ,sizeof(real));            \
+    c12_SSE = _mm512_i32gather_ps(_ind,nbfp+1,sizeof(real));            \
+}
+
+#else
+
+/* Set the lower half of an int register to a, the upper half to b */
+#define gmx_set2_epi32(a,b)  _mm256_blend_epi32(_mm256_set1_epi32(a),_mm256_set1_epi32(b),0xF0)
+
+/* Load the j-atom types, multiplied by NBFP_STRIDE=2, into both halves */
+#define load_lj_type_j(type,aj,tj_SSE)                                  \
+{                                                                       \
+    __m128i _tj;                                                        \
+    _tj    = _mm_slli_epi32(_mm_loadu_si128((const __m128i *)(type+aj)),1); \
+    tj_SSE = _mm256_inserti128_si256(_mm256_castsi128_si256(_tj),_tj,1); \
+}
+
+#define load_lj_pair_params(nbfp,ti_SSE,tj_SSE,c6_SSE,c12_SSE)          \
+{                                                                       \
+    gmx_epi32 _ind;                                                     \
+    _ind    = _mm256_add_epi32(ti_SSE,tj_SSE);                          \
+    c6_SSE  = _mm512_i32gather_pd(_ind,nbfp  ,sizeof(real));            \
+    c12_SSE = _mm512_i32gather_pd(_ind,nbfp+1,sizeof(real));            \
+}
+
+#endif
+
+
+/* Force and energy table load routines.
+ * Single precision uses the FDV0 table with stride 4,
+ * double precision the separate F and V tables.
+ * ctab1_SSE returns the difference of the next and current force entry.
+ */
+#ifndef GMX_DOUBLE
+
+#define load_table_f(tab_coul_FDV0, ti_SSE, ctab0_SSE, ctab1_SSE)       \
+{                                                                       \
+    gmx_epi32 _ind;                                                     \
+    _ind      = _mm512_slli_epi32(ti_SSE,2);                            \
+    ctab0_SSE = _mm512_i32gather_ps(_ind,tab_coul_FDV0  ,sizeof(real)); \
+    ctab1_SSE = _mm512_i32gather_ps(_ind,tab_coul_FDV0+1,sizeof(real)); \
+}
+
+#define load_table_f_v(tab_coul_FDV0, ti_SSE, ctab0_SSE, ctab1_SSE, ctabv_SSE) \
+{                                                                       \
+    gmx_epi32 _ind;                                                     \
+    _ind      = _mm512_slli_epi32(ti_SSE,2);                            \
+    ctab0_SSE = _mm512_i32gather_ps(_ind,tab_coul_FDV0  ,sizeof(real)); \
+    ctab1_SSE = _mm512_i32gather_ps(_ind,tab_coul_FDV0+1,sizeof(real)); \
+    ctabv_SSE = _mm512_i32gather_ps(_ind,tab_coul_FDV0+2,sizeof(real)); \
+}
+
+#else
+
+#define load_table_f(tab_coul_F, ti_SSE, ctab0_SSE, ctab1_SSE)          \
+{                                                                       \
+    ctab0_SSE = _mm512_i32gather_pd(ti_SSE,tab_coul_F  ,sizeof(real));  \
+    ctab1_SSE = _mm512_i32gather_pd(ti_SSE,tab_coul_F+1,sizeof(real));  \
+    ctab1_SSE = _mm512_sub_pd(ctab1_SSE,ctab0_SSE);                     \
+}
+
+#define load_table_f_v(tab_coul_F, tab_coul_V, ti_SSE, ctab0_SSE, ctab1_SSE, ctabv_SSE) \
+{                                                                       \
+    ctab0_SSE = _mm512_i32gather_pd(ti_SSE,tab_coul_F  ,sizeof(real));  \
+    ctab1_SSE = _mm512_i32gather_pd(ti_SSE,tab_coul_F+1,sizeof(real));  \
+    ctab1_SSE = _mm512_sub_pd(ctab1_SSE,ctab0_SSE);                     \
+    ctabv_SSE = _mm512_i32gather_pd(ti_SSE,tab_coul_V  ,sizeof(real));  \
+}
+
+#endif
+
+
+/* Add energy register to possibly multiple terms in the energy array.
+ * The lower half of e_SSE is added to the buffer of i-atom a (v0),
+ * the upper half to the buffer of i-atom a+1 (v1).
+ */
+static inline void add_ener_grp_halves(gmx_mm_pr e_SSE,
+                                       real *v0,real *v1,int *offset_jj)
+{
+    int jj;
+
+    /* We need to balance the number of store operations with
+     * the rapidly increases number of combinations of energy groups.
+     * We add to a temporary buffer for 1 i-group vs 2 j-groups.
+     */
+    for(jj=0; jj<(UNROLLJ/2); jj++)
+    {
+        gmx_mm_hpr v_SSE;
+
+        v_SSE = gmx_load_hpr(v0+offset_jj[jj]+jj*UNROLLJ);
+        gmx_store_hpr(v0+offset_jj[jj]+jj*UNROLLJ,gmx_add_hpr(v_SSE,gmx_lower_hpr(e_SSE)));
+    }
+    for(jj=0; jj<(UNROLLJ/2); jj++)
+    {
+        gmx_mm_hpr v_SSE;
+
+        v_SSE = gmx_load_hpr(v1+offset_jj[jj]+jj*UNROLLJ);
+        gmx_store_hpr(v1+offset_jj[jj]+jj*UNROLLJ,gmx_add_hpr(v_SSE,gmx_upper_hpr(e_SSE)));
+    }
+}
+
+#endif /* _nbnxn_kernel_sse_2xnn_utils_h_ */
@@ -44,6 +44,12 @@
 #include "nbnxn_kernel_x86_simd_outer.h"
 #undef LJ_COMB_LB
 #include "nbnxn_kernel_x86_simd_outer.h"
+#define LJ_FORCE_SWITCH
+#include "nbnxn_kernel_x86_simd_outer.h"
+#undef LJ_FORCE_SWITCH
+#define LJ_POT_SWITCH
+#include "nbnxn_kernel_x86_simd_outer.h"
+#undef LJ_POT_SWITCH
 #undef CALC_ENERGIES
 
 /* Include the force+energygroups kernels */
@@ -56,6 +62,12 @@
 #include "nbnxn_kernel_x86_simd_outer.h"
 #undef LJ_COMB_LB
 #include "nbnxn_kernel_x86_simd_outer.h"
+#define LJ_FORCE_SWITCH
+#include "nbnxn_kernel_x86_simd_outer.h"
+#undef LJ_FORCE_SWITCH
+#define LJ_POT_SWITCH
+#include "nbnxn_kernel_x86_simd_outer.h"
+#undef LJ_POT_SWITCH
 #undef ENERGY_GROUPS
 #undef CALC_ENERGIES
 
@@ -67,3 +79,9 @@
 #include "nbnxn_kernel_x86_simd_outer.h"
 #undef LJ_COMB_LB
 #include "nbnxn_kernel_x86_simd_outer.h"
+#define LJ_FORCE_SWITCH
+#include "nbnxn_kernel_x86_simd_outer.h"
+#undef LJ_FORCE_SWITCH
+#define LJ_POT_SWITCH
+#include "nbnxn_kernel_x86_simd_outer.h"
+#undef LJ_POT_SWITCH
@@ -257,6 +257,22 @@
             gmx_mm_pr  VLJ6_SSE3,VLJ12_SSE3,VLJ_SSE3;
 #endif
 #endif
+#if defined LJ_FORCE_SWITCH || defined LJ_POT_SWITCH
+            gmx_mm_pr  rlj_SSE0,rsw_SSE0,rsw2_SSE0;
+            gmx_mm_pr  rlj_SSE1,rsw_SSE1,rsw2_SSE1;
+#ifndef HALF_LJ
+            gmx_mm_pr  rlj_SSE2,rsw_SSE2,rsw2_SSE2;
+            gmx_mm_pr  rlj_SSE3,rsw_SSE3,rsw2_SSE3;
+#endif
+#endif
+#ifdef LJ_POT_SWITCH
+            gmx_mm_pr  sw_SSE0,dsw_SSE0;
+            gmx_mm_pr  sw_SSE1,dsw_SSE1;
+#ifndef HALF_LJ
+            gmx_mm_pr  sw_SSE2,dsw_SSE2;
+            gmx_mm_pr  sw_SSE3,dsw_SSE3;
+#endif
+#endif
 #endif /* CALC_LJ */
 
             /* j-cluster index */
@@ -826,6 +842,61 @@
 #endif
 #endif /* LJ_COMB_LB */
 
+#if defined LJ_FORCE_SWITCH || defined LJ_POT_SWITCH
+            /* The distance beyond the switch radius, rinv is zero beyond
+             * the cut-off, we also need to mask the twin-range and excluded
+             * pairs, so the switch terms are zero for those.
+             */
+            rlj_SSE0    = gmx_mul_pr(rsq_SSE0,rinv_SSE0);
+            rlj_SSE1    = gmx_mul_pr(rsq_SSE1,rinv_SSE1);
+#ifndef HALF_LJ
+            rlj_SSE2    = gmx_mul_pr(rsq_SSE2,rinv_SSE2);
+            rlj_SSE3    = gmx_mul_pr(rsq_SSE3,rinv_SSE3);
+#endif
+            rsw_SSE0    = gmx_max_pr(gmx_sub_pr(rlj_SSE0,rswitch_SSE),gmx_setzero_pr());
+            rsw_SSE1    = gmx_max_pr(gmx_sub_pr(rlj_SSE1,rswitch_SSE),gmx_setzero_pr());
+#ifndef HALF_LJ
+            rsw_SSE2    = gmx_max_pr(gmx_sub_pr(rlj_SSE2,rswitch_SSE),gmx_setzero_pr());
+            rsw_SSE3    = gmx_max_pr(gmx_sub_pr(rlj_SSE3,rswitch_SSE),gmx_setzero_pr());
+#endif
+#ifdef EXCL_FORCES
+            rsw_SSE0    = gmx_and_pr(rsw_SSE0,int_SSE0);
+            rsw_SSE1    = gmx_and_pr(rsw_SSE1,int_SSE1);
+#ifndef HALF_LJ
+            rsw_SSE2    = gmx_and_pr(rsw_SSE2,int_SSE2);
+            rsw_SSE3    = gmx_and_pr(rsw_SSE3,int_SSE3);
+#endif
+#endif
+#ifdef VDW_CUTOFF_CHECK
+            rsw_SSE0    = gmx_and_pr(rsw_SSE0,wco_vdw_SSE0);
+            rsw_SSE1    = gmx_and_pr(rsw_SSE1,wco_vdw_SSE1);
+#ifndef HALF_LJ
+            rsw_SSE2    = gmx_and_pr(rsw_SSE2,wco_vdw_SSE2);
+            rsw_SSE3    = gmx_and_pr(rsw_SSE3,wco_vdw_SSE3);
+#endif
+#endif
+            rsw2_SSE0   = gmx_mul_pr(rsw_SSE0,rsw_SSE0);
+            rsw2_SSE1   = gmx_mul_pr(rsw_SSE1,rsw_SSE1);
+#ifndef HALF_LJ
+            rsw2_SSE2   = gmx_mul_pr(rsw_SSE2,rsw_SSE2);
+            rsw2_SSE3   = gmx_mul_pr(rsw_SSE3,rsw_SSE3);
+#endif
+#endif
+#ifdef LJ_POT_SWITCH
+            sw_SSE0     = gmx_add_pr(one_SSE,gmx_mul_pr(gmx_mul_pr(rsw2_SSE0,rsw_SSE0),gmx_add_pr(swV3_SSE,gmx_mul_pr(rsw_SSE0,gmx_add_pr(swV4_SSE,gmx_mul_pr(rsw_SSE0,swV5_SSE))))));
+            sw_SSE1     = gmx_add_pr(one_SSE,gmx_mul_pr(gmx_mul_pr(rsw2_SSE1,rsw_SSE1),gmx_add_pr(swV3_SSE,gmx_mul_pr(rsw_SSE1,gmx_add_pr(swV4_SSE,gmx_mul_pr(rsw_SSE1,swV5_SSE))))));
+#ifndef HALF_LJ
+            sw_SSE2     = gmx_add_pr(one_SSE,gmx_mul_pr(gmx_mul_pr(rsw2_SSE2,rsw_SSE2),gmx_add_pr(swV3_SSE,gmx_mul_pr(rsw_SSE2,gmx_add_pr(swV4_SSE,gmx_mul_pr(rsw_SSE2,swV5_SSE))))));
+            sw_SSE3     = gmx_add_pr(one_SSE,gmx_mul_pr(gmx_mul_pr(rsw2_SSE3,rsw_SSE3),gmx_add_pr(swV3_SSE,gmx_mul_pr(rsw_SSE3,gmx_add_pr(swV4_SSE,gmx_mul_pr(rsw_SSE3,swV5_SSE))))));
+#endif
+            dsw_SSE0    = gmx_mul_pr(rsw2_SSE0,gmx_add_pr(swF2_SSE,gmx_mul_pr(rsw_SSE0,gmx_add_pr(swF3_SSE,gmx_mul_pr(rsw_SSE0,swF4_SSE)))));
+            dsw_SSE1    = gmx_mul_pr(rsw2_SSE1,gmx_add_pr(swF2_SSE,gmx_mul_pr(rsw_SSE1,gmx_add_pr(swF3_SSE,gmx_mul_pr(rsw_SSE1,swF4_SSE)))));
+#ifndef HALF_LJ
+            dsw_SSE2    = gmx_mul_pr(rsw2_SSE2,gmx_add_pr(swF2_SSE,gmx_mul_pr(rsw_SSE2,gmx_add_pr(swF3_SSE,gmx_mul_pr(rsw_SSE2,swF4_SSE)))));
+            dsw_SSE3    = gmx_mul_pr(rsw2_SSE3,gmx_add_pr(swF2_SSE,gmx_mul_pr(rsw_SSE3,gmx_add_pr(swF3_SSE,gmx_mul_pr(rsw_SSE3,swF4_SSE)))));
+#endif
+#endif
+
 #endif /* CALC_LJ */
             
 #ifdef CALC_ENERGIES
@@ -881,11 +952,35 @@
             VLJ12_SSE3    = gmx_mul_pr(twelvethSSE,gmx_sub_pr(FrLJ12_SSE3,gmx_mul_pr(c12_SSE3,sh_invrc12_SSE)));
 #endif
 
+#ifdef LJ_FORCE_SWITCH
+            /* Add the terms for the force switch beyond rvdw_switch */
+            VLJ6_SSE0   = gmx_add_pr(VLJ6_SSE0,gmx_mul_pr(c6_SSE0,gmx_mul_pr(gmx_add_pr(p6_vc3_SSE,gmx_mul_pr(p6_vc4_SSE,rsw_SSE0)),gmx_mul_pr(rsw2_SSE0,rsw_SSE0))));
+            VLJ6_SSE1   = gmx_add_pr(VLJ6_SSE1,gmx_mul_pr(c6_SSE1,gmx_mul_pr(gmx_add_pr(p6_vc3_SSE,gmx_mul_pr(p6_vc4_SSE,rsw_SSE1)),gmx_mul_pr(rsw2_SSE1,rsw_SSE1))));
+#ifndef HALF_LJ
+            VLJ6_SSE2   = gmx_add_pr(VLJ6_SSE2,gmx_mul_pr(c6_SSE2,gmx_mul_pr(gmx_add_pr(p6_vc3_SSE,gmx_mul_pr(p6_vc4_SSE,rsw_SSE2)),gmx_mul_pr(rsw2_SSE2,rsw_SSE2))));
+            VLJ6_SSE3   = gmx_add_pr(VLJ6_SSE3,gmx_mul_pr(c6_SSE3,gmx_mul_pr(gmx_add_pr(p6_vc3_SSE,gmx_mul_pr(p6_vc4_SSE,rsw_SSE3)),gmx_mul_pr(rsw2_SSE3,rsw_SSE3))));
+#endif
+            VLJ12_SSE0  = gmx_add_pr(VLJ12_SSE0,gmx_mul_pr(c12_SSE0,gmx_mul_pr(gmx_add_pr(p12_vc3_SSE,gmx_mul_pr(p12_vc4_SSE,rsw_SSE0)),gmx_mul_pr(rsw2_SSE0,rsw_SSE0))));
+            VLJ12_SSE1  = gmx_add_pr(VLJ12_SSE1,gmx_mul_pr(c12_SSE1,gmx_mul_pr(gmx_add_pr(p12_vc3_SSE,gmx_mul_pr(p12_vc4_SSE,rsw_SSE1)),gmx_mul_pr(rsw2_SSE1,rsw_SSE1))));
+#ifndef HALF_LJ
+            VLJ12_SSE2  = gmx_add_pr(VLJ12_SSE2,gmx_mul_pr(c12_SSE2,gmx_mul_pr(gmx_add_pr(p12_vc3_SSE,gmx_mul_pr(p12_vc4_SSE,rsw_SSE2)),gmx_mul_pr(rsw2_SSE2,rsw_SSE2))));
+            VLJ12_SSE3  = gmx_add_pr(VLJ12_SSE3,gmx_mul_pr(c12_SSE3,gmx_mul_pr(gmx_add_pr(p12_vc3_SSE,gmx_mul_pr(p12_vc4_SSE,rsw_SSE3)),gmx_mul_pr(rsw2_SSE3,rsw_SSE3))));
+#endif
+#endif
+
             VLJ_SSE0      = gmx_sub_pr(VLJ12_SSE0,VLJ6_SSE0);
             VLJ_SSE1      = gmx_sub_pr(VLJ12_SSE1,VLJ6_SSE1);
 #ifndef HALF_LJ
             VLJ_SSE2      = gmx_sub_pr(VLJ12_SSE2,VLJ6_SSE2);
             VLJ_SSE3      = gmx_sub_pr(VLJ12_SSE3,VLJ6_SSE3);
+#endif
+#ifdef LJ_POT_SWITCH
+            VLJ_SSE0    = gmx_mul_pr(VLJ_SSE0,sw_SSE0);
+            VLJ_SSE1    = gmx_mul_pr(VLJ_SSE1,sw_SSE1);
+#ifndef HALF_LJ
+            VLJ_SSE2    = gmx_mul_pr(VLJ_SSE2,sw_SSE2);
+            VLJ_SSE3    = gmx_mul_pr(VLJ_SSE3,sw_SSE3);
+#endif
 #endif
             /* The potential shift should be removed for pairs beyond cut-off */
             VLJ_SSE0      = gmx_and_pr(VLJ_SSE0,wco_vdw_SSE0);
@@ -922,6 +1017,44 @@
 #endif /* CALC_LJ */
 #endif /* CALC_ENERGIES */
 
+#if defined CALC_LJ && defined LJ_FORCE_SWITCH
+            /* Add the force switch terms, the force is computed as F*r */
+            FrLJ6_SSE0  = gmx_add_pr(FrLJ6_SSE0,gmx_mul_pr(c6_SSE0,gmx_mul_pr(gmx_add_pr(p6_fc2_SSE,gmx_mul_pr(p6_fc3_SSE,rsw_SSE0)),gmx_mul_pr(rsw2_SSE0,rlj_SSE0))));
+            FrLJ6_SSE1  = gmx_add_pr(FrLJ6_SSE1,gmx_mul_pr(c6_SSE1,gmx_mul_pr(gmx_add_pr(p6_fc2_SSE,gmx_mul_pr(p6_fc3_SSE,rsw_SSE1)),gmx_mul_pr(rsw2_SSE1,rlj_SSE1))));
+#ifndef HALF_LJ
+            FrLJ6_SSE2  = gmx_add_pr(FrLJ6_SSE2,gmx_mul_pr(c6_SSE2,gmx_mul_pr(gmx_add_pr(p6_fc2_SSE,gmx_mul_pr(p6_fc3_SSE,rsw_SSE2)),gmx_mul_pr(rsw2_SSE2,rlj_SSE2))));
+            FrLJ6_SSE3  = gmx_add_pr(FrLJ6_SSE3,gmx_mul_pr(c6_SSE3,gmx_mul_pr(gmx_add_pr(p6_fc2_SSE,gmx_mul_pr(p6_fc3_SSE,rsw_SSE3)),gmx_mul_pr(rsw2_SSE3,rlj_SSE3))));
+#endif
+            FrLJ12_SSE0 = gmx_add_pr(FrLJ12_SSE0,gmx_mul_pr(c12_SSE0,gmx_mul_pr(gmx_add_pr(p12_fc2_SSE,gmx_mul_pr(p12_fc3_SSE,rsw_SSE0)),gmx_mul_pr(rsw2_SSE0,rlj_SSE0))));
+            FrLJ12_SSE1 = gmx_add_pr(FrLJ12_SSE1,gmx_mul_pr(c12_SSE1,gmx_mul_pr(gmx_add_pr(p12_fc2_SSE,gmx_mul_pr(p12_fc3_SSE,rsw_SSE1)),gmx_mul_pr(rsw2_SSE1,rlj_SSE1))));
+#ifndef HALF_LJ
+            FrLJ12_SSE2 = gmx_add_pr(FrLJ12_SSE2,gmx_mul_pr(c12_SSE2,gmx_mul_pr(gmx_add_pr(p12_fc2_SSE,gmx_mul_pr(p12_fc3_SSE,rsw_SSE2)),gmx_mul_pr(rsw2_SSE2,rlj_SSE2))));
+            FrLJ12_SSE3 = gmx_add_pr(FrLJ12_SSE3,gmx_mul_pr(c12_SSE3,gmx_mul_pr(gmx_add_pr(p12_fc2_SSE,gmx_mul_pr(p12_fc3_SSE,rsw_SSE3)),gmx_mul_pr(rsw2_SSE3,rlj_SSE3))));
+#endif
+#endif
+
+#if defined CALC_LJ && defined LJ_POT_SWITCH
+            /* F*r = F*r*sw - V*dsw*r, with V = FrLJ12/12 - FrLJ6/6 */
+            dsw_SSE0    = gmx_mul_pr(dsw_SSE0,rlj_SSE0);
+            dsw_SSE1    = gmx_mul_pr(dsw_SSE1,rlj_SSE1);
+#ifndef HALF_LJ
+            dsw_SSE2    = gmx_mul_pr(dsw_SSE2,rlj_SSE2);
+            dsw_SSE3    = gmx_mul_pr(dsw_SSE3,rlj_SSE3);
+#endif
+            FrLJ6_SSE0  = gmx_mul_pr(FrLJ6_SSE0,gmx_sub_pr(sw_SSE0,gmx_mul_pr(dsw_SSE0,sixthSSE)));
+            FrLJ6_SSE1  = gmx_mul_pr(FrLJ6_SSE1,gmx_sub_pr(sw_SSE1,gmx_mul_pr(dsw_SSE1,sixthSSE)));
+#ifndef HALF_LJ
+            FrLJ6_SSE2  = gmx_mul_pr(FrLJ6_SSE2,gmx_sub_pr(sw_SSE2,gmx_mul_pr(dsw_SSE2,sixthSSE)));
+            FrLJ6_SSE3  = gmx_mul_pr(FrLJ6_SSE3,gmx_sub_pr(sw_SSE3,gmx_mul_pr(dsw_SSE3,sixthSSE)));
+#endif
+            FrLJ12_SSE0 = gmx_mul_pr(FrLJ12_SSE0,gmx_sub_pr(sw_SSE0,gmx_mul_pr(dsw_SSE0,twelvethSSE)));
+            FrLJ12_SSE1 = gmx_mul_pr(FrLJ12_SSE1,gmx_sub_pr(sw_SSE1,gmx_mul_pr(dsw_SSE1,twelvethSSE)));
+#ifndef HALF_LJ
+            FrLJ12_SSE2 = gmx_mul_pr(FrLJ12_SSE2,gmx_sub_pr(sw_SSE2,gmx_mul_pr(dsw_SSE2,twelvethSSE)));
+            FrLJ12_SSE3 = gmx_mul_pr(FrLJ12_SSE3,gmx_sub_pr(sw_SSE3,gmx_mul_pr(dsw_SSE3,twelvethSSE)));
+#endif
+#endif
+
 #ifdef CALC_LJ
             fscal_SSE0    = gmx_mul_pr(rinvsq_SSE0,
 #ifdef CALC_COULOMB
@@ -87,6 +87,7 @@
 /* #define FIX_LJ_C */
 
 #define NBK_FUNC_NAME_C_LJC(b,s,c,ljc,e) b##_##s##_##c##_comb_##ljc##_##e
+#define NBK_FUNC_NAME_C_LJT(b,s,c,ljt,e) b##_##s##_##c##_##ljt##_##e
 
 #if defined LJ_COMB_GEOM
 #define NBK_FUNC_NAME_C(b,s,c,e) NBK_FUNC_NAME_C_LJC(b,s,c,geom,e)
@@ -94,12 +95,25 @@
 #if defined LJ_COMB_LB
 #define NBK_FUNC_NAME_C(b,s,c,e) NBK_FUNC_NAME_C_LJC(b,s,c,lb,e)
 #else
+#if defined LJ_FORCE_SWITCH
+/* The switched LJ kernels always use the full parameter matrix */
+#define NBK_FUNC_NAME_C(b,s,c,e) NBK_FUNC_NAME_C_LJT(b,s,c,lj_fsw,e)
+#else
+#if defined LJ_POT_SWITCH
+#define NBK_FUNC_NAME_C(b,s,c,e) NBK_FUNC_NAME_C_LJT(b,s,c,lj_psw,e)
+#else
 #define NBK_FUNC_NAME_C(b,s,c,e) NBK_FUNC_NAME_C_LJC(b,s,c,none,e)
 #endif
 #endif
+#endif
+#endif
 
 #ifdef CALC_COUL_RF
+#ifndef VDW_CUTOFF_CHECK
 #define NBK_FUNC_NAME(b,s,e) NBK_FUNC_NAME_C(b,s,rf,e)
+#else
+#define NBK_FUNC_NAME(b,s,e) NBK_FUNC_NAME_C(b,s,rf_twin,e)
+#endif
 #endif
 #ifdef CALC_COUL_TAB
 #ifndef VDW_CUTOFF_CHECK
@@ -136,6 +150,7 @@ NBK_FUNC_NAME_S128_OR_S256(nbnxn_kernel,energrp)
 #undef NBK_FUNC_NAME
 #undef NBK_FUNC_NAME_C
 #undef NBK_FUNC_NAME_C_LJC
+#undef NBK_FUNC_NAME_C_LJT
                             (const nbnxn_pairlist_t     *nbl,
                              const nbnxn_atomdata_t     *nbat,
                              const interaction_const_t  *ic,
@@ -340,6 +355,22 @@ NBK_FUNC_NAME_S128_OR_S256(nbnxn_kernel,energrp)
     gmx_mm_pr  rcvdw2_SSE;
 #endif
 
+#if defined LJ_FORCE_SWITCH || defined LJ_POT_SWITCH
+    gmx_mm_pr  rswitch_SSE;
+#endif
+#ifdef LJ_FORCE_SWITCH
+    gmx_mm_pr  p6_fc2_SSE,p6_fc3_SSE;
+    gmx_mm_pr  p12_fc2_SSE,p12_fc3_SSE;
+#ifdef CALC_ENERGIES
+    gmx_mm_pr  p6_vc3_SSE,p6_vc4_SSE;
+    gmx_mm_pr  p12_vc3_SSE,p12_vc4_SSE;
+#endif
+#endif
+#ifdef LJ_POT_SWITCH
+    gmx_mm_pr  swV3_SSE,swV4_SSE,swV5_SSE;
+    gmx_mm_pr  swF2_SSE,swF3_SSE,swF4_SSE;
+#endif
+
 #ifdef CALC_ENERGIES
     gmx_mm_pr  sh_invrc6_SSE,sh_invrc12_SSE;
 
@@ -416,12 +447,46 @@ NBK_FUNC_NAME_S128_OR_S256(nbnxn_kernel,energrp)
     rcvdw2_SSE = gmx_set1_pr(ic->rvdw*ic->rvdw);
 #endif
 
-#ifdef CALC_ENERGIES
+#if defined CALC_ENERGIES || defined LJ_POT_SWITCH
     sixthSSE    = gmx_set1_pr(1.0/6.0);
     twelvethSSE = gmx_set1_pr(1.0/12.0);
+#endif
 
+#ifdef CALC_ENERGIES
+#ifndef LJ_FORCE_SWITCH
     sh_invrc6_SSE  = gmx_set1_pr(ic->sh_invrc6);
     sh_invrc12_SSE = gmx_set1_pr(ic->sh_invrc6*ic->sh_invrc6);
+#else
+    /* The force-switch potential shift is applied as a shift of r^-p */
+    sh_invrc6_SSE  = gmx_set1_pr(-ic->dispersion_shift_cpot);
+    sh_invrc12_SSE = gmx_set1_pr(-ic->repulsion_shift_cpot);
+#endif
+#endif
+
+#if defined LJ_FORCE_SWITCH || defined LJ_POT_SWITCH
+    rswitch_SSE = gmx_set1_pr(ic->rvdw_switch);
+#endif
+
+#ifdef LJ_FORCE_SWITCH
+    p6_fc2_SSE  = gmx_set1_pr(ic->dispersion_shift_c2);
+    p6_fc3_SSE  = gmx_set1_pr(ic->dispersion_shift_c3);
+    p12_fc2_SSE = gmx_set1_pr(ic->repulsion_shift_c2);
+    p12_fc3_SSE = gmx_set1_pr(ic->repulsion_shift_c3);
+#ifdef CALC_ENERGIES
+    p6_vc3_SSE  = gmx_set1_pr(-ic->dispersion_shift_c2/3);
+    p6_vc4_SSE  = gmx_set1_pr(-ic->dispersion_shift_c3/4);
+    p12_vc3_SSE = gmx_set1_pr(-ic->repulsion_shift_c2/3);
+    p12_vc4_SSE = gmx_set1_pr(-ic->repulsion_shift_c3/4);
+#endif
+#endif
+
+#ifdef LJ_POT_SWITCH
+    swV3_SSE = gmx_set1_pr(ic->vdw_switch_c3);
+    swV4_SSE = gmx_set1_pr(ic->vdw_switch_c4);
+    swV5_SSE = gmx_set1_pr(ic->vdw_switch_c5);
+    swF2_SSE = gmx_set1_pr(3*ic->vdw_switch_c3);
+    swF3_SSE = gmx_set1_pr(4*ic->vdw_switch_c4);
+    swF4_SSE = gmx_set1_pr(5*ic->vdw_switch_c5);
 #endif
 
     mrc_3_SSE = gmx_set1_pr(-2*ic->k_rf);
@@ -122,6 +122,10 @@
 #define CI_TO_CJ_S256(ci)  CI_TO_CJ_J8(ci)
 #define X_IND_CI_S256(ci)  X_IND_CI_J8(ci)
 #define X_IND_CJ_S256(cj)  X_IND_CJ_J8(cj)
+/* 512 bits hold two i-atoms times 8 floats */
+#define CI_TO_CJ_S512(ci)  CI_TO_CJ_J8(ci)
+#define X_IND_CI_S512(ci)  X_IND_CI_J8(ci)
+#define X_IND_CJ_S512(cj)  X_IND_CJ_J8(cj)
 #else
 /* 128 bits can hold 2 doubles */
 #define CI_TO_CJ_S128(ci)  CI_TO_CJ_J2(ci)
@@ -131,6 +135,10 @@
 #define CI_TO_CJ_S256(ci)  CI_TO_CJ_J4(ci)
 #define X_IND_CI_S256(ci)  X_IND_CI_J4(ci)
 #define X_IND_CJ_S256(cj)  X_IND_CJ_J4(cj)
+/* 512 bits hold two i-atoms times 4 doubles */
+#define CI_TO_CJ_S512(ci)  CI_TO_CJ_J4(ci)
+#define X_IND_CI_S512(ci)  X_IND_CI_J4(ci)
+#define X_IND_CJ_S512(cj)  X_IND_CJ_J4(cj)
 #endif
 
 #endif /* NBNXN_SEARCH_SSE */
@@ -250,6 +258,7 @@ static int nbnxn_kernel_to_ci_size(int nb_kernel_type)
     case nbk4x4_PlainC:
     case nbk4xN_X86_SIMD128:
     case nbk4xN_X86_SIMD256:
+    case nbk4xN_X86_SIMD512:
         return NBNXN_CPU_CLUSTER_I_SIZE;
     case nbk8x8x8_CUDA:
     case nbk8x8x8_PlainC:
@@ -277,6 +286,9 @@ int nbnxn_kernel_to_cj_size(int nb_kernel_type)
     case nbk4xN_X86_SIMD256:
         /* Number of reals that fit in SIMD (256 bits = 32 bytes) */
         return 32/sizeof(real);
+    case nbk4xN_X86_SIMD512:
+        /* Each 512-bit register holds two half-width j-clusters */
+        return 32/sizeof(real);
     case nbk8x8x8_CUDA:
     case nbk8x8x8_PlainC:
         return nbnxn_kernel_to_ci_size(nb_kernel_type);
@@ -315,6 +327,7 @@ gmx_bool nbnxn_kernel_pairlist_simple(int nb_kernel_type)
     case nbk4x4_PlainC:
     case nbk4xN_X86_SIMD128:
     case nbk4xN_X86_SIMD256:
+    case nbk4xN_X86_SIMD512:
         return TRUE;
 
     default:
@@ -2364,6 +2377,9 @@ static void nbnxn_init_pairlist(nbnxn_pairlist_t *nbl,
 #ifdef GMX_X86_AVX_256
     snew_aligned(nbl->work->x_ci_x86_simd256,1,32);
 #endif
+#ifdef GMX_X86_AVX_512
+    snew_aligned(nbl->work->x_ci_x86_simd512,1,64);
+#endif
 #endif
     snew_aligned(nbl->work->d2,GPU_NSUBCELL,16);
 }
@@ -2388,6 +2404,8 @@ void nbnxn_init_pairlist_set(nbnxn_pairlist_set_t *nbl_list,
     }
 
     snew(nbl_list->nbl,nbl_list->nnbl);
+    nbl_list->nbl_fep      = NULL;
+    nbl_list->nbl_fep_excl = NULL;
     /* Execute in order to avoid memory interleaving between threads */
 #pragma omp parallel for num_threads(nbl_list->nnbl) schedule(static)
     for(i=0; i<nbl_list->nnbl; i++)
@@ -2646,6 +2664,22 @@ static unsigned int get_imask_x86_simd256(gmx_bool rdiag,int ci,int cj)
 #endif
 }
 #endif
+
+#ifdef GMX_X86_AVX_512
+/* Returns a diagonal or off-diagonal interaction mask for SIMD512 lists,
+ * the cluster sizes, and thus the masks, are identical to SIMD256.
+ */
+static unsigned int get_imask_x86_simd512(gmx_bool rdiag,int ci,int cj)
+{
+#ifndef GMX_DOUBLE /* cj-size = 8 */
+    return (rdiag && ci == cj*2 ? NBNXN_INT_MASK_DIAG_J8_0 :
+            (rdiag && ci == cj*2+1 ? NBNXN_INT_MASK_DIAG_J8_1 :
+             NBNXN_INT_MASK_ALL));
+#else              /* cj-size = 4 */
+    return (rdiag && ci == cj ? NBNXN_INT_MASK_DIAG : NBNXN_INT_MASK_ALL);
+#endif
+}
+#endif
 #endif /* NBNXN_SEARCH_SSE */
 
 /* Plain C code for making a pair list of cell ci vs cell cjf-cjl.
@@ -2784,6 +2818,15 @@ static void make_cluster_list_simple(const nbnxn_grid_t *gridj,
 #undef STRIDE_S
 #undef GMX_MM256_HERE
 #endif
+#ifdef GMX_X86_AVX_512
+/* Include make_cluster_list_x86_simd512, the j-cluster is half a register */
+#define GMX_MM512_HERE
+#include "gmx_x86_simd_macros.h"
+#define STRIDE_S  (GMX_X86_SIMD_WIDTH_HERE/2)
+#include "nbnxn_search_x86_simd.h"
+#undef STRIDE_S
+#undef GMX_MM512_HERE
+#endif
 #endif
 
 /* Plain C or SSE code for making a pair list of super-cell sci vs scj.
@@ -4520,6 +4563,17 @@ static void nbnxn_make_pairlist_part(const nbnxn_search_t nbs,
                                                                       &ndistc);
                                         break;
 #endif
+#ifdef GMX_X86_AVX_512
+                                    case nbk4xN_X86_SIMD512:
+                                        check_subcell_list_space_simple(nbl,ci_to_cj(na_cj_2log,cl-cf)+2);
+                                        make_cluster_list_x86_simd512(gridj,
+                                                                      nbl,ci,cf,cl,
+                                                                      (gridi == gridj && shift == CENTRAL),
+                                                                      nbat->x,
+                                                                      rl2,rbb2,
+                                                                      &ndistc);
+                                        break;
+#endif
 #endif
                                     case nbk8x8x8_PlainC:
                                     case nbk8x8x8_CUDA:
@@ -4731,6 +4785,11 @@ void nbnxn_make_pairlist(const nbnxn_search_t nbs,
             nbs->icell_set_x = icell_set_x_x86_simd256;
             break;
 #endif
+#ifdef GMX_X86_AVX_512
+        case nbk4xN_X86_SIMD512:
+            nbs->icell_set_x = icell_set_x_x86_simd512;
+            break;
+#endif
 #endif
         default:
             nbs->icell_set_x = icell_set_x_simple;
@@ -4923,3 +4982,408 @@ void nbnxn_make_pairlist(const nbnxn_search_t nbs,
         }
     }
 }
+
+/* Starts a new i-entry for atom ai with shift index shift
+ * and energy group pair index gid in nlist
+ */
+static void atomlist_new_i(t_nblist *nlist,int ai,int shift,int gid)
+{
+    if (nlist->nri + 1 >= nlist->maxnri)
+    {
+        nlist->maxnri = over_alloc_large(nlist->nri + 2);
+        srenew(nlist->iinr,nlist->maxnri);
+        srenew(nlist->gid,nlist->maxnri);
+        srenew(nlist->shift,nlist->maxnri);
+        srenew(nlist->jindex,nlist->maxnri + 1);
+    }
+    nlist->iinr[nlist->nri]  = ai;
+    nlist->gid[nlist->nri]   = gid;
+    nlist->shift[nlist->nri] = shift;
+}
+
+static void atomlist_add_j(t_nblist *nlist,int aj)
+{
+    if (nlist->nrj >= nlist->maxnrj)
+    {
+        nlist->maxnrj = over_alloc_large(nlist->nrj + 1);
+        srenew(nlist->jjnr,nlist->maxnrj);
+    }
+    nlist->jjnr[nlist->nrj++] = aj;
+}
+
+/* Closes the current i-entry of nlist, empty entries are dropped */
+static void atomlist_close_i(t_nblist *nlist)
+{
+    if (nlist->nrj > nlist->jindex[nlist->nri])
+    {
+        nlist->nri++;
+        nlist->jindex[nlist->nri] = nlist->nrj;
+    }
+}
+
+static void atomlist_clear(t_nblist *nlist)
+{
+    if (nlist->maxnri == 0)
+    {
+        nlist->maxnri = 1;
+        snew(nlist->jindex,nlist->maxnri + 1);
+    }
+    nlist->nri       = 0;
+    nlist->nrj       = 0;
+    nlist->jindex[0] = 0;
+}
+
+/* Returns if atom aj is within rc of atom ai shifted by shift_vec */
+static gmx_bool atompair_within(const rvec *x,int ai,const rvec shift_vec,
+                                int aj,real rc2)
+{
+    rvec dx;
+
+    rvec_add(x[ai],shift_vec,dx);
+    rvec_dec(dx,x[aj]);
+
+    return (norm2(dx) < rc2);
+}
+
+void nbnxn_make_qmmm_list(const nbnxn_search_t nbs,
+                          const nbnxn_pairlist_set_t *nbl_list,
+                          const gmx_bool *bQM,
+                          const rvec *x,
+                          const rvec *shift_vec,
+                          real rc,
+                          t_nblist *nlist)
+{
+    const nbnxn_pairlist_t *nbl;
+    const nbnxn_ci_t *nbl_ci;
+    const int *a;
+    int  n,ci_ind,cj_ind,ci,cj,i,j,ai,aj;
+    int  na_ci,na_cj,na_cj_2log;
+    int  shift,shift_inv;
+    unsigned int excl;
+    real rc2;
+
+    if (!nbl_list->bSimple)
+    {
+        gmx_incons("nbnxn_make_qmmm_list called with a GPU pair list");
+    }
+
+    atomlist_clear(nlist);
+
+    a   = nbs->a;
+    rc2 = rc*rc;
+
+    for(n=0; n<nbl_list->nnbl; n++)
+    {
+        nbl        = nbl_list->nbl[n];
+        na_ci      = nbl->na_ci;
+        na_cj      = nbl->na_cj;
+        na_cj_2log = get_2log(na_cj);
+
+        for(ci_ind=0; ci_ind<nbl->nci; ci_ind++)
+        {
+            nbl_ci    = &nbl->ci[ci_ind];
+            ci        = nbl_ci->ci;
+            shift     = nbl_ci->shift & NBNXN_CI_SHIFT;
+            shift_inv = XYZ2IS(-IS2X(shift),-IS2Y(shift),-IS2Z(shift));
+
+            /* QM i-atoms with the MM atoms of the j-clusters */
+            for(i=0; i<na_ci; i++)
+            {
+                ai = a[ci*na_ci+i];
+                if (ai < 0 || !bQM[ai])
+                {
+                    continue;
+                }
+                atomlist_new_i(nlist,ai,shift,0);
+                for(cj_ind=nbl_ci->cj_ind_start; cj_ind<nbl_ci->cj_ind_end; cj_ind++)
+                {
+                    cj   = nbl->cj[cj_ind].cj;
+                    excl = nbl->cj[cj_ind].excl;
+                    for(j=0; j<na_cj; j++)
+                    {
+                        aj = a[cj*na_cj+j];
+                        if (aj >= 0 && !bQM[aj] &&
+                            (excl & (1U<<((i<<na_cj_2log) + j))) &&
+                            atompair_within(x,ai,shift_vec[shift],aj,rc2))
+                        {
+                            atomlist_add_j(nlist,aj);
+                        }
+                    }
+                }
+                atomlist_close_i(nlist);
+            }
+
+            /* QM j-atoms with the MM atoms of the i-cluster. The shift
+             * is applied to the i-cluster, so the QM atom as i-entry
+             * gets the inverse shift.
+             */
+            for(cj_ind=nbl_ci->cj_ind_start; cj_ind<nbl_ci->cj_ind_end; cj_ind++)
+            {
+                cj   = nbl->cj[cj_ind].cj;
+                excl = nbl->cj[cj_ind].excl;
+                for(j=0; j<na_cj; j++)
+                {
+                    aj = a[cj*na_cj+j];
+                    if (aj < 0 || !bQM[aj])
+                    {
+                        continue;
+                    }
+                    atomlist_new_i(nlist,aj,shift_inv,0);
+                    for(i=0; i<na_ci; i++)
+                    {
+                        ai = a[ci*na_ci+i];
+                        if (ai >= 0 && !bQM[ai] &&
+                            (excl & (1U<<((i<<na_cj_2log) + j))) &&
+                            atompair_within(x,ai,shift_vec[shift],aj,rc2))
+                        {
+                            atomlist_add_j(nlist,ai);
+                        }
+                    }
+                    atomlist_close_i(nlist);
+                }
+            }
+        }
+    }
+}
+
+static void init_fep_list(t_nblist *nlist,int ielec,int ivdw)
+{
+    nlist->igeometry = GMX_NBLIST_GEOMETRY_PARTICLE_PARTICLE;
+    nlist->ielec     = ielec;
+    nlist->ivdw      = ivdw;
+    nlist->type      = GMX_NBLIST_INTERACTION_FREE_ENERGY;
+    atomlist_clear(nlist);
+}
+
+void nbnxn_init_pairlist_fep(nbnxn_pairlist_set_t *nbl_list,
+                             int ielec,int ivdw)
+{
+    int th;
+
+    snew(nbl_list->nbl_fep,nbl_list->nnbl);
+    snew(nbl_list->nbl_fep_excl,nbl_list->nnbl);
+    for(th=0; th<nbl_list->nnbl; th++)
+    {
+        snew(nbl_list->nbl_fep[th],1);
+        init_fep_list(nbl_list->nbl_fep[th],ielec,ivdw);
+        snew(nbl_list->nbl_fep_excl[th],1);
+        init_fep_list(nbl_list->nbl_fep_excl[th],ielec,ivdw);
+    }
+}
+
+/* Adds aj to the open i-entry of nlist. With energy groups the i-entry
+ * is reopened when the energy group pair index gid changes.
+ */
+static void fep_list_add_j(t_nblist *nlist,int gid,int aj)
+{
+    int ai,shift;
+
+    if (gid != nlist->gid[nlist->nri])
+    {
+        ai    = nlist->iinr[nlist->nri];
+        shift = nlist->shift[nlist->nri];
+        atomlist_close_i(nlist);
+        atomlist_new_i(nlist,ai,shift,gid);
+    }
+    atomlist_add_j(nlist,aj);
+}
+
+/* Returns if the pair of atoms at positions pi and pj in the grid
+ * order, with a cleared bit in the cluster pair mask, is a topology
+ * exclusion or the self pair (pj==pi). In the diagonal cluster pairs
+ * (bDiag) the pairs with pj<pi are not excluded, but absent, as they
+ * are listed the other way around, see set_ci_top_excls.
+ */
+static gmx_bool fep_pair_excluded(gmx_bool bDiag,int pi,int pj)
+{
+    return (!bDiag || pj >= pi);
+}
+
+/* Adds aj to the open i-entry of nlist when bInt and aj is within
+ * rlist of ai, or when !bInt to the open i-entry of nlist_excl
+ */
+static void fep_list_add_pair(const rvec *x,const rvec shift_vec,real rlist2,
+                              int ai,int aj,gmx_bool bInt,
+                              const unsigned short *cENER,int ngener,
+                              t_nblist *nlist,t_nblist *nlist_excl)
+{
+    int gid;
+
+    gid = 0;
+    if (ngener > 1)
+    {
+        gid = GID(cENER[ai],cENER[aj],ngener);
+    }
+
+    if (!bInt)
+    {
+        fep_list_add_j(nlist_excl,gid,aj);
+    }
+    else if (atompair_within(x,ai,shift_vec,aj,rlist2))
+    {
+        fep_list_add_j(nlist,gid,aj);
+    }
+}
+
+/* Makes the free-energy atom pair lists nlist and nlist_excl
+ * from the cluster list nbl
+ */
+static void make_fep_list_part(const nbnxn_search_t nbs,
+                               const nbnxn_pairlist_t *nbl,
+                               const gmx_bool *bPerturbed,
+                               const unsigned short *cENER,
+                               int ngener,
+                               const rvec *x,
+                               const rvec *shift_vec,
+                               real rlist2,
+                               t_nblist *nlist,
+                               t_nblist *nlist_excl)
+{
+    const nbnxn_ci_t *nbl_ci;
+    const int *a;
+    int  ci_ind,cj_ind,ci,cj,i,j,ai,aj,pi,pj;
+    int  na_ci,na_cj,na_cj_2log;
+    int  shift,shift_inv;
+    unsigned int excl;
+    gmx_bool bPert_ci,bPert_cj,bDiag,bInt;
+
+    atomlist_clear(nlist);
+    atomlist_clear(nlist_excl);
+
+    a          = nbs->a;
+    na_ci      = nbl->na_ci;
+    na_cj      = nbl->na_cj;
+    na_cj_2log = get_2log(na_cj);
+
+    for(ci_ind=0; ci_ind<nbl->nci; ci_ind++)
+    {
+        nbl_ci    = &nbl->ci[ci_ind];
+        ci        = nbl_ci->ci;
+        shift     = nbl_ci->shift & NBNXN_CI_SHIFT;
+        shift_inv = XYZ2IS(-IS2X(shift),-IS2Y(shift),-IS2Z(shift));
+
+        bPert_ci = FALSE;
+        for(i=0; i<na_ci; i++)
+        {
+            ai = a[ci*na_ci+i];
+            bPert_ci = bPert_ci || (ai >= 0 && bPerturbed[ai]);
+        }
+
+        if (bPert_ci)
+        {
+            /* All pairs of the i-cluster with a perturbed atom */
+            for(i=0; i<na_ci; i++)
+            {
+                pi = ci*na_ci + i;
+                ai = a[pi];
+                if (ai < 0)
+                {
+                    continue;
+                }
+                atomlist_new_i(nlist,ai,shift,0);
+                atomlist_new_i(nlist_excl,ai,shift,0);
+                for(cj_ind=nbl_ci->cj_ind_start; cj_ind<nbl_ci->cj_ind_end; cj_ind++)
+                {
+                    cj    = nbl->cj[cj_ind].cj;
+                    excl  = nbl->cj[cj_ind].excl;
+                    bDiag = (shift == CENTRAL &&
+                             cj*na_cj < (ci + 1)*na_ci &&
+                             ci*na_ci < (cj + 1)*na_cj);
+                    for(j=0; j<na_cj; j++)
+                    {
+                        pj   = cj*na_cj + j;
+                        aj   = a[pj];
+                        bInt = ((excl & (1U<<((i<<na_cj_2log) + j))) != 0);
+                        if (aj >= 0 && (bPerturbed[ai] || bPerturbed[aj]) &&
+                            (bInt || fep_pair_excluded(bDiag,pi,pj)))
+                        {
+                            fep_list_add_pair(x,shift_vec[shift],rlist2,
+                                              ai,aj,bInt,
+                                              cENER,ngener,nlist,nlist_excl);
+                        }
+                    }
+                }
+                atomlist_close_i(nlist);
+                atomlist_close_i(nlist_excl);
+            }
+        }
+        else
+        {
+            /* The perturbed j-atoms with the i-cluster, the shift
+             * is applied to the i-cluster, so the j-atom as i-entry
+             * gets the inverse shift.
+             */
+            for(cj_ind=nbl_ci->cj_ind_start; cj_ind<nbl_ci->cj_ind_end; cj_ind++)
+            {
+                cj = nbl->cj[cj_ind].cj;
+
+                bPert_cj = FALSE;
+                for(j=0; j<na_cj; j++)
+                {
+                    aj = a[cj*na_cj+j];
+                    bPert_cj = bPert_cj || (aj >= 0 && bPerturbed[aj]);
+                }
+                if (!bPert_cj)
+                {
+                    continue;
+                }
+
+                excl  = nbl->cj[cj_ind].excl;
+                bDiag = (shift == CENTRAL &&
+                         cj*na_cj < (ci + 1)*na_ci &&
+                         ci*na_ci < (cj + 1)*na_cj);
+                for(j=0; j<na_cj; j++)
+                {
+                    pj = cj*na_cj + j;
+                    aj = a[pj];
+                    if (aj < 0 || !bPerturbed[aj])
+                    {
+                        continue;
+                    }
+                    atomlist_new_i(nlist,aj,shift_inv,0);
+                    atomlist_new_i(nlist_excl,aj,shift_inv,0);
+                    for(i=0; i<na_ci; i++)
+                    {
+                        pi   = ci*na_ci + i;
+                        ai   = a[pi];
+                        bInt = ((excl & (1U<<((i<<na_cj_2log) + j))) != 0);
+                        if (ai >= 0 &&
+                            (bInt || fep_pair_excluded(bDiag,pi,pj)))
+                        {
+                            fep_list_add_pair(x,shift_vec[shift_inv],rlist2,
+                                              aj,ai,bInt,
+                                              cENER,ngener,nlist,nlist_excl);
+                        }
+                    }
+                    atomlist_close_i(nlist);
+                    atomlist_close_i(nlist_excl);
+                }
+            }
+        }
+    }
+}
+
+void nbnxn_make_fep_list(const nbnxn_search_t nbs,
+                         nbnxn_pairlist_set_t *nbl_list,
+                         const gmx_bool *bPerturbed,
+                         const unsigned short *cENER,
+                         int ngener,
+                         const rvec *x,
+                         const rvec *shift_vec,
+                         real rlist)
+{
+    int th;
+
+    if (!nbl_list->bSimple)
+    {
+        gmx_incons("nbnxn_make_fep_list called with a GPU pair list");
+    }
+
+#pragma omp parallel for num_threads(nbl_list->nnbl) schedule(static)
+    for(th=0; th<nbl_list->nnbl; th++)
+    {
+        make_fep_list_part(nbs,nbl_list->nbl[th],bPerturbed,cENER,ngener,
+                           x,shift_vec,rlist*rlist,
+                           nbl_list->nbl_fep[th],nbl_list->nbl_fep_excl[th]);
+    }
+}
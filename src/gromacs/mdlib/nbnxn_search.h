@@ -129,6 +129,45 @@ void nbnxn_make_pairlist(const nbnxn_search_t nbs,
                          int nb_kernel_type,
                          t_nrnb *nrnb);
 
+/* Make the QM/MM neighbor list nlist from the simple pair lists in
+ * nbl_list: for every QM atom (bQM) the MM atoms within distance rc,
+ * with the shift index of the QM atom. Excluded pairs are skipped.
+ * A QM atom gets an i-entry for every i-cluster it pairs with.
+ */
+void nbnxn_make_qmmm_list(const nbnxn_search_t nbs,
+                          const nbnxn_pairlist_set_t *nbl_list,
+                          const gmx_bool *bQM,
+                          const rvec *x,
+                          const rvec *shift_vec,
+                          real rc,
+                          t_nblist *nlist);
+
+/* Allocates the free-energy atom pair and exclusion lists of nbl_list,
+ * one per pair list, to be evaluated with Coulomb and VdW kernel types
+ * ielec and ivdw (GMX_NBKERNEL_ELEC_... and GMX_NBKERNEL_VDW_...).
+ */
+void nbnxn_init_pairlist_fep(nbnxn_pairlist_set_t *nbl_list,
+                             int ielec,int ivdw);
+
+/* Make the free-energy atom pair lists nbl_list->nbl_fep from the
+ * simple pair lists in nbl_list: all non-excluded pairs within rlist
+ * that involve a perturbed atom (bPerturbed), with the energy group
+ * pair index from cENER as gid when ngener > 1.
+ * The excluded pairs of the perturbed atoms in the cluster lists and
+ * their self pairs go into nbl_list->nbl_fep_excl, for the Ewald and
+ * reaction-field exclusion corrections.
+ * As the cluster kernels do not see the perturbed atoms, see
+ * nbnxn_atomdata_set, these lists hold all their interactions.
+ */
+void nbnxn_make_fep_list(const nbnxn_search_t nbs,
+                         nbnxn_pairlist_set_t *nbl_list,
+                         const gmx_bool *bPerturbed,
+                         const unsigned short *cENER,
+                         int ngener,
+                         const rvec *x,
+                         const rvec *shift_vec,
+                         real rlist);
+
 #ifdef __cplusplus
 }
 #endif
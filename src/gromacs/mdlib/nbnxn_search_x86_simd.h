@@ -33,7 +33,8 @@
  * Gallium Rubidium Oxygen Manganese Argon Carbon Silicon
  */
 
-/* GMX_MM128_HERE or GMX_MM256_HERE should be set before including this file.
+/* GMX_MM128_HERE, GMX_MM256_HERE or GMX_MM512_HERE should be set
+ * before including this file.
  * gmx_sse_or_avh.h should be included before including this file.
  */
 
@@ -44,7 +45,11 @@ static void icell_set_x_x86_simd128
 #ifdef GMX_MM256_HERE
 static void icell_set_x_x86_simd256
 #else
-"error: GMX_MM128_HERE or GMX_MM256_HERE not defined"
+#ifdef GMX_MM512_HERE
+static void icell_set_x_x86_simd512
+#else
+"error: GMX_MM128_HERE, GMX_MM256_HERE or GMX_MM512_HERE not defined"
+#endif
 #endif
 #endif
                                    (int ci,
@@ -60,14 +65,35 @@ static void icell_set_x_x86_simd256
     x_ci = work->x_ci_x86_simd128;
 
     ia = X_IND_CI_S128(ci);
-#else
+#endif
+#ifdef GMX_MM256_HERE
     nbnxn_x_ci_x86_simd256_t *x_ci;
 
     x_ci = work->x_ci_x86_simd256;
 
     ia = X_IND_CI_S256(ci);
 #endif
+#ifdef GMX_MM512_HERE
+    nbnxn_x_ci_x86_simd512_t *x_ci;
 
+    x_ci = work->x_ci_x86_simd512;
+
+    ia = X_IND_CI_S512(ci);
+
+    /* i-atoms 0,1 go in register 0 and i-atoms 2,3 in register 2 */
+    x_ci->ix_SSE0 = gmx_set2_pr(x[ia + 0*STRIDE_S    ] + shx,
+                                x[ia + 0*STRIDE_S + 1] + shx);
+    x_ci->iy_SSE0 = gmx_set2_pr(x[ia + 1*STRIDE_S    ] + shy,
+                                x[ia + 1*STRIDE_S + 1] + shy);
+    x_ci->iz_SSE0 = gmx_set2_pr(x[ia + 2*STRIDE_S    ] + shz,
+                                x[ia + 2*STRIDE_S + 1] + shz);
+    x_ci->ix_SSE2 = gmx_set2_pr(x[ia + 0*STRIDE_S + 2] + shx,
+                                x[ia + 0*STRIDE_S + 3] + shx);
+    x_ci->iy_SSE2 = gmx_set2_pr(x[ia + 1*STRIDE_S + 2] + shy,
+                                x[ia + 1*STRIDE_S + 3] + shy);
+    x_ci->iz_SSE2 = gmx_set2_pr(x[ia + 2*STRIDE_S + 2] + shz,
+                                x[ia + 2*STRIDE_S + 3] + shz);
+#else
     x_ci->ix_SSE0 = gmx_set1_pr(x[ia + 0*STRIDE_S    ] + shx);
     x_ci->iy_SSE0 = gmx_set1_pr(x[ia + 1*STRIDE_S    ] + shy);
     x_ci->iz_SSE0 = gmx_set1_pr(x[ia + 2*STRIDE_S    ] + shz);
@@ -80,6 +106,7 @@ static void icell_set_x_x86_simd256
     x_ci->ix_SSE3 = gmx_set1_pr(x[ia + 0*STRIDE_S + 3] + shx);
     x_ci->iy_SSE3 = gmx_set1_pr(x[ia + 1*STRIDE_S + 3] + shy);
     x_ci->iz_SSE3 = gmx_set1_pr(x[ia + 2*STRIDE_S + 3] + shz);
+#endif
 }
 
 /* SSE or AVX code for making a pair list of cell ci vs cell cjf-cjl
@@ -93,7 +120,11 @@ static void make_cluster_list_x86_simd128
 #ifdef GMX_MM256_HERE
 static void make_cluster_list_x86_simd256
 #else
-"error: GMX_MM128_HERE or GMX_MM256_HERE not defined"
+#ifdef GMX_MM512_HERE
+static void make_cluster_list_x86_simd512
+#else
+"error: GMX_MM128_HERE, GMX_MM256_HERE or GMX_MM512_HERE not defined"
+#endif
 #endif
 #endif
                                          (const nbnxn_grid_t *gridj,
@@ -106,22 +137,32 @@ static void make_cluster_list_x86_simd256
 {
 #ifdef GMX_MM128_HERE
     const nbnxn_x_ci_x86_simd128_t *work;
-#else
+#endif
+#ifdef GMX_MM256_HERE
     const nbnxn_x_ci_x86_simd256_t *work;
 #endif
+#ifdef GMX_MM512_HERE
+    const nbnxn_x_ci_x86_simd512_t *work;
+#endif
 
     const float *bb_ci;
 
     gmx_mm_pr  jx_SSE,jy_SSE,jz_SSE;
 
     gmx_mm_pr  dx_SSE0,dy_SSE0,dz_SSE0;
-    gmx_mm_pr  dx_SSE1,dy_SSE1,dz_SSE1;
     gmx_mm_pr  dx_SSE2,dy_SSE2,dz_SSE2;
-    gmx_mm_pr  dx_SSE3,dy_SSE3,dz_SSE3;
 
     gmx_mm_pr  rsq_SSE0;
-    gmx_mm_pr  rsq_SSE1;
     gmx_mm_pr  rsq_SSE2;
+
+#ifdef GMX_MM512_HERE
+    gmx_mm_pb  wco_SSE0;
+    gmx_mm_pb  wco_SSE2;
+#else
+    gmx_mm_pr  dx_SSE1,dy_SSE1,dz_SSE1;
+    gmx_mm_pr  dx_SSE3,dy_SSE3,dz_SSE3;
+
+    gmx_mm_pr  rsq_SSE1;
     gmx_mm_pr  rsq_SSE3;
 
     gmx_mm_pr  wco_SSE0;
@@ -129,6 +170,7 @@ static void make_cluster_list_x86_simd256
     gmx_mm_pr  wco_SSE2;
     gmx_mm_pr  wco_SSE3;
     gmx_mm_pr  wco_any_SSE01,wco_any_SSE23,wco_any_SSE;
+#endif
     
     gmx_mm_pr  rc2_SSE;
 
@@ -141,12 +183,19 @@ static void make_cluster_list_x86_simd256
     cjl = CI_TO_CJ_S128(cjl+1) - 1;
 
     work = nbl->work->x_ci_x86_simd128;
-#else
+#endif
+#ifdef GMX_MM256_HERE
     cjf = CI_TO_CJ_S256(cjf);
     cjl = CI_TO_CJ_S256(cjl+1) - 1;
 
     work = nbl->work->x_ci_x86_simd256;
 #endif
+#ifdef GMX_MM512_HERE
+    cjf = CI_TO_CJ_S512(cjf);
+    cjl = CI_TO_CJ_S512(cjl+1) - 1;
+
+    work = nbl->work->x_ci_x86_simd512;
+#endif
 
     bb_ci = nbl->work->bb_ci;
 
@@ -169,6 +218,14 @@ static void make_cluster_list_x86_simd256
         }
         else if (d2 < rl2)
         {
+#ifdef GMX_MM512_HERE
+            xind_f  = X_IND_CJ_S512(CI_TO_CJ_S512(gridj->cell0) + cjf);
+
+            /* Load the j-cluster in both halves of the registers */
+            jx_SSE  = gmx_load_dup_pr(x_j+xind_f+0*STRIDE_S);
+            jy_SSE  = gmx_load_dup_pr(x_j+xind_f+1*STRIDE_S);
+            jz_SSE  = gmx_load_dup_pr(x_j+xind_f+2*STRIDE_S);
+#else
 #ifdef GMX_MM128_HERE
             xind_f  = X_IND_CJ_S128(CI_TO_CJ_S128(gridj->cell0) + cjf);
 #else
@@ -177,8 +234,29 @@ static void make_cluster_list_x86_simd256
             jx_SSE  = gmx_load_pr(x_j+xind_f+0*STRIDE_S);
             jy_SSE  = gmx_load_pr(x_j+xind_f+1*STRIDE_S);
             jz_SSE  = gmx_load_pr(x_j+xind_f+2*STRIDE_S);
+#endif
 
             
+#ifdef GMX_MM512_HERE
+            /* Calculate distance */
+            dx_SSE0            = gmx_sub_pr(work->ix_SSE0,jx_SSE);
+            dy_SSE0            = gmx_sub_pr(work->iy_SSE0,jy_SSE);
+            dz_SSE0            = gmx_sub_pr(work->iz_SSE0,jz_SSE);
+            dx_SSE2            = gmx_sub_pr(work->ix_SSE2,jx_SSE);
+            dy_SSE2            = gmx_sub_pr(work->iy_SSE2,jy_SSE);
+            dz_SSE2            = gmx_sub_pr(work->iz_SSE2,jz_SSE);
+
+            /* rsq = dx*dx+dy*dy+dz*dz */
+            rsq_SSE0           = gmx_calc_rsq_pr(dx_SSE0,dy_SSE0,dz_SSE0);
+            rsq_SSE2           = gmx_calc_rsq_pr(dx_SSE2,dy_SSE2,dz_SSE2);
+
+            wco_SSE0           = gmx_cmplt_pb(rsq_SSE0,rc2_SSE);
+            wco_SSE2           = gmx_cmplt_pb(rsq_SSE2,rc2_SSE);
+
+            InRange            = ((wco_SSE0 | wco_SSE2) != 0);
+
+            *ndistc += 2*GMX_X86_SIMD_WIDTH_HERE;
+#else
             /* Calculate distance */
             dx_SSE0            = gmx_sub_pr(work->ix_SSE0,jx_SSE);
             dy_SSE0            = gmx_sub_pr(work->iy_SSE0,jy_SSE);
@@ -211,6 +289,7 @@ static void make_cluster_list_x86_simd256
             InRange            = gmx_movemask_pr(wco_any_SSE);
 
             *ndistc += 4*GMX_X86_SIMD_WIDTH_HERE;
+#endif
         }
         if (!InRange)
         {
@@ -239,6 +318,14 @@ static void make_cluster_list_x86_simd256
         }
         else if (d2 < rl2)
         {
+#ifdef GMX_MM512_HERE
+            xind_l  = X_IND_CJ_S512(CI_TO_CJ_S512(gridj->cell0) + cjl);
+
+            /* Load the j-cluster in both halves of the registers */
+            jx_SSE  = gmx_load_dup_pr(x_j+xind_l+0*STRIDE_S);
+            jy_SSE  = gmx_load_dup_pr(x_j+xind_l+1*STRIDE_S);
+            jz_SSE  = gmx_load_dup_pr(x_j+xind_l+2*STRIDE_S);
+#else
 #ifdef GMX_MM128_HERE
             xind_l  = X_IND_CJ_S128(CI_TO_CJ_S128(gridj->cell0) + cjl);
 #else
@@ -247,7 +334,28 @@ static void make_cluster_list_x86_simd256
             jx_SSE  = gmx_load_pr(x_j+xind_l+0*STRIDE_S);
             jy_SSE  = gmx_load_pr(x_j+xind_l+1*STRIDE_S);
             jz_SSE  = gmx_load_pr(x_j+xind_l+2*STRIDE_S);
+#endif
             
+#ifdef GMX_MM512_HERE
+            /* Calculate distance */
+            dx_SSE0            = gmx_sub_pr(work->ix_SSE0,jx_SSE);
+            dy_SSE0            = gmx_sub_pr(work->iy_SSE0,jy_SSE);
+            dz_SSE0            = gmx_sub_pr(work->iz_SSE0,jz_SSE);
+            dx_SSE2            = gmx_sub_pr(work->ix_SSE2,jx_SSE);
+            dy_SSE2            = gmx_sub_pr(work->iy_SSE2,jy_SSE);
+            dz_SSE2            = gmx_sub_pr(work->iz_SSE2,jz_SSE);
+
+            /* rsq = dx*dx+dy*dy+dz*dz */
+            rsq_SSE0           = gmx_calc_rsq_pr(dx_SSE0,dy_SSE0,dz_SSE0);
+            rsq_SSE2           = gmx_calc_rsq_pr(dx_SSE2,dy_SSE2,dz_SSE2);
+
+            wco_SSE0           = gmx_cmplt_pb(rsq_SSE0,rc2_SSE);
+            wco_SSE2           = gmx_cmplt_pb(rsq_SSE2,rc2_SSE);
+
+            InRange            = ((wco_SSE0 | wco_SSE2) != 0);
+
+            *ndistc += 2*GMX_X86_SIMD_WIDTH_HERE;
+#else
             /* Calculate distance */
             dx_SSE0            = gmx_sub_pr(work->ix_SSE0,jx_SSE);
             dy_SSE0            = gmx_sub_pr(work->iy_SSE0,jy_SSE);
@@ -280,6 +388,7 @@ static void make_cluster_list_x86_simd256
             InRange            = gmx_movemask_pr(wco_any_SSE);
 
             *ndistc += 4*GMX_X86_SIMD_WIDTH_HERE;
+#endif
         }
         if (!InRange)
         {
@@ -295,9 +404,14 @@ static void make_cluster_list_x86_simd256
 #ifdef GMX_MM128_HERE
             nbl->cj[nbl->ncj].cj   = CI_TO_CJ_S128(gridj->cell0) + cj;
             nbl->cj[nbl->ncj].excl = get_imask_x86_simd128(remove_sub_diag,ci,cj);
-#else
+#endif
+#ifdef GMX_MM256_HERE
             nbl->cj[nbl->ncj].cj   = CI_TO_CJ_S256(gridj->cell0) + cj;
             nbl->cj[nbl->ncj].excl = get_imask_x86_simd256(remove_sub_diag,ci,cj);
+#endif
+#ifdef GMX_MM512_HERE
+            nbl->cj[nbl->ncj].cj   = CI_TO_CJ_S512(gridj->cell0) + cj;
+            nbl->cj[nbl->ncj].excl = get_imask_x86_simd512(remove_sub_diag,ci,cj);
 #endif
             nbl->ncj++;
         }
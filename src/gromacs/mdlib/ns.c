@@ -191,6 +191,7 @@ void init_neighbor_list(FILE *log,t_forcerec *fr,int homenr)
    int igeometry_def,igeometry_w,igeometry_ww;
    int i;
    t_nblists *nbl;
+   FILE *fplog;
 
    /* maxsr     = homenr-fr->nWatMol*3; */
    maxsr     = homenr;
@@ -244,26 +245,32 @@ void init_neighbor_list(FILE *log,t_forcerec *fr,int homenr)
        igeometry_ww = GMX_NBLIST_GEOMETRY_WATER3_WATER3;
    }
 
-   for(i=0; i<fr->nnblists; i++) 
+   /* Each search thread has its own set of nnblists lists,
+    * we only print the kernel choices for the first set.
+    */
+   for(i=0; i<fr->nnblists*fr->nthread_ns; i++) 
    {
-       nbl = &(fr->nblists[i]);
+       nbl   = &(fr->nblists[i]);
+       fplog = (i < fr->nnblists) ? log : NULL;
 
-       if ((fr->adress_type!=eAdressOff) && (i>=fr->nnblists/2)){
+       type  = GMX_NBLIST_INTERACTION_STANDARD;
+       if ((fr->adress_type!=eAdressOff) &&
+           (i % fr->nnblists >= fr->nnblists/2)){
            type=GMX_NBLIST_INTERACTION_ADRESS;
        }
-       init_nblist(log,&nbl->nlist_sr[eNL_VDWQQ],&nbl->nlist_lr[eNL_VDWQQ],
+       init_nblist(fplog,&nbl->nlist_sr[eNL_VDWQQ],&nbl->nlist_lr[eNL_VDWQQ],
                    maxsr,maxlr,ivdw,ivdwmod,ielec,ielecmod,igeometry_def, type);
-       init_nblist(log,&nbl->nlist_sr[eNL_VDW],&nbl->nlist_lr[eNL_VDW],
+       init_nblist(fplog,&nbl->nlist_sr[eNL_VDW],&nbl->nlist_lr[eNL_VDW],
                    maxsr,maxlr,ivdw,ivdwmod,GMX_NBKERNEL_ELEC_NONE,eintmodNONE,igeometry_def, type);
-       init_nblist(log,&nbl->nlist_sr[eNL_QQ],&nbl->nlist_lr[eNL_QQ],
+       init_nblist(fplog,&nbl->nlist_sr[eNL_QQ],&nbl->nlist_lr[eNL_QQ],
                    maxsr,maxlr,GMX_NBKERNEL_VDW_NONE,eintmodNONE,ielec,ielecmod,igeometry_def, type);
-       init_nblist(log,&nbl->nlist_sr[eNL_VDWQQ_WATER],&nbl->nlist_lr[eNL_VDWQQ_WATER],
+       init_nblist(fplog,&nbl->nlist_sr[eNL_VDWQQ_WATER],&nbl->nlist_lr[eNL_VDWQQ_WATER],
                    maxsr_wat,maxlr_wat,ivdw,ivdwmod,ielec,ielecmod, igeometry_w, type);
-       init_nblist(log,&nbl->nlist_sr[eNL_QQ_WATER],&nbl->nlist_lr[eNL_QQ_WATER],
+       init_nblist(fplog,&nbl->nlist_sr[eNL_QQ_WATER],&nbl->nlist_lr[eNL_QQ_WATER],
                    maxsr_wat,maxlr_wat,GMX_NBKERNEL_VDW_NONE,eintmodNONE,ielec,ielecmod, igeometry_w, type);
-       init_nblist(log,&nbl->nlist_sr[eNL_VDWQQ_WATERWATER],&nbl->nlist_lr[eNL_VDWQQ_WATERWATER],
+       init_nblist(fplog,&nbl->nlist_sr[eNL_VDWQQ_WATERWATER],&nbl->nlist_lr[eNL_VDWQQ_WATERWATER],
                    maxsr_wat,maxlr_wat,ivdw,ivdwmod,ielec,ielecmod, igeometry_ww, type);
-       init_nblist(log,&nbl->nlist_sr[eNL_QQ_WATERWATER],&nbl->nlist_lr[eNL_QQ_WATERWATER],
+       init_nblist(fplog,&nbl->nlist_sr[eNL_QQ_WATERWATER],&nbl->nlist_lr[eNL_QQ_WATERWATER],
                    maxsr_wat,maxlr_wat,GMX_NBKERNEL_VDW_NONE,eintmodNONE,ielec,ielecmod, igeometry_ww, type);
 
        /* Did we get the solvent loops so we can use optimized water kernels? */
@@ -276,7 +283,10 @@ void init_neighbor_list(FILE *log,t_forcerec *fr,int homenr)
           )
        {
            fr->solvent_opt = esolNO;
-           fprintf(log,"Note: The available nonbonded kernels do not support water optimization - disabling.\n");
+           if (fplog != NULL)
+           {
+               fprintf(fplog,"Note: The available nonbonded kernels do not support water optimization - disabling.\n");
+           }
        }
        
        if (fr->efep != efepNO) 
@@ -292,11 +302,11 @@ void init_neighbor_list(FILE *log,t_forcerec *fr,int homenr)
                ielecmodf = ielecmod;
            }
 
-           init_nblist(log,&nbl->nlist_sr[eNL_VDWQQ_FREE],&nbl->nlist_lr[eNL_VDWQQ_FREE],
+           init_nblist(fplog,&nbl->nlist_sr[eNL_VDWQQ_FREE],&nbl->nlist_lr[eNL_VDWQQ_FREE],
                        maxsr,maxlr,ivdw,ivdwmod,ielecf,ielecmod,GMX_NBLIST_GEOMETRY_PARTICLE_PARTICLE, GMX_NBLIST_INTERACTION_FREE_ENERGY);
-           init_nblist(log,&nbl->nlist_sr[eNL_VDW_FREE],&nbl->nlist_lr[eNL_VDW_FREE],
+           init_nblist(fplog,&nbl->nlist_sr[eNL_VDW_FREE],&nbl->nlist_lr[eNL_VDW_FREE],
                        maxsr,maxlr,ivdw,ivdwmod,GMX_NBKERNEL_ELEC_NONE,eintmodNONE,GMX_NBLIST_GEOMETRY_PARTICLE_PARTICLE, GMX_NBLIST_INTERACTION_FREE_ENERGY);
-           init_nblist(log,&nbl->nlist_sr[eNL_QQ_FREE],&nbl->nlist_lr[eNL_QQ_FREE],
+           init_nblist(fplog,&nbl->nlist_sr[eNL_QQ_FREE],&nbl->nlist_lr[eNL_QQ_FREE],
                        maxsr,maxlr,GMX_NBKERNEL_VDW_NONE,eintmodNONE,ielecf,ielecmod,GMX_NBLIST_GEOMETRY_PARTICLE_PARTICLE, GMX_NBLIST_INTERACTION_FREE_ENERGY);
        }  
    }
@@ -336,7 +346,7 @@ static void reset_neighbor_lists(t_forcerec *fr,gmx_bool bResetSR, gmx_bool bRes
         reset_nblist(&(fr->QMMMlist));
     }
 
-    for(n=0; n<fr->nnblists; n++)
+    for(n=0; n<fr->nnblists*fr->nthread_ns; n++)
     {
         for(i=0; i<eNL_NR; i++)
         {
@@ -453,7 +463,7 @@ static inline void close_neighbor_lists(t_forcerec *fr,gmx_bool bMakeQMMMnblist)
             close_nblist(&(fr->QMMMlist));
     }
 
-    for(n=0; n<fr->nnblists; n++)
+    for(n=0; n<fr->nnblists*fr->nthread_ns; n++)
     {
         for(i=0; (i<eNL_NR); i++)
         {
@@ -540,6 +550,7 @@ put_in_list_t(gmx_bool              bHaveVdW[],
               t_excl            bExcl[],
               int               shift,
               t_forcerec *      fr,
+              t_nblists *       nblists,
               gmx_bool          bLR,
               gmx_bool          bDoVdW,
               gmx_bool          bDoCoul,
@@ -557,6 +568,7 @@ put_in_list_at(gmx_bool              bHaveVdW[],
                t_excl            bExcl[],
                int               shift,
                t_forcerec *      fr,
+               t_nblists *       nblists,
                gmx_bool          bLR,
                gmx_bool          bDoVdW,
                gmx_bool          bDoCoul,
@@ -640,11 +652,11 @@ put_in_list_at(gmx_bool              bHaveVdW[],
     }
     if (bLR)
     {
-        nlist = fr->nblists[nbl_ind].nlist_lr;
+        nlist = nblists[nbl_ind].nlist_lr;
     }
     else
     {
-        nlist = fr->nblists[nbl_ind].nlist_sr;
+        nlist = nblists[nbl_ind].nlist_sr;
     }
     
     if (iwater != esolNO)
@@ -1096,6 +1108,7 @@ put_in_list_adress(gmx_bool              bHaveVdW[],
                t_excl            bExcl[],
                int               shift,
                t_forcerec *      fr,
+               t_nblists *       nblists,
                gmx_bool          bLR,
                gmx_bool          bDoVdW,
                gmx_bool          bDoCoul,
@@ -1165,13 +1178,13 @@ put_in_list_adress(gmx_bool              bHaveVdW[],
     }
     if (bLR)
     {
-        nlist = fr->nblists[nbl_ind].nlist_lr;
-        nlist_adress= fr->nblists[nbl_ind_adress].nlist_lr;
+        nlist = nblists[nbl_ind].nlist_lr;
+        nlist_adress= nblists[nbl_ind_adress].nlist_lr;
     }
     else
     {
-        nlist = fr->nblists[nbl_ind].nlist_sr;
-        nlist_adress = fr->nblists[nbl_ind_adress].nlist_sr;
+        nlist = nblists[nbl_ind].nlist_sr;
+        nlist_adress = nblists[nbl_ind_adress].nlist_sr;
     }
 
 
@@ -1322,6 +1335,7 @@ put_in_list_qmmm(gmx_bool              bHaveVdW[],
                  t_excl            bExcl[],
                  int               shift,
                  t_forcerec *      fr,
+                 t_nblists *       nblists,
                  gmx_bool          bLR,
                  gmx_bool          bDoVdW,
                  gmx_bool          bDoCoul,
@@ -1385,6 +1399,7 @@ put_in_list_cg(gmx_bool              bHaveVdW[],
                t_excl            bExcl[],
                int               shift,
                t_forcerec *      fr,
+               t_nblists *       nblists,
                gmx_bool          bLR,
                gmx_bool          bDoVdW,
                gmx_bool          bDoCoul,
@@ -1411,11 +1426,11 @@ put_in_list_cg(gmx_bool              bHaveVdW[],
     }
     if (bLR)
     {
-        vdwc = &fr->nblists[nbl_ind].nlist_lr[eNL_VDWQQ];
+        vdwc = &nblists[nbl_ind].nlist_lr[eNL_VDWQQ];
     }
     else
     {
-        vdwc = &fr->nblists[nbl_ind].nlist_sr[eNL_VDWQQ];
+        vdwc = &nblists[nbl_ind].nlist_sr[eNL_VDWQQ];
     }
 
     /* Make a new neighbor list for charge group icg.
@@ -1616,7 +1631,8 @@ static void add_simple(t_ns_buf *nsbuf,int nrj,atom_id cg_j,
     if (nsbuf->nj + nrj > MAX_CG)
     {
         put_in_list(bHaveVdW,ngid,md,icg,jgid,nsbuf->ncg,nsbuf->jcg,
-                    cgs->index,bexcl,shift,fr,FALSE,TRUE,TRUE,fr->solvent_opt);
+                    cgs->index,bexcl,shift,fr,fr->nblists,
+                    FALSE,TRUE,TRUE,fr->solvent_opt);
         /* Reset buffer contents */
         nsbuf->ncg = nsbuf->nj = 0;
     }
@@ -1788,7 +1804,8 @@ static int ns_simple_core(t_forcerec *fr,
                 if (nsbuf->ncg > 0)
                 {
                     put_in_list(bHaveVdW,ngid,md,icg,nn,nsbuf->ncg,nsbuf->jcg,
-                                cgs->index,bexcl,k,fr,FALSE,TRUE,TRUE,fr->solvent_opt);
+                                cgs->index,bexcl,k,fr,fr->nblists,
+                                FALSE,TRUE,TRUE,fr->solvent_opt);
                     nsbuf->ncg=nsbuf->nj=0;
                 }
             }
@@ -2001,27 +2018,33 @@ static void get_cutoff2(t_forcerec *fr,gmx_bool bDoLongRange,
 static void init_nsgrid_lists(t_forcerec *fr,int ngid,gmx_ns_t *ns)
 {
     real rvdw2,rcoul2,rs2,rm2,rl2;
-    int j;
+    gmx_ns_thread_t *nsth;
+    int j,th;
 
     get_cutoff2(fr,TRUE,&rvdw2,&rcoul2,&rs2,&rm2,&rl2);
 
-    /* Short range buffers */
-    snew(ns->nl_sr,ngid);
-    /* Counters */
-    snew(ns->nsr,ngid);
-    snew(ns->nlr_ljc,ngid);
-    snew(ns->nlr_one,ngid);
-    
-    /* Always allocate both list types, since rcoulomb might now change with PME load balancing */
-    /* Long range VdW and Coul buffers */
-    snew(ns->nl_lr_ljc,ngid);
-    /* Long range VdW or Coul only buffers */
-    snew(ns->nl_lr_one,ngid);
+    for(th=0; th<ns->nthread; th++)
+    {
+        nsth = &ns->th[th];
+
+        /* Short range buffers */
+        snew(nsth->nl_sr,ngid);
+        /* Counters */
+        snew(nsth->nsr,ngid);
+        snew(nsth->nlr_ljc,ngid);
+        snew(nsth->nlr_one,ngid);
 
-    for(j=0; (j<ngid); j++) {
-        snew(ns->nl_sr[j],MAX_CG);
-        snew(ns->nl_lr_ljc[j],MAX_CG);
-        snew(ns->nl_lr_one[j],MAX_CG);
+        /* Always allocate both list types, since rcoulomb might now change with PME load balancing */
+        /* Long range VdW and Coul buffers */
+        snew(nsth->nl_lr_ljc,ngid);
+        /* Long range VdW or Coul only buffers */
+        snew(nsth->nl_lr_one,ngid);
+
+        for(j=0; (j<ngid); j++) {
+            snew(nsth->nl_sr[j],MAX_CG);
+            snew(nsth->nl_lr_ljc[j],MAX_CG);
+            snew(nsth->nl_lr_one[j],MAX_CG);
+        }
     }
     if (debug)
     {
@@ -2035,7 +2058,7 @@ static int nsgrid_core(FILE *log,t_commrec *cr,t_forcerec *fr,
                        matrix box,rvec box_size,int ngid,
                        gmx_localtop_t *top,
                        t_grid *grid,rvec x[],
-                       t_excl bexcl[],gmx_bool *bExcludeAlleg,
+                       gmx_bool *bExcludeAlleg,
                        t_nrnb *nrnb,t_mdatoms *md,
                        real *lambda,real *dvdlambda,
                        gmx_grppairener_t *grppener,
@@ -2044,32 +2067,25 @@ static int nsgrid_core(FILE *log,t_commrec *cr,t_forcerec *fr,
                        gmx_bool bDoLongRange,gmx_bool bMakeQMMMnblist)
 {
     gmx_ns_t *ns;
-    atom_id **nl_lr_ljc,**nl_lr_one,**nl_sr;
-    int     *nlr_ljc,*nlr_one,*nsr;
     gmx_domdec_t *dd=NULL;
     t_block *cgs=&(top->cgs);
     int     *cginfo=fr->cginfo;
     /* atom_id *i_atoms,*cgsindex=cgs->index; */
-    ivec    sh0,sh1,shp;
-    int     cell_x,cell_y,cell_z;
-    int     d,tx,ty,tz,dx,dy,dz,cj;
+    ivec    shp;
+    int     d;
 #ifdef ALLOW_OFFDIAG_LT_HALFDIAG
     int     zsh_ty,zsh_tx,ysh_tx;
 #endif
-    int     dx0,dx1,dy0,dy1,dz0,dz1;
-    int     Nx,Ny,Nz,shift=-1,j,nrj,nns,nn=-1;
+    int     Nx,Ny,Nz,nns;
     real    gridx,gridy,gridz,grid_x,grid_y,grid_z;
-    real    *dcx2,*dcy2,*dcz2;
-    int     zgi,ygi,xgi;
-    int     cg0,cg1,icg=-1,cgsnr,i0,igid,nri,naaj,max_jcg;
-    int     jcg0,jcg1,jjcg,cgj0,jgid;
+    int     cg0,cg1,cgsnr;
     int     *grida,*gridnra,*gridind;
     gmx_bool    rvdw_lt_rcoul,rcoul_lt_rvdw;
-    rvec    xi,*cgcm,grid_offset;
-    real    r2,rs2,rvdw2,rcoul2,rm2,rl2,XI,YI,ZI,dcx,dcy,dcz,tmp1,tmp2;
-    int     *i_egp_flags;
+    rvec    *cgcm,grid_offset;
+    real    rs2,rvdw2,rcoul2,rm2,rl2;
     gmx_bool    bDomDec,bTriclinicX,bTriclinicY;
     ivec    ncpddc;
+    int     nthread,th;
     
     ns = &fr->ns;
     
@@ -2099,13 +2115,6 @@ static int nsgrid_core(FILE *log,t_commrec *cr,t_forcerec *fr,
         rs2 = rl2;
     }
 
-    nl_sr     = ns->nl_sr;
-    nsr       = ns->nsr;
-    nl_lr_ljc = ns->nl_lr_ljc;
-    nl_lr_one = ns->nl_lr_one;
-    nlr_ljc   = ns->nlr_ljc;
-    nlr_one   = ns->nlr_one;
-    
     /* Unpack arrays */
     cgcm    = fr->cg_cm;
     Nx      = grid->n[XX];
@@ -2124,9 +2133,6 @@ static int nsgrid_core(FILE *log,t_commrec *cr,t_forcerec *fr,
     grid_z     = 1/gridz;
     copy_rvec(grid->cell_offset,grid_offset);
     copy_ivec(grid->ncpddc,ncpddc);
-    dcx2       = grid->dcx2;
-    dcy2       = grid->dcy2;
-    dcz2       = grid->dcz2;
     
 #ifdef ALLOW_OFFDIAG_LT_HALFDIAG
     zsh_ty = floor(-box[ZZ][YY]/box[YY][YY]+0.5);
@@ -2155,8 +2161,6 @@ static int nsgrid_core(FILE *log,t_commrec *cr,t_forcerec *fr,
     /* Set the shift range */
     for(d=0; d<DIM; d++)
     {
-        sh0[d] = -1;
-        sh1[d] = 1;
         /* Check if we need periodicity shifts.
          * Without PBC or with domain decomposition we don't need them.
          */
@@ -2178,291 +2182,351 @@ static int nsgrid_core(FILE *log,t_commrec *cr,t_forcerec *fr,
         }
     }
     
-    /* Loop over charge groups */
-    for(icg=cg0; (icg < cg1); icg++)
-    {
-        igid = GET_CGINFO_GID(cginfo[icg]);
-        /* Skip this charge group if all energy groups are excluded! */
-        if (bExcludeAlleg[igid])
+    /* The QM/MM list is a single list, which we generate serially */
+    nthread = (bMakeQMMMnblist ? 1 : fr->nthread_ns);
+
+    /* Each thread searches a contiguous range of i-charge groups
+     * and puts the pairs in its own set of neighbor lists.
+     */
+#pragma omp parallel for num_threads(nthread) schedule(static) reduction(+:nns)
+    for(th=0; th<nthread; th++)
+    {
+        gmx_ns_thread_t *nsth;
+        t_nblists *nblists;
+        t_excl  *bexcl;
+        atom_id **nl_lr_ljc,**nl_lr_one,**nl_sr;
+        int     *nlr_ljc,*nlr_one,*nsr;
+        real    *dcx2,*dcy2,*dcz2;
+        ivec    sh0,sh1;
+        int     cell_x,cell_y,cell_z;
+        int     d,tx,ty,tz,dx,dy,dz,cj;
+        int     dx0,dx1,dy0,dy1,dz0,dz1;
+        int     shift,j,nrj,nn;
+        int     zgi,ygi,xgi;
+        int     icg,icg0,icg1,i0,igid,naaj,max_jcg;
+        int     jcg0,jcg1,jjcg,cgj0,jgid;
+        real    r2,XI,YI,ZI,tmp1,tmp2;
+        int     *i_egp_flags;
+
+        nsth      = &ns->th[th];
+        nblists   = fr->nblists + th*fr->nnblists;
+        bexcl     = nsth->bexcl;
+        nl_sr     = nsth->nl_sr;
+        nsr       = nsth->nsr;
+        nl_lr_ljc = nsth->nl_lr_ljc;
+        nl_lr_one = nsth->nl_lr_one;
+        nlr_ljc   = nsth->nlr_ljc;
+        nlr_one   = nsth->nlr_one;
+
+        if (grid->dc_nalloc > nsth->dc_nalloc)
+        {
+            nsth->dc_nalloc = grid->dc_nalloc;
+            srenew(nsth->dcx2,nsth->dc_nalloc);
+            srenew(nsth->dcy2,nsth->dc_nalloc);
+            srenew(nsth->dcz2,nsth->dc_nalloc);
+        }
+        dcx2      = nsth->dcx2;
+        dcy2      = nsth->dcy2;
+        dcz2      = nsth->dcz2;
+
+        /* Without domain decomposition the cell shift range is fixed,
+         * with DD dd_get_ns_ranges sets it for each i-charge group.
+         */
+        for(d=0; d<DIM; d++)
         {
-            continue;
+            sh0[d] = -1;
+            sh1[d] = 1;
         }
-        
-        i0   = cgs->index[icg];
-        
-        if (bMakeQMMMnblist)
-        { 
-            /* Skip this charge group if it is not a QM atom while making a
-             * QM/MM neighbourlist
-             */
-            if (md->bQM[i0]==FALSE)
+
+        icg0 = cg0 + ((cg1 - cg0)*th    )/nthread;
+        icg1 = cg0 + ((cg1 - cg0)*(th+1))/nthread;
+
+        /* Loop over charge groups */
+        for(icg=icg0; (icg < icg1); icg++)
+        {
+            igid = GET_CGINFO_GID(cginfo[icg]);
+            /* Skip this charge group if all energy groups are excluded! */
+            if (bExcludeAlleg[igid])
             {
-                continue; /* MM particle, go to next particle */ 
+                continue;
             }
+        
+            i0   = cgs->index[icg];
+        
+            if (bMakeQMMMnblist)
+            { 
+                /* Skip this charge group if it is not a QM atom while making a
+                 * QM/MM neighbourlist
+                 */
+                if (md->bQM[i0]==FALSE)
+                {
+                    continue; /* MM particle, go to next particle */ 
+                }
             
-            /* Compute the number of charge groups that fall within the control
-             * of this one (icg)
-             */
-            naaj    = calc_naaj(icg,cgsnr);
-            jcg0    = icg;
-            jcg1    = icg + naaj;
-            max_jcg = cgsnr;       
-        } 
-        else
-        { 
-            /* make a normal neighbourlist */
-            
-            if (bDomDec)
-            {
-                /* Get the j charge-group and dd cell shift ranges */
-                dd_get_ns_ranges(cr->dd,icg,&jcg0,&jcg1,sh0,sh1);
-                max_jcg = 0;
-            }
-            else
-            {
                 /* Compute the number of charge groups that fall within the control
                  * of this one (icg)
                  */
-                naaj = calc_naaj(icg,cgsnr);
-                jcg0 = icg;
-                jcg1 = icg + naaj;
-                
-                if (fr->n_tpi)
+                naaj    = calc_naaj(icg,cgsnr);
+                jcg0    = icg;
+                jcg1    = icg + naaj;
+                max_jcg = cgsnr;       
+            } 
+            else
+            { 
+                /* make a normal neighbourlist */
+            
+                if (bDomDec)
                 {
-                    /* The i-particle is awlways the test particle,
-                     * so we want all j-particles
-                     */
-                    max_jcg = cgsnr - 1;
+                    /* Get the j charge-group and dd cell shift ranges */
+                    dd_get_ns_ranges(cr->dd,icg,&jcg0,&jcg1,sh0,sh1);
+                    max_jcg = 0;
                 }
                 else
                 {
-                    max_jcg  = jcg1 - cgsnr;
+                    /* Compute the number of charge groups that fall within the control
+                     * of this one (icg)
+                     */
+                    naaj = calc_naaj(icg,cgsnr);
+                    jcg0 = icg;
+                    jcg1 = icg + naaj;
+                
+                    if (fr->n_tpi)
+                    {
+                        /* The i-particle is awlways the test particle,
+                         * so we want all j-particles
+                         */
+                        max_jcg = cgsnr - 1;
+                    }
+                    else
+                    {
+                        max_jcg  = jcg1 - cgsnr;
+                    }
                 }
             }
-        }
         
-        i_egp_flags = fr->egp_flags + igid*ngid;
+            i_egp_flags = fr->egp_flags + igid*ngid;
         
-        /* Set the exclusions for the atoms in charge group icg using a bitmask */
-        setexcl(i0,cgs->index[icg+1],&top->excls,TRUE,bexcl);
+            /* Set the exclusions for the atoms in charge group icg using a bitmask */
+            setexcl(i0,cgs->index[icg+1],&top->excls,TRUE,bexcl);
         
-        ci2xyz(grid,icg,&cell_x,&cell_y,&cell_z);
+            ci2xyz(grid,icg,&cell_x,&cell_y,&cell_z);
         
-        /* Changed iicg to icg, DvdS 990115 
-         * (but see consistency check above, DvdS 990330) 
-         */
+            /* Changed iicg to icg, DvdS 990115 
+             * (but see consistency check above, DvdS 990330) 
+             */
 #ifdef NS5DB
-        fprintf(log,"icg=%5d, naaj=%5d, cell %d %d %d\n",
-                icg,naaj,cell_x,cell_y,cell_z);
-#endif
-        /* Loop over shift vectors in three dimensions */
-        for (tz=-shp[ZZ]; tz<=shp[ZZ]; tz++)
-        {
-            ZI = cgcm[icg][ZZ]+tz*box[ZZ][ZZ];
-            /* Calculate range of cells in Z direction that have the shift tz */
-            zgi = cell_z + tz*Nz;
-#define FAST_DD_NS
-#ifndef FAST_DD_NS
-            get_dx(Nz,gridz,rl2,zgi,ZI,&dz0,&dz1,dcz2);
-#else
-            get_dx_dd(Nz,gridz,rl2,zgi,ZI-grid_offset[ZZ],
-                      ncpddc[ZZ],sh0[ZZ],sh1[ZZ],&dz0,&dz1,dcz2);
+            fprintf(log,"icg=%5d, naaj=%5d, cell %d %d %d\n",
+                    icg,naaj,cell_x,cell_y,cell_z);
 #endif
-            if (dz0 > dz1)
+            /* Loop over shift vectors in three dimensions */
+            for (tz=-shp[ZZ]; tz<=shp[ZZ]; tz++)
             {
-                continue;
-            }
-            for (ty=-shp[YY]; ty<=shp[YY]; ty++)
-            {
-                YI = cgcm[icg][YY]+ty*box[YY][YY]+tz*box[ZZ][YY];
-                /* Calculate range of cells in Y direction that have the shift ty */
-                if (bTriclinicY)
-                {
-                    ygi = (int)(Ny + (YI - grid_offset[YY])*grid_y) - Ny;
-                }
-                else
-                {
-                    ygi = cell_y + ty*Ny;
-                }
+                ZI = cgcm[icg][ZZ]+tz*box[ZZ][ZZ];
+                /* Calculate range of cells in Z direction that have the shift tz */
+                zgi = cell_z + tz*Nz;
+#define FAST_DD_NS
 #ifndef FAST_DD_NS
-                get_dx(Ny,gridy,rl2,ygi,YI,&dy0,&dy1,dcy2);
+                get_dx(Nz,gridz,rl2,zgi,ZI,&dz0,&dz1,dcz2);
 #else
-                get_dx_dd(Ny,gridy,rl2,ygi,YI-grid_offset[YY],
-                          ncpddc[YY],sh0[YY],sh1[YY],&dy0,&dy1,dcy2);
+                get_dx_dd(Nz,gridz,rl2,zgi,ZI-grid_offset[ZZ],
+                          ncpddc[ZZ],sh0[ZZ],sh1[ZZ],&dz0,&dz1,dcz2);
 #endif
-                if (dy0 > dy1)
+                if (dz0 > dz1)
                 {
                     continue;
                 }
-                for (tx=-shp[XX]; tx<=shp[XX]; tx++)
+                for (ty=-shp[YY]; ty<=shp[YY]; ty++)
                 {
-                    XI = cgcm[icg][XX]+tx*box[XX][XX]+ty*box[YY][XX]+tz*box[ZZ][XX];
-                    /* Calculate range of cells in X direction that have the shift tx */
-                    if (bTriclinicX)
+                    YI = cgcm[icg][YY]+ty*box[YY][YY]+tz*box[ZZ][YY];
+                    /* Calculate range of cells in Y direction that have the shift ty */
+                    if (bTriclinicY)
                     {
-                        xgi = (int)(Nx + (XI - grid_offset[XX])*grid_x) - Nx;
+                        ygi = (int)(Ny + (YI - grid_offset[YY])*grid_y) - Ny;
                     }
                     else
                     {
-                        xgi = cell_x + tx*Nx;
+                        ygi = cell_y + ty*Ny;
                     }
 #ifndef FAST_DD_NS
-                    get_dx(Nx,gridx,rl2,xgi*Nx,XI,&dx0,&dx1,dcx2);
+                    get_dx(Ny,gridy,rl2,ygi,YI,&dy0,&dy1,dcy2);
 #else
-                    get_dx_dd(Nx,gridx,rl2,xgi,XI-grid_offset[XX],
-                              ncpddc[XX],sh0[XX],sh1[XX],&dx0,&dx1,dcx2);
+                    get_dx_dd(Ny,gridy,rl2,ygi,YI-grid_offset[YY],
+                              ncpddc[YY],sh0[YY],sh1[YY],&dy0,&dy1,dcy2);
 #endif
-                    if (dx0 > dx1)
+                    if (dy0 > dy1)
                     {
                         continue;
                     }
-                    /* Adress: an explicit cg that has a weigthing function of 0 is excluded
-                     *  from the neigbour list as it will not interact  */
-                    if (fr->adress_type != eAdressOff){
-                        if (md->wf[cgs->index[icg]]==0 && egp_explicit(fr, igid)){
+                    for (tx=-shp[XX]; tx<=shp[XX]; tx++)
+                    {
+                        XI = cgcm[icg][XX]+tx*box[XX][XX]+ty*box[YY][XX]+tz*box[ZZ][XX];
+                        /* Calculate range of cells in X direction that have the shift tx */
+                        if (bTriclinicX)
+                        {
+                            xgi = (int)(Nx + (XI - grid_offset[XX])*grid_x) - Nx;
+                        }
+                        else
+                        {
+                            xgi = cell_x + tx*Nx;
+                        }
+#ifndef FAST_DD_NS
+                        get_dx(Nx,gridx,rl2,xgi*Nx,XI,&dx0,&dx1,dcx2);
+#else
+                        get_dx_dd(Nx,gridx,rl2,xgi,XI-grid_offset[XX],
+                                  ncpddc[XX],sh0[XX],sh1[XX],&dx0,&dx1,dcx2);
+#endif
+                        if (dx0 > dx1)
+                        {
                             continue;
                         }
-                    }
-                    /* Get shift vector */	  
-                    shift=XYZ2IS(tx,ty,tz);
+                        /* Adress: an explicit cg that has a weigthing function of 0 is excluded
+                         *  from the neigbour list as it will not interact  */
+                        if (fr->adress_type != eAdressOff){
+                            if (md->wf[cgs->index[icg]]==0 && egp_explicit(fr, igid)){
+                                continue;
+                            }
+                        }
+                        /* Get shift vector */	  
+                        shift=XYZ2IS(tx,ty,tz);
 #ifdef NS5DB
-                    range_check(shift,0,SHIFTS);
+                        range_check(shift,0,SHIFTS);
 #endif
-                    for(nn=0; (nn<ngid); nn++)
-                    {
-                        nsr[nn]      = 0;
-                        nlr_ljc[nn]  = 0;
-                        nlr_one[nn] = 0;
-                    }
+                        for(nn=0; (nn<ngid); nn++)
+                        {
+                            nsr[nn]      = 0;
+                            nlr_ljc[nn]  = 0;
+                            nlr_one[nn] = 0;
+                        }
 #ifdef NS5DB
-                    fprintf(log,"shift: %2d, dx0,1: %2d,%2d, dy0,1: %2d,%2d, dz0,1: %2d,%2d\n",
-                            shift,dx0,dx1,dy0,dy1,dz0,dz1);
-                    fprintf(log,"cgcm: %8.3f  %8.3f  %8.3f\n",cgcm[icg][XX],
-                            cgcm[icg][YY],cgcm[icg][ZZ]);
-                    fprintf(log,"xi:   %8.3f  %8.3f  %8.3f\n",XI,YI,ZI);
+                        fprintf(log,"shift: %2d, dx0,1: %2d,%2d, dy0,1: %2d,%2d, dz0,1: %2d,%2d\n",
+                                shift,dx0,dx1,dy0,dy1,dz0,dz1);
+                        fprintf(log,"cgcm: %8.3f  %8.3f  %8.3f\n",cgcm[icg][XX],
+                                cgcm[icg][YY],cgcm[icg][ZZ]);
+                        fprintf(log,"xi:   %8.3f  %8.3f  %8.3f\n",XI,YI,ZI);
 #endif
-                    for (dx=dx0; (dx<=dx1); dx++)
-                    {
-                        tmp1 = rl2 - dcx2[dx];
-                        for (dy=dy0; (dy<=dy1); dy++)
+                        for (dx=dx0; (dx<=dx1); dx++)
                         {
-                            tmp2 = tmp1 - dcy2[dy];
-                            if (tmp2 > 0)
+                            tmp1 = rl2 - dcx2[dx];
+                            for (dy=dy0; (dy<=dy1); dy++)
                             {
-                                for (dz=dz0; (dz<=dz1); dz++) {
-                                    if (tmp2 > dcz2[dz]) {
-                                        /* Find grid-cell cj in which possible neighbours are */
-                                        cj   = xyz2ci(Ny,Nz,dx,dy,dz);
+                                tmp2 = tmp1 - dcy2[dy];
+                                if (tmp2 > 0)
+                                {
+                                    for (dz=dz0; (dz<=dz1); dz++) {
+                                        if (tmp2 > dcz2[dz]) {
+                                            /* Find grid-cell cj in which possible neighbours are */
+                                            cj   = xyz2ci(Ny,Nz,dx,dy,dz);
                                         
-                                        /* Check out how many cgs (nrj) there in this cell */
-                                        nrj  = gridnra[cj];
+                                            /* Check out how many cgs (nrj) there in this cell */
+                                            nrj  = gridnra[cj];
                                         
-                                        /* Find the offset in the cg list */
-                                        cgj0 = gridind[cj];
+                                            /* Find the offset in the cg list */
+                                            cgj0 = gridind[cj];
                                         
-                                        /* Check if all j's are out of range so we
-                                         * can skip the whole cell.
-                                         * Should save some time, especially with DD.
-                                         */
-                                        if (nrj == 0 ||
-                                            (grida[cgj0] >= max_jcg &&
-                                             (grida[cgj0] >= jcg1 || grida[cgj0+nrj-1] < jcg0)))
-                                        {
-                                            continue;
-                                        }
+                                            /* Check if all j's are out of range so we
+                                             * can skip the whole cell.
+                                             * Should save some time, especially with DD.
+                                             */
+                                            if (nrj == 0 ||
+                                                (grida[cgj0] >= max_jcg &&
+                                                 (grida[cgj0] >= jcg1 || grida[cgj0+nrj-1] < jcg0)))
+                                            {
+                                                continue;
+                                            }
                                         
-                                        /* Loop over cgs */
-                                        for (j=0; (j<nrj); j++)
-                                        {
-                                            jjcg = grida[cgj0+j];
-                                            
-                                            /* check whether this guy is in range! */
-                                            if ((jjcg >= jcg0 && jjcg < jcg1) ||
-                                                (jjcg < max_jcg))
+                                            /* Loop over cgs */
+                                            for (j=0; (j<nrj); j++)
                                             {
-                                                r2=calc_dx2(XI,YI,ZI,cgcm[jjcg]);
-                                                if (r2 < rl2) {
-                                                    /* jgid = gid[cgsatoms[cgsindex[jjcg]]]; */
-                                                    jgid = GET_CGINFO_GID(cginfo[jjcg]);
-                                                    /* check energy group exclusions */
-                                                    if (!(i_egp_flags[jgid] & EGP_EXCL))
-                                                    {
-                                                        if (r2 < rs2)
+                                                jjcg = grida[cgj0+j];
+                                            
+                                                /* check whether this guy is in range! */
+                                                if ((jjcg >= jcg0 && jjcg < jcg1) ||
+                                                    (jjcg < max_jcg))
+                                                {
+                                                    r2=calc_dx2(XI,YI,ZI,cgcm[jjcg]);
+                                                    if (r2 < rl2) {
+                                                        /* jgid = gid[cgsatoms[cgsindex[jjcg]]]; */
+                                                        jgid = GET_CGINFO_GID(cginfo[jjcg]);
+                                                        /* check energy group exclusions */
+                                                        if (!(i_egp_flags[jgid] & EGP_EXCL))
                                                         {
-                                                            if (nsr[jgid] >= MAX_CG)
+                                                            if (r2 < rs2)
                                                             {
-                                                                /* Add to short-range list */
-                                                                put_in_list(bHaveVdW,ngid,md,icg,jgid,
-                                                                            nsr[jgid],nl_sr[jgid],
-                                                                            cgs->index,/* cgsatoms, */ bexcl,
-                                                                            shift,fr,FALSE,TRUE,TRUE,fr->solvent_opt);
-                                                                nsr[jgid]=0;
-                                                            }
-                                                            nl_sr[jgid][nsr[jgid]++]=jjcg;
-                                                        } 
-                                                        else if (r2 < rm2)
-                                                        {
-                                                            if (nlr_ljc[jgid] >= MAX_CG)
+                                                                if (nsr[jgid] >= MAX_CG)
+                                                                {
+                                                                    /* Add to short-range list */
+                                                                    put_in_list(bHaveVdW,ngid,md,icg,jgid,
+                                                                                nsr[jgid],nl_sr[jgid],
+                                                                                cgs->index,/* cgsatoms, */ bexcl,
+                                                                                shift,fr,nblists,FALSE,TRUE,TRUE,fr->solvent_opt);
+                                                                    nsr[jgid]=0;
+                                                                }
+                                                                nl_sr[jgid][nsr[jgid]++]=jjcg;
+                                                            } 
+                                                            else if (r2 < rm2)
                                                             {
-                                                                /* Add to LJ+coulomb long-range list */
-                                                                put_in_list(bHaveVdW,ngid,md,icg,jgid,
-                                                                            nlr_ljc[jgid],nl_lr_ljc[jgid],top->cgs.index,
-                                                                            bexcl,shift,fr,TRUE,TRUE,TRUE,fr->solvent_opt);
-                                                                nlr_ljc[jgid]=0;
+                                                                if (nlr_ljc[jgid] >= MAX_CG)
+                                                                {
+                                                                    /* Add to LJ+coulomb long-range list */
+                                                                    put_in_list(bHaveVdW,ngid,md,icg,jgid,
+                                                                                nlr_ljc[jgid],nl_lr_ljc[jgid],top->cgs.index,
+                                                                                bexcl,shift,fr,nblists,TRUE,TRUE,TRUE,fr->solvent_opt);
+                                                                    nlr_ljc[jgid]=0;
+                                                                }
+                                                                nl_lr_ljc[jgid][nlr_ljc[jgid]++]=jjcg;
                                                             }
-                                                            nl_lr_ljc[jgid][nlr_ljc[jgid]++]=jjcg;
-                                                        }
-                                                        else
-                                                        {
-                                                            if (nlr_one[jgid] >= MAX_CG)
+                                                            else
                                                             {
-                                                                /* Add to long-range list with only coul, or only LJ */
-                                                                put_in_list(bHaveVdW,ngid,md,icg,jgid,
-                                                                            nlr_one[jgid],nl_lr_one[jgid],top->cgs.index,
-                                                                            bexcl,shift,fr,TRUE,rvdw_lt_rcoul,rcoul_lt_rvdw,fr->solvent_opt);
-                                                                nlr_one[jgid]=0;
+                                                                if (nlr_one[jgid] >= MAX_CG)
+                                                                {
+                                                                    /* Add to long-range list with only coul, or only LJ */
+                                                                    put_in_list(bHaveVdW,ngid,md,icg,jgid,
+                                                                                nlr_one[jgid],nl_lr_one[jgid],top->cgs.index,
+                                                                                bexcl,shift,fr,nblists,TRUE,rvdw_lt_rcoul,rcoul_lt_rvdw,fr->solvent_opt);
+                                                                    nlr_one[jgid]=0;
+                                                                }
+                                                                nl_lr_one[jgid][nlr_one[jgid]++]=jjcg;
                                                             }
-                                                            nl_lr_one[jgid][nlr_one[jgid]++]=jjcg;
                                                         }
                                                     }
+                                                    nns++;
                                                 }
-                                                nns++;
                                             }
                                         }
                                     }
                                 }
                             }
                         }
-                    }
-                    /* CHECK whether there is anything left in the buffers */
-                    for(nn=0; (nn<ngid); nn++)
-                    {
-                        if (nsr[nn] > 0)
+                        /* CHECK whether there is anything left in the buffers */
+                        for(nn=0; (nn<ngid); nn++)
                         {
-                            put_in_list(bHaveVdW,ngid,md,icg,nn,nsr[nn],nl_sr[nn],
-                                        cgs->index, /* cgsatoms, */ bexcl,
-                                        shift,fr,FALSE,TRUE,TRUE,fr->solvent_opt);
-                        }
+                            if (nsr[nn] > 0)
+                            {
+                                put_in_list(bHaveVdW,ngid,md,icg,nn,nsr[nn],nl_sr[nn],
+                                            cgs->index, /* cgsatoms, */ bexcl,
+                                            shift,fr,nblists,FALSE,TRUE,TRUE,fr->solvent_opt);
+                            }
                         
-                        if (nlr_ljc[nn] > 0)
-                        {
-                            put_in_list(bHaveVdW,ngid,md,icg,nn,nlr_ljc[nn],
-                                        nl_lr_ljc[nn],top->cgs.index,
-                                        bexcl,shift,fr,TRUE,TRUE,TRUE,fr->solvent_opt);
-                        }
+                            if (nlr_ljc[nn] > 0)
+                            {
+                                put_in_list(bHaveVdW,ngid,md,icg,nn,nlr_ljc[nn],
+                                            nl_lr_ljc[nn],top->cgs.index,
+                                            bexcl,shift,fr,nblists,TRUE,TRUE,TRUE,fr->solvent_opt);
+                            }
                         
-                        if (nlr_one[nn] > 0)
-                        {
-                            put_in_list(bHaveVdW,ngid,md,icg,nn,nlr_one[nn],
-                                        nl_lr_one[nn],top->cgs.index,
-                                        bexcl,shift,fr,TRUE,rvdw_lt_rcoul,rcoul_lt_rvdw,fr->solvent_opt);
+                            if (nlr_one[nn] > 0)
+                            {
+                                put_in_list(bHaveVdW,ngid,md,icg,nn,nlr_one[nn],
+                                            nl_lr_one[nn],top->cgs.index,
+                                            bexcl,shift,fr,nblists,TRUE,rvdw_lt_rcoul,rcoul_lt_rvdw,fr->solvent_opt);
+                            }
                         }
                     }
                 }
             }
+            /* setexcl(nri,i_atoms,&top->atoms.excl,FALSE,bexcl); */
+            setexcl(cgs->index[icg],cgs->index[icg+1],&top->excls,FALSE,bexcl);
         }
-        /* setexcl(nri,i_atoms,&top->atoms.excl,FALSE,bexcl); */
-        setexcl(cgs->index[icg],cgs->index[icg+1],&top->excls,FALSE,bexcl);
     }
     /* No need to perform any left-over force calculations anymore (as we used to do here)
      * since we now save the proper long-range lists for later evaluation.
@@ -2478,15 +2542,18 @@ static int nsgrid_core(FILE *log,t_commrec *cr,t_forcerec *fr,
 
 void ns_realloc_natoms(gmx_ns_t *ns,int natoms)
 {
-    int i;
+    int i,th;
     
     if (natoms > ns->nra_alloc)
     {
         ns->nra_alloc = over_alloc_dd(natoms);
-        srenew(ns->bexcl,ns->nra_alloc);
-        for(i=0; i<ns->nra_alloc; i++)
+        for(th=0; th<ns->nthread; th++)
         {
-            ns->bexcl[i] = 0;
+            srenew(ns->th[th].bexcl,ns->nra_alloc);
+            for(i=0; i<ns->nra_alloc; i++)
+            {
+                ns->th[th].bexcl[i] = 0;
+            }
         }
     }
 }
@@ -2534,6 +2601,10 @@ void init_ns(FILE *fplog,const t_commrec *cr,
             }
         }
     }
+
+    /* One set of search buffers per set of neighbor lists */
+    ns->nthread = fr->nthread_ns;
+    snew(ns->th,ns->nthread);
     
     if (fr->bGrid) {
         /* Grid search */
@@ -2576,7 +2647,6 @@ void init_ns(FILE *fplog,const t_commrec *cr,
         pr_bvec(debug,0,"bHaveVdW",ns->bHaveVdW,fr->ntype,TRUE);
     
     ns->nra_alloc = 0;
-    ns->bexcl = NULL;
     if (!DOMAINDECOMP(cr))
     {
         /* This could be reduced with particle decomposition */
@@ -2749,7 +2819,7 @@ int search_neighbours(FILE *log,t_forcerec *fr,
     {
         grid = ns->grid;
         nsearch = nsgrid_core(log,cr,fr,box,box_size,ngid,top,
-                              grid,x,ns->bexcl,ns->bExcludeAlleg,
+                              grid,x,ns->bExcludeAlleg,
                               nrnb,md,lambda,dvdlambda,grppener,
                               put_in_list,ns->bHaveVdW,
                               bDoLongRangeNS,FALSE);
@@ -2766,7 +2836,7 @@ int search_neighbours(FILE *log,t_forcerec *fr,
         if (fr->bQMMM && fr->qr->QMMMscheme!=eQMMMschemeoniom)
         {
             nsearch += nsgrid_core(log,cr,fr,box,box_size,ngid,top,
-                                   grid,x,ns->bexcl,ns->bExcludeAlleg,
+                                   grid,x,ns->bExcludeAlleg,
                                    nrnb,md,lambda,dvdlambda,grppener,
                                    put_in_list_qmmm,ns->bHaveVdW,
                                    bDoLongRangeNS,TRUE);
@@ -2775,7 +2845,7 @@ int search_neighbours(FILE *log,t_forcerec *fr,
     else 
     {
         nsearch = ns_simple_core(fr,top,md,box,box_size,
-                                 ns->bexcl,ns->simple_aaj,
+                                 ns->th[0].bexcl,ns->simple_aaj,
                                  ngid,ns->ns_buf,put_in_list,ns->bHaveVdW);
     }
     debug_gmx();
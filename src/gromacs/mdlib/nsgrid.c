@@ -415,9 +415,6 @@ void done_grid(t_grid *grid)
   sfree(grid->index);
   sfree(grid->nra);
   grid->cells_nalloc = 0;
-  sfree(grid->dcx2);
-  sfree(grid->dcy2);
-  sfree(grid->dcz2);
   grid->dc_nalloc = 0;
 
   if (debug) 
@@ -493,9 +490,6 @@ void grid_first(FILE *fplog,t_grid *grid,
   if (m > grid->dc_nalloc) {
     /* Allocate with double the initial size for box scaling */
     grid->dc_nalloc = 2*m;
-    srenew(grid->dcx2,grid->dc_nalloc);
-    srenew(grid->dcy2,grid->dc_nalloc);
-    srenew(grid->dcz2,grid->dc_nalloc);
   }
 
   grid->nr = 0;
@@ -103,6 +103,21 @@
 #endif
 #endif
 
+/* Single precision, with 256-bit AVX available.
+ * AVX-512 builds also define GMX_X86_AVX_256 and use these kernels,
+ * since with pme_order <= 8 a z-line of splines fits in 256 bits.
+ */
+#if defined(GMX_X86_AVX_256) && !defined(GMX_DOUBLE)
+#define PME_AVX
+#endif
+
+/* The memory alignment of the PME grids and the spline work data */
+#ifdef PME_AVX
+#define PME_SIMD_ALIGN 32
+#else
+#define PME_SIMD_ALIGN 16
+#endif
+
 #define DFT_TOL 1e-7
 /* #define PRT_FORCE */
 /* conditions for on the fly time-measurement */
@@ -231,6 +246,10 @@ typedef struct {
 #ifdef PME_SSE
     /* Masks for SSE aligned spreading and gathering */
     __m128 mask_SSE0[6],mask_SSE1[6];
+#ifdef PME_AVX
+    /* Mask for the pme_order z-elements of an 8-wide AVX spline */
+    __m256 mask_AVX;
+#endif
 #else
     int dummy; /* C89 requires that struct has at least one member */
 #endif
@@ -576,7 +595,9 @@ static void realloc_splinevec(splinevec th,real **ptr_z,int nalloc)
 
     srenew(th[XX],nalloc);
     srenew(th[YY],nalloc);
-    /* In z we add padding, this is only required for the aligned SSE code */
+    /* In z we add padding, this is only required for the aligned SSE code
+     * and for the AVX code, which loads 8 z-splines for pme_order 5 and 6.
+     */
     srenew(*ptr_z,nalloc+2*padding);
     th[ZZ] = *ptr_z + padding;
 
@@ -1485,6 +1506,10 @@ static void spread_q_bsplines_thread(pmegrid_t *pmegrid,
 
             switch (order) {
             case 4:
+#ifdef PME_AVX
+#define PME_SPREAD_AVX_ORDER4
+#include "pme_avx_single.h"
+#else
 #ifdef PME_SSE
 #ifdef PME_SSE_UNALIGNED
 #define PME_SPREAD_SSE_ORDER4
@@ -1495,15 +1520,31 @@ static void spread_q_bsplines_thread(pmegrid_t *pmegrid,
 #include "pme_sse_single.h"
 #else
                 DO_BSPLINE(4);
+#endif
 #endif
                 break;
             case 5:
+#ifdef PME_AVX
+#define PME_SPREAD_AVX_MASKED
+#define PME_ORDER 5
+#include "pme_avx_single.h"
+#else
 #ifdef PME_SSE
 #define PME_SPREAD_SSE_ALIGNED
 #define PME_ORDER 5
 #include "pme_sse_single.h"
 #else
                 DO_BSPLINE(5);
+#endif
+#endif
+                break;
+            case 6:
+#ifdef PME_AVX
+#define PME_SPREAD_AVX_MASKED
+#define PME_ORDER 6
+#include "pme_avx_single.h"
+#else
+                DO_BSPLINE(6);
 #endif
                 break;
             default:
@@ -1516,7 +1557,7 @@ static void spread_q_bsplines_thread(pmegrid_t *pmegrid,
 
 static void set_grid_alignment(int *pmegrid_nz,int pme_order)
 {
-#ifdef PME_SSE
+#if defined PME_SSE && !defined PME_AVX
     if (pme_order == 5
 #ifndef PME_SSE_UNALIGNED
         || pme_order == 4
@@ -1531,6 +1572,18 @@ static void set_grid_alignment(int *pmegrid_nz,int pme_order)
 
 static void set_gridsize_alignment(int *gridsize,int pme_order)
 {
+#ifdef PME_AVX
+    if (pme_order == 5 || pme_order == 6)
+    {
+        /* The AVX kernels load and store 8 z-elements starting at
+         * the first z-index of the spline. For the last line of the grid
+         * this can extend by up to 8-pme_order elements beyond the grid.
+         */
+        *gridsize += 8;
+    }
+    /* Keep the start of consecutive thread-local grids 32-byte aligned */
+    *gridsize = ((*gridsize + 7) & ~7);
+#else
 #ifdef PME_SSE
 #ifndef PME_SSE_UNALIGNED
     if (pme_order == 4)
@@ -1544,6 +1597,7 @@ static void set_gridsize_alignment(int *gridsize,int pme_order)
     }
 #endif
 #endif
+#endif
 }
 
 static void pmegrid_init(pmegrid_t *grid,
@@ -1583,7 +1637,7 @@ static void pmegrid_init(pmegrid_t *grid,
     {
         gridsize = grid->s[XX]*grid->s[YY]*grid->s[ZZ];
         set_gridsize_alignment(&gridsize,pme_order);
-        snew_aligned(grid->grid,gridsize,16);
+        snew_aligned(grid->grid,gridsize,PME_SIMD_ALIGN);
     }
     else
     {
@@ -1701,7 +1755,7 @@ static void pmegrids_init(pmegrids_t *grids,
         set_gridsize_alignment(&gridsize,pme_order);
         snew_aligned(grids->grid_all,
                      grids->nthread*gridsize+(grids->nthread+1)*GMX_CACHE_SEP,
-                     16);
+                     PME_SIMD_ALIGN);
 
         for(x=0; x<grids->nc[XX]; x++)
         {
@@ -2246,6 +2300,10 @@ static void gather_f_bsplines(gmx_pme_t pme,real *grid,
 
             switch (order) {
             case 4:
+#ifdef PME_AVX
+#define PME_GATHER_F_AVX_ORDER4
+#include "pme_avx_single.h"
+#else
 #ifdef PME_SSE
 #ifdef PME_SSE_UNALIGNED
 #define PME_GATHER_F_SSE_ORDER4
@@ -2256,15 +2314,31 @@ static void gather_f_bsplines(gmx_pme_t pme,real *grid,
 #include "pme_sse_single.h"
 #else
                 DO_FSPLINE(4);
+#endif
 #endif
                 break;
             case 5:
+#ifdef PME_AVX
+#define PME_GATHER_F_AVX_MASKED
+#define PME_ORDER 5
+#include "pme_avx_single.h"
+#else
 #ifdef PME_SSE
 #define PME_GATHER_F_SSE_ALIGNED
 #define PME_ORDER 5
 #include "pme_sse_single.h"
 #else
                 DO_FSPLINE(5);
+#endif
+#endif
+                break;
+            case 6:
+#ifdef PME_AVX
+#define PME_GATHER_F_AVX_MASKED
+#define PME_ORDER 6
+#include "pme_avx_single.h"
+#else
+                DO_FSPLINE(6);
 #endif
                 break;
             default:
@@ -2290,8 +2364,9 @@ static void gather_f_bsplines(gmx_pme_t pme,real *grid,
 
 
 static real gather_energy_bsplines(gmx_pme_t pme,real *grid,
-                                   pme_atomcomm_t *atc)
+                                   pme_atomcomm_t *atc,real *pot_atom)
 {
+    /* When pot_atom != NULL, the potential at each atom is stored */
     splinedata_t *spline;
     int     n,ithx,ithy,ithz,i0,j0,k0;
     int     index_x,index_xy;
@@ -2344,6 +2419,14 @@ static real gather_energy_bsplines(gmx_pme_t pme,real *grid,
 
             energy += pot*qn;
         }
+        else
+        {
+            pot = 0;
+        }
+        if (pot_atom != NULL)
+        {
+            pot_atom[n] = pot;
+        }
     }
 
     return energy;
@@ -2423,6 +2506,7 @@ void make_bsplines(splinevec theta,splinevec dtheta,int order,
             switch(order) {
             case 4:  CALC_SPLINE(4);     break;
             case 5:  CALC_SPLINE(5);     break;
+            case 6:  CALC_SPLINE(6);     break;
             default: CALC_SPLINE(order); break;
             }
         }
@@ -2911,7 +2995,7 @@ static pme_spline_work_t *make_pme_spline_work(int order)
     __m128 zero_SSE;
     int    of,i;
 
-    snew_aligned(work,1,16);
+    snew_aligned(work,1,PME_SIMD_ALIGN);
 
     zero_SSE = _mm_setzero_ps();
 
@@ -2930,6 +3014,14 @@ static pme_spline_work_t *make_pme_spline_work(int order)
         work->mask_SSE0[of] = _mm_cmpgt_ps(work->mask_SSE0[of],zero_SSE);
         work->mask_SSE1[of] = _mm_cmpgt_ps(work->mask_SSE1[of],zero_SSE);
     }
+#ifdef PME_AVX
+    for(i=0; i<8; i++)
+    {
+        tmp[i] = (i < order ? 1 : 0);
+    }
+    work->mask_AVX = _mm256_cmp_ps(_mm256_loadu_ps(tmp),_mm256_setzero_ps(),
+                                   _CMP_GT_OQ);
+#endif
 #else
     work = NULL;
 #endif
@@ -3242,8 +3334,8 @@ int gmx_pme_init(gmx_pme_t *         pmedata,
                       pme->pmegrid_nz_base,
                       pme->pme_order,
                       pme->nthread,
-                      pme->nkx % pme->nnodes_major != 0,
-                      pme->nky % pme->nnodes_minor != 0);
+                      pme->overlap[0].s2g1[pme->nodeid_major]-pme->overlap[0].s2g0[pme->nodeid_major+1],
+                      pme->overlap[1].s2g1[pme->nodeid_minor]-pme->overlap[1].s2g0[pme->nodeid_minor+1]);
 
         gmx_parallel_3dfft_init(&pme->pfft_setupB,ndata,
                                 &pme->fftgridB,&pme->cfftgridB,
@@ -4006,7 +4098,133 @@ void gmx_pme_calc_energy(gmx_pme_t pme,int n,rvec *x,real *q,real *V)
 
     spread_on_grid(pme,atc,NULL,TRUE,FALSE,pme->fftgridA);
 
-    *V = gather_energy_bsplines(pme,grid->grid.grid,atc);
+    *V = gather_energy_bsplines(pme,grid->grid.grid,atc,NULL);
+}
+
+
+void gmx_pme_calc_pot_field(gmx_pme_t pme,int n,rvec *x,
+                            real *pot,rvec *field)
+{
+    pme_atomcomm_t *atc;
+    pmegrids_t *grid;
+    real *q;
+    int  i;
+
+    if (pme->nnodes > 1)
+    {
+        gmx_incons("gmx_pme_calc_pot_field called in parallel");
+    }
+    if (pme->bFEP)
+    {
+        gmx_incons("gmx_pme_calc_pot_field with free energy");
+    }
+
+    /* We interpolate with unit charges, the splines are only made
+     * for charged atoms.
+     */
+    snew(q,n);
+    for(i=0; i<n; i++)
+    {
+        q[i] = 1;
+    }
+
+    atc = &pme->atc_energy;
+    atc->nthread   = 1;
+    if (atc->spline == NULL)
+    {
+        snew(atc->spline,atc->nthread);
+    }
+    atc->nslab     = 1;
+    atc->bSpread   = TRUE;
+    atc->pme_order = pme->pme_order;
+    atc->n         = n;
+    pme_realloc_atomcomm_things(atc);
+    atc->x         = x;
+    atc->q         = q;
+    atc->f         = field;
+
+    /* We only use the A-charges grid */
+    grid = &pme->pmegridA;
+
+    spread_on_grid(pme,atc,NULL,TRUE,FALSE,pme->fftgridA);
+
+    gather_energy_bsplines(pme,grid->grid.grid,atc,pot);
+    /* The force on a unit charge is the field */
+    gather_f_bsplines(pme,grid->grid.grid,TRUE,atc,&atc->spline[0],1.0);
+
+    atc->f = NULL;
+    sfree(q);
+}
+
+
+void gmx_pme_calc_source_f(gmx_pme_t pme,matrix box,real ewaldcoeff,
+                           int nsrc,rvec *xsrc,real *qsrc,
+                           int n,rvec *x,real *q,rvec *f)
+{
+    pme_atomcomm_t *atc;
+    pmegrids_t *pmegrid;
+    real *grid,*fftgrid;
+    t_complex *cfftgrid;
+    int  natoms,thread;
+
+    if (pme->nnodes > 1)
+    {
+        gmx_incons("gmx_pme_calc_source_f called in parallel");
+    }
+    if (pme->bFEP)
+    {
+        gmx_incons("gmx_pme_calc_source_f with free energy");
+    }
+
+    atc      = &pme->atc[0];
+    pmegrid  = &pme->pmegridA;
+    grid     = pmegrid->grid.grid;
+    fftgrid  = pme->fftgridA;
+    cfftgrid = pme->cfftgridA;
+    /* Without decomposition gmx_pme_do does not reset the atom count */
+    natoms   = atc->n;
+
+    m_inv_ur0(box,pme->recipbox);
+
+    /* Spread the source charges and solve, as gmx_pme_do does */
+    atc->n = nsrc;
+    pme_realloc_atomcomm_things(atc);
+    atc->x = xsrc;
+    atc->q = qsrc;
+    spread_on_grid(pme,atc,pmegrid,TRUE,TRUE,fftgrid);
+    if (pme->nthread == 1)
+    {
+        wrap_periodic_pmegrid(pme,grid);
+        copy_pmegrid_to_fftgrid(pme,grid,fftgrid);
+    }
+#pragma omp parallel num_threads(pme->nthread) private(thread)
+    {
+        thread = gmx_omp_get_thread_num();
+        gmx_parallel_3dfft_execute(pme->pfft_setupA,GMX_FFT_REAL_TO_COMPLEX,
+                                   fftgrid,cfftgrid,thread,NULL);
+        solve_pme_yzx(pme,cfftgrid,ewaldcoeff,
+                      box[XX][XX]*box[YY][YY]*box[ZZ][ZZ],
+                      FALSE,pme->nthread,thread);
+        gmx_parallel_3dfft_execute(pme->pfft_setupA,GMX_FFT_COMPLEX_TO_REAL,
+                                   cfftgrid,fftgrid,thread,NULL);
+        copy_fftgrid_to_pmegrid(pme,fftgrid,grid,pme->nthread,thread);
+    }
+    unwrap_periodic_pmegrid(pme,grid);
+
+    /* Gather the forces of this potential on the target charges */
+    atc->n = n;
+    pme_realloc_atomcomm_things(atc);
+    atc->x = x;
+    atc->q = q;
+    atc->f = f;
+    spread_on_grid(pme,atc,pmegrid,TRUE,FALSE,fftgrid);
+#pragma omp parallel for num_threads(pme->nthread) schedule(static)
+    for(thread=0; thread<pme->nthread; thread++)
+    {
+        gather_f_bsplines(pme,grid,FALSE,atc,&atc->spline[thread],1.0);
+    }
+    atc->f = NULL;
+    atc->n = natoms;
 }
 
 
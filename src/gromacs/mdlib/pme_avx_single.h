@@ -0,0 +1,256 @@
+/* -*- mode: c; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4; c-file-style: "stroustrup"; -*-
+ *
+ * 
+ *                This source code is part of
+ * 
+ *                 G   R   O   M   A   C   S
+ * 
+ *          GROningen MAchine for Chemical Simulations
+ * 
+ *                        VERSION 4.5
+ * Written by David van der Spoel, Erik Lindahl, Berk Hess, and others.
+ * Copyright (c) 1991-2000, University of Groningen, The Netherlands.
+ * Copyright (c) 2001-2004, The GROMACS development team,
+ * check out http://www.gromacs.org for more information.
+
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * If you want to redistribute modifications, please consider that
+ * scientific software is very special. Version control is crucial -
+ * bugs must be traceable. We will be happy to consider code for
+ * inclusion in the official distribution, but derived work must not
+ * be called official GROMACS. Details are found in the README & COPYING
+ * files - if they are missing, get the official version at www.gromacs.org.
+ * 
+ * To help us fund GROMACS development, we humbly ask that you cite
+ * the papers on the package - you can find them in the top README file.
+ * 
+ * For more info, check our website at http://www.gromacs.org
+ * 
+ * And Hey:
+ * GROwing Monsters And Cloning Shrimps
+ */
+
+
+/* This include file has code between ifdef's to make sure
+ * that this performance sensitive code is inlined
+ * and to remove conditionals and variable loop bounds at compile time.
+ * These are the 256-bit AVX versions of the kernels in pme_sse_single.h.
+ */
+
+#ifdef PME_SPREAD_AVX_ORDER4
+/* This code does not assume any memory alignment.
+ * This code only works for pme_order = 4.
+ * Two grid lines along y, of 4 z-elements each, are processed
+ * in one AVX register.
+ */
+{
+    __m256 ty_AVX01,ty_AVX23;
+    __m256 tz_AVX;
+    __m256 vx_AVX;
+    __m256 vx_tz_AVX;
+    __m256 sum_AVX01,sum_AVX23;
+    __m256 gri_AVX01,gri_AVX23;
+    real   *gr;
+
+    ty_AVX01 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_load1_ps(&thy[0])),_mm_load1_ps(&thy[1]),1);
+    ty_AVX23 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_load1_ps(&thy[2])),_mm_load1_ps(&thy[3]),1);
+
+    tz_AVX   = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(thz)),_mm_loadu_ps(thz),1);
+
+    for(ithx=0; (ithx<4); ithx++)
+    {
+        gr      = grid + (i0+ithx)*pny*pnz + j0*pnz + k0;
+        valx    = qn*thx[ithx];
+
+        vx_AVX    = _mm256_broadcast_ss(&valx);
+
+        vx_tz_AVX = _mm256_mul_ps(vx_AVX,tz_AVX);
+
+        gri_AVX01 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(gr+0*pnz)),_mm_loadu_ps(gr+1*pnz),1);
+        gri_AVX23 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(gr+2*pnz)),_mm_loadu_ps(gr+3*pnz),1);
+
+        sum_AVX01 = _mm256_add_ps(gri_AVX01,_mm256_mul_ps(vx_tz_AVX,ty_AVX01));
+        sum_AVX23 = _mm256_add_ps(gri_AVX23,_mm256_mul_ps(vx_tz_AVX,ty_AVX23));
+
+        _mm_storeu_ps(gr+0*pnz,_mm256_castps256_ps128(sum_AVX01));
+        _mm_storeu_ps(gr+1*pnz,_mm256_extractf128_ps(sum_AVX01,1));
+        _mm_storeu_ps(gr+2*pnz,_mm256_castps256_ps128(sum_AVX23));
+        _mm_storeu_ps(gr+3*pnz,_mm256_extractf128_ps(sum_AVX23,1));
+    }
+}
+#undef PME_SPREAD_AVX_ORDER4
+#endif
+
+
+#ifdef PME_GATHER_F_AVX_ORDER4
+/* This code does not assume any memory alignment.
+ * This code only works for pme_order = 4.
+ */
+{
+    float fx_tmp[8],fy_tmp[8],fz_tmp[8];
+
+    __m256 fx_AVX,fy_AVX,fz_AVX;
+
+    __m256 tx_AVX,tz_AVX;
+    __m256 dx_AVX,dz_AVX;
+    __m256 ty_AVX01,ty_AVX23,dy_AVX01,dy_AVX23;
+
+    __m256 gval_AVX01,gval_AVX23;
+
+    __m256 fxy1_AVX01,fz1_AVX01;
+    __m256 fxy1_AVX23,fz1_AVX23;
+    real   *gr;
+
+    fx_AVX = _mm256_setzero_ps();
+    fy_AVX = _mm256_setzero_ps();
+    fz_AVX = _mm256_setzero_ps();
+
+    tz_AVX   = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(thz)),_mm_loadu_ps(thz),1);
+    dz_AVX   = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(dthz)),_mm_loadu_ps(dthz),1);
+
+    ty_AVX01 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_load1_ps(thy+0)),_mm_load1_ps(thy+1),1);
+    ty_AVX23 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_load1_ps(thy+2)),_mm_load1_ps(thy+3),1);
+    dy_AVX01 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_load1_ps(dthy+0)),_mm_load1_ps(dthy+1),1);
+    dy_AVX23 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_load1_ps(dthy+2)),_mm_load1_ps(dthy+3),1);
+
+    for(ithx=0; (ithx<4); ithx++)
+    {
+        gr       = grid + (i0+ithx)*pny*pnz + j0*pnz + k0;
+        tx_AVX   = _mm256_broadcast_ss(thx+ithx);
+        dx_AVX   = _mm256_broadcast_ss(dthx+ithx);
+
+        gval_AVX01 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(gr+0*pnz)),_mm_loadu_ps(gr+1*pnz),1);
+        gval_AVX23 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(gr+2*pnz)),_mm_loadu_ps(gr+3*pnz),1);
+
+        fxy1_AVX01 = _mm256_mul_ps(tz_AVX,gval_AVX01);
+        fz1_AVX01  = _mm256_mul_ps(dz_AVX,gval_AVX01);
+        fxy1_AVX23 = _mm256_mul_ps(tz_AVX,gval_AVX23);
+        fz1_AVX23  = _mm256_mul_ps(dz_AVX,gval_AVX23);
+
+        fx_AVX = _mm256_add_ps(fx_AVX,_mm256_mul_ps(dx_AVX,_mm256_add_ps(_mm256_mul_ps(ty_AVX01,fxy1_AVX01),_mm256_mul_ps(ty_AVX23,fxy1_AVX23))));
+        fy_AVX = _mm256_add_ps(fy_AVX,_mm256_mul_ps(tx_AVX,_mm256_add_ps(_mm256_mul_ps(dy_AVX01,fxy1_AVX01),_mm256_mul_ps(dy_AVX23,fxy1_AVX23))));
+        fz_AVX = _mm256_add_ps(fz_AVX,_mm256_mul_ps(tx_AVX,_mm256_add_ps(_mm256_mul_ps(ty_AVX01,fz1_AVX01),_mm256_mul_ps(ty_AVX23,fz1_AVX23))));
+    }
+
+    _mm256_storeu_ps(fx_tmp,fx_AVX);
+    _mm256_storeu_ps(fy_tmp,fy_AVX);
+    _mm256_storeu_ps(fz_tmp,fz_AVX);
+
+    fx += fx_tmp[0]+fx_tmp[1]+fx_tmp[2]+fx_tmp[3]+fx_tmp[4]+fx_tmp[5]+fx_tmp[6]+fx_tmp[7];
+    fy += fy_tmp[0]+fy_tmp[1]+fy_tmp[2]+fy_tmp[3]+fy_tmp[4]+fy_tmp[5]+fy_tmp[6]+fy_tmp[7];
+    fz += fz_tmp[0]+fz_tmp[1]+fz_tmp[2]+fz_tmp[3]+fz_tmp[4]+fz_tmp[5]+fz_tmp[6]+fz_tmp[7];
+}
+#undef PME_GATHER_F_AVX_ORDER4
+#endif
+
+
+#ifdef PME_SPREAD_AVX_MASKED
+/* This code does not assume any memory alignment.
+ * A full line of 8 z-elements is loaded and stored, the elements
+ * beyond PME_ORDER are multiplied by zero through work->mask_AVX.
+ * This requires 8-PME_ORDER elements of padding after each thread grid
+ * and after the last z-spline, see set_gridsize_alignment
+ * and realloc_splinevec.
+ * This code supports 4 < pme_order <= 8.
+ */
+{
+    __m256 ty_AVX[PME_ORDER];
+    __m256 tz_AVX;
+    __m256 vx_AVX;
+    __m256 vx_tz_AVX;
+    __m256 gri_AVX;
+    real   *gr;
+
+    for(ithy=0; (ithy<PME_ORDER); ithy++)
+    {
+        ty_AVX[ithy] = _mm256_broadcast_ss(&thy[ithy]);
+    }
+
+    tz_AVX = _mm256_and_ps(_mm256_loadu_ps(thz),work->mask_AVX);
+
+    for(ithx=0; (ithx<PME_ORDER); ithx++)
+    {
+        index_x = (i0+ithx)*pny*pnz + j0*pnz + k0;
+        valx    = qn*thx[ithx];
+
+        vx_AVX    = _mm256_broadcast_ss(&valx);
+
+        vx_tz_AVX = _mm256_mul_ps(vx_AVX,tz_AVX);
+
+        for(ithy=0; (ithy<PME_ORDER); ithy++)
+        {
+            gr      = grid + index_x + ithy*pnz;
+            gri_AVX = _mm256_loadu_ps(gr);
+            gri_AVX = _mm256_add_ps(gri_AVX,_mm256_mul_ps(vx_tz_AVX,ty_AVX[ithy]));
+            _mm256_storeu_ps(gr,gri_AVX);
+        }
+    }
+}
+#undef PME_ORDER
+#undef PME_SPREAD_AVX_MASKED
+#endif
+
+
+#ifdef PME_GATHER_F_AVX_MASKED
+/* This code does not assume any memory alignment.
+ * The same padding requirements as for PME_SPREAD_AVX_MASKED apply.
+ * This code supports 4 < pme_order <= 8.
+ */
+{
+    float fx_tmp[8],fy_tmp[8],fz_tmp[8];
+
+    __m256 fx_AVX,fy_AVX,fz_AVX;
+
+    __m256 tx_AVX,ty_AVX,tz_AVX;
+    __m256 dx_AVX,dy_AVX,dz_AVX;
+
+    __m256 gval_AVX;
+
+    __m256 fxy1_AVX;
+    __m256 fz1_AVX;
+
+    fx_AVX = _mm256_setzero_ps();
+    fy_AVX = _mm256_setzero_ps();
+    fz_AVX = _mm256_setzero_ps();
+
+    tz_AVX = _mm256_and_ps(_mm256_loadu_ps(thz),work->mask_AVX);
+    dz_AVX = _mm256_and_ps(_mm256_loadu_ps(dthz),work->mask_AVX);
+
+    for(ithx=0; (ithx<PME_ORDER); ithx++)
+    {
+        index_x = (i0+ithx)*pny*pnz;
+        tx_AVX  = _mm256_broadcast_ss(thx+ithx);
+        dx_AVX  = _mm256_broadcast_ss(dthx+ithx);
+
+        for(ithy=0; (ithy<PME_ORDER); ithy++)
+        {
+            index_xy = index_x+(j0+ithy)*pnz;
+            ty_AVX   = _mm256_broadcast_ss(thy+ithy);
+            dy_AVX   = _mm256_broadcast_ss(dthy+ithy);
+
+            gval_AVX = _mm256_loadu_ps(grid+index_xy+k0);
+
+            fxy1_AVX = _mm256_mul_ps(tz_AVX,gval_AVX);
+            fz1_AVX  = _mm256_mul_ps(dz_AVX,gval_AVX);
+
+            fx_AVX = _mm256_add_ps(fx_AVX,_mm256_mul_ps(_mm256_mul_ps(dx_AVX,ty_AVX),fxy1_AVX));
+            fy_AVX = _mm256_add_ps(fy_AVX,_mm256_mul_ps(_mm256_mul_ps(tx_AVX,dy_AVX),fxy1_AVX));
+            fz_AVX = _mm256_add_ps(fz_AVX,_mm256_mul_ps(_mm256_mul_ps(tx_AVX,ty_AVX),fz1_AVX));
+        }
+    }
+
+    _mm256_storeu_ps(fx_tmp,fx_AVX);
+    _mm256_storeu_ps(fy_tmp,fy_AVX);
+    _mm256_storeu_ps(fz_tmp,fz_AVX);
+
+    fx += fx_tmp[0]+fx_tmp[1]+fx_tmp[2]+fx_tmp[3]+fx_tmp[4]+fx_tmp[5]+fx_tmp[6]+fx_tmp[7];
+    fy += fy_tmp[0]+fy_tmp[1]+fy_tmp[2]+fy_tmp[3]+fy_tmp[4]+fy_tmp[5]+fy_tmp[6]+fy_tmp[7];
+    fz += fz_tmp[0]+fz_tmp[1]+fz_tmp[2]+fz_tmp[3]+fz_tmp[4]+fz_tmp[5]+fz_tmp[6]+fz_tmp[7];
+}
+#undef PME_ORDER
+#undef PME_GATHER_F_AVX_MASKED
+#endif
@@ -62,6 +62,8 @@
 #include <stdio.h>
 #include <string.h>
 #include "gmx_fatal.h"
+#include "futil.h"
+#include "string2.h"
 #include "typedefs.h"
 #include <stdlib.h>
 
@@ -86,7 +88,7 @@ void init_gaussian(t_commrec *cr, t_QMrec *qm, t_MMrec *mm)
 			   {1,6,11},
 			   {4,6,0}};
   char
-    *buf=NULL;
+    *buf=NULL,fname[STRLEN];
   int
     i;
   
@@ -160,7 +162,7 @@ void init_gaussian(t_commrec *cr, t_QMrec *qm, t_MMrec *mm)
      * MM and QM atoms.
      */
     if(qm->bTS||qm->bOPT){
-      out = fopen("LJ.dat","w");
+      out = fopen(QMMM_workfile(qm,"LJ.dat",fname),"w");
       for(i=0;i<qm->nrQMatoms;i++){
 
 #ifdef GMX_DOUBLE
@@ -203,6 +205,15 @@ void init_gaussian(t_commrec *cr, t_QMrec *qm, t_MMrec *mm)
     /* fclose(rffile);*/
     /*  }*/
   }
+  /* the checkpoint file gaussian reads its guess from and writes the
+   * new wavefunction to, the QM/MM layer keeps copies per step
+   */
+  if(!qm->wfnfile){
+    if(qm->QMmethod>=eQMmethodRHF)
+      qm->wfnfile = gmx_strdup(QMMM_workfile(qm,"input.chk",fname));
+    else
+      qm->wfnfile = gmx_strdup(QMMM_workfile(qm,"se.chk",fname));
+  }
   fprintf(stderr,"gaussian initialised...\n");
 }  
 
@@ -219,10 +230,12 @@ void write_gaussian_SH_input(int step,gmx_bool swap,
     *out;
   t_QMMMrec
     *QMMMrec;
+  char
+    fname[STRLEN];
   QMMMrec = fr->qr;
   bSA = (qm->SAstep>0);
 
-  out = fopen("input.com","w");
+  out = fopen(QMMM_workfile(qm,"input.com",fname),"w");
   /* write the route */
   fprintf(out,"%s","%scr=input\n");
   fprintf(out,"%s","%rwf=input\n");
@@ -411,9 +424,19 @@ void write_gaussian_input(int step ,t_forcerec *fr, t_QMrec *qm, t_MMrec *mm)
     *QMMMrec;
   FILE
     *out;
+  char
+    fname[STRLEN];
   
   QMMMrec = fr->qr;
-  out = fopen("input.com","w");
+  /* put the guess the QM/MM layer kept for this calculation in place,
+   * gaussian only reads the newest one
+   */
+  if(qm->guess && qm->guess->nstored){
+    if(gmx_file_copy(qm->guess->file[0],qm->wfnfile,TRUE) != 0)
+      gmx_fatal(FARGS,"Could not copy the SCF guess %s to %s",
+		qm->guess->file[0],qm->wfnfile);
+  }
+  out = fopen(QMMM_workfile(qm,"input.com",fname),"w");
   /* write the route */
 
   if(qm->QMmethod>=eQMmethodRHF)
@@ -472,7 +495,7 @@ void write_gaussian_input(int step ,t_forcerec *fr, t_QMrec *qm, t_MMrec *mm)
     fprintf(out," %s",
 	    "Charge ");
   }
-  if (step || qm->QMmethod==eQMmethodCASSCF){
+  if ((qm->guess && qm->guess->nstored) || qm->QMmethod==eQMmethodCASSCF){
     /* fetch guess from checkpoint file, always for CASSCF */
     fprintf(out,"%s"," guess=read");
   }
@@ -600,13 +623,13 @@ real read_gaussian_output(rvec QMgrad[],rvec MMgrad[],int step,
   int
     i,j,atnum;
   char
-    buf[300];
+    buf[300],fname[STRLEN];
   real
     QMener;
   FILE
     *in;
   
-  in=fopen("fort.7","r");
+  in=fopen(QMMM_workfile(qm,"fort.7",fname),"r");
 
 
 
@@ -700,13 +723,13 @@ real read_gaussian_SH_output(rvec QMgrad[],rvec MMgrad[],int step,
   int
     i;
   char
-    buf[300];
+    buf[300],fname[STRLEN];
   real
     QMener,DeltaE;
   FILE
     *in;
   
-  in=fopen("fort.7","r");
+  in=fopen(QMMM_workfile(qm,"fort.7",fname),"r");
   /* first line is the energy and in the case of CAS, the energy
    * difference between the two states.
    */
@@ -870,23 +893,50 @@ int hop(int step, t_QMrec *qm)
   return(swap);
 }
 
-void do_gaussian(int step,char *exe)
+static int read_gaussian_scf_cycles(const char *logfile)
+{
+  /* the number of SCF cycles is on the "SCF Done:" line of the log,
+   * "SCF Done:  E(RHF) =  -75.98  A.U. after    9 cycles"
+   */
+  FILE
+    *in;
+  char
+    buf[300],*ptr;
+  int
+    nscf=0;
+
+  in = fopen(logfile,"r");
+  if (in == NULL)
+    return 0;
+  while (fgets(buf,300,in) != NULL){
+    if (strstr(buf,"SCF Done:") && (ptr = strstr(buf,"after")) != NULL)
+      sscanf(ptr+5,"%d",&nscf);
+  }
+  fclose(in);
+  return nscf;
+}
+
+void do_gaussian(int step,char *exe,const char *workdir)
 {
   char
-    buf[STRLEN];
+    buf[STRLEN],cd[STRLEN];
 
   /* make the call to the gaussian binary through system()
    * The location of the binary will be picked up from the 
-   * environment using getenv().
+   * environment using getenv(). Gaussian runs in workdir, if set.
    */
+  if(workdir)
+    sprintf(cd,"cd %s && ",workdir);
+  else
+    cd[0] = '\0';
   if(step) /* hack to prevent long inputfiles */
-    sprintf(buf,"%s < %s > %s",
-	    exe,
+    sprintf(buf,"%s%s < %s > %s",
+	    cd,exe,
 	    "input.com",
 	    "input.log");
   else
-    sprintf(buf,"%s < %s > %s",
-	    exe,
+    sprintf(buf,"%s%s < %s > %s",
+	    cd,exe,
             "input.com",
 	    "input.log");
   fprintf(stderr,"Calling '%s'\n",buf);
@@ -902,26 +952,34 @@ void do_gaussian(int step,char *exe)
 real call_gaussian(t_commrec *cr,  t_forcerec *fr, 
 		   t_QMrec *qm, t_MMrec *mm, rvec f[], rvec fshift[])
 {
-  /* normal gaussian jobs */
-  static int
-    step=0;
+  /* normal gaussian jobs, the ONIOM layers can call this
+   * concurrently, so all state is in qm
+   */
   int
-    i,j;
+    step,i,j;
   real
     QMener=0.0;
   rvec
     *QMgrad,*MMgrad;
   char
-    *exe;
+    *exe,fname[STRLEN];
   
+  step = qm->ncalls;
   snew(exe,30);
   sprintf(exe,"%s/%s",qm->gauss_dir,qm->gauss_exe);
   snew(QMgrad,qm->nrQMatoms);
   snew(MMgrad,mm->nrMMatoms);
 
+  QMMM_cycles_start(qm,eQMcycINPUT);
   write_gaussian_input(step,fr,qm,mm);
-  do_gaussian(step,exe);
+  QMMM_cycles_stop(qm,eQMcycINPUT);
+  QMMM_cycles_start(qm,eQMcycENGINE);
+  do_gaussian(step,exe,qm->workdir);
+  QMMM_cycles_stop(qm,eQMcycENGINE);
+  QMMM_cycles_start(qm,eQMcycOUTPUT);
   QMener = read_gaussian_output(QMgrad,MMgrad,step,qm,mm);
+  QMMM_cycles_stop(qm,eQMcycOUTPUT);
+  qm->nSCF = read_gaussian_scf_cycles(QMMM_workfile(qm,"input.log",fname));
   /* put the QMMM forces in the force array and to the fshift
    */
   for(i=0;i<qm->nrQMatoms;i++){
@@ -937,7 +995,7 @@ real call_gaussian(t_commrec *cr,  t_forcerec *fr,
     }
   }
   QMener = QMener*HARTREE2KJ*AVOGADRO;
-  step++;
+  qm->ncalls++;
   free(exe);
   return(QMener);
 
@@ -992,7 +1050,7 @@ real call_gaussian_SH(t_commrec *cr, t_forcerec *fr, t_QMrec *qm, t_MMrec *mm,
   /* temporray set to step + 1, since there is a chk start */
   write_gaussian_SH_input(step,swapped,fr,qm,mm);
 
-  do_gaussian(step,exe);
+  do_gaussian(step,exe,qm->workdir);
   QMener = read_gaussian_SH_output(QMgrad,MMgrad,step,swapped,qm,mm);
 
   /* check for a surface hop. Only possible if we were already state
@@ -1009,7 +1067,7 @@ real call_gaussian_SH(t_commrec *cr, t_forcerec *fr, t_QMrec *qm, t_MMrec *mm,
     }
     if (swap){/* change surface, so do another call */
       write_gaussian_SH_input(step,swapped,fr,qm,mm);
-      do_gaussian(step,exe);
+      do_gaussian(step,exe,qm->workdir);
       QMener = read_gaussian_SH_output(QMgrad,MMgrad,step,swapped,qm,mm);
     }
   }
@@ -60,6 +60,8 @@
 #include <stdio.h>
 #include <string.h>
 #include "gmx_fatal.h"
+#include "futil.h"
+#include "string2.h"
 #include "typedefs.h"
 #include <stdlib.h>
 
@@ -68,7 +70,7 @@
 void init_orca(t_commrec *cr, t_QMrec *qm, t_MMrec *mm)
 {
  char
-   *buf;
+   *buf,fname[STRLEN],path[STRLEN];
  snew(buf,200);    
  /* ORCA settings on the system */
  buf = getenv("BASENAME");
@@ -95,8 +97,15 @@ void init_orca(t_commrec *cr, t_QMrec *qm, t_MMrec *mm)
  fprintf(stderr,"orca initialised...\n");
  /* since we append the output to the BASENAME.out file,
  we should delete an existent old out-file here. */
- sprintf(buf,"%s.out",qm->orca_basename);
- remove(buf);
+ sprintf(fname,"%s.out",qm->orca_basename);
+ remove(QMMM_workfile(qm,fname,path));
+ /* ORCA leaves the converged orbitals in BASENAME.gbw, the QM/MM layer
+  * keeps copies of it to use as the guess of the next steps
+  */
+ if (!qm->wfnfile){
+     sprintf(fname,"%s.gbw",qm->orca_basename);
+     qm->wfnfile = gmx_strdup(QMMM_workfile(qm,fname,path));
+ }
 }  
 
 
@@ -110,12 +119,12 @@ void write_orca_input(int step ,t_forcerec *fr, t_QMrec *qm, t_MMrec *mm)
    *out, *pcFile, *addInputFile, *LJCoeff;
  char
    *buf,*orcaInput,*addInputFilename,*LJCoeffFilename,
-   *pcFilename,*exclInName,*exclOutName;
+   *pcFilename,*exclInName,*exclOutName,fname[STRLEN];
  QMMMrec = fr->qr;
  /* write the first part of the input-file */
- snew(orcaInput,200);
- sprintf(orcaInput,"%s.inp",qm->orca_basename);
- out = fopen(orcaInput,"w");
+ snew(orcaInput,STRLEN);
+ sprintf(fname,"%s.inp",qm->orca_basename);
+ out = fopen(QMMM_workfile(qm,fname,orcaInput),"w");
  snew(addInputFilename,200);
  sprintf(addInputFilename,"%s.ORCAINFO",qm->orca_basename);
  addInputFile = fopen(addInputFilename,"r");
@@ -130,6 +139,17 @@ void write_orca_input(int step ,t_forcerec *fr, t_QMrec *qm, t_MMrec *mm)
  else{
      fprintf(out,"!EnGrad TightSCF\n");
  }
+ /* read the orbitals of the previous step, ORCA can not extrapolate
+  * so we only use the newest
+  */
+ if (qm->guess && qm->guess->nstored){
+     fprintf(out,"!MORead\n");
+     /* the guesses are kept in the working directory, one up from
+      * the scratch directory ORCA runs in
+      */
+     fprintf(out,"%s%s%s%s\n","%moinp \"",qm->workdir ? "../" : "",
+             qm->guess->file[0],"\"");
+ }
  /* here we include the insertion of the additional orca-input */
  snew(buf,200);
  if (addInputFile!=NULL) {
@@ -228,17 +248,17 @@ void write_orca_input(int step ,t_forcerec *fr, t_QMrec *qm, t_MMrec *mm)
      snew(pcFilename,200);
      sprintf(pcFilename,"%s.pc",qm->orca_basename);
      fprintf(out,"%s%s%s\n","%pointcharges \"",pcFilename,"\"");
-     pcFile = fopen(pcFilename,"w");
+     pcFile = fopen(QMMM_workfile(qm,pcFilename,fname),"w");
      fprintf(pcFile,"%d\n",mm->nrMMatoms);
      for(i=0;i<mm->nrMMatoms;i++){
 #ifdef GMX_DOUBLE
-         fprintf(pcFile,"%8.4lf %10.7lf  %10.7lf  %10.7lf\n",
+         fprintf(pcFile,"%10.7lf %10.7lf  %10.7lf  %10.7lf\n",
                         mm->MMcharges[i],
                         mm->xMM[i][XX]/0.1,
                         mm->xMM[i][YY]/0.1,
                         mm->xMM[i][ZZ]/0.1);
 #else
-         fprintf(pcFile,"%8.4f %10.7f  %10.7f  %10.7f\n",
+         fprintf(pcFile,"%10.7f %10.7f  %10.7f  %10.7f\n",
                         mm->MMcharges[i],
                         mm->xMM[i][XX]/0.1,
                         mm->xMM[i][YY]/0.1,
@@ -259,7 +279,8 @@ real read_orca_output(rvec QMgrad[],rvec MMgrad[],int step,t_forcerec *fr,
  int
    i,j,atnum;
  char
-   buf[300], tmp[300], orca_xyzFilename[300], orca_pcgradFilename[300], orca_engradFilename[300];
+   buf[300], tmp[300], orca_xyzFilename[300], orca_pcgradFilename[300], orca_engradFilename[300],
+   fname[STRLEN];
  real
    QMener;
  FILE
@@ -278,7 +299,7 @@ real read_orca_output(rvec QMgrad[],rvec MMgrad[],int step,t_forcerec *fr,
 
  if(qm->bTS||qm->bOPT){
      sprintf(orca_xyzFilename,"%s.xyz",qm->orca_basename);
-     xyz=fopen(orca_xyzFilename,"r");
+     xyz=fopen(QMMM_workfile(qm,orca_xyzFilename,fname),"r");
      if (fgets(buf,300,xyz) == NULL)
          gmx_fatal(FARGS, "Unexpected end of ORCA output");
      if (fgets(buf,300,xyz) == NULL)
@@ -306,7 +327,7 @@ real read_orca_output(rvec QMgrad[],rvec MMgrad[],int step,t_forcerec *fr,
      fclose(xyz);
  }
  sprintf(orca_engradFilename,"%s.engrad",qm->orca_basename);
- engrad=fopen(orca_engradFilename,"r");
+ engrad=fopen(QMMM_workfile(qm,orca_engradFilename,fname),"r");
  /* we read the energy and the gradient for the qm-atoms from the engrad file
   */
  /* we can skip the first seven lines
@@ -360,7 +381,7 @@ real read_orca_output(rvec QMgrad[],rvec MMgrad[],int step,t_forcerec *fr,
   */
  if(QMMMrec->QMMMscheme!=eQMMMschemeoniom && mm->nrMMatoms){
      sprintf(orca_pcgradFilename,"%s.pcgrad",qm->orca_basename);
-     pcgrad=fopen(orca_pcgradFilename,"r");
+     pcgrad=fopen(QMMM_workfile(qm,orca_pcgradFilename,fname),"r");
     
      /* we read the gradient for the mm-atoms from the pcgrad file
       */
@@ -388,16 +409,46 @@ real read_orca_output(rvec QMgrad[],rvec MMgrad[],int step,t_forcerec *fr,
  return(QMener);  
 }
 
-void do_orca(int step,char *exe, char *orca_dir, char *basename)
+static int read_orca_scf_cycles(const char *outfile, long offset)
+{
+ /* ORCA appends to BASENAME.out, so we only look at what was written
+  * after offset, the line is "SCF CONVERGED AFTER  12 CYCLES"
+  */
+ FILE
+   *in;
+ char
+   buf[300],*ptr;
+ int
+   nscf=0;
+
+ in = fopen(outfile,"r");
+ if (in == NULL)
+     return 0;
+ fseek(in,offset,SEEK_SET);
+ while (fgets(buf,300,in) != NULL){
+     if ((ptr = strstr(buf,"SCF CONVERGED AFTER")) != NULL)
+         sscanf(ptr+19,"%d",&nscf);
+ }
+ fclose(in);
+ return nscf;
+}
+
+void do_orca(int step,char *exe, char *orca_dir, char *basename,
+             const char *workdir)
 {
 
  /* make the call to the orca binary through system()
   * The location of the binary is set through the
-  * environment.
+  * environment. ORCA runs in workdir, if set.
   */
  char
-   buf[100];
- sprintf(buf,"%s/%s %s.inp >> %s.out",
+   buf[STRLEN],cd[STRLEN];
+ if (workdir)
+     sprintf(cd,"cd %s && ",workdir);
+ else
+     cd[0] = '\0';
+ sprintf(buf,"%s%s/%s %s.inp >> %s.out",
+             cd,
              orca_dir,
              "orca",
              basename,
@@ -410,26 +461,48 @@ void do_orca(int step,char *exe, char *orca_dir, char *basename)
 real call_orca(t_commrec *cr,  t_forcerec *fr, 
 		   t_QMrec *qm, t_MMrec *mm, rvec f[], rvec fshift[])
 {
- /* normal orca jobs */
- static int
-   step=0;
+ /* normal orca jobs, the ONIOM layers can call this concurrently,
+  * so all state is in qm
+  */
  int
-   i,j;
+   step,i,j;
  real
    QMener=0.0;
  rvec
    *QMgrad,*MMgrad;
  char
-   *exe;
+   *exe,fname[STRLEN],outbuf[STRLEN];
+ const char
+   *outfile;
+ long
+   offset;
+ FILE
+   *out;
 
+ step = qm->ncalls;
  snew(exe,30);
  sprintf(exe,"%s","orca");
  snew(QMgrad,qm->nrQMatoms);
  snew(MMgrad,mm->nrMMatoms);
 
+ sprintf(fname,"%s.out",qm->orca_basename);
+ outfile = QMMM_workfile(qm,fname,outbuf);
+ offset = 0;
+ if ((out = fopen(outfile,"r")) != NULL){
+     fseek(out,0,SEEK_END);
+     offset = ftell(out);
+     fclose(out);
+ }
+ QMMM_cycles_start(qm,eQMcycINPUT);
  write_orca_input(step,fr,qm,mm);
- do_orca(step,exe,qm->orca_dir,qm->orca_basename);
+ QMMM_cycles_stop(qm,eQMcycINPUT);
+ QMMM_cycles_start(qm,eQMcycENGINE);
+ do_orca(step,exe,qm->orca_dir,qm->orca_basename,qm->workdir);
+ QMMM_cycles_stop(qm,eQMcycENGINE);
+ QMMM_cycles_start(qm,eQMcycOUTPUT);
  QMener = read_orca_output(QMgrad,MMgrad,step,fr,qm,mm);
+ QMMM_cycles_stop(qm,eQMcycOUTPUT);
+ qm->nSCF = read_orca_scf_cycles(outfile,offset);
  /* put the QMMM forces in the force array and to the fshift
   */
  for(i=0;i<qm->nrQMatoms;i++){
@@ -445,7 +518,7 @@ real call_orca(t_commrec *cr,  t_forcerec *fr,
      }
  }
  QMener = QMener*HARTREE2KJ*AVOGADRO;
- step++;
+ qm->ncalls++;
  free(exe);
  return(QMener);
 } /* call_orca */
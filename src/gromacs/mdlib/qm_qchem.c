@@ -0,0 +1,732 @@
+/*
+ *
+ *                This source code is part of
+ *
+ *                 G   R   O   M   A   C   S
+ *
+ *          GROningen MAchine for Chemical Simulations
+ *
+ * Written by David van der Spoel, Erik Lindahl, Berk Hess, and others.
+ * Copyright (c) 1991-2000, University of Groningen, The Netherlands.
+ * Copyright (c) 2001-2012, The GROMACS development team,
+ * check out http://www.gromacs.org for more information.
+
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * If you want to redistribute modifications, please consider that
+ * scientific software is very special. Version control is crucial -
+ * bugs must be traceable. We will be happy to consider code for
+ * inclusion in the official distribution, but derived work must not
+ * be called official GROMACS. Details are found in the README & COPYING
+ * files - if they are missing, get the official version at www.gromacs.org.
+ *
+ * To help us fund GROMACS development, we humbly ask that you cite
+ * the papers on the package - you can find them in the top README file.
+ *
+ * For more info, check our website at http://www.gromacs.org
+ */
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+
+#ifndef GMX_NATIVE_WINDOWS
+#include <unistd.h>
+#include <signal.h>
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#endif
+
+#include "typedefs.h"
+#include "smalloc.h"
+#include "physics.h"
+#include "names.h"
+#include "futil.h"
+#include "string2.h"
+#include "gmx_fatal.h"
+#include "qmmm.h"
+#include "qm_qchem.h"
+
+/* Binary transport buffer of a connection, see GMX_QMMM_IO in qm_qchem.h */
+typedef struct {
+    int     type;     /* eqchemioMMAP or eqchemioTEXT                 */
+    char   *fn;       /* mapped file or base name of the text files   */
+    int     fd;       /* descriptor of the mapped file                */
+    size_t  nbytes;   /* size of the mapping                          */
+    double *buf;      /* the buffer, mapped or in memory              */
+    int     nalloc;   /* doubles allocated in buf (text)              */
+    int     nQM;      /* atom counts of the last request              */
+    int     nMM;
+} qchem_io_t;
+
+/* The request in the buffer holds nQM, nMM, the QM coordinates, the MM
+ * charges and the MM coordinates, the reply after it the energy, the QM
+ * gradient and the MM gradient, in atomic units.
+ */
+#define QCHEM_IO_NREQUEST(nQM, nMM) (2 + 3*(nQM) + 4*(nMM))
+#define QCHEM_IO_NREPLY(nQM, nMM)   (1 + 3*(nQM) + 3*(nMM))
+
+struct gmx_qchem {
+    int   fd;         /* socket connected to the server              */
+    char *buf;        /* message buffer, requests and replies        */
+    int   buf_nalloc;
+    int   nQM;        /* atom counts of the outstanding request      */
+    int   nMM;
+    int   next;       /* nQM with an external potential, 0 otherwise */
+    gmx_bool bPending;
+    qchem_io_t *io;   /* transport buffer, NULL: all through the socket */
+};
+
+#ifndef GMX_NATIVE_WINDOWS
+
+static void qchem_write(int fd, const void *data, size_t n)
+{
+    const char *p = (const char *)data;
+    ssize_t     nw;
+
+    while (n > 0)
+    {
+        nw = write(fd, p, n);
+        if (nw < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (nw <= 0)
+        {
+            gmx_fatal(FARGS, "Writing to the Q-Chem server failed: %s",
+                      strerror(errno));
+        }
+        p += nw;
+        n -= nw;
+    }
+}
+
+static void qchem_read(int fd, void *data, size_t n)
+{
+    char   *p = (char *)data;
+    ssize_t nr;
+
+    while (n > 0)
+    {
+        nr = read(fd, p, n);
+        if (nr < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (nr == 0)
+        {
+            gmx_fatal(FARGS, "The Q-Chem server closed the connection");
+        }
+        if (nr < 0)
+        {
+            gmx_fatal(FARGS, "Reading from the Q-Chem server failed: %s",
+                      strerror(errno));
+        }
+        p += nr;
+        n -= nr;
+    }
+}
+
+static int qchem_try_connect(const char *socket_path)
+{
+    struct sockaddr_un addr;
+    int                fd;
+
+    fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0)
+    {
+        gmx_fatal(FARGS, "Could not create a socket: %s", strerror(errno));
+    }
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strncpy(addr.sun_path, socket_path, sizeof(addr.sun_path)-1);
+    if (connect(fd, (struct sockaddr *)&addr, sizeof(addr)) != 0)
+    {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+static void qchem_start_server(const char *server_cmd)
+{
+    pid_t pid;
+
+    fprintf(stderr, "Starting the Q-Chem server '%s'\n", server_cmd);
+    pid = fork();
+    if (pid < 0)
+    {
+        gmx_fatal(FARGS, "Could not fork to start '%s': %s",
+                  server_cmd, strerror(errno));
+    }
+    if (pid == 0)
+    {
+        /* Detach, so the server does not get our terminal signals */
+        setsid();
+        execl("/bin/sh", "sh", "-c", server_cmd, (char *)NULL);
+        _exit(127);
+    }
+}
+
+static qchem_io_t *qchem_io_open(const char *name)
+{
+    qchem_io_t *io;
+    char       *env, buf[STRLEN];
+    const char *dir;
+    struct stat st;
+
+    snew(io, 1);
+    io->fd   = -1;
+    io->type = eqchemioTEXT;
+    env      = getenv("GMX_QMMM_IO");
+    if (env == NULL || gmx_strcasecmp(env, "text") != 0)
+    {
+        dir = getenv("GMX_QMMM_IO_DIR");
+        if (dir == NULL)
+        {
+            dir = (stat("/dev/shm", &st) == 0 && S_ISDIR(st.st_mode)) ?
+                "/dev/shm" : ".";
+        }
+        /* runs sharing the directory should not share buffers */
+        sprintf(buf, "%s/%s-%d.qmio", dir, name, (int)getpid());
+        io->fd = open(buf, O_RDWR | O_CREAT | O_TRUNC, 0600);
+        if (io->fd >= 0)
+        {
+            io->type = eqchemioMMAP;
+        }
+        else
+        {
+            fprintf(stderr, "Can not create the Q-Chem transport buffer %s (%s), "
+                    "using text files\n", buf, strerror(errno));
+        }
+    }
+    if (io->type == eqchemioTEXT)
+    {
+        strcpy(buf, name);
+    }
+    io->fn = gmx_strdup(buf);
+
+    return io;
+}
+
+static void qchem_io_reserve(qchem_io_t *io, int n)
+{
+    if (io->type == eqchemioTEXT)
+    {
+        if (n > io->nalloc)
+        {
+            io->nalloc = over_alloc_large(n);
+            srenew(io->buf, io->nalloc);
+        }
+    }
+    else if (n*sizeof(double) > io->nbytes)
+    {
+        if (io->buf != NULL)
+        {
+            munmap(io->buf, io->nbytes);
+        }
+        io->nbytes = over_alloc_large(n)*sizeof(double);
+        if (ftruncate(io->fd, io->nbytes) != 0)
+        {
+            gmx_fatal(FARGS, "Can not resize the Q-Chem transport buffer %s: %s",
+                      io->fn, strerror(errno));
+        }
+        io->buf = mmap(NULL, io->nbytes, PROT_READ | PROT_WRITE, MAP_SHARED,
+                       io->fd, 0);
+        if (io->buf == MAP_FAILED)
+        {
+            gmx_fatal(FARGS, "Can not map the Q-Chem transport buffer %s: %s",
+                      io->fn, strerror(errno));
+        }
+    }
+}
+
+static void qchem_io_put_request(qchem_io_t *io, t_QMrec *qm, t_MMrec *mm)
+{
+    int     nQM, nMM, i, d;
+    double *x, *q;
+    char    fn[STRLEN];
+    FILE   *out;
+
+    nQM = qm->nrQMatoms;
+    nMM = mm->nrMMatoms;
+    qchem_io_reserve(io, QCHEM_IO_NREQUEST(nQM, nMM) + QCHEM_IO_NREPLY(nQM, nMM));
+    io->nQM = nQM;
+    io->nMM = nMM;
+
+    io->buf[0] = nQM;
+    io->buf[1] = nMM;
+    x          = io->buf + 2;
+    for (i = 0; i < nQM; i++)
+    {
+        for (d = 0; d < DIM; d++)
+        {
+            *x++ = qm->xQM[i][d]/BOHR2NM;
+        }
+    }
+    q = x;
+    for (i = 0; i < nMM; i++)
+    {
+        *x++ = mm->MMcharges[i];
+    }
+    for (i = 0; i < nMM; i++)
+    {
+        for (d = 0; d < DIM; d++)
+        {
+            *x++ = mm->xMM[i][d]/BOHR2NM;
+        }
+    }
+
+    if (io->type == eqchemioTEXT)
+    {
+        /* %.17g reproduces the doubles exactly */
+        sprintf(fn, "%s.in", io->fn);
+        /* rewritten every call, so no backups as with ffopen */
+        if ((out = fopen(fn, "w")) == NULL)
+        {
+            gmx_fatal(FARGS, "Can not write the Q-Chem request %s", fn);
+        }
+        fprintf(out, "%d %d\n", nQM, nMM);
+        x = io->buf + 2;
+        for (i = 0; i < nQM; i++, x += DIM)
+        {
+            fprintf(out, "%.17g %.17g %.17g\n", x[XX], x[YY], x[ZZ]);
+        }
+        x = q + nMM;
+        for (i = 0; i < nMM; i++, x += DIM)
+        {
+            fprintf(out, "%.17g %.17g %.17g %.17g\n", q[i], x[XX], x[YY], x[ZZ]);
+        }
+        fclose(out);
+    }
+}
+
+static real qchem_io_get_reply(qchem_io_t *io, rvec QMgrad[], rvec MMgrad[])
+{
+    int     n, i, d;
+    double *r;
+    char    fn[STRLEN];
+    FILE   *in;
+
+    r = io->buf + QCHEM_IO_NREQUEST(io->nQM, io->nMM);
+    if (io->type == eqchemioTEXT)
+    {
+        sprintf(fn, "%s.out", io->fn);
+        in = ffopen(fn, "r");
+        n  = QCHEM_IO_NREPLY(io->nQM, io->nMM);
+        for (i = 0; i < n; i++)
+        {
+            if (fscanf(in, "%lf", &r[i]) != 1)
+            {
+                gmx_fatal(FARGS, "Error reading the Q-Chem reply %s, expected "
+                          "%d numbers, found %d", fn, n, i);
+            }
+        }
+        ffclose(in);
+    }
+    for (i = 0; i < io->nQM; i++)
+    {
+        for (d = 0; d < DIM; d++)
+        {
+            QMgrad[i][d] = r[1 + DIM*i + d];
+        }
+    }
+    for (i = 0; i < io->nMM; i++)
+    {
+        for (d = 0; d < DIM; d++)
+        {
+            MMgrad[i][d] = r[1 + DIM*io->nQM + DIM*i + d];
+        }
+    }
+
+    return r[0];
+}
+
+static void qchem_io_close(qchem_io_t *io)
+{
+    if (io->type == eqchemioTEXT)
+    {
+        sfree(io->buf);
+    }
+    else
+    {
+        if (io->buf != NULL)
+        {
+            munmap(io->buf, io->nbytes);
+        }
+        close(io->fd);
+        unlink(io->fn);
+    }
+    sfree(io->fn);
+    sfree(io);
+}
+
+#endif /* GMX_NATIVE_WINDOWS */
+
+static void qchem_realloc_buf(gmx_qchem_t qc, int nbytes)
+{
+    if (nbytes > qc->buf_nalloc)
+    {
+        qc->buf_nalloc = over_alloc_large(nbytes);
+        srenew(qc->buf, qc->buf_nalloc);
+    }
+}
+
+gmx_qchem_t gmx_qchem_connect(const char *socket_path,
+                              const char *server_cmd,
+                              int timeout)
+{
+#ifdef GMX_NATIVE_WINDOWS
+    gmx_fatal(FARGS, "The Q-Chem server interface needs Unix domain sockets");
+    return NULL;
+#else
+    gmx_qchem_t qc;
+    int         fd, t;
+    char        name[STRLEN];
+
+    fd = qchem_try_connect(socket_path);
+    if (fd < 0 && server_cmd != NULL)
+    {
+        qchem_start_server(server_cmd);
+        for (t = 0; t < timeout && fd < 0; t++)
+        {
+            sleep(1);
+            fd = qchem_try_connect(socket_path);
+        }
+    }
+    if (fd < 0)
+    {
+        gmx_fatal(FARGS, "Could not connect to the Q-Chem server at '%s'",
+                  socket_path);
+    }
+    /* A server that dies should give us a read/write error, not kill us */
+    signal(SIGPIPE, SIG_IGN);
+
+    snew(qc, 1);
+    qc->fd = fd;
+    if (getenv("GMX_QMMM_IO") != NULL)
+    {
+        /* Connections can be open at the same time, each needs a buffer */
+        sprintf(name, "qchem%d", fd);
+        qc->io = qchem_io_open(name);
+    }
+
+    return qc;
+#endif
+}
+
+void gmx_qchem_send_request(gmx_qchem_t qc, int step,
+                            t_QMrec *qm, t_MMrec *mm)
+{
+#ifndef GMX_NATIVE_WINDOWS
+    int     *ibuf;
+    double  *dbuf;
+    int      nQM, nMM, nguess, next, nfn, nbytes, i, d;
+
+    if (qc->bPending)
+    {
+        gmx_incons("Q-Chem request sent while the previous one is pending");
+    }
+    nQM    = qm->nrQMatoms;
+    nMM    = mm->nrMMatoms;
+    nguess = (qm->guess != NULL ? qm->guess->nstored : 0);
+    next   = (qm->Vext != NULL ? nQM : 0);
+
+    if (qc->io != NULL)
+    {
+        qchem_io_put_request(qc->io, qm, mm);
+        nfn    = strlen(qc->io->fn);
+        nbytes = (GMX_QCHEM_NHEADER + nQM + 1)*sizeof(int) + nfn +
+            (nguess + next)*sizeof(double);
+    }
+    else
+    {
+        nfn    = 0;
+        nbytes = (GMX_QCHEM_NHEADER + nQM)*sizeof(int) +
+            (3*nQM + 4*nMM + nguess + next)*sizeof(double);
+    }
+    qchem_realloc_buf(qc, nbytes);
+
+    ibuf    = (int *)qc->buf;
+    ibuf[0]  = GMX_QCHEM_MAGIC;
+    ibuf[1]  = eqchemGRADIENT;
+    ibuf[2]  = step;
+    ibuf[3]  = nQM;
+    ibuf[4]  = nMM;
+    ibuf[5]  = qm->QMcharge;
+    ibuf[6]  = qm->multiplicity;
+    ibuf[7]  = qm->QMmethod;
+    ibuf[8]  = qm->QMbasis;
+    ibuf[9]  = nguess;
+    ibuf[10] = (next > 0);
+    ibuf[11] = (qc->io != NULL ? qc->io->type : eqchemioSOCKET);
+    ibuf    += GMX_QCHEM_NHEADER;
+    for (i = 0; i < nQM; i++)
+    {
+        ibuf[i] = qm->atomicnumberQM[i];
+    }
+    /* The int block can leave the doubles unaligned, so we copy */
+    dbuf = (double *)(ibuf + nQM);
+    if (qc->io != NULL)
+    {
+        ibuf[nQM] = nfn;
+        memcpy(ibuf + nQM + 1, qc->io->fn, nfn);
+        dbuf = (double *)((char *)(ibuf + nQM + 1) + nfn);
+    }
+    else
+    {
+        for (i = 0; i < nQM; i++)
+        {
+            for (d = 0; d < DIM; d++)
+            {
+                double x = qm->xQM[i][d]/BOHR2NM;
+                memcpy(dbuf++, &x, sizeof(x));
+            }
+        }
+        for (i = 0; i < nMM; i++)
+        {
+            double q = mm->MMcharges[i];
+            memcpy(dbuf++, &q, sizeof(q));
+        }
+        for (i = 0; i < nMM; i++)
+        {
+            for (d = 0; d < DIM; d++)
+            {
+                double x = mm->xMM[i][d]/BOHR2NM;
+                memcpy(dbuf++, &x, sizeof(x));
+            }
+        }
+    }
+    for (i = 0; i < nguess; i++)
+    {
+        double c = qm->guess->coeff[i];
+        memcpy(dbuf++, &c, sizeof(c));
+    }
+    for (i = 0; i < next; i++)
+    {
+        double v = qm->Vext[i]/(HARTREE2KJ*AVOGADRO);
+        memcpy(dbuf++, &v, sizeof(v));
+    }
+
+    qchem_write(qc->fd, qc->buf, nbytes);
+
+    qc->nQM      = nQM;
+    qc->nMM      = nMM;
+    qc->next     = next;
+    qc->bPending = TRUE;
+#endif
+}
+
+real gmx_qchem_recv_reply(gmx_qchem_t qc, t_QMrec *qm, t_MMrec *mm,
+                          rvec QMgrad[], rvec MMgrad[], int *nscf)
+{
+    double QMener = 0;
+#ifndef GMX_NATIVE_WINDOWS
+    int    header[GMX_QCHEM_NREPLY];
+    double g;
+    char  *p;
+    int    nbytes, i, d;
+
+    if (!qc->bPending)
+    {
+        gmx_incons("Waiting for a Q-Chem reply without a request");
+    }
+    qc->bPending = FALSE;
+
+    qchem_read(qc->fd, header, sizeof(header));
+    if (header[0] != GMX_QCHEM_MAGIC)
+    {
+        gmx_fatal(FARGS, "Garbled reply from the Q-Chem server");
+    }
+    if (header[1] != 0)
+    {
+        gmx_fatal(FARGS, "The Q-Chem server returned error status %d",
+                  header[1]);
+    }
+    if (nscf != NULL)
+    {
+        *nscf = header[2];
+    }
+
+    if (qc->io != NULL)
+    {
+        QMener = qchem_io_get_reply(qc->io, QMgrad, MMgrad);
+        nbytes = qc->next*sizeof(double);
+        qchem_realloc_buf(qc, nbytes);
+        qchem_read(qc->fd, qc->buf, nbytes);
+        p = qc->buf;
+    }
+    else
+    {
+        nbytes = (1 + 3*qc->nQM + 3*qc->nMM + qc->next)*sizeof(double);
+        qchem_realloc_buf(qc, nbytes);
+        qchem_read(qc->fd, qc->buf, nbytes);
+
+        p = qc->buf;
+        memcpy(&QMener, p, sizeof(double));
+        p += sizeof(double);
+        for (i = 0; i < qc->nQM; i++)
+        {
+            for (d = 0; d < DIM; d++)
+            {
+                memcpy(&g, p, sizeof(double));
+                p            += sizeof(double);
+                QMgrad[i][d]  = g;
+            }
+        }
+        for (i = 0; i < qc->nMM; i++)
+        {
+            for (d = 0; d < DIM; d++)
+            {
+                memcpy(&g, p, sizeof(double));
+                p            += sizeof(double);
+                MMgrad[i][d]  = g;
+            }
+        }
+    }
+    /* dE/dVext is a charge, the same in atomic and in MD units */
+    for (i = 0; i < qc->next; i++)
+    {
+        memcpy(&g, p, sizeof(double));
+        p          += sizeof(double);
+        qm->Qext[i] = g;
+    }
+#endif
+    return QMener;
+}
+
+void gmx_qchem_close(gmx_qchem_t qc)
+{
+#ifndef GMX_NATIVE_WINDOWS
+    int header[GMX_QCHEM_NHEADER];
+
+    memset(header, 0, sizeof(header));
+    header[0] = GMX_QCHEM_MAGIC;
+    header[1] = eqchemQUIT;
+    /* The server might be gone already, so we ignore errors here */
+    if (write(qc->fd, header, sizeof(header)) < 0)
+    {
+        fprintf(stderr, "Could not send quit to the Q-Chem server\n");
+    }
+    close(qc->fd);
+    if (qc->io != NULL)
+    {
+        qchem_io_close(qc->io);
+    }
+#endif
+    sfree(qc->buf);
+    sfree(qc);
+}
+
+void done_qchem(t_QMrec *qm)
+{
+    if (qm->qchem != NULL)
+    {
+        gmx_qchem_close(qm->qchem);
+        qm->qchem = NULL;
+    }
+}
+
+void init_qchem(t_commrec *cr, t_QMrec *qm, t_MMrec *mm)
+{
+    char *socket_path, *server_cmd, *buf;
+    int   timeout;
+
+    if (qm->bTS || qm->bOPT)
+    {
+        gmx_fatal(FARGS, "QM optimizations are not supported with the Q-Chem server interface");
+    }
+    /* With multi-layer ONIOM this is called for every layer every step,
+     * but we allocate and connect only once per layer.
+     */
+    if (qm->QMgrad == NULL)
+    {
+        snew(qm->QMgrad, qm->nrQMatoms);
+    }
+    if (qm->qchem != NULL)
+    {
+        return;
+    }
+
+    socket_path = getenv("QCHEM_SOCKET");
+    if (socket_path == NULL)
+    {
+        gmx_fatal(FARGS, "no $QCHEM_SOCKET, this should be the Unix socket of the Q-Chem server\n");
+    }
+    server_cmd = getenv("QCHEM_SERVER");
+    timeout    = 60;
+    buf        = getenv("QCHEM_TIMEOUT");
+    if (buf)
+    {
+        sscanf(buf, "%d", &timeout);
+    }
+
+    qm->qchem = gmx_qchem_connect(socket_path, server_cmd, timeout);
+
+    fprintf(stderr, "Connected %s/%s to the Q-Chem server at %s\n",
+            eQMmethod_names[qm->QMmethod], eQMbasis_names[qm->QMbasis],
+            socket_path);
+}
+
+real call_qchem(t_commrec *cr, t_forcerec *fr,
+                t_QMrec *qm, t_MMrec *mm, rvec f[], rvec fshift[])
+{
+    int        step, i, j;
+    real       QMener;
+    rvec      *QMgrad, *MMgrad;
+
+    /* The ONIOM layers can run concurrently, so all state, including
+     * the connection, is in qm
+     */
+    step = qm->ncalls;
+    if (mm->nrMMatoms > qm->MMgrad_nalloc)
+    {
+        qm->MMgrad_nalloc = over_alloc_large(mm->nrMMatoms);
+        srenew(qm->MMgrad, qm->MMgrad_nalloc);
+    }
+    QMgrad = qm->QMgrad;
+    MMgrad = qm->MMgrad;
+
+    QMMM_cycles_start(qm, eQMcycINPUT);
+    gmx_qchem_send_request(qm->qchem, step, qm, mm);
+    QMMM_cycles_stop(qm, eQMcycINPUT);
+    /* The binary reply takes no time to read, so this is the server */
+    QMMM_cycles_start(qm, eQMcycENGINE);
+    QMener = gmx_qchem_recv_reply(qm->qchem, qm, mm, QMgrad, MMgrad,
+                                  &qm->nSCF);
+    QMMM_cycles_stop(qm, eQMcycENGINE);
+
+    /* put the QMMM forces in the force array and to the fshift
+     */
+    for (i = 0; i < qm->nrQMatoms; i++)
+    {
+        for (j = 0; j < DIM; j++)
+        {
+            f[i][j]      = HARTREE_BOHR2MD*QMgrad[i][j];
+            fshift[i][j] = HARTREE_BOHR2MD*QMgrad[i][j];
+        }
+    }
+    for (i = 0; i < mm->nrMMatoms; i++)
+    {
+        for (j = 0; j < DIM; j++)
+        {
+            f[i+qm->nrQMatoms][j]      = HARTREE_BOHR2MD*MMgrad[i][j];
+            fshift[i+qm->nrQMatoms][j] = HARTREE_BOHR2MD*MMgrad[i][j];
+        }
+    }
+    QMener = QMener*HARTREE2KJ*AVOGADRO;
+    qm->ncalls++;
+
+    return QMener;
+}
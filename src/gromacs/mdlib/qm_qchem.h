@@ -0,0 +1,180 @@
+/*
+ *
+ *                This source code is part of
+ *
+ *                 G   R   O   M   A   C   S
+ *
+ *          GROningen MAchine for Chemical Simulations
+ *
+ * Written by David van der Spoel, Erik Lindahl, Berk Hess, and others.
+ * Copyright (c) 1991-2000, University of Groningen, The Netherlands.
+ * Copyright (c) 2001-2012, The GROMACS development team,
+ * check out http://www.gromacs.org for more information.
+
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * If you want to redistribute modifications, please consider that
+ * scientific software is very special. Version control is crucial -
+ * bugs must be traceable. We will be happy to consider code for
+ * inclusion in the official distribution, but derived work must not
+ * be called official GROMACS. Details are found in the README & COPYING
+ * files - if they are missing, get the official version at www.gromacs.org.
+ *
+ * To help us fund GROMACS development, we humbly ask that you cite
+ * the papers on the package - you can find them in the top README file.
+ *
+ * For more info, check our website at http://www.gromacs.org
+ */
+#ifndef _qm_qchem_h
+#define _qm_qchem_h
+
+#include "typedefs.h"
+#include "types/commrec.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Interface to a persistent Q-Chem server process.
+ *
+ * Instead of writing an input file and starting the QM program through
+ * system() every step, mdrun connects once to a long-lived QM process
+ * over a Unix domain socket. Every QM calculation, i.e. every t_QMrec
+ * (ONIOM layer, lower level of a layer or multiple time stepping
+ * reference), has a connection of its own, so the calculations can run
+ * concurrently. The server should treat each connection as a separate
+ * session with its own SCF history. The server keeps the basis set, integral
+ * screening data and the SCF solution of the previous step resident,
+ * so per step only coordinates and point charges go out and the energy
+ * and gradients come back.
+ *
+ * The environment controls the connection:
+ *   QCHEM_SOCKET   path of the Unix socket the server listens on (required)
+ *   QCHEM_SERVER   command that starts the server, run once through
+ *                  /bin/sh when nothing is listening on QCHEM_SOCKET yet
+ *   QCHEM_TIMEOUT  seconds to wait for a freshly started server (60)
+ *   GMX_QMMM_IO    when set, the coordinates, charges and gradients go
+ *                  through a binary transport buffer instead of the
+ *                  socket; "text" selects text files, anything else a
+ *                  buffer mapped in memory
+ *   GMX_QMMM_IO_DIR directory of the mapped buffer, by default /dev/shm
+ *                  when it exists and the working directory otherwise
+ *
+ * Wire format, native byte order, all integers 32-bit, all reals double,
+ * lengths in bohr, energies in hartree:
+ *
+ *   request: magic, type, step, nQM, nMM, QMcharge, multiplicity,
+ *            QMmethod, QMbasis, flags, bext, io    (GMX_QCHEM_NHEADER ints)
+ *            atomic numbers                        (nQM ints)
+ *            buffer name length, buffer name       (1 int, chars, io only)
+ *            QM coordinates                        (3*nQM doubles, no io)
+ *            MM charges                            (nMM doubles, no io)
+ *            MM coordinates                        (3*nMM doubles, no io)
+ *            guess coefficients                    (nguess doubles)
+ *            external potential on the QM atoms    (nQM doubles, bext only)
+ *
+ *   reply:   magic, status, nscf, reserved         (GMX_QCHEM_NREPLY ints)
+ *            energy                                (1 double, no io)
+ *            QM gradient                           (3*nQM doubles, no io)
+ *            MM gradient                           (3*nMM doubles, no io)
+ *            dE/dV of the external potential       (nQM doubles, bext only)
+ *
+ * flags holds nguess, the number of previous SCF solutions the server
+ * should combine, with the given coefficients, into the guess for this
+ * step; 0 means a fresh guess. The server keeps these solutions itself.
+ * QMmethod and QMbasis are the eQMmethod and eQMbasis enum values. A
+ * status other than 0 signals a failed QM calculation. nscf is the
+ * number of SCF cycles the server needed, 0 when unknown.
+ *
+ * With bext set, the long-range potential (hartree/e) of the MM charges
+ * that are not in the point charge list follows. The server adds it
+ * to the QM Hamiltonian and to the energy and returns the QM gradient
+ * at a fixed potential, followed by the
+ * derivatives of the energy with respect to the potential on each QM
+ * atom, the QM charges in e; mdrun computes the forces that come from
+ * the dependence of the potential on the coordinates. These
+ * derivatives are always sent through the socket.
+ *
+ * io is eqchemioSOCKET when all data goes through the socket. Otherwise
+ * the coordinates and charges are in the transport buffer named in the
+ * request, the mapped file (eqchemioMMAP) or the base name of the text
+ * files (eqchemioTEXT). The server then writes the energy and gradients
+ * into the buffer before it sends the reply header.
+ *
+ * The mapped buffer is a file <name>-<pid>.qmio that both sides map in
+ * memory, so nothing is formatted, parsed or written to disk. It holds,
+ * as doubles in atomic units: nQM, nMM, the QM coordinates (3*nQM), the
+ * MM charges (nMM) and the MM coordinates (3*nMM), directly followed by
+ * the reply: the energy, the QM gradient (3*nQM) and the MM gradient
+ * (3*nMM). The text files <name>.in and <name>.out in the working
+ * directory hold "nQM nMM" on the first line, a line "x y z" per QM atom
+ * and "q x y z" per MM atom, and for the reply all numbers in the same
+ * order. The text files are also used when the buffer can not be
+ * created. This transport is specific to the Q-Chem server; the other
+ * QM interfaces use the input and output files of their QM programs.
+ */
+
+#define GMX_QCHEM_MAGIC    0x4d484351 /* "QCHM" */
+#define GMX_QCHEM_NHEADER  12
+#define GMX_QCHEM_NREPLY   4
+
+enum {
+    eqchemGRADIENT = 1, eqchemQUIT
+};
+
+enum {
+    eqchemioSOCKET, eqchemioMMAP, eqchemioTEXT
+};
+
+typedef struct gmx_qchem *gmx_qchem_t;
+
+gmx_qchem_t gmx_qchem_connect(const char *socket_path,
+                              const char *server_cmd,
+                              int timeout);
+/* Connects to the server listening on socket_path. When nobody is
+ * listening and server_cmd is not NULL, the server is started with
+ * server_cmd and we retry for timeout seconds. Fatal error on failure.
+ * Opens a transport buffer when GMX_QMMM_IO is set.
+ */
+
+void gmx_qchem_send_request(gmx_qchem_t qc, int step,
+                            t_QMrec *qm, t_MMrec *mm);
+/* Sends the coordinates of qm and the point charges of mm to the server.
+ * Returns as soon as the request is written, the server computes
+ * asynchronously until gmx_qchem_recv_reply is called.
+ */
+
+real gmx_qchem_recv_reply(gmx_qchem_t qc, t_QMrec *qm, t_MMrec *mm,
+                          rvec QMgrad[], rvec MMgrad[], int *nscf);
+/* Waits for the reply to the last request, stores the gradients in
+ * atomic units in QMgrad and MMgrad and returns the energy in hartree.
+ * When nscf != NULL the number of SCF cycles is returned in *nscf.
+ * With an external potential qm->Qext is set.
+ */
+
+void gmx_qchem_close(gmx_qchem_t qc);
+/* Tells the server we are done and closes the connection */
+
+
+void init_qchem(t_commrec *cr, t_QMrec *qm, t_MMrec *mm);
+/* Connects qm to (and if needed starts) the Q-Chem server, does nothing
+ * when qm is connected already
+ */
+
+void done_qchem(t_QMrec *qm);
+/* Closes the connection of qm, if any */
+
+real call_qchem(t_commrec *cr, t_forcerec *fr,
+                t_QMrec *qm, t_MMrec *mm, rvec f[], rvec fshift[]);
+/* Computes the QM energy (kJ/mol) and the gradients on the QM and MM
+ * atoms (stored in f, as in the other QM interfaces)
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _qm_qchem_h */
@@ -63,6 +63,17 @@
 #include "typedefs.h"
 #include <stdlib.h>
 #include "mtop_util.h"
+#include "futil.h"
+#include "string2.h"
+#include "thread_mpi/threads.h"
+#include "pme.h"
+#include "gmx_wallcycle.h"
+#include "gmx_cyclecounter.h"
+#include "nbnxn_search.h"
+#ifndef GMX_NATIVE_WINDOWS
+#include <sys/stat.h>
+#include <errno.h>
+#endif
 
 
 /* declarations of the interfaces to the QM packages. The _SH indicate
@@ -116,20 +127,19 @@ real
 call_orca(t_commrec *cr,t_forcerec *fr, t_QMrec *qm,
               t_MMrec *mm,rvec f[], rvec fshift[]);
 
+#elif defined GMX_QMMM_QCHEM
+/* Q-Chem server interface */
+#include "qm_qchem.h"
+
 #endif
 
 
 
 
-/* this struct and these comparison functions are needed for creating
- * a QMMM input for the QM routines from the QMMM neighbor list.  
+/* these comparison functions are needed for creating a QMMM input
+ * for the QM routines from the QMMM neighbor list.  
  */
 
-typedef struct {
-  int      j;
-  int      shift;
-} t_j_particle;
-
 static int struct_comp(const void *a, const void *b){
 
   return (int)(((t_j_particle *)a)->j)-(int)(((t_j_particle *)b)->j);
@@ -162,10 +172,12 @@ real call_QMroutine(t_commrec *cr, t_forcerec *fr, t_QMrec *qm,
     if (qm->QMmethod<eQMmethodRHF && !(mm->nrMMatoms))
     {
 #ifdef GMX_QMMM_MOPAC
+        QMMM_cycles_start(qm,eQMcycENGINE);
         if (qm->bSH)
             QMener = call_mopac_SH(cr,fr,qm,mm,f,fshift);
         else
             QMener = call_mopac(cr,fr,qm,mm,f,fshift);
+        QMMM_cycles_stop(qm,eQMcycENGINE);
 #else
         gmx_fatal(FARGS,"Semi-empirical QM only supported with Mopac.");
 #endif
@@ -184,13 +196,18 @@ real call_QMroutine(t_commrec *cr, t_forcerec *fr, t_QMrec *qm,
         else
         {
 #ifdef GMX_QMMM_GAMESS
+            /* GAMESS-UK runs in our process, we can only time it as a whole */
+            QMMM_cycles_start(qm,eQMcycENGINE);
             QMener = call_gamess(cr,fr,qm,mm,f,fshift);
+            QMMM_cycles_stop(qm,eQMcycENGINE);
 #elif defined GMX_QMMM_GAUSSIAN
             QMener = call_gaussian(cr,fr,qm,mm,f,fshift);
 #elif defined GMX_QMMM_ORCA
             QMener = call_orca(cr,fr,qm,mm,f,fshift);
+#elif defined GMX_QMMM_QCHEM
+            QMener = call_qchem(cr,fr,qm,mm,f,fshift);
 #else
-            gmx_fatal(FARGS,"Ab-initio calculation only supported with Gamess, Gaussian or ORCA.");
+            gmx_fatal(FARGS,"Ab-initio calculation only supported with Gamess, Gaussian, ORCA or Q-Chem.");
 #endif
         }
     }
@@ -218,8 +235,10 @@ void init_QMroutine(t_commrec *cr, t_QMrec *qm, t_MMrec *mm)
         init_gaussian(cr,qm,mm);
 #elif defined GMX_QMMM_ORCA
         init_orca(cr,qm,mm);
+#elif defined GMX_QMMM_QCHEM
+        init_qchem(cr,qm,mm);
 #else
-        gmx_fatal(FARGS,"Ab-initio calculation only supported with Gamess, Gaussian or ORCA.");   
+        gmx_fatal(FARGS,"Ab-initio calculation only supported with Gamess, Gaussian, ORCA or Q-Chem.");   
 #endif
     }
 } /* init_QMroutine */
@@ -289,6 +308,161 @@ static void punch_QMMM_excl(t_QMrec *qm,t_MMrec *mm,t_blocka *excls)
 } /* punch_QMMM_excl */
 
 
+/* The SCF guess of every QM calculation is carried over from the
+ * previous steps. The QM/MM layer keeps the wavefunction files itself,
+ * so different ONIOM layers and levels of theory can not overwrite
+ * each other's guesses, and hands the newest one to the QM program.
+ * GMX_QMMM_GUESS sets the number of previous steps used: 0 for a fresh
+ * guess every step, 1 (default) for the previous wavefunction, 2 to 4
+ * for an always stable predictor-corrector (ASPC) extrapolation, with
+ * QM programs that can combine densities.
+ */
+#define QMGUESS_MAX 4
+
+/* ASPC predictor coefficients, Kolafa, J. Comput. Chem. 25, 335 (2004) */
+static const real aspc_coeff[QMGUESS_MAX][QMGUESS_MAX] = {
+  { 1.0,  0.0,  0.0,  0.0 },
+  { 2.0, -1.0,  0.0,  0.0 },
+  { 2.5, -2.0,  0.5,  0.0 },
+  { 2.8, -2.8,  1.2, -0.2 }
+};
+
+static t_QMguess *mk_QMguess(const char *name)
+{
+  t_QMguess *guess;
+  char      *env,buf[STRLEN];
+  int       k;
+
+  snew(guess,1);
+  guess->nhist = 1;
+  env = getenv("GMX_QMMM_GUESS");
+  if (env)
+    sscanf(env,"%d",&guess->nhist);
+  if (guess->nhist < 0 || guess->nhist > QMGUESS_MAX)
+    gmx_fatal(FARGS,"GMX_QMMM_GUESS should be between 0 and %d",QMGUESS_MAX);
+
+  snew(guess->file,guess->nhist);
+  snew(guess->coeff,guess->nhist);
+  for(k=0;k<guess->nhist;k++){
+    sprintf(buf,"%s_%d.wfn",name,k);
+    guess->file[k] = gmx_strdup(buf);
+  }
+  return guess;
+} /* mk_QMguess */
+
+static void store_QMguess(t_QMguess *guess, const char *wfnfile)
+{
+  /* stores the wavefunction the QM program just left in wfnfile as the
+   * newest guess. wfnfile is NULL for QM programs that keep their
+   * wavefunctions in memory, then we only count them.
+   */
+  int k;
+
+  if (guess == NULL || guess->nhist == 0)
+    return;
+
+  if (wfnfile != NULL){
+    if (!gmx_fexist(wfnfile)){
+      /* no wavefunction to carry over, start from scratch */
+      guess->nstored = 0;
+      return;
+    }
+    /* shift the history by one, the oldest falls off the end */
+    for(k=min(guess->nstored,guess->nhist-1);k>0;k--){
+      gmx_file_rename(guess->file[k-1],guess->file[k]);
+    }
+    if (gmx_file_copy(wfnfile,guess->file[0],TRUE) != 0)
+      gmx_fatal(FARGS,"Could not copy the wavefunction %s to %s",
+                wfnfile,guess->file[0]);
+  }
+  if (guess->nstored < guess->nhist)
+    guess->nstored++;
+  for(k=0;k<guess->nstored;k++){
+    guess->coeff[k] = aspc_coeff[guess->nstored-1][k];
+  }
+} /* store_QMguess */
+
+static void finish_QMcall(gmx_large_int_t step,const char *layer,
+                          t_QMMMrec *qr,t_QMrec *qm)
+{
+  /* the QM calls can run in a thread of their own, so the log lines
+   * are collected in qr and written by print_QMMM_log
+   */
+  char buf[22],line[STRLEN];
+  int  len;
+
+  store_QMguess(qm->guess,qm->wfnfile);
+  qr->nSCF += qm->nSCF;
+  if (qm->nSCF > 0){
+    sprintf(line,"Step %s: QM %s converged in %d SCF cycles\n",
+            gmx_step_str(step,buf),layer,qm->nSCF);
+    len = (qr->QMlog ? strlen(qr->QMlog) : 0);
+    if (len + strlen(line) + 1 > qr->QMlog_nalloc){
+      qr->QMlog_nalloc = over_alloc_small(len + strlen(line) + 1);
+      srenew(qr->QMlog,qr->QMlog_nalloc);
+      qr->QMlog[len] = '\0';
+    }
+    strcat(qr->QMlog,line);
+  }
+} /* finish_QMcall */
+
+static void print_QMMM_log(FILE *fplog,t_QMMMrec *qr)
+{
+  /* writes and clears the log lines of the QM calls of this step */
+  if (qr->QMlog && qr->QMlog[0] != '\0'){
+    if (fplog)
+      fputs(qr->QMlog,fplog);
+    qr->QMlog[0] = '\0';
+  }
+} /* print_QMMM_log */
+
+const char *QMMM_workfile(t_QMrec *qm,const char *name,char *buf)
+{
+  if (qm->workdir == NULL)
+    return name;
+  sprintf(buf,"%s/%s",qm->workdir,name);
+  return buf;
+} /* QMMM_workfile */
+
+void QMMM_cycles_start(t_QMrec *qm,int stage)
+{
+  qm->cyc_start = (double)gmx_cycles_read();
+} /* QMMM_cycles_start */
+
+void QMMM_cycles_stop(t_QMrec *qm,int stage)
+{
+  qm->cyc[stage] += (double)gmx_cycles_read() - qm->cyc_start;
+  qm->ncyc[stage]++;
+} /* QMMM_cycles_stop */
+
+static void flush_QMrec_cycles(t_QMrec *qm,gmx_wallcycle_t wcycle)
+{
+  static const int ewc[eQMcycNR] = { ewcQMMM_INPUT, ewcQMMM_ENGINE, ewcQMMM_OUTPUT };
+  int k;
+
+  for(k=0;k<eQMcycNR;k++){
+    wallcycle_add(wcycle,ewc[k],qm->ncyc[k],qm->cyc[k]);
+    qm->ncyc[k] = 0;
+    qm->cyc[k]  = 0;
+  }
+} /* flush_QMrec_cycles */
+
+static void flush_QMMM_cycles(t_QMMMrec *qr,gmx_wallcycle_t wcycle)
+{
+  /* the stages may have been timed in other threads, which can not use
+   * wcycle, so they are collected here, when the QM calls are done
+   */
+  int i;
+
+  for(i=0;i<qr->nrQMlayers;i++){
+    flush_QMrec_cycles(qr->qm[i],wcycle);
+    if(qr->qm_low && qr->qm_low[i])
+      flush_QMrec_cycles(qr->qm_low[i],wcycle);
+  }
+  if(qr->qm_ref)
+    flush_QMrec_cycles(qr->qm_ref,wcycle);
+} /* flush_QMMM_cycles */
+
 /* end of QMMM subroutines */
 
 /* QMMM core routines */
@@ -411,6 +585,11 @@ t_QMrec *copy_QMrec(t_QMrec *qm)
   qmcopy->accuracy     = qm->accuracy;
   qmcopy->cpmcscf      = qm->cpmcscf;
   qmcopy->SAstep       = qm->SAstep;
+  qmcopy->wfnfile      = qm->wfnfile;
+  /* the long-range embedding is the same for all levels of theory */
+  qmcopy->Vext         = qm->Vext;
+  qmcopy->Eext         = qm->Eext;
+  qmcopy->Qext         = qm->Qext;
   snew(qmcopy->frontatoms,qm->nrQMatoms);
   snew(qmcopy->c12,qmcopy->nrQMatoms);
   snew(qmcopy->c6,qmcopy->nrQMatoms);
@@ -426,6 +605,392 @@ t_QMrec *copy_QMrec(t_QMrec *qm)
 
 } /*copy_QMrec */
 
+static t_QMrec *mk_QMrec_low(t_QMrec *qm,t_QMrec *level)
+{
+  /* the atoms of ONIOM layer qm at the level of theory of the next
+   * layer, level. The coordinates are copied from qm every step.
+   */
+  t_QMrec
+    *low;
+  int
+    i;
+
+  low = copy_QMrec(level);
+  low->nrQMatoms = qm->nrQMatoms;
+  for (i=0;i<qm->nrQMatoms;i++){
+    low->indexQM[i]        = qm->indexQM[i];
+    low->atomicnumberQM[i] = qm->atomicnumberQM[i];
+    low->shiftQM[i]        = qm->shiftQM[i];
+  }
+  low->QMcharge = qm->QMcharge;
+  /* the QM program sets its own wavefunction file */
+  low->wfnfile  = NULL;
+
+  return(low);
+} /* mk_QMrec_low */
+
+/* Asynchronous QM/MM: the QM calculation runs in its own thread while
+ * the MM forces are computed. The QM thread writes its forces to a
+ * private array, which is merged into the MD force array afterwards,
+ * so no locking is needed for the forces. The thread is started once
+ * and waits for the next calculation until done_QMMMrec stops it.
+ */
+struct gmx_QMMM_async {
+  tMPI_Thread_t       thread;
+  tMPI_Thread_mutex_t mutex;
+  tMPI_Thread_cond_t  cond;
+  gmx_bool        bStart;   /* set by the main thread, cleared when done */
+  gmx_bool        bStop;    /* set by done_QMMM_async, the thread exits */
+  gmx_bool        bRunning;
+  FILE            *fplog;
+  gmx_large_int_t step;
+  t_commrec       *cr;
+  t_forcerec      *fr;
+  rvec            *x;
+  t_mdatoms       *md;
+  rvec            *f;       /* QM forces, indexed like the MD forces */
+  int             f_nalloc;
+  rvec            fshift[SHIFTS];
+  gmx_bool        bFullQM;
+  real            QMener;
+};
+
+static void *QMMM_thread(void *arg);
+
+static gmx_QMMM_async_t mk_QMMM_async(t_QMMMrec *qr)
+{
+  gmx_QMMM_async_t as;
+  int              j;
+
+  for(j=0;j<qr->nrQMlayers;j++){
+    if(qr->qm[j]->bTS || qr->qm[j]->bOPT){
+      fprintf(stderr,"Note: QM optimizations change the coordinates, "
+              "ignoring GMX_QMMM_ASYNC\n");
+      return NULL;
+    }
+  }
+  snew(as,1);
+  tMPI_Thread_mutex_init(&as->mutex);
+  tMPI_Thread_cond_init(&as->cond);
+  if(tMPI_Thread_create(&as->thread,QMMM_thread,as) != 0)
+    gmx_fatal(FARGS,"Could not start the QM/MM thread");
+  fprintf(stderr,"Running the QM calculations concurrently with the MM forces\n");
+
+  return as;
+}
+
+static int QMMM_enum(const char *env,const char *names[],int nr)
+{
+  char *s;
+  int  i;
+
+  s = getenv(env);
+  for(i=0;i<nr;i++){
+    if(gmx_strcasecmp(s,names[i]) == 0)
+      return i;
+  }
+  gmx_fatal(FARGS,"Unknown value '%s' for %s",s,env);
+
+  return -1;
+}
+
+static void init_QMMM_mts(t_commrec *cr,t_inputrec *ir,t_forcerec *fr,
+                          int natoms)
+{
+  /* multiple time stepping: every step a cheap reference is computed
+   * and every nstQM steps the full QM correction on top of it, which
+   * is applied as an impulse in update_coords
+   */
+  t_QMMMrec *qr=fr->qr;
+  char      *env;
+
+  qr->nstQM = 1;
+  env = getenv("GMX_QMMM_NSTQM");
+  if(env)
+    sscanf(env,"%d",&qr->nstQM);
+  if(qr->nstQM < 1)
+    gmx_fatal(FARGS,"GMX_QMMM_NSTQM should be 1 or larger");
+  if(qr->nstQM == 1)
+    return;
+  if(!EI_DYNAMICS(ir->eI) || EI_VV(ir->eI)){
+    fprintf(stderr,"Note: QM/MM multiple time stepping is only supported "
+            "with leap-frog type integrators, ignoring GMX_QMMM_NSTQM\n");
+    qr->nstQM = 1;
+    return;
+  }
+  if(qr->QMMMscheme!=eQMMMschemenormal || qr->qm[0]->bTS || qr->qm[0]->bOPT)
+    gmx_fatal(FARGS,"QM/MM multiple time stepping is only supported with "
+              "normal QM/MM dynamics");
+  if(fr->bTwinRange && ir->nstcalclr > 1)
+    gmx_fatal(FARGS,"QM/MM multiple time stepping can not be combined with "
+              "twin-range interactions (nstcalclr > 1)");
+  if(fr->nstpme > 1)
+    gmx_fatal(FARGS,"QM/MM multiple time stepping can not be combined with "
+              "PME mesh multiple time stepping (GMX_PME_NSTMESH)");
+  if(qr->bPMEembed)
+    gmx_fatal(FARGS,"QM/MM multiple time stepping can not be combined with "
+              "the PME mesh embedding (GMX_QMMM_PME)");
+
+  if(getenv("GMX_QMMM_MTS_METHOD")){
+    qr->qm_ref           = copy_QMrec(qr->qm[0]);
+    qr->qm_ref->QMmethod = QMMM_enum("GMX_QMMM_MTS_METHOD",
+                                     eQMmethod_names,eQMmethodNR);
+    if(getenv("GMX_QMMM_MTS_BASIS"))
+      qr->qm_ref->QMbasis = QMMM_enum("GMX_QMMM_MTS_BASIS",
+                                      eQMbasis_names,eQMbasisNR);
+    qr->qm_ref->wfnfile  = NULL;
+    qr->qm_ref->guess    = mk_QMguess("QMguess_ref");
+    init_QMroutine(cr,qr->qm_ref,qr->mm);
+  }
+  qr->natoms_mts = natoms;
+  snew(qr->f_mts,qr->natoms_mts);
+  /* the QM plus MM atoms are a subset of the local atoms, so these
+   * never need to grow. f_ref stays zero without a QM reference.
+   */
+  snew(qr->f_QM,qr->natoms_mts);
+  snew(qr->fshift_QM,qr->natoms_mts);
+  snew(qr->f_ref,qr->natoms_mts);
+  snew(qr->fshift_ref,qr->natoms_mts);
+
+  fprintf(stderr,"Computing the full QM forces every %d steps, "
+          "with a %s%s%s reference every step\n",qr->nstQM,
+          qr->qm_ref ? eQMmethod_names[qr->qm_ref->QMmethod] : "MM",
+          qr->qm_ref ? "/" : "",
+          qr->qm_ref ? eQMbasis_names[qr->qm_ref->QMbasis] : "");
+}
+
+static void init_QMMM_pme(t_commrec *cr,t_inputrec *ir,t_forcerec *fr)
+{
+  /* the MM charges in the QM/MM neighborlist are embedded explicitly,
+   * the rest of the MM system enters the QM Hamiltonian through the
+   * potential and field of the PME mesh on the QM atoms
+   */
+  t_QMMMrec *qr=fr->qr;
+  t_QMrec   *qm=qr->qm[0];
+
+  if(getenv("GMX_QMMM_PME") == NULL)
+    return;
+  if(!EEL_PME(fr->eeltype))
+    gmx_fatal(FARGS,"GMX_QMMM_PME requires PME electrostatics");
+  if(qr->QMMMscheme!=eQMMMschemenormal)
+    gmx_fatal(FARGS,"GMX_QMMM_PME is only supported with normal QM/MM");
+  if(PAR(cr))
+    gmx_fatal(FARGS,"GMX_QMMM_PME does not work in parallel");
+  if(ir->efep != efepNO)
+    gmx_fatal(FARGS,"GMX_QMMM_PME does not work with free energy");
+  if(fr->nstpme > 1)
+    gmx_fatal(FARGS,"GMX_QMMM_PME can not be combined with PME mesh "
+              "multiple time stepping (GMX_PME_NSTMESH)");
+  /* the long-range part of the QM/MM virial is not computed */
+  if(ir->epc != epcNO)
+    gmx_fatal(FARGS,"GMX_QMMM_PME can not be combined with pressure "
+              "coupling");
+#ifndef GMX_QMMM_QCHEM
+  gmx_fatal(FARGS,"GMX_QMMM_PME is only supported with the Q-Chem interface");
+#endif
+
+  qr->bPMEembed = TRUE;
+  snew(qm->Vext,qm->nrQMatoms);
+  snew(qm->Eext,qm->nrQMatoms);
+  snew(qm->Qext,qm->nrQMatoms);
+  fprintf(stderr,"Embedding the QM region in the PME mesh potential\n");
+}
+
+static void QMMM_pme_pair(t_forcerec *fr,t_mdatoms *md,
+                          t_QMrec *qm,t_MMrec *mm,int i,int j,
+                          real *v,rvec e)
+{
+  /* the mesh part, erf(beta r)/r, of the potential v and field e of
+   * explicit MM charge j on QM atom i
+   */
+  real
+    beta=fr->ewaldcoeff,q,r2,rinv,br,ev;
+  rvec
+    dx;
+
+  q    = fr->epsfac*md->chargeA[mm->indexMM[j]];
+  rvec_sub(qm->xQM[i],mm->xMM[j],dx);
+  r2   = norm2(dx);
+  rinv = gmx_invsqrt(r2);
+  br   = beta*r2*rinv;
+  *v   = q*gmx_erf(br)*rinv;
+  /* the field is minus the gradient with respect to the QM atom */
+  ev   = (*v - q*M_2_SQRTPI*beta*exp(-br*br))*rinv*rinv;
+  svmul(ev,dx,e);
+}
+
+static void QMMM_pme_potential(t_commrec *cr,t_forcerec *fr,rvec x[],
+                               t_mdatoms *md,matrix box,
+                               t_QMrec *qm,t_MMrec *mm)
+{
+  /* puts the MM charges at the current coordinates on the PME mesh and
+   * interpolates the potential and field on the QM atoms. The QM
+   * charges are zero, so the mesh holds the MM charges only. The mesh
+   * part of the charges that are embedded explicitly is subtracted.
+   * Only the charged atoms of the explicit MM list need the
+   * correction, every one of these is seen by all QM atoms.
+   */
+  t_QMMMrec
+    *qr=fr->qr;
+  t_nrnb
+    nrnb;
+  matrix
+    vir;
+  real
+    ener,dvdl,v;
+  rvec
+    e;
+  int
+    i,j,status;
+
+  if(md->nr > qr->f_pme_nalloc){
+    qr->f_pme_nalloc = over_alloc_large(md->nr);
+    srenew(qr->f_pme,qr->f_pme_nalloc);
+  }
+  clear_rvecs(md->nr,qr->f_pme);
+  copy_mat(box,qr->box_pme);
+  /* the flop count is not reported, the embedding is an extra call */
+  init_nrnb(&nrnb);
+  status = gmx_pme_do(fr->pmedata,md->start,md->homenr,x,qr->f_pme,
+                      md->chargeA,md->chargeB,box,cr,0,0,&nrnb,NULL,vir,
+                      fr->ewaldcoeff,&ener,0,&dvdl,
+                      GMX_PME_SPREAD_Q | GMX_PME_SOLVE | GMX_PME_CALC_F);
+  if(status != 0)
+    gmx_fatal(FARGS,"Error %d in the PME mesh embedding of the QM atoms",
+              status);
+
+  gmx_pme_calc_pot_field(fr->pmedata,qm->nrQMatoms,qm->xQM,
+                         qm->Vext,qm->Eext);
+  for(i=0;i<qm->nrQMatoms;i++){
+    for(j=0;j<mm->nrMMatoms;j++){
+      if(md->chargeA[mm->indexMM[j]] == 0)
+        continue;
+      QMMM_pme_pair(fr,md,qm,mm,i,j,&v,e);
+      qm->Vext[i] -= v;
+      rvec_dec(qm->Eext[i],e);
+    }
+  }
+}
+
+static void QMMM_pme_forces(t_forcerec *fr,rvec x[],t_mdatoms *md,
+                            t_QMrec *qm,t_MMrec *mm,rvec f[])
+{
+  /* the reaction forces of the QM charges Qext that couple to the
+   * potential of QMMM_pme_potential: the field on the QM atoms, and on
+   * all MM atoms the mesh forces of the QM charges minus those of the
+   * explicit MM charges, which the QM program accounts for. The QM
+   * gradient itself is computed at a fixed potential.
+   */
+  real
+    v;
+  rvec
+    e;
+  int
+    i,j;
+
+  for(i=0;i<qm->nrQMatoms;i++){
+    for(j=0;j<DIM;j++)
+      f[qm->indexQM[i]][j] += qm->Qext[i]*qm->Eext[i][j];
+    for(j=0;j<mm->nrMMatoms;j++){
+      if(md->chargeA[mm->indexMM[j]] == 0)
+        continue;
+      QMMM_pme_pair(fr,md,qm,mm,i,j,&v,e);
+      /* the pair force is minus the one on the QM atom */
+      svmul(qm->Qext[i],e,e);
+      rvec_inc(f[mm->indexMM[j]],e);
+    }
+  }
+  gmx_pme_calc_source_f(fr->pmedata,fr->qr->box_pme,fr->ewaldcoeff,
+                        qm->nrQMatoms,qm->xQM,qm->Qext,
+                        md->nr,x,md->chargeA,f);
+}
+
+static void mk_QMworkdir(t_QMrec *qm,const char *name)
+{
+#ifndef GMX_NATIVE_WINDOWS
+  if (mkdir(name,0755) != 0 && errno != EEXIST)
+    gmx_fatal(FARGS,"Could not create the QM scratch directory %s",name);
+#endif
+  qm->workdir = gmx_strdup(name);
+} /* mk_QMworkdir */
+
+static void init_QMMM_oniom_parallel(t_QMMMrec *qr)
+{
+  /* All 2n-1 ONIOM calculations are independent, so they can run
+   * concurrently, each in a thread of its own. The QM programs that
+   * communicate through files get a scratch directory per
+   * calculation, Q-Chem a server connection per calculation (opened
+   * in init_QMMMrec). The others keep global state and run serially.
+   */
+  char
+    buf[STRLEN];
+  int
+    j;
+
+#if (defined GMX_QMMM_GAUSSIAN || defined GMX_QMMM_ORCA || defined GMX_QMMM_QCHEM) && !defined GMX_NATIVE_WINDOWS
+  for(j=0;j<qr->nrQMlayers;j++){
+    if(qr->qm[j]->bSH || qr->qm[j]->bTS || qr->qm[j]->bOPT){
+      fprintf(stderr,"Note: surface hopping and QM optimizations can not "
+              "run concurrently, running the ONIOM layers one by one\n");
+      return;
+    }
+  }
+#ifndef GMX_QMMM_QCHEM
+  for(j=0;j<qr->nrQMlayers;j++){
+    sprintf(buf,"QMlayer%d",j);
+    mk_QMworkdir(qr->qm[j],buf);
+    if(j < qr->nrQMlayers-1){
+      sprintf(buf,"QMlayer%d_low",j);
+      mk_QMworkdir(qr->qm_low[j],buf);
+    }
+  }
+#endif
+  qr->bParONIOM = TRUE;
+  fprintf(stderr,"Running the %d ONIOM QM calculations concurrently\n",
+          2*qr->nrQMlayers-1);
+#else
+  fprintf(stderr,"Note: concurrent ONIOM layers are only supported with "
+          "Gaussian, ORCA and Q-Chem, running the layers one by one\n");
+#endif
+} /* init_QMMM_oniom_parallel */
+
+static void init_QMMM_nm_parallel(t_commrec *cr,t_QMMMrec *qr)
+{
+  /* With normal mode analysis every node computes its own displaced
+   * geometries, so the QM calculations of the nodes run at the same
+   * time. Every node gets a scratch directory QMnode<i> for the files
+   * of the QM program and its SCF guesses. The QM programs that keep
+   * global state can not run concurrently.
+   */
+  char
+    dir[STRLEN],buf[STRLEN];
+  int
+    j,k,n;
+  t_QMrec
+    *qm;
+
+#if defined GMX_QMMM_GAMESS || defined GMX_QMMM_MOPAC
+  gmx_fatal(FARGS,"Normal mode analysis of a QM/MM system on more than one "
+            "node is only supported with Gaussian, ORCA or Q-Chem");
+#endif
+  sprintf(dir,"QMnode%d",cr->nodeid);
+  n = qr->QMMMscheme==eQMMMschemeoniom ? 2*qr->nrQMlayers-1 : 1;
+  for(j=0;j<n;j++){
+    qm = j < qr->nrQMlayers ? qr->qm[j] : qr->qm_low[j-qr->nrQMlayers];
+    if(qm->bSH)
+      gmx_fatal(FARGS,"Surface hopping does not work on more than one node");
+    mk_QMworkdir(qm,dir);
+    for(k=0;qm->guess && k<qm->guess->nhist;k++){
+      QMMM_workfile(qm,qm->guess->file[k],buf);
+      sfree(qm->guess->file[k]);
+      qm->guess->file[k] = gmx_strdup(buf);
+    }
+  }
+  if(MASTER(cr))
+    fprintf(stderr,"Running the QM calculations of the %d nodes "
+            "concurrently, each in a directory QMnode<i>\n",cr->nnodes);
+} /* init_QMMM_nm_parallel */
+
 t_QMMMrec *mk_QMMMrec(void)
 {
 
@@ -462,11 +1027,22 @@ void init_QMMMrec(t_commrec *cr,
   int       a_offset;
   t_ilist   *ilist_mol;
   gmx_mtop_atomlookup_t alook;
+  char      guessname[STRLEN];
 
   c6au  = (HARTREE2KJ*AVOGADRO*pow(BOHR2NM,6)); 
   c12au = (HARTREE2KJ*AVOGADRO*pow(BOHR2NM,12)); 
-  /* issue a fatal if the user wants to run with more than one node */
-  if ( PAR(cr)) gmx_fatal(FARGS,"QM/MM does not work in parallel, use a single node instead\n");
+  /* issue a fatal if the user wants to run with more than one node,
+   * only normal mode analysis divides its independent force
+   * calculations over the nodes, each with the full system
+   */
+  if ( PAR(cr) && ir->eI != eiNM) gmx_fatal(FARGS,"QM/MM does not work in parallel, use a single node instead\n");
+
+  /* with the Verlet scheme the QM/MM list is made from the simple
+   * cluster pair lists, see nbnxn_make_qmmm_list
+   */
+  if (fr->cutoff_scheme == ecutsVERLET &&
+      !nbnxn_kernel_pairlist_simple(fr->nbv->grp[eintLocal].kernel_type))
+    gmx_fatal(FARGS,"QM/MM with the Verlet cut-off scheme is not supported with GPUs\n");
 
   /* Make a local copy of the QMMMrec */
   qr = fr->qr;
@@ -563,6 +1139,8 @@ void init_QMMMrec(t_commrec *cr,
       /* store QM atoms in this layer in the QMrec and initialise layer 
        */
       init_QMrec(j,qr->qm[j],qm_nr,qm_arr,mtop,ir);
+      sprintf(guessname,"QMguess%d",j);
+      qr->qm[j]->guess = mk_QMguess(guessname);
       
       /* we now store the LJ C6 and C12 parameters in QM rec in case
        * we need to do an optimization 
@@ -629,6 +1207,7 @@ void init_QMMMrec(t_commrec *cr,
     /* store QM atoms in the QMrec and initialise
      */
     init_QMrec(0,qr->qm[0],qm_nr,qm_arr,mtop,ir);
+    qr->qm[0]->guess = mk_QMguess("QMguess0");
     if(qr->qm[0]->bOPT || qr->qm[0]->bTS)
     {
         for(i=0;i<qm_nr;i++)
@@ -681,7 +1260,30 @@ void init_QMMMrec(t_commrec *cr,
     mm->scalefactor  = ir->scalefactor;
     mm->nrMMatoms    = 0;
     qr->mm           = mm;
+    /* the lower level calculations on layers 0..n-2 need their own
+     * guesses, as they use a different level of theory
+     */
+    snew(qr->qm_low,qr->nrQMlayers);
+    for(j=0;j<qr->nrQMlayers-1;j++){
+      qr->qm_low[j] = mk_QMrec_low(qr->qm[j],qr->qm[j+1]);
+      sprintf(guessname,"QMguess%d_low",j);
+      qr->qm_low[j]->guess = mk_QMguess(guessname);
+    }
+    if (getenv("GMX_QMMM_ONIOM_PARALLEL") != NULL){
+      if (PAR(cr))
+        fprintf(stderr,"Note: the nodes already run their QM calculations "
+                "concurrently, running the ONIOM layers one by one\n");
+      else
+        init_QMMM_oniom_parallel(qr);
+    }
   }
+  if (PAR(cr))
+    init_QMMM_nm_parallel(cr,qr);
+  if (getenv("GMX_QMMM_ASYNC") != NULL)
+    qr->async = mk_QMMM_async(qr);
+  if (qr->qm[0]->guess->nhist > 1)
+    fprintf(stderr,"Extrapolating the SCF guess from the last %d steps\n",
+            qr->qm[0]->guess->nhist);
   
   /* these variables get updated in the update QMMMrec */
 
@@ -702,277 +1304,312 @@ void init_QMMMrec(t_commrec *cr,
     }
     else 
     { 
-        /* ab initio calculation requested (gamess/gaussian/ORCA) */
+        /* ab initio calculation requested (gamess/gaussian/ORCA/Q-Chem) */
 #ifdef GMX_QMMM_GAMESS
         init_gamess(cr,qr->qm[0],qr->mm);
 #elif defined GMX_QMMM_GAUSSIAN
         init_gaussian(cr,qr->qm[0],qr->mm);
 #elif defined GMX_QMMM_ORCA
         init_orca(cr,qr->qm[0],qr->mm);
+#elif defined GMX_QMMM_QCHEM
+        init_qchem(cr,qr->qm[0],qr->mm);
 #else
-        gmx_fatal(FARGS,"Ab-initio calculation only supported with Gamess, Gaussian or ORCA.");
+        gmx_fatal(FARGS,"Ab-initio calculation only supported with Gamess, Gaussian, ORCA or Q-Chem.");
 #endif
     }
   }
+#ifdef GMX_QMMM_QCHEM
+  /* every QM calculation talks to the server over a connection of its
+   * own, which is opened here, so the ONIOM layers can run concurrently
+   */
+  for(j=0;j<qr->nrQMlayers;j++){
+    init_qchem(cr,qr->qm[j],qr->mm);
+    if(qr->qm_low && qr->qm_low[j])
+      init_qchem(cr,qr->qm_low[j],qr->mm);
+  }
+#endif
+  init_QMMM_pme(cr,ir,fr);
+  /* the reference level is initialised after the full QM level */
+  init_QMMM_mts(cr,ir,fr,mtop->natoms);
 } /* init_QMMMrec */
 
-void update_QMMMrec(t_commrec *cr,
-		    t_forcerec *fr,
-		    rvec x[],
-		    t_mdatoms *md,
-		    matrix box,
-		    gmx_localtop_t *top)
+static void make_QMMM_embedding(t_commrec *cr,
+                                t_forcerec *fr,
+                                rvec x[],
+                                t_mdatoms *md,
+                                gmx_localtop_t *top,
+                                t_pbc *pbc)
 {
-  /* updates the coordinates of both QM atoms and MM atoms and stores
-   * them in the QMMMrec.  
-   *
-   * NOTE: is NOT yet working if there are no PBC. Also in ns.c, simple
-   * ns needs to be fixed!  
+  /* (re)builds the MM embedding of the QM system from the QMMM
+   * neighborlist. This is only needed on neighbor search steps, in
+   * between the list and the shifts do not change.
+   * Duplicates are removed with a marker array over the local atoms,
+   * only the unique MM particles are sorted.
    */
   int 
-    mm_max=0,mm_nr=0,mm_nr_new,i,j,is,k,shift;
-  t_j_particle 
-    *mm_j_particles=NULL,*qm_i_particles=NULL;
+    mm_nr=0,i,j,k,a,is,shift,ix,iy,iz,nnodes,total,offset;
   t_QMMMrec 
     *qr; 
+  t_QMMMenv
+    *env;
   t_nblist 
-    QMMMlist;
+    *QMMMlist;
   rvec
-    dx,crd;
-  int
-    *MMatoms;
+    dx;
   t_QMrec
     *qm;
   t_MMrec
     *mm;
-  t_pbc
-    pbc;
-  int  
-    *parallelMMarray=NULL;
+  gmx_bool
+    bAllMM;
   real
     c12au,c6au;
 
   c6au  = (HARTREE2KJ*AVOGADRO*pow(BOHR2NM,6)); 
   c12au = (HARTREE2KJ*AVOGADRO*pow(BOHR2NM,12)); 
 
-  /* every cpu has this array. On every processor we fill this array
-   * with 1's and 0's. 1's indicate the atoms is a QM atom on the
-   * current cpu in a later stage these arrays are all summed. indexes
-   * > 0 indicate the atom is a QM atom. Every node therefore knows
-   * whcih atoms are part of the QM subsystem.  
+  qr       = fr->qr;
+  env      = &qr->env;
+  mm       = qr->mm;
+  qm       = qr->qm[0]; /* in case of normal QMMM, there is only one group */
+  QMMMlist = &fr->QMMMlist;
+
+  if (md->nr > env->mark_nalloc){
+    env->mark_nalloc = over_alloc_large(md->nr);
+    srenew(env->mark,env->mark_nalloc);
+    for(i=0;i<env->mark_nalloc;i++){
+      env->mark[i] = 0;
+    }
+  }
+  /* with optimizations all MM particles are needed for the LJ
+   * interactions, otherwise only the charged ones
    */
-  /* copy some pointers */
-  qr          = fr->qr;
-  mm          = qr->mm;
-  QMMMlist    = fr->QMMMlist;
-
-  
+  bAllMM = (qm->bTS || qm->bOPT);
 
-  /*  init_pbc(box);  needs to be called first, see pbc.h */
-  set_pbc_dd(&pbc,fr->ePBC,DOMAINDECOMP(cr) ? cr->dd : NULL,FALSE,box);
-  /* only in standard (normal) QMMM we need the neighbouring MM
-   * particles to provide a electric field of point charges for the QM
-   * atoms.  
+  /* we NOW create/update a number of QMMMrec entries:
+   *
+   * 1) the shiftQM, containing the shifts of the QM atoms
+   *
+   * 2) the indexMM array, containing the index of the MM atoms
+   * 
+   * 3) the shiftMM, containing the shifts of the MM atoms
+   *
+   * the shifts are used for computing virial of the QM/MM particles.
    */
-  if(qr->QMMMscheme==eQMMMschemenormal){ /* also implies 1 QM-layer */
-    /* we NOW create/update a number of QMMMrec entries:
-     *
-     * 1) the shiftQM, containing the shifts of the QM atoms
-     *
-     * 2) the indexMM array, containing the index of the MM atoms
-     * 
-     * 3) the shiftMM, containing the shifts of the MM atoms
-     *
-     * 4) the shifted coordinates of the MM atoms
-     *
-     * the shifts are used for computing virial of the QM/MM particles.
-     */
-    qm = qr->qm[0]; /* in case of normal QMMM, there is only one group */
-    snew(qm_i_particles,QMMMlist.nri);
-    if(QMMMlist.nri){
-      qm_i_particles[0].shift = XYZ2IS(0,0,0);
-      for(i=0;i<QMMMlist.nri;i++){
-	qm_i_particles[i].j     = QMMMlist.iinr[i];
-	
-	if(i){
-	  qm_i_particles[i].shift = pbc_dx_aiuc(&pbc,x[QMMMlist.iinr[0]],
-						x[QMMMlist.iinr[i]],dx);
-	  
-	}
-	/* However, since nri >= nrQMatoms, we do a quicksort, and throw
-	 * out double, triple, etc. entries later, as we do for the MM
-	 * list too.  
-	 */
-	
-	/* compute the shift for the MM j-particles with respect to
-	 * the QM i-particle and store them. 
-	 */
-	
-	crd[0] = IS2X(QMMMlist.shift[i]) + IS2X(qm_i_particles[i].shift);
-	crd[1] = IS2Y(QMMMlist.shift[i]) + IS2Y(qm_i_particles[i].shift);
-	crd[2] = IS2Z(QMMMlist.shift[i]) + IS2Z(qm_i_particles[i].shift);
-	is = XYZ2IS(crd[0],crd[1],crd[2]); 
-	for(j=QMMMlist.jindex[i];
-	    j<QMMMlist.jindex[i+1];
-	    j++){
-	  if(mm_nr >= mm_max){
-	    mm_max += 1000;
-	    srenew(mm_j_particles,mm_max);
-	  }	  
-	  
-	  mm_j_particles[mm_nr].j = QMMMlist.jjnr[j];
-	  mm_j_particles[mm_nr].shift = is;
-	  mm_nr++;
-	}
+  if(QMMMlist->nri){
+    for(i=0;i<QMMMlist->nri;i++){
+      /* the shift of the QM i-particle with respect to the first one */
+      if(i){
+        shift = pbc_dx_aiuc(pbc,x[QMMMlist->iinr[0]],x[QMMMlist->iinr[i]],dx);
       }
-      
-      /* quicksort QM and MM shift arrays and throw away multiple entries */
-      
-
-
-      qsort(qm_i_particles,QMMMlist.nri,
-	    (size_t)sizeof(qm_i_particles[0]),
-	    struct_comp);
-      qsort(mm_j_particles,mm_nr,
-	    (size_t)sizeof(mm_j_particles[0]),
-	    struct_comp);
-      /* remove multiples in the QM shift array, since in init_QMMM() we
-       * went through the atom numbers from 0 to md.nr, the order sorted
-       * here matches the one of QMindex already.
-       */
-      j=0;
-      for(i=0;i<QMMMlist.nri;i++){
-	if (i==0 || qm_i_particles[i].j!=qm_i_particles[i-1].j){
-	  qm_i_particles[j++] = qm_i_particles[i];
-	}
-      }
-      mm_nr_new = 0;
-      if(qm->bTS||qm->bOPT){
-	/* only remove double entries for the MM array */
-	for(i=0;i<mm_nr;i++){
-	  if((i==0 || mm_j_particles[i].j!=mm_j_particles[i-1].j)
-	     && !md->bQM[mm_j_particles[i].j]){
-	    mm_j_particles[mm_nr_new++] = mm_j_particles[i];
-	  }
-	}
-      }      
-      /* we also remove mm atoms that have no charges! 
-      * actually this is already done in the ns.c  
-      */
       else{
-	for(i=0;i<mm_nr;i++){
-	  if((i==0 || mm_j_particles[i].j!=mm_j_particles[i-1].j)
-	     && !md->bQM[mm_j_particles[i].j] 
-	     && (md->chargeA[mm_j_particles[i].j]
-		 || (md->chargeB && md->chargeB[mm_j_particles[i].j]))) {
-	    mm_j_particles[mm_nr_new++] = mm_j_particles[i];
-	  }
-	}
+        shift = XYZ2IS(0,0,0);
       }
-      mm_nr = mm_nr_new;
-      /* store the data retrieved above into the QMMMrec
-       */    
-      k=0;
-      /* Keep the compiler happy,
-       * shift will always be set in the loop for i=0
-       */
-      shift = 0;
-      for(i=0;i<qm->nrQMatoms;i++){
-	/* not all qm particles might have appeared as i
-	 * particles. They might have been part of the same charge
-	 * group for instance.
-	 */
-	if (qm->indexQM[i] == qm_i_particles[k].j) {
-	  shift = qm_i_particles[k++].shift;
-	}
-	/* use previous shift, assuming they belong the same charge
-	 * group anyway,
-	 */
-	
-	qm->shiftQM[i] = shift;
+      /* nri >= nrQMatoms, the first occurence of a QM atom is used */
+      a = QMMMlist->iinr[i];
+      if (!env->mark[a]){
+        env->mark[a] = shift + 1;
       }
-    }
-    /* parallel excecution */
-    if(PAR(cr)){
-      snew(parallelMMarray,2*(md->nr)); 
-      /* only MM particles have a 1 at their atomnumber. The second part
-       * of the array contains the shifts. Thus:
-       * p[i]=1/0 depending on wether atomnumber i is a MM particle in the QM
-       * step or not. p[i+md->nr] is the shift of atomnumber i.
+
+      /* compute the shift for the MM j-particles with respect to
+       * the QM i-particle and store them. 
        */
-      for(i=0;i<2*(md->nr);i++){
-	parallelMMarray[i]=0;
-      }
-      
-      for(i=0;i<mm_nr;i++){
-	parallelMMarray[mm_j_particles[i].j]=1;
-	parallelMMarray[mm_j_particles[i].j+(md->nr)]=mm_j_particles[i].shift;
+      ix = IS2X(QMMMlist->shift[i]) + IS2X(shift);
+      iy = IS2Y(QMMMlist->shift[i]) + IS2Y(shift);
+      iz = IS2Z(QMMMlist->shift[i]) + IS2Z(shift);
+      is = XYZ2IS(ix,iy,iz);
+      if (mm_nr + QMMMlist->jindex[i+1] - QMMMlist->jindex[i] > env->mm_nalloc){
+        env->mm_nalloc = over_alloc_large(mm_nr + QMMMlist->jindex[i+1] - 
+                                          QMMMlist->jindex[i]);
+        srenew(env->mm,env->mm_nalloc);
       }
-      gmx_sumi(md->nr,parallelMMarray,cr);
-      mm_nr=0;
-      
-      mm_max = 0;
-      for(i=0;i<md->nr;i++){
-	if(parallelMMarray[i]){
-	  if(mm_nr >= mm_max){
-	    mm_max += 1000;
-	    srenew(mm->indexMM,mm_max);
-	    srenew(mm->shiftMM,mm_max);
-	  }
-	  mm->indexMM[mm_nr]  = i;
-	  mm->shiftMM[mm_nr++]= parallelMMarray[i+md->nr]/parallelMMarray[i];
-	}
+      for(j=QMMMlist->jindex[i];j<QMMMlist->jindex[i+1];j++){
+        a = QMMMlist->jjnr[j];
+        /* we also remove mm atoms that have no charges! 
+         * actually this is already done in the ns.c  
+         */
+        if (!env->mark[a] && !md->bQM[a] &&
+            (bAllMM || md->chargeA[a] || (md->chargeB && md->chargeB[a]))){
+          env->mark[a] = 1;
+          env->mm[mm_nr].j     = a;
+          env->mm[mm_nr].shift = is;
+          mm_nr++;
+        }
       }
-      mm->nrMMatoms=mm_nr;
-      free(parallelMMarray);
     }
-    /* serial execution */
-    else{
-      mm->nrMMatoms = mm_nr;
-      srenew(mm->shiftMM,mm_nr);
-      srenew(mm->indexMM,mm_nr);
-      for(i=0;i<mm_nr;i++){
-	mm->indexMM[i]=mm_j_particles[i].j;
-	mm->shiftMM[i]=mm_j_particles[i].shift;
+    /* store the QM shifts; not all qm particles might have appeared as
+     * i particles, they might have been part of the same charge group
+     * for instance. Then we use the previous shift, assuming they
+     * belong the same charge group anyway.
+     */
+    shift = 0;
+    for(i=0;i<qm->nrQMatoms;i++){
+      a = qm->indexQM[i];
+      if (env->mark[a]){
+        shift = env->mark[a] - 1;
       }
-      
+      qm->shiftQM[i] = shift;
     }
-    /* (re) allocate memory for the MM coordiate array. The QM
-     * coordinate array was already allocated in init_QMMM, and is
-     * only (re)filled in the update_QMMM_coordinates routine 
-     */
-    srenew(mm->xMM,mm->nrMMatoms);
-    /* now we (re) fill the array that contains the MM charges with
-     * the forcefield charges. If requested, these charges will be
-     * scaled by a factor 
+    /* reset the markers, only touching the entries we set */
+    for(i=0;i<QMMMlist->nri;i++){
+      env->mark[QMMMlist->iinr[i]] = 0;
+    }
+    for(i=0;i<mm_nr;i++){
+      env->mark[env->mm[i].j] = 0;
+    }
+  }
+
+  if(PAR(cr)){
+    /* Every node only has part of the embedding. We exchange only the
+     * (index,shift) pairs of the listed MM particles, not an array over
+     * all atoms: first the counts, then the pairs.
      */
-    srenew(mm->MMcharges,mm->nrMMatoms);
-    for(i=0;i<mm->nrMMatoms;i++){/* no free energy yet */
-      mm->MMcharges[i]=md->chargeA[mm->indexMM[i]]*mm->scalefactor; 
-    }  
-    if(qm->bTS||qm->bOPT){
-      /* store (copy) the c6 and c12 parameters into the MMrec struct 
-       */
-      srenew(mm->c6,mm->nrMMatoms);
-      srenew(mm->c12,mm->nrMMatoms);
-      for (i=0;i<mm->nrMMatoms;i++)
-      {
-          /* nbfp now includes the 6.0/12.0 derivative prefactors */
-          mm->c6[i]  = C6(fr->nbfp,top->idef.atnr,md->typeA[mm->indexMM[i]],md->typeA[mm->indexMM[i]])/c6au/6.0;
-          mm->c12[i] =C12(fr->nbfp,top->idef.atnr,md->typeA[mm->indexMM[i]],md->typeA[mm->indexMM[i]])/c12au/12.0;
+    nnodes = cr->nnodes;
+    if (2*nnodes > env->buf_nalloc){
+      env->buf_nalloc = over_alloc_small(2*nnodes);
+      srenew(env->buf,env->buf_nalloc);
+    }
+    for(i=0;i<nnodes;i++){
+      env->buf[i] = 0;
+    }
+    env->buf[cr->nodeid] = mm_nr;
+    gmx_sumi(nnodes,env->buf,cr);
+    total  = 0;
+    offset = 0;
+    for(i=0;i<nnodes;i++){
+      if (i == cr->nodeid)
+        offset = total;
+      total += env->buf[i];
+    }
+    if (2*total > env->buf_nalloc){
+      env->buf_nalloc = over_alloc_large(2*total);
+      srenew(env->buf,env->buf_nalloc);
+    }
+    for(i=0;i<2*total;i++){
+      env->buf[i] = 0;
+    }
+    for(i=0;i<mm_nr;i++){
+      env->buf[2*(offset+i)]   = env->mm[i].j;
+      env->buf[2*(offset+i)+1] = env->mm[i].shift;
+    }
+    gmx_sumi(2*total,env->buf,cr);
+    if (total > env->mm_nalloc){
+      env->mm_nalloc = over_alloc_large(total);
+      srenew(env->mm,env->mm_nalloc);
+    }
+    /* merge, particles listed on more than one node are taken once */
+    mm_nr = 0;
+    for(i=0;i<total;i++){
+      a = env->buf[2*i];
+      if (!env->mark[a]){
+        env->mark[a] = 1;
+        env->mm[mm_nr].j       = a;
+        env->mm[mm_nr++].shift = env->buf[2*i+1];
       }
-      punch_QMMM_excl(qr->qm[0],mm,&(top->excls));
+    }
+    for(i=0;i<mm_nr;i++){
+      env->mark[env->mm[i].j] = 0;
+    }
+  }
+  /* sort on atom index, this keeps the MM order, and thus the QM
+   * input, independent of the order of the neighborlist
+   */
+  qsort(env->mm,mm_nr,(size_t)sizeof(env->mm[0]),struct_comp);
+  env->mm_nr = mm_nr;
+
+  /* store the data retrieved above into the MMrec, (re) allocating
+   * memory only when the embedding grew
+   */
+  mm->nrMMatoms = mm_nr;
+  if (mm_nr > env->MMrec_nalloc){
+    env->MMrec_nalloc = over_alloc_large(mm_nr);
+    srenew(mm->indexMM,env->MMrec_nalloc);
+    srenew(mm->shiftMM,env->MMrec_nalloc);
+    srenew(mm->xMM,env->MMrec_nalloc);
+    srenew(mm->MMcharges,env->MMrec_nalloc);
+    if(bAllMM){
+      srenew(mm->c6,env->MMrec_nalloc);
+      srenew(mm->c12,env->MMrec_nalloc);
+    }
+  }
+  /* now we (re) fill the array that contains the MM charges with
+   * the forcefield charges. If requested, these charges will be
+   * scaled by a factor 
+   */
+  for(i=0;i<mm_nr;i++){
+    k = env->mm[i].j;
+    mm->indexMM[i]   = k;
+    mm->shiftMM[i]   = env->mm[i].shift;
+    mm->MMcharges[i] = md->chargeA[k]*mm->scalefactor; /* no free energy yet */
+  }
+  if(bAllMM){
+    /* store (copy) the c6 and c12 parameters into the MMrec struct 
+     */
+    for (i=0;i<mm_nr;i++)
+    {
+      /* nbfp now includes the 6.0/12.0 derivative prefactors */
+      mm->c6[i]  = C6(fr->nbfp,top->idef.atnr,md->typeA[mm->indexMM[i]],md->typeA[mm->indexMM[i]])/c6au/6.0;
+      mm->c12[i] =C12(fr->nbfp,top->idef.atnr,md->typeA[mm->indexMM[i]],md->typeA[mm->indexMM[i]])/c12au/12.0;
+    }
+    punch_QMMM_excl(qm,mm,&(top->excls));
+  }
+} /* make_QMMM_embedding */
+
+void update_QMMMrec(t_commrec *cr,
+		    t_forcerec *fr,
+		    rvec x[],
+		    t_mdatoms *md,
+		    matrix box,
+		    gmx_localtop_t *top,
+		    gmx_bool bNS,
+		    gmx_wallcycle_t wcycle)
+{
+  /* updates the coordinates of both QM atoms and MM atoms and stores
+   * them in the QMMMrec.  
+   *
+   * NOTE: is NOT yet working if there are no PBC. Also in ns.c, simple
+   * ns needs to be fixed!  
+   */
+  int 
+    i,j;
+  t_QMMMrec 
+    *qr; 
+  rvec
+    dx;
+  t_QMrec
+    *qm;
+  t_MMrec
+    *mm;
+  t_pbc
+    pbc;
+
+  /* copy some pointers */
+  qr          = fr->qr;
+  mm          = qr->mm;
+
+  wallcycle_start(wcycle,ewcQMMM);
+  /* only in standard (normal) QMMM we need the neighbouring MM
+   * particles to provide a electric field of point charges for the QM
+   * atoms.  
+   */
+  if(qr->QMMMscheme==eQMMMschemenormal){ /* also implies 1 QM-layer */
+    if (bNS){
+      /*  init_pbc(box);  needs to be called first, see pbc.h */
+      set_pbc_dd(&pbc,fr->ePBC,DOMAINDECOMP(cr) ? cr->dd : NULL,FALSE,box);
+      wallcycle_start(wcycle,ewcQMMM_EMBED);
+      make_QMMM_embedding(cr,fr,x,md,top,&pbc);
+      wallcycle_stop(wcycle,ewcQMMM_EMBED);
     }
     /* the next routine fills the coordinate fields in the QMMM rec of
      * both the qunatum atoms and the MM atoms, using the shifts
      * calculated above.  
      */
-
     update_QMMM_coord(x,fr,qr->qm[0],qr->mm);
-    free(qm_i_particles);
-    free(mm_j_particles);
+    if(qr->bPMEembed)
+      QMMM_pme_potential(cr,fr,x,md,box,qr->qm[0],qr->mm);
   } 
   else { /* ONIOM */ /* ????? */
+    set_pbc_dd(&pbc,fr->ePBC,DOMAINDECOMP(cr) ? cr->dd : NULL,FALSE,box);
     mm->nrMMatoms=0;
     /* do for each layer */
     for (j=0;j<qr->nrQMlayers;j++){
@@ -985,18 +1622,145 @@ void update_QMMMrec(t_commrec *cr,
       update_QMMM_coord(x,fr,qm,mm);    
     }
   }
+  wallcycle_stop(wcycle,ewcQMMM);
 } /* update_QMMM_rec */
 
 
-real calculate_QMMM(t_commrec *cr,
-		    rvec x[],rvec f[],
-		    t_forcerec *fr,
-		    t_mdatoms *md)
+real add_QMMM_mts_forces(t_QMMMrec *qr,gmx_bool bFullQM,real Eref,real EQM,
+                         rvec f[],rvec fshift_tot[])
+{
+  t_QMrec
+    *qm=qr->qm[0];
+  t_MMrec
+    *mm=qr->mm;
+  rvec
+    *forces=qr->f_QM,*fshift=qr->fshift_QM;
+  rvec
+    *fref=qr->f_ref,*fshiftref=qr->fshift_ref;
+  int
+    n,i,j,a,is;
+
+  n = qm->nrQMatoms+mm->nrMMatoms;
+  if(bFullQM){
+    qr->dE_mts = EQM - Eref;
+    clear_rvecs(qr->natoms_mts,qr->f_mts);
+  }
+  for(i=0;i<n;i++){
+    if(i < qm->nrQMatoms){
+      a  = qm->indexQM[i];
+      is = qm->shiftQM[i];
+    }
+    else{
+      a  = mm->indexMM[i-qm->nrQMatoms];
+      is = mm->shiftMM[i-qm->nrQMatoms];
+    }
+    for(j=0;j<DIM;j++){
+      f[a][j]           -= fref[i][j];
+      fshift_tot[is][j] += fshiftref[i][j];
+      if(bFullQM){
+        f[a][j]           -= forces[i][j] - fref[i][j];
+        fshift_tot[is][j] += fshift[i][j] - fshiftref[i][j];
+        qr->f_mts[a][j]   -= forces[i][j] - fref[i][j];
+      }
+    }
+  }
+
+  return Eref + qr->dE_mts;
+} /* add_QMMM_mts_forces */
+
+static real do_QMMM_mts(gmx_large_int_t step,
+                        t_commrec *cr,
+                        rvec f[],rvec fshift_tot[],
+                        t_forcerec *fr,
+                        gmx_bool bFullQM)
+{
+  /* computes the reference and, with bFullQM, the full QM gradients
+   * and adds them to f with add_QMMM_mts_forces
+   */
+  t_QMMMrec
+    *qr=fr->qr;
+  t_QMrec
+    *qm=qr->qm[0],*ref=qr->qm_ref;
+  t_MMrec
+    *mm=qr->mm;
+  real
+    Eref=0.0,EQM=0.0;
+  int
+    i;
+
+  if(ref){
+    for(i=0;i<qm->nrQMatoms;i++){
+      copy_rvec(qm->xQM[i],ref->xQM[i]);
+      ref->shiftQM[i] = qm->shiftQM[i];
+    }
+    Eref = call_QMroutine(cr,fr,ref,mm,qr->f_ref,qr->fshift_ref);
+    finish_QMcall(step,"reference",qr,ref);
+  }
+  if(bFullQM){
+    EQM = call_QMroutine(cr,fr,qm,mm,qr->f_QM,qr->fshift_QM);
+    finish_QMcall(step,"calculation",qr,qm);
+  }
+
+  return add_QMMM_mts_forces(qr,bFullQM,Eref,EQM,f,fshift_tot);
+} /* do_QMMM_mts */
+
+/* One of the independent QM calculations of a multi-layer ONIOM step */
+typedef struct {
+  t_QMrec       *qm;
+  t_MMrec       *mm;
+  t_commrec     *cr;
+  t_forcerec    *fr;
+  rvec          *f;         /* the gradient on the atoms of qm */
+  rvec          *fshift;
+  real          ener;
+  tMPI_Thread_t thread;
+} t_QMsubcalc;
+
+static void *QMsubcalc_thread(void *arg)
+{
+  t_QMsubcalc *sub=(t_QMsubcalc *)arg;
+
+  sub->ener = call_QMroutine(sub->cr,sub->fr,sub->qm,sub->mm,
+                             sub->f,sub->fshift);
+
+  return NULL;
+} /* QMsubcalc_thread */
+
+static void run_QMsubcalc_parallel(int nsub,t_QMsubcalc sub[])
+{
+  /* runs calculation 0 on this thread and the others each in a
+   * thread of their own. The QM programs are initialized up front,
+   * as their init routines are not thread safe.
+   */
+  int
+    k;
+
+  for(k=0;k<nsub;k++)
+    init_QMroutine(sub[k].cr,sub[k].qm,sub[k].mm);
+  for(k=1;k<nsub;k++){
+    if(tMPI_Thread_create(&sub[k].thread,QMsubcalc_thread,&sub[k]) != 0)
+      gmx_fatal(FARGS,"Could not start an ONIOM QM thread");
+  }
+  QMsubcalc_thread(&sub[0]);
+  for(k=1;k<nsub;k++){
+    if(tMPI_Thread_join(sub[k].thread,NULL) != 0)
+      gmx_fatal(FARGS,"Could not join an ONIOM QM thread");
+  }
+} /* run_QMsubcalc_parallel */
+
+/* Does the QM calculation(s) of calculate_QMMM, the QM forces are
+ * added to f and the shift forces to fshift_tot.
+ */
+static real do_QMMM(gmx_large_int_t step,
+                    t_commrec *cr,
+                    rvec x[],rvec f[],rvec fshift_tot[],
+                    t_forcerec *fr,
+                    gmx_bool bFullQM)
 {
   real
     QMener=0.0;
   /* a selection for the QM package depending on which is requested
-   * (Gaussian, GAMESS-UK, MOPAC or ORCA) needs to be implemented here. Now
+   * (Gaussian, GAMESS-UK, MOPAC, ORCA or Q-Chem) needs to be implemented here. Now
    * it works through defines.... Not so nice yet 
    */
   t_QMMMrec
@@ -1006,15 +1770,23 @@ real calculate_QMMM(t_commrec *cr,
   t_MMrec
     *mm=NULL;
   rvec 
-    *forces=NULL,*fshift=NULL,    
-    *forces2=NULL, *fshift2=NULL; /* needed for multilayer ONIOM */
+    *forces=NULL,*fshift=NULL;
+  t_QMsubcalc
+    *sub;                   /* needed for multilayer ONIOM */
   int
-    i,j,k;
+    i,j,k,nsub,sign;
+  char
+    layer[STRLEN];
   /* make a local copy the QMMMrec pointer 
    */
   qr = fr->qr;
   mm = qr->mm;
 
+  qr->nSCF = 0;
+  if(qr->nstQM > 1){
+    return do_QMMM_mts(step,cr,f,fshift_tot,fr,bFullQM);
+  }
+
   /* now different procedures are carried out for one layer ONION and
    * normal QMMM on one hand and multilayer oniom on the other
    */
@@ -1023,16 +1795,17 @@ real calculate_QMMM(t_commrec *cr,
     snew(forces,(qm->nrQMatoms+mm->nrMMatoms));
     snew(fshift,(qm->nrQMatoms+mm->nrMMatoms));
     QMener = call_QMroutine(cr,fr,qm,mm,forces,fshift);
+    finish_QMcall(step,"calculation",qr,qm);
     for(i=0;i<qm->nrQMatoms;i++){
       for(j=0;j<DIM;j++){
 	f[qm->indexQM[i]][j]          -= forces[i][j];
-	fr->fshift[qm->shiftQM[i]][j] += fshift[i][j];
+	fshift_tot[qm->shiftQM[i]][j] += fshift[i][j];
       }
     }
     for(i=0;i<mm->nrMMatoms;i++){
       for(j=0;j<DIM;j++){
 	f[mm->indexMM[i]][j]          -= forces[qm->nrQMatoms+i][j];
-	fr->fshift[mm->shiftMM[i]][j] += fshift[qm->nrQMatoms+i][j];
+	fshift_tot[mm->shiftMM[i]][j] += fshift[qm->nrQMatoms+i][j];
       }
       
     }
@@ -1040,61 +1813,66 @@ real calculate_QMMM(t_commrec *cr,
     free(fshift);
   }
   else{ /* Multi-layer ONIOM */
-    for(i=0;i<qr->nrQMlayers-1;i++){ /* last layer is special */
-      qm  = qr->qm[i];
-      qm2 = copy_QMrec(qr->qm[i+1]);
-
-      qm2->nrQMatoms = qm->nrQMatoms;
-    
-      for(j=0;j<qm2->nrQMatoms;j++){
-	for(k=0;k<DIM;k++)
-	  qm2->xQM[j][k]       = qm->xQM[j][k];
-	qm2->indexQM[j]        = qm->indexQM[j];
-	qm2->atomicnumberQM[j] = qm->atomicnumberQM[j];
-	qm2->shiftQM[j]        = qm->shiftQM[j];
+    /* E = sum_i (E_i^high - E_i^low) + E_n-1^high, where layer i at
+     * the lower level of theory is computed at the level of layer
+     * i+1; similar for the gradients. Calculation 2i is layer i at its
+     * own level, calculation 2i+1 the same layer at the lower level.
+     */
+    nsub = 2*qr->nrQMlayers-1;
+    snew(sub,nsub);
+    for(i=0;i<qr->nrQMlayers;i++){
+      sub[2*i].qm = qr->qm[i];
+      if(i < qr->nrQMlayers-1){
+        qm  = qr->qm[i];
+        qm2 = qr->qm_low[i];
+        for(j=0;j<qm->nrQMatoms;j++){
+          copy_rvec(qm->xQM[j],qm2->xQM[j]);
+          qm2->shiftQM[j] = qm->shiftQM[j];
+        }
+        sub[2*i+1].qm = qm2;
       }
-
-      qm2->QMcharge = qm->QMcharge;
-      /* this layer at the higher level of theory */
-      srenew(forces,qm->nrQMatoms);
-      srenew(fshift,qm->nrQMatoms);
-      /* we need to re-initialize the QMroutine every step... */
-      init_QMroutine(cr,qm,mm);
-      QMener += call_QMroutine(cr,fr,qm,mm,forces,fshift);
-
-      /* this layer at the lower level of theory */
-      srenew(forces2,qm->nrQMatoms);
-      srenew(fshift2,qm->nrQMatoms);
-      init_QMroutine(cr,qm2,mm);
-      QMener -= call_QMroutine(cr,fr,qm2,mm,forces2,fshift2);
-      /* E = E1high-E1low The next layer includes the current layer at
-       * the lower level of theory, which provides + E2low
-       * this is similar for gradients
-       */
-      for(i=0;i<qm->nrQMatoms;i++){
-	for(j=0;j<DIM;j++){
-	  f[qm->indexQM[i]][j]          -= (forces[i][j]-forces2[i][j]);
-	  fr->fshift[qm->shiftQM[i]][j] += (fshift[i][j]-fshift2[i][j]);
-	}
+    }
+    for(k=0;k<nsub;k++){
+      sub[k].cr = cr;
+      sub[k].fr = fr;
+      sub[k].mm = mm;
+      snew(sub[k].f,sub[k].qm->nrQMatoms);
+      snew(sub[k].fshift,sub[k].qm->nrQMatoms);
+    }
+    if(qr->bParONIOM)
+      run_QMsubcalc_parallel(nsub,sub);
+    for(k=0;k<nsub;k++){
+      if(!qr->bParONIOM){
+        /* we need to re-initialize the QMroutine every step... */
+        init_QMroutine(cr,sub[k].qm,mm);
+        QMsubcalc_thread(&sub[k]);
       }
-      free(qm2);
+      /* serially, levels of theory share the wavefunction file of the
+       * QM program, so each guess is stored directly after its call
+       */
+      if(k % 2 == 0)
+        sprintf(layer,"layer %d",k/2);
+      else
+        sprintf(layer,"layer %d (low level)",k/2);
+      finish_QMcall(step,layer,qr,sub[k].qm);
     }
-    /* now the last layer still needs to be done: */
-    qm      = qr->qm[qr->nrQMlayers-1]; /* C counts from 0 */
-    init_QMroutine(cr,qm,mm);
-    srenew(forces,qm->nrQMatoms);
-    srenew(fshift,qm->nrQMatoms);
-    QMener += call_QMroutine(cr,fr,qm,mm,forces,fshift);
-    for(i=0;i<qm->nrQMatoms;i++){
-      for(j=0;j<DIM;j++){
-	f[qm->indexQM[i]][j]          -= forces[i][j];
-	fr->fshift[qm->shiftQM[i]][j] += fshift[i][j];
+    for(k=0;k<nsub;k++){
+      /* the lower level calculations are subtracted */
+      sign = (k % 2 == 0 ? 1 : -1);
+      qm   = sub[k].qm;
+      QMener += sign*sub[k].ener;
+      for(i=0;i<qm->nrQMatoms;i++){
+        for(j=0;j<DIM;j++){
+          f[qm->indexQM[i]][j]          -= sign*sub[k].f[i][j];
+          fshift_tot[qm->shiftQM[i]][j] += sign*sub[k].fshift[i][j];
+        }
       }
+      sfree(sub[k].f);
+      sfree(sub[k].fshift);
     }
-    free(forces);
-    free(fshift);
-    free(forces2);
-    free(fshift2);
+    sfree(sub);
+    /* the largest layer */
+    qm = qr->qm[qr->nrQMlayers-1];
   }
   if(qm->bTS||qm->bOPT){
     /* qm[0] still contains the largest ONIOM QM subsystem 
@@ -1107,6 +1885,187 @@ real calculate_QMMM(t_commrec *cr,
     }
   }
   return(QMener);
+} /* do_QMMM */
+
+real calculate_QMMM(FILE *fplog,
+                    gmx_large_int_t step,
+                    t_commrec *cr,
+		    rvec x[],rvec f[],
+		    t_forcerec *fr,
+		    t_mdatoms *md,
+		    gmx_bool bFullQM,
+		    gmx_wallcycle_t wcycle)
+{
+  real QMener;
+
+  wallcycle_start(wcycle,ewcQMMM);
+  QMener = do_QMMM(step,cr,x,f,fr->fshift,fr,bFullQM);
+  if(fr->qr->bPMEembed)
+    QMMM_pme_forces(fr,x,md,fr->qr->qm[0],fr->qr->mm,fr->f_novirsum);
+  print_QMMM_log(fplog,fr->qr);
+  flush_QMMM_cycles(fr->qr,wcycle);
+  wallcycle_stop(wcycle,ewcQMMM);
+
+  return QMener;
 } /* calculate_QMMM */
 
+static void *QMMM_thread(void *arg)
+{
+  gmx_QMMM_async_t as=(gmx_QMMM_async_t)arg;
+
+  tMPI_Thread_mutex_lock(&as->mutex);
+  while(TRUE){
+    while(!as->bStart && !as->bStop)
+      tMPI_Thread_cond_wait(&as->cond,&as->mutex);
+    if(as->bStop)
+      break;
+    /* the main thread does not touch as until we are done */
+    tMPI_Thread_mutex_unlock(&as->mutex);
+
+    as->QMener = do_QMMM(as->step,as->cr,as->x,as->f,as->fshift,
+                         as->fr,as->bFullQM);
+
+    tMPI_Thread_mutex_lock(&as->mutex);
+    as->bStart = FALSE;
+    tMPI_Thread_cond_broadcast(&as->cond);
+  }
+  tMPI_Thread_mutex_unlock(&as->mutex);
+
+  return NULL;
+}
+
+static void done_QMMM_async(gmx_QMMM_async_t as)
+{
+  /* a calculation that is still running is finished first */
+  tMPI_Thread_mutex_lock(&as->mutex);
+  as->bStop = TRUE;
+  tMPI_Thread_cond_broadcast(&as->cond);
+  tMPI_Thread_mutex_unlock(&as->mutex);
+  if(tMPI_Thread_join(as->thread,NULL) != 0)
+    gmx_fatal(FARGS,"Could not join the QM/MM thread");
+  tMPI_Thread_mutex_destroy(&as->mutex);
+  tMPI_Thread_cond_destroy(&as->cond);
+  sfree(as->f);
+  sfree(as);
+} /* done_QMMM_async */
+
+void start_QMMM(FILE *fplog,
+                gmx_large_int_t step,
+                t_commrec *cr,
+                rvec x[],
+                t_forcerec *fr,
+                t_mdatoms *md,
+                gmx_bool bFullQM)
+{
+  gmx_QMMM_async_t as=fr->qr->async;
+
+  if(as == NULL)
+    return;
+
+  if(as->bRunning)
+    gmx_incons("start_QMMM called while a QM calculation is running");
+
+  if(md->nr > as->f_nalloc){
+    /* The merge in finish_QMMM clears what the QM thread touched,
+     * so the array only has to be cleared here once.
+     */
+    as->f_nalloc = over_alloc_large(md->nr);
+    sfree(as->f);
+    snew(as->f,as->f_nalloc);
+  }
+  as->fplog = fplog;
+  as->step  = step;
+  as->cr    = cr;
+  as->fr    = fr;
+  as->x     = x;
+  as->md    = md;
+  as->bFullQM = bFullQM;
+  tMPI_Thread_mutex_lock(&as->mutex);
+  as->bStart = TRUE;
+  tMPI_Thread_cond_broadcast(&as->cond);
+  tMPI_Thread_mutex_unlock(&as->mutex);
+  as->bRunning = TRUE;
+}
+
+static void add_QMMM_f(int n,int index[],rvec fqm[],rvec f[])
+{
+  int i;
+
+  for(i=0;i<n;i++){
+    rvec_inc(f[index[i]],fqm[index[i]]);
+    clear_rvec(fqm[index[i]]);
+  }
+}
+
+real finish_QMMM(rvec f[], t_forcerec *fr, gmx_wallcycle_t wcycle)
+{
+  t_QMMMrec        *qr=fr->qr;
+  gmx_QMMM_async_t as=qr->async;
+  int              i;
+
+  if(as == NULL || !as->bRunning)
+    gmx_incons("finish_QMMM called without a running QM calculation");
+
+  wallcycle_start(wcycle,ewcQMMM);
+  tMPI_Thread_mutex_lock(&as->mutex);
+  while(as->bStart)
+    tMPI_Thread_cond_wait(&as->cond,&as->mutex);
+  tMPI_Thread_mutex_unlock(&as->mutex);
+  as->bRunning = FALSE;
+  print_QMMM_log(as->fplog,qr);
+
+  /* The ONIOM layers overlap, but an atom is cleared after its first
+   * visit, so it is only added once.
+   */
+  for(i=0;i<qr->nrQMlayers;i++)
+    add_QMMM_f(qr->qm[i]->nrQMatoms,qr->qm[i]->indexQM,as->f,f);
+  add_QMMM_f(qr->mm->nrMMatoms,qr->mm->indexMM,as->f,f);
+  for(i=0;i<SHIFTS;i++){
+    rvec_inc(fr->fshift[i],as->fshift[i]);
+    clear_rvec(as->fshift[i]);
+  }
+  /* the mesh is shared with the MM forces, so not in the QM thread */
+  if(qr->bPMEembed)
+    QMMM_pme_forces(fr,as->x,as->md,qr->qm[0],qr->mm,fr->f_novirsum);
+  flush_QMMM_cycles(qr,wcycle);
+  wallcycle_stop(wcycle,ewcQMMM);
+
+  return as->QMener;
+} /* finish_QMMM */
+
+static void done_QMroutine(t_QMrec *qm)
+{
+  /* closes what the QM program keeps open over the run */
+#ifdef GMX_QMMM_QCHEM
+  done_qchem(qm);
+#endif
+} /* done_QMroutine */
+
+void done_QMMMrec(t_QMMMrec *qr)
+{
+  int i;
+
+  if(qr->async){
+    done_QMMM_async(qr->async);
+    qr->async = NULL;
+  }
+  for(i=0;i<qr->nrQMlayers;i++){
+    done_QMroutine(qr->qm[i]);
+    if(qr->qm_low && qr->qm_low[i])
+      done_QMroutine(qr->qm_low[i]);
+  }
+  if(qr->qm_ref)
+    done_QMroutine(qr->qm_ref);
+  sfree(qr->f_mts);
+  sfree(qr->f_QM);
+  sfree(qr->fshift_QM);
+  sfree(qr->f_ref);
+  sfree(qr->fshift_ref);
+  qr->natoms_mts = 0;
+  sfree(qr->f_pme);
+  qr->f_pme_nalloc = 0;
+  sfree(qr->QMlog);
+  qr->QMlog_nalloc = 0;
+} /* done_QMMMrec */
+
 /* end of QMMM core routines */
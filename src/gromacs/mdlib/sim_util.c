@@ -91,7 +91,9 @@
 #include "nbnxn_kernels/nbnxn_kernel_ref.h"
 #include "nbnxn_kernels/nbnxn_kernel_x86_simd128.h"
 #include "nbnxn_kernels/nbnxn_kernel_x86_simd256.h"
+#include "nbnxn_kernels/nbnxn_kernel_x86_simd512.h"
 #include "nbnxn_kernels/nbnxn_kernel_gpu_ref.h"
+#include "nonbonded.h"
 
 #ifdef GMX_LIB_MPI
 #include <mpi.h>
@@ -484,7 +486,8 @@ static void pme_receive_force_ener(FILE *fplog,
                                    t_commrec *cr,
                                    gmx_wallcycle_t wcycle,
                                    gmx_enerdata_t *enerd,
-                                   t_forcerec *fr)
+                                   t_forcerec *fr,
+                                   int flags)
 {
     real   e,v,dvdl;    
     float  cycles_ppdpme,cycles_seppme;
@@ -495,10 +498,37 @@ static void pme_receive_force_ener(FILE *fplog,
     /* In case of node-splitting, the PP nodes receive the long-range 
      * forces, virial and energy from the PME nodes here.
      */    
+    if (fr->nstpme > 1 && !(flags & GMX_FORCE_PME_MESH))
+    {
+        /* No mesh step, the coordinates were not sent to the PME nodes.
+         * We reuse the mesh energy and virial of the last mesh step.
+         */
+        m_add(fr->vir_el_recip,fr->pme_mts_vir,fr->vir_el_recip);
+        enerd->term[F_COUL_RECIP] += fr->pme_mts_ener;
+        enerd->dvdl_lin[efptCOUL] += fr->pme_mts_dvdl;
+
+        return;
+    }
+
     wallcycle_start(wcycle,ewcPP_PMEWAITRECVF);
     dvdl = 0;
-    gmx_pme_receive_f(cr,fr->f_novirsum,fr->vir_el_recip,&e,&dvdl,
-                      &cycles_seppme);
+    if (fr->nstpme > 1)
+    {
+        /* Store the mesh part separately for the impulse */
+        clear_rvecs(fr->natoms_force_constr,fr->f_pme_mts);
+        clear_mat(fr->pme_mts_vir);
+        gmx_pme_receive_f(cr,fr->f_pme_mts,fr->pme_mts_vir,&e,&dvdl,
+                          &cycles_seppme);
+        sum_forces(0,cr->dd->nat_home,fr->f_novirsum,fr->f_pme_mts);
+        m_add(fr->vir_el_recip,fr->pme_mts_vir,fr->vir_el_recip);
+        fr->pme_mts_ener = e;
+        fr->pme_mts_dvdl = dvdl;
+    }
+    else
+    {
+        gmx_pme_receive_f(cr,fr->f_novirsum,fr->vir_el_recip,&e,&dvdl,
+                          &cycles_seppme);
+    }
     if (bSepDVDL)
     {
         fprintf(fplog,sepdvdlformat,"PME mesh",e,dvdl);
@@ -557,6 +587,13 @@ static void post_process_forces(FILE *fplog,
                            (flags & GMX_FORCE_VIRIAL),fr->vir_el_recip,
                            nrnb,
                            &top->idef,fr->ePBC,fr->bMolPBC,graph,box,cr);
+            if (fr->nstpme > 1 && (flags & GMX_FORCE_PME_MESH))
+            {
+                /* The mesh force impulse also acts on the constructing atoms */
+                spread_vsite_f(fplog,vsite,x,fr->f_pme_mts,NULL,
+                               FALSE,NULL,nrnb,
+                               &top->idef,fr->ePBC,fr->bMolPBC,graph,box,cr);
+            }
             wallcycle_stop(wcycle,ewcVSITESPREAD);
         }
         if (flags & GMX_FORCE_VIRIAL)
@@ -660,6 +697,19 @@ static void do_nb_verlet(t_forcerec *fr,
                                      enerd->grpp.ener[egBHAMSR] :
                                      enerd->grpp.ener[egLJSR]);
             break;
+        case nbk4xN_X86_SIMD512:
+            nbnxn_kernel_x86_simd512(&nbvg->nbl_lists,
+                                     nbvg->nbat, ic,
+                                     nbvg->ewald_excl,
+                                     fr->shift_vec,
+                                     flags,
+                                     clearF,
+                                     fr->fshift[0],
+                                     enerd->grpp.ener[egCOULSR],
+                                     fr->bBHAM ?
+                                     enerd->grpp.ener[egBHAMSR] :
+                                     enerd->grpp.ener[egLJSR]);
+            break;
 
         case nbk8x8x8_CUDA:
             nbnxn_cuda_launch_kernel(fr->nbv->cu_nbv, nbvg->nbat, flags, ilocality);
@@ -716,6 +766,172 @@ static void do_nb_verlet(t_forcerec *fr,
              nbvg->nbl_lists.natpair_q);
 }
 
+/* Computes the free-energy pair lists of nbl_lists on one OpenMP
+ * thread per list. Thread 0 adds to f, fr->fshift, grpp and dvdl,
+ * the other threads use fr->f_t_fep and are reduced afterwards.
+ * Only the force blocks with atoms in a thread's lists are cleared
+ * and reduced.
+ */
+static void nb_verlet_fep_threads(nbnxn_pairlist_set_t *nbl_lists,
+                                  t_forcerec *fr,rvec x[],rvec f[],
+                                  t_mdatoms *mdatoms,real *lambda,
+                                  gmx_grppairener_t *grpp,real *dvdl,
+                                  int donb_flags,t_nrnb *nrnb)
+{
+    int      nthreads,th,i,j,ashift;
+    gmx_bool bForce;
+
+    nthreads = nbl_lists->nnbl;
+    bForce   = (donb_flags & GMX_NONBONDED_DO_FORCE);
+    ashift   = gmx_nonbonded_red_ashift(fr->natoms_force);
+
+#pragma omp parallel for num_threads(nthreads) schedule(static)
+    for(th=0; th<nthreads; th++)
+    {
+        f_thread_t *ft;
+        t_nrnb     nrnb_th;
+        int        e,n;
+
+        init_nrnb(&nrnb_th);
+        if (th == 0)
+        {
+            do_nonbonded_fep_list(fr,nbl_lists->nbl_fep[th],
+                                  nbl_lists->nbl_fep_excl[th],
+                                  x,f,fr->fshift,mdatoms,grpp,
+                                  &nrnb_th,lambda,dvdl,donb_flags);
+        }
+        else
+        {
+            ft = &fr->f_t_fep[th];
+            if (bForce)
+            {
+                ft->red_mask = gmx_nblist_red_mask(nbl_lists->nbl_fep[th],
+                                                   ashift,0);
+                ft->red_mask = gmx_nblist_red_mask(nbl_lists->nbl_fep_excl[th],
+                                                   ashift,ft->red_mask);
+                gmx_nonbonded_clear_thread_force(ft,fr->natoms_force,ashift,
+                                                 FALSE);
+            }
+            for(e=0; e<egNR; e++)
+            {
+                for(n=0; n<ft->grpp.nener; n++)
+                {
+                    ft->grpp.ener[e][n] = 0;
+                }
+            }
+            ft->dvdl[efptCOUL] = 0;
+            ft->dvdl[efptVDW]  = 0;
+
+            do_nonbonded_fep_list(fr,nbl_lists->nbl_fep[th],
+                                  nbl_lists->nbl_fep_excl[th],
+                                  x,ft->f,ft->fshift,mdatoms,&ft->grpp,
+                                  &nrnb_th,lambda,ft->dvdl,donb_flags);
+        }
+#pragma omp critical
+        add_nrnb(nrnb,nrnb,&nrnb_th);
+    }
+
+    if (bForce)
+    {
+        gmx_nonbonded_reduce_thread_force(fr->natoms_force,f,NULL,
+                                          nthreads,fr->f_t_fep,ashift);
+    }
+    for(th=1; th<nthreads; th++)
+    {
+        if (bForce)
+        {
+            for(i=0; i<SHIFTS; i++)
+            {
+                rvec_inc(fr->fshift[i],fr->f_t_fep[th].fshift[i]);
+            }
+        }
+        for(i=0; i<egNR; i++)
+        {
+            for(j=0; j<grpp->nener; j++)
+            {
+                grpp->ener[i][j] += fr->f_t_fep[th].grpp.ener[i][j];
+            }
+        }
+        dvdl[efptCOUL] += fr->f_t_fep[th].dvdl[efptCOUL];
+        dvdl[efptVDW]  += fr->f_t_fep[th].dvdl[efptVDW];
+    }
+}
+
+/* Computes the interactions of the perturbed atoms with the Verlet
+ * scheme, these are not computed by the cluster kernels.
+ */
+static void do_nb_verlet_fep(nbnxn_pairlist_set_t *nbl_lists,
+                             t_forcerec *fr,rvec x[],rvec f[],
+                             t_mdatoms *mdatoms,t_inputrec *ir,
+                             real *lambda,gmx_enerdata_t *enerd,
+                             int flags,t_nrnb *nrnb,gmx_wallcycle_t wcycle)
+{
+    t_lambda *fepvals;
+    int      donb_flags,i,j;
+    real     dvdl_nb[efptNR],dvdl_dum[efptNR],lam_i[efptNR];
+
+    if (!(flags & GMX_FORCE_NONBONDED))
+    {
+        return;
+    }
+
+    fepvals    = ir->fepvals;
+
+    donb_flags = GMX_NONBONDED_DO_SR;
+    if (flags & GMX_FORCE_FORCES)
+    {
+        donb_flags |= GMX_NONBONDED_DO_FORCE;
+    }
+    if (flags & GMX_FORCE_ENERGY)
+    {
+        donb_flags |= GMX_NONBONDED_DO_POTENTIAL;
+    }
+
+    for(i=0; i<efptNR; i++)
+    {
+        dvdl_nb[i]  = 0;
+        dvdl_dum[i] = 0;
+    }
+
+    wallcycle_sub_start(wcycle, ewcsNONBONDED);
+    nb_verlet_fep_threads(nbl_lists,fr,x,f,mdatoms,lambda,
+                          &enerd->grpp,dvdl_nb,donb_flags,nrnb);
+
+    if (fepvals->sc_alpha != 0)
+    {
+        enerd->dvdl_nonlin[efptVDW]  += dvdl_nb[efptVDW];
+        enerd->dvdl_nonlin[efptCOUL] += dvdl_nb[efptCOUL];
+    }
+    else
+    {
+        enerd->dvdl_lin[efptVDW]     += dvdl_nb[efptVDW];
+        enerd->dvdl_lin[efptCOUL]    += dvdl_nb[efptCOUL];
+    }
+
+    /* With soft-core the foreign lambda energies have to be recalculated,
+     * as in do_force_lowlevel for the group scheme.
+     */
+    if (fepvals->n_lambda > 0 && (flags & GMX_FORCE_DHDL) &&
+        fepvals->sc_alpha != 0)
+    {
+        for(i=0; i<enerd->n_lambda; i++)
+        {
+            for(j=0; j<efptNR; j++)
+            {
+                lam_i[j] = (i==0 ? lambda[j] : fepvals->all_lambda[j][i-1]);
+            }
+            reset_foreign_enerdata(enerd);
+            nb_verlet_fep_threads(nbl_lists,fr,x,f,mdatoms,lam_i,
+                                  &enerd->foreign_grpp,dvdl_dum,
+                                  (donb_flags & ~GMX_NONBONDED_DO_FORCE) | GMX_NONBONDED_DO_FOREIGNLAMBDA,
+                                  nrnb);
+            sum_epot(&ir->opts,&enerd->foreign_grpp,enerd->foreign_term);
+            enerd->enerpart_lambda[i] += enerd->foreign_term[F_EPOT];
+        }
+    }
+    wallcycle_sub_stop(wcycle, ewcsNONBONDED);
+}
+
 void do_force_cutsVERLET(FILE *fplog,t_commrec *cr,
               t_inputrec *inputrec,
               gmx_large_int_t step,t_nrnb *nrnb,gmx_wallcycle_t wcycle,
@@ -817,11 +1033,13 @@ void do_force_cutsVERLET(FILE *fplog,t_commrec *cr,
                                   fr->shift_vec,nbv->grp[0].nbat);
 
 #ifdef GMX_MPI
-    if (!(cr->duty & DUTY_PME)) {
+    if (!(cr->duty & DUTY_PME) &&
+        (fr->nstpme == 1 || (flags & GMX_FORCE_PME_MESH))) {
         /* Send particle coordinates to the pme nodes.
          * Since this is only implemented for domain decomposition
          * and domain decomposition does not use the graph,
          * we do not need to worry about shifting.
+         * With PME mesh multiple time stepping we only send on mesh steps.
          */    
 
         wallcycle_start(wcycle,ewcPP_PMESENDX);
@@ -834,7 +1052,8 @@ void do_force_cutsVERLET(FILE *fplog,t_commrec *cr,
 
         gmx_pme_send_x(cr,bBS ? boxs : box,x,
                        mdatoms->nChargePerturbed,lambda[efptCOUL],
-                       (flags & (GMX_FORCE_VIRIAL | GMX_FORCE_ENERGY)),step);
+                       (flags & (GMX_FORCE_VIRIAL | GMX_FORCE_ENERGY)) ||
+                       fr->nstpme > 1,step);
 
         wallcycle_stop(wcycle,ewcPP_PMESENDX);
     }
@@ -922,6 +1141,25 @@ void do_force_cutsVERLET(FILE *fplog,t_commrec *cr,
                             nrnb);
         wallcycle_sub_stop(wcycle,ewcsNBS_SEARCH_LOCAL);
 
+        if (fr->bQMMM && fr->qr->QMMMscheme != eQMMMschemeoniom)
+        {
+            /* the MM atoms within rcoulomb of the QM atoms, the
+             * embedding of the QM system
+             */
+            nbnxn_make_qmmm_list(nbv->nbs,&nbv->grp[eintLocal].nbl_lists,
+                                 mdatoms->bQM,(const rvec *)x,
+                                 (const rvec *)fr->shift_vec,ic->rcoulomb,
+                                 &fr->QMMMlist);
+        }
+
+        if (fr->efep != efepNO)
+        {
+            nbnxn_make_fep_list(nbv->nbs,&nbv->grp[eintLocal].nbl_lists,
+                                mdatoms->bPerturbed,mdatoms->cENER,
+                                inputrec->opts.ngener,(const rvec *)x,
+                                (const rvec *)fr->shift_vec,ic->rlist);
+        }
+
         if (bUseGPU)
         {
             /* initialize local pair-list on the GPU */
@@ -991,6 +1229,14 @@ void do_force_cutsVERLET(FILE *fplog,t_commrec *cr,
                                 nbv->grp[eintNonlocal].kernel_type,
                                 nrnb);
 
+            if (fr->efep != efepNO)
+            {
+                nbnxn_make_fep_list(nbv->nbs,&nbv->grp[eintNonlocal].nbl_lists,
+                                    mdatoms->bPerturbed,mdatoms->cENER,
+                                    inputrec->opts.ngener,(const rvec *)x,
+                                    (const rvec *)fr->shift_vec,ic->rlist);
+            }
+
             wallcycle_sub_stop(wcycle,ewcsNBS_SEARCH_NONLOCAL);
 
             if (nbv->grp[eintNonlocal].kernel_type == nbk8x8x8_CUDA)
@@ -1139,7 +1385,10 @@ void do_force_cutsVERLET(FILE *fplog,t_commrec *cr,
     /* update QMMMrec, if necessary */
     if(fr->bQMMM)
     {
-        update_QMMMrec(cr,fr,x,mdatoms,box,top);
+        update_QMMMrec(cr,fr,x,mdatoms,box,top,bNS,wcycle);
+        /* with GMX_QMMM_ASYNC the QM package runs from here on */
+        start_QMMM(fplog,step,cr,x,fr,mdatoms,
+                   (flags & GMX_FORCE_QMMM_FULL));
     }
 
     if ((flags & GMX_FORCE_BONDED) && top->idef.il[F_POSRES].nr > 0)
@@ -1173,6 +1422,12 @@ void do_force_cutsVERLET(FILE *fplog,t_commrec *cr,
         /* Maybe we should move this into do_force_lowlevel */
         do_nb_verlet(fr, ic, enerd, flags, eintLocal, enbvClearFYes,
                      nrnb, wcycle);
+
+        if (fr->efep != efepNO)
+        {
+            do_nb_verlet_fep(&nbv->grp[eintLocal].nbl_lists,fr,x,f,mdatoms,
+                             inputrec,lambda,enerd,flags,nrnb,wcycle);
+        }
     }
         
 
@@ -1185,6 +1440,13 @@ void do_force_cutsVERLET(FILE *fplog,t_commrec *cr,
             do_nb_verlet(fr, ic, enerd, flags, eintNonlocal,
                          bDiffKernels ? enbvClearFYes : enbvClearFNo,
                          nrnb, wcycle);
+
+            if (fr->efep != efepNO)
+            {
+                do_nb_verlet_fep(&nbv->grp[eintNonlocal].nbl_lists,fr,x,f,
+                                 mdatoms,inputrec,lambda,enerd,flags,
+                                 nrnb,wcycle);
+            }
         }
 
         if (!bUseOrEmulGPU)
@@ -1328,6 +1590,16 @@ void do_force_cutsVERLET(FILE *fplog,t_commrec *cr,
         wallcycle_stop(wcycle, ewcNB_XF_BUF_OPS);
     }
     
+    if (fr->bQMMM && fr->qr->async)
+    {
+        /* The MM forces are done, collect the concurrent QM forces */
+        /* The QM/MM counter should be nested in the force counter */
+        wallcycle_start_nocount(wcycle,ewcFORCE);
+        enerd->term[F_EQM] = finish_QMMM(f,fr,wcycle);
+        enerd->QMnscf      = fr->qr->nSCF;
+        wallcycle_stop(wcycle,ewcFORCE);
+    }
+
     if (DOMAINDECOMP(cr))
     {
         dd_force_flop_stop(cr->dd,nrnb);
@@ -1386,7 +1658,7 @@ void do_force_cutsVERLET(FILE *fplog,t_commrec *cr,
         /* In case of node-splitting, the PP nodes receive the long-range 
          * forces, virial and energy from the PME nodes here.
          */    
-        pme_receive_force_ener(fplog,bSepDVDL,cr,wcycle,enerd,fr);
+        pme_receive_force_ener(fplog,bSepDVDL,cr,wcycle,enerd,fr,flags);
     }
 
     if (bDoForces)
@@ -1518,11 +1790,13 @@ void do_force_cutsGROUP(FILE *fplog,t_commrec *cr,
     }
 
 #ifdef GMX_MPI
-    if (!(cr->duty & DUTY_PME)) {
+    if (!(cr->duty & DUTY_PME) &&
+        (fr->nstpme == 1 || (flags & GMX_FORCE_PME_MESH))) {
         /* Send particle coordinates to the pme nodes.
          * Since this is only implemented for domain decomposition
          * and domain decomposition does not use the graph,
          * we do not need to worry about shifting.
+         * With PME mesh multiple time stepping we only send on mesh steps.
          */    
 
         wallcycle_start(wcycle,ewcPP_PMESENDX);
@@ -1535,7 +1809,8 @@ void do_force_cutsGROUP(FILE *fplog,t_commrec *cr,
 
         gmx_pme_send_x(cr,bBS ? boxs : box,x,
                        mdatoms->nChargePerturbed,lambda[efptCOUL],
-                       (flags & (GMX_FORCE_VIRIAL | GMX_FORCE_ENERGY)),step);
+                       (flags & (GMX_FORCE_VIRIAL | GMX_FORCE_ENERGY)) ||
+                       fr->nstpme > 1,step);
 
         wallcycle_stop(wcycle,ewcPP_PMESENDX);
     }
@@ -1722,7 +1997,10 @@ void do_force_cutsGROUP(FILE *fplog,t_commrec *cr,
     /* update QMMMrec, if necessary */
     if(fr->bQMMM)
     {
-        update_QMMMrec(cr,fr,x,mdatoms,box,top);
+        update_QMMMrec(cr,fr,x,mdatoms,box,top,bNS,wcycle);
+        /* with GMX_QMMM_ASYNC the QM package runs from here on */
+        start_QMMM(fplog,step,cr,x,fr,mdatoms,
+                   (flags & GMX_FORCE_QMMM_FULL));
     }
 
     if ((flags & GMX_FORCE_BONDED) && top->idef.il[F_POSRES].nr > 0)
@@ -1776,6 +2054,16 @@ void do_force_cutsGROUP(FILE *fplog,t_commrec *cr,
         do_flood(fplog,cr,x,f,ed,box,step,bNS);
     }
 
+    if (fr->bQMMM && fr->qr->async)
+    {
+        /* The MM forces are done, collect the concurrent QM forces */
+        /* The QM/MM counter should be nested in the force counter */
+        wallcycle_start_nocount(wcycle,ewcFORCE);
+        enerd->term[F_EQM] = finish_QMMM(f,fr,wcycle);
+        enerd->QMnscf      = fr->qr->nSCF;
+        wallcycle_stop(wcycle,ewcFORCE);
+    }
+
     if (DOMAINDECOMP(cr))
     {
         dd_force_flop_stop(cr->dd,nrnb);
@@ -1887,7 +2175,7 @@ void do_force_cutsGROUP(FILE *fplog,t_commrec *cr,
         /* In case of node-splitting, the PP nodes receive the long-range 
          * forces, virial and energy from the PME nodes here.
          */
-        pme_receive_force_ener(fplog,bSepDVDL,cr,wcycle,enerd,fr);
+        pme_receive_force_ener(fplog,bSepDVDL,cr,wcycle,enerd,fr,flags);
     }
 
     if (bDoForces)
@@ -69,6 +69,7 @@
 #include "md_support.h"
 #include "mdrun.h"
 #include "sim_util.h"
+#include "thread_mpi/threads.h"
 
 typedef struct gmx_global_stat
 {
@@ -431,6 +432,219 @@ static void moveit(t_commrec *cr,
 	     xx,NULL,(cr->nnodes-cr->npmenodes)-1,NULL);
 }
 
+/* A trn/xtc frame copied by the master for the I/O thread */
+typedef struct
+{
+    int             mdof_flags;
+    gmx_large_int_t step;
+    double          t;
+    real            lambda;
+    matrix          box;
+    int             natoms;
+    rvec            *x;
+    rvec            *v;
+    rvec            *f;
+    int             n_xtc;
+    rvec            *x_xtc;
+    gmx_bool        bXtcChunks;
+    int             xtc_nchunk;
+    int             xtc_nbytes;
+    unsigned char   *xtc_chunks;
+    int             xtc_chunks_nalloc;
+} t_mdoutf_frame;
+
+typedef struct gmx_mdoutf_async
+{
+    gmx_mdoutf_t        *of;
+    t_mdoutf_frame      frame[2]; /* double buffer                      */
+    int                 ifill;    /* the frame the master fills next    */
+    int                 iwrite;   /* the frame the I/O thread writes next */
+    int                 nqueued;  /* the number of frames still to write */
+    gmx_bool            bFinish;
+    tMPI_Thread_t       thread;
+    tMPI_Thread_mutex_t mutex;
+    tMPI_Thread_cond_t  cond;
+} t_mdoutf_async;
+
+static void write_trn_xtc(gmx_mdoutf_t *of,int mdof_flags,
+                          gmx_large_int_t step,double t,real lambda,
+                          matrix box,int natoms,rvec *x,rvec *v,rvec *f,
+                          int n_xtc,rvec *x_xtc,
+                          int xtc_nchunk,int xtc_nbytes,
+                          unsigned char *xtc_chunks)
+{
+    int bOK;
+
+
+    if (mdof_flags & (MDOF_X | MDOF_V | MDOF_F))
+    {
+        fwrite_trn(of->fp_trn,step,t,lambda,box,natoms,
+                   (mdof_flags & MDOF_X) ? x : NULL,
+                   (mdof_flags & MDOF_V) ? v : NULL,
+                   (mdof_flags & MDOF_F) ? f : NULL);
+        if (gmx_fio_flush(of->fp_trn) != 0)
+        {
+            gmx_file("Cannot write trajectory; maybe you are out of disk space?");
+        }
+        gmx_fio_check_file_position(of->fp_trn);
+    }
+    if (mdof_flags & MDOF_XTC)
+    {
+        if (xtc_chunks != NULL)
+        {
+            bOK = write_xtc_chunks(of->fp_xtc,n_xtc,step,t,box,of->xtc_prec,
+                                   xtc_nchunk,xtc_nbytes,xtc_chunks);
+        }
+        else
+        {
+            bOK = write_xtc(of->fp_xtc,n_xtc,step,t,box,x_xtc,of->xtc_prec);
+        }
+        if (bOK == 0)
+        {
+            gmx_fatal(FARGS,"XTC error - maybe you are out of disk space?");
+        }
+        gmx_fio_check_file_position(of->fp_xtc);
+    }
+}
+
+static void *mdoutf_thread(void *arg)
+{
+    t_mdoutf_async *as=(t_mdoutf_async *)arg;
+    t_mdoutf_frame *fr;
+
+    tMPI_Thread_mutex_lock(&as->mutex);
+    while (TRUE)
+    {
+        while (as->nqueued == 0 && !as->bFinish)
+        {
+            tMPI_Thread_cond_wait(&as->cond,&as->mutex);
+        }
+        if (as->nqueued == 0)
+        {
+            break;
+        }
+        /* The master does not touch a queued frame, so we can write
+         * it without holding the lock.
+         */
+        fr = &as->frame[as->iwrite];
+        tMPI_Thread_mutex_unlock(&as->mutex);
+
+        write_trn_xtc(as->of,fr->mdof_flags,fr->step,fr->t,fr->lambda,
+                      fr->box,fr->natoms,fr->x,fr->v,fr->f,
+                      fr->n_xtc,fr->x_xtc,fr->xtc_nchunk,fr->xtc_nbytes,
+                      fr->bXtcChunks ? fr->xtc_chunks : NULL);
+
+        tMPI_Thread_mutex_lock(&as->mutex);
+        as->iwrite = 1 - as->iwrite;
+        as->nqueued--;
+        tMPI_Thread_cond_broadcast(&as->cond);
+    }
+    tMPI_Thread_mutex_unlock(&as->mutex);
+
+    return NULL;
+}
+
+static t_mdoutf_async *init_mdoutf_async(gmx_mdoutf_t *of)
+{
+    t_mdoutf_async *as;
+
+    snew(as,1);
+    as->of = of;
+    tMPI_Thread_mutex_init(&as->mutex);
+    tMPI_Thread_cond_init(&as->cond);
+    if (tMPI_Thread_create(&as->thread,mdoutf_thread,as) != 0)
+    {
+        gmx_fatal(FARGS,"Could not start the trajectory output thread");
+    }
+
+    return as;
+}
+
+static t_mdoutf_frame *mdoutf_async_get_frame(t_mdoutf_async *as)
+{
+    /* With both frames queued, wait for the I/O thread to finish one */
+    tMPI_Thread_mutex_lock(&as->mutex);
+    while (as->nqueued == 2)
+    {
+        tMPI_Thread_cond_wait(&as->cond,&as->mutex);
+    }
+    tMPI_Thread_mutex_unlock(&as->mutex);
+
+    return &as->frame[as->ifill];
+}
+
+static void mdoutf_async_queue(t_mdoutf_async *as)
+{
+    tMPI_Thread_mutex_lock(&as->mutex);
+    as->ifill = 1 - as->ifill;
+    as->nqueued++;
+    tMPI_Thread_cond_broadcast(&as->cond);
+    tMPI_Thread_mutex_unlock(&as->mutex);
+}
+
+static void mdoutf_async_wait(t_mdoutf_async *as)
+{
+    tMPI_Thread_mutex_lock(&as->mutex);
+    while (as->nqueued > 0)
+    {
+        tMPI_Thread_cond_wait(&as->cond,&as->mutex);
+    }
+    tMPI_Thread_mutex_unlock(&as->mutex);
+}
+
+static void done_mdoutf_async(t_mdoutf_async *as)
+{
+    int i;
+
+    /* The I/O thread writes all queued frames before it stops */
+    tMPI_Thread_mutex_lock(&as->mutex);
+    as->bFinish = TRUE;
+    tMPI_Thread_cond_broadcast(&as->cond);
+    tMPI_Thread_mutex_unlock(&as->mutex);
+    if (tMPI_Thread_join(as->thread,NULL) != 0)
+    {
+        gmx_fatal(FARGS,"Could not join the trajectory output thread");
+    }
+    tMPI_Thread_cond_destroy(&as->cond);
+    tMPI_Thread_mutex_destroy(&as->mutex);
+
+    for(i=0; i<2; i++)
+    {
+        sfree(as->frame[i].x);
+        sfree(as->frame[i].v);
+        sfree(as->frame[i].f);
+        sfree(as->frame[i].x_xtc);
+        sfree(as->frame[i].xtc_chunks);
+    }
+    sfree(as);
+}
+
+static void copy_frame_vec(int n,rvec *src,rvec **dest)
+{
+    /* The number of atoms does not change during a run */
+    if (*dest == NULL)
+    {
+        snew(*dest,n);
+    }
+    memcpy(*dest,src,n*sizeof(**dest));
+}
+
+static void select_xtc_x(gmx_mtop_t *top_global,rvec *x,rvec *x_xtc)
+{
+    gmx_groups_t *groups;
+    int          i,j;
+
+    groups = &top_global->groups;
+    j = 0;
+    for(i=0; (i<top_global->natoms); i++)
+    {
+        if (ggrpnr(groups,egcXTC,i) == 0)
+        {
+            copy_rvec(x[i],x_xtc[j++]);
+        }
+    }
+}
+
 gmx_mdoutf_t *init_mdoutf(int nfile,const t_filenm fnm[],int mdrun_flags,
                           const t_commrec *cr,const t_inputrec *ir,
                           const output_env_t oenv)
@@ -446,6 +660,16 @@ gmx_mdoutf_t *init_mdoutf(int nfile,const t_filenm fnm[],int mdrun_flags,
     of->fp_xtc   = NULL;
     of->fp_dhdl  = NULL;
     of->fp_field = NULL;
+    of->async    = NULL;
+
+    /* With domain decomposition each domain can compress its own atoms,
+     * so the master only concatenates the compressed xtc chunks.
+     */
+    of->xtc_prec          = ir->xtcprec;
+    of->bXtcChunks        = (DOMAINDECOMP(cr) &&
+                             getenv("GMX_XTC_CHUNKS") != NULL);
+    of->xtc_chunks        = NULL;
+    of->xtc_chunks_nalloc = 0;
     
     of->eIntegrator     = ir->eI;
     of->bExpanded       = ir->bExpanded;
@@ -476,7 +700,10 @@ gmx_mdoutf_t *init_mdoutf(int nfile,const t_filenm fnm[],int mdrun_flags,
             ir->nstxtcout > 0)
         {
             of->fp_xtc = open_xtc(ftp2fn(efXTC,nfile,fnm), filemode);
-            of->xtc_prec = ir->xtcprec;
+            if (of->bXtcChunks)
+            {
+                fprintf(stderr,"Writing xtc frames as chunks compressed by each domain\n");
+            }
         }
         if (EI_DYNAMICS(ir->eI) || EI_ENERGY_MINIMIZATION(ir->eI))
         {
@@ -513,6 +740,13 @@ gmx_mdoutf_t *init_mdoutf(int nfile,const t_filenm fnm[],int mdrun_flags,
                                         "E (V/nm)",oenv);
             }
         }
+
+        if ((of->fp_trn != NULL || of->fp_xtc != NULL) &&
+            getenv("GMX_ASYNC_OUTPUT") != NULL)
+        {
+            of->async = init_mdoutf_async(of);
+            fprintf(stderr,"Writing trajectory frames with a separate I/O thread\n");
+        }
     }
 
     return of;
@@ -520,6 +754,10 @@ gmx_mdoutf_t *init_mdoutf(int nfile,const t_filenm fnm[],int mdrun_flags,
 
 void done_mdoutf(gmx_mdoutf_t *of)
 {
+    if (of->async != NULL)
+    {
+        done_mdoutf_async(of->async);
+    }
     if (of->fp_ene != NULL)
     {
         close_enx(of->fp_ene);
@@ -540,6 +778,7 @@ void done_mdoutf(gmx_mdoutf_t *of)
     {
         gmx_fio_fclose(of->fp_field);
     }
+    sfree(of->xtc_chunks);
 
     sfree(of);
 }
@@ -558,6 +797,11 @@ void write_traj(FILE *fplog,t_commrec *cr,
     rvec    *xxtc;
     rvec *local_v;
     rvec *global_v;
+    t_mdoutf_frame *frame;
+    gmx_bool bCollectXTC,bChunkXTC;
+    int     xtc_nchunk=0,xtc_nbytes=0;
+    unsigned char **xtc_chunks;
+    int     *xtc_chunks_nalloc;
     
 #define MX(xvf) moveit(cr,GMX_LEFT,GMX_RIGHT,#xvf,xvf)
 
@@ -566,16 +810,93 @@ void write_traj(FILE *fplog,t_commrec *cr,
 
     local_v  = state_local->v;
     global_v = state_global->v;
+
+    groups = &top_global->groups;
+    if ((mdof_flags & MDOF_XTC) && *n_xtc == -1)
+    {
+        /* All nodes need the xtc atom count to choose the collection */
+        *n_xtc = 0;
+        for(i=0; (i<top_global->natoms); i++)
+        {
+            if (ggrpnr(groups,egcXTC,i) == 0)
+            {
+                (*n_xtc)++;
+            }
+        }
+        if (*n_xtc != top_global->natoms && MASTER(cr) && of->async == NULL &&
+            !of->bXtcChunks)
+        {
+            snew(*x_xtc,*n_xtc);
+        }
+    }
+
+    /* The domains compress their own atoms into xtc chunks */
+    bChunkXTC = (of->bXtcChunks && (mdof_flags & MDOF_XTC));
+
+    frame = NULL;
+    if (MASTER(cr) && of->async != NULL &&
+        (mdof_flags & (MDOF_X | MDOF_V | MDOF_F | MDOF_XTC)))
+    {
+        frame = mdoutf_async_get_frame(of->async);
+        if ((mdof_flags & MDOF_XTC) && !bChunkXTC && frame->x_xtc == NULL)
+        {
+            snew(frame->x_xtc,*n_xtc);
+        }
+    }
+    xxtc = NULL;
+    if (MASTER(cr) && (mdof_flags & MDOF_XTC) && !bChunkXTC)
+    {
+        if (frame != NULL)
+        {
+            xxtc = frame->x_xtc;
+        }
+        else if (*n_xtc == top_global->natoms)
+        {
+            xxtc = state_global->x;
+        }
+        else
+        {
+            xxtc = *x_xtc;
+        }
+    }
+
+    /* When only a subset of the atoms is written to xtc and the full
+     * coordinates are not needed, only the xtc atoms are collected.
+     */
+    bCollectXTC = (DOMAINDECOMP(cr) && (mdof_flags & MDOF_XTC) &&
+                   !bChunkXTC && !(mdof_flags & (MDOF_X | MDOF_CPT)) &&
+                   *n_xtc < top_global->natoms);
     
     if (DOMAINDECOMP(cr))
     {
+        if (bChunkXTC)
+        {
+            if (frame != NULL)
+            {
+                xtc_chunks        = &frame->xtc_chunks;
+                xtc_chunks_nalloc = &frame->xtc_chunks_nalloc;
+            }
+            else
+            {
+                xtc_chunks        = &of->xtc_chunks;
+                xtc_chunks_nalloc = &of->xtc_chunks_nalloc;
+            }
+            dd_collect_xtc_chunks(cr->dd,state_local,groups,of->xtc_prec,
+                                  &xtc_nchunk,&xtc_nbytes,
+                                  xtc_chunks,xtc_chunks_nalloc);
+        }
         if (mdof_flags & MDOF_CPT)
         {
             dd_collect_state(cr->dd,state_local,state_global);
         }
         else
         {
-            if (mdof_flags & (MDOF_X | MDOF_XTC))
+            if (bCollectXTC)
+            {
+                dd_collect_xtc(cr->dd,state_local,groups,xxtc);
+            }
+            else if ((mdof_flags & MDOF_X) ||
+                     ((mdof_flags & MDOF_XTC) && !bChunkXTC))
             {
                 dd_collect_vec(cr->dd,state_local,state_local->x,
                                state_global->x);
@@ -646,67 +967,67 @@ void write_traj(FILE *fplog,t_commrec *cr,
          }
      }
 
-     if (MASTER(cr))
-     {
-         if (mdof_flags & MDOF_CPT)
-         {
-             write_checkpoint(of->fn_cpt,of->bKeepAndNumCPT,
-                              fplog,cr,of->eIntegrator,of->simulation_part,
-                              of->bExpanded,of->elamstats,step,t,state_global);
-         }
+    if (MASTER(cr))
+    {
+        if (mdof_flags & MDOF_CPT)
+        {
+            if (of->async != NULL)
+            {
+                /* The checkpoint stores the trajectory file positions */
+                mdoutf_async_wait(of->async);
+            }
+            write_checkpoint(of->fn_cpt,of->bKeepAndNumCPT,
+                             fplog,cr,of->eIntegrator,of->simulation_part,
+                             of->bExpanded,of->elamstats,step,t,state_global);
+        }
 
-         if (mdof_flags & (MDOF_X | MDOF_V | MDOF_F))
-         {
-            fwrite_trn(of->fp_trn,step,t,state_local->lambda[efptFEP],
-                       state_local->box,top_global->natoms,
-                       (mdof_flags & MDOF_X) ? state_global->x : NULL,
-                       (mdof_flags & MDOF_V) ? global_v : NULL,
-                       (mdof_flags & MDOF_F) ? f_global : NULL);
-            if (gmx_fio_flush(of->fp_trn) != 0)
+        if ((mdof_flags & MDOF_XTC) && !bCollectXTC && !bChunkXTC &&
+            xxtc != state_global->x)
+        {
+            if (*n_xtc == top_global->natoms)
             {
-                gmx_file("Cannot write trajectory; maybe you are out of disk space?");
+                memcpy(xxtc,state_global->x,*n_xtc*sizeof(*xxtc));
             }
-            gmx_fio_check_file_position(of->fp_trn);
-        }      
-        if (mdof_flags & MDOF_XTC) {
-            groups = &top_global->groups;
-            if (*n_xtc == -1)
+            else
             {
-                *n_xtc = 0;
-                for(i=0; (i<top_global->natoms); i++)
-                {
-                    if (ggrpnr(groups,egcXTC,i) == 0)
-                    {
-                        (*n_xtc)++;
-                    }
-                }
-                if (*n_xtc != top_global->natoms)
-                {
-                    snew(*x_xtc,*n_xtc);
-                }
+                select_xtc_x(top_global,state_global->x,xxtc);
             }
-            if (*n_xtc == top_global->natoms)
+        }
+
+        if (frame == NULL)
+        {
+            write_trn_xtc(of,mdof_flags,step,t,state_local->lambda[efptFEP],
+                          state_local->box,top_global->natoms,
+                          state_global->x,global_v,f_global,*n_xtc,xxtc,
+                          xtc_nchunk,xtc_nbytes,
+                          bChunkXTC ? of->xtc_chunks : NULL);
+        }
+        else
+        {
+            /* Copy the frame, the I/O thread compresses and writes it */
+            frame->mdof_flags = mdof_flags;
+            frame->step       = step;
+            frame->t          = t;
+            frame->lambda     = state_local->lambda[efptFEP];
+            copy_mat(state_local->box,frame->box);
+            frame->natoms     = top_global->natoms;
+            frame->n_xtc      = *n_xtc;
+            frame->bXtcChunks = bChunkXTC;
+            frame->xtc_nchunk = xtc_nchunk;
+            frame->xtc_nbytes = xtc_nbytes;
+            if (mdof_flags & MDOF_X)
             {
-                xxtc = state_global->x;
+                copy_frame_vec(frame->natoms,state_global->x,&frame->x);
             }
-            else
+            if (mdof_flags & MDOF_V)
             {
-                xxtc = *x_xtc;
-                j = 0;
-                for(i=0; (i<top_global->natoms); i++)
-                {
-                    if (ggrpnr(groups,egcXTC,i) == 0)
-                    {
-                        copy_rvec(state_global->x[i],xxtc[j++]);
-                    }
-                }
+                copy_frame_vec(frame->natoms,global_v,&frame->v);
             }
-            if (write_xtc(of->fp_xtc,*n_xtc,step,t,
-                          state_local->box,xxtc,of->xtc_prec) == 0)
+            if (mdof_flags & MDOF_F)
             {
-                gmx_fatal(FARGS,"XTC error - maybe you are out of disk space?");
+                copy_frame_vec(frame->natoms,f_global,&frame->f);
             }
-            gmx_fio_check_file_position(of->fp_xtc);
+            mdoutf_async_queue(of->async);
         }
     }
 }
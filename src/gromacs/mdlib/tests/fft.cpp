@@ -37,6 +37,7 @@
  */
 
 #include "config.h"
+#include <algorithm>
 #include <vector>
 #include <complex>
 #include <gtest/gtest.h>
@@ -44,6 +45,8 @@
 #include "gromacs/utility/stringutil.h"
 #include "gmx_fft.h"
 #include "gmx_parallel_3dfft.h"
+#include "gmx_omp.h"
+#include "../fft5d.h"
 
 namespace
 {
@@ -279,4 +282,225 @@ TEST_F(FFFTest3D, Real5_6_9)
     }
 }
 
+#ifdef GMX_THREAD_MPI
+/*! \brief
+ * Setup and per-rank results of a 3D-FFT on thread-MPI ranks.
+ *
+ * The ranks are arranged as in PME, nmajor along x and nminor along y.
+ * Results are indexed on [pipelined][rank].
+ */
+struct FFT5DRun
+{
+    int                                     ndata[3];
+    int                                     nmajor, nminor;
+    int                                     nthreads;
+    int                                     nchunk[2][2];
+    std::vector< std::vector<real> >        input;
+    std::vector< std::vector<real> >        forward[2];
+    std::vector< std::vector<real> >        backward[2];
+};
+
+//! Runs fft5d_execute for plan on nthreads OpenMP threads.
+void executeFFT5D(fft5d_plan plan, int nthreads)
+{
+#pragma omp parallel num_threads(nthreads)
+    {
+        fft5d_execute(plan, gmx_omp_get_thread_num(), NULL);
+    }
+}
+
+/*! \brief
+ * Thread-MPI rank function: does a forward real-to-complex and a backward
+ * complex-to-real transform, with and without FFT5D_PIPELINE.
+ *
+ * Plans are made as in gmx_parallel_3dfft_init().
+ */
+void runFFT5DRank(void *arg)
+{
+    FFT5DRun  *run = static_cast<FFT5DRun *>(arg);
+    const int  nin = sizeof(inputdata)/sizeof(real);
+    int        rN  = run->ndata[2], M = run->ndata[1], K = run->ndata[0];
+    int        rank;
+    MPI_Comm   comm[2], rcomm[2];
+
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    if (run->nminor == 1)
+    {
+        comm[0] = MPI_COMM_WORLD;
+        comm[1] = MPI_COMM_NULL;
+    }
+    else
+    {
+        MPI_Comm_split(MPI_COMM_WORLD, rank % run->nminor, rank, &comm[0]);
+        MPI_Comm_split(MPI_COMM_WORLD, rank/run->nminor, rank, &comm[1]);
+    }
+    rcomm[0] = comm[1];
+    rcomm[1] = comm[0];
+
+    for (int bPipe = 0; bPipe < 2; bPipe++)
+    {
+        int         flags = FFT5D_REALCOMPLEX | FFT5D_ORDER_YZ | FFT5D_NOMEASURE;
+        t_complex  *rdata, *cdata, *buf1, *buf2;
+        fft5d_plan  p1, p2;
+
+        if (bPipe)
+        {
+            flags |= FFT5D_PIPELINE;
+        }
+        p1 = fft5d_plan_3d(rN, M, K, rcomm, flags,
+                           &rdata, &cdata, &buf1, &buf2, run->nthreads);
+        p2 = fft5d_plan_3d(K, rN, M, rcomm,
+                           (flags | FFT5D_BACKWARD | FFT5D_NOMALLOC) ^ FFT5D_ORDER_YZ,
+                           &cdata, &rdata, &buf1, &buf2, run->nthreads);
+        run->nchunk[bPipe][0] = p1->nchunk[0];
+        run->nchunk[bPipe][1] = p1->nchunk[1];
+
+        /* Real lines of rC[0] values, stored with a stride of 2*C[0] */
+        const int          rstride = 2*p1->C[0];
+        const int          nline   = p1->pM[0]*p1->pK[0];
+        const int          ncplx   = p2->C[0]*p2->pM[0]*p2->pK[0];
+        real              *r       = reinterpret_cast<real *>(rdata);
+        std::vector<real> &in      = run->input[rank];
+        std::vector<real> &fwd     = run->forward[bPipe][rank];
+        std::vector<real> &bwd     = run->backward[bPipe][rank];
+
+        in.clear();
+        for (int l = 0; l < nline; l++)
+        {
+            for (int x = 0; x < rstride; x++)
+            {
+                r[l*rstride + x] = (x < p1->rC[0] ?
+                                    inputdata[(rank*37 + l*rstride + x) % nin] : 0);
+            }
+            in.insert(in.end(), r + l*rstride, r + l*rstride + p1->rC[0]);
+        }
+        executeFFT5D(p1, run->nthreads);
+        fwd.assign(reinterpret_cast<real *>(cdata),
+                   reinterpret_cast<real *>(cdata) + 2*ncplx);
+        executeFFT5D(p2, run->nthreads);
+        for (int l = 0; l < nline; l++)
+        {
+            bwd.insert(bwd.end(), r + l*rstride, r + l*rstride + p1->rC[0]);
+        }
+
+        fft5d_destroy(p2);
+        fft5d_destroy(p1);
+    }
+
+    if (run->nminor > 1)
+    {
+        MPI_Comm_free(&comm[0]);
+        MPI_Comm_free(&comm[1]);
+    }
+}
+
+/*! \brief
+ * Tests that FFT5D_PIPELINE gives the same output as the plain transposes.
+ *
+ * The ranks are started as thread-MPI threads, the calling thread is rank 0
+ * and returns when all ranks are done.
+ */
+class FFT5DPipelineTest : public ::testing::Test
+{
+    public:
+        ~FFT5DPipelineTest()
+        {
+            gmx_fft_cleanup();
+        }
+
+        //! Transforms a nx x ny x nz grid on nmajor x nminor ranks.
+        void run(int nx, int ny, int nz, int nmajor, int nminor, int nthreads)
+        {
+            const int nranks = nmajor*nminor;
+
+            run_.ndata[0] = nx;
+            run_.ndata[1] = ny;
+            run_.ndata[2] = nz;
+            run_.nmajor   = nmajor;
+            run_.nminor   = nminor;
+            run_.nthreads = nthreads;
+            run_.input.assign(nranks, std::vector<real>());
+            for (int bPipe = 0; bPipe < 2; bPipe++)
+            {
+                run_.forward[bPipe].assign(nranks, std::vector<real>());
+                run_.backward[bPipe].assign(nranks, std::vector<real>());
+            }
+            ASSERT_EQ(TMPI_SUCCESS,
+                      tMPI_Init_fn(FALSE, nranks, TMPI_AFFINITY_NONE,
+                                   runFFT5DRank, &run_));
+        }
+
+        //! Checks that exactly the decomposed transposes were pipelined.
+        void checkPipelined()
+        {
+            /* The transposes are along y (minor) and then x (major) */
+            const int P[2] = { run_.nminor, run_.nmajor };
+
+            for (int s = 0; s < 2; s++)
+            {
+                EXPECT_EQ(0, run_.nchunk[0][s]) << "transpose " << s;
+                if (P[s] > 1)
+                {
+                    EXPECT_GT(run_.nchunk[1][s], 1) << "transpose " << s;
+                }
+                else
+                {
+                    EXPECT_EQ(0, run_.nchunk[1][s]) << "transpose " << s;
+                }
+            }
+        }
+
+        /*! \brief
+         * Checks that the backward transform returns the input scaled
+         * by the grid size, and that the pipelined output is identical.
+         */
+        void checkOutput()
+        {
+            const real scale = run_.ndata[0]*run_.ndata[1]*run_.ndata[2];
+
+            for (size_t rank = 0; rank < run_.input.size(); rank++)
+            {
+                const std::vector<real> &in = run_.input[rank];
+
+                ASSERT_FALSE(in.empty());
+                ASSERT_EQ(in.size(), run_.backward[0][rank].size());
+                for (size_t i = 0; i < in.size(); i++)
+                {
+                    ASSERT_NEAR(in[i], run_.backward[0][rank][i]/scale, 1e-4)
+                    << "rank " << rank << " element " << i;
+                }
+                EXPECT_TRUE(run_.forward[0][rank] == run_.forward[1][rank])
+                << "forward output differs on rank " << rank;
+                EXPECT_TRUE(run_.backward[0][rank] == run_.backward[1][rank])
+                << "backward output differs on rank " << rank;
+            }
+        }
+
+        FFT5DRun run_;
+};
+
+TEST_F(FFT5DPipelineTest, Ranks4x1)
+{
+    run(20, 16, 12, 4, 1, 1);
+    checkPipelined();
+    checkOutput();
+}
+
+TEST_F(FFT5DPipelineTest, Ranks2x2)
+{
+    run(20, 16, 12, 2, 2, 1);
+    checkPipelined();
+    checkOutput();
+}
+
+#ifdef GMX_OPENMP
+TEST_F(FFT5DPipelineTest, Ranks2x1With2Threads)
+{
+    run(20, 16, 12, 2, 1, 2);
+    checkPipelined();
+    checkOutput();
+}
+#endif
+#endif
+
 } // namespace
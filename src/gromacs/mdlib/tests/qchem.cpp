@@ -0,0 +1,655 @@
+/*
+ *
+ *                This source code is part of
+ *
+ *                 G   R   O   M   A   C   S
+ *
+ *          GROningen MAchine for Chemical Simulations
+ *
+ * Written by David van der Spoel, Erik Lindahl, Berk Hess, and others.
+ * Copyright (c) 1991-2000, University of Groningen, The Netherlands.
+ * Copyright (c) 2001-2012, The GROMACS development team,
+ * check out http://www.gromacs.org for more information.
+
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * If you want to redistribute modifications, please consider that
+ * scientific software is very special. Version control is crucial -
+ * bugs must be traceable. We will be happy to consider code for
+ * inclusion in the official distribution, but derived work must not
+ * be called official GROMACS. Details are found in the README & COPYING
+ * files - if they are missing, get the official version at www.gromacs.org.
+ *
+ * To help us fund GROMACS development, we humbly ask that you cite
+ * the papers on the package - you can find them in the top README file.
+ *
+ * For more info, check our website at http://www.gromacs.org
+ */
+/*! \internal \file
+ * \brief
+ * Tests the Q-Chem server client against a local stub server.
+ *
+ * \ingroup module_mdlibs
+ */
+
+#include "config.h"
+
+#ifndef GMX_NATIVE_WINDOWS
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <glob.h>
+#include <signal.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+
+#include <gtest/gtest.h>
+
+#include "physics.h"
+#include "smalloc.h"
+#include "vec.h"
+#include "qmmm.h"
+#include "../qm_qchem.h"
+
+namespace
+{
+
+//! Energy in hartree the stub server returns for step 0.
+const double stubEnergy = -76.25;
+//! Number of SCF cycles the stub server reports.
+const int    stubNscf   = 7;
+
+//! Reads exactly n bytes, returns false on EOF or error.
+bool readAll(int fd, void *data, size_t n)
+{
+    char *p = static_cast<char *>(data);
+    while (n > 0)
+    {
+        ssize_t nr = read(fd, p, n);
+        if (nr <= 0)
+        {
+            return false;
+        }
+        p += nr;
+        n -= nr;
+    }
+    return true;
+}
+
+//! Writes exactly n bytes.
+void writeAll(int fd, const void *data, size_t n)
+{
+    const char *p = static_cast<const char *>(data);
+    while (n > 0)
+    {
+        ssize_t nw = write(fd, p, n);
+        if (nw <= 0)
+        {
+            return;
+        }
+        p += nw;
+        n -= nw;
+    }
+}
+
+/*! \brief
+ * Maps the transport buffer fn, returns NULL on failure.
+ *
+ * The client sized the buffer for the request and the reply, so we
+ * can map the whole file.
+ */
+double *mapBuffer(const std::string &fn, size_t *nbytes)
+{
+    int         fd = open(fn.c_str(), O_RDWR);
+    struct stat st;
+    if (fd < 0 || fstat(fd, &st) != 0)
+    {
+        return NULL;
+    }
+    *nbytes   = st.st_size;
+    void *buf = mmap(NULL, *nbytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    return (buf == MAP_FAILED ? NULL : static_cast<double *>(buf));
+}
+
+/*! \brief
+ * Serves canned replies on connection fd until the client quits or
+ * disconnects.
+ *
+ * The gradient on each QM atom is its position and the gradient on each
+ * MM atom is its position times its charge, so the client can check both
+ * directions of the unit conversion. The energy is the harmonic
+ * potential these gradients belong to, plus stubEnergy, the step number
+ * and, with an external potential, the potential on QM atom i times
+ * i + 1, the charge that is returned as dE/dV. The number of SCF
+ * cycles is stubNscf minus the number of guess coefficients sent. The coordinates and charges
+ * come through the socket or through the transport buffer the request
+ * names, the reply goes back the same way; dE/dV always comes through
+ * the socket.
+ */
+void serveConnection(int fd)
+{
+    int header[GMX_QCHEM_NHEADER];
+    while (readAll(fd, header, sizeof(header)) &&
+           header[0] == GMX_QCHEM_MAGIC && header[1] == eqchemGRADIENT)
+    {
+        int                 nQM    = header[3];
+        int                 nMM    = header[4];
+        int                 nguess = header[9];
+        int                 next   = (header[10] ? nQM : 0);
+        int                 io     = header[11];
+        std::vector<int>    atomnr(nQM);
+        std::vector<double> xQM(3*nQM), qMM(nMM), xMM(3*nMM), coeff(nguess);
+        std::vector<double> ext(next), dEdV(next);
+        std::string         fn;
+        int                 nfn = 0;
+        if (nQM > 0 && !readAll(fd, &atomnr[0], nQM*sizeof(int)))
+        {
+            break;
+        }
+        if (io != eqchemioSOCKET)
+        {
+            if (!readAll(fd, &nfn, sizeof(nfn)))
+            {
+                break;
+            }
+            fn.resize(nfn);
+            if (nfn > 0 && !readAll(fd, &fn[0], nfn))
+            {
+                break;
+            }
+        }
+        if (io == eqchemioSOCKET &&
+            ((nQM > 0 && !readAll(fd, &xQM[0], 3*nQM*sizeof(double))) ||
+             (nMM > 0 && !readAll(fd, &qMM[0], nMM*sizeof(double))) ||
+             (nMM > 0 && !readAll(fd, &xMM[0], 3*nMM*sizeof(double)))))
+        {
+            break;
+        }
+        if ((nguess > 0 && !readAll(fd, &coeff[0], nguess*sizeof(double))) ||
+            (next > 0 && !readAll(fd, &ext[0], next*sizeof(double))))
+        {
+            break;
+        }
+        double *buf    = NULL;
+        size_t  nbytes = 0;
+        if (io == eqchemioMMAP)
+        {
+            buf = mapBuffer(fn, &nbytes);
+            if (buf == NULL || buf[0] != nQM || buf[1] != nMM)
+            {
+                break;
+            }
+            std::copy(buf + 2, buf + 2 + 3*nQM, xQM.begin());
+            std::copy(buf + 2 + 3*nQM, buf + 2 + 3*nQM + nMM, qMM.begin());
+            std::copy(buf + 2 + 3*nQM + nMM, buf + 2 + 3*nQM + 4*nMM, xMM.begin());
+        }
+        else if (io == eqchemioTEXT)
+        {
+            FILE *in = std::fopen((fn + ".in").c_str(), "r");
+            int   n[2];
+            if (in == NULL || std::fscanf(in, "%d %d", &n[0], &n[1]) != 2 ||
+                n[0] != nQM || n[1] != nMM)
+            {
+                break;
+            }
+            for (int i = 0; i < 3*nQM; i++)
+            {
+                std::fscanf(in, "%lf", &xQM[i]);
+            }
+            for (int i = 0; i < nMM; i++)
+            {
+                std::fscanf(in, "%lf %lf %lf %lf", &qMM[i],
+                            &xMM[3*i], &xMM[3*i+1], &xMM[3*i+2]);
+            }
+            std::fclose(in);
+        }
+        /* A guess saves SCF cycles, the more so the more steps it uses */
+        int                 reply[GMX_QCHEM_NREPLY] = { GMX_QCHEM_MAGIC, 0, stubNscf - nguess, 0 };
+        std::vector<double> data(1 + 3*nQM + 3*nMM);
+        data[0] = stubEnergy + header[2];
+        for (int i = 0; i < next; i++)
+        {
+            dEdV[i]  = i + 1;
+            data[0] += dEdV[i]*ext[i];
+        }
+        for (int i = 0; i < 3*nQM; i++)
+        {
+            data[0]    += 0.5*xQM[i]*xQM[i];
+            data[1 + i] = xQM[i];
+        }
+        for (int i = 0; i < 3*nMM; i++)
+        {
+            data[0]            += 0.5*qMM[i/3]*xMM[i]*xMM[i];
+            data[1 + 3*nQM + i] = qMM[i/3]*xMM[i];
+        }
+        if (io == eqchemioMMAP)
+        {
+            std::copy(data.begin(), data.end(), buf + 2 + 3*nQM + 4*nMM);
+            munmap(buf, nbytes);
+        }
+        else if (io == eqchemioTEXT)
+        {
+            FILE *out = std::fopen((fn + ".out").c_str(), "w");
+            for (size_t i = 0; i < data.size(); i++)
+            {
+                std::fprintf(out, "%.17g\n", data[i]);
+            }
+            std::fclose(out);
+        }
+        writeAll(fd, reply, sizeof(reply));
+        if (io == eqchemioSOCKET)
+        {
+            writeAll(fd, &data[0], data.size()*sizeof(double));
+        }
+        if (next > 0)
+        {
+            writeAll(fd, &dEdV[0], next*sizeof(double));
+        }
+    }
+    close(fd);
+}
+
+//! Serves every connection in a process of its own, until killed.
+void runStubServer(int listenfd)
+{
+    int fd;
+    while ((fd = accept(listenfd, NULL, NULL)) >= 0)
+    {
+        if (fork() == 0)
+        {
+            serveConnection(fd);
+            _exit(0);
+        }
+        close(fd);
+    }
+}
+
+//! Removes the files matching pattern.
+void removeFiles(const char *pattern)
+{
+    glob_t g;
+    if (glob(pattern, 0, NULL, &g) == 0)
+    {
+        for (size_t i = 0; i < g.gl_pathc; i++)
+        {
+            std::remove(g.gl_pathv[i]);
+        }
+    }
+    globfree(&g);
+}
+
+class QChemServerTest : public ::testing::Test
+{
+    public:
+        QChemServerTest() : listenfd_(-1), server_(-1)
+        {
+            std::sprintf(path_, "/tmp/gmx-qchem-test-%d.sock",
+                         static_cast<int>(getpid()));
+            unlink(path_);
+            listenfd_ = socket(AF_UNIX, SOCK_STREAM, 0);
+            struct sockaddr_un addr;
+            std::memset(&addr, 0, sizeof(addr));
+            addr.sun_family = AF_UNIX;
+            std::strncpy(addr.sun_path, path_, sizeof(addr.sun_path)-1);
+            /* We listen before forking, so connecting can not race */
+            if (bind(listenfd_, reinterpret_cast<struct sockaddr *>(&addr),
+                     sizeof(addr)) == 0 && listen(listenfd_, 4) == 0)
+            {
+                server_ = fork();
+                if (server_ == 0)
+                {
+                    runStubServer(listenfd_);
+                    _exit(0);
+                }
+            }
+        }
+        ~QChemServerTest()
+        {
+            if (server_ > 0)
+            {
+                /* The connections are closed, their servers exit */
+                kill(server_, SIGTERM);
+                waitpid(server_, NULL, 0);
+            }
+            close(listenfd_);
+            unlink(path_);
+        }
+
+        int   listenfd_;
+        pid_t server_;
+        char  path_[108];
+};
+
+//! Returns the harmonic part of the stub server energy in hartree.
+double harmonicEnergy(int nQM, const rvec xQM[],
+                      int nMM, const rvec xMM[], const real qMM[])
+{
+    double e = 0;
+    for (int i = 0; i < nQM; i++)
+    {
+        e += 0.5*norm2(xQM[i])/(BOHR2NM*BOHR2NM);
+    }
+    for (int i = 0; i < nMM; i++)
+    {
+        e += 0.5*qMM[i]*norm2(xMM[i])/(BOHR2NM*BOHR2NM);
+    }
+    return e;
+}
+
+/*! \brief
+ * Runs four steps against the stub server and checks the replies.
+ *
+ * The transport is selected by GMX_QMMM_IO, which should be set, or
+ * not, before calling this.
+ */
+void checkEnergyAndGradients(const char *path)
+{
+    rvec    xQM[2]    = { { 0.1, 0.2, 0.3 }, { -0.1, 0.0, 0.25 } };
+    int     atomnr[2] = { 8, 1 };
+    rvec    xMM[3]    = { { 1.0, 0.0, 0.0 }, { 0.0, 1.0, 0.0 }, { 0.5, 0.5, 0.5 } };
+    real    qMM[3]    = { -0.8, 0.4, 0.4 };
+    t_QMrec qm;
+    t_MMrec mm;
+    std::memset(&qm, 0, sizeof(qm));
+    std::memset(&mm, 0, sizeof(mm));
+    qm.nrQMatoms      = 2;
+    qm.xQM            = xQM;
+    qm.atomicnumberQM = atomnr;
+    qm.multiplicity   = 1;
+    mm.nrMMatoms      = 3;
+    mm.xMM            = xMM;
+    mm.MMcharges      = qMM;
+
+    /* The guess history grows by one every step, up to 2 */
+    real      coeff[2] = { 2.0, -1.0 };
+    t_QMguess guess;
+    std::memset(&guess, 0, sizeof(guess));
+    guess.nhist       = 2;
+    guess.coeff       = coeff;
+    qm.guess          = &guess;
+
+    /* From the last step on we send a long-range potential, in kJ/mol/e */
+    real Vext[2] = { 0.5*HARTREE2KJ*AVOGADRO, 0.25*HARTREE2KJ*AVOGADRO };
+    real Qext[2] = { 0, 0 };
+
+    gmx_qchem_t qc = gmx_qchem_connect(path, NULL, 0);
+    for (int step = 0; step < 4; step++)
+    {
+        rvec QMgrad[2], MMgrad[3];
+        int  nscf = 0;
+        guess.nstored = std::min(step, guess.nhist);
+        if (step == 3)
+        {
+            qm.Vext = Vext;
+            qm.Qext = Qext;
+        }
+        gmx_qchem_send_request(qc, step, &qm, &mm);
+        real ener = gmx_qchem_recv_reply(qc, &qm, &mm, QMgrad, MMgrad, &nscf);
+
+        EXPECT_FLOAT_EQ(stubEnergy + step + (qm.Vext != NULL ? 1.0 : 0) +
+                        harmonicEnergy(2, xQM, 3, xMM, qMM), ener);
+        if (qm.Vext != NULL)
+        {
+            EXPECT_EQ(1, Qext[0]);
+            EXPECT_EQ(2, Qext[1]);
+        }
+        EXPECT_EQ(stubNscf - guess.nstored, nscf);
+        for (int i = 0; i < 2; i++)
+        {
+            for (int d = 0; d < DIM; d++)
+            {
+                EXPECT_FLOAT_EQ(xQM[i][d]/BOHR2NM, QMgrad[i][d]);
+            }
+        }
+        for (int i = 0; i < 3; i++)
+        {
+            for (int d = 0; d < DIM; d++)
+            {
+                EXPECT_FLOAT_EQ(qMM[i]*xMM[i][d]/BOHR2NM, MMgrad[i][d]);
+            }
+        }
+    }
+    gmx_qchem_close(qc);
+}
+
+TEST_F(QChemServerTest, ReturnsEnergyAndGradients)
+{
+    ASSERT_GT(server_, 0);
+    unsetenv("GMX_QMMM_IO");
+    checkEnergyAndGradients(path_);
+}
+
+TEST_F(QChemServerTest, ReturnsEnergyAndGradientsThroughMappedBuffer)
+{
+    ASSERT_GT(server_, 0);
+    setenv("GMX_QMMM_IO", "mmap", 1);
+    checkEnergyAndGradients(path_);
+    unsetenv("GMX_QMMM_IO");
+}
+
+TEST_F(QChemServerTest, ReturnsEnergyAndGradientsThroughTextFiles)
+{
+    ASSERT_GT(server_, 0);
+    setenv("GMX_QMMM_IO", "text", 1);
+    checkEnergyAndGradients(path_);
+    unsetenv("GMX_QMMM_IO");
+    removeFiles("qchem*.in");
+    removeFiles("qchem*.out");
+}
+
+/*! \brief
+ * Runs two QM records over connections of their own at the same time.
+ *
+ * Both requests are sent before either reply is read, as concurrent
+ * ONIOM layers do, and each reply should belong to its own request.
+ */
+TEST_F(QChemServerTest, KeepsAConnectionPerQMrec)
+{
+    ASSERT_GT(server_, 0);
+    unsetenv("GMX_QMMM_IO");
+    setenv("QCHEM_SOCKET", path_, 1);
+
+    rvec    xQM[2][1] = { { { 0.1, 0.2, 0.3 } }, { { -0.3, 0.1, 0.0 } } };
+    int     atomnr[1] = { 8 };
+    rvec    xMM[1]    = { { 1.0, 0.0, 0.0 } };
+    real    qMM[1]    = { -0.5 };
+    t_QMrec qm[2];
+    t_MMrec mm;
+    std::memset(&mm, 0, sizeof(mm));
+    mm.nrMMatoms = 1;
+    mm.xMM       = xMM;
+    mm.MMcharges = qMM;
+    for (int k = 0; k < 2; k++)
+    {
+        std::memset(&qm[k], 0, sizeof(qm[k]));
+        qm[k].nrQMatoms      = 1;
+        qm[k].xQM            = xQM[k];
+        qm[k].atomicnumberQM = atomnr;
+        qm[k].multiplicity   = 1;
+        init_qchem(NULL, &qm[k], &mm);
+        ASSERT_TRUE(qm[k].qchem != NULL);
+    }
+    EXPECT_NE(qm[0].qchem, qm[1].qchem);
+
+    for (int step = 0; step < 2; step++)
+    {
+        for (int k = 0; k < 2; k++)
+        {
+            gmx_qchem_send_request(qm[k].qchem, step + k, &qm[k], &mm);
+        }
+        for (int k = 1; k >= 0; k--)
+        {
+            rvec QMgrad[1], MMgrad[1];
+            real ener = gmx_qchem_recv_reply(qm[k].qchem, &qm[k], &mm,
+                                             QMgrad, MMgrad, NULL);
+            EXPECT_FLOAT_EQ(stubEnergy + step + k +
+                            harmonicEnergy(1, xQM[k], 1, xMM, qMM), ener);
+            for (int d = 0; d < DIM; d++)
+            {
+                EXPECT_FLOAT_EQ(xQM[k][0][d]/BOHR2NM, QMgrad[0][d]);
+            }
+        }
+    }
+    for (int k = 0; k < 2; k++)
+    {
+        done_qchem(&qm[k]);
+        EXPECT_TRUE(qm[k].qchem == NULL);
+        sfree(qm[k].QMgrad);
+    }
+    unsetenv("QCHEM_SOCKET");
+}
+
+#ifdef GMX_QMMM_QCHEM
+/*! \brief
+ * Integrates the stub server potential with QM/MM multiple time stepping.
+ *
+ * The full QM forces are computed every nstQM steps on top of an MM
+ * only reference, through calculate_QMMM, and applied as an impulse
+ * like md does. The total energy at the full QM steps should not drift.
+ */
+TEST_F(QChemServerTest, ConservesEnergyWithMultipleTimeStepping)
+{
+    ASSERT_GT(server_, 0);
+    unsetenv("GMX_QMMM_IO");
+    setenv("QCHEM_SOCKET", path_, 1);
+
+    const int    natoms = 5, nQM = 2, nMM = 3, nstQM = 2, nsteps = 1000;
+    const real   dt     = 0.0002;
+    rvec         x[natoms] = {
+        { 0.10, 0.20, 0.30 }, { -0.10, 0.00, 0.25 },
+        { 0.20, 0.00, 0.00 }, { 0.00, -0.15, 0.00 }, { 0.10, 0.10, 0.10 }
+    };
+    const real   mass[natoms] = { 16, 12, 12, 14, 12 };
+    rvec         v[natoms], f[natoms], force[natoms], fshift[SHIFTS];
+    rvec         xQM[nQM], xMM[nMM], f_mts[natoms];
+    rvec         f_QM[natoms], fshift_QM[natoms], f_ref[natoms], fshift_ref[natoms];
+    int          indexQM[nQM] = { 0, 1 }, indexMM[nMM] = { 2, 3, 4 };
+    int          shiftQM[nQM] = { 0 }, shiftMM[nMM] = { 0 };
+    int          atomnr[nQM]  = { 8, 6 };
+    real         qMM[nMM]     = { 0.3, 0.5, 0.2 };
+    t_QMrec      qm;
+    t_MMrec      mm;
+    t_QMrec     *qmp = &qm;
+    t_QMMMrec    qr;
+    t_forcerec   fr;
+    std::memset(&qm, 0, sizeof(qm));
+    std::memset(&mm, 0, sizeof(mm));
+    std::memset(&qr, 0, sizeof(qr));
+    std::memset(&fr, 0, sizeof(fr));
+    clear_rvecs(natoms, v);
+    clear_rvecs(SHIFTS, fshift);
+    clear_rvecs(natoms, f_mts);
+    clear_rvecs(natoms, f_ref);
+    clear_rvecs(natoms, fshift_ref);
+    qm.nrQMatoms      = nQM;
+    qm.xQM            = xQM;
+    qm.indexQM        = indexQM;
+    qm.shiftQM        = shiftQM;
+    qm.atomicnumberQM = atomnr;
+    qm.multiplicity   = 1;
+    qm.QMmethod       = eQMmethodRHF;
+    mm.nrMMatoms      = nMM;
+    mm.xMM            = xMM;
+    mm.indexMM        = indexMM;
+    mm.shiftMM        = shiftMM;
+    mm.MMcharges      = qMM;
+    /* This is what init_QMMM_mts sets up without a QM reference */
+    qr.QMMMscheme     = eQMMMschemenormal;
+    qr.nrQMlayers     = 1;
+    qr.qm             = &qmp;
+    qr.mm             = &mm;
+    qr.nstQM          = nstQM;
+    qr.natoms_mts     = natoms;
+    qr.f_mts          = f_mts;
+    qr.f_QM           = f_QM;
+    qr.fshift_QM      = fshift_QM;
+    qr.f_ref          = f_ref;
+    qr.fshift_ref     = fshift_ref;
+    fr.qr             = &qr;
+    fr.fshift         = fshift;
+    init_qchem(NULL, &qm, &mm);
+
+    std::vector<double> etot;
+    double              ekinOld = 0;
+    for (int step = 0; step <= nsteps; step++)
+    {
+        gmx_bool bFullQM = (step % nstQM == 0);
+        int      ncalls  = qm.ncalls;
+        for (int i = 0; i < nQM; i++)
+        {
+            copy_rvec(x[indexQM[i]], xQM[i]);
+        }
+        for (int i = 0; i < nMM; i++)
+        {
+            copy_rvec(x[indexMM[i]], xMM[i]);
+        }
+        clear_rvecs(natoms, f);
+        real epot = calculate_QMMM(NULL, step, NULL, x, f, &fr, NULL,
+                                   bFullQM, NULL);
+        /* As combine_forces in update, the impulse is nstQM times the
+         * full QM minus reference forces
+         */
+        double ekin = 0;
+        for (int i = 0; i < natoms; i++)
+        {
+            for (int d = 0; d < DIM; d++)
+            {
+                force[i][d] = f[i][d];
+                if (bFullQM)
+                {
+                    force[i][d] += (nstQM - 1)*f_mts[i][d];
+                }
+                v[i][d] += force[i][d]/mass[i]*dt;
+                x[i][d] += v[i][d]*dt;
+            }
+            ekin += 0.5*mass[i]*norm2(v[i]);
+        }
+        /* The leap-frog kinetic energy is the average of the half steps,
+         * the first step only provides the previous half step.
+         */
+        if (bFullQM && step > 0)
+        {
+            epot -= (stubEnergy + ncalls)*HARTREE2KJ*AVOGADRO;
+            etot.push_back(epot + 0.5*(ekinOld + ekin));
+        }
+        ekinOld = ekin;
+    }
+    done_qchem(&qm);
+    sfree(qm.QMgrad);
+    unsetenv("QCHEM_SOCKET");
+
+    /* The energy fluctuates with (omega nstQM dt)^2, but does not drift */
+    size_t n     = etot.size(), nq = n/4;
+    double first = 0, last = 0, maxdev = 0;
+    for (size_t k = 0; k < nq; k++)
+    {
+        first += etot[k]/nq;
+        last  += etot[n - nq + k]/nq;
+    }
+    for (size_t k = 0; k < n; k++)
+    {
+        maxdev = std::max(maxdev, std::abs(etot[k] - etot[0]));
+    }
+    EXPECT_LT(maxdev, 0.02*etot[0]);
+    EXPECT_LT(std::abs(last - first), 1e-3*etot[0]);
+}
+#endif
+
+} // namespace
+
+#endif
@@ -0,0 +1,210 @@
+/*
+ *
+ *                This source code is part of
+ *
+ *                 G   R   O   M   A   C   S
+ *
+ *          GROningen MAchine for Chemical Simulations
+ *
+ * Written by David van der Spoel, Erik Lindahl, Berk Hess, and others.
+ * Copyright (c) 1991-2000, University of Groningen, The Netherlands.
+ * Copyright (c) 2001-2012, The GROMACS development team,
+ * check out http://www.gromacs.org for more information.
+
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * If you want to redistribute modifications, please consider that
+ * scientific software is very special. Version control is crucial -
+ * bugs must be traceable. We will be happy to consider code for
+ * inclusion in the official distribution, but derived work must not
+ * be called official GROMACS. Details are found in the README & COPYING
+ * files - if they are missing, get the official version at www.gromacs.org.
+ *
+ * To help us fund GROMACS development, we humbly ask that you cite
+ * the papers on the package - you can find them in the top README file.
+ *
+ * For more info, check our website at http://www.gromacs.org
+ */
+/*! \internal \file
+ * \brief
+ * Tests QM/MM multiple time stepping independently of the QM package.
+ *
+ * \ingroup module_mdlibs
+ */
+
+#include <cmath>
+#include <cstring>
+#include <algorithm>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "typedefs.h"
+#include "vec.h"
+#include "qmmm.h"
+#include "update.h"
+
+namespace
+{
+
+//! Number of QM, MM and all atoms in the test system.
+const int natomsQM = 2, natomsMM = 2, natoms = natomsQM + natomsMM;
+
+/*! \brief
+ * Stub QM potential, harmonic springs with force constant k between all
+ * atom pairs. Stores the gradient on the QM and MM atoms, in the order
+ * of the QM/MM records, in grad and returns the energy.
+ */
+real stubQM(const rvec x[], real k, rvec grad[])
+{
+    const real r0  = 0.15;
+    real       ener = 0;
+
+    clear_rvecs(natoms, grad);
+    for (int i = 0; i < natoms; i++)
+    {
+        for (int j = i + 1; j < natoms; j++)
+        {
+            rvec dx;
+            rvec_sub(x[i], x[j], dx);
+            real r    = norm(dx);
+            real fscal = k*(r - r0)/r;
+            ener += 0.5*k*(r - r0)*(r - r0);
+            for (int d = 0; d < DIM; d++)
+            {
+                grad[i][d] += fscal*dx[d];
+                grad[j][d] -= fscal*dx[d];
+            }
+        }
+    }
+    return ener;
+}
+
+/*! \brief
+ * Integrates the stub QM potential with QM/MM multiple time stepping.
+ *
+ * As md does with GMX_QMMM_NSTQM, the cheap reference forces are applied
+ * every step and the full minus reference forces every nstQM steps as an
+ * impulse, through add_QMMM_mts_forces and combine_forces.
+ */
+TEST(QMMMMultipleTimeSteppingTest, CombinesForcesAndConservesEnergy)
+{
+    const int  nstQM = 4, nsteps = 2000;
+    const real dt    = 0.0005, kFull = 4000, kRef = 3000;
+    rvec       x[natoms] = {
+        { 0.00, 0.00, 0.00 }, { 0.17, 0.02, 0.00 },
+        { 0.05, 0.16, 0.01 }, { 0.10, 0.08, 0.14 }
+    };
+    const real mass[natoms] = { 16, 12, 14, 12 };
+    rvec       v[natoms], f[natoms], fshift[SHIFTS], f_mts[natoms];
+    rvec       gradQM[natoms], fshiftQM[natoms], gradRef[natoms], fshiftRef[natoms];
+    int        indexQM[natomsQM] = { 0, 1 }, indexMM[natomsMM] = { 2, 3 };
+    int        shiftQM[natomsQM] = { 0 }, shiftMM[natomsMM] = { 0 };
+    t_QMrec    qm;
+    t_MMrec    mm;
+    t_QMrec   *qmp = &qm;
+    t_QMMMrec  qr;
+    t_inputrec ir;
+    std::memset(&qm, 0, sizeof(qm));
+    std::memset(&mm, 0, sizeof(mm));
+    std::memset(&qr, 0, sizeof(qr));
+    std::memset(&ir, 0, sizeof(ir));
+    clear_rvecs(natoms, v);
+    clear_rvecs(natoms, f_mts);
+    clear_rvecs(natoms, fshiftQM);
+    clear_rvecs(natoms, fshiftRef);
+    qm.nrQMatoms  = natomsQM;
+    qm.indexQM    = indexQM;
+    qm.shiftQM    = shiftQM;
+    mm.nrMMatoms  = natomsMM;
+    mm.indexMM    = indexMM;
+    mm.shiftMM    = shiftMM;
+    qr.nrQMlayers = 1;
+    qr.qm         = &qmp;
+    qr.mm         = &mm;
+    qr.nstQM      = nstQM;
+    qr.natoms_mts = natoms;
+    qr.f_mts      = f_mts;
+    qr.f_QM       = gradQM;
+    qr.fshift_QM  = fshiftQM;
+    qr.f_ref      = gradRef;
+    qr.fshift_ref = fshiftRef;
+
+    std::vector<double> etot;
+    double              ekinOld = 0;
+    for (int step = 0; step <= nsteps; step++)
+    {
+        gmx_bool bFullQM = (step % nstQM == 0);
+        real     Eref    = stubQM(x, kRef, gradRef);
+        real     EQM     = (bFullQM ? stubQM(x, kFull, gradQM) : 0);
+
+        clear_rvecs(natoms, f);
+        clear_rvecs(SHIFTS, fshift);
+        real     epot    = add_QMMM_mts_forces(&qr, bFullQM, Eref, EQM,
+                                               f, fshift);
+        rvec    *force   = f;
+        if (bFullQM)
+        {
+            EXPECT_FLOAT_EQ(EQM, epot);
+            /* As update_coords does with the nstQM forces */
+            combine_forces(nstQM, NULL, &ir, NULL, NULL, NULL, step, NULL,
+                           FALSE, 0, natoms, f, f_mts, NULL);
+            force = f_mts;
+            if (step == 0)
+            {
+                for (int i = 0; i < natoms; i++)
+                {
+                    for (int d = 0; d < DIM; d++)
+                    {
+                        EXPECT_FLOAT_EQ(-gradRef[i][d] - nstQM*(gradQM[i][d] - gradRef[i][d]),
+                                        force[i][d]);
+                    }
+                }
+            }
+        }
+        else
+        {
+            EXPECT_FLOAT_EQ(Eref + qr.dE_mts, epot);
+        }
+
+        double ekin = 0;
+        for (int i = 0; i < natoms; i++)
+        {
+            for (int d = 0; d < DIM; d++)
+            {
+                v[i][d] += force[i][d]/mass[i]*dt;
+                x[i][d] += v[i][d]*dt;
+            }
+            ekin += 0.5*mass[i]*norm2(v[i]);
+        }
+        /* The leap-frog kinetic energy is the average of the half steps,
+         * the first step only provides the previous half step.
+         */
+        if (bFullQM && step > 0)
+        {
+            etot.push_back(EQM + 0.5*(ekinOld + ekin));
+        }
+        ekinOld = ekin;
+    }
+
+    /* The energy fluctuates with (omega nstQM dt)^2, but does not drift */
+    size_t n     = etot.size(), nq = n/4;
+    double first = 0, last = 0, maxdev = 0;
+    for (size_t k = 0; k < nq; k++)
+    {
+        first += etot[k]/nq;
+        last  += etot[n - nq + k]/nq;
+    }
+    for (size_t k = 0; k < n; k++)
+    {
+        maxdev = std::max(maxdev, std::abs(etot[k] - etot[0]));
+    }
+    ASSERT_GT(etot[0], 0);
+    EXPECT_LT(maxdev, 0.05*etot[0]);
+    EXPECT_LT(std::abs(last - first), 2e-3*etot[0]);
+}
+
+} // namespace
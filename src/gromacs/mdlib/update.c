@@ -1205,7 +1205,7 @@ static void deform(gmx_update_t upd,
     }
 }
 
-static void combine_forces(int nstcalclr,
+void combine_forces(int nstcalclr,
                            gmx_constr_t constr,
                            t_inputrec *ir,t_mdatoms *md,t_idef *idef,
                            t_commrec *cr,
@@ -1686,6 +1686,7 @@ void update_coords(FILE         *fplog,
                    rvec         *f,        /* forces on home particles */
                    gmx_bool         bDoLR,
                    rvec         *f_lr,
+                   int          nstlr,
                    t_fcdata     *fcd,
                    gmx_ekindata_t *ekind,
                    matrix       M,
@@ -1740,14 +1741,15 @@ void update_coords(FILE         *fplog,
     bNH = inputrec->etc == etcNOSEHOOVER;
     bPR = ((inputrec->epc == epcPARRINELLORAHMAN) || (inputrec->epc == epcMTTK));
 
-    if (bDoLR && inputrec->nstcalclr > 1 && !EI_VV(inputrec->eI))  /* get this working with VV? */
+    if (bDoLR && nstlr > 1 && !EI_VV(inputrec->eI))  /* get this working with VV? */
     {
-        /* Store the total force + nstcalclr-1 times the LR force
+        /* Store the total force + nstlr-1 times the LR force
          * in forces_lr, so it can be used in a normal update algorithm
-         * to produce twin time stepping.
+         * to produce twin time stepping. nstlr is nstcalclr for
+         * twin-range forces and nstQM for QM/MM multiple time stepping.
          */
         /* is this correct in the new construction? MRS */
-        combine_forces(inputrec->nstcalclr,constr,inputrec,md,idef,cr,
+        combine_forces(nstlr,constr,inputrec,md,idef,cr,
                        step,state,bMolPBC,
                        start,nrend,f,f_lr,nrnb);
         force = f_lr;
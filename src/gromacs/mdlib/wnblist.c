@@ -149,7 +149,7 @@ void dump_nblist(FILE *out,t_commrec *cr,t_forcerec *fr,int nDNL)
   }
   fprintf(fp,"%s\n",header);
 
-  for(n=0; (n<fr->nnblists); n++)
+  for(n=0; (n<fr->nnblists*fr->nthread_ns); n++)
     for(i=0; (i<eNL_NR); i++) 
       write_nblist(fp,cr->dd,&fr->nblists[n].nlist_sr[i],nDNL);
 #endif
@@ -158,7 +158,7 @@ void dump_nblist(FILE *out,t_commrec *cr,t_forcerec *fr,int nDNL)
 
   fprintf(out,"%s\n",header);
 
-  for(n=0; (n<fr->nnblists); n++)
+  for(n=0; (n<fr->nnblists*fr->nthread_ns); n++)
     for(i=0; (i<eNL_NR); i++) 
       write_nblist(out,cr->dd,&fr->nblists[n].nlist_sr[i],nDNL);
 
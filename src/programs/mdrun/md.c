@@ -203,6 +203,8 @@ double do_md(FILE *fplog,t_commrec *cr,int nfile,const t_filenm fnm[],
     gmx_bool        bResetCountersHalfMaxH=FALSE;
     gmx_bool        bVV,bIterations,bFirstIterate,bTemp,bPres,bTrotter;
     gmx_bool        bUpdateDoLR;
+    rvec            *f_lr;
+    int             nstlr;
     real        mu_aver=0,dvdl;
     int         a0,a1,gnx=0,ii;
     atom_id     *grpindex=NULL;
@@ -234,6 +236,7 @@ double do_md(FILE *fplog,t_commrec *cr,int nfile,const t_filenm fnm[],
     pme_load_balancing_t pme_loadbal=NULL;
     double          cycles_pmes;
     gmx_bool        bPMETuneTry=FALSE,bPMETuneRunning=FALSE;
+    gmx_bool        bCheckNpme;
 
 #ifdef GMX_FAHCORE
     /* Temporary addition for FAHCORE checkpointing */
@@ -510,9 +513,11 @@ double do_md(FILE *fplog,t_commrec *cr,int nfile,const t_filenm fnm[],
                                         repl_ex_nst,repl_ex_nex,repl_ex_seed);
     }
 
-    /* PME tuning is only supported with GPUs or PME nodes and not with rerun */
+    /* PME tuning is only supported with GPUs or PME nodes and not with rerun
+     * or PME mesh multiple time stepping.
+     */
     if ((Flags & MD_TUNEPME) &&
-        EEL_PME(fr->eeltype) &&
+        EEL_PME(fr->eeltype) && fr->nstpme == 1 &&
         ( (fr->cutoff_scheme == ecutsVERLET && fr->nbv->bUseGPU) || !(cr->duty & DUTY_PME)) &&
         !bRerunMD)
     {
@@ -530,6 +535,12 @@ double do_md(FILE *fplog,t_commrec *cr,int nfile,const t_filenm fnm[],
         }
     }
 
+    /* With separate PME nodes we check the number of PME nodes
+     * with the load measured after the PME tuning has finished.
+     */
+    bCheckNpme = (DOMAINDECOMP(cr) && !(cr->duty & DUTY_PME) && !bRerunMD &&
+                  fr->nstpme == 1);
+
     if (!ir->bContinuation && !bRerunMD)
     {
         if (mdatoms->cFREEZE && (state->flags & (1<<estV)))
@@ -1105,6 +1116,42 @@ double do_md(FILE *fplog,t_commrec *cr,int nfile,const t_filenm fnm[],
                 force_flags |= GMX_FORCE_DO_LR;
             }
         }
+
+        /* If we are using twin-range interactions where the long-range component
+         * is only evaluated every nstcalclr>1 steps, we should do a special update
+         * step to combine the long-range forces on these steps.
+         * For nstcalclr=1 this is not done, since the forces would have been added
+         * directly to the short-range forces already.
+         * QM/MM multiple time stepping works the same, with the full QM minus
+         * reference forces as long-range forces every nstQM steps,
+         * as does PME mesh multiple time stepping every nstpme steps.
+         */
+        if (fr->bQMMM && fr->qr->nstQM > 1)
+        {
+            bUpdateDoLR = do_per_step(step,fr->qr->nstQM);
+            f_lr        = fr->qr->f_mts;
+            nstlr       = fr->qr->nstQM;
+        }
+        else if (fr->nstpme > 1)
+        {
+            bUpdateDoLR = do_per_step(step,fr->nstpme);
+            f_lr        = fr->f_pme_mts;
+            nstlr       = fr->nstpme;
+        }
+        else
+        {
+            bUpdateDoLR = (fr->bTwinRange && do_per_step(step,ir->nstcalclr));
+            f_lr        = fr->f_twin;
+            nstlr       = ir->nstcalclr;
+        }
+        if (fr->bQMMM && (bRerunMD || do_per_step(step,fr->qr->nstQM)))
+        {
+            force_flags |= GMX_FORCE_QMMM_FULL;
+        }
+        if (fr->nstpme > 1 && (bRerunMD || do_per_step(step,fr->nstpme)))
+        {
+            force_flags |= GMX_FORCE_PME_MESH;
+        }
         
         if (shellfc)
         {
@@ -1170,16 +1217,8 @@ double do_md(FILE *fplog,t_commrec *cr,int nfile,const t_filenm fnm[],
                 trotter_update(ir,step,ekind,enerd,state,total_vir,mdatoms,&MassQ,trotter_seq,ettTSEQ1);            
             }
 
-            /* If we are using twin-range interactions where the long-range component
-             * is only evaluated every nstcalclr>1 steps, we should do a special update
-             * step to combine the long-range forces on these steps.
-             * For nstcalclr=1 this is not done, since the forces would have been added
-             * directly to the short-range forces already.
-             */
-            bUpdateDoLR = (fr->bTwinRange && do_per_step(step,ir->nstcalclr));
-            
             update_coords(fplog,step,ir,mdatoms,state,fr->bMolPBC,
-                          f,bUpdateDoLR,fr->f_twin,fcd,
+                          f,bUpdateDoLR,f_lr,nstlr,fcd,
                           ekind,M,wcycle,upd,bInitStep,etrtVELOCITY1,
                           cr,nrnb,constr,&top->idef);
             
@@ -1643,11 +1682,9 @@ double do_md(FILE *fplog,t_commrec *cr,int nfile,const t_filenm fnm[],
 
                 if (bVV)
                 {
-                    bUpdateDoLR = (fr->bTwinRange && do_per_step(step,ir->nstcalclr));
-
                     /* velocity half-step update */
                     update_coords(fplog,step,ir,mdatoms,state,fr->bMolPBC,f,
-                                  bUpdateDoLR,fr->f_twin,fcd,
+                                  bUpdateDoLR,f_lr,nstlr,fcd,
                                   ekind,M,wcycle,upd,FALSE,etrtVELOCITY2,
                                   cr,nrnb,constr,&top->idef);
                 }
@@ -1661,10 +1698,9 @@ double do_md(FILE *fplog,t_commrec *cr,int nfile,const t_filenm fnm[],
                 {
                     copy_rvecn(state->x,cbuf,0,state->natoms);
                 }
-                bUpdateDoLR = (fr->bTwinRange && do_per_step(step,ir->nstcalclr));
 
                 update_coords(fplog,step,ir,mdatoms,state,fr->bMolPBC,f,
-                              bUpdateDoLR,fr->f_twin,fcd,
+                              bUpdateDoLR,f_lr,nstlr,fcd,
                               ekind,M,wcycle,upd,bInitStep,etrtPOSITION,cr,nrnb,constr,&top->idef);
                 wallcycle_stop(wcycle,ewcUPDATE);
 
@@ -1689,10 +1725,8 @@ double do_md(FILE *fplog,t_commrec *cr,int nfile,const t_filenm fnm[],
                     /* now we know the scaling, we can compute the positions again again */
                     copy_rvecn(cbuf,state->x,0,state->natoms);
 
-                    bUpdateDoLR = (fr->bTwinRange && do_per_step(step,ir->nstcalclr));
-
                     update_coords(fplog,step,ir,mdatoms,state,fr->bMolPBC,f,
-                                  bUpdateDoLR,fr->f_twin,fcd,
+                                  bUpdateDoLR,f_lr,nstlr,fcd,
                                   ekind,M,wcycle,upd,bInitStep,etrtPOSITION,cr,nrnb,constr,&top->idef);
                     wallcycle_stop(wcycle,ewcUPDATE);
 
@@ -2073,6 +2107,12 @@ double do_md(FILE *fplog,t_commrec *cr,int nfile,const t_filenm fnm[],
             }
         }
 
+        if (bCheckNpme && !(bPMETuneRunning || bPMETuneTry))
+        {
+            dd_check_npme_start(cr->dd);
+            bCheckNpme = FALSE;
+        }
+
         if (step_rel == wcycle_get_reset_counters(wcycle) ||
             gs.set[eglsRESETCOUNTERS] != 0)
         {
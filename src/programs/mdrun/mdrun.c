@@ -140,6 +140,10 @@ int cmain(int argc,char *argv[])
     "builds a Hessian matrix from single conformation.",
     "For usual Normal Modes-like calculations, make sure that",
     "the structure provided is properly energy-minimized.",
+    "On more than one node the displaced geometries are divided over",
+    "the nodes, each computing its rows of the Hessian independently,",
+    "also for QM/MM systems, where every node runs its QM calculations",
+    "in a directory [TT]QMnode<i>[tt].",
     "The generated matrix can be diagonalized by [TT]g_nmeig[tt].[PAR]",
     "The [TT]mdrun[tt] program reads the run input file ([TT]-s[tt])",
     "and distributes the topology over nodes if needed.",
@@ -163,10 +167,11 @@ int cmain(int argc,char *argv[])
     "compiled with the GROMACS built-in thread-MPI library. OpenMP threads",
     "are supported when mdrun is compiled with OpenMP. Full OpenMP support",
     "is only available with the Verlet cut-off scheme, with the (older)",
-    "group scheme only PME-only processes can use OpenMP parallelization.",
+    "group scheme only PME and the non-bonded search and kernels use OpenMP",
+    "and only when threads are requested with [TT]-ntomp[tt].",
     "In all cases [TT]mdrun[tt] will by default try to use all the available",
     "hardware resources. With a normal MPI library only the options",
-    "[TT]-ntomp[tt] (with the Verlet cut-off scheme) and [TT]-ntomp_pme[tt],",
+    "[TT]-ntomp[tt] and [TT]-ntomp_pme[tt],",
     "for PME-only processes, can be used to control the number of threads.",
     "With thread-MPI there are additional options [TT]-nt[tt], which sets",
     "the total number of threads, and [TT]-ntmpi[tt], which sets the number",
@@ -259,6 +264,11 @@ int cmain(int argc,char *argv[])
     "not compatible with the PME grid x dimension.",
     "But the user should optimize npme. Performance statistics on this issue",
     "are written at the end of the log file.",
+    "Early in the run, after the PME tuning, [TT]mdrun[tt] also measures",
+    "the PME/PP load and notes in the log file when a different number of",
+    "PME nodes would be faster. The number of PME nodes is never changed",
+    "during a run, the suggestion can be used when continuing from",
+    "a checkpoint.",
     "For good load balancing at high parallelization, the PME grid x and y",
     "dimensions should be divisible by the number of PME nodes",
     "(the simulation will run correctly also when this is not the case).",
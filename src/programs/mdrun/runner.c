@@ -753,9 +753,9 @@ static void convert_to_verlet_scheme(FILE *fplog,
         gmx_fatal(FARGS,"Can only convert old tpr files to the Verlet cut-off scheme with 3D pbc");
     }
 
-    if (ir->efep != efepNO || ir->implicit_solvent != eisNO)
+    if (ir->implicit_solvent != eisNO)
     {
-        gmx_fatal(FARGS,"Will not convert old tpr files to the Verlet cut-off scheme with free-energy calculations or implicit solvent");
+        gmx_fatal(FARGS,"Will not convert old tpr files to the Verlet cut-off scheme with implicit solvent");
     }
 
     if (EI_DYNAMICS(ir->eI) && !(EI_MD(ir->eI) && ir->etc == etcNO))
@@ -1124,15 +1124,11 @@ static void check_and_update_hw_opt(gmx_hw_opt_t *hw_opt,
     }
 #endif
 
-    if (cutoff_scheme == ecutsGROUP)
+    if (cutoff_scheme == ecutsGROUP && hw_opt->nthreads_omp <= 0)
     {
-        /* We only have OpenMP support for PME only nodes */
-        if (hw_opt->nthreads_omp > 1)
-        {
-            gmx_fatal(FARGS,"OpenMP threads have been requested with cut-off scheme %s, but these are only supported with cut-off scheme %s",
-                      ecutscheme_names[cutoff_scheme],
-                      ecutscheme_names[ecutsVERLET]);
-        }
+        /* With the group scheme only PME and the non-bonded search and
+         * kernels support OpenMP, so we only use threads on request.
+         */
         hw_opt->nthreads_omp = 1;
     }
 
@@ -1910,6 +1906,11 @@ int mdrunner(gmx_hw_opt_t *hw_opt,
             finish_rot(fplog,inputrec->rot);
         }
 
+        if (fr->bQMMM)
+        {
+            done_QMMMrec(fr->qr);
+        }
+
     } 
     else 
     {